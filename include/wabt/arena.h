@@ -0,0 +1,99 @@
+/*
+ * Copyright 2026 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef WABT_ARENA_H_
+#define WABT_ARENA_H_
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "wabt/common.h"
+
+namespace wabt {
+
+template <typename T>
+class ArenaAllocated;
+
+// A bump allocator for IR nodes. Deleting a node that was allocated from an
+// Arena runs its destructor, but its memory is only released when the Arena
+// is destroyed.
+class Arena {
+ public:
+  // Makes `arena` the allocator of the ArenaAllocated objects that are
+  // created on this thread while the Scope is alive. Scopes may be nested.
+  class Scope {
+   public:
+    WABT_DISALLOW_COPY_AND_ASSIGN(Scope);
+    explicit Scope(Arena* arena);
+    ~Scope();
+
+   private:
+    Arena* prev_;
+  };
+
+  // The same alignment that ::operator new guarantees, so a class doesn't
+  // need more alignment when it's allocated from an Arena than from the heap.
+  static constexpr size_t kAlignment = alignof(std::max_align_t);
+
+  Arena();
+  ~Arena();
+  WABT_DISALLOW_COPY_AND_ASSIGN(Arena);
+
+  // Returns memory that is aligned to kAlignment.
+  void* Allocate(size_t size);
+
+  // The number of bytes that have been reserved from the system.
+  size_t capacity() const { return capacity_; }
+
+  // The Arena of the innermost Scope on this thread, or nullptr.
+  static Arena* current();
+
+ private:
+  template <typename T>
+  friend class ArenaAllocated;
+
+  static constexpr size_t kBlockSize = 64 * 1024;
+
+  // Allocate and free an ArenaAllocated object.
+  static void* NewObject(size_t size);
+  static void DeleteObject(void* p);
+
+  std::vector<std::unique_ptr<char[]>> blocks_;
+  char* next_ = nullptr;
+  char* end_ = nullptr;
+  size_t capacity_ = 0;
+};
+
+// A base for the classes whose objects are allocated from the current Arena,
+// if there is one, and from the heap otherwise. T is the derived class.
+// std::unique_ptr is still their owning pointer: each object records where it
+// came from, so deleting it does the right thing either way. Classes derived
+// from T must not need more alignment than T.
+template <typename T>
+class ArenaAllocated {
+ public:
+  static void* operator new(size_t size) {
+    static_assert(alignof(T) <= Arena::kAlignment,
+                  "T needs more alignment than an Arena provides");
+    return Arena::NewObject(size);
+  }
+  static void operator delete(void* p) { Arena::DeleteObject(p); }
+};
+
+}  // namespace wabt
+
+#endif  // WABT_ARENA_H_
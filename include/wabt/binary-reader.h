@@ -50,6 +50,8 @@ struct ReadBinaryOptions {
   bool stop_on_first_error = true;
   bool fail_on_custom_section_error = true;
   bool skip_function_bodies = false;
+  // The number of threads that ReadBinaryIr decodes function bodies on.
+  int num_threads = 1;
 };
 
 // TODO: Move somewhere else?
@@ -519,6 +521,19 @@ Result ReadBinary(ByteSpan data,
                   BinaryReaderDelegate* reader,
                   const ReadBinaryOptions& options);
 
+// Reads the body of one function, e.g. one that was skipped with
+// ReadBinaryOptions::skip_function_bodies. `offset` and `size` are the
+// state->offset and size seen by BeginFunctionBody, and `data_count` is the
+// count from the DataCount section, or kInvalidIndex if it has none. The
+// delegate gets the callbacks from BeginFunctionBody to EndFunctionBody.
+Result ReadBinaryFunctionBody(ByteSpan data,
+                              Index func_index,
+                              Offset offset,
+                              Offset size,
+                              Index data_count,
+                              BinaryReaderDelegate* reader,
+                              const ReadBinaryOptions& options);
+
 size_t ReadU32Leb128(const uint8_t* ptr,
                      const uint8_t* end,
                      uint32_t* out_value);
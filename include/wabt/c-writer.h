@@ -43,6 +43,18 @@ struct WriteCOptions {
       size_t num_imported_functions,
       size_t num_outputs)>
       name_to_output_file_index;
+  // The number of threads that the .c outputs are written on.
+  int num_threads = 1;
+  // If set, the time taken to write the functions of each .c output is
+  // logged to it.
+  Stream* log_stream = nullptr;
+  // If set, the contents of the data segments are written to data_stream
+  // instead of as array literals. The C output reads them back from
+  // data_file_name, with #embed if the C compiler supports it and with the
+  // assembler's .incbin directive otherwise. They resolve a relative path
+  // differently, so data_file_name should be absolute.
+  Stream* data_stream = nullptr;
+  std::string_view data_file_name;
 };
 
 Result WriteC(std::vector<Stream*>&& c_streams,
@@ -27,6 +27,32 @@ struct ReadBinaryOptions;
 
 namespace interp {
 
+// Options that control how function bodies are translated to the istream.
+struct CompileOptions {
+  // Fuse common instruction sequences into superinstructions. The sequences
+  // are listed in src/interp/superinstructions.def.
+  bool superinstructions = true;
+  // Charge each basic block's instruction count against the running
+  // Thread's fuel; see Thread::Options::fuel.
+  bool meter_fuel = false;
+  // Check the Store's epoch at loop headers and function entries, so another
+  // OS thread can interrupt a running Thread; see Store::IncrementEpoch.
+  bool epoch_interruption = false;
+  // Only record where each function body is while the module is read, and
+  // validate and compile it on the function's first call; see
+  // ModuleDesc::compile_func. This makes reading a large module that runs few
+  // of its functions much cheaper, but a function that is never called is
+  // never validated, and an invalid one traps when it is called.
+  bool lazy = false;
+};
+
+Result ReadBinaryInterp(std::string_view filename,
+                        ByteSpan data,
+                        const ReadBinaryOptions& options,
+                        const CompileOptions& compile_options,
+                        Errors*,
+                        ModuleDesc* out_module);
+
 Result ReadBinaryInterp(std::string_view filename,
                         ByteSpan data,
                         const ReadBinaryOptions& options,
@@ -14,8 +14,10 @@
  * limitations under the License.
  */
 
+#include <atomic>
 #include <cassert>
 #include <limits>
+#include <new>
 #include <string>
 
 namespace wabt {
@@ -145,9 +147,6 @@ inline bool FreeList<Ref>::IsUsed(Index index) const {
   return (list_[index].index & refFreeBit) == 0;
 }
 
-template <>
-inline FreeList<Ref>::~FreeList() {}
-
 template <>
 template <typename... Args>
 auto FreeList<Ref>::New(Args&&... args) -> Index {
@@ -181,15 +180,6 @@ bool FreeList<T>::IsUsed(Index index) const {
   return (reinterpret_cast<uintptr_t>(list_[index]) & ptrFreeBit) == 0;
 }
 
-template <typename T>
-FreeList<T>::~FreeList() {
-  for (auto object : list_) {
-    if ((reinterpret_cast<uintptr_t>(object) & ptrFreeBit) == 0) {
-      delete object;
-    }
-  }
-}
-
 template <typename T>
 template <typename... Args>
 auto FreeList<T>::New(Args&&... args) -> Index {
@@ -213,7 +203,6 @@ template <typename T>
 void FreeList<T>::Delete(Index index) {
   assert(IsUsed(index));
 
-  delete list_[index];
   list_[index] = reinterpret_cast<T>((free_head_ << ptrFreeShift) | ptrFreeBit);
   free_head_ = index + 1;
   free_items_++;
@@ -504,14 +493,46 @@ RefPtr<T> Store::UnsafeGet(Ref ref) {
   return RefPtr<T>(*this, ref);
 }
 
+template <typename T>
+T* Store::UnsafeGetUnrooted(Ref ref) {
+  assert(Is<T>(ref));
+  return static_cast<T*>(objects_.Get(ref.index));
+}
+
 template <typename T, typename... Args>
 RefPtr<T> Store::Alloc(Args&&... args) {
-  Ref ref{objects_.New(new T(std::forward<Args>(args)...))};
+  T* object;
+  if constexpr (IsPooled(T::skind)) {
+    static_assert(sizeof(T) <= ObjectPool::kMaxSize);
+    object = new (object_pool_.Allocate(sizeof(T)))
+        T(std::forward<Args>(args)...);
+  } else {
+    object = new T(std::forward<Args>(args)...);
+  }
+  Ref ref{objects_.New(object)};
   RefPtr<T> ptr{*this, ref};
   ptr->self_ = ref;
+  if (WABT_UNLIKELY(objects_.count() >= gc_context_.trigger)) {
+    OnAllocGC(ref);
+  }
   return ptr;
 }
 
+inline void Store::WriteBarrier(Ref ref) {
+  if (WABT_UNLIKELY(gc_context_.phase == GCPhase::Mark) && ref != Ref::Null) {
+    Mark(ref);
+  }
+}
+
+inline void Store::WriteBarrier(RefVec::const_iterator begin,
+                                RefVec::const_iterator end) {
+  if (WABT_UNLIKELY(gc_context_.phase == GCPhase::Mark)) {
+    for (auto iter = begin; iter != end; ++iter) {
+      WriteBarrier(*iter);
+    }
+  }
+}
+
 inline Store::ObjectList::Index Store::object_count() const {
   return objects_.count();
 }
@@ -520,8 +541,12 @@ inline const Features& Store::features() const {
   return features_;
 }
 
-inline std::set<Thread*>& Store::threads() {
-  return threads_;
+inline void Store::IncrementEpoch() {
+  epoch_.fetch_add(1, std::memory_order_relaxed);
+}
+
+inline u64 Store::epoch() const {
+  return epoch_.load(std::memory_order_relaxed);
 }
 
 //// Object ////
@@ -666,6 +691,10 @@ inline const FuncDesc& DefinedFunc::desc() const {
   return desc_;
 }
 
+inline bool DefinedFunc::IsCompiled() const {
+  return desc_.code_offset != Istream::kInvalidOffset;
+}
+
 //// HostFunc ////
 // static
 inline bool HostFunc::classof(const Object* obj) {
@@ -715,10 +744,24 @@ inline Memory::Ptr Memory::New(interp::Store& store, MemoryType type) {
   return store.Alloc<Memory>(store, type);
 }
 
+// static
+inline Memory::Ptr Memory::New(interp::Store& store, const Memory& shared) {
+  if (!shared.shared_) {
+    return {};
+  }
+  return store.Alloc<Memory>(store, shared);
+}
+
+inline bool Memory::IsShared() const {
+  return type_.limits.is_shared;
+}
+
 inline bool Memory::IsValidAccess(u64 offset, u64 addend, u64 size) const {
-  // FIXME: make this faster.
-  return offset <= data_.size() && addend <= data_.size() &&
-         size <= data_.size() && offset + addend + size <= data_.size();
+  // A shared memory may have been grown through another Memory object, so
+  // its size is read from the storage.
+  u64 mem_size = ByteSize();
+  return offset <= mem_size && addend <= mem_size && size <= mem_size &&
+         offset + addend + size <= mem_size;
 }
 
 inline bool Memory::IsValidAtomicAccess(u64 offset,
@@ -728,13 +771,17 @@ inline bool Memory::IsValidAtomicAccess(u64 offset,
          ((offset + addend) & (size - 1)) == 0;
 }
 
+inline bool Memory::IsGuarded() const {
+  return guarded_;
+}
+
 template <typename T>
 Result Memory::Load(u64 offset, u64 addend, T* out) const {
   if (!IsValidAccess(offset, addend, sizeof(T))) {
     return Result::Error;
   }
-  MemcpyEndianAware(out, data_.data(), sizeof(T), data_.size(), 0,
-                    offset + addend, sizeof(T));
+  MemcpyEndianAware(out, data_, sizeof(T), size_, 0, offset + addend,
+                    sizeof(T));
   return Result::Ok;
 }
 
@@ -742,8 +789,8 @@ template <typename T>
 T WABT_VECTORCALL Memory::UnsafeLoad(u64 offset, u64 addend) const {
   assert(IsValidAccess(offset, addend, sizeof(T)));
   T val;
-  MemcpyEndianAware(&val, data_.data(), sizeof(T), data_.size(), 0,
-                    offset + addend, sizeof(T));
+  MemcpyEndianAware(&val, data_, sizeof(T), size_, 0, offset + addend,
+                    sizeof(T));
   return val;
 }
 
@@ -752,18 +799,28 @@ Result WABT_VECTORCALL Memory::Store(u64 offset, u64 addend, T val) {
   if (!IsValidAccess(offset, addend, sizeof(T))) {
     return Result::Error;
   }
-  MemcpyEndianAware(data_.data(), &val, data_.size(), sizeof(T),
-                    offset + addend, 0, sizeof(T));
+  MemcpyEndianAware(data_, &val, size_, sizeof(T), offset + addend, 0,
+                    sizeof(T));
   return Result::Ok;
 }
 
+template <typename T>
+T* Memory::AtomicAddress(u64 offset, u64 addend) const {
+  // The access is aligned, so it doesn't straddle the bytes of two values,
+  // even when the memory is stored in reverse.
+#if WABT_BIG_ENDIAN
+  return reinterpret_cast<T*>(data_ + size_ - offset - addend - sizeof(T));
+#else
+  return reinterpret_cast<T*>(data_ + offset + addend);
+#endif
+}
+
 template <typename T>
 Result Memory::AtomicLoad(u64 offset, u64 addend, T* out) const {
   if (!IsValidAtomicAccess(offset, addend, sizeof(T))) {
     return Result::Error;
   }
-  MemcpyEndianAware(out, data_.data(), sizeof(T), data_.size(), 0,
-                    offset + addend, sizeof(T));
+  *out = std::atomic_ref<T>(*AtomicAddress<T>(offset, addend)).load();
   return Result::Ok;
 }
 
@@ -772,16 +829,19 @@ Result Memory::AtomicStore(u64 offset, u64 addend, T val) {
   if (!IsValidAtomicAccess(offset, addend, sizeof(T))) {
     return Result::Error;
   }
-  MemcpyEndianAware(data_.data(), &val, data_.size(), sizeof(T),
-                    offset + addend, 0, sizeof(T));
+  std::atomic_ref<T>(*AtomicAddress<T>(offset, addend)).store(val);
   return Result::Ok;
 }
 
 template <typename T, typename F>
 Result Memory::AtomicRmw(u64 offset, u64 addend, T rhs, F&& func, T* out) {
-  T lhs;
-  CHECK_RESULT(AtomicLoad(offset, addend, &lhs));
-  CHECK_RESULT(AtomicStore(offset, addend, func(lhs, rhs)));
+  if (!IsValidAtomicAccess(offset, addend, sizeof(T))) {
+    return Result::Error;
+  }
+  std::atomic_ref<T> ref(*AtomicAddress<T>(offset, addend));
+  T lhs = ref.load(std::memory_order_relaxed);
+  while (!ref.compare_exchange_weak(lhs, func(lhs, rhs))) {
+  }
   *out = lhs;
   return Result::Ok;
 }
@@ -792,25 +852,26 @@ Result Memory::AtomicRmwCmpxchg(u64 offset,
                                 T expect,
                                 T replace,
                                 T* out) {
-  T read;
-  CHECK_RESULT(AtomicLoad(offset, addend, &read));
-  if (read == expect) {
-    CHECK_RESULT(AtomicStore(offset, addend, replace));
+  if (!IsValidAtomicAccess(offset, addend, sizeof(T))) {
+    return Result::Error;
   }
-  *out = read;
+  std::atomic_ref<T>(*AtomicAddress<T>(offset, addend))
+      .compare_exchange_strong(expect, replace);
+  *out = expect;
   return Result::Ok;
 }
 
 inline u8* Memory::UnsafeData() {
-  return data_.data();
+  return data_;
 }
 
 inline u64 Memory::ByteSize() const {
-  return data_.size();
+  return WABT_UNLIKELY(shared_ != nullptr) ? SharedByteSize() : size_;
 }
 
 inline u64 Memory::PageSize() const {
-  return pages_;
+  return WABT_UNLIKELY(shared_ != nullptr) ? SharedByteSize() / type_.page_size
+                                          : pages_;
 }
 
 inline const ExternType& Memory::extern_type() {
@@ -0,0 +1,115 @@
+/*
+ * Copyright 2026 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef WABT_INTERP_PROFILE_H_
+#define WABT_INTERP_PROFILE_H_
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "wabt/interp/interp.h"
+
+namespace wabt {
+
+class Stream;
+
+namespace interp {
+
+// Counts the instructions executed by the Threads that were created with
+// Thread::Options::profile. Every instruction is attributed to the call stack
+// it ran in, so the counts are exact rather than sampled. The opcodes are the
+// istream's, so superinstructions are counted as they were compiled.
+//
+// A Profile may be shared by several Threads, as long as they don't run at the
+// same time.
+class Profile {
+ public:
+  static constexpr size_t kDefaultMaxHotLoops = 10;
+
+  struct FuncStats {
+    std::string name;
+    u64 calls = 0;
+    // Instructions executed by the function itself.
+    u64 self = 0;
+    // Instructions executed while the function was on the call stack.
+    // Recursive activations are only counted once.
+    u64 total = 0;
+  };
+
+  struct LoopStats {
+    Index func;  // Index into the vector returned by GetFuncStats.
+    Istream::Offset offset;  // The loop header.
+    u64 iterations;
+  };
+
+  Profile();
+  ~Profile();
+
+  u64 instruction_count() const { return instruction_count_; }
+  u64 GetOpcodeCount(Opcode) const;
+  // In the order that the functions were first called.
+  std::vector<FuncStats> GetFuncStats() const;
+  // The loops whose back-edges were taken most often, most iterated first.
+  std::vector<LoopStats> GetHotLoops(size_t max_count) const;
+
+  // Writes a line for each call stack that executed instructions, e.g.
+  // `_start;main;fac 1234`, as read by flamegraph.pl.
+  void WriteFoldedStacks(Stream*) const;
+  void WriteJson(Stream*, size_t max_hot_loops = kDefaultMaxHotLoops) const;
+
+ private:
+  friend Thread;
+
+  struct Node;
+
+  // Called when a call is pushed from outside the interpreter at
+  // `frames[depth]`.
+  void OnCall(size_t depth);
+  // Called before each instruction is executed.
+  void OnInstruction(const std::vector<Frame>& frames, Opcode);
+
+  Index GetFuncIndex(const std::vector<Frame>& frames, size_t depth);
+  std::string GetFuncName(const std::vector<Frame>& frames, size_t depth);
+
+  // Adds the instructions executed at and below `node` to the totals of the
+  // functions on the path, and returns them.
+  static u64 AddTotals(const Node&,
+                       std::vector<u32>* active,
+                       std::vector<FuncStats>* out_stats);
+  static void WriteFoldedStacks(Stream*,
+                                const std::vector<FuncStats>&,
+                                const Node&,
+                                std::string* path);
+
+  std::unique_ptr<Node> root_;
+  // The nodes for the current call stack.
+  std::vector<Node*> stack_;
+  std::vector<FuncStats> funcs_;
+  // Indexes into funcs_, keyed by the index of the function's Ref.
+  std::map<size_t, Index> func_indexes_;
+  std::vector<u64> opcode_counts_;
+  std::map<std::pair<Index, Istream::Offset>, u64> loops_;
+  u64 instruction_count_ = 0;
+  Istream::Offset last_offset_ = 0;
+};
+
+}  // namespace interp
+}  // namespace wabt
+
+#endif  // WABT_INTERP_PROFILE_H_
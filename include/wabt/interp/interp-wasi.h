@@ -36,7 +36,8 @@ Result WasiBindImports(const Module::Ptr& module,
 Result WasiRunStart(const Instance::Ptr& instance,
                     uvwasi_s* uvwasi,
                     Stream* stream,
-                    Stream* trace_stream);
+                    Stream* trace_stream,
+                    Profile* profile = nullptr);
 
 }  // namespace interp
 }  // namespace wabt
@@ -17,10 +17,14 @@
 #ifndef WABT_INTERP_H_
 #define WABT_INTERP_H_
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <limits>
+#include <map>
 #include <memory>
-#include <set>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -45,7 +49,9 @@ class DataSegment;
 class ElemSegment;
 class Module;
 class Instance;
+class InstanceSnapshot;
 class Thread;
+class Profile;
 template <typename T>
 class RefPtr;
 
@@ -326,14 +332,31 @@ struct HandlerDesc {
   bool catch_all_ref = false;
 };
 
+// The value stack slots of a function's frame that hold references, from
+// `offset` up to the offset of the next stack map. Slots are numbered from the
+// function's first param, so the locals come first, followed by the operand
+// stack.
+struct StackMapDesc {
+  u32 offset;             // Istream offset.
+  std::vector<u32> refs;  // Sorted.
+};
+
 struct FuncDesc {
   // Includes params.
   ValueType GetLocalType(Index) const;
+  // Returns the stack map that describes the frame when it is at `offset`, or
+  // nullptr if there is none.
+  const StackMapDesc* GetStackMap(u32 offset) const;
 
   FuncType type;
   std::vector<LocalDesc> locals;
   u32 code_offset;  // Istream offset.
   std::vector<HandlerDesc> handlers;
+  std::vector<StackMapDesc> stack_maps;  // Sorted by offset.
+  // The index in ModuleDesc::funcs of a function that is compiled on its
+  // first call; see CompileOptions::lazy. Its code_offset is kInvalidOffset
+  // until then.
+  Index lazy_index = kInvalidIndex;
 };
 
 struct TableDesc {
@@ -391,6 +414,13 @@ struct ModuleDesc {
   std::vector<ElemDesc> elems;
   std::vector<DataDesc> datas;
   Istream istream;
+
+  // Set when the function bodies are compiled on their first call. Appends
+  // the body of funcs[index] to `module`'s istream and fills in its FuncDesc.
+  // `module` is this ModuleDesc or a copy of it.
+  using CompileFuncCallback = std::function<
+      Result(ModuleDesc* module, Index index, std::string* out_error)>;
+  CompileFuncCallback compile_func;
 };
 
 //// Runtime ////
@@ -415,13 +445,12 @@ struct Frame {
   Module* mod;
 };
 
+// Delete only frees the slot; the owner of the elements destroys them.
 template <typename T>
 class FreeList {
  public:
   using Index = size_t;
 
-  ~FreeList();
-
   template <typename... Args>
   Index New(Args&&...);
   void Delete(Index);
@@ -453,12 +482,71 @@ class FreeList {
   Index free_items_ = 0;
 };
 
+// Allocates small objects from 64KiB slabs, with a free list per slab. Each
+// slab holds objects of a single size class, and is found from an object's
+// address by alignment, so Free doesn't need the size.
+class ObjectPool {
+ public:
+  static constexpr size_t kMaxSize = 512;
+
+  ObjectPool() = default;
+  ~ObjectPool();
+
+  ObjectPool(const ObjectPool&) = delete;
+  ObjectPool& operator=(const ObjectPool&) = delete;
+
+  void* Allocate(size_t size);
+  void Free(void*);
+  // Returns the slabs that have no objects left to the system allocator,
+  // except for one per size class.
+  void ReleaseEmptySlabs();
+
+  size_t slab_count() const { return slabs_.size(); }
+
+ private:
+  static constexpr size_t kSlabSize = 64 * 1024;
+  static constexpr size_t kGranularity = alignof(std::max_align_t);
+  static constexpr size_t kNumSizeClasses = kMaxSize / kGranularity;
+
+  struct Slab;
+
+  Slab* NewSlab(size_t size_class);
+  void LinkAvailable(Slab*);
+  void UnlinkAvailable(Slab*);
+
+  // The slabs of each size class that have a free slot.
+  Slab* available_[kNumSizeClasses] = {};
+  std::vector<Slab*> slabs_;
+};
+
 class Store {
  public:
   using ObjectList = FreeList<Object*>;
   using RootList = FreeList<Ref>;
 
+  struct GCOptions {
+    // Collect incrementally as objects are allocated, once the number of
+    // objects has grown by `growth_factor` since the last collection. Objects
+    // that are only referenced by a Ref (rather than a RefPtr) held outside
+    // the store may then be freed by any allocation.
+    bool automatic = false;
+    double growth_factor = 2.0;
+    // Don't collect automatically while there are fewer objects than this.
+    size_t min_objects = 4096;
+    // The number of objects that each increment marks or sweeps.
+    size_t slice_size = 256;
+  };
+
+  struct GCStats {
+    u64 collections = 0;
+    u64 increments = 0;
+    u64 objects_freed = 0;
+    std::chrono::nanoseconds total_pause{0};
+    std::chrono::nanoseconds max_pause{0};
+  };
+
   explicit Store(const Features& = Features{});
+  ~Store();
 
   Store(const Store&) = delete;
   Store& operator=(const Store&) = delete;
@@ -475,38 +563,120 @@ class Store {
   Result Get(Ref, RefPtr<T>* out);
   template <typename T>
   RefPtr<T> UnsafeGet(Ref);
+  // Like UnsafeGet, but the object isn't rooted. The caller must make sure
+  // it stays reachable while the pointer is used.
+  template <typename T>
+  T* UnsafeGetUnrooted(Ref);
 
   RootList::Index NewRoot(Ref);
   RootList::Index CopyRoot(RootList::Index);
   void DeleteRoot(RootList::Index);
 
+  // Finishes the collection in progress, if any, and then does a full one.
   void Collect();
+  // Does one increment of work on the collection in progress, starting one
+  // if there is none. Returns true once the collection has finished.
+  bool CollectIncrement();
   void Mark(Ref);
   void Mark(const RefVec&);
+  // Must be called when `ref` is stored in an object, unless the object was
+  // just allocated. While marking, this makes sure `ref` is traced, even if the
+  // object has already been.
+  void WriteBarrier(Ref ref);
+  void WriteBarrier(RefVec::const_iterator begin, RefVec::const_iterator end);
+
+  const GCOptions& gc_options() const { return gc_options_; }
+  void SetGCOptions(const GCOptions&);
+  const GCStats& gc_stats() const { return gc_stats_; }
 
   ObjectList::Index object_count() const;
+  // The slabs that hold the pooled objects; see IsPooled.
+  size_t object_pool_slab_count() const { return object_pool_.slab_count(); }
 
   const Features& features() const;
   void setFeatures(const Features& features) { features_ = features; }
 
-  std::set<Thread*>& threads();
+  // Whether the 32-bit memories created from now on are guarded, if the
+  // platform supports it; see Memory::IsGuarded. Off by default, since each
+  // guarded memory reserves 4GiB of address space.
+  bool guard_memories() const { return guard_memories_; }
+  void SetGuardMemories(bool guard) { guard_memories_ = guard; }
+
+  // Threads with the default options are pooled, so a call through
+  // Func::Call doesn't allocate a new stack. A Thread taken from the pool
+  // must be given back once its call has finished; it is reset then.
+  std::unique_ptr<Thread> AcquireThread();
+  void ReleaseThread(std::unique_ptr<Thread>);
+
+  // The epoch may be advanced from any OS thread. Code compiled with
+  // CompileOptions::epoch_interruption checks it at loop headers and function
+  // entries, where Run returns RunResult::Interrupted once it has reached the
+  // Thread's deadline. A Thread blocked in memory.atomic.wait isn't
+  // interrupted; see Memory::AtomicWait.
+  void IncrementEpoch();
+  u64 epoch() const;
 
  private:
   template <typename T>
   friend class RefPtr;
+  friend Thread;
+
+  enum class GCPhase { Idle, Mark, Sweep };
 
   struct GCContext {
-    int call_depth = 0;
+    GCPhase phase = GCPhase::Idle;
     std::vector<bool> marks;
-    std::vector<size_t> untraced_objects;
+    // Objects that are marked but haven't been traced yet.
+    std::vector<size_t> mark_stack;
+    size_t sweep_index = 0;
+    size_t sweep_end = 0;
+    // Alloc calls OnAllocGC once the object count reaches this. It is zero
+    // while a collection is in progress, so new objects can be marked.
+    size_t trigger = SIZE_MAX;
+    // Non-zero while a Thread is executing, except in host calls. The stack
+    // maps only describe the value stack between instructions.
+    int blocked = 0;
   };
 
-  static const int max_call_depth = 10;
+  // Traps, exceptions, globals, foreign objects and host functions are
+  // created often (e.g. for each throw, or by an embedder for each call), so
+  // they are allocated from object_pool_ rather than individually.
+  static constexpr bool IsPooled(ObjectKind kind) {
+    return kind == ObjectKind::Trap || kind == ObjectKind::Exception ||
+           kind == ObjectKind::Global || kind == ObjectKind::Foreign ||
+           kind == ObjectKind::HostFunc;
+  }
+
+  void DeleteObject(ObjectList::Index);
+
+  void AddThread(Thread*);
+  void RemoveThread(Thread*);
+
+  // Automatic collection is blocked while a Thread executes.
+  void BlockGC();
+  void UnblockGC();
+  // Called by the executing Thread between instructions.
+  void GCSafePoint();
+  void OnAllocGC(Ref);
+  void RecordPause(std::chrono::steady_clock::time_point start);
+  void MarkRoots();
+  void StartCollection();
+  void FinishMarking();
+  // Traces or sweeps up to `budget` objects. Returns true once the collection
+  // has finished.
+  bool DoCollectionWork(size_t budget);
+  void UpdateTrigger();
 
   Features features_;
+  bool guard_memories_ = false;
+  GCOptions gc_options_;
+  GCStats gc_stats_;
   GCContext gc_context_;
-  // This set contains the currently active Thread objects.
-  std::set<Thread*> threads_;
+  // The live Thread objects, linked through Thread::next_thread_.
+  Thread* threads_ = nullptr;
+  std::vector<std::unique_ptr<Thread>> thread_pool_;
+  std::atomic<u64> epoch_{0};
+  ObjectPool object_pool_;
   ObjectList objects_;
   RootList roots_;
 };
@@ -770,6 +940,10 @@ class DefinedFunc : public Func {
   Ref instance() const;
   const FuncDesc& desc() const;
 
+  // False until a function that is compiled lazily is first called.
+  bool IsCompiled() const;
+  Result Compile(Store&, std::string* out_error);
+
  protected:
   Result DoCall(Thread& thread,
                 const Values& params,
@@ -855,6 +1029,7 @@ class Table : public Extern {
 
  private:
   friend Store;
+  friend Instance;
   explicit Table(Store&, TableType, Ref);
   void Mark(Store&) override;
 
@@ -870,17 +1045,33 @@ class Memory : public Extern {
   using Ptr = RefPtr<Memory>;
 
   static Memory::Ptr New(Store&, MemoryType);
+  // Creates a Memory in `store` that uses the same storage as `shared`, so
+  // that Threads of different Stores can run on different OS threads with the
+  // same memory. `shared` must be a shared memory, and guarded; otherwise
+  // this returns an empty Ptr.
+  static Memory::Ptr New(Store& store, const Memory& shared);
 
   Result Match(Store&, const ImportType&, Trap::Ptr* out_trap) override;
 
+  bool IsShared() const;
   bool IsValidAccess(u64 offset, u64 addend, u64 size) const;
   bool IsValidAtomicAccess(u64 offset, u64 addend, u64 size) const;
 
+  // A guarded memory is backed by an address space reservation that is large
+  // enough for the largest 32-bit memory, with everything past ByteSize()
+  // inaccessible. Grow makes more of the reservation accessible in place, so
+  // the data never moves, which lets Stores on other OS threads share it.
+  // Accesses are still bounds checked. Memories are only guarded if their
+  // Store's guard_memories() is set.
+  bool IsGuarded() const;
+
   template <typename T>
   Result Load(u64 offset, u64 addend, T* out) const;
   template <typename T>
   Result WABT_VECTORCALL Store(u64 offset, u64 addend, T);
-  Result Grow(u64 pages);
+  // Also returns the size before growing, which for a shared memory may be
+  // different from PageSize() if it grows on another OS thread.
+  Result Grow(u64 pages, u64* out_old_pages = nullptr);
   Result Fill(u64 offset, u8 value, u64 size);
   Result Init(u64 dst_offset, const DataSegment&, u64 src_offset, u64 size);
   static Result Copy(Memory& dst,
@@ -889,7 +1080,8 @@ class Memory : public Extern {
                      u64 src_offset,
                      u64 size);
 
-  // Fake atomics; just checks alignment.
+  // Atomic accesses are sequentially consistent, and fail if they are
+  // misaligned.
   template <typename T>
   Result AtomicLoad(u64 offset, u64 addend, T* out) const;
   template <typename T>
@@ -898,6 +1090,17 @@ class Memory : public Extern {
   Result AtomicRmw(u64 offset, u64 addend, T, F&& func, T* out);
   template <typename T>
   Result AtomicRmwCmpxchg(u64 offset, u64 addend, T expect, T replace, T* out);
+  // Blocks the calling OS thread until AtomicNotify wakes it, or until
+  // `timeout` nanoseconds have passed, unless it is negative. `out` is set to
+  // the result of memory.atomic.wait: 0 if woken, 1 if the value wasn't
+  // `expected`, or 2 if timed out. The memory must be shared.
+  //
+  // The wait doesn't use fuel, and isn't interrupted by Store::IncrementEpoch;
+  // a wait without a timeout only returns once it is notified.
+  template <typename T>
+  Result AtomicWait(u64 offset, u64 addend, T expected, s64 timeout, u32* out);
+  // Wakes up to `count` waiters, and sets `out` to the number woken.
+  Result AtomicNotify(u64 offset, u64 addend, u32 count, u32* out);
 
   u64 ByteSize() const;
   u64 PageSize() const;
@@ -910,14 +1113,38 @@ class Memory : public Extern {
   const ExternType& extern_type() override;
   const MemoryType& type() const;
 
+  ~Memory() override;
+
  private:
   friend class Store;
+  friend class Thread;
+  friend class Instance;
+  // The reservation of a guarded shared memory, which may be used by Memory
+  // objects in several Stores.
+  struct SharedStorage;
+
   explicit Memory(class Store&, MemoryType);
+  explicit Memory(class Store&, const Memory& shared);
   void Mark(class Store&) override;
 
+  bool Reserve();
+  u64 SharedByteSize() const;
+  template <typename T>
+  T* AtomicAddress(u64 offset, u64 addend) const;
+  // Replaces the contents with those captured by an InstanceSnapshot, either
+  // in the memfd `fd` or, if `fd` is -1, in `data`.
+  Result InitFromImage(int fd, const Buffer& data);
+
   MemoryType type_;
-  Buffer data_;
+  u8* data_ = nullptr;
+  u64 size_ = 0;
+  Buffer buffer_;  // Backs the memory when it isn't guarded.
   u64 pages_;
+  bool guarded_ = false;
+  // Set for a guarded shared memory. size_ and pages_ may then be smaller
+  // than the size in the storage, if the memory was grown through another
+  // Memory object.
+  std::shared_ptr<SharedStorage> shared_;
 };
 
 class Global : public Extern {
@@ -937,6 +1164,8 @@ class Global : public Extern {
   template <typename T>
   Result WABT_VECTORCALL Set(T);
   void Set(Store&, Ref);
+  // Like UnsafeSet, but stores of references go through the write barrier.
+  void Set(Store&, Value);
 
   template <typename T>
   T WABT_VECTORCALL UnsafeGet() const;
@@ -989,6 +1218,7 @@ class ElemSegment {
 
  private:
   friend Instance;
+  ElemSegment(const ElemDesc*, RefVec elements);
   void Mark(Store&);
 
   const ElemDesc* desc_;  // Borrowed from the Module.
@@ -1023,6 +1253,9 @@ class Module : public Object {
   const std::vector<ImportType>& import_types() const;
   const std::vector<ExportType>& export_types() const;
 
+  // Compiles desc().funcs[index], unless that has already been done.
+  Result CompileFunc(Index index, std::string* out_error);
+
  private:
   friend Store;
   friend Instance;
@@ -1045,6 +1278,11 @@ class Instance : public Object {
                                    Ref module,
                                    const RefVec& imports,
                                    Trap::Ptr* out_trap);
+  // Creates a copy of the instance that `snapshot` captured. Its
+  // initializers, segments and start function aren't run again.
+  static Instance::Ptr Instantiate(Store&,
+                                   const InstanceSnapshot& snapshot,
+                                   Trap::Ptr* out_trap);
 
   Ref module() const;
   const RefVec& imports() const;
@@ -1070,6 +1308,8 @@ class Instance : public Object {
                       const Ref func_ref,
                       Value* result,
                       Trap::Ptr* out_trap);
+  void AddImport(Store&, ExternKind, Ref);
+  void InitExports(const ModuleDesc&);
 
   Ref module_;
   RefVec imports_;
@@ -1083,11 +1323,77 @@ class Instance : public Object {
   std::vector<DataSegment> datas_;
 };
 
+// The state of an initialized Instance, from which copies of it can be
+// instantiated cheaply. Each copy gets its own memories, tables, globals and
+// tags with the captured contents, and shares the original's imports.
+// References to the original's own functions are replaced with references to
+// the copy's. Where the platform supports it, the memories of the copies map
+// the captured contents copy-on-write from a memfd, so instantiating a copy
+// only costs the pages that it touches.
+class InstanceSnapshot {
+ public:
+  // `inst` must not be running.
+  InstanceSnapshot(Store&, const Instance& inst);
+  ~InstanceSnapshot();
+
+  InstanceSnapshot(const InstanceSnapshot&) = delete;
+  InstanceSnapshot& operator=(const InstanceSnapshot&) = delete;
+
+ private:
+  friend Instance;
+
+  struct MemoryImage {
+    explicit MemoryImage(const MemoryType& type) : type(type) {}
+
+    MemoryType type;
+    int fd = -1;  // A memfd with the contents, or -1.
+    Buffer data;  // The contents, if there is no memfd.
+  };
+
+  // Captured references. The original instance's own functions are stored
+  // as Ref::Null, and listed in `funcs` with their function index.
+  struct RefImage {
+    RefVec refs;
+    std::vector<std::pair<Index, Index>> funcs;  // Position, function index.
+  };
+
+  struct TableImage {
+    TableType type;
+    RefImage elements;
+  };
+
+  struct GlobalImage {
+    GlobalType type;
+    Value value;
+    Index func = kInvalidIndex;  // If the value is an own function.
+  };
+
+  // Maps the index of each of the original instance's own functions to its
+  // function index.
+  using FuncIndexMap = std::map<size_t, Index>;
+
+  Ref CaptureRef(Ref, const FuncIndexMap&, Index* out_func);
+  RefImage CaptureRefs(const RefVec&, const FuncIndexMap&);
+
+  Store& store_;
+  Module::Ptr module_;
+  RefVec imports_;
+  // The imports and every other object that the captured state refers to.
+  std::vector<Object::Ptr> roots_;
+  std::vector<MemoryImage> memories_;
+  std::vector<TableImage> tables_;
+  std::vector<GlobalImage> globals_;
+  std::vector<RefImage> elems_;
+  std::vector<bool> dropped_datas_;
+};
+
 enum class RunResult {
   Ok,
   Return,
   Trap,
   Exception,
+  OutOfFuel,
+  Interrupted,
 };
 
 class Thread {
@@ -1096,18 +1402,56 @@ class Thread {
     static constexpr u32 kDefaultValueStackSize = 64 * 1024 / sizeof(Value);
     static constexpr u32 kDefaultCallStackSize = 64 * 1024 / sizeof(Frame);
 
+    static constexpr u64 kUnlimitedFuel = std::numeric_limits<s64>::max();
+    static constexpr u64 kNoEpochDeadline = std::numeric_limits<u64>::max();
+
     u32 value_stack_size = kDefaultValueStackSize;
     u32 call_stack_size = kDefaultCallStackSize;
     Stream* trace_stream = nullptr;
+    // Code compiled with CompileOptions::meter_fuel consumes one unit of fuel
+    // per instruction. The cost of a basic block is charged when it is
+    // entered, and the fuel is checked at loop headers and function entries,
+    // where Run returns RunResult::OutOfFuel once it has run out.
+    u64 fuel = kUnlimitedFuel;
+    // The thread is interrupted once the Store's epoch reaches this value.
+    u64 epoch_deadline = kNoEpochDeadline;
+    // Count every instruction that the thread executes; see Profile. Like
+    // tracing, this runs one instruction at a time.
+    Profile* profile = nullptr;
   };
 
   Thread(Store& store, Stream* trace_stream = nullptr);
+  Thread(Store& store, const Options&);
   ~Thread();
 
+  Thread(const Thread&) = delete;
+  Thread& operator=(const Thread&) = delete;
+
+  // Push a call to `func` without running it. The call can then be driven
+  // with Run() or Step(), which return RunResult::Return once it finishes.
+  RunResult PushCall(const DefinedFunc& func,
+                     const Values& params,
+                     Trap::Ptr* out_trap);
+  // Pops the results of a call pushed with PushCall, after it has returned.
+  void PopResults(const DefinedFunc& func, Values* out_results);
+
   RunResult Run(Trap::Ptr* out_trap);
   RunResult Run(int num_instructions, Trap::Ptr* out_trap);
   RunResult Step(Trap::Ptr* out_trap);
 
+  // A call that ran out of fuel is resumed by adding fuel and calling Run
+  // again.
+  void AddFuel(u64);
+  u64 GetFuel() const;
+  // This may exceed the fuel that was given by the cost of the blocks that
+  // were entered since the last check.
+  u64 GetFuelConsumed() const;
+
+  // An interrupted call is resumed by calling Run again. It runs until the
+  // next check, so the deadline should usually be moved first.
+  void SetEpochDeadline(u64);
+  u64 GetEpochDeadline() const;
+
   Store& store();
   void Mark();
 
@@ -1119,10 +1463,16 @@ class Thread {
 
   struct TraceSource;
 
+  // Clears the stacks and restores the default fuel and epoch deadline, for
+  // reuse from the Store's pool.
+  void Reset();
+
   RunResult PushCall(Ref func, u32 offset, Trap::Ptr* out_trap);
   RunResult PushCall(const DefinedFunc&, Trap::Ptr* out_trap);
   RunResult PushCall(const HostFunc&, Trap::Ptr* out_trap);
+  RunResult CompileFunc(DefinedFunc&, Trap::Ptr* out_trap);
   RunResult PopCall();
+  void PopTrappedCall();
   RunResult DoCall(const Func::Ptr&, Trap::Ptr* out_trap);
   RunResult DoReturnCall(const Func::Ptr&, Trap::Ptr* out_trap);
 
@@ -1136,6 +1486,7 @@ class Thread {
   Value Pop();
   u64 PopPtr(const Memory::Ptr& memory);
   u64 PopPtr(const Table::Ptr& table);
+  u64 PickPtr(const Memory& memory, Index);
   void PushPtr(const Memory::Ptr& memory, u64 value);
   void PushPtr(const Table::Ptr& table, u64 value);
 
@@ -1167,8 +1518,13 @@ class Thread {
   template <typename R, typename T>
   RunResult DoReinterpret();
 
+  // The memory isn't rooted; it is kept alive by the current instance.
+  Memory& GetMemory(Index memidx);
+
+  // Memory accesses leave their operands on the stack until the access has
+  // succeeded.
   template <typename T>
-  RunResult Load(Instr, T* out, Trap::Ptr* out_trap);
+  RunResult Load(Memory&, u64 offset, u64 addend, T* out, Trap::Ptr* out_trap);
   template <typename T, typename V = T>
   RunResult DoLoad(Instr, Trap::Ptr* out_trap);
   template <typename T, typename V = T>
@@ -1246,14 +1602,21 @@ class Thread {
   RunResult DoAtomicRmw(BinopFunc<T, T>, Instr, Trap::Ptr* out_trap);
   template <typename T, typename V = T>
   RunResult DoAtomicRmwCmpxchg(Instr, Trap::Ptr* out_trap);
+  template <typename T>
+  RunResult DoAtomicWait(Instr, Trap::Ptr* out_trap);
+  RunResult DoAtomicNotify(Instr, Trap::Ptr* out_trap);
 
   RunResult DoThrow(Exception::Ptr exn_ref);
 
   RunResult StepInternal(Trap::Ptr* out_trap);
+  // Execute at most `num_instructions` instructions without tracing. Returns
+  // RunResult::Ok when the budget is exhausted. Without a budget, instructions
+  // aren't counted at all.
+  template <bool kHasBudget>
+  RunResult Execute(int num_instructions, Trap::Ptr* out_trap);
 
   std::vector<Frame> frames_;
   std::vector<Value> values_;
-  std::vector<u32> refs_;  // Index into values_.
 
   // Exception handling requires tracking a separate stack of caught
   // exceptions for catch blocks.
@@ -1261,12 +1624,22 @@ class Thread {
 
   // Cached for convenience.
   Store& store_;
+  Thread* prev_thread_ = nullptr;
+  Thread* next_thread_ = nullptr;
   Instance* inst_ = nullptr;
   Module* mod_ = nullptr;
 
+  // Negative once the fuel has run out.
+  s64 fuel_;
+  u64 fuel_added_;
+  u64 epoch_deadline_;
+
   // Tracing.
   Stream* trace_stream_;
   std::unique_ptr<TraceSource> trace_source_;
+
+  // Profiling.
+  Profile* profile_;
 };
 
 struct Thread::TraceSource : Istream::TraceSource {
@@ -17,7 +17,10 @@
 #ifndef WABT_INTERP_ISTREAM_H_
 #define WABT_INTERP_ISTREAM_H_
 
+#include <array>
+#include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <string>
 #include <vector>
 
@@ -43,32 +46,37 @@ using ValueType = wabt::Type;
 // simplify instruction decoding, disassembling, and tracing. There is an
 // example of an instruction that uses this encoding on the right.
 enum class InstrKind {
-  Imm_0_Op_0,                  // Nop
-  Imm_0_Op_1,                  // i32.eqz
-  Imm_0_Op_2,                  // i32.add
-  Imm_0_Op_3,                  // select
-  Imm_Jump_Op_0,               // br
-  Imm_Jump_Op_1,               // br_if
-  Imm_Index_Op_0,              // global.get
-  Imm_Index_Op_1,              // global.set
-  Imm_Index_Op_2,              // table.set
-  Imm_Index_Op_3,              // memory.fill
-  Imm_Index_Op_N,              // call
-  Imm_Index_Index_Op_3,        // memory.init
-  Imm_Index_Index_Op_N,        // call_indirect
-  Imm_Index_Offset_Op_1,       // i32.load
-  Imm_Index_Offset_Op_2,       // i32.store
-  Imm_Index_Offset_Op_3,       // i32.atomic.rmw.cmpxchg
-  Imm_Index_Offset_Lane_Op_2,  // v128.load8_lane
-  Imm_I32_Op_0,                // i32.const
-  Imm_I64_Op_0,                // i64.const
-  Imm_F32_Op_0,                // f32.const
-  Imm_F64_Op_0,                // f64.const
-  Imm_I32_I32_Op_0,            // drop_keep
-  Imm_I8_Op_1,                 // i32x4.extract_lane
-  Imm_I8_Op_2,                 // i32x4.replace_lane
-  Imm_V128_Op_0,               // v128.const
-  Imm_V128_Op_2,               // i8x16.shuffle
+  Imm_0_Op_0,                   // Nop
+  Imm_0_Op_1,                   // i32.eqz
+  Imm_0_Op_2,                   // i32.add
+  Imm_0_Op_3,                   // select
+  Imm_Jump_Op_0,                // br
+  Imm_Jump_Op_1,                // br_if
+  Imm_Jump_Op_2,                // br_unless.i32.eq
+  Imm_Index_Op_0,               // global.get
+  Imm_Index_Op_1,               // global.set
+  Imm_Index_Op_2,               // table.set
+  Imm_Index_Op_3,               // memory.fill
+  Imm_Index_Op_N,               // call
+  Imm_Index_Index_Op_3,         // memory.init
+  Imm_Index_Index_Op_N,         // call_indirect
+  Imm_Index_Offset_Op_1,        // i32.load
+  Imm_Index_Offset_Op_2,        // i32.store
+  Imm_Index_Offset_Op_3,        // i32.atomic.rmw.cmpxchg
+  Imm_Index_Offset_Lane_Op_2,   // v128.load8_lane
+  Imm_I32_Op_0,                 // i32.const
+  Imm_I64_Op_0,                 // i64.const
+  Imm_F32_Op_0,                 // f32.const
+  Imm_F64_Op_0,                 // f64.const
+  Imm_I32_I32_Op_0,             // drop_keep
+  Imm_I8_Op_1,                  // i32x4.extract_lane
+  Imm_I8_Op_2,                  // i32x4.replace_lane
+  Imm_V128_Op_0,                // v128.const
+  Imm_V128_Op_2,                // i8x16.shuffle
+  Imm_Index_Index_Op_0,         // i32.add_locals
+  Imm_Index_I32_Op_0,           // i32.add_local_const
+  Imm_Index_I32_Index_Op_0,     // i32.add_local_const_set
+  Imm_Index_Index_Offset_Op_0,  // i32.load_local
 };
 
 struct Instr {
@@ -88,6 +96,9 @@ struct Instr {
       u32 fst, snd;
       u8 idx;
     } imm_u32x2_u8;
+    struct {
+      u32 fst, snd, trd;
+    } imm_u32x3;
     struct {
       u32 memidx;
       u64 offset;
@@ -97,6 +108,12 @@ struct Instr {
       u8 lane;
       u64 offset;
     } imm_index_offset_lane;
+    // Laid out like imm_index_offset, so it can be read as one.
+    struct {
+      u32 memidx;
+      u32 local;
+      u64 offset;
+    } imm_index_local_offset;
   };
 };
 
@@ -114,6 +131,24 @@ class Istream {
   // Each opcode is a SerializedOpcode, and each immediate is a u32.
   static constexpr Offset kBrTableEntrySize =
       sizeof(SerializedOpcode) * 3 + 4 * sizeof(u32);
+  // Same as above, for the FixedWidth encoding.
+  static constexpr Offset kFixedWidthBrTableEntrySize = sizeof(Instr) * 3;
+
+  enum class Encoding {
+    // Each opcode is followed by its immediates, unaligned. Reading an
+    // instruction requires decoding its immediates.
+    Compact,
+    // Each instruction is stored as an aligned Instr, so reading it is just a
+    // copy. Offsets are still byte offsets, but larger than in the Compact
+    // encoding.
+    FixedWidth,
+  };
+
+  Istream() = default;
+  explicit Istream(Encoding);
+
+  Encoding encoding() const { return encoding_; }
+  Offset BrTableEntrySize() const;
 
   // Emit API.
   void Emit(u32);
@@ -124,6 +159,8 @@ class Istream {
   void Emit(Opcode::Enum, v128);
   void Emit(Opcode::Enum, u32, u32);
   void Emit(Opcode::Enum, u32, u32, u8);
+  void Emit(Opcode::Enum, u32, u32, u32);
+  void Emit(Opcode::Enum, u32, u32, u64);
   void Emit(Opcode::Enum, u32, u64);
   void Emit(Opcode::Enum, u32, u64, u8);
   void EmitDropKeep(u32 drop, u32 keep);
@@ -131,11 +168,19 @@ class Istream {
 
   Offset EmitFixupU32();
   void ResolveFixupU32(Offset);
+  // Resolves the fixup to `value` instead of the current end.
+  void ResolveFixupU32(Offset, u32 value);
 
   Offset end() const;
 
-  // Read API.
-  Instr Read(Offset*) const;
+  // Discard everything emitted at or after the given offset. Used to replace
+  // a sequence of instructions that was just emitted by a superinstruction.
+  void Truncate(Offset);
+
+  // Read API. This is defined inline since it is called once per executed
+  // instruction; the InstrKind of each opcode is looked up in a table rather
+  // than recomputed from a switch.
+  inline Instr Read(Offset*) const;
 
   // Disassemble/Trace API.
   // TODO separate out disassembly/tracing?
@@ -165,11 +210,124 @@ class Istream {
   void WABT_VECTORCALL EmitInternal(T val);
 
   template <typename T>
-  T WABT_VECTORCALL ReadAt(Offset*) const;
+  inline T WABT_VECTORCALL ReadAt(Offset*) const;
+
+  Instr& EmitSlot(Opcode::Enum);
 
-  Buffer data_;
+  static const std::array<InstrKind, Opcode::Invalid + 1> kInstrKinds;
+
+  Encoding encoding_ = Encoding::Compact;
+  Buffer data_;               // Used by the Compact encoding.
+  std::vector<Instr> slots_;  // Used by the FixedWidth encoding.
+  // Number of immediate bytes written to, and still expected for, the last
+  // slot. Only used when an opcode's immediates are emitted separately, e.g.
+  // a branch followed by a fixup.
+  u32 slot_imm_written_ = 0;
+  u32 slot_imm_pending_ = 0;
 };
 
+template <typename T>
+T WABT_VECTORCALL Istream::ReadAt(Offset* offset) const {
+  assert(*offset + sizeof(T) <= data_.size());
+  T result;
+  memcpy(&result, data_.data() + *offset, sizeof(T));
+  *offset += sizeof(T);
+  return result;
+}
+
+Instr Istream::Read(Offset* offset) const {
+  if (encoding_ == Encoding::FixedWidth) {
+    assert(*offset % sizeof(Instr) == 0 &&
+           *offset < slots_.size() * sizeof(Instr));
+    Instr instr = *reinterpret_cast<const Instr*>(
+        reinterpret_cast<const u8*>(slots_.data()) + *offset);
+    *offset += sizeof(Instr);
+    return instr;
+  }
+
+  Instr instr;
+  instr.op = static_cast<Opcode::Enum>(ReadAt<SerializedOpcode>(offset));
+  assert(instr.op <= Opcode::Invalid);
+  instr.kind = kInstrKinds[instr.op];
+
+  switch (instr.kind) {
+    case InstrKind::Imm_0_Op_0:
+    case InstrKind::Imm_0_Op_1:
+    case InstrKind::Imm_0_Op_2:
+    case InstrKind::Imm_0_Op_3:
+      break;
+
+    case InstrKind::Imm_Jump_Op_0:
+    case InstrKind::Imm_Jump_Op_1:
+    case InstrKind::Imm_Jump_Op_2:
+    case InstrKind::Imm_Index_Op_0:
+    case InstrKind::Imm_Index_Op_1:
+    case InstrKind::Imm_Index_Op_2:
+    case InstrKind::Imm_Index_Op_3:
+    case InstrKind::Imm_Index_Op_N:
+    case InstrKind::Imm_I32_Op_0:
+      instr.imm_u32 = ReadAt<u32>(offset);
+      break;
+
+    case InstrKind::Imm_Index_Index_Op_3:
+    case InstrKind::Imm_Index_Index_Op_N:
+    case InstrKind::Imm_I32_I32_Op_0:
+    case InstrKind::Imm_Index_Index_Op_0:
+    case InstrKind::Imm_Index_I32_Op_0:
+      instr.imm_u32x2.fst = ReadAt<u32>(offset);
+      instr.imm_u32x2.snd = ReadAt<u32>(offset);
+      break;
+
+    case InstrKind::Imm_Index_I32_Index_Op_0:
+      instr.imm_u32x3.fst = ReadAt<u32>(offset);
+      instr.imm_u32x3.snd = ReadAt<u32>(offset);
+      instr.imm_u32x3.trd = ReadAt<u32>(offset);
+      break;
+
+    case InstrKind::Imm_Index_Index_Offset_Op_0:
+      instr.imm_index_local_offset.memidx = ReadAt<u32>(offset);
+      instr.imm_index_local_offset.local = ReadAt<u32>(offset);
+      instr.imm_index_local_offset.offset = ReadAt<u64>(offset);
+      break;
+
+    case InstrKind::Imm_Index_Offset_Op_1:
+    case InstrKind::Imm_Index_Offset_Op_2:
+    case InstrKind::Imm_Index_Offset_Op_3:
+      instr.imm_index_offset.memidx = ReadAt<u32>(offset);
+      instr.imm_index_offset.offset = ReadAt<u64>(offset);
+      break;
+
+    case InstrKind::Imm_Index_Offset_Lane_Op_2:
+      instr.imm_index_offset_lane.memidx = ReadAt<u32>(offset);
+      instr.imm_index_offset_lane.offset = ReadAt<u64>(offset);
+      instr.imm_index_offset_lane.lane = ReadAt<u8>(offset);
+      break;
+
+    case InstrKind::Imm_I64_Op_0:
+      instr.imm_u64 = ReadAt<u64>(offset);
+      break;
+
+    case InstrKind::Imm_F32_Op_0:
+      instr.imm_f32 = ReadAt<f32>(offset);
+      break;
+
+    case InstrKind::Imm_F64_Op_0:
+      instr.imm_f64 = ReadAt<f64>(offset);
+      break;
+
+    case InstrKind::Imm_I8_Op_1:
+    case InstrKind::Imm_I8_Op_2:
+      instr.imm_u8 = ReadAt<u8>(offset);
+      break;
+
+    case InstrKind::Imm_V128_Op_0:
+    case InstrKind::Imm_V128_Op_2:
+      instr.imm_v128 = ReadAt<v128>(offset);
+      break;
+  }
+  return instr;
+}
+
 }  // namespace interp
 }  // namespace wabt
 
@@ -27,6 +27,7 @@
 #include <type_traits>
 #include <vector>
 
+#include "wabt/arena.h"
 #include "wabt/binding-hash.h"
 #include "wabt/common.h"
 #include "wabt/intrusive-list.h"
@@ -505,7 +506,8 @@ using TryTableVector = std::vector<TableCatch>;
 
 enum class TryKind { Plain, Catch, Delegate };
 
-class Expr : public intrusive_list_base<Expr> {
+class Expr : public intrusive_list_base<Expr>,
+             public ArenaAllocated<Expr> {
  public:
   WABT_DISALLOW_COPY_AND_ASSIGN(Expr);
   Expr() = delete;
@@ -1118,7 +1120,8 @@ enum class ModuleFieldType {
   Tag
 };
 
-class ModuleField : public intrusive_list_base<ModuleField> {
+class ModuleField : public intrusive_list_base<ModuleField>,
+                    public ArenaAllocated<ModuleField> {
  public:
   WABT_DISALLOW_COPY_AND_ASSIGN(ModuleField);
   ModuleField() = delete;
@@ -1262,6 +1265,12 @@ struct Custom {
 };
 
 struct Module {
+  Module() = default;
+  Module(Module&&) = default;
+  Module& operator=(Module&&) = default;
+  // The fields must be destroyed before the arenas they were allocated from.
+  ~Module() { fields.clear(); }
+
   Index GetFuncTypeIndex(const Var&) const;
   Index GetFuncTypeIndex(const FuncDeclaration&) const;
   Index GetFuncTypeIndex(const FuncSignature&) const;
@@ -1359,6 +1368,11 @@ struct Module {
   // needs to emit wrappers for any functions that might get used as function
   // references, and uses this information to limit its output.
   std::set<Index> used_func_refs;
+
+  // The arenas that the BinaryReaderIR allocated the fields and expressions
+  // from. This is the last member, so that a move replaces the fields before
+  // it releases the arenas that they were allocated from.
+  std::vector<std::unique_ptr<Arena>> arenas;
 };
 
 enum class ScriptModuleType {
@@ -38,6 +38,8 @@ struct ValidateOptions {
   ValidateOptions(const Features& features) : features(features) {}
 
   Features features;
+  // The number of threads that ValidateModule checks function bodies on.
+  int num_threads = 1;
 };
 
 enum class TableImportStatus {
@@ -52,10 +54,15 @@ class SharedValidator {
   SharedValidator(Errors*,
                   std::string_view filename,
                   const ValidateOptions& options);
+  // Starts from the module-level state of `other`, so that function bodies
+  // can be checked independently of it, e.g. on another thread. Its errors
+  // are added to `errors`.
+  SharedValidator(const SharedValidator& other, Errors* errors);
 
   // TODO: Move into SharedValidator?
   using Label = TypeChecker::Label;
   size_t type_stack_size() const { return typechecker_.type_stack_size(); }
+  const TypeVector& type_stack() const { return typechecker_.type_stack(); }
   Result GetLabel(Index depth, Label** out_label) {
     return typechecker_.GetLabel(depth, out_label);
   }
@@ -71,6 +78,9 @@ class SharedValidator {
   Index GetLocalCount() const;
 
   Result EndModule();
+  // Takes the checks that `other`, which was created from this validator,
+  // deferred to the end of the module.
+  void MergeDeferredChecks(SharedValidator* other);
 
   Result OnFuncType(const Location&,
                     Index param_count,
@@ -355,6 +365,10 @@ class SharedValidator {
   // Cached for access by OnTypecheckerError.
   Location expr_loc_ = Location(kInvalidOffset);
   bool in_init_expr_ = false;
+  // Set by EndModule, once every declared function is known. Function bodies
+  // that are validated after that, such as lazily compiled ones, check their
+  // ref.func declarations right away.
+  bool module_ended_ = false;
 
   Index num_types_ = 0;
   std::map<Index, FuncType> func_types_;
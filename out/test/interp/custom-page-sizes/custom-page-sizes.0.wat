@@ -0,0 +1 @@
+(memory 0 (pagesize 0))
\ No newline at end of file
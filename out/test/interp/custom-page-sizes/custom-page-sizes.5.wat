@@ -0,0 +1 @@
+(memory 0x1_0000_0000 (pagesize 1))
\ No newline at end of file
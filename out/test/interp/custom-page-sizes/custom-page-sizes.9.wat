@@ -0,0 +1 @@
+(memory (pagesize 0) (data))
\ No newline at end of file
@@ -0,0 +1,9 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    block  ;; label = @1
+      br 0 (;@1;)
+    end
+    block  ;; label = @1
+      br 0 (;@1;)
+    end))
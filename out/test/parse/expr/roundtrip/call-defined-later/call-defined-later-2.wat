@@ -0,0 +1,10 @@
+(module
+  (type (;0;) (func))
+  (type (;1;) (func (param i32 i32) (result i32)))
+  (func (;0;) (type 0)
+    i32.const 1
+    i32.const 0
+    call 1
+    drop)
+  (func (;1;) (type 1) (param i32 i32) (result i32)
+    i32.const 0))
@@ -0,0 +1,9 @@
+(module
+  (type (;0;) (func (param i32)))
+  (type (;1;) (func))
+  (func (;0;) (type 1)
+    i32.const 0
+    i32.const 0
+    call_indirect (type 0))
+  (table (;0;) 1 1 funcref)
+  (elem (;0;) (i32.const 0) func 0))
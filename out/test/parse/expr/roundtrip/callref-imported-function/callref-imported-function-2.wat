@@ -0,0 +1,10 @@
+(module
+  (type (;0;) (func (param i32) (result i32)))
+  (type (;1;) (func (result i32)))
+  (import "" "foo" (func (;0;) (type 0)))
+  (func (;1;) (type 1) (result i32)
+    i32.const 10
+    ref.func 0
+    call_ref 0)
+  (export "main" (func 1))
+  (elem (;0;) declare funcref (ref.func 0)))
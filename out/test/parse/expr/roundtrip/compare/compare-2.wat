@@ -0,0 +1,131 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    i32.const 0
+    i32.const 0
+    i32.eq
+    drop
+    i64.const 0
+    i64.const 0
+    i64.eq
+    drop
+    f32.const 0x0p+0 (;=0;)
+    f32.const 0x0p+0 (;=0;)
+    f32.eq
+    drop
+    f64.const 0x0p+0 (;=0;)
+    f64.const 0x0p+0 (;=0;)
+    f64.eq
+    drop
+    i32.const 0
+    i32.const 0
+    i32.ne
+    drop
+    i64.const 0
+    i64.const 0
+    i64.ne
+    drop
+    f32.const 0x0p+0 (;=0;)
+    f32.const 0x0p+0 (;=0;)
+    f32.ne
+    drop
+    f64.const 0x0p+0 (;=0;)
+    f64.const 0x0p+0 (;=0;)
+    f64.ne
+    drop
+    i32.const 0
+    i32.const 0
+    i32.lt_s
+    drop
+    i64.const 0
+    i64.const 0
+    i64.lt_s
+    drop
+    i32.const 0
+    i32.const 0
+    i32.lt_u
+    drop
+    i64.const 0
+    i64.const 0
+    i64.lt_u
+    drop
+    f32.const 0x0p+0 (;=0;)
+    f32.const 0x0p+0 (;=0;)
+    f32.lt
+    drop
+    f64.const 0x0p+0 (;=0;)
+    f64.const 0x0p+0 (;=0;)
+    f64.lt
+    drop
+    i32.const 0
+    i32.const 0
+    i32.le_s
+    drop
+    i64.const 0
+    i64.const 0
+    i64.le_s
+    drop
+    i32.const 0
+    i32.const 0
+    i32.le_u
+    drop
+    i64.const 0
+    i64.const 0
+    i64.le_u
+    drop
+    f32.const 0x0p+0 (;=0;)
+    f32.const 0x0p+0 (;=0;)
+    f32.le
+    drop
+    f64.const 0x0p+0 (;=0;)
+    f64.const 0x0p+0 (;=0;)
+    f64.le
+    drop
+    i32.const 0
+    i32.const 0
+    i32.gt_s
+    drop
+    i64.const 0
+    i64.const 0
+    i64.gt_s
+    drop
+    i32.const 0
+    i32.const 0
+    i32.gt_u
+    drop
+    i64.const 0
+    i64.const 0
+    i64.gt_u
+    drop
+    f32.const 0x0p+0 (;=0;)
+    f32.const 0x0p+0 (;=0;)
+    f32.gt
+    drop
+    f64.const 0x0p+0 (;=0;)
+    f64.const 0x0p+0 (;=0;)
+    f64.gt
+    drop
+    i32.const 0
+    i32.const 0
+    i32.ge_s
+    drop
+    i64.const 0
+    i64.const 0
+    i64.ge_s
+    drop
+    i32.const 0
+    i32.const 0
+    i32.ge_u
+    drop
+    i64.const 0
+    i64.const 0
+    i64.ge_u
+    drop
+    f32.const 0x0p+0 (;=0;)
+    f32.const 0x0p+0 (;=0;)
+    f32.ge
+    drop
+    f64.const 0x0p+0 (;=0;)
+    f64.const 0x0p+0 (;=0;)
+    f64.ge
+    drop))
@@ -0,0 +1,7 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    i32.const 1
+    if  ;; label = @1
+      br 0 (;@1;)
+    end))
@@ -0,0 +1,46 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    i64.const 0
+    i32.load
+    drop
+    i64.const 0
+    i32.load8_s
+    drop
+    i64.const 0
+    i32.load16_s
+    drop
+    i64.const 0
+    i32.load8_u
+    drop
+    i64.const 0
+    i32.load16_u
+    drop
+    i64.const 0
+    i64.load
+    drop
+    i64.const 0
+    i64.load8_s
+    drop
+    i64.const 0
+    i64.load16_s
+    drop
+    i64.const 0
+    i64.load32_s
+    drop
+    i64.const 0
+    i64.load8_u
+    drop
+    i64.const 0
+    i64.load16_u
+    drop
+    i64.const 0
+    i64.load32_u
+    drop
+    i64.const 0
+    f32.load
+    drop
+    i64.const 0
+    f64.load
+    drop)
+  (memory (;0;) i64 1))
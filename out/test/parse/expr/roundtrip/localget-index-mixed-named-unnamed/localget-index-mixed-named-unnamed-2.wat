@@ -0,0 +1,18 @@
+(module
+  (type (;0;) (func (param i32 f32)))
+  (func (;0;) (type 0) (param i32 f32)
+    (local i32 i64 f64)
+    local.get 0
+    drop
+    local.get 1
+    drop
+    local.get 1
+    drop
+    local.get 2
+    drop
+    local.get 3
+    drop
+    local.get 4
+    drop
+    local.get 4
+    drop))
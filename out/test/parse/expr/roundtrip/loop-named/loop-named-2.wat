@@ -0,0 +1,9 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    loop  ;; label = @1
+      nop
+    end
+    loop  ;; label = @1
+      nop
+    end))
@@ -0,0 +1,14 @@
+(module
+  (type (;0;) (func (result i32)))
+  (func (;0;) (type 0) (result i32)
+    i32.const 0)
+  (func (;1;) (type 0) (result i32)
+    i32.const 1)
+  (func (;2;) (type 0) (result i32)
+    i32.const 0
+    call_indirect (type 0))
+  (func (;3;) (type 0) (result i32)
+    i32.const 0
+    call_indirect 1 (type 0))
+  (table (;0;) 1 funcref)
+  (table (;1;) 1 funcref))
@@ -0,0 +1,16 @@
+(module
+  (type (;0;) (func (result externref)))
+  (type (;1;) (func (param externref)))
+  (type (;2;) (func (result i32)))
+  (func (;0;) (type 0) (result externref)
+    i32.const 0
+    table.get 0)
+  (func (;1;) (type 1) (param externref)
+    i32.const 0
+    local.get 0
+    table.set 0)
+  (func (;2;) (type 2) (result i32)
+    ref.null extern
+    i32.const 0
+    table.grow 0)
+  (table (;0;) 1 externref))
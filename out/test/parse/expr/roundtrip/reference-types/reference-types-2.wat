@@ -0,0 +1,43 @@
+(module
+  (type (;0;) (func (result externref)))
+  (type (;1;) (func (param externref)))
+  (type (;2;) (func (result i32)))
+  (type (;3;) (func (param externref) (result i32)))
+  (type (;4;) (func (result funcref)))
+  (func (;0;) (type 0) (result externref)
+    i32.const 0
+    table.get 0)
+  (func (;1;) (type 0) (result externref)
+    i32.const 0
+    table.get 1)
+  (func (;2;) (type 1) (param externref)
+    i32.const 0
+    local.get 0
+    table.set 0)
+  (func (;3;) (type 1) (param externref)
+    i32.const 0
+    local.get 0
+    table.set 1)
+  (func (;4;) (type 2) (result i32)
+    ref.null extern
+    i32.const 0
+    table.grow 0)
+  (func (;5;) (type 2) (result i32)
+    ref.null extern
+    i32.const 0
+    table.grow 1)
+  (func (;6;) (type 3) (param externref) (result i32)
+    local.get 0
+    ref.is_null)
+  (func (;7;) (type 4) (result funcref)
+    ref.func 0)
+  (func (;8;) (type 2) (result i32)
+    table.size 0)
+  (func (;9;) (type 2) (result i32)
+    table.size 1)
+  (func (;10;) (type 2) (result i32)
+    table.size 2)
+  (table (;0;) 1 externref)
+  (table (;1;) 1 externref)
+  (table (;2;) 1 funcref)
+  (elem (;0;) declare func 0))
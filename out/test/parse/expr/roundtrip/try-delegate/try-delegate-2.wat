@@ -0,0 +1,15 @@
+(module
+  (type (;0;) (func (param i32)))
+  (type (;1;) (func))
+  (func (;0;) (type 1)
+    try  ;; label = @1
+      try  ;; label = @2
+        nop
+      delegate 0
+      try  ;; label = @2
+        nop
+      delegate 1
+    catch 0
+      drop
+    end)
+  (tag (;0;) (type 0) (param i32)))
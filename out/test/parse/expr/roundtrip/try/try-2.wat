@@ -0,0 +1,28 @@
+(module
+  (type (;0;) (func (param i32)))
+  (type (;1;) (func))
+  (func (;0;) (type 1)
+    try  ;; label = @1
+      nop
+    end)
+  (func (;1;) (type 1)
+    try  ;; label = @1
+      nop
+    catch 0
+      drop
+    end)
+  (func (;2;) (type 1)
+    try  ;; label = @1
+      nop
+    catch 0
+      drop
+    end)
+  (func (;3;) (type 1)
+    try (result i32)  ;; label = @1
+      i32.const 1
+    catch 0
+      drop
+      i32.const 2
+    end
+    drop)
+  (tag (;0;) (type 0) (param i32)))
@@ -0,0 +1,69 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    f32.const 0x0p+0 (;=0;)
+    f32.neg
+    drop
+    f64.const 0x0p+0 (;=0;)
+    f64.neg
+    drop
+    f32.const 0x0p+0 (;=0;)
+    f32.abs
+    drop
+    f64.const 0x0p+0 (;=0;)
+    f64.abs
+    drop
+    f32.const 0x0p+0 (;=0;)
+    f32.sqrt
+    drop
+    f64.const 0x0p+0 (;=0;)
+    f64.sqrt
+    drop
+    i32.const 0
+    i32.eqz
+    drop
+    i64.const 0
+    i64.eqz
+    drop
+    i32.const 0
+    i32.clz
+    drop
+    i64.const 0
+    i64.clz
+    drop
+    i32.const 0
+    i32.ctz
+    drop
+    i64.const 0
+    i64.ctz
+    drop
+    i32.const 0
+    i32.popcnt
+    drop
+    i64.const 0
+    i64.popcnt
+    drop
+    f32.const 0x0p+0 (;=0;)
+    f32.ceil
+    drop
+    f64.const 0x0p+0 (;=0;)
+    f64.ceil
+    drop
+    f32.const 0x0p+0 (;=0;)
+    f32.floor
+    drop
+    f64.const 0x0p+0 (;=0;)
+    f64.floor
+    drop
+    f32.const 0x0p+0 (;=0;)
+    f32.trunc
+    drop
+    f64.const 0x0p+0 (;=0;)
+    f64.trunc
+    drop
+    f32.const 0x0p+0 (;=0;)
+    f32.nearest
+    drop
+    f64.const 0x0p+0 (;=0;)
+    f64.nearest
+    drop))
@@ -0,0 +1,27 @@
+(module
+  (type (;0;) (func))
+  (type (;1;) (func (param i32 i32)))
+  (type (;2;) (func (result i32 i32)))
+  (type (;3;) (func (param f32 f32) (result f32 f32)))
+  (func (;0;) (type 0)
+    (block  ;; label = @1
+    ))
+  (func (;1;) (type 0)
+    (i32.const 1)
+    (i32.const 2)
+    (block (param i32 i32)  ;; label = @1
+      (drop)
+      (drop)))
+  (func (;2;) (type 0)
+    (block (result i32 i32)  ;; label = @1
+      (i32.const 1)
+      (i32.const 2))
+    (drop)
+    (drop))
+  (func (;3;) (type 0)
+    (f32.const 0x1p+0 (;=1;))
+    (f32.const 0x1p+1 (;=2;))
+    (block (param f32 f32) (result f32 f32)  ;; label = @1
+    )
+    (drop)
+    (drop)))
@@ -0,0 +1,14 @@
+(module
+  (type (;0;) (func))
+  (type (;1;) (func (result i32 i64)))
+  (type (;2;) (func (param i32) (result i32 i32)))
+  (func (;0;) (type 0)
+    (block (result i32 i64)  ;; label = @1
+      (i32.const 0)
+      (i64.const 0))
+    (return))
+  (func (;1;) (type 0)
+    (i32.const 0)
+    (block (param i32) (result i32 i32)  ;; label = @1
+      (i32.const 1))
+    (return)))
@@ -0,0 +1,19 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    (memory.init 0
+      (i64.const 0)
+      (i32.const 0)
+      (i32.const 0))
+    (data.drop 0))
+  (func (;1;) (type 0)
+    (table.init 0
+      (i32.const 0)
+      (i32.const 0)
+      (i32.const 0))
+    (elem.drop 0))
+  (table (;0;) 1 funcref)
+  (memory (;0;) i64 1)
+  (elem (;0;) funcref (ref.func 0) (ref.null func))
+  (elem (;1;) func 0)
+  (data (;0;) "a"))
@@ -0,0 +1,5 @@
+(module
+  (type (;0;) (func (param f32)))
+  (func (;0;) (type 0) (param f32)
+    (call 0
+      (f32.const 0x0p+0 (;=0;)))))
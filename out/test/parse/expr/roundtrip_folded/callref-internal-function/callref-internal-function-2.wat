@@ -0,0 +1,13 @@
+(module
+  (type (;0;) (func (param i32) (result i32)))
+  (type (;1;) (func (result i32)))
+  (func (;0;) (type 1) (result i32)
+    (i32.const 10)
+    (call_ref 0
+      (ref.func 1)))
+  (func (;1;) (type 0) (param i32) (result i32)
+    (i32.add
+      (local.get 0)
+      (i32.const 19)))
+  (export "main" (func 0))
+  (elem (;0;) declare funcref (ref.func 1)))
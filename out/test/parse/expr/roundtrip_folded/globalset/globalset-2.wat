@@ -0,0 +1,6 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    (global.set 0
+      (f32.const 0x1p+1 (;=2;))))
+  (global (;0;) (mut f32) (f32.const 0x1p+0 (;=1;))))
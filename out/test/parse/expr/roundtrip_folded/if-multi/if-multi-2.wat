@@ -0,0 +1,26 @@
+(module
+  (type (;0;) (func))
+  (type (;1;) (func (result i32 f32 f64)))
+  (type (;2;) (func (param i32) (result i64)))
+  (func (;0;) (type 0)
+    (if (result i32 f32 f64)  ;; label = @1
+      (i32.const 0)
+      (then
+        (i32.const 0)
+        (f32.const 0x0p+0 (;=0;))
+        (f64.const 0x0p+0 (;=0;)))
+      (else
+        (i32.const 1)
+        (f32.const 0x1p+0 (;=1;))
+        (f64.const 0x1p+0 (;=1;))))
+    (return))
+  (func (;1;) (type 0)
+    (i32.const 1)
+    (if (param i32) (result i64)  ;; label = @1
+      (i32.const 0)
+      (then
+        (drop)
+        (i64.const 1))
+      (else
+        (i64.extend_i32_u)))
+    (return)))
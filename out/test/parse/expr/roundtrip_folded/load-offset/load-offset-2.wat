@@ -0,0 +1,88 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    (drop
+      (i32.load
+        (i32.const 0)))
+    (drop
+      (i64.load offset=1
+        (i32.const 0)))
+    (drop
+      (i64.load8_s offset=2
+        (i32.const 0)))
+    (drop
+      (i64.load16_s offset=3
+        (i32.const 0)))
+    (drop
+      (i64.load32_s offset=4
+        (i32.const 0)))
+    (drop
+      (i64.load8_u offset=5
+        (i32.const 0)))
+    (drop
+      (i64.load16_u offset=6
+        (i32.const 0)))
+    (drop
+      (i64.load32_u offset=7
+        (i32.const 0)))
+    (drop
+      (i32.load8_s offset=8
+        (i32.const 0)))
+    (drop
+      (i32.load16_s offset=9
+        (i32.const 0)))
+    (drop
+      (i32.load8_u offset=10
+        (i32.const 0)))
+    (drop
+      (i32.load16_u offset=11
+        (i32.const 0)))
+    (drop
+      (f32.load offset=12
+        (i32.const 0)))
+    (drop
+      (f64.load offset=13
+        (i32.const 0)))
+    (drop
+      (i32.load align=1
+        (i32.const 0)))
+    (drop
+      (i64.load offset=1 align=2
+        (i32.const 0)))
+    (drop
+      (i64.load8_s offset=2
+        (i32.const 0)))
+    (drop
+      (i64.load16_s offset=3 align=1
+        (i32.const 0)))
+    (drop
+      (i64.load32_s offset=4 align=1
+        (i32.const 0)))
+    (drop
+      (i64.load8_u offset=5
+        (i32.const 0)))
+    (drop
+      (i64.load16_u offset=6
+        (i32.const 0)))
+    (drop
+      (i64.load32_u offset=7 align=2
+        (i32.const 0)))
+    (drop
+      (i32.load8_s offset=8
+        (i32.const 0)))
+    (drop
+      (i32.load16_s offset=9
+        (i32.const 0)))
+    (drop
+      (i32.load8_u offset=10
+        (i32.const 0)))
+    (drop
+      (i32.load16_u offset=11
+        (i32.const 0)))
+    (drop
+      (f32.load offset=12
+        (i32.const 0)))
+    (drop
+      (f64.load offset=13 align=2
+        (i32.const 0))))
+  (memory (;0;) 1))
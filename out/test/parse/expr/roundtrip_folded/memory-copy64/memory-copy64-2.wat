@@ -0,0 +1,8 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    (memory.copy
+      (i64.const 0)
+      (i64.const 0)
+      (i64.const 0)))
+  (memory (;0;) i64 0))
@@ -0,0 +1,16 @@
+(module
+  (type (;0;) (func (result externref)))
+  (type (;1;) (func (param externref)))
+  (type (;2;) (func (result i32)))
+  (func (;0;) (type 0) (result externref)
+    (table.get 0
+      (i32.const 0)))
+  (func (;1;) (type 1) (param externref)
+    (table.set 0
+      (i32.const 0)
+      (local.get 0)))
+  (func (;2;) (type 2) (result i32)
+    (table.grow 0
+      (ref.null extern)
+      (i32.const 0)))
+  (table (;0;) 1 externref))
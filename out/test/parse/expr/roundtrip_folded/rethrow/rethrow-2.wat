@@ -0,0 +1,8 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    (try  ;; label = @1
+      (do)
+      (catch 0
+        (rethrow 0 (;@1;)))))
+  (tag (;0;) (type 0)))
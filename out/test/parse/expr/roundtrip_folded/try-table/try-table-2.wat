@@ -0,0 +1,20 @@
+(module
+  (type (;0;) (func (param i32)))
+  (type (;1;) (func (param i32 i32)))
+  (type (;2;) (func))
+  (type (;3;) (func (result i32 i32)))
+  (func (;0;) (type 2)
+    (block  ;; label = @1
+      (drop
+        (block (result i32)  ;; label = @2
+          (block (result i32 i32)  ;; label = @3
+            (try_table  ;; label = @4
+              (catch 0 1 (;@2;))
+              (catch 1 0 (;@3;))
+              (catch_all 2 (;@1;))
+              (nop))
+            (i32.const 0)
+            (i32.const 0))
+          (drop)))))
+  (tag (;0;) (type 0) (param i32))
+  (tag (;1;) (type 1) (param i32 i32)))
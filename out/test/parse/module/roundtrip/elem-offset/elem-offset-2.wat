@@ -0,0 +1,7 @@
+(module
+  (type (;0;) (func))
+  (import "foo" "bar" (global (;0;) i32))
+  (func (;0;) (type 0))
+  (table (;0;) 2 funcref)
+  (global (;1;) i32 (i32.const 1))
+  (elem (;0;) (global.get 0) func 0))
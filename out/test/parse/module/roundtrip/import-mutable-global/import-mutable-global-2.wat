@@ -0,0 +1,2 @@
+(module
+  (import "mod" "field" (global (;0;) (mut f32))))
@@ -0,0 +1,5 @@
+(module
+  (type (;0;) (func (param f64 f32)))
+  (type (;1;) (func (param i32 i64)))
+  (import "foo" "1" (tag (;0;) (type 0) (param f64 f32)))
+  (import "foo" "2" (tag (;1;) (type 1) (param i32 i64))))
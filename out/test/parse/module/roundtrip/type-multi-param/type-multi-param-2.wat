@@ -0,0 +1,2 @@
+(module
+  (type (;0;) (func (param i32 f32 f64) (result f32))))
@@ -0,0 +1,6 @@
+(module
+  (type (;0;) (func (result i32)))
+  (func (;0;) (type 0) (result i32)
+    (return
+      (i32.const -420)))
+  (export "main" (func 0)))
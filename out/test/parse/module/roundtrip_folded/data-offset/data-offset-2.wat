@@ -0,0 +1,5 @@
+(module
+  (import "foo" "bar" (global (;0;) i32))
+  (memory (;0;) 1)
+  (global (;1;) i32 (i32.const 1))
+  (data (;0;) (global.get 0) "hi"))
@@ -0,0 +1,3 @@
+(module
+  (memory (;0;) 1)
+  (export "mem" (memory 0)))
@@ -0,0 +1,7 @@
+(module
+  (type (;0;) (func (param i32 i32)))
+  (type (;1;) (func (param i32)))
+  (tag (;0;) (type 0) (param i32 i32))
+  (tag (;1;) (type 1) (param i32))
+  (export "my_tag" (tag 0))
+  (export "my_tag_2" (tag 1)))
@@ -0,0 +1,10 @@
+(module
+  (type (;0;) (func (param i32)))
+  (type (;1;) (func (param i32 i64)))
+  (type (;2;) (func (result i64)))
+  (func (;0;) (type 0) (param i32))
+  (func (;1;) (type 1) (param i32 i64))
+  (func (;2;) (type 2) (result i64)
+    (i64.const 0))
+  (table (;0;) 4 4 funcref)
+  (elem (;0;) (i32.const 0) func 0 0 1 2))
@@ -0,0 +1,15 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0))
+  (func (;1;) (type 0))
+  (func (;2;) (type 0))
+  (func (;3;) (type 0)
+    (call 0)
+    (call 0)
+    (call 0)
+    (call 1)
+    (call 1)
+    (call 1)
+    (call 2)
+    (call 2)
+    (call 2)))
@@ -0,0 +1,4 @@
+(module
+  (type (;0;) (func))
+  (import "foo" "bar" (func (;0;) (type 0)))
+  (export "baz" (func 0)))
@@ -0,0 +1,18 @@
+(module
+  (type $t0 (func))
+  (func $f0 (type $t0)
+    (local $l0 (ref func)) (local $l1 (ref func)) (local $l2 (ref func)))
+  (func $f1 (type $t0)
+    (local $l0 (ref func)) (local $l1 (ref func))
+    (try_table $T0
+    ))
+  (func $f2 (type $t0)
+    (local $l0 (ref func))
+    (try_table $T0
+      (catch $e0 0 (;@0;))
+      (catch_all 0 (;@0;))))
+  (func $f3 (type $t0)
+    (unreachable)
+    (try_table $T0
+    ))
+  (tag $e0 (type $t0)))
@@ -0,0 +1,10 @@
+(module
+  (type (;0;) (func (result i32)))
+  (type (;1;) (func))
+  (func (;0;) (type 1)
+    call 1
+    i32.const 0
+    i32.eq
+    drop)
+  (func (;1;) (type 0) (result i32)
+    i32.const 42))
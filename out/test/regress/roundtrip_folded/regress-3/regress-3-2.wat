@@ -0,0 +1,10 @@
+(module
+  (type (;0;) (func (result i32)))
+  (type (;1;) (func))
+  (func (;0;) (type 1)
+    (drop
+      (i32.eq
+        (call 1)
+        (i32.const 0))))
+  (func (;1;) (type 0) (result i32)
+    (i32.const 42)))
@@ -0,0 +1,4 @@
+(module
+  (memory (;0;) 0)
+  (memory $k 0 0)
+  (data (;0;) (memory $k) (i32.const 0) ""))
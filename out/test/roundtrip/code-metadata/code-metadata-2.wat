@@ -0,0 +1,8 @@
+(module
+  (type (;0;) (func (param i32) (result i32)))
+  (func (;0;) (type 0) (param i32) (result i32)
+    i32.const 1234
+    local.get 0
+    (@metadata.code.test "aa\01a\ff") i32.add
+    return)
+  (@custom "metadata.code.test" "\01\00\01\06\05aa\01a\ff"))
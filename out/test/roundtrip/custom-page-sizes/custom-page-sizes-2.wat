@@ -0,0 +1,47 @@
+(module
+  (import "n" "mem2" (memory (;0;) 23 (pagesize 1)))
+  (import "o" "mem3" (memory (;1;) 24 25 (pagesize 1)))
+  (import "n" "mem2" (memory (;2;) 23))
+  (import "o" "mem3" (memory (;3;) 24 25))
+  (import "n" "mem2" (memory $g i64 23 (pagesize 1)))
+  (import "o" "mem3" (memory $h i64 24 25 (pagesize 1)))
+  (import "n" "mem2" (memory (;6;) i64 23))
+  (import "o" "mem3" (memory (;7;) i64 24 25))
+  (import "m" "mem1" (memory (;8;) 107 (pagesize 1)))
+  (import "m" "mem1" (memory (;9;) 107))
+  (import "m" "mem1" (memory $c i64 107 (pagesize 1)))
+  (import "m" "mem1" (memory (;11;) i64 107))
+  (memory (;12;) 57 (pagesize 1))
+  (memory (;13;) 73 92 (pagesize 1))
+  (memory (;14;) 0 0 (pagesize 1))
+  (memory (;15;) 3 3 (pagesize 1))
+  (memory (;16;) 57)
+  (memory (;17;) 73 92)
+  (memory (;18;) 0 0)
+  (memory (;19;) 1 1)
+  (memory $a i64 57 (pagesize 1))
+  (memory $b i64 73 92 (pagesize 1))
+  (memory $d i64 0 0 (pagesize 1))
+  (memory $e i64 3 3 (pagesize 1))
+  (memory $k i64 0 0)
+  (memory $i i64 0 0)
+  (memory $j i64 1 1)
+  (memory (;27;) i64 57)
+  (memory (;28;) i64 73 92)
+  (memory (;29;) i64 0 0)
+  (memory (;30;) i64 1 1)
+  (memory (;31;) 4294967295 (pagesize 1))
+  (memory (;32;) i64 18446744073709551615 (pagesize 1))
+  (memory (;33;) 65536)
+  (memory (;34;) i64 281474976710656)
+  (data (;0;) (memory 14) (i32.const 0) "")
+  (data (;1;) (memory 15) (i32.const 0) "xyz")
+  (data (;2;) (memory 18) (i32.const 0) "")
+  (data (;3;) (memory 19) (i32.const 0) "xyz")
+  (data (;4;) (memory $d) (i64.const 0) "")
+  (data (;5;) (memory $e) (i64.const 0) "xyz")
+  (data (;6;) (memory $k) (i64.const 0) "")
+  (data (;7;) (memory $i) (i64.const 0) "")
+  (data (;8;) (memory $j) (i64.const 0) "xyz")
+  (data (;9;) (memory 29) (i64.const 0) "")
+  (data (;10;) (memory 30) (i64.const 0) "xyz"))
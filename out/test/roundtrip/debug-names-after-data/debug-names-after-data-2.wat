@@ -0,0 +1,5 @@
+(module
+  (type (;0;) (func))
+  (func $foo (type 0))
+  (memory (;0;) 1)
+  (data (;0;) (i32.const 0) "hi"))
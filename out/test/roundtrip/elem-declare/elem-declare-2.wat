@@ -0,0 +1,5 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0))
+  (table (;0;) 2 funcref)
+  (elem (;0;) declare funcref (ref.func 0) (ref.null func)))
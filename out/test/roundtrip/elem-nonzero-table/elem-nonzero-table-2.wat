@@ -0,0 +1,6 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0))
+  (table (;0;) 1 funcref)
+  (table (;1;) 1 funcref)
+  (elem (;0;) (table 1) (i32.const 0) func 0))
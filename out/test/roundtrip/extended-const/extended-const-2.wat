@@ -0,0 +1,16 @@
+(module
+  (type (;0;) (func))
+  (import "foo" "bar" (global (;0;) i32))
+  (func (;0;) (type 0))
+  (table (;0;) 1 funcref)
+  (memory (;0;) 1)
+  (global (;1;) (mut i32) (i32.sub
+      (i32.const 44)
+      (i32.const 3)))
+  (global (;2;) i32 (i32.const 45))
+  (elem (;0;) (i32.mul
+      (i32.const 4)
+      (global.get 0)) func 0)
+  (data (;0;) (i32.add
+      (global.get 0)
+      (i32.const 42)) "hello"))
@@ -0,0 +1,13 @@
+(module
+  (type (;0;) (func (param i32)))
+  (type (;1;) (func (param f32 i32)))
+  (type (;2;) (func))
+  (func (;0;) (type 2)
+    (throw 0
+      (i32.const 1)))
+  (func (;1;) (type 2)
+    (throw 1
+      (f32.const 0x1p+1 (;=2;))
+      (i32.const 1)))
+  (tag (;0;) (type 0) (param i32))
+  (tag (;1;) (type 1) (param f32 i32)))
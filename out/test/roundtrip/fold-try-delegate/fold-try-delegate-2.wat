@@ -0,0 +1,12 @@
+(module
+  (type (;0;) (func (result i32)))
+  (func (;0;) (type 0) (result i32)
+    (try (result i32)  ;; label = @1
+      (do
+        (try  ;; label = @2
+          (do
+            (nop))
+          (delegate 1))
+        (i32.const 7))
+      (catch_all
+        (i32.const 8)))))
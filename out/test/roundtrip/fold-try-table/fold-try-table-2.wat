@@ -0,0 +1,14 @@
+(module
+  (type (;0;) (func (result i32)))
+  (func (;0;) (type 0) (result i32)
+    (drop
+      (try_table (result i32)  ;; label = @1
+        (i32.const 6)))
+    (block  ;; label = @1
+      (drop
+        (try_table (result i32)  ;; label = @2
+          (catch_all 0 (;@1;))
+          (nop)
+          (br 2 (;@0;)
+            (i32.const 7)))))
+    (i32.const 8)))
@@ -0,0 +1,5 @@
+(module
+  (type (;0;) (func (result i32)))
+  (type (;1;) (func (param f32)))
+  (import "a" "b" (func (;0;) (type 0)))
+  (func (;1;) (type 1) (param f32)))
@@ -0,0 +1,18 @@
+(module
+  (type $t0 (func))
+  (func $f0 (type $t0)
+    i32.const 0
+    i32.const 0
+    i32.const 0
+    memory.init $d0
+    data.drop $d0)
+  (func $f1 (type $t0)
+    i32.const 0
+    i32.const 0
+    i32.const 0
+    table.init $T0 $e0
+    elem.drop $e0)
+  (table $T0 1 funcref)
+  (memory $M0 1)
+  (elem $e0 func $f0)
+  (data $d0 "a"))
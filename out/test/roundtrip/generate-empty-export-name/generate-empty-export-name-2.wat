@@ -0,0 +1,6 @@
+(module
+  (type $t0 (func))
+  (func $f0 (type $t0))
+  (func $named (type $t0))
+  (export "" (func $f0))
+  (export "named" (func $named)))
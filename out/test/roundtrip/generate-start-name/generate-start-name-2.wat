@@ -0,0 +1,4 @@
+(module
+  (type $t0 (func))
+  (func $f0 (type $t0))
+  (start $f0))
@@ -0,0 +1,3 @@
+(module
+  (type $t0 (func (param i32)))
+  (tag $e0 (type $t0) (param i32)))
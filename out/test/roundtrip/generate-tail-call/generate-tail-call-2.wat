@@ -0,0 +1,8 @@
+(module
+  (type $t0 (func))
+  (func $f0 (type $t0)
+    return_call $f0)
+  (func $f1 (type $t0)
+    i32.const 0
+    return_call_indirect (type $t0))
+  (table $T0 1 funcref))
@@ -0,0 +1,3 @@
+(module
+  (import "a" "b" (global (;0;) i32))
+  (global (;1;) f32 (f32.const 0x1.81cdp+13 (;=12345.6;))))
@@ -0,0 +1,6 @@
+(module
+  (type (;0;) (func (param i32)))
+  (func (;0;) (export "F") (import "mod" "f") (type 0) (param i32))
+  (global (;0;) (export "G") (import "mod" "g") f32)
+  (table (;0;) (export "T") (import "mod" "t") 1 2 funcref)
+  (memory (;0;) (export "M") (import "mod" "m") 3))
@@ -0,0 +1,13 @@
+(module
+  (type (;0;) (func))
+  (type (;1;) (func (param (ref func) (ref extern) (ref 0))))
+  (type (;2;) (func (param funcref externref (ref null 0))))
+  (func (;0;) (type 0))
+  (func (;1;) (type 1) (param (ref func) (ref extern) (ref 0))
+    (local (ref func) (ref func) (ref extern) (ref extern) (ref 0) (ref 0)))
+  (func (;2;) (type 2) (param funcref externref (ref null 0))
+    (local funcref funcref externref externref (ref null 0) (ref null 0)))
+  (global (;0;) (ref func) (ref.func 0))
+  (global (;1;) (ref 0) (ref.func 0))
+  (global (;2;) funcref (ref.null 0))
+  (global (;3;) (ref null 0) (ref.null 0)))
@@ -0,0 +1,6 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0))
+  (func (;1;) (type 0))
+  (export "a:\00 b:\01 c:\7f d:\c2\80 e:\df\bf f:\e0\a0\80 g:\ef\bf\bf h:\f0\90\80\80 i:\f4\8f\bf\bf" (func 0))
+  (export "Hello" (func 1)))
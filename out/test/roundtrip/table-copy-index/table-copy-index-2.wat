@@ -0,0 +1,9 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    i32.const 0
+    i32.const 0
+    i32.const 0
+    table.copy 0 1)
+  (table (;0;) 0 funcref)
+  (table (;1;) 0 funcref))
@@ -0,0 +1,3 @@
+(module
+  (table (;0;) i64 0 18446744073709551615 funcref)
+  (table (;1;) i64 18446744073709551615 18446744073709551615 funcref))
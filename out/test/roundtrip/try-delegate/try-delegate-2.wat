@@ -0,0 +1,12 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    try  ;; label = @1
+      try  ;; label = @2
+        nop
+      delegate 0
+      try  ;; label = @2
+        nop
+      delegate 0
+    catch_all
+    end))
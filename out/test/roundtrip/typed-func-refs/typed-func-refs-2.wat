@@ -0,0 +1,7 @@
+(module
+  (type $t0 (func))
+  (type $t1 (func))
+  (type $t2 (func (param (ref 0) (ref 1) (ref 1))))
+  (type (;3;) (func (param (ref 0) (ref 0))))
+  (func $f1 (type 3) (param (ref 0) (ref 0))
+    (local (ref 0) (ref 0) (ref 1) (ref 1))))
@@ -0,0 +1,35 @@
+(module
+  (type (;0;) (func))
+  (type (;1;) (func (result i32 i64)))
+  (type (;2;) (func (param i32)))
+  (func (;0;) (type 0)
+    block (result i32 i64)  ;; label = @1
+      i32.const 1
+      i64.const 2
+      br 0 (;@1;)
+    end
+    return)
+  (func (;1;) (type 0)
+    loop (result i32 i64)  ;; label = @1
+      br 0 (;@1;)
+    end
+    return)
+  (func (;2;) (type 0)
+    i32.const 1
+    loop (param i32)  ;; label = @1
+      drop
+      i32.const 2
+      br 0 (;@1;)
+    end)
+  (func (;3;) (type 0)
+    i32.const 1
+    if (result i32 i64)  ;; label = @1
+      i32.const 1
+      i64.const 2
+      br 0 (;@1;)
+    else
+      i32.const 3
+      i64.const 4
+      br 0 (;@1;)
+    end
+    return))
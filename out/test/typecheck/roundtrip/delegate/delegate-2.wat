@@ -0,0 +1,31 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    try  ;; label = @1
+      try  ;; label = @2
+        try  ;; label = @3
+          throw 0
+        delegate 0
+      catch 0
+      end
+    catch 0
+    end)
+  (func (;1;) (type 0)
+    try  ;; label = @1
+      block  ;; label = @2
+        try  ;; label = @3
+          throw 0
+        delegate 1
+      end
+    catch 0
+    end)
+  (func (;2;) (type 0)
+    try  ;; label = @1
+      block  ;; label = @2
+        try  ;; label = @3
+          throw 0
+        delegate 2
+      end
+    catch 0
+    end)
+  (tag (;0;) (type 0)))
@@ -0,0 +1,51 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    try  ;; label = @1
+      nop
+    catch 0
+      block  ;; label = @2
+        try  ;; label = @3
+          nop
+        catch 0
+          try  ;; label = @4
+            rethrow 1 (;@3;)
+            rethrow 1 (;@3;)
+            rethrow 3 (;@1;)
+            rethrow 3 (;@1;)
+          catch 0
+            rethrow 0 (;@4;)
+            rethrow 0 (;@4;)
+            rethrow 1 (;@3;)
+            rethrow 1 (;@3;)
+            rethrow 3 (;@1;)
+            rethrow 3 (;@1;)
+          end
+        end
+      end
+    end)
+  (func (;1;) (type 0)
+    try  ;; label = @1
+      nop
+    catch_all
+      block  ;; label = @2
+        try  ;; label = @3
+          nop
+        catch_all
+          try  ;; label = @4
+            rethrow 1 (;@3;)
+            rethrow 1 (;@3;)
+            rethrow 3 (;@1;)
+            rethrow 3 (;@1;)
+          catch_all
+            rethrow 0 (;@4;)
+            rethrow 0 (;@4;)
+            rethrow 1 (;@3;)
+            rethrow 1 (;@3;)
+            rethrow 3 (;@1;)
+            rethrow 3 (;@1;)
+          end
+        end
+      end
+    end)
+  (tag (;0;) (type 0)))
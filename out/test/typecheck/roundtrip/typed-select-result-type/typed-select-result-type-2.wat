@@ -0,0 +1,15 @@
+(module
+  (type (;0;) (func))
+  (type (;1;) (func (param externref externref) (result externref)))
+  (func (;0;) (type 0)
+    ref.null func
+    ref.null func
+    i32.const 1
+    select (result funcref)
+    global.set 0)
+  (func (;1;) (type 1) (param externref externref) (result externref)
+    local.get 0
+    local.get 1
+    i32.const 0
+    select (result externref))
+  (global (;0;) (mut funcref) (ref.null func)))
@@ -0,0 +1,40 @@
+(module
+  (type (;0;) (func))
+  (type (;1;) (func (result i32 i64)))
+  (type (;2;) (func (param i32)))
+  (func (;0;) (type 0)
+    (block (result i32 i64)  ;; label = @1
+      (br_if 0 (;@1;)
+        (i32.const 1)
+        (i64.const 2)
+        (i32.const 0)))
+    (return))
+  (func (;1;) (type 0)
+    (loop (result i32 i64)  ;; label = @1
+      (br_if 0 (;@1;)
+        (i32.const 0))
+      (i32.const 1)
+      (i64.const 2))
+    (return))
+  (func (;2;) (type 0)
+    (i32.const 1)
+    (loop (param i32)  ;; label = @1
+      (drop)
+      (drop
+        (br_if 0 (;@1;)
+          (i32.const 2)
+          (i32.const 0)))))
+  (func (;3;) (type 0)
+    (if (result i32 i64)  ;; label = @1
+      (i32.const 1)
+      (then
+        (br_if 0 (;@1;)
+          (i32.const 1)
+          (i64.const 2)
+          (i32.const 0)))
+      (else
+        (br_if 0 (;@1;)
+          (i32.const 3)
+          (i64.const 4)
+          (i32.const 0))))
+    (return)))
@@ -0,0 +1,10 @@
+(module
+  (type (;0;) (func (result i32)))
+  (func (;0;) (type 0) (result i32)
+    (block (result i32)  ;; label = @1
+      (i32.add
+        (block (result i32)  ;; label = @2
+          (i32.const 2))
+        (block (result i32)  ;; label = @2
+          (br 0 (;@2;)
+            (i32.const 3)))))))
@@ -0,0 +1,15 @@
+(module
+  (type (;0;) (func (result i32)))
+  (func (;0;) (type 0) (result i32)
+    (block  ;; label = @1
+      (block  ;; label = @2
+        (loop  ;; label = @3
+          (if  ;; label = @4
+            (i32.const 1)
+            (then
+              (br 3 (;@1;))))
+          (br 1 (;@2;))))
+      (return
+        (i32.const 2)))
+    (return
+      (i32.const 3))))
@@ -0,0 +1,49 @@
+(module
+  (type (;0;) (func))
+  (func (;0;) (type 0)
+    (try  ;; label = @1
+      (do
+        (nop))
+      (catch 0
+        (block  ;; label = @2
+          (try  ;; label = @3
+            (do
+              (nop))
+            (catch 0
+              (try  ;; label = @4
+                (do
+                  (rethrow 1 (;@3;))
+                  (rethrow 1 (;@3;))
+                  (rethrow 3 (;@1;))
+                  (rethrow 3 (;@1;)))
+                (catch 0
+                  (rethrow 0 (;@4;))
+                  (rethrow 0 (;@4;))
+                  (rethrow 1 (;@3;))
+                  (rethrow 1 (;@3;))
+                  (rethrow 3 (;@1;))
+                  (rethrow 3 (;@1;))))))))))
+  (func (;1;) (type 0)
+    (try  ;; label = @1
+      (do
+        (nop))
+      (catch_all
+        (block  ;; label = @2
+          (try  ;; label = @3
+            (do
+              (nop))
+            (catch_all
+              (try  ;; label = @4
+                (do
+                  (rethrow 1 (;@3;))
+                  (rethrow 1 (;@3;))
+                  (rethrow 3 (;@1;))
+                  (rethrow 3 (;@1;)))
+                (catch_all
+                  (rethrow 0 (;@4;))
+                  (rethrow 0 (;@4;))
+                  (rethrow 1 (;@3;))
+                  (rethrow 1 (;@3;))
+                  (rethrow 3 (;@1;))
+                  (rethrow 3 (;@1;))))))))))
+  (tag (;0;) (type 0)))
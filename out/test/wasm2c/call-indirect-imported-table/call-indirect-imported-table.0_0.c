@@ -0,0 +1,89 @@
+/* Automatically generated by wasm2c */
+#include "call-indirect-imported-table.0-impl.h"
+
+FUNC_TYPE_EXTERN_T(w2c_a_t0);
+FUNC_TYPE_EXTERN_T(w2c_a_t1);
+
+static void init_func_types(void) {
+  static bool interned;
+  static const wasm_rt_func_type_init_t types[] = {
+    {&w2c_a_t0, "\x07\x80\x96\x7a\x42\xf7\x3e\xe6\x70\x5c\x2f\xac\x83\xf5\x67\xd2\xa2\xa0\x69\x41\x5f\xf8\xe7\x96\x7f\x23\xab\x00\x03\x5f\x4a\x3c"},
+    {&w2c_a_t1, "\xe1\xbe\x1d\x1b\x04\xf4\x2e\xb3\xf5\x2f\x05\x8b\xda\x39\xd0\xab\x5c\xae\xfb\x73\x3c\xd0\x0f\xe5\xc6\xb0\xa8\x61\x3a\x48\x8d\xcd"},
+  };
+  wasm_rt_intern_func_types(&interned, types, 2);
+}
+
+static u32 wrap_w2c_a_f0(void *instance, u32 var_0) {
+  return w2c_a_f0((struct w2c_a*) instance, var_0);
+}
+static u64 wrap_w2c_a_f1(void *instance, u64 var_0) {
+  return w2c_a_f1((struct w2c_a*) instance, var_0);
+}
+
+const wasm_elem_segment_expr_t elem_segment_exprs_w2c_a_e0[] = {
+  {RefFunc, &w2c_a_t0, (wasm_rt_function_ptr_t)wrap_w2c_a_f0, {NULL}, 0},
+  {RefFunc, &w2c_a_t1, (wasm_rt_function_ptr_t)wrap_w2c_a_f1, {NULL}, 0},
+};
+
+static void init_tables(w2c_a* instance) {
+  wasm_rt_allocate_funcref_table(&instance->w2c_table, 2, 4294967295);
+  funcref_table_init(&instance->w2c_table, elem_segment_exprs_w2c_a_e0, 2, 0u, 0, 2, instance);
+}
+
+static void init_elem_instances(w2c_a *instance) {
+}
+
+/* export: 'table' */
+wasm_rt_funcref_table_t* w2c_a_table(w2c_a* instance) {
+  return &instance->w2c_table;
+}
+
+void wasm2c_a_instantiate(w2c_a* instance) {
+  assert(wasm_rt_is_initialized());
+  init_func_types();
+  init_tables(instance);
+  init_elem_instances(instance);
+}
+
+void wasm2c_a_free(w2c_a* instance) {
+  wasm_rt_free_funcref_table(&instance->w2c_table);
+}
+
+wasm_rt_func_type_t wasm2c_a_get_func_type(uint32_t param_count, uint32_t result_count, ...) {
+  va_list args;
+  init_func_types();
+  
+  if (param_count == 1 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_I32) {
+      va_end(args);
+      return w2c_a_t0;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 1 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I64 && va_arg(args, int) == WASM_RT_I64) {
+      va_end(args);
+      return w2c_a_t1;
+    }
+    va_end(args);
+  }
+  
+  return NULL;
+}
+
+u32 w2c_a_f0(w2c_a* instance, u32 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = var_p0;
+  var_i1 = 2u;
+  var_i0 *= var_i1;
+  FUNC_EPILOGUE;
+  return var_i0;
+}
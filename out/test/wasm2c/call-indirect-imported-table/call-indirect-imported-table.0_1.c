@@ -0,0 +1,16 @@
+/* Automatically generated by wasm2c */
+#include "call-indirect-imported-table.0-impl.h"
+
+u64 w2c_a_f1(w2c_a* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u64 var_j0, var_j1;
+  var_j0 = 0ull;
+  var_j1 = var_p0;
+  var_j0 -= var_j1;
+  FUNC_EPILOGUE;
+  return var_j0;
+}
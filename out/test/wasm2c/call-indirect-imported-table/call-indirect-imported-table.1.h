@@ -0,0 +1,52 @@
+/* Automatically generated by wasm2c */
+#ifndef CALL_INDIRECT_IMPORTED_TABLE_1_H_GENERATED_
+#define CALL_INDIRECT_IMPORTED_TABLE_1_H_GENERATED_
+
+#include "wasm-rt.h"
+
+#include <stdint.h>
+
+#ifndef WASM_RT_CORE_TYPES_DEFINED
+#define WASM_RT_CORE_TYPES_DEFINED
+typedef uint8_t u8;
+typedef int8_t s8;
+typedef uint16_t u16;
+typedef int16_t s16;
+typedef uint32_t u32;
+typedef int32_t s32;
+typedef uint64_t u64;
+typedef int64_t s64;
+typedef float f32;
+typedef double f64;
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct w2c_a;
+extern wasm_rt_funcref_table_t* w2c_a_table(struct w2c_a*);
+
+typedef struct w2c_b {
+  /* import: 'a' 'table' */
+  wasm_rt_funcref_table_t *w2c_a_table;
+} w2c_b;
+
+void wasm2c_b_instantiate(w2c_b*, struct w2c_a*);
+void wasm2c_b_free(w2c_b*);
+wasm_rt_func_type_t wasm2c_b_get_func_type(uint32_t param_count, uint32_t result_count, ...);
+
+extern const u32 wasm2c_b_min_a_table;
+extern const u32 wasm2c_b_max_a_table;
+
+/* export: 'call_ii' */
+u32 w2c_b_call_ii(w2c_b*, u32, u32);
+
+/* export: 'call_ll' */
+u64 w2c_b_call_ll(w2c_b*, u32, u64);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* CALL_INDIRECT_IMPORTED_TABLE_1_H_GENERATED_ */
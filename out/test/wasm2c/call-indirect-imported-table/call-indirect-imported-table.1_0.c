@@ -0,0 +1,107 @@
+/* Automatically generated by wasm2c */
+#include "call-indirect-imported-table.1-impl.h"
+
+FUNC_TYPE_EXTERN_T(w2c_b_t0);
+FUNC_TYPE_EXTERN_T(w2c_b_t1);
+FUNC_TYPE_EXTERN_T(w2c_b_t2);
+FUNC_TYPE_EXTERN_T(w2c_b_t3);
+
+static void init_func_types(void) {
+  static bool interned;
+  static const wasm_rt_func_type_init_t types[] = {
+    {&w2c_b_t0, "\x07\x80\x96\x7a\x42\xf7\x3e\xe6\x70\x5c\x2f\xac\x83\xf5\x67\xd2\xa2\xa0\x69\x41\x5f\xf8\xe7\x96\x7f\x23\xab\x00\x03\x5f\x4a\x3c"},
+    {&w2c_b_t1, "\xe1\xbe\x1d\x1b\x04\xf4\x2e\xb3\xf5\x2f\x05\x8b\xda\x39\xd0\xab\x5c\xae\xfb\x73\x3c\xd0\x0f\xe5\xc6\xb0\xa8\x61\x3a\x48\x8d\xcd"},
+    {&w2c_b_t2, "\x92\xfb\x6a\xdf\x49\x07\x0a\x83\xbe\x08\x02\x68\xcd\xf6\x95\x27\x4a\xc2\xf3\xe5\xe4\x7d\x29\x49\xe8\xed\x42\x92\x6a\x9d\xda\xf0"},
+    {&w2c_b_t3, "\xb7\x7b\x09\x27\x00\xd6\xf9\x20\xce\x8e\x68\xc0\x9f\x87\xc4\xe2\xe0\xd0\xc0\xd5\x5a\x8b\x45\x32\x3f\xbb\xec\xe6\xf4\x8d\xf4\x55"},
+  };
+  wasm_rt_intern_func_types(&interned, types, 4);
+}
+
+static void init_tables(w2c_b* instance) {
+}
+
+/* export: 'call_ii' */
+u32 w2c_b_call_ii(w2c_b* instance, u32 var_p0, u32 var_p1) {
+  u32 ret = w2c_b_call_ii_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'call_ll' */
+u64 w2c_b_call_ll(w2c_b* instance, u32 var_p0, u64 var_p1) {
+  u64 ret = w2c_b_call_ll_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+static void init_instance_import(w2c_b* instance, struct w2c_a* w2c_a_instance) {
+  instance->w2c_a_table = w2c_a_table(w2c_a_instance);
+}
+
+const u32 wasm2c_b_min_a_table = 2;
+const u32 wasm2c_b_max_a_table = 4294967295;
+
+void wasm2c_b_instantiate(w2c_b* instance, struct w2c_a* w2c_a_instance) {
+  assert(wasm_rt_is_initialized());
+  init_func_types();
+  init_instance_import(instance, w2c_a_instance);
+  init_tables(instance);
+}
+
+void wasm2c_b_free(w2c_b* instance) {
+}
+
+wasm_rt_func_type_t wasm2c_b_get_func_type(uint32_t param_count, uint32_t result_count, ...) {
+  va_list args;
+  init_func_types();
+  
+  if (param_count == 1 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_I32) {
+      va_end(args);
+      return w2c_b_t0;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 1 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I64 && va_arg(args, int) == WASM_RT_I64) {
+      va_end(args);
+      return w2c_b_t1;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 2 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_I32) {
+      va_end(args);
+      return w2c_b_t2;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 2 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_I64 && va_arg(args, int) == WASM_RT_I64) {
+      va_end(args);
+      return w2c_b_t3;
+    }
+    va_end(args);
+  }
+  
+  return NULL;
+}
+
+u32 w2c_b_call_ii_0(w2c_b* instance, u32 var_p0, u32 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = var_p1;
+  var_i1 = var_p0;
+  var_i0 = CALL_INDIRECT((*instance->w2c_a_table), u32 (*)(void*, u32), w2c_b_t0, var_i1, (*instance->w2c_a_table).data[var_i1].module_instance, var_i0);
+  FUNC_EPILOGUE;
+  return var_i0;
+}
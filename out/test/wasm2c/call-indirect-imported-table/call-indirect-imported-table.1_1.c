@@ -0,0 +1,17 @@
+/* Automatically generated by wasm2c */
+#include "call-indirect-imported-table.1-impl.h"
+
+u64 w2c_b_call_ll_0(w2c_b* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i1;
+  u64 var_j0;
+  var_j0 = var_p1;
+  var_i1 = var_p0;
+  var_j0 = CALL_INDIRECT((*instance->w2c_a_table), u64 (*)(void*, u64), w2c_b_t1, var_i1, (*instance->w2c_a_table).data[var_i1].module_instance, var_j0);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
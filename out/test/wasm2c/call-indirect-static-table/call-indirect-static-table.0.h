@@ -0,0 +1,69 @@
+/* Automatically generated by wasm2c */
+#ifndef CALL_INDIRECT_STATIC_TABLE_0_H_GENERATED_
+#define CALL_INDIRECT_STATIC_TABLE_0_H_GENERATED_
+
+#include "wasm-rt.h"
+
+#include <stdint.h>
+
+#ifndef WASM_RT_CORE_TYPES_DEFINED
+#define WASM_RT_CORE_TYPES_DEFINED
+typedef uint8_t u8;
+typedef int8_t s8;
+typedef uint16_t u16;
+typedef int16_t s16;
+typedef uint32_t u32;
+typedef int32_t s32;
+typedef uint64_t u64;
+typedef int64_t s64;
+typedef float f32;
+typedef double f64;
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct w2c_spectest;
+
+typedef struct w2c_call__indirect__static__table__0__wasm {
+  struct w2c_spectest* w2c_spectest_instance;
+  wasm_rt_funcref_table_t w2c_T0;
+  wasm_rt_funcref_table_t w2c_T1;
+} w2c_call__indirect__static__table__0__wasm;
+
+void wasm2c_call__indirect__static__table__0__wasm_instantiate(w2c_call__indirect__static__table__0__wasm*, struct w2c_spectest*);
+void wasm2c_call__indirect__static__table__0__wasm_free(w2c_call__indirect__static__table__0__wasm*);
+wasm_rt_func_type_t wasm2c_call__indirect__static__table__0__wasm_get_func_type(uint32_t param_count, uint32_t result_count, ...);
+
+#ifndef wasm_multi_ij
+#define wasm_multi_ij wasm_multi_ij
+struct wasm_multi_ij {
+  u32 i0;
+  u64 j1;
+};
+#endif  /* wasm_multi_ij */
+
+/* import: 'spectest' 'print_i32' */
+void w2c_spectest_print_i32(struct w2c_spectest*, u32);
+
+/* export: 'call_ii' */
+u32 w2c_call__indirect__static__table__0__wasm_call_ii(w2c_call__indirect__static__table__0__wasm*, u32, u32);
+
+/* export: 'call_v' */
+void w2c_call__indirect__static__table__0__wasm_call_v(w2c_call__indirect__static__table__0__wasm*, u32);
+
+/* export: 'call_multi' */
+struct wasm_multi_ij w2c_call__indirect__static__table__0__wasm_call_multi(w2c_call__indirect__static__table__0__wasm*, u32, u32);
+
+/* export: 'call_dynamic' */
+u32 w2c_call__indirect__static__table__0__wasm_call_dynamic(w2c_call__indirect__static__table__0__wasm*, u32, u32);
+
+/* export: 'set_dynamic' */
+void w2c_call__indirect__static__table__0__wasm_set_dynamic(w2c_call__indirect__static__table__0__wasm*);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* CALL_INDIRECT_STATIC_TABLE_0_H_GENERATED_ */
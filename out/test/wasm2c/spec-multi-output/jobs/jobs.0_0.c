@@ -0,0 +1,133 @@
+/* Automatically generated by wasm2c */
+#include "jobs.0-impl.h"
+
+FUNC_TYPE_EXTERN_T(w2c_jobs__0__wasm_t0) = "\xe1\xbe\x1d\x1b\x04\xf4\x2e\xb3\xf5\x2f\x05\x8b\xda\x39\xd0\xab\x5c\xae\xfb\x73\x3c\xd0\x0f\xe5\xc6\xb0\xa8\x61\x3a\x48\x8d\xcd";
+FUNC_TYPE_EXTERN_T(w2c_jobs__0__wasm_t1) = "\x07\x80\x96\x7a\x42\xf7\x3e\xe6\x70\x5c\x2f\xac\x83\xf5\x67\xd2\xa2\xa0\x69\x41\x5f\xf8\xe7\x96\x7f\x23\xab\x00\x03\x5f\x4a\x3c";
+
+static u64 wrap_w2c_jobs__0__wasm_fac_0(void *instance, u64 var_0) {
+  return w2c_jobs__0__wasm_fac_0((struct w2c_jobs__0__wasm*) instance, var_0);
+}
+static u32 wrap_w2c_jobs__0__wasm_even_0(void *instance, u32 var_0) {
+  return w2c_jobs__0__wasm_even_0((struct w2c_jobs__0__wasm*) instance, var_0);
+}
+static u32 wrap_w2c_jobs__0__wasm_odd_0(void *instance, u32 var_0) {
+  return w2c_jobs__0__wasm_odd_0((struct w2c_jobs__0__wasm*) instance, var_0);
+}
+
+const wasm_elem_segment_expr_t elem_segment_exprs_w2c_jobs__0__wasm_e0[] = {
+  {RefFunc, w2c_jobs__0__wasm_t0, (wasm_rt_function_ptr_t)wrap_w2c_jobs__0__wasm_fac_0, {NULL}, 0},
+  {RefFunc, w2c_jobs__0__wasm_t1, (wasm_rt_function_ptr_t)wrap_w2c_jobs__0__wasm_even_0, {NULL}, 0},
+  {RefFunc, w2c_jobs__0__wasm_t1, (wasm_rt_function_ptr_t)wrap_w2c_jobs__0__wasm_odd_0, {NULL}, 0},
+};
+
+static void init_tables(w2c_jobs__0__wasm* instance) {
+  wasm_rt_allocate_funcref_table(&instance->w2c_T0, 3, 3);
+  funcref_table_init(&instance->w2c_T0, elem_segment_exprs_w2c_jobs__0__wasm_e0, 3, 0u, 0, 3, instance);
+}
+
+static void init_elem_instances(w2c_jobs__0__wasm *instance) {
+}
+
+/* export: 'fac' */
+u64 w2c_jobs__0__wasm_fac(w2c_jobs__0__wasm* instance, u64 var_p0) {
+  u64 ret = w2c_jobs__0__wasm_fac_0(instance, var_p0);
+  return ret;
+}
+
+/* export: 'even' */
+u32 w2c_jobs__0__wasm_even(w2c_jobs__0__wasm* instance, u32 var_p0) {
+  u32 ret = w2c_jobs__0__wasm_even_0(instance, var_p0);
+  return ret;
+}
+
+/* export: 'odd' */
+u32 w2c_jobs__0__wasm_odd(w2c_jobs__0__wasm* instance, u32 var_p0) {
+  u32 ret = w2c_jobs__0__wasm_odd_0(instance, var_p0);
+  return ret;
+}
+
+/* export: 'sum' */
+u32 w2c_jobs__0__wasm_sum(w2c_jobs__0__wasm* instance, u32 var_p0) {
+  u32 ret = w2c_jobs__0__wasm_sum_0(instance, var_p0);
+  return ret;
+}
+
+void wasm2c_jobs__0__wasm_instantiate(w2c_jobs__0__wasm* instance) {
+  assert(wasm_rt_is_initialized());
+  init_tables(instance);
+  init_elem_instances(instance);
+}
+
+void wasm2c_jobs__0__wasm_free(w2c_jobs__0__wasm* instance) {
+  wasm_rt_free_funcref_table(&instance->w2c_T0);
+}
+
+wasm_rt_func_type_t wasm2c_jobs__0__wasm_get_func_type(uint32_t param_count, uint32_t result_count, ...) {
+  va_list args;
+  
+  if (param_count == 1 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I64 && va_arg(args, int) == WASM_RT_I64) {
+      va_end(args);
+      return w2c_jobs__0__wasm_t0;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 1 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_I32) {
+      va_end(args);
+      return w2c_jobs__0__wasm_t1;
+    }
+    va_end(args);
+  }
+  
+  return NULL;
+}
+
+u64 w2c_jobs__0__wasm_fac_0(w2c_jobs__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0, var_j1, var_j2;
+  var_j0 = var_p0;
+  var_i0 = !(var_j0);
+  if (var_i0) {
+    var_j0 = 1ull;
+  } else {
+    var_j0 = var_p0;
+    var_j1 = var_p0;
+    var_j2 = 1ull;
+    var_j1 -= var_j2;
+    var_j1 = w2c_jobs__0__wasm_fac_0(instance, var_j1);
+    var_j0 *= var_j1;
+  }
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u32 w2c_jobs__0__wasm_even_0(w2c_jobs__0__wasm* instance, u32 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = var_p0;
+  var_i0 = !(var_i0);
+  if (var_i0) {
+    var_i0 = 1u;
+  } else {
+    var_i0 = var_p0;
+    var_i1 = 1u;
+    var_i0 -= var_i1;
+    var_i1 = 2u;
+    var_i0 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*, u32), w2c_jobs__0__wasm_t1, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_i0);
+  }
+  FUNC_EPILOGUE;
+  return var_i0;
+}
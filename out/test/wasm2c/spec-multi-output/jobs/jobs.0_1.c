@@ -0,0 +1,50 @@
+/* Automatically generated by wasm2c */
+#include "jobs.0-impl.h"
+
+u32 w2c_jobs__0__wasm_odd_0(w2c_jobs__0__wasm* instance, u32 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = var_p0;
+  var_i0 = !(var_i0);
+  if (var_i0) {
+    var_i0 = 0u;
+  } else {
+    var_i0 = var_p0;
+    var_i1 = 1u;
+    var_i0 -= var_i1;
+    var_i0 = w2c_jobs__0__wasm_even_0(instance, var_i0);
+  }
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_jobs__0__wasm_sum_0(w2c_jobs__0__wasm* instance, u32 var_p0) {
+  u32 var_l1 = 0;
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_L1: 
+    var_i0 = var_p0;
+    var_i0 = !(var_i0);
+    if (var_i0) {goto var_B0;}
+    var_i0 = var_l1;
+    var_i1 = var_p0;
+    var_i0 += var_i1;
+    var_l1 = var_i0;
+    var_i0 = var_p0;
+    var_i1 = 1u;
+    var_i0 -= var_i1;
+    var_p0 = var_i0;
+    goto var_L1;
+  var_B0:;
+  var_i0 = var_l1;
+  FUNC_EPILOGUE;
+  return var_i0;
+}
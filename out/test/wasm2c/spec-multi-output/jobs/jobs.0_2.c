@@ -0,0 +1,2 @@
+/* Empty wasm2c generated file */
+typedef int dummy_def;
\ No newline at end of file
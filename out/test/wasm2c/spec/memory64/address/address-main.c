@@ -0,0 +1,1303 @@
+#include "address.0.h"
+#include "address.2.h"
+#include "address.3.h"
+#include "address.4.h"
+#include <assert.h>
+#define __STDC_FORMAT_MACROS
+#include <inttypes.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "wasm-rt.h"
+#include "wasm-rt-impl.h"
+#include "wasm-rt-exceptions.h"
+
+/* NOTE: function argument evaluation order is implementation-defined in C,
+   so it SHOULD NOT be relied on by tests. */
+#if WABT_BIG_ENDIAN
+#define v128_i8x16_make(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p) \
+	simde_wasm_i8x16_make(p,o,n,m,l,k,j,i,h,g,f,e,d,c,b,a)
+#define v128_u8x16_make(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p) \
+	simde_wasm_u8x16_make(p,o,n,m,l,k,j,i,h,g,f,e,d,c,b,a)
+#define v128_i16x8_make(a,b,c,d,e,f,g,h) simde_wasm_i16x8_make(h,g,f,e,d,c,b,a)
+#define v128_u16x8_make(a,b,c,d,e,f,g,h) simde_wasm_u16x8_make(h,g,f,e,d,c,b,a)
+#define v128_i32x4_make(a,b,c,d) simde_wasm_i32x4_make(d,c,b,a)
+#define v128_u32x4_make(a,b,c,d) simde_wasm_u32x4_make(d,c,b,a)
+#define v128_i64x2_make(a,b) simde_wasm_i64x2_make(b,a)
+#define v128_u64x2_make(a,b) simde_wasm_u64x2_make(b,a)
+#define v128_f32x4_make(a,b,c,d) simde_wasm_f32x4_make(d,c,b,a)
+#define v128_f64x2_make(a,b) simde_wasm_f64x2_make(b,a)
+#define v128_i8x16_extract_lane(a,n) simde_wasm_u8x16_extract_lane(a,15-(n))
+#define v128_u8x16_extract_lane(a,n) simde_wasm_u8x16_extract_lane(a,15-(n))
+#define v128_i16x8_extract_lane(a,n) simde_wasm_u16x8_extract_lane(a,7-(n))
+#define v128_u16x8_extract_lane(a,n) simde_wasm_u16x8_extract_lane(a,7-(n))
+#define v128_i32x4_extract_lane(a,n) simde_wasm_u32x4_extract_lane(a,3-(n))
+#define v128_u32x4_extract_lane(a,n) simde_wasm_u32x4_extract_lane(a,3-(n))
+#define v128_i64x2_extract_lane(a,n) simde_wasm_u64x2_extract_lane(a,1-(n))
+#define v128_u64x2_extract_lane(a,n) simde_wasm_u64x2_extract_lane(a,1-(n))
+#define v128_f32x4_extract_lane(a,n) simde_wasm_f32x4_extract_lane(a,3-(n))
+#define v128_f64x2_extract_lane(a,n) simde_wasm_f64x2_extract_lane(a,1-(n))
+#else
+#define v128_i8x16_make simde_wasm_i8x16_make
+#define v128_u8x16_make simde_wasm_u8x16_make
+#define v128_i16x8_make simde_wasm_i16x8_make
+#define v128_u16x8_make simde_wasm_u16x8_make
+#define v128_i32x4_make simde_wasm_i32x4_make
+#define v128_u32x4_make simde_wasm_u32x4_make
+#define v128_i64x2_make simde_wasm_i64x2_make
+#define v128_u64x2_make simde_wasm_u64x2_make
+#define v128_f32x4_make simde_wasm_f32x4_make
+#define v128_f64x2_make simde_wasm_f64x2_make
+// like is_equal_TYPE below, always use unsigned for these
+#define v128_i8x16_extract_lane simde_wasm_u8x16_extract_lane
+#define v128_u8x16_extract_lane simde_wasm_u8x16_extract_lane
+#define v128_i16x8_extract_lane simde_wasm_u16x8_extract_lane
+#define v128_u16x8_extract_lane simde_wasm_u16x8_extract_lane
+#define v128_i32x4_extract_lane simde_wasm_u32x4_extract_lane
+#define v128_u32x4_extract_lane simde_wasm_u32x4_extract_lane
+#define v128_i64x2_extract_lane simde_wasm_u64x2_extract_lane
+#define v128_u64x2_extract_lane simde_wasm_u64x2_extract_lane
+#define v128_f32x4_extract_lane simde_wasm_f32x4_extract_lane
+#define v128_f64x2_extract_lane simde_wasm_f64x2_extract_lane
+#endif
+
+static int g_tests_run;
+static int g_tests_passed;
+
+static void run_spec_tests(void);
+
+static void error(const char* file, int line, const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  fprintf(stderr, "%s:%d: assertion failed: ", file, line);
+  vfprintf(stderr, format, args);
+  va_end(args);
+}
+
+#define ASSERT_EXCEPTION(f)                                               \
+  do {                                                                    \
+    g_tests_run++;                                                        \
+    if (wasm_rt_impl_try() == WASM_RT_TRAP_UNCAUGHT_EXCEPTION) {          \
+      g_tests_passed++;                                                   \
+    } else {                                                              \
+      (void)(f);                                                          \
+      error(__FILE__, __LINE__, "expected " #f " to throw exception.\n"); \
+    }                                                                     \
+  } while (0)
+
+#define ASSERT_TRAP(f)                                         \
+  do {                                                         \
+    g_tests_run++;                                             \
+    if (wasm_rt_impl_try() != 0) {                             \
+      g_tests_passed++;                                        \
+    } else {                                                   \
+      (void)(f);                                               \
+      error(__FILE__, __LINE__, "expected " #f " to trap.\n"); \
+    }                                                          \
+  } while (0)
+
+#define ASSERT_EXHAUSTION(f)                                     \
+  do {                                                           \
+    g_tests_run++;                                               \
+    wasm_rt_trap_t code = wasm_rt_impl_try();                    \
+    switch (code) {                                              \
+      case WASM_RT_TRAP_NONE:                                    \
+        (void)(f);                                               \
+        error(__FILE__, __LINE__, "expected " #f " to trap.\n"); \
+        break;                                                   \
+      case WASM_RT_TRAP_EXHAUSTION:                              \
+        g_tests_passed++;                                        \
+        break;                                                   \
+      default:                                                   \
+        error(__FILE__, __LINE__,                                \
+              "expected " #f                                     \
+              " to trap due to exhaustion, got trap code %d.\n", \
+              code);                                             \
+        break;                                                   \
+    }                                                            \
+  } while (0)
+
+#define ASSERT_RETURN(f)                               \
+  do {                                                 \
+    g_tests_run++;                                     \
+    int trap_code = wasm_rt_impl_try();                \
+    if (trap_code) {                                   \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n", \
+            wasm_rt_strerror(trap_code));              \
+    } else {                                           \
+      f;                                               \
+      g_tests_passed++;                                \
+    }                                                  \
+  } while (0)
+
+#define ASSERT_RETURN_T(type, fmt, f, expected)                          \
+  do {                                                                   \
+    g_tests_run++;                                                       \
+    int trap_code = wasm_rt_impl_try();                                  \
+    if (trap_code) {                                                     \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                   \
+            wasm_rt_strerror(trap_code));                                \
+    } else {                                                             \
+      type actual = f;                                                   \
+      if (is_equal_##type(actual, expected)) {                           \
+        g_tests_passed++;                                                \
+      } else {                                                           \
+        error(__FILE__, __LINE__,                                        \
+              "in " #f ": expected %" fmt ", got %" fmt ".\n", expected, \
+              actual);                                                   \
+      }                                                                  \
+    }                                                                    \
+  } while (0)
+
+#define ASSERT_RETURN_FUNCREF(f, expected)                                \
+  do {                                                                    \
+    g_tests_run++;                                                        \
+    int trap_code = wasm_rt_impl_try();                                   \
+    if (trap_code) {                                                      \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                    \
+            wasm_rt_strerror(trap_code));                                 \
+    } else {                                                              \
+      wasm_rt_funcref_t actual = f;                                       \
+      if (is_equal_wasm_rt_funcref_t(actual, expected)) {                 \
+        g_tests_passed++;                                                 \
+      } else {                                                            \
+        error(__FILE__, __LINE__,                                         \
+              "in " #f ": mismatch between expected and actual funcref"); \
+      }                                                                   \
+    }                                                                     \
+  } while (0)
+
+#define ASSERT_RETURN_EXNREF(f, expected)                                \
+  do {                                                                   \
+    g_tests_run++;                                                       \
+    int trap_code = wasm_rt_impl_try();                                  \
+    if (trap_code) {                                                     \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                   \
+            wasm_rt_strerror(trap_code));                                \
+    } else {                                                             \
+      wasm_rt_exnref_t actual = f;                                       \
+      if (is_equal_wasm_rt_exnref_t(actual, expected)) {                 \
+        g_tests_passed++;                                                \
+      } else {                                                           \
+        error(__FILE__, __LINE__,                                        \
+              "in " #f ": mismatch between expected and actual exnref"); \
+      }                                                                  \
+    }                                                                    \
+  } while (0)
+
+#define ASSERT_RETURN_NAN_T(type, itype, fmt, f, kind)                        \
+  do {                                                                        \
+    g_tests_run++;                                                            \
+    int trap_code = wasm_rt_impl_try();                                       \
+    if (trap_code) {                                                          \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                        \
+            wasm_rt_strerror(trap_code));                                     \
+    } else {                                                                  \
+      type actual = f;                                                        \
+      itype iactual;                                                          \
+      memcpy(&iactual, &actual, sizeof(iactual));                             \
+      if (is_##kind##_nan_##type(iactual)) {                                  \
+        g_tests_passed++;                                                     \
+      } else {                                                                \
+        error(__FILE__, __LINE__,                                             \
+              "in " #f ": expected result to be a " #kind " nan, got 0x%" fmt \
+              ".\n",                                                          \
+              iactual);                                                       \
+      }                                                                       \
+    }                                                                         \
+  } while (0)
+
+#define MULTI_T_UNPACK_(...) __VA_ARGS__
+#define MULTI_T_UNPACK(arg) MULTI_T_UNPACK_ arg
+#define MULTI_i8 "%" PRIu8 " "
+#define MULTI_i16 "%" PRIu16 " "
+#define MULTI_i32 "%u "
+#define MULTI_i64 "%" PRIu64 " "
+#define MULTI_f32 "%.9g "
+#define MULTI_f64 "%.17g "
+#define MULTI_str "%s "
+#define ASSERT_RETURN_MULTI_T(type, fmt_expected, fmt_got, f, compare,        \
+                              expected, found)                                \
+  do {                                                                        \
+    g_tests_run++;                                                            \
+    int trap_code = wasm_rt_impl_try();                                       \
+    if (trap_code) {                                                          \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                        \
+            wasm_rt_strerror(trap_code));                                     \
+    } else {                                                                  \
+      type actual = f;                                                        \
+      if (compare) {                                                          \
+        g_tests_passed++;                                                     \
+      } else {                                                                \
+        error(__FILE__, __LINE__,                                             \
+              "in " #f ": expected <" fmt_expected ">, got <" fmt_got ">.\n", \
+              MULTI_T_UNPACK(expected), MULTI_T_UNPACK(found));               \
+      }                                                                       \
+    }                                                                         \
+  } while (0)
+
+
+#define ASSERT_RETURN_I32(f, expected) ASSERT_RETURN_T(u32, "u", f, expected)
+#define ASSERT_RETURN_I64(f, expected) ASSERT_RETURN_T(u64, PRIu64, f, expected)
+#define ASSERT_RETURN_F32(f, expected) ASSERT_RETURN_T(f32, ".9g", f, expected)
+#define ASSERT_RETURN_F64(f, expected) ASSERT_RETURN_T(f64, ".17g", f, expected)
+#define ASSERT_RETURN_EXTERNREF(f, expected) \
+  ASSERT_RETURN_T(wasm_rt_externref_t, "p", f, expected);
+
+#define ASSERT_RETURN_CANONICAL_NAN_F32(f) \
+  ASSERT_RETURN_NAN_T(f32, u32, "08x", f, canonical)
+#define ASSERT_RETURN_CANONICAL_NAN_F64(f) \
+  ASSERT_RETURN_NAN_T(f64, u64, "016x", f, canonical)
+#define ASSERT_RETURN_ARITHMETIC_NAN_F32(f) \
+  ASSERT_RETURN_NAN_T(f32, u32, "08x", f, arithmetic)
+#define ASSERT_RETURN_ARITHMETIC_NAN_F64(f) \
+  ASSERT_RETURN_NAN_T(f64, u64, "016x", f, arithmetic)
+
+static bool is_equal_u8(u8 x, u8 y) {
+  return x == y;
+}
+
+static bool is_equal_u16(u16 x, u16 y) {
+  return x == y;
+}
+
+static bool is_equal_u32(u32 x, u32 y) {
+  return x == y;
+}
+
+static bool is_equal_u64(u64 x, u64 y) {
+  return x == y;
+}
+
+#define is_equal_i8 is_equal_u8
+#define is_equal_i16 is_equal_u16
+#define is_equal_i32 is_equal_u32
+#define is_equal_i64 is_equal_u64
+
+static bool is_equal_wasm_rt_externref_t(wasm_rt_externref_t x,
+                                         wasm_rt_externref_t y) {
+  return x == y;
+}
+
+static inline bool is_equal_wasm_rt_func_type_t(const wasm_rt_func_type_t a,
+                                                const wasm_rt_func_type_t b) {
+  return (a == b) || (a && b && !memcmp(a, b, 32));
+}
+
+static bool is_equal_wasm_rt_funcref_t(wasm_rt_funcref_t x,
+                                       wasm_rt_funcref_t y) {
+  return is_equal_wasm_rt_func_type_t(x.func_type, y.func_type) &&
+         (x.func == y.func) && (x.module_instance == y.module_instance);
+}
+
+#ifdef WASM_EXN_MAX_SIZE
+static bool is_equal_wasm_rt_exnref_t(wasm_rt_exnref_t x, wasm_rt_exnref_t y) {
+  return x.tag == y.tag && x.size == y.size && !memcmp(x.data, y.data, x.size);
+}
+#endif
+
+wasm_rt_externref_t spectest_make_externref(uintptr_t x) {
+  return (wasm_rt_externref_t)(x + 1);  // externref(0) is not null
+}
+
+static u32 f32_bits(f32 x) {
+  u32 ux;
+  memcpy(&ux, &x, sizeof(ux));
+  return ux;
+}
+
+static u64 f64_bits(f64 x) {
+  u64 ux;
+  memcpy(&ux, &x, sizeof(ux));
+  return ux;
+}
+
+static bool is_equal_f32(f32 x, f32 y) {
+  return f32_bits(x) == f32_bits(y);
+}
+
+static bool is_equal_f64(f64 x, f64 y) {
+  return f64_bits(x) == f64_bits(y);
+}
+
+static f32 make_nan_f32(u32 x) {
+  x |= 0x7f800000;
+  f32 res;
+  memcpy(&res, &x, sizeof(res));
+  return res;
+}
+
+static f64 make_nan_f64(u64 x) {
+  x |= 0x7ff0000000000000;
+  f64 res;
+  memcpy(&res, &x, sizeof(res));
+  return res;
+}
+
+static bool is_canonical_nan_f32(u32 x) {
+  return (x & 0x7fffffff) == 0x7fc00000;
+}
+
+static bool is_canonical_nan_f64(u64 x) {
+  return (x & 0x7fffffffffffffff) == 0x7ff8000000000000;
+}
+
+static bool is_arithmetic_nan_f32(u32 x) {
+  return (x & 0x7fc00000) == 0x7fc00000;
+}
+
+static bool is_arithmetic_nan_f64(u64 x) {
+  return (x & 0x7ff8000000000000) == 0x7ff8000000000000;
+}
+
+typedef struct w2c_spectest {
+  wasm_rt_funcref_table_t spectest_table;
+  wasm_rt_funcref_table_t spectest_table64;
+  wasm_rt_memory_t spectest_memory;
+  uint32_t spectest_global_i32;
+  uint64_t spectest_global_i64;
+  float spectest_global_f32;
+  double spectest_global_f64;
+} w2c_spectest;
+
+static w2c_spectest spectest_instance;
+
+/*
+ * spectest implementations
+ */
+void w2c_spectest_print(w2c_spectest* instance) {
+  printf("spectest.print()\n");
+}
+
+void w2c_spectest_print_i32(w2c_spectest* instance, uint32_t i) {
+  printf("spectest.print_i32(%d)\n", i);
+}
+
+void w2c_spectest_print_i64(w2c_spectest* instance, uint64_t i) {
+  printf("spectest.print_i64(%" PRIu64 ")\n", i);
+}
+
+void w2c_spectest_print_f32(w2c_spectest* instance, float f) {
+  printf("spectest.print_f32(%g)\n", f);
+}
+
+void w2c_spectest_print_i32_f32(w2c_spectest* instance, uint32_t i, float f) {
+  printf("spectest.print_i32_f32(%d %g)\n", i, f);
+}
+
+void w2c_spectest_print_f64(w2c_spectest* instance, double d) {
+  printf("spectest.print_f64(%g)\n", d);
+}
+
+void w2c_spectest_print_f64_f64(w2c_spectest* instance, double d1, double d2) {
+  printf("spectest.print_f64_f64(%g %g)\n", d1, d2);
+}
+
+wasm_rt_funcref_table_t* w2c_spectest_table(w2c_spectest* instance) {
+  return &instance->spectest_table;
+}
+
+wasm_rt_funcref_table_t* w2c_spectest_table64(w2c_spectest* instance) {
+  return &instance->spectest_table64;
+}
+
+wasm_rt_memory_t* w2c_spectest_memory(w2c_spectest* instance) {
+  return &instance->spectest_memory;
+}
+
+uint32_t* w2c_spectest_global_i32(w2c_spectest* instance) {
+  return &instance->spectest_global_i32;
+}
+
+uint64_t* w2c_spectest_global_i64(w2c_spectest* instance) {
+  return &instance->spectest_global_i64;
+}
+
+float* w2c_spectest_global_f32(w2c_spectest* instance) {
+  return &instance->spectest_global_f32;
+}
+
+double* w2c_spectest_global_f64(w2c_spectest* instance) {
+  return &instance->spectest_global_f64;
+}
+
+static void init_spectest_module(w2c_spectest* instance) {
+  instance->spectest_global_i32 = 666;
+  instance->spectest_global_i64 = 666l;
+  instance->spectest_global_f32 = 666.6;
+  instance->spectest_global_f64 = 666.6;
+  wasm_rt_allocate_memory(&instance->spectest_memory, 1, 2, false,
+                          WASM_DEFAULT_PAGE_SIZE);
+  wasm_rt_allocate_funcref_table(&instance->spectest_table, 10, 20);
+  wasm_rt_allocate_funcref_table(&instance->spectest_table64, 10, 20);
+}
+
+// POSIX-only test config where embedder handles signals instead of w2c runtime
+#ifdef WASM2C_TEST_EMBEDDER_SIGNAL_HANDLING
+#include <signal.h>
+
+static void posix_signal_handler(int sig, siginfo_t* si, void* unused) {
+  wasm_rt_trap((si->si_code == SEGV_ACCERR) ? WASM_RT_TRAP_OOB
+                                            : WASM_RT_TRAP_EXHAUSTION);
+}
+
+static void posix_install_signal_handler(void) {
+  /* install altstack */
+  stack_t ss;
+  ss.ss_sp = malloc(SIGSTKSZ);
+  ss.ss_flags = 0;
+  ss.ss_size = SIGSTKSZ;
+  if (sigaltstack(&ss, NULL) != 0) {
+    perror("sigaltstack failed");
+    abort();
+  }
+
+  /* install signal handler */
+  struct sigaction sa;
+  memset(&sa, '\0', sizeof(sa));
+  sa.sa_flags = SA_SIGINFO | SA_ONSTACK;
+  sigemptyset(&sa.sa_mask);
+  sa.sa_sigaction = posix_signal_handler;
+  if (sigaction(SIGSEGV, &sa, NULL) != 0 || sigaction(SIGBUS, &sa, NULL) != 0) {
+    perror("sigaction failed");
+    abort();
+  }
+}
+
+static void posix_cleanup_signal_handler(void) {
+  /* remove signal handler */
+  struct sigaction sa;
+  memset(&sa, '\0', sizeof(sa));
+  sa.sa_handler = SIG_DFL;
+  if (sigaction(SIGSEGV, &sa, NULL) != 0 || sigaction(SIGBUS, &sa, NULL)) {
+    perror("sigaction failed");
+    abort();
+  }
+
+  /* disable and free altstack */
+  stack_t ss;
+  ss.ss_flags = SS_DISABLE;
+  if (sigaltstack(&ss, NULL) != 0) {
+    perror("sigaltstack failed");
+    abort();
+  }
+  free(ss.ss_sp);
+}
+#endif
+
+int main(int argc, char** argv) {
+#ifdef WASM2C_TEST_EMBEDDER_SIGNAL_HANDLING
+  posix_install_signal_handler();
+#endif
+  wasm_rt_init();
+  init_spectest_module(&spectest_instance);
+  run_spec_tests();
+  printf("%u/%u tests passed.\n", g_tests_passed, g_tests_run);
+  wasm_rt_free();
+#ifdef WASM2C_TEST_EMBEDDER_SIGNAL_HANDLING
+  posix_cleanup_signal_handler();
+#endif
+  return g_tests_passed != g_tests_run;
+}
+
+w2c_address__0__wasm address__0__wasm_instance;
+w2c_address__2__wasm address__2__wasm_instance;
+w2c_address__3__wasm address__3__wasm_instance;
+w2c_address__4__wasm address__4__wasm_instance;
+
+void run_spec_tests_0(void) {
+
+#line 3 "address.wast"
+wasm2c_address__0__wasm_instantiate(&address__0__wasm_instance);
+
+#line 104 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8u_good1(&address__0__wasm_instance, 0u), 97u);
+
+#line 105 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8u_good2(&address__0__wasm_instance, 0u), 97u);
+
+#line 106 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8u_good3(&address__0__wasm_instance, 0u), 98u);
+
+#line 107 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8u_good4(&address__0__wasm_instance, 0u), 99u);
+
+#line 108 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8u_good5(&address__0__wasm_instance, 0u), 122u);
+
+#line 110 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8s_good1(&address__0__wasm_instance, 0u), 97u);
+
+#line 111 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8s_good2(&address__0__wasm_instance, 0u), 97u);
+
+#line 112 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8s_good3(&address__0__wasm_instance, 0u), 98u);
+
+#line 113 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8s_good4(&address__0__wasm_instance, 0u), 99u);
+
+#line 114 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8s_good5(&address__0__wasm_instance, 0u), 122u);
+
+#line 116 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16u_good1(&address__0__wasm_instance, 0u), 25185u);
+
+#line 117 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16u_good2(&address__0__wasm_instance, 0u), 25185u);
+
+#line 118 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16u_good3(&address__0__wasm_instance, 0u), 25442u);
+
+#line 119 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16u_good4(&address__0__wasm_instance, 0u), 25699u);
+
+#line 120 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16u_good5(&address__0__wasm_instance, 0u), 122u);
+
+#line 122 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16s_good1(&address__0__wasm_instance, 0u), 25185u);
+
+#line 123 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16s_good2(&address__0__wasm_instance, 0u), 25185u);
+
+#line 124 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16s_good3(&address__0__wasm_instance, 0u), 25442u);
+
+#line 125 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16s_good4(&address__0__wasm_instance, 0u), 25699u);
+
+#line 126 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16s_good5(&address__0__wasm_instance, 0u), 122u);
+
+#line 128 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_32_good1(&address__0__wasm_instance, 0u), 1684234849u);
+
+#line 129 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_32_good2(&address__0__wasm_instance, 0u), 1684234849u);
+
+#line 130 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_32_good3(&address__0__wasm_instance, 0u), 1701077858u);
+
+#line 131 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_32_good4(&address__0__wasm_instance, 0u), 1717920867u);
+
+#line 132 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_32_good5(&address__0__wasm_instance, 0u), 122u);
+
+#line 134 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8u_good1(&address__0__wasm_instance, 65507u), 0u);
+
+#line 135 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8u_good2(&address__0__wasm_instance, 65507u), 0u);
+
+#line 136 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8u_good3(&address__0__wasm_instance, 65507u), 0u);
+
+#line 137 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8u_good4(&address__0__wasm_instance, 65507u), 0u);
+
+#line 138 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8u_good5(&address__0__wasm_instance, 65507u), 0u);
+
+#line 140 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8s_good1(&address__0__wasm_instance, 65507u), 0u);
+
+#line 141 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8s_good2(&address__0__wasm_instance, 65507u), 0u);
+
+#line 142 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8s_good3(&address__0__wasm_instance, 65507u), 0u);
+
+#line 143 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8s_good4(&address__0__wasm_instance, 65507u), 0u);
+
+#line 144 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8s_good5(&address__0__wasm_instance, 65507u), 0u);
+
+#line 146 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16u_good1(&address__0__wasm_instance, 65507u), 0u);
+
+#line 147 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16u_good2(&address__0__wasm_instance, 65507u), 0u);
+
+#line 148 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16u_good3(&address__0__wasm_instance, 65507u), 0u);
+
+#line 149 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16u_good4(&address__0__wasm_instance, 65507u), 0u);
+
+#line 150 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16u_good5(&address__0__wasm_instance, 65507u), 0u);
+
+#line 152 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16s_good1(&address__0__wasm_instance, 65507u), 0u);
+
+#line 153 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16s_good2(&address__0__wasm_instance, 65507u), 0u);
+
+#line 154 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16s_good3(&address__0__wasm_instance, 65507u), 0u);
+
+#line 155 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16s_good4(&address__0__wasm_instance, 65507u), 0u);
+
+#line 156 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16s_good5(&address__0__wasm_instance, 65507u), 0u);
+
+#line 158 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_32_good1(&address__0__wasm_instance, 65507u), 0u);
+
+#line 159 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_32_good2(&address__0__wasm_instance, 65507u), 0u);
+
+#line 160 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_32_good3(&address__0__wasm_instance, 65507u), 0u);
+
+#line 161 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_32_good4(&address__0__wasm_instance, 65507u), 0u);
+
+#line 162 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_32_good5(&address__0__wasm_instance, 65507u), 0u);
+
+#line 164 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8u_good1(&address__0__wasm_instance, 65508u), 0u);
+
+#line 165 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8u_good2(&address__0__wasm_instance, 65508u), 0u);
+
+#line 166 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8u_good3(&address__0__wasm_instance, 65508u), 0u);
+
+#line 167 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8u_good4(&address__0__wasm_instance, 65508u), 0u);
+
+#line 168 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8u_good5(&address__0__wasm_instance, 65508u), 0u);
+
+#line 170 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8s_good1(&address__0__wasm_instance, 65508u), 0u);
+
+#line 171 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8s_good2(&address__0__wasm_instance, 65508u), 0u);
+
+#line 172 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8s_good3(&address__0__wasm_instance, 65508u), 0u);
+
+#line 173 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8s_good4(&address__0__wasm_instance, 65508u), 0u);
+
+#line 174 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_8s_good5(&address__0__wasm_instance, 65508u), 0u);
+
+#line 176 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16u_good1(&address__0__wasm_instance, 65508u), 0u);
+
+#line 177 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16u_good2(&address__0__wasm_instance, 65508u), 0u);
+
+#line 178 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16u_good3(&address__0__wasm_instance, 65508u), 0u);
+
+#line 179 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16u_good4(&address__0__wasm_instance, 65508u), 0u);
+
+#line 180 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16u_good5(&address__0__wasm_instance, 65508u), 0u);
+
+#line 182 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16s_good1(&address__0__wasm_instance, 65508u), 0u);
+
+#line 183 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16s_good2(&address__0__wasm_instance, 65508u), 0u);
+
+#line 184 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16s_good3(&address__0__wasm_instance, 65508u), 0u);
+
+#line 185 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16s_good4(&address__0__wasm_instance, 65508u), 0u);
+
+#line 186 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_16s_good5(&address__0__wasm_instance, 65508u), 0u);
+
+#line 188 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_32_good1(&address__0__wasm_instance, 65508u), 0u);
+
+#line 189 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_32_good2(&address__0__wasm_instance, 65508u), 0u);
+
+#line 190 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_32_good3(&address__0__wasm_instance, 65508u), 0u);
+
+#line 191 "address.wast"
+ASSERT_RETURN_I32(w2c_address__0__wasm_32_good4(&address__0__wasm_instance, 65508u), 0u);
+
+#line 192 "address.wast"
+ASSERT_TRAP(w2c_address__0__wasm_32_good5(&address__0__wasm_instance, 65508u));
+
+#line 194 "address.wast"
+ASSERT_TRAP(w2c_address__0__wasm_8u_good3(&address__0__wasm_instance, 4294967295u));
+
+#line 195 "address.wast"
+ASSERT_TRAP(w2c_address__0__wasm_8s_good3(&address__0__wasm_instance, 4294967295u));
+
+#line 196 "address.wast"
+ASSERT_TRAP(w2c_address__0__wasm_16u_good3(&address__0__wasm_instance, 4294967295u));
+
+#line 197 "address.wast"
+ASSERT_TRAP(w2c_address__0__wasm_16s_good3(&address__0__wasm_instance, 4294967295u));
+
+#line 198 "address.wast"
+ASSERT_TRAP(w2c_address__0__wasm_32_good3(&address__0__wasm_instance, 4294967295u));
+
+#line 199 "address.wast"
+ASSERT_TRAP(w2c_address__0__wasm_32_good3(&address__0__wasm_instance, 4294967295u));
+
+#line 201 "address.wast"
+ASSERT_TRAP(w2c_address__0__wasm_8u_bad(&address__0__wasm_instance, 0u));
+
+#line 202 "address.wast"
+ASSERT_TRAP(w2c_address__0__wasm_8s_bad(&address__0__wasm_instance, 0u));
+
+#line 203 "address.wast"
+ASSERT_TRAP(w2c_address__0__wasm_16u_bad(&address__0__wasm_instance, 0u));
+
+#line 204 "address.wast"
+ASSERT_TRAP(w2c_address__0__wasm_16s_bad(&address__0__wasm_instance, 0u));
+
+#line 205 "address.wast"
+ASSERT_TRAP(w2c_address__0__wasm_32_bad(&address__0__wasm_instance, 0u));
+
+#line 207 "address.wast"
+ASSERT_TRAP(w2c_address__0__wasm_8u_bad(&address__0__wasm_instance, 1u));
+
+#line 208 "address.wast"
+ASSERT_TRAP(w2c_address__0__wasm_8s_bad(&address__0__wasm_instance, 1u));
+
+#line 209 "address.wast"
+ASSERT_TRAP(w2c_address__0__wasm_16u_bad(&address__0__wasm_instance, 1u));
+
+#line 210 "address.wast"
+ASSERT_TRAP(w2c_address__0__wasm_16s_bad(&address__0__wasm_instance, 1u));
+
+#line 211 "address.wast"
+ASSERT_TRAP(w2c_address__0__wasm_32_bad(&address__0__wasm_instance, 1u));
+
+#line 223 "address.wast"
+wasm2c_address__2__wasm_instantiate(&address__2__wasm_instance);
+
+#line 362 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8u_good1(&address__2__wasm_instance, 0u), 97ull);
+
+#line 363 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8u_good2(&address__2__wasm_instance, 0u), 97ull);
+
+#line 364 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8u_good3(&address__2__wasm_instance, 0u), 98ull);
+
+#line 365 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8u_good4(&address__2__wasm_instance, 0u), 99ull);
+
+#line 366 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8u_good5(&address__2__wasm_instance, 0u), 122ull);
+
+#line 368 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8s_good1(&address__2__wasm_instance, 0u), 97ull);
+
+#line 369 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8s_good2(&address__2__wasm_instance, 0u), 97ull);
+
+#line 370 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8s_good3(&address__2__wasm_instance, 0u), 98ull);
+
+#line 371 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8s_good4(&address__2__wasm_instance, 0u), 99ull);
+
+#line 372 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8s_good5(&address__2__wasm_instance, 0u), 122ull);
+
+#line 374 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16u_good1(&address__2__wasm_instance, 0u), 25185ull);
+
+#line 375 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16u_good2(&address__2__wasm_instance, 0u), 25185ull);
+
+#line 376 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16u_good3(&address__2__wasm_instance, 0u), 25442ull);
+
+#line 377 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16u_good4(&address__2__wasm_instance, 0u), 25699ull);
+
+#line 378 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16u_good5(&address__2__wasm_instance, 0u), 122ull);
+
+#line 380 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16s_good1(&address__2__wasm_instance, 0u), 25185ull);
+
+#line 381 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16s_good2(&address__2__wasm_instance, 0u), 25185ull);
+
+#line 382 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16s_good3(&address__2__wasm_instance, 0u), 25442ull);
+
+#line 383 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16s_good4(&address__2__wasm_instance, 0u), 25699ull);
+
+#line 384 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16s_good5(&address__2__wasm_instance, 0u), 122ull);
+
+#line 386 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32u_good1(&address__2__wasm_instance, 0u), 1684234849ull);
+
+#line 387 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32u_good2(&address__2__wasm_instance, 0u), 1684234849ull);
+
+#line 388 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32u_good3(&address__2__wasm_instance, 0u), 1701077858ull);
+
+#line 389 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32u_good4(&address__2__wasm_instance, 0u), 1717920867ull);
+
+#line 390 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32u_good5(&address__2__wasm_instance, 0u), 122ull);
+
+#line 392 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32s_good1(&address__2__wasm_instance, 0u), 1684234849ull);
+
+#line 393 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32s_good2(&address__2__wasm_instance, 0u), 1684234849ull);
+
+#line 394 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32s_good3(&address__2__wasm_instance, 0u), 1701077858ull);
+
+#line 395 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32s_good4(&address__2__wasm_instance, 0u), 1717920867ull);
+
+#line 396 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32s_good5(&address__2__wasm_instance, 0u), 122ull);
+
+#line 398 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_64_good1(&address__2__wasm_instance, 0u), 7523094288207667809ull);
+
+#line 399 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_64_good2(&address__2__wasm_instance, 0u), 7523094288207667809ull);
+
+#line 400 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_64_good3(&address__2__wasm_instance, 0u), 7595434461045744482ull);
+
+#line 401 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_64_good4(&address__2__wasm_instance, 0u), 7667774633883821155ull);
+
+#line 402 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_64_good5(&address__2__wasm_instance, 0u), 122ull);
+
+#line 404 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8u_good1(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 405 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8u_good2(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 406 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8u_good3(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 407 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8u_good4(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 408 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8u_good5(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 410 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8s_good1(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 411 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8s_good2(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 412 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8s_good3(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 413 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8s_good4(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 414 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8s_good5(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 416 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16u_good1(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 417 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16u_good2(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 418 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16u_good3(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 419 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16u_good4(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 420 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16u_good5(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 422 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16s_good1(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 423 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16s_good2(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 424 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16s_good3(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 425 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16s_good4(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 426 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16s_good5(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 428 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32u_good1(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 429 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32u_good2(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 430 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32u_good3(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 431 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32u_good4(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 432 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32u_good5(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 434 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32s_good1(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 435 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32s_good2(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 436 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32s_good3(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 437 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32s_good4(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 438 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32s_good5(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 440 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_64_good1(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 441 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_64_good2(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 442 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_64_good3(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 443 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_64_good4(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 444 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_64_good5(&address__2__wasm_instance, 65503u), 0ull);
+
+#line 446 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8u_good1(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 447 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8u_good2(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 448 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8u_good3(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 449 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8u_good4(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 450 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8u_good5(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 452 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8s_good1(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 453 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8s_good2(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 454 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8s_good3(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 455 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8s_good4(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 456 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_8s_good5(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 458 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16u_good1(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 459 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16u_good2(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 460 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16u_good3(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 461 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16u_good4(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 462 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16u_good5(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 464 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16s_good1(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 465 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16s_good2(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 466 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16s_good3(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 467 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16s_good4(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 468 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_16s_good5(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 470 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32u_good1(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 471 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32u_good2(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 472 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32u_good3(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 473 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32u_good4(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 474 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32u_good5(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 476 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32s_good1(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 477 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32s_good2(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 478 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32s_good3(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 479 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32s_good4(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 480 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_32s_good5(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 482 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_64_good1(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 483 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_64_good2(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 484 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_64_good3(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 485 "address.wast"
+ASSERT_RETURN_I64(w2c_address__2__wasm_64_good4(&address__2__wasm_instance, 65504u), 0ull);
+
+#line 486 "address.wast"
+ASSERT_TRAP(w2c_address__2__wasm_64_good5(&address__2__wasm_instance, 65504u));
+
+#line 488 "address.wast"
+ASSERT_TRAP(w2c_address__2__wasm_8u_good3(&address__2__wasm_instance, 4294967295u));
+
+#line 489 "address.wast"
+ASSERT_TRAP(w2c_address__2__wasm_8s_good3(&address__2__wasm_instance, 4294967295u));
+
+#line 490 "address.wast"
+ASSERT_TRAP(w2c_address__2__wasm_16u_good3(&address__2__wasm_instance, 4294967295u));
+
+#line 491 "address.wast"
+ASSERT_TRAP(w2c_address__2__wasm_16s_good3(&address__2__wasm_instance, 4294967295u));
+
+#line 492 "address.wast"
+ASSERT_TRAP(w2c_address__2__wasm_32u_good3(&address__2__wasm_instance, 4294967295u));
+
+#line 493 "address.wast"
+ASSERT_TRAP(w2c_address__2__wasm_32s_good3(&address__2__wasm_instance, 4294967295u));
+
+#line 494 "address.wast"
+ASSERT_TRAP(w2c_address__2__wasm_64_good3(&address__2__wasm_instance, 4294967295u));
+
+#line 496 "address.wast"
+ASSERT_TRAP(w2c_address__2__wasm_8u_bad(&address__2__wasm_instance, 0u));
+
+#line 497 "address.wast"
+ASSERT_TRAP(w2c_address__2__wasm_8s_bad(&address__2__wasm_instance, 0u));
+
+#line 498 "address.wast"
+ASSERT_TRAP(w2c_address__2__wasm_16u_bad(&address__2__wasm_instance, 0u));
+
+#line 499 "address.wast"
+ASSERT_TRAP(w2c_address__2__wasm_16s_bad(&address__2__wasm_instance, 0u));
+
+#line 500 "address.wast"
+ASSERT_TRAP(w2c_address__2__wasm_32u_bad(&address__2__wasm_instance, 0u));
+
+#line 501 "address.wast"
+ASSERT_TRAP(w2c_address__2__wasm_32s_bad(&address__2__wasm_instance, 0u));
+
+#line 502 "address.wast"
+ASSERT_TRAP(w2c_address__2__wasm_64_bad(&address__2__wasm_instance, 0u));
+
+#line 504 "address.wast"
+ASSERT_TRAP(w2c_address__2__wasm_8u_bad(&address__2__wasm_instance, 1u));
+
+#line 505 "address.wast"
+ASSERT_TRAP(w2c_address__2__wasm_8s_bad(&address__2__wasm_instance, 1u));
+
+#line 506 "address.wast"
+ASSERT_TRAP(w2c_address__2__wasm_16u_bad(&address__2__wasm_instance, 1u));
+
+#line 507 "address.wast"
+ASSERT_TRAP(w2c_address__2__wasm_16s_bad(&address__2__wasm_instance, 1u));
+
+#line 508 "address.wast"
+ASSERT_TRAP(w2c_address__2__wasm_32u_bad(&address__2__wasm_instance, 0u));
+
+#line 509 "address.wast"
+ASSERT_TRAP(w2c_address__2__wasm_32s_bad(&address__2__wasm_instance, 0u));
+
+#line 510 "address.wast"
+ASSERT_TRAP(w2c_address__2__wasm_64_bad(&address__2__wasm_instance, 1u));
+
+#line 514 "address.wast"
+wasm2c_address__3__wasm_instantiate(&address__3__wasm_instance);
+
+#line 538 "address.wast"
+ASSERT_RETURN_F32(w2c_address__3__wasm_32_good1(&address__3__wasm_instance, 0u), 0.f);
+
+#line 539 "address.wast"
+ASSERT_RETURN_F32(w2c_address__3__wasm_32_good2(&address__3__wasm_instance, 0u), 0.f);
+
+#line 540 "address.wast"
+ASSERT_RETURN_F32(w2c_address__3__wasm_32_good3(&address__3__wasm_instance, 0u), 0.f);
+
+#line 541 "address.wast"
+ASSERT_RETURN_F32(w2c_address__3__wasm_32_good4(&address__3__wasm_instance, 0u), 0.f);
+
+#line 542 "address.wast"
+ASSERT_RETURN_F32(w2c_address__3__wasm_32_good5(&address__3__wasm_instance, 0u), make_nan_f32(0x500001));
+
+#line 544 "address.wast"
+ASSERT_RETURN_F32(w2c_address__3__wasm_32_good1(&address__3__wasm_instance, 65524u), 0.f);
+
+#line 545 "address.wast"
+ASSERT_RETURN_F32(w2c_address__3__wasm_32_good2(&address__3__wasm_instance, 65524u), 0.f);
+
+#line 546 "address.wast"
+ASSERT_RETURN_F32(w2c_address__3__wasm_32_good3(&address__3__wasm_instance, 65524u), 0.f);
+
+#line 547 "address.wast"
+ASSERT_RETURN_F32(w2c_address__3__wasm_32_good4(&address__3__wasm_instance, 65524u), 0.f);
+
+#line 548 "address.wast"
+ASSERT_RETURN_F32(w2c_address__3__wasm_32_good5(&address__3__wasm_instance, 65524u), 0.f);
+
+#line 550 "address.wast"
+ASSERT_RETURN_F32(w2c_address__3__wasm_32_good1(&address__3__wasm_instance, 65525u), 0.f);
+
+#line 551 "address.wast"
+ASSERT_RETURN_F32(w2c_address__3__wasm_32_good2(&address__3__wasm_instance, 65525u), 0.f);
+
+#line 552 "address.wast"
+ASSERT_RETURN_F32(w2c_address__3__wasm_32_good3(&address__3__wasm_instance, 65525u), 0.f);
+
+#line 553 "address.wast"
+ASSERT_RETURN_F32(w2c_address__3__wasm_32_good4(&address__3__wasm_instance, 65525u), 0.f);
+
+#line 554 "address.wast"
+ASSERT_TRAP(w2c_address__3__wasm_32_good5(&address__3__wasm_instance, 65525u));
+
+#line 556 "address.wast"
+ASSERT_TRAP(w2c_address__3__wasm_32_good3(&address__3__wasm_instance, 4294967295u));
+
+#line 557 "address.wast"
+ASSERT_TRAP(w2c_address__3__wasm_32_good3(&address__3__wasm_instance, 4294967295u));
+
+#line 559 "address.wast"
+ASSERT_TRAP(w2c_address__3__wasm_32_bad(&address__3__wasm_instance, 0u));
+
+#line 560 "address.wast"
+ASSERT_TRAP(w2c_address__3__wasm_32_bad(&address__3__wasm_instance, 1u));
+
+#line 564 "address.wast"
+wasm2c_address__4__wasm_instantiate(&address__4__wasm_instance);
+
+#line 588 "address.wast"
+ASSERT_RETURN_F64(w2c_address__4__wasm_64_good1(&address__4__wasm_instance, 0u), 0.0000000000000000);
+
+#line 589 "address.wast"
+ASSERT_RETURN_F64(w2c_address__4__wasm_64_good2(&address__4__wasm_instance, 0u), 0.0000000000000000);
+
+#line 590 "address.wast"
+ASSERT_RETURN_F64(w2c_address__4__wasm_64_good3(&address__4__wasm_instance, 0u), 0.0000000000000000);
+
+#line 591 "address.wast"
+ASSERT_RETURN_F64(w2c_address__4__wasm_64_good4(&address__4__wasm_instance, 0u), 0.0000000000000000);
+
+#line 592 "address.wast"
+ASSERT_RETURN_F64(w2c_address__4__wasm_64_good5(&address__4__wasm_instance, 0u), make_nan_f64(0xc000000000001));
+
+#line 594 "address.wast"
+ASSERT_RETURN_F64(w2c_address__4__wasm_64_good1(&address__4__wasm_instance, 65510u), 0.0000000000000000);
+
+#line 595 "address.wast"
+ASSERT_RETURN_F64(w2c_address__4__wasm_64_good2(&address__4__wasm_instance, 65510u), 0.0000000000000000);
+
+#line 596 "address.wast"
+ASSERT_RETURN_F64(w2c_address__4__wasm_64_good3(&address__4__wasm_instance, 65510u), 0.0000000000000000);
+
+#line 597 "address.wast"
+ASSERT_RETURN_F64(w2c_address__4__wasm_64_good4(&address__4__wasm_instance, 65510u), 0.0000000000000000);
+
+#line 598 "address.wast"
+ASSERT_RETURN_F64(w2c_address__4__wasm_64_good5(&address__4__wasm_instance, 65510u), 0.0000000000000000);
+
+#line 600 "address.wast"
+ASSERT_RETURN_F64(w2c_address__4__wasm_64_good1(&address__4__wasm_instance, 65511u), 0.0000000000000000);
+
+#line 601 "address.wast"
+ASSERT_RETURN_F64(w2c_address__4__wasm_64_good2(&address__4__wasm_instance, 65511u), 0.0000000000000000);
+
+#line 602 "address.wast"
+ASSERT_RETURN_F64(w2c_address__4__wasm_64_good3(&address__4__wasm_instance, 65511u), 0.0000000000000000);
+
+#line 603 "address.wast"
+ASSERT_RETURN_F64(w2c_address__4__wasm_64_good4(&address__4__wasm_instance, 65511u), 0.0000000000000000);
+
+#line 604 "address.wast"
+ASSERT_TRAP(w2c_address__4__wasm_64_good5(&address__4__wasm_instance, 65511u));
+
+#line 606 "address.wast"
+ASSERT_TRAP(w2c_address__4__wasm_64_good3(&address__4__wasm_instance, 4294967295u));
+
+#line 607 "address.wast"
+ASSERT_TRAP(w2c_address__4__wasm_64_good3(&address__4__wasm_instance, 4294967295u));
+
+#line 609 "address.wast"
+ASSERT_TRAP(w2c_address__4__wasm_64_bad(&address__4__wasm_instance, 0u));
+
+#line 610 "address.wast"
+ASSERT_TRAP(w2c_address__4__wasm_64_bad(&address__4__wasm_instance, 1u));
+
+
+}
+
+void run_spec_tests(void) {
+
+run_spec_tests_0();
+wasm2c_address__0__wasm_free(&address__0__wasm_instance);
+wasm2c_address__2__wasm_free(&address__2__wasm_instance);
+wasm2c_address__3__wasm_free(&address__3__wasm_instance);
+wasm2c_address__4__wasm_free(&address__4__wasm_instance);
+
+}
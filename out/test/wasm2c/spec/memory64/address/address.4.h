@@ -0,0 +1,57 @@
+/* Automatically generated by wasm2c */
+#ifndef ADDRESS_4_H_GENERATED_
+#define ADDRESS_4_H_GENERATED_
+
+#include "wasm-rt.h"
+
+#include <stdint.h>
+
+#ifndef WASM_RT_CORE_TYPES_DEFINED
+#define WASM_RT_CORE_TYPES_DEFINED
+typedef uint8_t u8;
+typedef int8_t s8;
+typedef uint16_t u16;
+typedef int16_t s16;
+typedef uint32_t u32;
+typedef int32_t s32;
+typedef uint64_t u64;
+typedef int64_t s64;
+typedef float f32;
+typedef double f64;
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct w2c_address__4__wasm {
+  wasm_rt_memory_t w2c_M0;
+} w2c_address__4__wasm;
+
+void wasm2c_address__4__wasm_instantiate(w2c_address__4__wasm*);
+void wasm2c_address__4__wasm_free(w2c_address__4__wasm*);
+wasm_rt_func_type_t wasm2c_address__4__wasm_get_func_type(uint32_t param_count, uint32_t result_count, ...);
+
+/* export: '64_good1' */
+f64 w2c_address__4__wasm_64_good1(w2c_address__4__wasm*, u32);
+
+/* export: '64_good2' */
+f64 w2c_address__4__wasm_64_good2(w2c_address__4__wasm*, u32);
+
+/* export: '64_good3' */
+f64 w2c_address__4__wasm_64_good3(w2c_address__4__wasm*, u32);
+
+/* export: '64_good4' */
+f64 w2c_address__4__wasm_64_good4(w2c_address__4__wasm*, u32);
+
+/* export: '64_good5' */
+f64 w2c_address__4__wasm_64_good5(w2c_address__4__wasm*, u32);
+
+/* export: '64_bad' */
+void w2c_address__4__wasm_64_bad(w2c_address__4__wasm*, u32);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* ADDRESS_4_H_GENERATED_ */
@@ -0,0 +1,1252 @@
+#include "address64.0.h"
+#include "address64.1.h"
+#include "address64.2.h"
+#include "address64.3.h"
+#include <assert.h>
+#define __STDC_FORMAT_MACROS
+#include <inttypes.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "wasm-rt.h"
+#include "wasm-rt-impl.h"
+#include "wasm-rt-exceptions.h"
+
+/* NOTE: function argument evaluation order is implementation-defined in C,
+   so it SHOULD NOT be relied on by tests. */
+#if WABT_BIG_ENDIAN
+#define v128_i8x16_make(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p) \
+	simde_wasm_i8x16_make(p,o,n,m,l,k,j,i,h,g,f,e,d,c,b,a)
+#define v128_u8x16_make(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p) \
+	simde_wasm_u8x16_make(p,o,n,m,l,k,j,i,h,g,f,e,d,c,b,a)
+#define v128_i16x8_make(a,b,c,d,e,f,g,h) simde_wasm_i16x8_make(h,g,f,e,d,c,b,a)
+#define v128_u16x8_make(a,b,c,d,e,f,g,h) simde_wasm_u16x8_make(h,g,f,e,d,c,b,a)
+#define v128_i32x4_make(a,b,c,d) simde_wasm_i32x4_make(d,c,b,a)
+#define v128_u32x4_make(a,b,c,d) simde_wasm_u32x4_make(d,c,b,a)
+#define v128_i64x2_make(a,b) simde_wasm_i64x2_make(b,a)
+#define v128_u64x2_make(a,b) simde_wasm_u64x2_make(b,a)
+#define v128_f32x4_make(a,b,c,d) simde_wasm_f32x4_make(d,c,b,a)
+#define v128_f64x2_make(a,b) simde_wasm_f64x2_make(b,a)
+#define v128_i8x16_extract_lane(a,n) simde_wasm_u8x16_extract_lane(a,15-(n))
+#define v128_u8x16_extract_lane(a,n) simde_wasm_u8x16_extract_lane(a,15-(n))
+#define v128_i16x8_extract_lane(a,n) simde_wasm_u16x8_extract_lane(a,7-(n))
+#define v128_u16x8_extract_lane(a,n) simde_wasm_u16x8_extract_lane(a,7-(n))
+#define v128_i32x4_extract_lane(a,n) simde_wasm_u32x4_extract_lane(a,3-(n))
+#define v128_u32x4_extract_lane(a,n) simde_wasm_u32x4_extract_lane(a,3-(n))
+#define v128_i64x2_extract_lane(a,n) simde_wasm_u64x2_extract_lane(a,1-(n))
+#define v128_u64x2_extract_lane(a,n) simde_wasm_u64x2_extract_lane(a,1-(n))
+#define v128_f32x4_extract_lane(a,n) simde_wasm_f32x4_extract_lane(a,3-(n))
+#define v128_f64x2_extract_lane(a,n) simde_wasm_f64x2_extract_lane(a,1-(n))
+#else
+#define v128_i8x16_make simde_wasm_i8x16_make
+#define v128_u8x16_make simde_wasm_u8x16_make
+#define v128_i16x8_make simde_wasm_i16x8_make
+#define v128_u16x8_make simde_wasm_u16x8_make
+#define v128_i32x4_make simde_wasm_i32x4_make
+#define v128_u32x4_make simde_wasm_u32x4_make
+#define v128_i64x2_make simde_wasm_i64x2_make
+#define v128_u64x2_make simde_wasm_u64x2_make
+#define v128_f32x4_make simde_wasm_f32x4_make
+#define v128_f64x2_make simde_wasm_f64x2_make
+// like is_equal_TYPE below, always use unsigned for these
+#define v128_i8x16_extract_lane simde_wasm_u8x16_extract_lane
+#define v128_u8x16_extract_lane simde_wasm_u8x16_extract_lane
+#define v128_i16x8_extract_lane simde_wasm_u16x8_extract_lane
+#define v128_u16x8_extract_lane simde_wasm_u16x8_extract_lane
+#define v128_i32x4_extract_lane simde_wasm_u32x4_extract_lane
+#define v128_u32x4_extract_lane simde_wasm_u32x4_extract_lane
+#define v128_i64x2_extract_lane simde_wasm_u64x2_extract_lane
+#define v128_u64x2_extract_lane simde_wasm_u64x2_extract_lane
+#define v128_f32x4_extract_lane simde_wasm_f32x4_extract_lane
+#define v128_f64x2_extract_lane simde_wasm_f64x2_extract_lane
+#endif
+
+static int g_tests_run;
+static int g_tests_passed;
+
+static void run_spec_tests(void);
+
+static void error(const char* file, int line, const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  fprintf(stderr, "%s:%d: assertion failed: ", file, line);
+  vfprintf(stderr, format, args);
+  va_end(args);
+}
+
+#define ASSERT_EXCEPTION(f)                                               \
+  do {                                                                    \
+    g_tests_run++;                                                        \
+    if (wasm_rt_impl_try() == WASM_RT_TRAP_UNCAUGHT_EXCEPTION) {          \
+      g_tests_passed++;                                                   \
+    } else {                                                              \
+      (void)(f);                                                          \
+      error(__FILE__, __LINE__, "expected " #f " to throw exception.\n"); \
+    }                                                                     \
+  } while (0)
+
+#define ASSERT_TRAP(f)                                         \
+  do {                                                         \
+    g_tests_run++;                                             \
+    if (wasm_rt_impl_try() != 0) {                             \
+      g_tests_passed++;                                        \
+    } else {                                                   \
+      (void)(f);                                               \
+      error(__FILE__, __LINE__, "expected " #f " to trap.\n"); \
+    }                                                          \
+  } while (0)
+
+#define ASSERT_EXHAUSTION(f)                                     \
+  do {                                                           \
+    g_tests_run++;                                               \
+    wasm_rt_trap_t code = wasm_rt_impl_try();                    \
+    switch (code) {                                              \
+      case WASM_RT_TRAP_NONE:                                    \
+        (void)(f);                                               \
+        error(__FILE__, __LINE__, "expected " #f " to trap.\n"); \
+        break;                                                   \
+      case WASM_RT_TRAP_EXHAUSTION:                              \
+        g_tests_passed++;                                        \
+        break;                                                   \
+      default:                                                   \
+        error(__FILE__, __LINE__,                                \
+              "expected " #f                                     \
+              " to trap due to exhaustion, got trap code %d.\n", \
+              code);                                             \
+        break;                                                   \
+    }                                                            \
+  } while (0)
+
+#define ASSERT_RETURN(f)                               \
+  do {                                                 \
+    g_tests_run++;                                     \
+    int trap_code = wasm_rt_impl_try();                \
+    if (trap_code) {                                   \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n", \
+            wasm_rt_strerror(trap_code));              \
+    } else {                                           \
+      f;                                               \
+      g_tests_passed++;                                \
+    }                                                  \
+  } while (0)
+
+#define ASSERT_RETURN_T(type, fmt, f, expected)                          \
+  do {                                                                   \
+    g_tests_run++;                                                       \
+    int trap_code = wasm_rt_impl_try();                                  \
+    if (trap_code) {                                                     \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                   \
+            wasm_rt_strerror(trap_code));                                \
+    } else {                                                             \
+      type actual = f;                                                   \
+      if (is_equal_##type(actual, expected)) {                           \
+        g_tests_passed++;                                                \
+      } else {                                                           \
+        error(__FILE__, __LINE__,                                        \
+              "in " #f ": expected %" fmt ", got %" fmt ".\n", expected, \
+              actual);                                                   \
+      }                                                                  \
+    }                                                                    \
+  } while (0)
+
+#define ASSERT_RETURN_FUNCREF(f, expected)                                \
+  do {                                                                    \
+    g_tests_run++;                                                        \
+    int trap_code = wasm_rt_impl_try();                                   \
+    if (trap_code) {                                                      \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                    \
+            wasm_rt_strerror(trap_code));                                 \
+    } else {                                                              \
+      wasm_rt_funcref_t actual = f;                                       \
+      if (is_equal_wasm_rt_funcref_t(actual, expected)) {                 \
+        g_tests_passed++;                                                 \
+      } else {                                                            \
+        error(__FILE__, __LINE__,                                         \
+              "in " #f ": mismatch between expected and actual funcref"); \
+      }                                                                   \
+    }                                                                     \
+  } while (0)
+
+#define ASSERT_RETURN_EXNREF(f, expected)                                \
+  do {                                                                   \
+    g_tests_run++;                                                       \
+    int trap_code = wasm_rt_impl_try();                                  \
+    if (trap_code) {                                                     \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                   \
+            wasm_rt_strerror(trap_code));                                \
+    } else {                                                             \
+      wasm_rt_exnref_t actual = f;                                       \
+      if (is_equal_wasm_rt_exnref_t(actual, expected)) {                 \
+        g_tests_passed++;                                                \
+      } else {                                                           \
+        error(__FILE__, __LINE__,                                        \
+              "in " #f ": mismatch between expected and actual exnref"); \
+      }                                                                  \
+    }                                                                    \
+  } while (0)
+
+#define ASSERT_RETURN_NAN_T(type, itype, fmt, f, kind)                        \
+  do {                                                                        \
+    g_tests_run++;                                                            \
+    int trap_code = wasm_rt_impl_try();                                       \
+    if (trap_code) {                                                          \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                        \
+            wasm_rt_strerror(trap_code));                                     \
+    } else {                                                                  \
+      type actual = f;                                                        \
+      itype iactual;                                                          \
+      memcpy(&iactual, &actual, sizeof(iactual));                             \
+      if (is_##kind##_nan_##type(iactual)) {                                  \
+        g_tests_passed++;                                                     \
+      } else {                                                                \
+        error(__FILE__, __LINE__,                                             \
+              "in " #f ": expected result to be a " #kind " nan, got 0x%" fmt \
+              ".\n",                                                          \
+              iactual);                                                       \
+      }                                                                       \
+    }                                                                         \
+  } while (0)
+
+#define MULTI_T_UNPACK_(...) __VA_ARGS__
+#define MULTI_T_UNPACK(arg) MULTI_T_UNPACK_ arg
+#define MULTI_i8 "%" PRIu8 " "
+#define MULTI_i16 "%" PRIu16 " "
+#define MULTI_i32 "%u "
+#define MULTI_i64 "%" PRIu64 " "
+#define MULTI_f32 "%.9g "
+#define MULTI_f64 "%.17g "
+#define MULTI_str "%s "
+#define ASSERT_RETURN_MULTI_T(type, fmt_expected, fmt_got, f, compare,        \
+                              expected, found)                                \
+  do {                                                                        \
+    g_tests_run++;                                                            \
+    int trap_code = wasm_rt_impl_try();                                       \
+    if (trap_code) {                                                          \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                        \
+            wasm_rt_strerror(trap_code));                                     \
+    } else {                                                                  \
+      type actual = f;                                                        \
+      if (compare) {                                                          \
+        g_tests_passed++;                                                     \
+      } else {                                                                \
+        error(__FILE__, __LINE__,                                             \
+              "in " #f ": expected <" fmt_expected ">, got <" fmt_got ">.\n", \
+              MULTI_T_UNPACK(expected), MULTI_T_UNPACK(found));               \
+      }                                                                       \
+    }                                                                         \
+  } while (0)
+
+
+#define ASSERT_RETURN_I32(f, expected) ASSERT_RETURN_T(u32, "u", f, expected)
+#define ASSERT_RETURN_I64(f, expected) ASSERT_RETURN_T(u64, PRIu64, f, expected)
+#define ASSERT_RETURN_F32(f, expected) ASSERT_RETURN_T(f32, ".9g", f, expected)
+#define ASSERT_RETURN_F64(f, expected) ASSERT_RETURN_T(f64, ".17g", f, expected)
+#define ASSERT_RETURN_EXTERNREF(f, expected) \
+  ASSERT_RETURN_T(wasm_rt_externref_t, "p", f, expected);
+
+#define ASSERT_RETURN_CANONICAL_NAN_F32(f) \
+  ASSERT_RETURN_NAN_T(f32, u32, "08x", f, canonical)
+#define ASSERT_RETURN_CANONICAL_NAN_F64(f) \
+  ASSERT_RETURN_NAN_T(f64, u64, "016x", f, canonical)
+#define ASSERT_RETURN_ARITHMETIC_NAN_F32(f) \
+  ASSERT_RETURN_NAN_T(f32, u32, "08x", f, arithmetic)
+#define ASSERT_RETURN_ARITHMETIC_NAN_F64(f) \
+  ASSERT_RETURN_NAN_T(f64, u64, "016x", f, arithmetic)
+
+static bool is_equal_u8(u8 x, u8 y) {
+  return x == y;
+}
+
+static bool is_equal_u16(u16 x, u16 y) {
+  return x == y;
+}
+
+static bool is_equal_u32(u32 x, u32 y) {
+  return x == y;
+}
+
+static bool is_equal_u64(u64 x, u64 y) {
+  return x == y;
+}
+
+#define is_equal_i8 is_equal_u8
+#define is_equal_i16 is_equal_u16
+#define is_equal_i32 is_equal_u32
+#define is_equal_i64 is_equal_u64
+
+static bool is_equal_wasm_rt_externref_t(wasm_rt_externref_t x,
+                                         wasm_rt_externref_t y) {
+  return x == y;
+}
+
+static inline bool is_equal_wasm_rt_func_type_t(const wasm_rt_func_type_t a,
+                                                const wasm_rt_func_type_t b) {
+  return (a == b) || (a && b && !memcmp(a, b, 32));
+}
+
+static bool is_equal_wasm_rt_funcref_t(wasm_rt_funcref_t x,
+                                       wasm_rt_funcref_t y) {
+  return is_equal_wasm_rt_func_type_t(x.func_type, y.func_type) &&
+         (x.func == y.func) && (x.module_instance == y.module_instance);
+}
+
+#ifdef WASM_EXN_MAX_SIZE
+static bool is_equal_wasm_rt_exnref_t(wasm_rt_exnref_t x, wasm_rt_exnref_t y) {
+  return x.tag == y.tag && x.size == y.size && !memcmp(x.data, y.data, x.size);
+}
+#endif
+
+wasm_rt_externref_t spectest_make_externref(uintptr_t x) {
+  return (wasm_rt_externref_t)(x + 1);  // externref(0) is not null
+}
+
+static u32 f32_bits(f32 x) {
+  u32 ux;
+  memcpy(&ux, &x, sizeof(ux));
+  return ux;
+}
+
+static u64 f64_bits(f64 x) {
+  u64 ux;
+  memcpy(&ux, &x, sizeof(ux));
+  return ux;
+}
+
+static bool is_equal_f32(f32 x, f32 y) {
+  return f32_bits(x) == f32_bits(y);
+}
+
+static bool is_equal_f64(f64 x, f64 y) {
+  return f64_bits(x) == f64_bits(y);
+}
+
+static f32 make_nan_f32(u32 x) {
+  x |= 0x7f800000;
+  f32 res;
+  memcpy(&res, &x, sizeof(res));
+  return res;
+}
+
+static f64 make_nan_f64(u64 x) {
+  x |= 0x7ff0000000000000;
+  f64 res;
+  memcpy(&res, &x, sizeof(res));
+  return res;
+}
+
+static bool is_canonical_nan_f32(u32 x) {
+  return (x & 0x7fffffff) == 0x7fc00000;
+}
+
+static bool is_canonical_nan_f64(u64 x) {
+  return (x & 0x7fffffffffffffff) == 0x7ff8000000000000;
+}
+
+static bool is_arithmetic_nan_f32(u32 x) {
+  return (x & 0x7fc00000) == 0x7fc00000;
+}
+
+static bool is_arithmetic_nan_f64(u64 x) {
+  return (x & 0x7ff8000000000000) == 0x7ff8000000000000;
+}
+
+typedef struct w2c_spectest {
+  wasm_rt_funcref_table_t spectest_table;
+  wasm_rt_funcref_table_t spectest_table64;
+  wasm_rt_memory_t spectest_memory;
+  uint32_t spectest_global_i32;
+  uint64_t spectest_global_i64;
+  float spectest_global_f32;
+  double spectest_global_f64;
+} w2c_spectest;
+
+static w2c_spectest spectest_instance;
+
+/*
+ * spectest implementations
+ */
+void w2c_spectest_print(w2c_spectest* instance) {
+  printf("spectest.print()\n");
+}
+
+void w2c_spectest_print_i32(w2c_spectest* instance, uint32_t i) {
+  printf("spectest.print_i32(%d)\n", i);
+}
+
+void w2c_spectest_print_i64(w2c_spectest* instance, uint64_t i) {
+  printf("spectest.print_i64(%" PRIu64 ")\n", i);
+}
+
+void w2c_spectest_print_f32(w2c_spectest* instance, float f) {
+  printf("spectest.print_f32(%g)\n", f);
+}
+
+void w2c_spectest_print_i32_f32(w2c_spectest* instance, uint32_t i, float f) {
+  printf("spectest.print_i32_f32(%d %g)\n", i, f);
+}
+
+void w2c_spectest_print_f64(w2c_spectest* instance, double d) {
+  printf("spectest.print_f64(%g)\n", d);
+}
+
+void w2c_spectest_print_f64_f64(w2c_spectest* instance, double d1, double d2) {
+  printf("spectest.print_f64_f64(%g %g)\n", d1, d2);
+}
+
+wasm_rt_funcref_table_t* w2c_spectest_table(w2c_spectest* instance) {
+  return &instance->spectest_table;
+}
+
+wasm_rt_funcref_table_t* w2c_spectest_table64(w2c_spectest* instance) {
+  return &instance->spectest_table64;
+}
+
+wasm_rt_memory_t* w2c_spectest_memory(w2c_spectest* instance) {
+  return &instance->spectest_memory;
+}
+
+uint32_t* w2c_spectest_global_i32(w2c_spectest* instance) {
+  return &instance->spectest_global_i32;
+}
+
+uint64_t* w2c_spectest_global_i64(w2c_spectest* instance) {
+  return &instance->spectest_global_i64;
+}
+
+float* w2c_spectest_global_f32(w2c_spectest* instance) {
+  return &instance->spectest_global_f32;
+}
+
+double* w2c_spectest_global_f64(w2c_spectest* instance) {
+  return &instance->spectest_global_f64;
+}
+
+static void init_spectest_module(w2c_spectest* instance) {
+  instance->spectest_global_i32 = 666;
+  instance->spectest_global_i64 = 666l;
+  instance->spectest_global_f32 = 666.6;
+  instance->spectest_global_f64 = 666.6;
+  wasm_rt_allocate_memory(&instance->spectest_memory, 1, 2, false,
+                          WASM_DEFAULT_PAGE_SIZE);
+  wasm_rt_allocate_funcref_table(&instance->spectest_table, 10, 20);
+  wasm_rt_allocate_funcref_table(&instance->spectest_table64, 10, 20);
+}
+
+// POSIX-only test config where embedder handles signals instead of w2c runtime
+#ifdef WASM2C_TEST_EMBEDDER_SIGNAL_HANDLING
+#include <signal.h>
+
+static void posix_signal_handler(int sig, siginfo_t* si, void* unused) {
+  wasm_rt_trap((si->si_code == SEGV_ACCERR) ? WASM_RT_TRAP_OOB
+                                            : WASM_RT_TRAP_EXHAUSTION);
+}
+
+static void posix_install_signal_handler(void) {
+  /* install altstack */
+  stack_t ss;
+  ss.ss_sp = malloc(SIGSTKSZ);
+  ss.ss_flags = 0;
+  ss.ss_size = SIGSTKSZ;
+  if (sigaltstack(&ss, NULL) != 0) {
+    perror("sigaltstack failed");
+    abort();
+  }
+
+  /* install signal handler */
+  struct sigaction sa;
+  memset(&sa, '\0', sizeof(sa));
+  sa.sa_flags = SA_SIGINFO | SA_ONSTACK;
+  sigemptyset(&sa.sa_mask);
+  sa.sa_sigaction = posix_signal_handler;
+  if (sigaction(SIGSEGV, &sa, NULL) != 0 || sigaction(SIGBUS, &sa, NULL) != 0) {
+    perror("sigaction failed");
+    abort();
+  }
+}
+
+static void posix_cleanup_signal_handler(void) {
+  /* remove signal handler */
+  struct sigaction sa;
+  memset(&sa, '\0', sizeof(sa));
+  sa.sa_handler = SIG_DFL;
+  if (sigaction(SIGSEGV, &sa, NULL) != 0 || sigaction(SIGBUS, &sa, NULL)) {
+    perror("sigaction failed");
+    abort();
+  }
+
+  /* disable and free altstack */
+  stack_t ss;
+  ss.ss_flags = SS_DISABLE;
+  if (sigaltstack(&ss, NULL) != 0) {
+    perror("sigaltstack failed");
+    abort();
+  }
+  free(ss.ss_sp);
+}
+#endif
+
+int main(int argc, char** argv) {
+#ifdef WASM2C_TEST_EMBEDDER_SIGNAL_HANDLING
+  posix_install_signal_handler();
+#endif
+  wasm_rt_init();
+  init_spectest_module(&spectest_instance);
+  run_spec_tests();
+  printf("%u/%u tests passed.\n", g_tests_passed, g_tests_run);
+  wasm_rt_free();
+#ifdef WASM2C_TEST_EMBEDDER_SIGNAL_HANDLING
+  posix_cleanup_signal_handler();
+#endif
+  return g_tests_passed != g_tests_run;
+}
+
+w2c_address64__0__wasm address64__0__wasm_instance;
+w2c_address64__1__wasm address64__1__wasm_instance;
+w2c_address64__2__wasm address64__2__wasm_instance;
+w2c_address64__3__wasm address64__3__wasm_instance;
+
+void run_spec_tests_0(void) {
+
+#line 3 "address64.wast"
+wasm2c_address64__0__wasm_instantiate(&address64__0__wasm_instance);
+
+#line 104 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8u_good1(&address64__0__wasm_instance, 0ull), 97u);
+
+#line 105 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8u_good2(&address64__0__wasm_instance, 0ull), 97u);
+
+#line 106 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8u_good3(&address64__0__wasm_instance, 0ull), 98u);
+
+#line 107 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8u_good4(&address64__0__wasm_instance, 0ull), 99u);
+
+#line 108 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8u_good5(&address64__0__wasm_instance, 0ull), 122u);
+
+#line 110 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8s_good1(&address64__0__wasm_instance, 0ull), 97u);
+
+#line 111 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8s_good2(&address64__0__wasm_instance, 0ull), 97u);
+
+#line 112 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8s_good3(&address64__0__wasm_instance, 0ull), 98u);
+
+#line 113 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8s_good4(&address64__0__wasm_instance, 0ull), 99u);
+
+#line 114 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8s_good5(&address64__0__wasm_instance, 0ull), 122u);
+
+#line 116 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16u_good1(&address64__0__wasm_instance, 0ull), 25185u);
+
+#line 117 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16u_good2(&address64__0__wasm_instance, 0ull), 25185u);
+
+#line 118 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16u_good3(&address64__0__wasm_instance, 0ull), 25442u);
+
+#line 119 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16u_good4(&address64__0__wasm_instance, 0ull), 25699u);
+
+#line 120 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16u_good5(&address64__0__wasm_instance, 0ull), 122u);
+
+#line 122 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16s_good1(&address64__0__wasm_instance, 0ull), 25185u);
+
+#line 123 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16s_good2(&address64__0__wasm_instance, 0ull), 25185u);
+
+#line 124 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16s_good3(&address64__0__wasm_instance, 0ull), 25442u);
+
+#line 125 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16s_good4(&address64__0__wasm_instance, 0ull), 25699u);
+
+#line 126 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16s_good5(&address64__0__wasm_instance, 0ull), 122u);
+
+#line 128 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_32_good1(&address64__0__wasm_instance, 0ull), 1684234849u);
+
+#line 129 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_32_good2(&address64__0__wasm_instance, 0ull), 1684234849u);
+
+#line 130 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_32_good3(&address64__0__wasm_instance, 0ull), 1701077858u);
+
+#line 131 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_32_good4(&address64__0__wasm_instance, 0ull), 1717920867u);
+
+#line 132 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_32_good5(&address64__0__wasm_instance, 0ull), 122u);
+
+#line 134 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8u_good1(&address64__0__wasm_instance, 65507ull), 0u);
+
+#line 135 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8u_good2(&address64__0__wasm_instance, 65507ull), 0u);
+
+#line 136 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8u_good3(&address64__0__wasm_instance, 65507ull), 0u);
+
+#line 137 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8u_good4(&address64__0__wasm_instance, 65507ull), 0u);
+
+#line 138 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8u_good5(&address64__0__wasm_instance, 65507ull), 0u);
+
+#line 140 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8s_good1(&address64__0__wasm_instance, 65507ull), 0u);
+
+#line 141 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8s_good2(&address64__0__wasm_instance, 65507ull), 0u);
+
+#line 142 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8s_good3(&address64__0__wasm_instance, 65507ull), 0u);
+
+#line 143 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8s_good4(&address64__0__wasm_instance, 65507ull), 0u);
+
+#line 144 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8s_good5(&address64__0__wasm_instance, 65507ull), 0u);
+
+#line 146 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16u_good1(&address64__0__wasm_instance, 65507ull), 0u);
+
+#line 147 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16u_good2(&address64__0__wasm_instance, 65507ull), 0u);
+
+#line 148 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16u_good3(&address64__0__wasm_instance, 65507ull), 0u);
+
+#line 149 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16u_good4(&address64__0__wasm_instance, 65507ull), 0u);
+
+#line 150 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16u_good5(&address64__0__wasm_instance, 65507ull), 0u);
+
+#line 152 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16s_good1(&address64__0__wasm_instance, 65507ull), 0u);
+
+#line 153 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16s_good2(&address64__0__wasm_instance, 65507ull), 0u);
+
+#line 154 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16s_good3(&address64__0__wasm_instance, 65507ull), 0u);
+
+#line 155 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16s_good4(&address64__0__wasm_instance, 65507ull), 0u);
+
+#line 156 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16s_good5(&address64__0__wasm_instance, 65507ull), 0u);
+
+#line 158 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_32_good1(&address64__0__wasm_instance, 65507ull), 0u);
+
+#line 159 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_32_good2(&address64__0__wasm_instance, 65507ull), 0u);
+
+#line 160 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_32_good3(&address64__0__wasm_instance, 65507ull), 0u);
+
+#line 161 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_32_good4(&address64__0__wasm_instance, 65507ull), 0u);
+
+#line 162 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_32_good5(&address64__0__wasm_instance, 65507ull), 0u);
+
+#line 164 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8u_good1(&address64__0__wasm_instance, 65508ull), 0u);
+
+#line 165 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8u_good2(&address64__0__wasm_instance, 65508ull), 0u);
+
+#line 166 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8u_good3(&address64__0__wasm_instance, 65508ull), 0u);
+
+#line 167 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8u_good4(&address64__0__wasm_instance, 65508ull), 0u);
+
+#line 168 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8u_good5(&address64__0__wasm_instance, 65508ull), 0u);
+
+#line 170 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8s_good1(&address64__0__wasm_instance, 65508ull), 0u);
+
+#line 171 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8s_good2(&address64__0__wasm_instance, 65508ull), 0u);
+
+#line 172 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8s_good3(&address64__0__wasm_instance, 65508ull), 0u);
+
+#line 173 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8s_good4(&address64__0__wasm_instance, 65508ull), 0u);
+
+#line 174 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_8s_good5(&address64__0__wasm_instance, 65508ull), 0u);
+
+#line 176 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16u_good1(&address64__0__wasm_instance, 65508ull), 0u);
+
+#line 177 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16u_good2(&address64__0__wasm_instance, 65508ull), 0u);
+
+#line 178 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16u_good3(&address64__0__wasm_instance, 65508ull), 0u);
+
+#line 179 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16u_good4(&address64__0__wasm_instance, 65508ull), 0u);
+
+#line 180 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16u_good5(&address64__0__wasm_instance, 65508ull), 0u);
+
+#line 182 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16s_good1(&address64__0__wasm_instance, 65508ull), 0u);
+
+#line 183 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16s_good2(&address64__0__wasm_instance, 65508ull), 0u);
+
+#line 184 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16s_good3(&address64__0__wasm_instance, 65508ull), 0u);
+
+#line 185 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16s_good4(&address64__0__wasm_instance, 65508ull), 0u);
+
+#line 186 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_16s_good5(&address64__0__wasm_instance, 65508ull), 0u);
+
+#line 188 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_32_good1(&address64__0__wasm_instance, 65508ull), 0u);
+
+#line 189 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_32_good2(&address64__0__wasm_instance, 65508ull), 0u);
+
+#line 190 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_32_good3(&address64__0__wasm_instance, 65508ull), 0u);
+
+#line 191 "address64.wast"
+ASSERT_RETURN_I32(w2c_address64__0__wasm_32_good4(&address64__0__wasm_instance, 65508ull), 0u);
+
+#line 192 "address64.wast"
+ASSERT_TRAP(w2c_address64__0__wasm_32_good5(&address64__0__wasm_instance, 65508ull));
+
+#line 194 "address64.wast"
+ASSERT_TRAP(w2c_address64__0__wasm_8u_bad(&address64__0__wasm_instance, 0ull));
+
+#line 195 "address64.wast"
+ASSERT_TRAP(w2c_address64__0__wasm_8s_bad(&address64__0__wasm_instance, 0ull));
+
+#line 196 "address64.wast"
+ASSERT_TRAP(w2c_address64__0__wasm_16u_bad(&address64__0__wasm_instance, 0ull));
+
+#line 197 "address64.wast"
+ASSERT_TRAP(w2c_address64__0__wasm_16s_bad(&address64__0__wasm_instance, 0ull));
+
+#line 198 "address64.wast"
+ASSERT_TRAP(w2c_address64__0__wasm_32_bad(&address64__0__wasm_instance, 0ull));
+
+#line 200 "address64.wast"
+ASSERT_TRAP(w2c_address64__0__wasm_8u_bad(&address64__0__wasm_instance, 1ull));
+
+#line 201 "address64.wast"
+ASSERT_TRAP(w2c_address64__0__wasm_8s_bad(&address64__0__wasm_instance, 1ull));
+
+#line 202 "address64.wast"
+ASSERT_TRAP(w2c_address64__0__wasm_16u_bad(&address64__0__wasm_instance, 1ull));
+
+#line 203 "address64.wast"
+ASSERT_TRAP(w2c_address64__0__wasm_16s_bad(&address64__0__wasm_instance, 1ull));
+
+#line 204 "address64.wast"
+ASSERT_TRAP(w2c_address64__0__wasm_32_bad(&address64__0__wasm_instance, 1ull));
+
+#line 209 "address64.wast"
+wasm2c_address64__1__wasm_instantiate(&address64__1__wasm_instance);
+
+#line 348 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8u_good1(&address64__1__wasm_instance, 0ull), 97ull);
+
+#line 349 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8u_good2(&address64__1__wasm_instance, 0ull), 97ull);
+
+#line 350 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8u_good3(&address64__1__wasm_instance, 0ull), 98ull);
+
+#line 351 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8u_good4(&address64__1__wasm_instance, 0ull), 99ull);
+
+#line 352 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8u_good5(&address64__1__wasm_instance, 0ull), 122ull);
+
+#line 354 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8s_good1(&address64__1__wasm_instance, 0ull), 97ull);
+
+#line 355 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8s_good2(&address64__1__wasm_instance, 0ull), 97ull);
+
+#line 356 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8s_good3(&address64__1__wasm_instance, 0ull), 98ull);
+
+#line 357 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8s_good4(&address64__1__wasm_instance, 0ull), 99ull);
+
+#line 358 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8s_good5(&address64__1__wasm_instance, 0ull), 122ull);
+
+#line 360 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16u_good1(&address64__1__wasm_instance, 0ull), 25185ull);
+
+#line 361 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16u_good2(&address64__1__wasm_instance, 0ull), 25185ull);
+
+#line 362 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16u_good3(&address64__1__wasm_instance, 0ull), 25442ull);
+
+#line 363 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16u_good4(&address64__1__wasm_instance, 0ull), 25699ull);
+
+#line 364 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16u_good5(&address64__1__wasm_instance, 0ull), 122ull);
+
+#line 366 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16s_good1(&address64__1__wasm_instance, 0ull), 25185ull);
+
+#line 367 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16s_good2(&address64__1__wasm_instance, 0ull), 25185ull);
+
+#line 368 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16s_good3(&address64__1__wasm_instance, 0ull), 25442ull);
+
+#line 369 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16s_good4(&address64__1__wasm_instance, 0ull), 25699ull);
+
+#line 370 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16s_good5(&address64__1__wasm_instance, 0ull), 122ull);
+
+#line 372 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32u_good1(&address64__1__wasm_instance, 0ull), 1684234849ull);
+
+#line 373 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32u_good2(&address64__1__wasm_instance, 0ull), 1684234849ull);
+
+#line 374 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32u_good3(&address64__1__wasm_instance, 0ull), 1701077858ull);
+
+#line 375 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32u_good4(&address64__1__wasm_instance, 0ull), 1717920867ull);
+
+#line 376 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32u_good5(&address64__1__wasm_instance, 0ull), 122ull);
+
+#line 378 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32s_good1(&address64__1__wasm_instance, 0ull), 1684234849ull);
+
+#line 379 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32s_good2(&address64__1__wasm_instance, 0ull), 1684234849ull);
+
+#line 380 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32s_good3(&address64__1__wasm_instance, 0ull), 1701077858ull);
+
+#line 381 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32s_good4(&address64__1__wasm_instance, 0ull), 1717920867ull);
+
+#line 382 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32s_good5(&address64__1__wasm_instance, 0ull), 122ull);
+
+#line 384 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_64_good1(&address64__1__wasm_instance, 0ull), 7523094288207667809ull);
+
+#line 385 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_64_good2(&address64__1__wasm_instance, 0ull), 7523094288207667809ull);
+
+#line 386 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_64_good3(&address64__1__wasm_instance, 0ull), 7595434461045744482ull);
+
+#line 387 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_64_good4(&address64__1__wasm_instance, 0ull), 7667774633883821155ull);
+
+#line 388 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_64_good5(&address64__1__wasm_instance, 0ull), 122ull);
+
+#line 390 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8u_good1(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 391 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8u_good2(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 392 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8u_good3(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 393 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8u_good4(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 394 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8u_good5(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 396 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8s_good1(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 397 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8s_good2(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 398 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8s_good3(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 399 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8s_good4(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 400 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8s_good5(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 402 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16u_good1(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 403 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16u_good2(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 404 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16u_good3(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 405 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16u_good4(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 406 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16u_good5(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 408 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16s_good1(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 409 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16s_good2(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 410 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16s_good3(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 411 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16s_good4(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 412 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16s_good5(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 414 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32u_good1(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 415 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32u_good2(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 416 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32u_good3(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 417 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32u_good4(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 418 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32u_good5(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 420 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32s_good1(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 421 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32s_good2(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 422 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32s_good3(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 423 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32s_good4(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 424 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32s_good5(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 426 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_64_good1(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 427 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_64_good2(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 428 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_64_good3(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 429 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_64_good4(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 430 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_64_good5(&address64__1__wasm_instance, 65503ull), 0ull);
+
+#line 432 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8u_good1(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 433 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8u_good2(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 434 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8u_good3(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 435 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8u_good4(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 436 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8u_good5(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 438 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8s_good1(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 439 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8s_good2(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 440 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8s_good3(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 441 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8s_good4(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 442 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_8s_good5(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 444 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16u_good1(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 445 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16u_good2(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 446 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16u_good3(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 447 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16u_good4(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 448 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16u_good5(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 450 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16s_good1(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 451 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16s_good2(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 452 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16s_good3(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 453 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16s_good4(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 454 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_16s_good5(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 456 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32u_good1(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 457 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32u_good2(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 458 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32u_good3(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 459 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32u_good4(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 460 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32u_good5(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 462 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32s_good1(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 463 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32s_good2(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 464 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32s_good3(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 465 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32s_good4(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 466 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_32s_good5(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 468 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_64_good1(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 469 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_64_good2(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 470 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_64_good3(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 471 "address64.wast"
+ASSERT_RETURN_I64(w2c_address64__1__wasm_64_good4(&address64__1__wasm_instance, 65504ull), 0ull);
+
+#line 472 "address64.wast"
+ASSERT_TRAP(w2c_address64__1__wasm_64_good5(&address64__1__wasm_instance, 65504ull));
+
+#line 474 "address64.wast"
+ASSERT_TRAP(w2c_address64__1__wasm_8u_bad(&address64__1__wasm_instance, 0ull));
+
+#line 475 "address64.wast"
+ASSERT_TRAP(w2c_address64__1__wasm_8s_bad(&address64__1__wasm_instance, 0ull));
+
+#line 476 "address64.wast"
+ASSERT_TRAP(w2c_address64__1__wasm_16u_bad(&address64__1__wasm_instance, 0ull));
+
+#line 477 "address64.wast"
+ASSERT_TRAP(w2c_address64__1__wasm_16s_bad(&address64__1__wasm_instance, 0ull));
+
+#line 478 "address64.wast"
+ASSERT_TRAP(w2c_address64__1__wasm_32u_bad(&address64__1__wasm_instance, 0ull));
+
+#line 479 "address64.wast"
+ASSERT_TRAP(w2c_address64__1__wasm_32s_bad(&address64__1__wasm_instance, 0ull));
+
+#line 480 "address64.wast"
+ASSERT_TRAP(w2c_address64__1__wasm_64_bad(&address64__1__wasm_instance, 0ull));
+
+#line 482 "address64.wast"
+ASSERT_TRAP(w2c_address64__1__wasm_8u_bad(&address64__1__wasm_instance, 1ull));
+
+#line 483 "address64.wast"
+ASSERT_TRAP(w2c_address64__1__wasm_8s_bad(&address64__1__wasm_instance, 1ull));
+
+#line 484 "address64.wast"
+ASSERT_TRAP(w2c_address64__1__wasm_16u_bad(&address64__1__wasm_instance, 1ull));
+
+#line 485 "address64.wast"
+ASSERT_TRAP(w2c_address64__1__wasm_16s_bad(&address64__1__wasm_instance, 1ull));
+
+#line 486 "address64.wast"
+ASSERT_TRAP(w2c_address64__1__wasm_32u_bad(&address64__1__wasm_instance, 0ull));
+
+#line 487 "address64.wast"
+ASSERT_TRAP(w2c_address64__1__wasm_32s_bad(&address64__1__wasm_instance, 0ull));
+
+#line 488 "address64.wast"
+ASSERT_TRAP(w2c_address64__1__wasm_64_bad(&address64__1__wasm_instance, 1ull));
+
+#line 492 "address64.wast"
+wasm2c_address64__2__wasm_instantiate(&address64__2__wasm_instance);
+
+#line 516 "address64.wast"
+ASSERT_RETURN_F32(w2c_address64__2__wasm_32_good1(&address64__2__wasm_instance, 0ull), 0.f);
+
+#line 517 "address64.wast"
+ASSERT_RETURN_F32(w2c_address64__2__wasm_32_good2(&address64__2__wasm_instance, 0ull), 0.f);
+
+#line 518 "address64.wast"
+ASSERT_RETURN_F32(w2c_address64__2__wasm_32_good3(&address64__2__wasm_instance, 0ull), 0.f);
+
+#line 519 "address64.wast"
+ASSERT_RETURN_F32(w2c_address64__2__wasm_32_good4(&address64__2__wasm_instance, 0ull), 0.f);
+
+#line 520 "address64.wast"
+ASSERT_RETURN_F32(w2c_address64__2__wasm_32_good5(&address64__2__wasm_instance, 0ull), make_nan_f32(0x500001));
+
+#line 522 "address64.wast"
+ASSERT_RETURN_F32(w2c_address64__2__wasm_32_good1(&address64__2__wasm_instance, 65524ull), 0.f);
+
+#line 523 "address64.wast"
+ASSERT_RETURN_F32(w2c_address64__2__wasm_32_good2(&address64__2__wasm_instance, 65524ull), 0.f);
+
+#line 524 "address64.wast"
+ASSERT_RETURN_F32(w2c_address64__2__wasm_32_good3(&address64__2__wasm_instance, 65524ull), 0.f);
+
+#line 525 "address64.wast"
+ASSERT_RETURN_F32(w2c_address64__2__wasm_32_good4(&address64__2__wasm_instance, 65524ull), 0.f);
+
+#line 526 "address64.wast"
+ASSERT_RETURN_F32(w2c_address64__2__wasm_32_good5(&address64__2__wasm_instance, 65524ull), 0.f);
+
+#line 528 "address64.wast"
+ASSERT_RETURN_F32(w2c_address64__2__wasm_32_good1(&address64__2__wasm_instance, 65525ull), 0.f);
+
+#line 529 "address64.wast"
+ASSERT_RETURN_F32(w2c_address64__2__wasm_32_good2(&address64__2__wasm_instance, 65525ull), 0.f);
+
+#line 530 "address64.wast"
+ASSERT_RETURN_F32(w2c_address64__2__wasm_32_good3(&address64__2__wasm_instance, 65525ull), 0.f);
+
+#line 531 "address64.wast"
+ASSERT_RETURN_F32(w2c_address64__2__wasm_32_good4(&address64__2__wasm_instance, 65525ull), 0.f);
+
+#line 532 "address64.wast"
+ASSERT_TRAP(w2c_address64__2__wasm_32_good5(&address64__2__wasm_instance, 65525ull));
+
+#line 534 "address64.wast"
+ASSERT_TRAP(w2c_address64__2__wasm_32_bad(&address64__2__wasm_instance, 0ull));
+
+#line 535 "address64.wast"
+ASSERT_TRAP(w2c_address64__2__wasm_32_bad(&address64__2__wasm_instance, 1ull));
+
+#line 539 "address64.wast"
+wasm2c_address64__3__wasm_instantiate(&address64__3__wasm_instance);
+
+#line 563 "address64.wast"
+ASSERT_RETURN_F64(w2c_address64__3__wasm_64_good1(&address64__3__wasm_instance, 0ull), 0.0000000000000000);
+
+#line 564 "address64.wast"
+ASSERT_RETURN_F64(w2c_address64__3__wasm_64_good2(&address64__3__wasm_instance, 0ull), 0.0000000000000000);
+
+#line 565 "address64.wast"
+ASSERT_RETURN_F64(w2c_address64__3__wasm_64_good3(&address64__3__wasm_instance, 0ull), 0.0000000000000000);
+
+#line 566 "address64.wast"
+ASSERT_RETURN_F64(w2c_address64__3__wasm_64_good4(&address64__3__wasm_instance, 0ull), 0.0000000000000000);
+
+#line 567 "address64.wast"
+ASSERT_RETURN_F64(w2c_address64__3__wasm_64_good5(&address64__3__wasm_instance, 0ull), make_nan_f64(0xc000000000001));
+
+#line 569 "address64.wast"
+ASSERT_RETURN_F64(w2c_address64__3__wasm_64_good1(&address64__3__wasm_instance, 65510ull), 0.0000000000000000);
+
+#line 570 "address64.wast"
+ASSERT_RETURN_F64(w2c_address64__3__wasm_64_good2(&address64__3__wasm_instance, 65510ull), 0.0000000000000000);
+
+#line 571 "address64.wast"
+ASSERT_RETURN_F64(w2c_address64__3__wasm_64_good3(&address64__3__wasm_instance, 65510ull), 0.0000000000000000);
+
+#line 572 "address64.wast"
+ASSERT_RETURN_F64(w2c_address64__3__wasm_64_good4(&address64__3__wasm_instance, 65510ull), 0.0000000000000000);
+
+#line 573 "address64.wast"
+ASSERT_RETURN_F64(w2c_address64__3__wasm_64_good5(&address64__3__wasm_instance, 65510ull), 0.0000000000000000);
+
+#line 575 "address64.wast"
+ASSERT_RETURN_F64(w2c_address64__3__wasm_64_good1(&address64__3__wasm_instance, 65511ull), 0.0000000000000000);
+
+#line 576 "address64.wast"
+ASSERT_RETURN_F64(w2c_address64__3__wasm_64_good2(&address64__3__wasm_instance, 65511ull), 0.0000000000000000);
+
+#line 577 "address64.wast"
+ASSERT_RETURN_F64(w2c_address64__3__wasm_64_good3(&address64__3__wasm_instance, 65511ull), 0.0000000000000000);
+
+#line 578 "address64.wast"
+ASSERT_RETURN_F64(w2c_address64__3__wasm_64_good4(&address64__3__wasm_instance, 65511ull), 0.0000000000000000);
+
+#line 579 "address64.wast"
+ASSERT_TRAP(w2c_address64__3__wasm_64_good5(&address64__3__wasm_instance, 65511ull));
+
+#line 581 "address64.wast"
+ASSERT_TRAP(w2c_address64__3__wasm_64_bad(&address64__3__wasm_instance, 0ull));
+
+#line 582 "address64.wast"
+ASSERT_TRAP(w2c_address64__3__wasm_64_bad(&address64__3__wasm_instance, 1ull));
+
+
+}
+
+void run_spec_tests(void) {
+
+run_spec_tests_0();
+wasm2c_address64__0__wasm_free(&address64__0__wasm_instance);
+wasm2c_address64__1__wasm_free(&address64__1__wasm_instance);
+wasm2c_address64__2__wasm_free(&address64__2__wasm_instance);
+wasm2c_address64__3__wasm_free(&address64__3__wasm_instance);
+
+}
@@ -0,0 +1,1517 @@
+/* Automatically generated by wasm2c */
+#include <assert.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <string.h>
+#if defined(__MINGW32__)
+#include <malloc.h>
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#include <malloc.h>
+#define alloca _alloca
+#elif defined(__FreeBSD__) || defined(__OpenBSD__)
+#include <stdlib.h>
+#else
+#include <alloca.h>
+#endif
+
+#include "address64.0.h"
+
+// Computes a pointer to an object of the given size in a little-endian memory.
+//
+// On a little-endian host, this is just &mem->data[addr] - the object's size is
+// unused. On a big-endian host, it's &mem->data[mem->size - addr - n], where n
+// is the object's size.
+//
+// Note that mem may be evaluated multiple times.
+//
+// Parameters:
+// mem - The memory.
+// addr - The address.
+// n - The size of the object.
+//
+// Result:
+// A pointer for an object of size n.
+#if WABT_BIG_ENDIAN
+#define MEM_ADDR(mem, addr, n) ((mem)->data_end - (addr) - (n))
+#else
+#define MEM_ADDR(mem, addr, n) &((mem)->data[addr])
+#endif
+
+// We can only use Segue for this module if it uses a single unshared,
+// default-page, 32-bit imported or exported memory.
+#if WASM_RT_USE_SEGUE && IS_SINGLE_UNSHARED_DEFAULT32_MEMORY
+#define WASM_RT_USE_SEGUE_FOR_THIS_MODULE 1
+#else
+#define WASM_RT_USE_SEGUE_FOR_THIS_MODULE 0
+#endif
+
+#ifndef WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE
+#define WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE 1
+#endif
+
+#if WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE && WASM_RT_USE_MMAP && \
+    IS_SINGLE_UNSHARED_DEFAULT32_MEMORY && !WABT_BIG_ENDIAN
+#define WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE_FOR_THIS_MODULE 1
+#else
+#define WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE_FOR_THIS_MODULE 0
+#endif
+
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+// POSIX uses FS for TLS, GS is free
+static inline void* wasm_rt_segue_read_base() {
+  if (wasm_rt_fsgsbase_inst_supported) {
+    return (void*)__builtin_ia32_rdgsbase64();
+  } else {
+    return wasm_rt_syscall_get_segue_base();
+  }
+}
+static inline void wasm_rt_segue_write_base(void* base) {
+#if WASM_RT_SEGUE_FREE_SEGMENT
+  if (wasm_rt_last_segment_val == base) {
+    return;
+  }
+
+  wasm_rt_last_segment_val = base;
+#endif
+
+  if (wasm_rt_fsgsbase_inst_supported) {
+    __builtin_ia32_wrgsbase64((uintptr_t)base);
+  } else {
+    wasm_rt_syscall_set_segue_base(base);
+  }
+}
+#define MEM_ADDR_MEMOP(mem, addr, n) ((uint8_t __seg_gs*)(uintptr_t)addr)
+#elif WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE_FOR_THIS_MODULE
+#define MEM_ADDR_MEMOP(mem, addr, n) (&wasm_rt_local_memory_base[(addr)])
+#else
+#define MEM_ADDR_MEMOP(mem, addr, n) MEM_ADDR(mem, addr, n)
+#endif
+
+#define TRAP(x) (wasm_rt_trap(WASM_RT_TRAP_##x), 0)
+
+#if WASM_RT_STACK_DEPTH_COUNT
+#define FUNC_PROLOGUE                                            \
+  if (++wasm_rt_call_stack_depth > WASM_RT_MAX_CALL_STACK_DEPTH) \
+    TRAP(EXHAUSTION);
+
+#define FUNC_EPILOGUE --wasm_rt_call_stack_depth
+#else
+#define FUNC_PROLOGUE
+
+#define FUNC_EPILOGUE
+#endif
+
+#define UNREACHABLE TRAP(UNREACHABLE)
+
+#if defined(__clang__) || defined(__GNUC__)
+#define W2C_COLD_FUNC __attribute__((noinline, cold))
+#elif defined(_MSC_VER)
+#define W2C_COLD_FUNC __declspec(noinline)
+#else
+#define W2C_COLD_FUNC
+#endif
+
+W2C_COLD_FUNC static bool func_types_eq_slowpath(
+    const wasm_rt_funcref_table_t* table,
+    const wasm_rt_func_type_t expected_type,
+    uint32_t index) {
+  const size_t sha256size = 32;
+  if (index >= table->size) {
+    // Table index out of bounds. Raise Wasm trap.
+    TRAP(CALL_INDIRECT);
+    return false;
+  }
+  const wasm_rt_funcref_t* const func_ref = &table->data[index];
+  if (!expected_type || !func_ref->func || !func_ref->func_type ||
+      memcmp(expected_type, func_ref->func_type, sha256size) != 0) {
+    // Type check failed. Raise Wasm trap.
+    TRAP(CALL_INDIRECT);
+    return false;
+  }
+  return true;
+}
+
+#define CHECK_CALL_INDIRECT(table, ft, x)                       \
+  (LIKELY((x) < table.size && ft == table.data[x].func_type) || \
+   func_types_eq_slowpath(&(table), ft, x))
+
+#define DO_CALL_INDIRECT(table, t, x, ...) ((t)table.data[x].func)(__VA_ARGS__)
+
+#define CALL_INDIRECT(table, t, ft, x, ...) \
+  (CHECK_CALL_INDIRECT(table, ft, x),       \
+   DO_CALL_INDIRECT(table, t, x, __VA_ARGS__))
+
+static inline uint64_t checked_add_u64(uint64_t a, uint64_t b) {
+  uint64_t ret;
+#if __has_builtin(__builtin_add_overflow)
+  if (__builtin_add_overflow(a, b, &ret))
+    TRAP(OOB);
+#elif defined(_MSC_VER)
+  if (_addcarry_u64(0, a, b, &ret))
+    TRAP(OOB);
+#else
+  ret = a + b;
+  if (ret < a)
+    TRAP(OOB);
+#endif
+  return ret;
+}
+
+#define RANGE_CHECK(mem, offset, len)            \
+  do {                                           \
+    uint64_t res = checked_add_u64(offset, len); \
+    if (UNLIKELY(res > (mem)->size))             \
+      TRAP(OOB);                                 \
+  } while (0);
+
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && WASM_RT_SANITY_CHECKS
+#include <stdio.h>
+#define WASM_RT_CHECK_BASE(mem)                                               \
+  if (((uintptr_t)((mem)->data)) != ((uintptr_t)wasm_rt_segue_read_base())) { \
+    puts("Segment register mismatch\n");                                      \
+    abort();                                                                  \
+  }
+#else
+#define WASM_RT_CHECK_BASE(mem)
+#endif
+
+// MEMCHECK_DEFAULT32 is an "accelerated" MEMCHECK used only for
+// default-page-size, 32-bit memories. It may do nothing at all
+// (if hardware bounds-checking is enabled via guard pages)
+// or it may do a slightly faster RANGE_CHECK.
+#if WASM_RT_MEMCHECK_GUARD_PAGES
+#define MEMCHECK_DEFAULT32(mem, local_memory_size, a, t) \
+  WASM_RT_CHECK_BASE(mem);
+#else
+#if WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE_FOR_THIS_MODULE
+#define MEMCHECK_DEFAULT32(mem, local_memory_size, a, t)     \
+  WASM_RT_CHECK_BASE(mem);                                   \
+  if (UNLIKELY(a + (uint64_t)sizeof(t) > local_memory_size)) \
+    TRAP(OOB);
+#else
+#define MEMCHECK_DEFAULT32(mem, local_memory_size, a, t) \
+  WASM_RT_CHECK_BASE(mem);                               \
+  if (UNLIKELY(a + (uint64_t)sizeof(t) > mem->size))     \
+    TRAP(OOB);
+#endif
+#endif
+
+// MEMCHECK_GENERAL can be used for any memory
+#define MEMCHECK_GENERAL(mem, a, t) \
+  WASM_RT_CHECK_BASE(mem);          \
+  RANGE_CHECK(mem, a, sizeof(t));
+
+// When using guard pages, reads have to be immediately consumed so that OOB
+// trap checks are applied in the right place, and not optimized away. This is
+// done using FORCE_READ_INT/FORCE_READ_FLOAT
+#if WASM_RT_MEMCHECK_BOUNDS_CHECK || \
+    WASM_RT_NONCONFORMING_ALLOW_OOB_READ_ELIMINATION
+#define FORCE_READ_INT(var)
+#define FORCE_READ_FLOAT(var)
+#elif defined(__GNUC__) && WASM_RT_MEMCHECK_GUARD_PAGES
+#define FORCE_READ_INT(var) __asm__("" ::"r"(var))
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define FORCE_READ_FLOAT_CONSTRAINT "x"
+#elif defined(__aarch64__) && defined(__ARM_FP) && ((__ARM_FP & 0x4) != 0)
+#define FORCE_READ_FLOAT_CONSTRAINT "w"
+#elif defined(__mips__) && defined(__clang__) && !defined(__mips_soft_float)
+// Clang before v18 uses hard floats which has a different constraint
+#define FORCE_READ_FLOAT_CONSTRAINT "f"
+#elif (defined(__powerpc__) || defined(__ppc__) || defined(__PPC__)) && \
+    !(defined(_SOFT_FLOAT) || defined(__NO_FPRS__))
+#define FORCE_READ_FLOAT_CONSTRAINT "f"
+#elif defined(__riscv) && defined(__riscv_flen) && (__riscv_flen >= 32)
+#define FORCE_READ_FLOAT_CONSTRAINT "f"
+#elif defined(__s390__) || defined(__s390x__)
+#define FORCE_READ_FLOAT_CONSTRAINT "f"
+#else
+#define FORCE_READ_FLOAT_CONSTRAINT "r"
+#endif
+
+#define FORCE_READ_FLOAT(var) __asm__("" ::FORCE_READ_FLOAT_CONSTRAINT(var))
+#else
+#error \
+    "Guard page mode for Wasm not supported on this platform because FORCE_READ_INT/FORCE_READ_FLOAT could not be instantiated." \
+   "Either enable specify -DWASM_RT_NONCONFORMING_ALLOW_OOB_READ_ELIMINATION=1 during compilation or use -DWASM_RT_MEMCHECK_BOUNDS_CHECK=1 to use bounds check mode"
+#endif
+
+static inline void load_data(u8* dest, const u8* src, size_t n) {
+  if (!n) {
+    return;
+  }
+#if WABT_BIG_ENDIAN
+  for (size_t i = 0; i < n; i++) {
+    dest[i] = src[n - i - 1];
+  }
+#else
+  wasm_rt_memcpy(dest, src, n);
+#endif
+}
+
+#define LOAD_DATA(m, o, i, s)            \
+  do {                                   \
+    RANGE_CHECK((&m), o, s);             \
+    load_data(MEM_ADDR(&m, o, s), i, s); \
+  } while (0)
+
+#define DEF_MEM_CHECKS0(name, shared, mem_type, ret_kw, return_type)         \
+  static inline return_type name##_default32(                                \
+      uint8_t* const wasm_rt_local_memory_base,                              \
+      uint64_t wasm_rt_local_memory_size, wasm_rt##shared##memory_t* mem,    \
+      u64 addr) {                                                            \
+    MEMCHECK_DEFAULT32(mem, wasm_rt_local_memory_size, addr, mem_type);      \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr);           \
+  }                                                                          \
+  static inline return_type name(uint8_t* const wasm_rt_local_memory_base,   \
+                                 uint64_t wasm_rt_local_memory_size,         \
+                                 wasm_rt##shared##memory_t* mem, u64 addr) { \
+    MEMCHECK_GENERAL(mem, addr, mem_type);                                   \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr);           \
+  }
+
+#define DEF_MEM_CHECKS1(name, shared, mem_type, ret_kw, return_type,       \
+                        val_type1)                                         \
+  static inline return_type name##_default32(                              \
+      uint8_t* const wasm_rt_local_memory_base,                            \
+      uint64_t wasm_rt_local_memory_size, wasm_rt##shared##memory_t* mem,  \
+      u64 addr, val_type1 val1) {                                          \
+    MEMCHECK_DEFAULT32(mem, wasm_rt_local_memory_size, addr, mem_type);    \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr, val1);   \
+  }                                                                        \
+  static inline return_type name(uint8_t* const wasm_rt_local_memory_base, \
+                                 uint64_t wasm_rt_local_memory_size,       \
+                                 wasm_rt##shared##memory_t* mem, u64 addr, \
+                                 val_type1 val1) {                         \
+    MEMCHECK_GENERAL(mem, addr, mem_type);                                 \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr, val1);   \
+  }
+
+#define DEF_MEM_CHECKS2(name, shared, mem_type, ret_kw, return_type,           \
+                        val_type1, val_type2)                                  \
+  static inline return_type name##_default32(                                  \
+      uint8_t* const wasm_rt_local_memory_base,                                \
+      uint64_t wasm_rt_local_memory_size, wasm_rt##shared##memory_t* mem,      \
+      u64 addr, val_type1 val1, val_type2 val2) {                              \
+    MEMCHECK_DEFAULT32(mem, wasm_rt_local_memory_size, addr, mem_type);        \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr, val1, val2); \
+  }                                                                            \
+  static inline return_type name(uint8_t* const wasm_rt_local_memory_base,     \
+                                 uint64_t wasm_rt_local_memory_size,           \
+                                 wasm_rt##shared##memory_t* mem, u64 addr,     \
+                                 val_type1 val1, val_type2 val2) {             \
+    MEMCHECK_GENERAL(mem, addr, mem_type);                                     \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr, val1, val2); \
+  }
+
+#define DEFINE_LOAD(name, t1, t2, t3, force_read)                             \
+  static inline t3 name##_unchecked(uint8_t* const wasm_rt_local_memory_base, \
+                                    wasm_rt_memory_t* mem, u64 addr) {        \
+    t1 result;                                                                \
+    wasm_rt_memcpy(&result, MEM_ADDR_MEMOP(mem, addr, sizeof(t1)),            \
+                   sizeof(t1));                                               \
+    t3 ret = (t3)(t2)result;                                                  \
+    force_read(ret);                                                          \
+    return ret;                                                               \
+  }                                                                           \
+  DEF_MEM_CHECKS0(name, _, t1, return, t3)
+
+#define DEFINE_STORE(name, t1, t2)                                     \
+  static inline void name##_unchecked(                                 \
+      uint8_t* const wasm_rt_local_memory_base, wasm_rt_memory_t* mem, \
+      u64 addr, t2 value) {                                            \
+    t1 wrapped = (t1)value;                                            \
+    wasm_rt_memcpy(MEM_ADDR_MEMOP(mem, addr, sizeof(t1)), &wrapped,    \
+                   sizeof(t1));                                        \
+  }                                                                    \
+  DEF_MEM_CHECKS1(name, _, t1, , void, t2)
+
+DEFINE_LOAD(i32_load, u32, u32, u32, FORCE_READ_INT)
+DEFINE_LOAD(i64_load, u64, u64, u64, FORCE_READ_INT)
+DEFINE_LOAD(f32_load, f32, f32, f32, FORCE_READ_FLOAT)
+DEFINE_LOAD(f64_load, f64, f64, f64, FORCE_READ_FLOAT)
+DEFINE_LOAD(i32_load8_s, s8, s32, u32, FORCE_READ_INT)
+DEFINE_LOAD(i64_load8_s, s8, s64, u64, FORCE_READ_INT)
+DEFINE_LOAD(i32_load8_u, u8, u32, u32, FORCE_READ_INT)
+DEFINE_LOAD(i64_load8_u, u8, u64, u64, FORCE_READ_INT)
+DEFINE_LOAD(i32_load16_s, s16, s32, u32, FORCE_READ_INT)
+DEFINE_LOAD(i64_load16_s, s16, s64, u64, FORCE_READ_INT)
+DEFINE_LOAD(i32_load16_u, u16, u32, u32, FORCE_READ_INT)
+DEFINE_LOAD(i64_load16_u, u16, u64, u64, FORCE_READ_INT)
+DEFINE_LOAD(i64_load32_s, s32, s64, u64, FORCE_READ_INT)
+DEFINE_LOAD(i64_load32_u, u32, u64, u64, FORCE_READ_INT)
+DEFINE_STORE(i32_store, u32, u32)
+DEFINE_STORE(i64_store, u64, u64)
+DEFINE_STORE(f32_store, f32, f32)
+DEFINE_STORE(f64_store, f64, f64)
+DEFINE_STORE(i32_store8, u8, u32)
+DEFINE_STORE(i32_store16, u16, u32)
+DEFINE_STORE(i64_store8, u8, u64)
+DEFINE_STORE(i64_store16, u16, u64)
+DEFINE_STORE(i64_store32, u32, u64)
+
+#if defined(_MSC_VER)
+
+// Adapted from
+// https://github.com/nemequ/portable-snippets/blob/master/builtin/builtin.h
+
+static inline int I64_CLZ(unsigned long long v) {
+  unsigned long r = 0;
+#if defined(_M_AMD64) || defined(_M_ARM)
+  if (_BitScanReverse64(&r, v)) {
+    return 63 - r;
+  }
+#else
+  if (_BitScanReverse(&r, (unsigned long)(v >> 32))) {
+    return 31 - r;
+  } else if (_BitScanReverse(&r, (unsigned long)v)) {
+    return 63 - r;
+  }
+#endif
+  return 64;
+}
+
+static inline int I32_CLZ(unsigned long v) {
+  unsigned long r = 0;
+  if (_BitScanReverse(&r, v)) {
+    return 31 - r;
+  }
+  return 32;
+}
+
+static inline int I64_CTZ(unsigned long long v) {
+  if (!v) {
+    return 64;
+  }
+  unsigned long r = 0;
+#if defined(_M_AMD64) || defined(_M_ARM)
+  _BitScanForward64(&r, v);
+  return (int)r;
+#else
+  if (_BitScanForward(&r, (unsigned int)(v))) {
+    return (int)(r);
+  }
+
+  _BitScanForward(&r, (unsigned int)(v >> 32));
+  return (int)(r + 32);
+#endif
+}
+
+static inline int I32_CTZ(unsigned long v) {
+  if (!v) {
+    return 32;
+  }
+  unsigned long r = 0;
+  _BitScanForward(&r, v);
+  return (int)r;
+}
+
+#define POPCOUNT_DEFINE_PORTABLE(f_n, T)                            \
+  static inline u32 f_n(T x) {                                      \
+    x = x - ((x >> 1) & (T) ~(T)0 / 3);                             \
+    x = (x & (T) ~(T)0 / 15 * 3) + ((x >> 2) & (T) ~(T)0 / 15 * 3); \
+    x = (x + (x >> 4)) & (T) ~(T)0 / 255 * 15;                      \
+    return (T)(x * ((T) ~(T)0 / 255)) >> (sizeof(T) - 1) * 8;       \
+  }
+
+POPCOUNT_DEFINE_PORTABLE(I32_POPCNT, u32)
+POPCOUNT_DEFINE_PORTABLE(I64_POPCNT, u64)
+
+#undef POPCOUNT_DEFINE_PORTABLE
+
+#else
+
+#define I32_CLZ(x) ((x) ? __builtin_clz(x) : 32)
+#define I64_CLZ(x) ((x) ? __builtin_clzll(x) : 64)
+#define I32_CTZ(x) ((x) ? __builtin_ctz(x) : 32)
+#define I64_CTZ(x) ((x) ? __builtin_ctzll(x) : 64)
+#define I32_POPCNT(x) (__builtin_popcount(x))
+#define I64_POPCNT(x) (__builtin_popcountll(x))
+
+#endif
+
+#define DIV_S(ut, min, x, y)                                  \
+  ((UNLIKELY((y) == 0))                  ? TRAP(DIV_BY_ZERO)  \
+   : (UNLIKELY((x) == min && (y) == -1)) ? TRAP(INT_OVERFLOW) \
+                                         : (ut)((x) / (y)))
+
+#define REM_S(ut, min, x, y)                                 \
+  ((UNLIKELY((y) == 0))                  ? TRAP(DIV_BY_ZERO) \
+   : (UNLIKELY((x) == min && (y) == -1)) ? 0                 \
+                                         : (ut)((x) % (y)))
+
+#define I32_DIV_S(x, y) DIV_S(u32, INT32_MIN, (s32)x, (s32)y)
+#define I64_DIV_S(x, y) DIV_S(u64, INT64_MIN, (s64)x, (s64)y)
+#define I32_REM_S(x, y) REM_S(u32, INT32_MIN, (s32)x, (s32)y)
+#define I64_REM_S(x, y) REM_S(u64, INT64_MIN, (s64)x, (s64)y)
+
+#define DIVREM_U(op, x, y) \
+  ((UNLIKELY((y) == 0)) ? TRAP(DIV_BY_ZERO) : ((x)op(y)))
+
+#define DIV_U(x, y) DIVREM_U(/, x, y)
+#define REM_U(x, y) DIVREM_U(%, x, y)
+
+#define ROTL(x, y, mask) \
+  (((x) << ((y) & (mask))) | ((x) >> (((mask) - (y) + 1) & (mask))))
+#define ROTR(x, y, mask) \
+  (((x) >> ((y) & (mask))) | ((x) << (((mask) - (y) + 1) & (mask))))
+
+#define I32_ROTL(x, y) ROTL(x, y, 31)
+#define I64_ROTL(x, y) ROTL(x, y, 63)
+#define I32_ROTR(x, y) ROTR(x, y, 31)
+#define I64_ROTR(x, y) ROTR(x, y, 63)
+
+#define FMIN(x, y)                                           \
+  ((UNLIKELY((x) != (x)))             ? NAN                  \
+   : (UNLIKELY((y) != (y)))           ? NAN                  \
+   : (UNLIKELY((x) == 0 && (y) == 0)) ? (signbit(x) ? x : y) \
+   : (x < y)                          ? x                    \
+                                      : y)
+
+#define FMAX(x, y)                                           \
+  ((UNLIKELY((x) != (x)))             ? NAN                  \
+   : (UNLIKELY((y) != (y)))           ? NAN                  \
+   : (UNLIKELY((x) == 0 && (y) == 0)) ? (signbit(x) ? y : x) \
+   : (x > y)                          ? x                    \
+                                      : y)
+
+#define TRUNC_S(ut, st, ft, min, minop, max, x)                             \
+  ((UNLIKELY((x) != (x)))                        ? TRAP(INVALID_CONVERSION) \
+   : (UNLIKELY(!((x)minop(min) && (x) < (max)))) ? TRAP(INT_OVERFLOW)       \
+                                                 : (ut)(st)(x))
+
+#define I32_TRUNC_S_F32(x) \
+  TRUNC_S(u32, s32, f32, (f32)INT32_MIN, >=, 2147483648.f, x)
+#define I64_TRUNC_S_F32(x) \
+  TRUNC_S(u64, s64, f32, (f32)INT64_MIN, >=, (f32)INT64_MAX, x)
+#define I32_TRUNC_S_F64(x) \
+  TRUNC_S(u32, s32, f64, -2147483649., >, 2147483648., x)
+#define I64_TRUNC_S_F64(x) \
+  TRUNC_S(u64, s64, f64, (f64)INT64_MIN, >=, (f64)INT64_MAX, x)
+
+#define TRUNC_U(ut, ft, max, x)                                              \
+  ((UNLIKELY((x) != (x)))                         ? TRAP(INVALID_CONVERSION) \
+   : (UNLIKELY(!((x) > (ft) - 1 && (x) < (max)))) ? TRAP(INT_OVERFLOW)       \
+                                                  : (ut)(x))
+
+#define I32_TRUNC_U_F32(x) TRUNC_U(u32, f32, 4294967296.f, x)
+#define I64_TRUNC_U_F32(x) TRUNC_U(u64, f32, (f32)UINT64_MAX, x)
+#define I32_TRUNC_U_F64(x) TRUNC_U(u32, f64, 4294967296., x)
+#define I64_TRUNC_U_F64(x) TRUNC_U(u64, f64, (f64)UINT64_MAX, x)
+
+#define TRUNC_SAT_S(ut, st, ft, min, smin, minop, max, smax, x) \
+  ((UNLIKELY((x) != (x)))         ? 0                           \
+   : (UNLIKELY(!((x)minop(min)))) ? smin                        \
+   : (UNLIKELY(!((x) < (max))))   ? smax                        \
+                                  : (ut)(st)(x))
+
+#define I32_TRUNC_SAT_S_F32(x)                                            \
+  TRUNC_SAT_S(u32, s32, f32, (f32)INT32_MIN, INT32_MIN, >=, 2147483648.f, \
+              INT32_MAX, x)
+#define I64_TRUNC_SAT_S_F32(x)                                              \
+  TRUNC_SAT_S(u64, s64, f32, (f32)INT64_MIN, INT64_MIN, >=, (f32)INT64_MAX, \
+              INT64_MAX, x)
+#define I32_TRUNC_SAT_S_F64(x)                                        \
+  TRUNC_SAT_S(u32, s32, f64, -2147483649., INT32_MIN, >, 2147483648., \
+              INT32_MAX, x)
+#define I64_TRUNC_SAT_S_F64(x)                                              \
+  TRUNC_SAT_S(u64, s64, f64, (f64)INT64_MIN, INT64_MIN, >=, (f64)INT64_MAX, \
+              INT64_MAX, x)
+
+#define TRUNC_SAT_U(ut, ft, max, smax, x) \
+  ((UNLIKELY((x) != (x)))          ? 0    \
+   : (UNLIKELY(!((x) > (ft) - 1))) ? 0    \
+   : (UNLIKELY(!((x) < (max))))    ? smax \
+                                   : (ut)(x))
+
+#define I32_TRUNC_SAT_U_F32(x) \
+  TRUNC_SAT_U(u32, f32, 4294967296.f, UINT32_MAX, x)
+#define I64_TRUNC_SAT_U_F32(x) \
+  TRUNC_SAT_U(u64, f32, (f32)UINT64_MAX, UINT64_MAX, x)
+#define I32_TRUNC_SAT_U_F64(x) TRUNC_SAT_U(u32, f64, 4294967296., UINT32_MAX, x)
+#define I64_TRUNC_SAT_U_F64(x) \
+  TRUNC_SAT_U(u64, f64, (f64)UINT64_MAX, UINT64_MAX, x)
+
+#define DEFINE_REINTERPRET(name, t1, t2)         \
+  static inline t2 name(t1 x) {                  \
+    t2 result;                                   \
+    wasm_rt_memcpy(&result, &x, sizeof(result)); \
+    return result;                               \
+  }
+
+DEFINE_REINTERPRET(f32_reinterpret_i32, u32, f32)
+DEFINE_REINTERPRET(i32_reinterpret_f32, f32, u32)
+DEFINE_REINTERPRET(f64_reinterpret_i64, u64, f64)
+DEFINE_REINTERPRET(i64_reinterpret_f64, f64, u64)
+
+static float quiet_nanf(float x) {
+  uint32_t tmp;
+  wasm_rt_memcpy(&tmp, &x, 4);
+  tmp |= 0x7fc00000lu;
+  wasm_rt_memcpy(&x, &tmp, 4);
+  return x;
+}
+
+static double quiet_nan(double x) {
+  uint64_t tmp;
+  wasm_rt_memcpy(&tmp, &x, 8);
+  tmp |= 0x7ff8000000000000llu;
+  wasm_rt_memcpy(&x, &tmp, 8);
+  return x;
+}
+
+static double wasm_quiet(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+  return x;
+}
+
+static float wasm_quietf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+  return x;
+}
+
+static double wasm_floor(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+  return floor(x);
+}
+
+static float wasm_floorf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+  return floorf(x);
+}
+
+static double wasm_ceil(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+  return ceil(x);
+}
+
+static float wasm_ceilf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+  return ceilf(x);
+}
+
+static double wasm_trunc(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+  return trunc(x);
+}
+
+static float wasm_truncf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+  return truncf(x);
+}
+
+static float wasm_nearbyintf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+  return nearbyintf(x);
+}
+
+static double wasm_nearbyint(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+  return nearbyint(x);
+}
+
+static float wasm_fabsf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    uint32_t tmp;
+    wasm_rt_memcpy(&tmp, &x, 4);
+    tmp = tmp & ~(1UL << 31);
+    wasm_rt_memcpy(&x, &tmp, 4);
+    return x;
+  }
+  return fabsf(x);
+}
+
+static double wasm_fabs(double x) {
+  if (UNLIKELY(isnan(x))) {
+    uint64_t tmp;
+    wasm_rt_memcpy(&tmp, &x, 8);
+    tmp = tmp & ~(1ULL << 63);
+    wasm_rt_memcpy(&x, &tmp, 8);
+    return x;
+  }
+  return fabs(x);
+}
+
+static double wasm_sqrt(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+
+#if __has_builtin(__builtin_elementwise_sqrt)
+  // Fastest option: doesn't set errno
+  return __builtin_elementwise_sqrt(x);
+#elif __has_builtin(__builtin_sqrt)
+  // Optimized if -fno-math-errno is set
+  return __builtin_sqrt(x);
+#else
+  // Libc call. May/may not be optimized
+  return sqrt(x);
+#endif
+}
+
+static float wasm_sqrtf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+
+#if __has_builtin(__builtin_elementwise_sqrt)
+  // Fastest option: doesn't set errno
+  return __builtin_elementwise_sqrt(x);
+#elif __has_builtin(__builtin_sqrt)
+  // Optimized if -fno-math-errno is set
+  return __builtin_sqrtf(x);
+#else
+  // Libc call. May/may not be optimized
+  return sqrtf(x);
+#endif
+}
+
+static inline void memory_fill(wasm_rt_memory_t* mem, u64 d, u32 val, u64 n) {
+  RANGE_CHECK(mem, d, n);
+  memset(MEM_ADDR(mem, d, n), val, n);
+}
+
+static inline void memory_copy(wasm_rt_memory_t* dest,
+                               const wasm_rt_memory_t* src,
+                               u64 dest_addr,
+                               u64 src_addr,
+                               u64 n) {
+  RANGE_CHECK(dest, dest_addr, n);
+  RANGE_CHECK(src, src_addr, n);
+  memmove(MEM_ADDR(dest, dest_addr, n), MEM_ADDR(src, src_addr, n), n);
+}
+
+static inline void memory_init(wasm_rt_memory_t* dest,
+                               const u8* src,
+                               u32 src_size,
+                               u64 dest_addr,
+                               u32 src_addr,
+                               u32 n) {
+  if (UNLIKELY(src_addr + (uint64_t)n > src_size))
+    TRAP(OOB);
+  LOAD_DATA((*dest), dest_addr, src + src_addr, n);
+}
+
+typedef enum { RefFunc, RefNull, GlobalGet } wasm_elem_segment_expr_type_t;
+
+typedef struct {
+  wasm_elem_segment_expr_type_t expr_type;
+  wasm_rt_func_type_t type;
+  wasm_rt_function_ptr_t func;
+  wasm_rt_tailcallee_t func_tailcallee;
+  size_t module_offset;
+} wasm_elem_segment_expr_t;
+
+static inline void funcref_table_init(wasm_rt_funcref_table_t* dest,
+                                      const wasm_elem_segment_expr_t* src,
+                                      u32 src_size,
+                                      u64 dest_addr,
+                                      u32 src_addr,
+                                      u32 n,
+                                      void* module_instance) {
+  if (UNLIKELY(src_addr + (uint64_t)n > src_size))
+    TRAP(OOB);
+  RANGE_CHECK(dest, dest_addr, n);
+  for (u32 i = 0; i < n; i++) {
+    const wasm_elem_segment_expr_t* const src_expr = &src[src_addr + i];
+    wasm_rt_funcref_t* const dest_val = &(dest->data[dest_addr + i]);
+    switch (src_expr->expr_type) {
+      case RefFunc:
+        *dest_val = (wasm_rt_funcref_t){
+            src_expr->type, src_expr->func, src_expr->func_tailcallee,
+            (char*)module_instance + src_expr->module_offset};
+        break;
+      case RefNull:
+        *dest_val = wasm_rt_funcref_null_value;
+        break;
+      case GlobalGet:
+        *dest_val = **(wasm_rt_funcref_t**)((char*)module_instance +
+                                            src_expr->module_offset);
+        break;
+    }
+  }
+}
+
+// Currently wasm2c only supports initializing externref tables with ref.null.
+static inline void externref_table_init(wasm_rt_externref_table_t* dest,
+                                        u32 src_size,
+                                        u64 dest_addr,
+                                        u32 src_addr,
+                                        u32 n) {
+  if (UNLIKELY(src_addr + (uint64_t)n > src_size))
+    TRAP(OOB);
+  RANGE_CHECK(dest, dest_addr, n);
+  for (u32 i = 0; i < n; i++) {
+    dest->data[dest_addr + i] = wasm_rt_externref_null_value;
+  }
+}
+
+#define DEFINE_TABLE_COPY(type)                                              \
+  static inline void type##_table_copy(wasm_rt_##type##_table_t* dest,       \
+                                       const wasm_rt_##type##_table_t* src,  \
+                                       u64 dest_addr, u64 src_addr, u64 n) { \
+    RANGE_CHECK(dest, dest_addr, n);                                         \
+    RANGE_CHECK(src, src_addr, n);                                           \
+    memmove(dest->data + dest_addr, src->data + src_addr,                    \
+            n * sizeof(wasm_rt_##type##_t));                                 \
+  }
+
+DEFINE_TABLE_COPY(funcref)
+DEFINE_TABLE_COPY(externref)
+
+#define DEFINE_TABLE_GET(type)                        \
+  static inline wasm_rt_##type##_t type##_table_get(  \
+      const wasm_rt_##type##_table_t* table, u64 i) { \
+    if (UNLIKELY(i >= table->size))                   \
+      TRAP(OOB);                                      \
+    return table->data[i];                            \
+  }
+
+DEFINE_TABLE_GET(funcref)
+DEFINE_TABLE_GET(externref)
+
+#define DEFINE_TABLE_SET(type)                                               \
+  static inline void type##_table_set(const wasm_rt_##type##_table_t* table, \
+                                      u64 i, const wasm_rt_##type##_t val) { \
+    if (UNLIKELY(i >= table->size))                                          \
+      TRAP(OOB);                                                             \
+    table->data[i] = val;                                                    \
+  }
+
+DEFINE_TABLE_SET(funcref)
+DEFINE_TABLE_SET(externref)
+
+#define DEFINE_TABLE_FILL(type)                                               \
+  static inline void type##_table_fill(const wasm_rt_##type##_table_t* table, \
+                                       u64 d, const wasm_rt_##type##_t val,   \
+                                       u64 n) {                               \
+    RANGE_CHECK(table, d, n);                                                 \
+    for (uint32_t i = d; i < d + n; i++) {                                    \
+      table->data[i] = val;                                                   \
+    }                                                                         \
+  }
+
+DEFINE_TABLE_FILL(funcref)
+DEFINE_TABLE_FILL(externref)
+
+#if defined(__GNUC__) || defined(__clang__)
+#define FUNC_TYPE_DECL_EXTERN_T(x) extern const char* const x
+#define FUNC_TYPE_EXTERN_T(x) const char* const x
+#define FUNC_TYPE_T(x) static const char* const x
+#else
+#define FUNC_TYPE_DECL_EXTERN_T(x) extern const char x[]
+#define FUNC_TYPE_EXTERN_T(x) const char x[]
+#define FUNC_TYPE_T(x) static const char x[]
+#endif
+
+#if (__STDC_VERSION__ < 201112L) && !defined(static_assert)
+#define static_assert(X) \
+  extern int(*assertion(void))[!!sizeof(struct { int x : (X) ? 2 : -1; })];
+#endif
+
+#ifdef _MSC_VER
+#define WEAK_FUNC_DECL(func, fallback)                             \
+  __pragma(comment(linker, "/alternatename:" #func "=" #fallback)) \
+                                                                   \
+      void                                                         \
+      fallback(void** instance_ptr, void* tail_call_stack,         \
+               wasm_rt_tailcallee_t* next)
+#else
+#define WEAK_FUNC_DECL(func, fallback)                                        \
+  __attribute__((weak)) void func(void** instance_ptr, void* tail_call_stack, \
+                                  wasm_rt_tailcallee_t* next)
+#endif
+
+static u32 w2c_address64__0__wasm_8u_good1_0(w2c_address64__0__wasm*, u64);
+static u32 w2c_address64__0__wasm_8u_good2_0(w2c_address64__0__wasm*, u64);
+static u32 w2c_address64__0__wasm_8u_good3_0(w2c_address64__0__wasm*, u64);
+static u32 w2c_address64__0__wasm_8u_good4_0(w2c_address64__0__wasm*, u64);
+static u32 w2c_address64__0__wasm_8u_good5_0(w2c_address64__0__wasm*, u64);
+static u32 w2c_address64__0__wasm_8s_good1_0(w2c_address64__0__wasm*, u64);
+static u32 w2c_address64__0__wasm_8s_good2_0(w2c_address64__0__wasm*, u64);
+static u32 w2c_address64__0__wasm_8s_good3_0(w2c_address64__0__wasm*, u64);
+static u32 w2c_address64__0__wasm_8s_good4_0(w2c_address64__0__wasm*, u64);
+static u32 w2c_address64__0__wasm_8s_good5_0(w2c_address64__0__wasm*, u64);
+static u32 w2c_address64__0__wasm_16u_good1_0(w2c_address64__0__wasm*, u64);
+static u32 w2c_address64__0__wasm_16u_good2_0(w2c_address64__0__wasm*, u64);
+static u32 w2c_address64__0__wasm_16u_good3_0(w2c_address64__0__wasm*, u64);
+static u32 w2c_address64__0__wasm_16u_good4_0(w2c_address64__0__wasm*, u64);
+static u32 w2c_address64__0__wasm_16u_good5_0(w2c_address64__0__wasm*, u64);
+static u32 w2c_address64__0__wasm_16s_good1_0(w2c_address64__0__wasm*, u64);
+static u32 w2c_address64__0__wasm_16s_good2_0(w2c_address64__0__wasm*, u64);
+static u32 w2c_address64__0__wasm_16s_good3_0(w2c_address64__0__wasm*, u64);
+static u32 w2c_address64__0__wasm_16s_good4_0(w2c_address64__0__wasm*, u64);
+static u32 w2c_address64__0__wasm_16s_good5_0(w2c_address64__0__wasm*, u64);
+static u32 w2c_address64__0__wasm_32_good1_0(w2c_address64__0__wasm*, u64);
+static u32 w2c_address64__0__wasm_32_good2_0(w2c_address64__0__wasm*, u64);
+static u32 w2c_address64__0__wasm_32_good3_0(w2c_address64__0__wasm*, u64);
+static u32 w2c_address64__0__wasm_32_good4_0(w2c_address64__0__wasm*, u64);
+static u32 w2c_address64__0__wasm_32_good5_0(w2c_address64__0__wasm*, u64);
+static void w2c_address64__0__wasm_8u_bad_0(w2c_address64__0__wasm*, u64);
+static void w2c_address64__0__wasm_8s_bad_0(w2c_address64__0__wasm*, u64);
+static void w2c_address64__0__wasm_16u_bad_0(w2c_address64__0__wasm*, u64);
+static void w2c_address64__0__wasm_16s_bad_0(w2c_address64__0__wasm*, u64);
+static void w2c_address64__0__wasm_32_bad_0(w2c_address64__0__wasm*, u64);
+
+FUNC_TYPE_T(w2c_address64__0__wasm_t0) = "\x36\xb2\x3b\x59\x0e\xe1\x68\x15\x39\xbd\x13\x39\xf5\xe5\xc8\x9b\x43\xd8\xb0\x6d\x5d\x5d\x18\xc2\x38\x45\x2d\x0e\x6b\x81\x8f\x8f";
+FUNC_TYPE_T(w2c_address64__0__wasm_t1) = "\x36\xe8\xcd\xcd\x7f\x90\xda\x2c\x26\xd8\x14\xae\x0b\x2f\x96\xbd\x2f\xba\x60\x45\x88\x21\xbf\x78\x71\xf1\x9d\xee\x54\x81\xd3\xc8";
+
+static const u8 data_segment_data_w2c_address64__0__wasm_d0[] = {
+  0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 
+  0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 
+  0x79, 0x7a, 
+};
+
+static void init_memories(w2c_address64__0__wasm* instance) {
+  wasm_rt_allocate_memory(&instance->w2c_M0, 1, 281474976710656, 1, 65536);
+  LOAD_DATA(instance->w2c_M0, 0ull, data_segment_data_w2c_address64__0__wasm_d0, 26);
+}
+
+static void init_data_instances(w2c_address64__0__wasm *instance) {
+}
+
+/* export: '8u_good1' */
+u32 w2c_address64__0__wasm_8u_good1(w2c_address64__0__wasm* instance, u64 var_p0) {
+  u32 ret = w2c_address64__0__wasm_8u_good1_0(instance, var_p0);
+  return ret;
+}
+
+/* export: '8u_good2' */
+u32 w2c_address64__0__wasm_8u_good2(w2c_address64__0__wasm* instance, u64 var_p0) {
+  u32 ret = w2c_address64__0__wasm_8u_good2_0(instance, var_p0);
+  return ret;
+}
+
+/* export: '8u_good3' */
+u32 w2c_address64__0__wasm_8u_good3(w2c_address64__0__wasm* instance, u64 var_p0) {
+  u32 ret = w2c_address64__0__wasm_8u_good3_0(instance, var_p0);
+  return ret;
+}
+
+/* export: '8u_good4' */
+u32 w2c_address64__0__wasm_8u_good4(w2c_address64__0__wasm* instance, u64 var_p0) {
+  u32 ret = w2c_address64__0__wasm_8u_good4_0(instance, var_p0);
+  return ret;
+}
+
+/* export: '8u_good5' */
+u32 w2c_address64__0__wasm_8u_good5(w2c_address64__0__wasm* instance, u64 var_p0) {
+  u32 ret = w2c_address64__0__wasm_8u_good5_0(instance, var_p0);
+  return ret;
+}
+
+/* export: '8s_good1' */
+u32 w2c_address64__0__wasm_8s_good1(w2c_address64__0__wasm* instance, u64 var_p0) {
+  u32 ret = w2c_address64__0__wasm_8s_good1_0(instance, var_p0);
+  return ret;
+}
+
+/* export: '8s_good2' */
+u32 w2c_address64__0__wasm_8s_good2(w2c_address64__0__wasm* instance, u64 var_p0) {
+  u32 ret = w2c_address64__0__wasm_8s_good2_0(instance, var_p0);
+  return ret;
+}
+
+/* export: '8s_good3' */
+u32 w2c_address64__0__wasm_8s_good3(w2c_address64__0__wasm* instance, u64 var_p0) {
+  u32 ret = w2c_address64__0__wasm_8s_good3_0(instance, var_p0);
+  return ret;
+}
+
+/* export: '8s_good4' */
+u32 w2c_address64__0__wasm_8s_good4(w2c_address64__0__wasm* instance, u64 var_p0) {
+  u32 ret = w2c_address64__0__wasm_8s_good4_0(instance, var_p0);
+  return ret;
+}
+
+/* export: '8s_good5' */
+u32 w2c_address64__0__wasm_8s_good5(w2c_address64__0__wasm* instance, u64 var_p0) {
+  u32 ret = w2c_address64__0__wasm_8s_good5_0(instance, var_p0);
+  return ret;
+}
+
+/* export: '16u_good1' */
+u32 w2c_address64__0__wasm_16u_good1(w2c_address64__0__wasm* instance, u64 var_p0) {
+  u32 ret = w2c_address64__0__wasm_16u_good1_0(instance, var_p0);
+  return ret;
+}
+
+/* export: '16u_good2' */
+u32 w2c_address64__0__wasm_16u_good2(w2c_address64__0__wasm* instance, u64 var_p0) {
+  u32 ret = w2c_address64__0__wasm_16u_good2_0(instance, var_p0);
+  return ret;
+}
+
+/* export: '16u_good3' */
+u32 w2c_address64__0__wasm_16u_good3(w2c_address64__0__wasm* instance, u64 var_p0) {
+  u32 ret = w2c_address64__0__wasm_16u_good3_0(instance, var_p0);
+  return ret;
+}
+
+/* export: '16u_good4' */
+u32 w2c_address64__0__wasm_16u_good4(w2c_address64__0__wasm* instance, u64 var_p0) {
+  u32 ret = w2c_address64__0__wasm_16u_good4_0(instance, var_p0);
+  return ret;
+}
+
+/* export: '16u_good5' */
+u32 w2c_address64__0__wasm_16u_good5(w2c_address64__0__wasm* instance, u64 var_p0) {
+  u32 ret = w2c_address64__0__wasm_16u_good5_0(instance, var_p0);
+  return ret;
+}
+
+/* export: '16s_good1' */
+u32 w2c_address64__0__wasm_16s_good1(w2c_address64__0__wasm* instance, u64 var_p0) {
+  u32 ret = w2c_address64__0__wasm_16s_good1_0(instance, var_p0);
+  return ret;
+}
+
+/* export: '16s_good2' */
+u32 w2c_address64__0__wasm_16s_good2(w2c_address64__0__wasm* instance, u64 var_p0) {
+  u32 ret = w2c_address64__0__wasm_16s_good2_0(instance, var_p0);
+  return ret;
+}
+
+/* export: '16s_good3' */
+u32 w2c_address64__0__wasm_16s_good3(w2c_address64__0__wasm* instance, u64 var_p0) {
+  u32 ret = w2c_address64__0__wasm_16s_good3_0(instance, var_p0);
+  return ret;
+}
+
+/* export: '16s_good4' */
+u32 w2c_address64__0__wasm_16s_good4(w2c_address64__0__wasm* instance, u64 var_p0) {
+  u32 ret = w2c_address64__0__wasm_16s_good4_0(instance, var_p0);
+  return ret;
+}
+
+/* export: '16s_good5' */
+u32 w2c_address64__0__wasm_16s_good5(w2c_address64__0__wasm* instance, u64 var_p0) {
+  u32 ret = w2c_address64__0__wasm_16s_good5_0(instance, var_p0);
+  return ret;
+}
+
+/* export: '32_good1' */
+u32 w2c_address64__0__wasm_32_good1(w2c_address64__0__wasm* instance, u64 var_p0) {
+  u32 ret = w2c_address64__0__wasm_32_good1_0(instance, var_p0);
+  return ret;
+}
+
+/* export: '32_good2' */
+u32 w2c_address64__0__wasm_32_good2(w2c_address64__0__wasm* instance, u64 var_p0) {
+  u32 ret = w2c_address64__0__wasm_32_good2_0(instance, var_p0);
+  return ret;
+}
+
+/* export: '32_good3' */
+u32 w2c_address64__0__wasm_32_good3(w2c_address64__0__wasm* instance, u64 var_p0) {
+  u32 ret = w2c_address64__0__wasm_32_good3_0(instance, var_p0);
+  return ret;
+}
+
+/* export: '32_good4' */
+u32 w2c_address64__0__wasm_32_good4(w2c_address64__0__wasm* instance, u64 var_p0) {
+  u32 ret = w2c_address64__0__wasm_32_good4_0(instance, var_p0);
+  return ret;
+}
+
+/* export: '32_good5' */
+u32 w2c_address64__0__wasm_32_good5(w2c_address64__0__wasm* instance, u64 var_p0) {
+  u32 ret = w2c_address64__0__wasm_32_good5_0(instance, var_p0);
+  return ret;
+}
+
+/* export: '8u_bad' */
+void w2c_address64__0__wasm_8u_bad(w2c_address64__0__wasm* instance, u64 var_p0) {
+  w2c_address64__0__wasm_8u_bad_0(instance, var_p0);
+}
+
+/* export: '8s_bad' */
+void w2c_address64__0__wasm_8s_bad(w2c_address64__0__wasm* instance, u64 var_p0) {
+  w2c_address64__0__wasm_8s_bad_0(instance, var_p0);
+}
+
+/* export: '16u_bad' */
+void w2c_address64__0__wasm_16u_bad(w2c_address64__0__wasm* instance, u64 var_p0) {
+  w2c_address64__0__wasm_16u_bad_0(instance, var_p0);
+}
+
+/* export: '16s_bad' */
+void w2c_address64__0__wasm_16s_bad(w2c_address64__0__wasm* instance, u64 var_p0) {
+  w2c_address64__0__wasm_16s_bad_0(instance, var_p0);
+}
+
+/* export: '32_bad' */
+void w2c_address64__0__wasm_32_bad(w2c_address64__0__wasm* instance, u64 var_p0) {
+  w2c_address64__0__wasm_32_bad_0(instance, var_p0);
+}
+
+void wasm2c_address64__0__wasm_instantiate(w2c_address64__0__wasm* instance) {
+  assert(wasm_rt_is_initialized());
+  init_memories(instance);
+  init_data_instances(instance);
+}
+
+void wasm2c_address64__0__wasm_free(w2c_address64__0__wasm* instance) {
+  wasm_rt_free_memory(&instance->w2c_M0);
+}
+
+wasm_rt_func_type_t wasm2c_address64__0__wasm_get_func_type(uint32_t param_count, uint32_t result_count, ...) {
+  va_list args;
+  
+  if (param_count == 1 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I64 && va_arg(args, int) == WASM_RT_I32) {
+      va_end(args);
+      return w2c_address64__0__wasm_t0;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 1 && result_count == 0) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I64) {
+      va_end(args);
+      return w2c_address64__0__wasm_t1;
+    }
+    va_end(args);
+  }
+  
+  return NULL;
+}
+
+u32 w2c_address64__0__wasm_8u_good1_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load8_u(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_j0));
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_address64__0__wasm_8u_good2_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load8_u(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_j0));
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_address64__0__wasm_8u_good3_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load8_u(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)checked_add_u64(var_j0, 1u));
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_address64__0__wasm_8u_good4_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load8_u(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)checked_add_u64(var_j0, 2u));
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_address64__0__wasm_8u_good5_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load8_u(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)checked_add_u64(var_j0, 25u));
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_address64__0__wasm_8s_good1_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load8_s(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_j0));
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_address64__0__wasm_8s_good2_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load8_s(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_j0));
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_address64__0__wasm_8s_good3_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load8_s(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)checked_add_u64(var_j0, 1u));
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_address64__0__wasm_8s_good4_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load8_s(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)checked_add_u64(var_j0, 2u));
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_address64__0__wasm_8s_good5_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load8_s(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)checked_add_u64(var_j0, 25u));
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_address64__0__wasm_16u_good1_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load16_u(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_j0));
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_address64__0__wasm_16u_good2_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load16_u(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_j0));
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_address64__0__wasm_16u_good3_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load16_u(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)checked_add_u64(var_j0, 1u));
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_address64__0__wasm_16u_good4_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load16_u(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)checked_add_u64(var_j0, 2u));
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_address64__0__wasm_16u_good5_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load16_u(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)checked_add_u64(var_j0, 25u));
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_address64__0__wasm_16s_good1_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load16_s(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_j0));
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_address64__0__wasm_16s_good2_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load16_s(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_j0));
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_address64__0__wasm_16s_good3_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load16_s(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)checked_add_u64(var_j0, 1u));
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_address64__0__wasm_16s_good4_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load16_s(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)checked_add_u64(var_j0, 2u));
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_address64__0__wasm_16s_good5_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load16_s(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)checked_add_u64(var_j0, 25u));
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_address64__0__wasm_32_good1_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_j0));
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_address64__0__wasm_32_good2_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_j0));
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_address64__0__wasm_32_good3_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)checked_add_u64(var_j0, 1u));
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_address64__0__wasm_32_good4_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)checked_add_u64(var_j0, 2u));
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_address64__0__wasm_32_good5_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)checked_add_u64(var_j0, 25u));
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+void w2c_address64__0__wasm_8u_bad_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load8_u(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)checked_add_u64(var_j0, 4294967295u));
+  FUNC_EPILOGUE;
+}
+
+void w2c_address64__0__wasm_8s_bad_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load8_s(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)checked_add_u64(var_j0, 4294967295u));
+  FUNC_EPILOGUE;
+}
+
+void w2c_address64__0__wasm_16u_bad_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load16_u(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)checked_add_u64(var_j0, 4294967295u));
+  FUNC_EPILOGUE;
+}
+
+void w2c_address64__0__wasm_16s_bad_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load16_s(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)checked_add_u64(var_j0, 4294967295u));
+  FUNC_EPILOGUE;
+}
+
+void w2c_address64__0__wasm_32_bad_0(w2c_address64__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = var_p0;
+  var_i0 = i32_load(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)checked_add_u64(var_j0, 4294967295u));
+  FUNC_EPILOGUE;
+}
@@ -0,0 +1 @@
+(module (memory i64 0) (func (drop (i32.load16_s align=7 (i64.const 0)))))
\ No newline at end of file
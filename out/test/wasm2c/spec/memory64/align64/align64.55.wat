@@ -0,0 +1 @@
+(module (memory i64 0) (func (i32.store align=0 (i64.const 0) (i32.const 0))))
\ No newline at end of file
@@ -0,0 +1 @@
+(module (memory i64 0) (func (f32.store align=7 (i64.const 0) (f32.const 0))))
\ No newline at end of file
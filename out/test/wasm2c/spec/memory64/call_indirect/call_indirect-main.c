@@ -0,0 +1,937 @@
+#include "call_indirect.0.h"
+#include "call_indirect.1.h"
+#include "call_indirect.35.h"
+#include <assert.h>
+#define __STDC_FORMAT_MACROS
+#include <inttypes.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "wasm-rt.h"
+#include "wasm-rt-impl.h"
+#include "wasm-rt-exceptions.h"
+
+/* NOTE: function argument evaluation order is implementation-defined in C,
+   so it SHOULD NOT be relied on by tests. */
+#if WABT_BIG_ENDIAN
+#define v128_i8x16_make(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p) \
+	simde_wasm_i8x16_make(p,o,n,m,l,k,j,i,h,g,f,e,d,c,b,a)
+#define v128_u8x16_make(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p) \
+	simde_wasm_u8x16_make(p,o,n,m,l,k,j,i,h,g,f,e,d,c,b,a)
+#define v128_i16x8_make(a,b,c,d,e,f,g,h) simde_wasm_i16x8_make(h,g,f,e,d,c,b,a)
+#define v128_u16x8_make(a,b,c,d,e,f,g,h) simde_wasm_u16x8_make(h,g,f,e,d,c,b,a)
+#define v128_i32x4_make(a,b,c,d) simde_wasm_i32x4_make(d,c,b,a)
+#define v128_u32x4_make(a,b,c,d) simde_wasm_u32x4_make(d,c,b,a)
+#define v128_i64x2_make(a,b) simde_wasm_i64x2_make(b,a)
+#define v128_u64x2_make(a,b) simde_wasm_u64x2_make(b,a)
+#define v128_f32x4_make(a,b,c,d) simde_wasm_f32x4_make(d,c,b,a)
+#define v128_f64x2_make(a,b) simde_wasm_f64x2_make(b,a)
+#define v128_i8x16_extract_lane(a,n) simde_wasm_u8x16_extract_lane(a,15-(n))
+#define v128_u8x16_extract_lane(a,n) simde_wasm_u8x16_extract_lane(a,15-(n))
+#define v128_i16x8_extract_lane(a,n) simde_wasm_u16x8_extract_lane(a,7-(n))
+#define v128_u16x8_extract_lane(a,n) simde_wasm_u16x8_extract_lane(a,7-(n))
+#define v128_i32x4_extract_lane(a,n) simde_wasm_u32x4_extract_lane(a,3-(n))
+#define v128_u32x4_extract_lane(a,n) simde_wasm_u32x4_extract_lane(a,3-(n))
+#define v128_i64x2_extract_lane(a,n) simde_wasm_u64x2_extract_lane(a,1-(n))
+#define v128_u64x2_extract_lane(a,n) simde_wasm_u64x2_extract_lane(a,1-(n))
+#define v128_f32x4_extract_lane(a,n) simde_wasm_f32x4_extract_lane(a,3-(n))
+#define v128_f64x2_extract_lane(a,n) simde_wasm_f64x2_extract_lane(a,1-(n))
+#else
+#define v128_i8x16_make simde_wasm_i8x16_make
+#define v128_u8x16_make simde_wasm_u8x16_make
+#define v128_i16x8_make simde_wasm_i16x8_make
+#define v128_u16x8_make simde_wasm_u16x8_make
+#define v128_i32x4_make simde_wasm_i32x4_make
+#define v128_u32x4_make simde_wasm_u32x4_make
+#define v128_i64x2_make simde_wasm_i64x2_make
+#define v128_u64x2_make simde_wasm_u64x2_make
+#define v128_f32x4_make simde_wasm_f32x4_make
+#define v128_f64x2_make simde_wasm_f64x2_make
+// like is_equal_TYPE below, always use unsigned for these
+#define v128_i8x16_extract_lane simde_wasm_u8x16_extract_lane
+#define v128_u8x16_extract_lane simde_wasm_u8x16_extract_lane
+#define v128_i16x8_extract_lane simde_wasm_u16x8_extract_lane
+#define v128_u16x8_extract_lane simde_wasm_u16x8_extract_lane
+#define v128_i32x4_extract_lane simde_wasm_u32x4_extract_lane
+#define v128_u32x4_extract_lane simde_wasm_u32x4_extract_lane
+#define v128_i64x2_extract_lane simde_wasm_u64x2_extract_lane
+#define v128_u64x2_extract_lane simde_wasm_u64x2_extract_lane
+#define v128_f32x4_extract_lane simde_wasm_f32x4_extract_lane
+#define v128_f64x2_extract_lane simde_wasm_f64x2_extract_lane
+#endif
+
+static int g_tests_run;
+static int g_tests_passed;
+
+static void run_spec_tests(void);
+
+static void error(const char* file, int line, const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  fprintf(stderr, "%s:%d: assertion failed: ", file, line);
+  vfprintf(stderr, format, args);
+  va_end(args);
+}
+
+#define ASSERT_EXCEPTION(f)                                               \
+  do {                                                                    \
+    g_tests_run++;                                                        \
+    if (wasm_rt_impl_try() == WASM_RT_TRAP_UNCAUGHT_EXCEPTION) {          \
+      g_tests_passed++;                                                   \
+    } else {                                                              \
+      (void)(f);                                                          \
+      error(__FILE__, __LINE__, "expected " #f " to throw exception.\n"); \
+    }                                                                     \
+  } while (0)
+
+#define ASSERT_TRAP(f)                                         \
+  do {                                                         \
+    g_tests_run++;                                             \
+    if (wasm_rt_impl_try() != 0) {                             \
+      g_tests_passed++;                                        \
+    } else {                                                   \
+      (void)(f);                                               \
+      error(__FILE__, __LINE__, "expected " #f " to trap.\n"); \
+    }                                                          \
+  } while (0)
+
+#define ASSERT_EXHAUSTION(f)                                     \
+  do {                                                           \
+    g_tests_run++;                                               \
+    wasm_rt_trap_t code = wasm_rt_impl_try();                    \
+    switch (code) {                                              \
+      case WASM_RT_TRAP_NONE:                                    \
+        (void)(f);                                               \
+        error(__FILE__, __LINE__, "expected " #f " to trap.\n"); \
+        break;                                                   \
+      case WASM_RT_TRAP_EXHAUSTION:                              \
+        g_tests_passed++;                                        \
+        break;                                                   \
+      default:                                                   \
+        error(__FILE__, __LINE__,                                \
+              "expected " #f                                     \
+              " to trap due to exhaustion, got trap code %d.\n", \
+              code);                                             \
+        break;                                                   \
+    }                                                            \
+  } while (0)
+
+#define ASSERT_RETURN(f)                               \
+  do {                                                 \
+    g_tests_run++;                                     \
+    int trap_code = wasm_rt_impl_try();                \
+    if (trap_code) {                                   \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n", \
+            wasm_rt_strerror(trap_code));              \
+    } else {                                           \
+      f;                                               \
+      g_tests_passed++;                                \
+    }                                                  \
+  } while (0)
+
+#define ASSERT_RETURN_T(type, fmt, f, expected)                          \
+  do {                                                                   \
+    g_tests_run++;                                                       \
+    int trap_code = wasm_rt_impl_try();                                  \
+    if (trap_code) {                                                     \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                   \
+            wasm_rt_strerror(trap_code));                                \
+    } else {                                                             \
+      type actual = f;                                                   \
+      if (is_equal_##type(actual, expected)) {                           \
+        g_tests_passed++;                                                \
+      } else {                                                           \
+        error(__FILE__, __LINE__,                                        \
+              "in " #f ": expected %" fmt ", got %" fmt ".\n", expected, \
+              actual);                                                   \
+      }                                                                  \
+    }                                                                    \
+  } while (0)
+
+#define ASSERT_RETURN_FUNCREF(f, expected)                                \
+  do {                                                                    \
+    g_tests_run++;                                                        \
+    int trap_code = wasm_rt_impl_try();                                   \
+    if (trap_code) {                                                      \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                    \
+            wasm_rt_strerror(trap_code));                                 \
+    } else {                                                              \
+      wasm_rt_funcref_t actual = f;                                       \
+      if (is_equal_wasm_rt_funcref_t(actual, expected)) {                 \
+        g_tests_passed++;                                                 \
+      } else {                                                            \
+        error(__FILE__, __LINE__,                                         \
+              "in " #f ": mismatch between expected and actual funcref"); \
+      }                                                                   \
+    }                                                                     \
+  } while (0)
+
+#define ASSERT_RETURN_EXNREF(f, expected)                                \
+  do {                                                                   \
+    g_tests_run++;                                                       \
+    int trap_code = wasm_rt_impl_try();                                  \
+    if (trap_code) {                                                     \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                   \
+            wasm_rt_strerror(trap_code));                                \
+    } else {                                                             \
+      wasm_rt_exnref_t actual = f;                                       \
+      if (is_equal_wasm_rt_exnref_t(actual, expected)) {                 \
+        g_tests_passed++;                                                \
+      } else {                                                           \
+        error(__FILE__, __LINE__,                                        \
+              "in " #f ": mismatch between expected and actual exnref"); \
+      }                                                                  \
+    }                                                                    \
+  } while (0)
+
+#define ASSERT_RETURN_NAN_T(type, itype, fmt, f, kind)                        \
+  do {                                                                        \
+    g_tests_run++;                                                            \
+    int trap_code = wasm_rt_impl_try();                                       \
+    if (trap_code) {                                                          \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                        \
+            wasm_rt_strerror(trap_code));                                     \
+    } else {                                                                  \
+      type actual = f;                                                        \
+      itype iactual;                                                          \
+      memcpy(&iactual, &actual, sizeof(iactual));                             \
+      if (is_##kind##_nan_##type(iactual)) {                                  \
+        g_tests_passed++;                                                     \
+      } else {                                                                \
+        error(__FILE__, __LINE__,                                             \
+              "in " #f ": expected result to be a " #kind " nan, got 0x%" fmt \
+              ".\n",                                                          \
+              iactual);                                                       \
+      }                                                                       \
+    }                                                                         \
+  } while (0)
+
+#define MULTI_T_UNPACK_(...) __VA_ARGS__
+#define MULTI_T_UNPACK(arg) MULTI_T_UNPACK_ arg
+#define MULTI_i8 "%" PRIu8 " "
+#define MULTI_i16 "%" PRIu16 " "
+#define MULTI_i32 "%u "
+#define MULTI_i64 "%" PRIu64 " "
+#define MULTI_f32 "%.9g "
+#define MULTI_f64 "%.17g "
+#define MULTI_str "%s "
+#define ASSERT_RETURN_MULTI_T(type, fmt_expected, fmt_got, f, compare,        \
+                              expected, found)                                \
+  do {                                                                        \
+    g_tests_run++;                                                            \
+    int trap_code = wasm_rt_impl_try();                                       \
+    if (trap_code) {                                                          \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                        \
+            wasm_rt_strerror(trap_code));                                     \
+    } else {                                                                  \
+      type actual = f;                                                        \
+      if (compare) {                                                          \
+        g_tests_passed++;                                                     \
+      } else {                                                                \
+        error(__FILE__, __LINE__,                                             \
+              "in " #f ": expected <" fmt_expected ">, got <" fmt_got ">.\n", \
+              MULTI_T_UNPACK(expected), MULTI_T_UNPACK(found));               \
+      }                                                                       \
+    }                                                                         \
+  } while (0)
+
+
+#define ASSERT_RETURN_I32(f, expected) ASSERT_RETURN_T(u32, "u", f, expected)
+#define ASSERT_RETURN_I64(f, expected) ASSERT_RETURN_T(u64, PRIu64, f, expected)
+#define ASSERT_RETURN_F32(f, expected) ASSERT_RETURN_T(f32, ".9g", f, expected)
+#define ASSERT_RETURN_F64(f, expected) ASSERT_RETURN_T(f64, ".17g", f, expected)
+#define ASSERT_RETURN_EXTERNREF(f, expected) \
+  ASSERT_RETURN_T(wasm_rt_externref_t, "p", f, expected);
+
+#define ASSERT_RETURN_CANONICAL_NAN_F32(f) \
+  ASSERT_RETURN_NAN_T(f32, u32, "08x", f, canonical)
+#define ASSERT_RETURN_CANONICAL_NAN_F64(f) \
+  ASSERT_RETURN_NAN_T(f64, u64, "016x", f, canonical)
+#define ASSERT_RETURN_ARITHMETIC_NAN_F32(f) \
+  ASSERT_RETURN_NAN_T(f32, u32, "08x", f, arithmetic)
+#define ASSERT_RETURN_ARITHMETIC_NAN_F64(f) \
+  ASSERT_RETURN_NAN_T(f64, u64, "016x", f, arithmetic)
+
+static bool is_equal_u8(u8 x, u8 y) {
+  return x == y;
+}
+
+static bool is_equal_u16(u16 x, u16 y) {
+  return x == y;
+}
+
+static bool is_equal_u32(u32 x, u32 y) {
+  return x == y;
+}
+
+static bool is_equal_u64(u64 x, u64 y) {
+  return x == y;
+}
+
+#define is_equal_i8 is_equal_u8
+#define is_equal_i16 is_equal_u16
+#define is_equal_i32 is_equal_u32
+#define is_equal_i64 is_equal_u64
+
+static bool is_equal_wasm_rt_externref_t(wasm_rt_externref_t x,
+                                         wasm_rt_externref_t y) {
+  return x == y;
+}
+
+static inline bool is_equal_wasm_rt_func_type_t(const wasm_rt_func_type_t a,
+                                                const wasm_rt_func_type_t b) {
+  return (a == b) || (a && b && !memcmp(a, b, 32));
+}
+
+static bool is_equal_wasm_rt_funcref_t(wasm_rt_funcref_t x,
+                                       wasm_rt_funcref_t y) {
+  return is_equal_wasm_rt_func_type_t(x.func_type, y.func_type) &&
+         (x.func == y.func) && (x.module_instance == y.module_instance);
+}
+
+#ifdef WASM_EXN_MAX_SIZE
+static bool is_equal_wasm_rt_exnref_t(wasm_rt_exnref_t x, wasm_rt_exnref_t y) {
+  return x.tag == y.tag && x.size == y.size && !memcmp(x.data, y.data, x.size);
+}
+#endif
+
+wasm_rt_externref_t spectest_make_externref(uintptr_t x) {
+  return (wasm_rt_externref_t)(x + 1);  // externref(0) is not null
+}
+
+static u32 f32_bits(f32 x) {
+  u32 ux;
+  memcpy(&ux, &x, sizeof(ux));
+  return ux;
+}
+
+static u64 f64_bits(f64 x) {
+  u64 ux;
+  memcpy(&ux, &x, sizeof(ux));
+  return ux;
+}
+
+static bool is_equal_f32(f32 x, f32 y) {
+  return f32_bits(x) == f32_bits(y);
+}
+
+static bool is_equal_f64(f64 x, f64 y) {
+  return f64_bits(x) == f64_bits(y);
+}
+
+static f32 make_nan_f32(u32 x) {
+  x |= 0x7f800000;
+  f32 res;
+  memcpy(&res, &x, sizeof(res));
+  return res;
+}
+
+static f64 make_nan_f64(u64 x) {
+  x |= 0x7ff0000000000000;
+  f64 res;
+  memcpy(&res, &x, sizeof(res));
+  return res;
+}
+
+static bool is_canonical_nan_f32(u32 x) {
+  return (x & 0x7fffffff) == 0x7fc00000;
+}
+
+static bool is_canonical_nan_f64(u64 x) {
+  return (x & 0x7fffffffffffffff) == 0x7ff8000000000000;
+}
+
+static bool is_arithmetic_nan_f32(u32 x) {
+  return (x & 0x7fc00000) == 0x7fc00000;
+}
+
+static bool is_arithmetic_nan_f64(u64 x) {
+  return (x & 0x7ff8000000000000) == 0x7ff8000000000000;
+}
+
+typedef struct w2c_spectest {
+  wasm_rt_funcref_table_t spectest_table;
+  wasm_rt_funcref_table_t spectest_table64;
+  wasm_rt_memory_t spectest_memory;
+  uint32_t spectest_global_i32;
+  uint64_t spectest_global_i64;
+  float spectest_global_f32;
+  double spectest_global_f64;
+} w2c_spectest;
+
+static w2c_spectest spectest_instance;
+
+/*
+ * spectest implementations
+ */
+void w2c_spectest_print(w2c_spectest* instance) {
+  printf("spectest.print()\n");
+}
+
+void w2c_spectest_print_i32(w2c_spectest* instance, uint32_t i) {
+  printf("spectest.print_i32(%d)\n", i);
+}
+
+void w2c_spectest_print_i64(w2c_spectest* instance, uint64_t i) {
+  printf("spectest.print_i64(%" PRIu64 ")\n", i);
+}
+
+void w2c_spectest_print_f32(w2c_spectest* instance, float f) {
+  printf("spectest.print_f32(%g)\n", f);
+}
+
+void w2c_spectest_print_i32_f32(w2c_spectest* instance, uint32_t i, float f) {
+  printf("spectest.print_i32_f32(%d %g)\n", i, f);
+}
+
+void w2c_spectest_print_f64(w2c_spectest* instance, double d) {
+  printf("spectest.print_f64(%g)\n", d);
+}
+
+void w2c_spectest_print_f64_f64(w2c_spectest* instance, double d1, double d2) {
+  printf("spectest.print_f64_f64(%g %g)\n", d1, d2);
+}
+
+wasm_rt_funcref_table_t* w2c_spectest_table(w2c_spectest* instance) {
+  return &instance->spectest_table;
+}
+
+wasm_rt_funcref_table_t* w2c_spectest_table64(w2c_spectest* instance) {
+  return &instance->spectest_table64;
+}
+
+wasm_rt_memory_t* w2c_spectest_memory(w2c_spectest* instance) {
+  return &instance->spectest_memory;
+}
+
+uint32_t* w2c_spectest_global_i32(w2c_spectest* instance) {
+  return &instance->spectest_global_i32;
+}
+
+uint64_t* w2c_spectest_global_i64(w2c_spectest* instance) {
+  return &instance->spectest_global_i64;
+}
+
+float* w2c_spectest_global_f32(w2c_spectest* instance) {
+  return &instance->spectest_global_f32;
+}
+
+double* w2c_spectest_global_f64(w2c_spectest* instance) {
+  return &instance->spectest_global_f64;
+}
+
+static void init_spectest_module(w2c_spectest* instance) {
+  instance->spectest_global_i32 = 666;
+  instance->spectest_global_i64 = 666l;
+  instance->spectest_global_f32 = 666.6;
+  instance->spectest_global_f64 = 666.6;
+  wasm_rt_allocate_memory(&instance->spectest_memory, 1, 2, false,
+                          WASM_DEFAULT_PAGE_SIZE);
+  wasm_rt_allocate_funcref_table(&instance->spectest_table, 10, 20);
+  wasm_rt_allocate_funcref_table(&instance->spectest_table64, 10, 20);
+}
+
+// POSIX-only test config where embedder handles signals instead of w2c runtime
+#ifdef WASM2C_TEST_EMBEDDER_SIGNAL_HANDLING
+#include <signal.h>
+
+static void posix_signal_handler(int sig, siginfo_t* si, void* unused) {
+  wasm_rt_trap((si->si_code == SEGV_ACCERR) ? WASM_RT_TRAP_OOB
+                                            : WASM_RT_TRAP_EXHAUSTION);
+}
+
+static void posix_install_signal_handler(void) {
+  /* install altstack */
+  stack_t ss;
+  ss.ss_sp = malloc(SIGSTKSZ);
+  ss.ss_flags = 0;
+  ss.ss_size = SIGSTKSZ;
+  if (sigaltstack(&ss, NULL) != 0) {
+    perror("sigaltstack failed");
+    abort();
+  }
+
+  /* install signal handler */
+  struct sigaction sa;
+  memset(&sa, '\0', sizeof(sa));
+  sa.sa_flags = SA_SIGINFO | SA_ONSTACK;
+  sigemptyset(&sa.sa_mask);
+  sa.sa_sigaction = posix_signal_handler;
+  if (sigaction(SIGSEGV, &sa, NULL) != 0 || sigaction(SIGBUS, &sa, NULL) != 0) {
+    perror("sigaction failed");
+    abort();
+  }
+}
+
+static void posix_cleanup_signal_handler(void) {
+  /* remove signal handler */
+  struct sigaction sa;
+  memset(&sa, '\0', sizeof(sa));
+  sa.sa_handler = SIG_DFL;
+  if (sigaction(SIGSEGV, &sa, NULL) != 0 || sigaction(SIGBUS, &sa, NULL)) {
+    perror("sigaction failed");
+    abort();
+  }
+
+  /* disable and free altstack */
+  stack_t ss;
+  ss.ss_flags = SS_DISABLE;
+  if (sigaltstack(&ss, NULL) != 0) {
+    perror("sigaltstack failed");
+    abort();
+  }
+  free(ss.ss_sp);
+}
+#endif
+
+int main(int argc, char** argv) {
+#ifdef WASM2C_TEST_EMBEDDER_SIGNAL_HANDLING
+  posix_install_signal_handler();
+#endif
+  wasm_rt_init();
+  init_spectest_module(&spectest_instance);
+  run_spec_tests();
+  printf("%u/%u tests passed.\n", g_tests_passed, g_tests_run);
+  wasm_rt_free();
+#ifdef WASM2C_TEST_EMBEDDER_SIGNAL_HANDLING
+  posix_cleanup_signal_handler();
+#endif
+  return g_tests_passed != g_tests_run;
+}
+
+w2c_call__indirect__0__wasm call__indirect__0__wasm_instance;
+w2c_call__indirect__1__wasm call__indirect__1__wasm_instance;
+w2c_call__indirect__35__wasm call__indirect__35__wasm_instance;
+
+void run_spec_tests_0(void) {
+
+#line 3 "call_indirect.wast"
+wasm2c_call__indirect__0__wasm_instantiate(&call__indirect__0__wasm_instance);
+
+#line 479 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_type0x2Di32(&call__indirect__0__wasm_instance), 306u);
+
+#line 480 "call_indirect.wast"
+ASSERT_RETURN_I64(w2c_call__indirect__0__wasm_type0x2Di64(&call__indirect__0__wasm_instance), 356ull);
+
+#line 481 "call_indirect.wast"
+ASSERT_RETURN_F32(w2c_call__indirect__0__wasm_type0x2Df32(&call__indirect__0__wasm_instance), 3890.f);
+
+#line 482 "call_indirect.wast"
+ASSERT_RETURN_F64(w2c_call__indirect__0__wasm_type0x2Df64(&call__indirect__0__wasm_instance), 3940.0000000000000);
+
+#line 483 "call_indirect.wast"
+ASSERT_RETURN_MULTI_T(struct wasm_multi_di, MULTI_f64 MULTI_i32, MULTI_f64 MULTI_i32, w2c_call__indirect__0__wasm_type0x2Df640x2Di32(&call__indirect__0__wasm_instance), is_equal_f64(3940.0000000000000, actual.d0) && is_equal_i32(32u, actual.i1), (3940.0000000000000, 32u), (actual.d0, actual.i1));
+
+#line 485 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_type0x2Di320x2Dt64(&call__indirect__0__wasm_instance), 306u);
+
+#line 487 "call_indirect.wast"
+ASSERT_RETURN_I64(w2c_call__indirect__0__wasm_type0x2Dindex(&call__indirect__0__wasm_instance), 100ull);
+
+#line 489 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_type0x2Dfirst0x2Di32(&call__indirect__0__wasm_instance), 32u);
+
+#line 490 "call_indirect.wast"
+ASSERT_RETURN_I64(w2c_call__indirect__0__wasm_type0x2Dfirst0x2Di64(&call__indirect__0__wasm_instance), 64ull);
+
+#line 491 "call_indirect.wast"
+ASSERT_RETURN_F32(w2c_call__indirect__0__wasm_type0x2Dfirst0x2Df32(&call__indirect__0__wasm_instance), 1.32000005f);
+
+#line 492 "call_indirect.wast"
+ASSERT_RETURN_F64(w2c_call__indirect__0__wasm_type0x2Dfirst0x2Df64(&call__indirect__0__wasm_instance), 1.6399999999999999);
+
+#line 494 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_type0x2Dsecond0x2Di32(&call__indirect__0__wasm_instance), 32u);
+
+#line 495 "call_indirect.wast"
+ASSERT_RETURN_I64(w2c_call__indirect__0__wasm_type0x2Dsecond0x2Di64(&call__indirect__0__wasm_instance), 64ull);
+
+#line 496 "call_indirect.wast"
+ASSERT_RETURN_F32(w2c_call__indirect__0__wasm_type0x2Dsecond0x2Df32(&call__indirect__0__wasm_instance), 32.f);
+
+#line 497 "call_indirect.wast"
+ASSERT_RETURN_F64(w2c_call__indirect__0__wasm_type0x2Dsecond0x2Df64(&call__indirect__0__wasm_instance), 64.099999999999994);
+
+#line 499 "call_indirect.wast"
+ASSERT_RETURN_MULTI_T(struct wasm_multi_di, MULTI_f64 MULTI_i32, MULTI_f64 MULTI_i32, w2c_call__indirect__0__wasm_type0x2Dall0x2Df640x2Di32(&call__indirect__0__wasm_instance), is_equal_f64(3940.0000000000000, actual.d0) && is_equal_i32(32u, actual.i1), (3940.0000000000000, 32u), (actual.d0, actual.i1));
+
+#line 500 "call_indirect.wast"
+ASSERT_RETURN_MULTI_T(struct wasm_multi_id, MULTI_i32 MULTI_f64, MULTI_i32 MULTI_f64, w2c_call__indirect__0__wasm_type0x2Dall0x2Di320x2Df64(&call__indirect__0__wasm_instance), is_equal_i32(1u, actual.i0) && is_equal_f64(2.0000000000000000, actual.d1), (1u, 2.0000000000000000), (actual.i0, actual.d1));
+
+#line 501 "call_indirect.wast"
+ASSERT_RETURN_MULTI_T(struct wasm_multi_ji, MULTI_i64 MULTI_i32, MULTI_i64 MULTI_i32, w2c_call__indirect__0__wasm_type0x2Dall0x2Di320x2Di64(&call__indirect__0__wasm_instance), is_equal_i64(2ull, actual.j0) && is_equal_i32(1u, actual.i1), (2ull, 1u), (actual.j0, actual.i1));
+
+#line 503 "call_indirect.wast"
+ASSERT_RETURN_I64(w2c_call__indirect__0__wasm_dispatch(&call__indirect__0__wasm_instance, 5u, 2ull), 2ull);
+
+#line 504 "call_indirect.wast"
+ASSERT_RETURN_I64(w2c_call__indirect__0__wasm_dispatch(&call__indirect__0__wasm_instance, 5u, 5ull), 5ull);
+
+#line 505 "call_indirect.wast"
+ASSERT_RETURN_I64(w2c_call__indirect__0__wasm_dispatch(&call__indirect__0__wasm_instance, 12u, 5ull), 120ull);
+
+#line 506 "call_indirect.wast"
+ASSERT_RETURN_I64(w2c_call__indirect__0__wasm_dispatch(&call__indirect__0__wasm_instance, 13u, 5ull), 8ull);
+
+#line 507 "call_indirect.wast"
+ASSERT_RETURN_I64(w2c_call__indirect__0__wasm_dispatch(&call__indirect__0__wasm_instance, 20u, 2ull), 2ull);
+
+#line 508 "call_indirect.wast"
+ASSERT_TRAP(w2c_call__indirect__0__wasm_dispatch(&call__indirect__0__wasm_instance, 0u, 2ull));
+
+#line 509 "call_indirect.wast"
+ASSERT_TRAP(w2c_call__indirect__0__wasm_dispatch(&call__indirect__0__wasm_instance, 15u, 2ull));
+
+#line 510 "call_indirect.wast"
+ASSERT_TRAP(w2c_call__indirect__0__wasm_dispatch(&call__indirect__0__wasm_instance, 32u, 2ull));
+
+#line 511 "call_indirect.wast"
+ASSERT_TRAP(w2c_call__indirect__0__wasm_dispatch(&call__indirect__0__wasm_instance, 4294967295u, 2ull));
+
+#line 512 "call_indirect.wast"
+ASSERT_TRAP(w2c_call__indirect__0__wasm_dispatch(&call__indirect__0__wasm_instance, 1213432423u, 2ull));
+
+#line 514 "call_indirect.wast"
+ASSERT_RETURN_I64(w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Di64(&call__indirect__0__wasm_instance, 5u), 9ull);
+
+#line 515 "call_indirect.wast"
+ASSERT_RETURN_I64(w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Di64(&call__indirect__0__wasm_instance, 12u), 362880ull);
+
+#line 516 "call_indirect.wast"
+ASSERT_RETURN_I64(w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Di64(&call__indirect__0__wasm_instance, 13u), 55ull);
+
+#line 517 "call_indirect.wast"
+ASSERT_RETURN_I64(w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Di64(&call__indirect__0__wasm_instance, 20u), 9ull);
+
+#line 518 "call_indirect.wast"
+ASSERT_TRAP(w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Di64(&call__indirect__0__wasm_instance, 11u));
+
+#line 519 "call_indirect.wast"
+ASSERT_TRAP(w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Di64(&call__indirect__0__wasm_instance, 22u));
+
+#line 521 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Di32(&call__indirect__0__wasm_instance, 4u), 9u);
+
+#line 522 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Di32(&call__indirect__0__wasm_instance, 23u), 362880u);
+
+#line 523 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Di32(&call__indirect__0__wasm_instance, 26u), 55u);
+
+#line 524 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Di32(&call__indirect__0__wasm_instance, 19u), 9u);
+
+#line 525 "call_indirect.wast"
+ASSERT_TRAP(w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Di32(&call__indirect__0__wasm_instance, 9u));
+
+#line 526 "call_indirect.wast"
+ASSERT_TRAP(w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Di32(&call__indirect__0__wasm_instance, 21u));
+
+#line 528 "call_indirect.wast"
+ASSERT_RETURN_F32(w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Df32(&call__indirect__0__wasm_instance, 6u), 9.f);
+
+#line 529 "call_indirect.wast"
+ASSERT_RETURN_F32(w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Df32(&call__indirect__0__wasm_instance, 24u), 362880.f);
+
+#line 530 "call_indirect.wast"
+ASSERT_RETURN_F32(w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Df32(&call__indirect__0__wasm_instance, 27u), 55.f);
+
+#line 531 "call_indirect.wast"
+ASSERT_RETURN_F32(w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Df32(&call__indirect__0__wasm_instance, 21u), 9.f);
+
+#line 532 "call_indirect.wast"
+ASSERT_TRAP(w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Df32(&call__indirect__0__wasm_instance, 8u));
+
+#line 533 "call_indirect.wast"
+ASSERT_TRAP(w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Df32(&call__indirect__0__wasm_instance, 19u));
+
+#line 535 "call_indirect.wast"
+ASSERT_RETURN_F64(w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Df64(&call__indirect__0__wasm_instance, 7u), 9.0000000000000000);
+
+#line 536 "call_indirect.wast"
+ASSERT_RETURN_F64(w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Df64(&call__indirect__0__wasm_instance, 25u), 362880.00000000000);
+
+#line 537 "call_indirect.wast"
+ASSERT_RETURN_F64(w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Df64(&call__indirect__0__wasm_instance, 28u), 55.000000000000000);
+
+#line 538 "call_indirect.wast"
+ASSERT_RETURN_F64(w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Df64(&call__indirect__0__wasm_instance, 22u), 9.0000000000000000);
+
+#line 539 "call_indirect.wast"
+ASSERT_TRAP(w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Df64(&call__indirect__0__wasm_instance, 10u));
+
+#line 540 "call_indirect.wast"
+ASSERT_TRAP(w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Df64(&call__indirect__0__wasm_instance, 18u));
+
+#line 542 "call_indirect.wast"
+ASSERT_RETURN_I64(w2c_call__indirect__0__wasm_fac0x2Di64(&call__indirect__0__wasm_instance, 0ull), 1ull);
+
+#line 543 "call_indirect.wast"
+ASSERT_RETURN_I64(w2c_call__indirect__0__wasm_fac0x2Di64(&call__indirect__0__wasm_instance, 1ull), 1ull);
+
+#line 544 "call_indirect.wast"
+ASSERT_RETURN_I64(w2c_call__indirect__0__wasm_fac0x2Di64(&call__indirect__0__wasm_instance, 5ull), 120ull);
+
+#line 545 "call_indirect.wast"
+ASSERT_RETURN_I64(w2c_call__indirect__0__wasm_fac0x2Di64(&call__indirect__0__wasm_instance, 25ull), 7034535277573963776ull);
+
+#line 547 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_fac0x2Di32(&call__indirect__0__wasm_instance, 0u), 1u);
+
+#line 548 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_fac0x2Di32(&call__indirect__0__wasm_instance, 1u), 1u);
+
+#line 549 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_fac0x2Di32(&call__indirect__0__wasm_instance, 5u), 120u);
+
+#line 550 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_fac0x2Di32(&call__indirect__0__wasm_instance, 10u), 3628800u);
+
+#line 552 "call_indirect.wast"
+ASSERT_RETURN_F32(w2c_call__indirect__0__wasm_fac0x2Df32(&call__indirect__0__wasm_instance, 0.f), 1.f);
+
+#line 553 "call_indirect.wast"
+ASSERT_RETURN_F32(w2c_call__indirect__0__wasm_fac0x2Df32(&call__indirect__0__wasm_instance, 1.f), 1.f);
+
+#line 554 "call_indirect.wast"
+ASSERT_RETURN_F32(w2c_call__indirect__0__wasm_fac0x2Df32(&call__indirect__0__wasm_instance, 5.f), 120.f);
+
+#line 555 "call_indirect.wast"
+ASSERT_RETURN_F32(w2c_call__indirect__0__wasm_fac0x2Df32(&call__indirect__0__wasm_instance, 10.f), 3628800.f);
+
+#line 557 "call_indirect.wast"
+ASSERT_RETURN_F64(w2c_call__indirect__0__wasm_fac0x2Df64(&call__indirect__0__wasm_instance, 0.0000000000000000), 1.0000000000000000);
+
+#line 558 "call_indirect.wast"
+ASSERT_RETURN_F64(w2c_call__indirect__0__wasm_fac0x2Df64(&call__indirect__0__wasm_instance, 1.0000000000000000), 1.0000000000000000);
+
+#line 559 "call_indirect.wast"
+ASSERT_RETURN_F64(w2c_call__indirect__0__wasm_fac0x2Df64(&call__indirect__0__wasm_instance, 5.0000000000000000), 120.00000000000000);
+
+#line 560 "call_indirect.wast"
+ASSERT_RETURN_F64(w2c_call__indirect__0__wasm_fac0x2Df64(&call__indirect__0__wasm_instance, 10.000000000000000), 3628800.0000000000);
+
+#line 562 "call_indirect.wast"
+ASSERT_RETURN_I64(w2c_call__indirect__0__wasm_fib0x2Di64(&call__indirect__0__wasm_instance, 0ull), 1ull);
+
+#line 563 "call_indirect.wast"
+ASSERT_RETURN_I64(w2c_call__indirect__0__wasm_fib0x2Di64(&call__indirect__0__wasm_instance, 1ull), 1ull);
+
+#line 564 "call_indirect.wast"
+ASSERT_RETURN_I64(w2c_call__indirect__0__wasm_fib0x2Di64(&call__indirect__0__wasm_instance, 2ull), 2ull);
+
+#line 565 "call_indirect.wast"
+ASSERT_RETURN_I64(w2c_call__indirect__0__wasm_fib0x2Di64(&call__indirect__0__wasm_instance, 5ull), 8ull);
+
+#line 566 "call_indirect.wast"
+ASSERT_RETURN_I64(w2c_call__indirect__0__wasm_fib0x2Di64(&call__indirect__0__wasm_instance, 20ull), 10946ull);
+
+#line 568 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_fib0x2Di32(&call__indirect__0__wasm_instance, 0u), 1u);
+
+#line 569 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_fib0x2Di32(&call__indirect__0__wasm_instance, 1u), 1u);
+
+#line 570 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_fib0x2Di32(&call__indirect__0__wasm_instance, 2u), 2u);
+
+#line 571 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_fib0x2Di32(&call__indirect__0__wasm_instance, 5u), 8u);
+
+#line 572 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_fib0x2Di32(&call__indirect__0__wasm_instance, 20u), 10946u);
+
+#line 574 "call_indirect.wast"
+ASSERT_RETURN_F32(w2c_call__indirect__0__wasm_fib0x2Df32(&call__indirect__0__wasm_instance, 0.f), 1.f);
+
+#line 575 "call_indirect.wast"
+ASSERT_RETURN_F32(w2c_call__indirect__0__wasm_fib0x2Df32(&call__indirect__0__wasm_instance, 1.f), 1.f);
+
+#line 576 "call_indirect.wast"
+ASSERT_RETURN_F32(w2c_call__indirect__0__wasm_fib0x2Df32(&call__indirect__0__wasm_instance, 2.f), 2.f);
+
+#line 577 "call_indirect.wast"
+ASSERT_RETURN_F32(w2c_call__indirect__0__wasm_fib0x2Df32(&call__indirect__0__wasm_instance, 5.f), 8.f);
+
+#line 578 "call_indirect.wast"
+ASSERT_RETURN_F32(w2c_call__indirect__0__wasm_fib0x2Df32(&call__indirect__0__wasm_instance, 20.f), 10946.f);
+
+#line 580 "call_indirect.wast"
+ASSERT_RETURN_F64(w2c_call__indirect__0__wasm_fib0x2Df64(&call__indirect__0__wasm_instance, 0.0000000000000000), 1.0000000000000000);
+
+#line 581 "call_indirect.wast"
+ASSERT_RETURN_F64(w2c_call__indirect__0__wasm_fib0x2Df64(&call__indirect__0__wasm_instance, 1.0000000000000000), 1.0000000000000000);
+
+#line 582 "call_indirect.wast"
+ASSERT_RETURN_F64(w2c_call__indirect__0__wasm_fib0x2Df64(&call__indirect__0__wasm_instance, 2.0000000000000000), 2.0000000000000000);
+
+#line 583 "call_indirect.wast"
+ASSERT_RETURN_F64(w2c_call__indirect__0__wasm_fib0x2Df64(&call__indirect__0__wasm_instance, 5.0000000000000000), 8.0000000000000000);
+
+#line 584 "call_indirect.wast"
+ASSERT_RETURN_F64(w2c_call__indirect__0__wasm_fib0x2Df64(&call__indirect__0__wasm_instance, 20.000000000000000), 10946.000000000000);
+
+#line 586 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_even(&call__indirect__0__wasm_instance, 0u), 44u);
+
+#line 587 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_even(&call__indirect__0__wasm_instance, 1u), 99u);
+
+#line 588 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_even(&call__indirect__0__wasm_instance, 100u), 44u);
+
+#line 589 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_even(&call__indirect__0__wasm_instance, 77u), 99u);
+
+#line 590 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_odd(&call__indirect__0__wasm_instance, 0u), 99u);
+
+#line 591 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_odd(&call__indirect__0__wasm_instance, 1u), 44u);
+
+#line 592 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_odd(&call__indirect__0__wasm_instance, 200u), 99u);
+
+#line 593 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_odd(&call__indirect__0__wasm_instance, 77u), 44u);
+
+#line 595 "call_indirect.wast"
+ASSERT_EXHAUSTION(w2c_call__indirect__0__wasm_runaway(&call__indirect__0__wasm_instance));
+
+#line 596 "call_indirect.wast"
+ASSERT_EXHAUSTION(w2c_call__indirect__0__wasm_mutual0x2Drunaway(&call__indirect__0__wasm_instance));
+
+#line 598 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_as0x2Dselect0x2Dfirst(&call__indirect__0__wasm_instance), 306u);
+
+#line 599 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_as0x2Dselect0x2Dmid(&call__indirect__0__wasm_instance), 2u);
+
+#line 600 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_as0x2Dselect0x2Dlast(&call__indirect__0__wasm_instance), 2u);
+
+#line 602 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_as0x2Dif0x2Dcondition(&call__indirect__0__wasm_instance), 1u);
+
+#line 604 "call_indirect.wast"
+ASSERT_RETURN_I64(w2c_call__indirect__0__wasm_as0x2Dbr_if0x2Dfirst(&call__indirect__0__wasm_instance), 356ull);
+
+#line 605 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_as0x2Dbr_if0x2Dlast(&call__indirect__0__wasm_instance), 2u);
+
+#line 607 "call_indirect.wast"
+ASSERT_RETURN_F32(w2c_call__indirect__0__wasm_as0x2Dbr_table0x2Dfirst(&call__indirect__0__wasm_instance), 3890.f);
+
+#line 608 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_as0x2Dbr_table0x2Dlast(&call__indirect__0__wasm_instance), 2u);
+
+#line 610 "call_indirect.wast"
+ASSERT_RETURN(w2c_call__indirect__0__wasm_as0x2Dstore0x2Dfirst(&call__indirect__0__wasm_instance));
+
+#line 611 "call_indirect.wast"
+ASSERT_RETURN(w2c_call__indirect__0__wasm_as0x2Dstore0x2Dlast(&call__indirect__0__wasm_instance));
+
+#line 613 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_as0x2Dmemory0x2Egrow0x2Dvalue(&call__indirect__0__wasm_instance), 1u);
+
+#line 614 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_as0x2Dreturn0x2Dvalue(&call__indirect__0__wasm_instance), 1u);
+
+#line 615 "call_indirect.wast"
+ASSERT_RETURN(w2c_call__indirect__0__wasm_as0x2Ddrop0x2Doperand(&call__indirect__0__wasm_instance));
+
+#line 616 "call_indirect.wast"
+ASSERT_RETURN_F32(w2c_call__indirect__0__wasm_as0x2Dbr0x2Dvalue(&call__indirect__0__wasm_instance), 1.f);
+
+#line 617 "call_indirect.wast"
+ASSERT_RETURN_F64(w2c_call__indirect__0__wasm_as0x2Dlocal0x2Eset0x2Dvalue(&call__indirect__0__wasm_instance), 1.0000000000000000);
+
+#line 618 "call_indirect.wast"
+ASSERT_RETURN_F64(w2c_call__indirect__0__wasm_as0x2Dlocal0x2Etee0x2Dvalue(&call__indirect__0__wasm_instance), 1.0000000000000000);
+
+#line 619 "call_indirect.wast"
+ASSERT_RETURN_F64(w2c_call__indirect__0__wasm_as0x2Dglobal0x2Eset0x2Dvalue(&call__indirect__0__wasm_instance), 1.0000000000000000);
+
+#line 620 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_as0x2Dload0x2Doperand(&call__indirect__0__wasm_instance), 1u);
+
+#line 622 "call_indirect.wast"
+ASSERT_RETURN_F32(w2c_call__indirect__0__wasm_as0x2Dunary0x2Doperand(&call__indirect__0__wasm_instance), 0.f);
+
+#line 623 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_as0x2Dbinary0x2Dleft(&call__indirect__0__wasm_instance), 11u);
+
+#line 624 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_as0x2Dbinary0x2Dright(&call__indirect__0__wasm_instance), 9u);
+
+#line 625 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_as0x2Dtest0x2Doperand(&call__indirect__0__wasm_instance), 0u);
+
+#line 626 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_as0x2Dcompare0x2Dleft(&call__indirect__0__wasm_instance), 1u);
+
+#line 627 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__0__wasm_as0x2Dcompare0x2Dright(&call__indirect__0__wasm_instance), 1u);
+
+#line 628 "call_indirect.wast"
+ASSERT_RETURN_I64(w2c_call__indirect__0__wasm_as0x2Dconvert0x2Doperand(&call__indirect__0__wasm_instance), 1ull);
+
+#line 633 "call_indirect.wast"
+wasm2c_call__indirect__1__wasm_instantiate(&call__indirect__1__wasm_instance);
+
+#line 660 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__1__wasm_call0x2D1(&call__indirect__1__wasm_instance, 2u, 3u, 0u), 5u);
+
+#line 661 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__1__wasm_call0x2D1(&call__indirect__1__wasm_instance, 2u, 3u, 1u), 4294967295u);
+
+#line 662 "call_indirect.wast"
+ASSERT_TRAP(w2c_call__indirect__1__wasm_call0x2D1(&call__indirect__1__wasm_instance, 2u, 3u, 2u));
+
+#line 664 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__1__wasm_call0x2D2(&call__indirect__1__wasm_instance, 2u, 3u, 0u), 6u);
+
+#line 665 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__1__wasm_call0x2D2(&call__indirect__1__wasm_instance, 2u, 3u, 1u), 0u);
+
+#line 666 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__1__wasm_call0x2D2(&call__indirect__1__wasm_instance, 2u, 3u, 2u), 2u);
+
+#line 667 "call_indirect.wast"
+ASSERT_TRAP(w2c_call__indirect__1__wasm_call0x2D2(&call__indirect__1__wasm_instance, 2u, 3u, 3u));
+
+#line 669 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__1__wasm_call0x2D3(&call__indirect__1__wasm_instance, 2u, 3u, 0u), 4294967295u);
+
+#line 670 "call_indirect.wast"
+ASSERT_RETURN_I32(w2c_call__indirect__1__wasm_call0x2D3(&call__indirect__1__wasm_instance, 2u, 3u, 1u), 6u);
+
+#line 671 "call_indirect.wast"
+ASSERT_TRAP(w2c_call__indirect__1__wasm_call0x2D3(&call__indirect__1__wasm_instance, 2u, 3u, 2u));
+
+#line 672 "call_indirect.wast"
+ASSERT_TRAP(w2c_call__indirect__1__wasm_call0x2D3(&call__indirect__1__wasm_instance, 2u, 3u, 3u));
+
+#line 673 "call_indirect.wast"
+ASSERT_TRAP(w2c_call__indirect__1__wasm_call0x2D3(&call__indirect__1__wasm_instance, 2u, 3u, 4u));
+
+#line 1034 "call_indirect.wast"
+wasm2c_call__indirect__35__wasm_instantiate(&call__indirect__35__wasm_instance);
+
+
+}
+
+void run_spec_tests(void) {
+
+run_spec_tests_0();
+wasm2c_call__indirect__0__wasm_free(&call__indirect__0__wasm_instance);
+wasm2c_call__indirect__1__wasm_free(&call__indirect__1__wasm_instance);
+wasm2c_call__indirect__35__wasm_free(&call__indirect__35__wasm_instance);
+
+}
@@ -0,0 +1,3978 @@
+/* Automatically generated by wasm2c */
+#include <assert.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <string.h>
+#if defined(__MINGW32__)
+#include <malloc.h>
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#include <malloc.h>
+#define alloca _alloca
+#elif defined(__FreeBSD__) || defined(__OpenBSD__)
+#include <stdlib.h>
+#else
+#include <alloca.h>
+#endif
+
+#include "call_indirect.0.h"
+#define IS_SINGLE_UNSHARED_DEFAULT32_MEMORY 1
+
+// Computes a pointer to an object of the given size in a little-endian memory.
+//
+// On a little-endian host, this is just &mem->data[addr] - the object's size is
+// unused. On a big-endian host, it's &mem->data[mem->size - addr - n], where n
+// is the object's size.
+//
+// Note that mem may be evaluated multiple times.
+//
+// Parameters:
+// mem - The memory.
+// addr - The address.
+// n - The size of the object.
+//
+// Result:
+// A pointer for an object of size n.
+#if WABT_BIG_ENDIAN
+#define MEM_ADDR(mem, addr, n) ((mem)->data_end - (addr) - (n))
+#else
+#define MEM_ADDR(mem, addr, n) &((mem)->data[addr])
+#endif
+
+// We can only use Segue for this module if it uses a single unshared,
+// default-page, 32-bit imported or exported memory.
+#if WASM_RT_USE_SEGUE && IS_SINGLE_UNSHARED_DEFAULT32_MEMORY
+#define WASM_RT_USE_SEGUE_FOR_THIS_MODULE 1
+#else
+#define WASM_RT_USE_SEGUE_FOR_THIS_MODULE 0
+#endif
+
+#ifndef WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE
+#define WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE 1
+#endif
+
+#if WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE && WASM_RT_USE_MMAP && \
+    IS_SINGLE_UNSHARED_DEFAULT32_MEMORY && !WABT_BIG_ENDIAN
+#define WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE_FOR_THIS_MODULE 1
+#else
+#define WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE_FOR_THIS_MODULE 0
+#endif
+
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+// POSIX uses FS for TLS, GS is free
+static inline void* wasm_rt_segue_read_base() {
+  if (wasm_rt_fsgsbase_inst_supported) {
+    return (void*)__builtin_ia32_rdgsbase64();
+  } else {
+    return wasm_rt_syscall_get_segue_base();
+  }
+}
+static inline void wasm_rt_segue_write_base(void* base) {
+#if WASM_RT_SEGUE_FREE_SEGMENT
+  if (wasm_rt_last_segment_val == base) {
+    return;
+  }
+
+  wasm_rt_last_segment_val = base;
+#endif
+
+  if (wasm_rt_fsgsbase_inst_supported) {
+    __builtin_ia32_wrgsbase64((uintptr_t)base);
+  } else {
+    wasm_rt_syscall_set_segue_base(base);
+  }
+}
+#define MEM_ADDR_MEMOP(mem, addr, n) ((uint8_t __seg_gs*)(uintptr_t)addr)
+#elif WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE_FOR_THIS_MODULE
+#define MEM_ADDR_MEMOP(mem, addr, n) (&wasm_rt_local_memory_base[(addr)])
+#else
+#define MEM_ADDR_MEMOP(mem, addr, n) MEM_ADDR(mem, addr, n)
+#endif
+
+#define TRAP(x) (wasm_rt_trap(WASM_RT_TRAP_##x), 0)
+
+#if WASM_RT_STACK_DEPTH_COUNT
+#define FUNC_PROLOGUE                                            \
+  if (++wasm_rt_call_stack_depth > WASM_RT_MAX_CALL_STACK_DEPTH) \
+    TRAP(EXHAUSTION);
+
+#define FUNC_EPILOGUE --wasm_rt_call_stack_depth
+#else
+#define FUNC_PROLOGUE
+
+#define FUNC_EPILOGUE
+#endif
+
+#define UNREACHABLE TRAP(UNREACHABLE)
+
+#if defined(__clang__) || defined(__GNUC__)
+#define W2C_COLD_FUNC __attribute__((noinline, cold))
+#elif defined(_MSC_VER)
+#define W2C_COLD_FUNC __declspec(noinline)
+#else
+#define W2C_COLD_FUNC
+#endif
+
+W2C_COLD_FUNC static bool func_types_eq_slowpath(
+    const wasm_rt_funcref_table_t* table,
+    const wasm_rt_func_type_t expected_type,
+    uint32_t index) {
+  const size_t sha256size = 32;
+  if (index >= table->size) {
+    // Table index out of bounds. Raise Wasm trap.
+    TRAP(CALL_INDIRECT);
+    return false;
+  }
+  const wasm_rt_funcref_t* const func_ref = &table->data[index];
+  if (!expected_type || !func_ref->func || !func_ref->func_type ||
+      memcmp(expected_type, func_ref->func_type, sha256size) != 0) {
+    // Type check failed. Raise Wasm trap.
+    TRAP(CALL_INDIRECT);
+    return false;
+  }
+  return true;
+}
+
+#define CHECK_CALL_INDIRECT(table, ft, x)                       \
+  (LIKELY((x) < table.size && ft == table.data[x].func_type) || \
+   func_types_eq_slowpath(&(table), ft, x))
+
+#define DO_CALL_INDIRECT(table, t, x, ...) ((t)table.data[x].func)(__VA_ARGS__)
+
+#define CALL_INDIRECT(table, t, ft, x, ...) \
+  (CHECK_CALL_INDIRECT(table, ft, x),       \
+   DO_CALL_INDIRECT(table, t, x, __VA_ARGS__))
+
+static inline uint64_t checked_add_u64(uint64_t a, uint64_t b) {
+  uint64_t ret;
+#if __has_builtin(__builtin_add_overflow)
+  if (__builtin_add_overflow(a, b, &ret))
+    TRAP(OOB);
+#elif defined(_MSC_VER)
+  if (_addcarry_u64(0, a, b, &ret))
+    TRAP(OOB);
+#else
+  ret = a + b;
+  if (ret < a)
+    TRAP(OOB);
+#endif
+  return ret;
+}
+
+#define RANGE_CHECK(mem, offset, len)            \
+  do {                                           \
+    uint64_t res = checked_add_u64(offset, len); \
+    if (UNLIKELY(res > (mem)->size))             \
+      TRAP(OOB);                                 \
+  } while (0);
+
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && WASM_RT_SANITY_CHECKS
+#include <stdio.h>
+#define WASM_RT_CHECK_BASE(mem)                                               \
+  if (((uintptr_t)((mem)->data)) != ((uintptr_t)wasm_rt_segue_read_base())) { \
+    puts("Segment register mismatch\n");                                      \
+    abort();                                                                  \
+  }
+#else
+#define WASM_RT_CHECK_BASE(mem)
+#endif
+
+// MEMCHECK_DEFAULT32 is an "accelerated" MEMCHECK used only for
+// default-page-size, 32-bit memories. It may do nothing at all
+// (if hardware bounds-checking is enabled via guard pages)
+// or it may do a slightly faster RANGE_CHECK.
+#if WASM_RT_MEMCHECK_GUARD_PAGES
+#define MEMCHECK_DEFAULT32(mem, local_memory_size, a, t) \
+  WASM_RT_CHECK_BASE(mem);
+#else
+#if WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE_FOR_THIS_MODULE
+#define MEMCHECK_DEFAULT32(mem, local_memory_size, a, t)     \
+  WASM_RT_CHECK_BASE(mem);                                   \
+  if (UNLIKELY(a + (uint64_t)sizeof(t) > local_memory_size)) \
+    TRAP(OOB);
+#else
+#define MEMCHECK_DEFAULT32(mem, local_memory_size, a, t) \
+  WASM_RT_CHECK_BASE(mem);                               \
+  if (UNLIKELY(a + (uint64_t)sizeof(t) > mem->size))     \
+    TRAP(OOB);
+#endif
+#endif
+
+// MEMCHECK_GENERAL can be used for any memory
+#define MEMCHECK_GENERAL(mem, a, t) \
+  WASM_RT_CHECK_BASE(mem);          \
+  RANGE_CHECK(mem, a, sizeof(t));
+
+// When using guard pages, reads have to be immediately consumed so that OOB
+// trap checks are applied in the right place, and not optimized away. This is
+// done using FORCE_READ_INT/FORCE_READ_FLOAT
+#if WASM_RT_MEMCHECK_BOUNDS_CHECK || \
+    WASM_RT_NONCONFORMING_ALLOW_OOB_READ_ELIMINATION
+#define FORCE_READ_INT(var)
+#define FORCE_READ_FLOAT(var)
+#elif defined(__GNUC__) && WASM_RT_MEMCHECK_GUARD_PAGES
+#define FORCE_READ_INT(var) __asm__("" ::"r"(var))
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define FORCE_READ_FLOAT_CONSTRAINT "x"
+#elif defined(__aarch64__) && defined(__ARM_FP) && ((__ARM_FP & 0x4) != 0)
+#define FORCE_READ_FLOAT_CONSTRAINT "w"
+#elif defined(__mips__) && defined(__clang__) && !defined(__mips_soft_float)
+// Clang before v18 uses hard floats which has a different constraint
+#define FORCE_READ_FLOAT_CONSTRAINT "f"
+#elif (defined(__powerpc__) || defined(__ppc__) || defined(__PPC__)) && \
+    !(defined(_SOFT_FLOAT) || defined(__NO_FPRS__))
+#define FORCE_READ_FLOAT_CONSTRAINT "f"
+#elif defined(__riscv) && defined(__riscv_flen) && (__riscv_flen >= 32)
+#define FORCE_READ_FLOAT_CONSTRAINT "f"
+#elif defined(__s390__) || defined(__s390x__)
+#define FORCE_READ_FLOAT_CONSTRAINT "f"
+#else
+#define FORCE_READ_FLOAT_CONSTRAINT "r"
+#endif
+
+#define FORCE_READ_FLOAT(var) __asm__("" ::FORCE_READ_FLOAT_CONSTRAINT(var))
+#else
+#error \
+    "Guard page mode for Wasm not supported on this platform because FORCE_READ_INT/FORCE_READ_FLOAT could not be instantiated." \
+   "Either enable specify -DWASM_RT_NONCONFORMING_ALLOW_OOB_READ_ELIMINATION=1 during compilation or use -DWASM_RT_MEMCHECK_BOUNDS_CHECK=1 to use bounds check mode"
+#endif
+
+static inline void load_data(u8* dest, const u8* src, size_t n) {
+  if (!n) {
+    return;
+  }
+#if WABT_BIG_ENDIAN
+  for (size_t i = 0; i < n; i++) {
+    dest[i] = src[n - i - 1];
+  }
+#else
+  wasm_rt_memcpy(dest, src, n);
+#endif
+}
+
+#define LOAD_DATA(m, o, i, s)            \
+  do {                                   \
+    RANGE_CHECK((&m), o, s);             \
+    load_data(MEM_ADDR(&m, o, s), i, s); \
+  } while (0)
+
+#define DEF_MEM_CHECKS0(name, shared, mem_type, ret_kw, return_type)         \
+  static inline return_type name##_default32(                                \
+      uint8_t* const wasm_rt_local_memory_base,                              \
+      uint64_t wasm_rt_local_memory_size, wasm_rt##shared##memory_t* mem,    \
+      u64 addr) {                                                            \
+    MEMCHECK_DEFAULT32(mem, wasm_rt_local_memory_size, addr, mem_type);      \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr);           \
+  }                                                                          \
+  static inline return_type name(uint8_t* const wasm_rt_local_memory_base,   \
+                                 uint64_t wasm_rt_local_memory_size,         \
+                                 wasm_rt##shared##memory_t* mem, u64 addr) { \
+    MEMCHECK_GENERAL(mem, addr, mem_type);                                   \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr);           \
+  }
+
+#define DEF_MEM_CHECKS1(name, shared, mem_type, ret_kw, return_type,       \
+                        val_type1)                                         \
+  static inline return_type name##_default32(                              \
+      uint8_t* const wasm_rt_local_memory_base,                            \
+      uint64_t wasm_rt_local_memory_size, wasm_rt##shared##memory_t* mem,  \
+      u64 addr, val_type1 val1) {                                          \
+    MEMCHECK_DEFAULT32(mem, wasm_rt_local_memory_size, addr, mem_type);    \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr, val1);   \
+  }                                                                        \
+  static inline return_type name(uint8_t* const wasm_rt_local_memory_base, \
+                                 uint64_t wasm_rt_local_memory_size,       \
+                                 wasm_rt##shared##memory_t* mem, u64 addr, \
+                                 val_type1 val1) {                         \
+    MEMCHECK_GENERAL(mem, addr, mem_type);                                 \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr, val1);   \
+  }
+
+#define DEF_MEM_CHECKS2(name, shared, mem_type, ret_kw, return_type,           \
+                        val_type1, val_type2)                                  \
+  static inline return_type name##_default32(                                  \
+      uint8_t* const wasm_rt_local_memory_base,                                \
+      uint64_t wasm_rt_local_memory_size, wasm_rt##shared##memory_t* mem,      \
+      u64 addr, val_type1 val1, val_type2 val2) {                              \
+    MEMCHECK_DEFAULT32(mem, wasm_rt_local_memory_size, addr, mem_type);        \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr, val1, val2); \
+  }                                                                            \
+  static inline return_type name(uint8_t* const wasm_rt_local_memory_base,     \
+                                 uint64_t wasm_rt_local_memory_size,           \
+                                 wasm_rt##shared##memory_t* mem, u64 addr,     \
+                                 val_type1 val1, val_type2 val2) {             \
+    MEMCHECK_GENERAL(mem, addr, mem_type);                                     \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr, val1, val2); \
+  }
+
+#define DEFINE_LOAD(name, t1, t2, t3, force_read)                             \
+  static inline t3 name##_unchecked(uint8_t* const wasm_rt_local_memory_base, \
+                                    wasm_rt_memory_t* mem, u64 addr) {        \
+    t1 result;                                                                \
+    wasm_rt_memcpy(&result, MEM_ADDR_MEMOP(mem, addr, sizeof(t1)),            \
+                   sizeof(t1));                                               \
+    t3 ret = (t3)(t2)result;                                                  \
+    force_read(ret);                                                          \
+    return ret;                                                               \
+  }                                                                           \
+  DEF_MEM_CHECKS0(name, _, t1, return, t3)
+
+#define DEFINE_STORE(name, t1, t2)                                     \
+  static inline void name##_unchecked(                                 \
+      uint8_t* const wasm_rt_local_memory_base, wasm_rt_memory_t* mem, \
+      u64 addr, t2 value) {                                            \
+    t1 wrapped = (t1)value;                                            \
+    wasm_rt_memcpy(MEM_ADDR_MEMOP(mem, addr, sizeof(t1)), &wrapped,    \
+                   sizeof(t1));                                        \
+  }                                                                    \
+  DEF_MEM_CHECKS1(name, _, t1, , void, t2)
+
+DEFINE_LOAD(i32_load, u32, u32, u32, FORCE_READ_INT)
+DEFINE_LOAD(i64_load, u64, u64, u64, FORCE_READ_INT)
+DEFINE_LOAD(f32_load, f32, f32, f32, FORCE_READ_FLOAT)
+DEFINE_LOAD(f64_load, f64, f64, f64, FORCE_READ_FLOAT)
+DEFINE_LOAD(i32_load8_s, s8, s32, u32, FORCE_READ_INT)
+DEFINE_LOAD(i64_load8_s, s8, s64, u64, FORCE_READ_INT)
+DEFINE_LOAD(i32_load8_u, u8, u32, u32, FORCE_READ_INT)
+DEFINE_LOAD(i64_load8_u, u8, u64, u64, FORCE_READ_INT)
+DEFINE_LOAD(i32_load16_s, s16, s32, u32, FORCE_READ_INT)
+DEFINE_LOAD(i64_load16_s, s16, s64, u64, FORCE_READ_INT)
+DEFINE_LOAD(i32_load16_u, u16, u32, u32, FORCE_READ_INT)
+DEFINE_LOAD(i64_load16_u, u16, u64, u64, FORCE_READ_INT)
+DEFINE_LOAD(i64_load32_s, s32, s64, u64, FORCE_READ_INT)
+DEFINE_LOAD(i64_load32_u, u32, u64, u64, FORCE_READ_INT)
+DEFINE_STORE(i32_store, u32, u32)
+DEFINE_STORE(i64_store, u64, u64)
+DEFINE_STORE(f32_store, f32, f32)
+DEFINE_STORE(f64_store, f64, f64)
+DEFINE_STORE(i32_store8, u8, u32)
+DEFINE_STORE(i32_store16, u16, u32)
+DEFINE_STORE(i64_store8, u8, u64)
+DEFINE_STORE(i64_store16, u16, u64)
+DEFINE_STORE(i64_store32, u32, u64)
+
+#if defined(_MSC_VER)
+
+// Adapted from
+// https://github.com/nemequ/portable-snippets/blob/master/builtin/builtin.h
+
+static inline int I64_CLZ(unsigned long long v) {
+  unsigned long r = 0;
+#if defined(_M_AMD64) || defined(_M_ARM)
+  if (_BitScanReverse64(&r, v)) {
+    return 63 - r;
+  }
+#else
+  if (_BitScanReverse(&r, (unsigned long)(v >> 32))) {
+    return 31 - r;
+  } else if (_BitScanReverse(&r, (unsigned long)v)) {
+    return 63 - r;
+  }
+#endif
+  return 64;
+}
+
+static inline int I32_CLZ(unsigned long v) {
+  unsigned long r = 0;
+  if (_BitScanReverse(&r, v)) {
+    return 31 - r;
+  }
+  return 32;
+}
+
+static inline int I64_CTZ(unsigned long long v) {
+  if (!v) {
+    return 64;
+  }
+  unsigned long r = 0;
+#if defined(_M_AMD64) || defined(_M_ARM)
+  _BitScanForward64(&r, v);
+  return (int)r;
+#else
+  if (_BitScanForward(&r, (unsigned int)(v))) {
+    return (int)(r);
+  }
+
+  _BitScanForward(&r, (unsigned int)(v >> 32));
+  return (int)(r + 32);
+#endif
+}
+
+static inline int I32_CTZ(unsigned long v) {
+  if (!v) {
+    return 32;
+  }
+  unsigned long r = 0;
+  _BitScanForward(&r, v);
+  return (int)r;
+}
+
+#define POPCOUNT_DEFINE_PORTABLE(f_n, T)                            \
+  static inline u32 f_n(T x) {                                      \
+    x = x - ((x >> 1) & (T) ~(T)0 / 3);                             \
+    x = (x & (T) ~(T)0 / 15 * 3) + ((x >> 2) & (T) ~(T)0 / 15 * 3); \
+    x = (x + (x >> 4)) & (T) ~(T)0 / 255 * 15;                      \
+    return (T)(x * ((T) ~(T)0 / 255)) >> (sizeof(T) - 1) * 8;       \
+  }
+
+POPCOUNT_DEFINE_PORTABLE(I32_POPCNT, u32)
+POPCOUNT_DEFINE_PORTABLE(I64_POPCNT, u64)
+
+#undef POPCOUNT_DEFINE_PORTABLE
+
+#else
+
+#define I32_CLZ(x) ((x) ? __builtin_clz(x) : 32)
+#define I64_CLZ(x) ((x) ? __builtin_clzll(x) : 64)
+#define I32_CTZ(x) ((x) ? __builtin_ctz(x) : 32)
+#define I64_CTZ(x) ((x) ? __builtin_ctzll(x) : 64)
+#define I32_POPCNT(x) (__builtin_popcount(x))
+#define I64_POPCNT(x) (__builtin_popcountll(x))
+
+#endif
+
+#define DIV_S(ut, min, x, y)                                  \
+  ((UNLIKELY((y) == 0))                  ? TRAP(DIV_BY_ZERO)  \
+   : (UNLIKELY((x) == min && (y) == -1)) ? TRAP(INT_OVERFLOW) \
+                                         : (ut)((x) / (y)))
+
+#define REM_S(ut, min, x, y)                                 \
+  ((UNLIKELY((y) == 0))                  ? TRAP(DIV_BY_ZERO) \
+   : (UNLIKELY((x) == min && (y) == -1)) ? 0                 \
+                                         : (ut)((x) % (y)))
+
+#define I32_DIV_S(x, y) DIV_S(u32, INT32_MIN, (s32)x, (s32)y)
+#define I64_DIV_S(x, y) DIV_S(u64, INT64_MIN, (s64)x, (s64)y)
+#define I32_REM_S(x, y) REM_S(u32, INT32_MIN, (s32)x, (s32)y)
+#define I64_REM_S(x, y) REM_S(u64, INT64_MIN, (s64)x, (s64)y)
+
+#define DIVREM_U(op, x, y) \
+  ((UNLIKELY((y) == 0)) ? TRAP(DIV_BY_ZERO) : ((x)op(y)))
+
+#define DIV_U(x, y) DIVREM_U(/, x, y)
+#define REM_U(x, y) DIVREM_U(%, x, y)
+
+#define ROTL(x, y, mask) \
+  (((x) << ((y) & (mask))) | ((x) >> (((mask) - (y) + 1) & (mask))))
+#define ROTR(x, y, mask) \
+  (((x) >> ((y) & (mask))) | ((x) << (((mask) - (y) + 1) & (mask))))
+
+#define I32_ROTL(x, y) ROTL(x, y, 31)
+#define I64_ROTL(x, y) ROTL(x, y, 63)
+#define I32_ROTR(x, y) ROTR(x, y, 31)
+#define I64_ROTR(x, y) ROTR(x, y, 63)
+
+#define FMIN(x, y)                                           \
+  ((UNLIKELY((x) != (x)))             ? NAN                  \
+   : (UNLIKELY((y) != (y)))           ? NAN                  \
+   : (UNLIKELY((x) == 0 && (y) == 0)) ? (signbit(x) ? x : y) \
+   : (x < y)                          ? x                    \
+                                      : y)
+
+#define FMAX(x, y)                                           \
+  ((UNLIKELY((x) != (x)))             ? NAN                  \
+   : (UNLIKELY((y) != (y)))           ? NAN                  \
+   : (UNLIKELY((x) == 0 && (y) == 0)) ? (signbit(x) ? y : x) \
+   : (x > y)                          ? x                    \
+                                      : y)
+
+#define TRUNC_S(ut, st, ft, min, minop, max, x)                             \
+  ((UNLIKELY((x) != (x)))                        ? TRAP(INVALID_CONVERSION) \
+   : (UNLIKELY(!((x)minop(min) && (x) < (max)))) ? TRAP(INT_OVERFLOW)       \
+                                                 : (ut)(st)(x))
+
+#define I32_TRUNC_S_F32(x) \
+  TRUNC_S(u32, s32, f32, (f32)INT32_MIN, >=, 2147483648.f, x)
+#define I64_TRUNC_S_F32(x) \
+  TRUNC_S(u64, s64, f32, (f32)INT64_MIN, >=, (f32)INT64_MAX, x)
+#define I32_TRUNC_S_F64(x) \
+  TRUNC_S(u32, s32, f64, -2147483649., >, 2147483648., x)
+#define I64_TRUNC_S_F64(x) \
+  TRUNC_S(u64, s64, f64, (f64)INT64_MIN, >=, (f64)INT64_MAX, x)
+
+#define TRUNC_U(ut, ft, max, x)                                              \
+  ((UNLIKELY((x) != (x)))                         ? TRAP(INVALID_CONVERSION) \
+   : (UNLIKELY(!((x) > (ft) - 1 && (x) < (max)))) ? TRAP(INT_OVERFLOW)       \
+                                                  : (ut)(x))
+
+#define I32_TRUNC_U_F32(x) TRUNC_U(u32, f32, 4294967296.f, x)
+#define I64_TRUNC_U_F32(x) TRUNC_U(u64, f32, (f32)UINT64_MAX, x)
+#define I32_TRUNC_U_F64(x) TRUNC_U(u32, f64, 4294967296., x)
+#define I64_TRUNC_U_F64(x) TRUNC_U(u64, f64, (f64)UINT64_MAX, x)
+
+#define TRUNC_SAT_S(ut, st, ft, min, smin, minop, max, smax, x) \
+  ((UNLIKELY((x) != (x)))         ? 0                           \
+   : (UNLIKELY(!((x)minop(min)))) ? smin                        \
+   : (UNLIKELY(!((x) < (max))))   ? smax                        \
+                                  : (ut)(st)(x))
+
+#define I32_TRUNC_SAT_S_F32(x)                                            \
+  TRUNC_SAT_S(u32, s32, f32, (f32)INT32_MIN, INT32_MIN, >=, 2147483648.f, \
+              INT32_MAX, x)
+#define I64_TRUNC_SAT_S_F32(x)                                              \
+  TRUNC_SAT_S(u64, s64, f32, (f32)INT64_MIN, INT64_MIN, >=, (f32)INT64_MAX, \
+              INT64_MAX, x)
+#define I32_TRUNC_SAT_S_F64(x)                                        \
+  TRUNC_SAT_S(u32, s32, f64, -2147483649., INT32_MIN, >, 2147483648., \
+              INT32_MAX, x)
+#define I64_TRUNC_SAT_S_F64(x)                                              \
+  TRUNC_SAT_S(u64, s64, f64, (f64)INT64_MIN, INT64_MIN, >=, (f64)INT64_MAX, \
+              INT64_MAX, x)
+
+#define TRUNC_SAT_U(ut, ft, max, smax, x) \
+  ((UNLIKELY((x) != (x)))          ? 0    \
+   : (UNLIKELY(!((x) > (ft) - 1))) ? 0    \
+   : (UNLIKELY(!((x) < (max))))    ? smax \
+                                   : (ut)(x))
+
+#define I32_TRUNC_SAT_U_F32(x) \
+  TRUNC_SAT_U(u32, f32, 4294967296.f, UINT32_MAX, x)
+#define I64_TRUNC_SAT_U_F32(x) \
+  TRUNC_SAT_U(u64, f32, (f32)UINT64_MAX, UINT64_MAX, x)
+#define I32_TRUNC_SAT_U_F64(x) TRUNC_SAT_U(u32, f64, 4294967296., UINT32_MAX, x)
+#define I64_TRUNC_SAT_U_F64(x) \
+  TRUNC_SAT_U(u64, f64, (f64)UINT64_MAX, UINT64_MAX, x)
+
+#define DEFINE_REINTERPRET(name, t1, t2)         \
+  static inline t2 name(t1 x) {                  \
+    t2 result;                                   \
+    wasm_rt_memcpy(&result, &x, sizeof(result)); \
+    return result;                               \
+  }
+
+DEFINE_REINTERPRET(f32_reinterpret_i32, u32, f32)
+DEFINE_REINTERPRET(i32_reinterpret_f32, f32, u32)
+DEFINE_REINTERPRET(f64_reinterpret_i64, u64, f64)
+DEFINE_REINTERPRET(i64_reinterpret_f64, f64, u64)
+
+static float quiet_nanf(float x) {
+  uint32_t tmp;
+  wasm_rt_memcpy(&tmp, &x, 4);
+  tmp |= 0x7fc00000lu;
+  wasm_rt_memcpy(&x, &tmp, 4);
+  return x;
+}
+
+static double quiet_nan(double x) {
+  uint64_t tmp;
+  wasm_rt_memcpy(&tmp, &x, 8);
+  tmp |= 0x7ff8000000000000llu;
+  wasm_rt_memcpy(&x, &tmp, 8);
+  return x;
+}
+
+static double wasm_quiet(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+  return x;
+}
+
+static float wasm_quietf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+  return x;
+}
+
+static double wasm_floor(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+  return floor(x);
+}
+
+static float wasm_floorf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+  return floorf(x);
+}
+
+static double wasm_ceil(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+  return ceil(x);
+}
+
+static float wasm_ceilf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+  return ceilf(x);
+}
+
+static double wasm_trunc(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+  return trunc(x);
+}
+
+static float wasm_truncf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+  return truncf(x);
+}
+
+static float wasm_nearbyintf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+  return nearbyintf(x);
+}
+
+static double wasm_nearbyint(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+  return nearbyint(x);
+}
+
+static float wasm_fabsf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    uint32_t tmp;
+    wasm_rt_memcpy(&tmp, &x, 4);
+    tmp = tmp & ~(1UL << 31);
+    wasm_rt_memcpy(&x, &tmp, 4);
+    return x;
+  }
+  return fabsf(x);
+}
+
+static double wasm_fabs(double x) {
+  if (UNLIKELY(isnan(x))) {
+    uint64_t tmp;
+    wasm_rt_memcpy(&tmp, &x, 8);
+    tmp = tmp & ~(1ULL << 63);
+    wasm_rt_memcpy(&x, &tmp, 8);
+    return x;
+  }
+  return fabs(x);
+}
+
+static double wasm_sqrt(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+
+#if __has_builtin(__builtin_elementwise_sqrt)
+  // Fastest option: doesn't set errno
+  return __builtin_elementwise_sqrt(x);
+#elif __has_builtin(__builtin_sqrt)
+  // Optimized if -fno-math-errno is set
+  return __builtin_sqrt(x);
+#else
+  // Libc call. May/may not be optimized
+  return sqrt(x);
+#endif
+}
+
+static float wasm_sqrtf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+
+#if __has_builtin(__builtin_elementwise_sqrt)
+  // Fastest option: doesn't set errno
+  return __builtin_elementwise_sqrt(x);
+#elif __has_builtin(__builtin_sqrt)
+  // Optimized if -fno-math-errno is set
+  return __builtin_sqrtf(x);
+#else
+  // Libc call. May/may not be optimized
+  return sqrtf(x);
+#endif
+}
+
+static inline void memory_fill(wasm_rt_memory_t* mem, u64 d, u32 val, u64 n) {
+  RANGE_CHECK(mem, d, n);
+  memset(MEM_ADDR(mem, d, n), val, n);
+}
+
+static inline void memory_copy(wasm_rt_memory_t* dest,
+                               const wasm_rt_memory_t* src,
+                               u64 dest_addr,
+                               u64 src_addr,
+                               u64 n) {
+  RANGE_CHECK(dest, dest_addr, n);
+  RANGE_CHECK(src, src_addr, n);
+  memmove(MEM_ADDR(dest, dest_addr, n), MEM_ADDR(src, src_addr, n), n);
+}
+
+static inline void memory_init(wasm_rt_memory_t* dest,
+                               const u8* src,
+                               u32 src_size,
+                               u64 dest_addr,
+                               u32 src_addr,
+                               u32 n) {
+  if (UNLIKELY(src_addr + (uint64_t)n > src_size))
+    TRAP(OOB);
+  LOAD_DATA((*dest), dest_addr, src + src_addr, n);
+}
+
+typedef enum { RefFunc, RefNull, GlobalGet } wasm_elem_segment_expr_type_t;
+
+typedef struct {
+  wasm_elem_segment_expr_type_t expr_type;
+  wasm_rt_func_type_t type;
+  wasm_rt_function_ptr_t func;
+  wasm_rt_tailcallee_t func_tailcallee;
+  size_t module_offset;
+} wasm_elem_segment_expr_t;
+
+static inline void funcref_table_init(wasm_rt_funcref_table_t* dest,
+                                      const wasm_elem_segment_expr_t* src,
+                                      u32 src_size,
+                                      u64 dest_addr,
+                                      u32 src_addr,
+                                      u32 n,
+                                      void* module_instance) {
+  if (UNLIKELY(src_addr + (uint64_t)n > src_size))
+    TRAP(OOB);
+  RANGE_CHECK(dest, dest_addr, n);
+  for (u32 i = 0; i < n; i++) {
+    const wasm_elem_segment_expr_t* const src_expr = &src[src_addr + i];
+    wasm_rt_funcref_t* const dest_val = &(dest->data[dest_addr + i]);
+    switch (src_expr->expr_type) {
+      case RefFunc:
+        *dest_val = (wasm_rt_funcref_t){
+            src_expr->type, src_expr->func, src_expr->func_tailcallee,
+            (char*)module_instance + src_expr->module_offset};
+        break;
+      case RefNull:
+        *dest_val = wasm_rt_funcref_null_value;
+        break;
+      case GlobalGet:
+        *dest_val = **(wasm_rt_funcref_t**)((char*)module_instance +
+                                            src_expr->module_offset);
+        break;
+    }
+  }
+}
+
+// Currently wasm2c only supports initializing externref tables with ref.null.
+static inline void externref_table_init(wasm_rt_externref_table_t* dest,
+                                        u32 src_size,
+                                        u64 dest_addr,
+                                        u32 src_addr,
+                                        u32 n) {
+  if (UNLIKELY(src_addr + (uint64_t)n > src_size))
+    TRAP(OOB);
+  RANGE_CHECK(dest, dest_addr, n);
+  for (u32 i = 0; i < n; i++) {
+    dest->data[dest_addr + i] = wasm_rt_externref_null_value;
+  }
+}
+
+#define DEFINE_TABLE_COPY(type)                                              \
+  static inline void type##_table_copy(wasm_rt_##type##_table_t* dest,       \
+                                       const wasm_rt_##type##_table_t* src,  \
+                                       u64 dest_addr, u64 src_addr, u64 n) { \
+    RANGE_CHECK(dest, dest_addr, n);                                         \
+    RANGE_CHECK(src, src_addr, n);                                           \
+    memmove(dest->data + dest_addr, src->data + src_addr,                    \
+            n * sizeof(wasm_rt_##type##_t));                                 \
+  }
+
+DEFINE_TABLE_COPY(funcref)
+DEFINE_TABLE_COPY(externref)
+
+#define DEFINE_TABLE_GET(type)                        \
+  static inline wasm_rt_##type##_t type##_table_get(  \
+      const wasm_rt_##type##_table_t* table, u64 i) { \
+    if (UNLIKELY(i >= table->size))                   \
+      TRAP(OOB);                                      \
+    return table->data[i];                            \
+  }
+
+DEFINE_TABLE_GET(funcref)
+DEFINE_TABLE_GET(externref)
+
+#define DEFINE_TABLE_SET(type)                                               \
+  static inline void type##_table_set(const wasm_rt_##type##_table_t* table, \
+                                      u64 i, const wasm_rt_##type##_t val) { \
+    if (UNLIKELY(i >= table->size))                                          \
+      TRAP(OOB);                                                             \
+    table->data[i] = val;                                                    \
+  }
+
+DEFINE_TABLE_SET(funcref)
+DEFINE_TABLE_SET(externref)
+
+#define DEFINE_TABLE_FILL(type)                                               \
+  static inline void type##_table_fill(const wasm_rt_##type##_table_t* table, \
+                                       u64 d, const wasm_rt_##type##_t val,   \
+                                       u64 n) {                               \
+    RANGE_CHECK(table, d, n);                                                 \
+    for (uint32_t i = d; i < d + n; i++) {                                    \
+      table->data[i] = val;                                                   \
+    }                                                                         \
+  }
+
+DEFINE_TABLE_FILL(funcref)
+DEFINE_TABLE_FILL(externref)
+
+#if defined(__GNUC__) || defined(__clang__)
+#define FUNC_TYPE_DECL_EXTERN_T(x) extern const char* const x
+#define FUNC_TYPE_EXTERN_T(x) const char* const x
+#define FUNC_TYPE_T(x) static const char* const x
+#else
+#define FUNC_TYPE_DECL_EXTERN_T(x) extern const char x[]
+#define FUNC_TYPE_EXTERN_T(x) const char x[]
+#define FUNC_TYPE_T(x) static const char x[]
+#endif
+
+#if (__STDC_VERSION__ < 201112L) && !defined(static_assert)
+#define static_assert(X) \
+  extern int(*assertion(void))[!!sizeof(struct { int x : (X) ? 2 : -1; })];
+#endif
+
+#ifdef _MSC_VER
+#define WEAK_FUNC_DECL(func, fallback)                             \
+  __pragma(comment(linker, "/alternatename:" #func "=" #fallback)) \
+                                                                   \
+      void                                                         \
+      fallback(void** instance_ptr, void* tail_call_stack,         \
+               wasm_rt_tailcallee_t* next)
+#else
+#define WEAK_FUNC_DECL(func, fallback)                                        \
+  __attribute__((weak)) void func(void** instance_ptr, void* tail_call_stack, \
+                                  wasm_rt_tailcallee_t* next)
+#endif
+
+static u32 w2c_call__indirect__0__wasm_f0(w2c_call__indirect__0__wasm*);
+static u64 w2c_call__indirect__0__wasm_f1(w2c_call__indirect__0__wasm*);
+static f32 w2c_call__indirect__0__wasm_f2(w2c_call__indirect__0__wasm*);
+static f64 w2c_call__indirect__0__wasm_f3(w2c_call__indirect__0__wasm*);
+static struct wasm_multi_di w2c_call__indirect__0__wasm_f4(w2c_call__indirect__0__wasm*);
+static u32 w2c_call__indirect__0__wasm_f5(w2c_call__indirect__0__wasm*, u32);
+static u64 w2c_call__indirect__0__wasm_f6(w2c_call__indirect__0__wasm*, u64);
+static f32 w2c_call__indirect__0__wasm_f7(w2c_call__indirect__0__wasm*, f32);
+static f64 w2c_call__indirect__0__wasm_f8(w2c_call__indirect__0__wasm*, f64);
+static struct wasm_multi_id w2c_call__indirect__0__wasm_f9(w2c_call__indirect__0__wasm*, u32, f64);
+static struct wasm_multi_ji w2c_call__indirect__0__wasm_f10(w2c_call__indirect__0__wasm*, u32, u64);
+static u64 w2c_call__indirect__0__wasm_f11(w2c_call__indirect__0__wasm*, u32, u64);
+static f64 w2c_call__indirect__0__wasm_f12(w2c_call__indirect__0__wasm*, u64, f64);
+static u32 w2c_call__indirect__0__wasm_f13(w2c_call__indirect__0__wasm*, f32, u32);
+static f32 w2c_call__indirect__0__wasm_f14(w2c_call__indirect__0__wasm*, f64, f32);
+static u32 w2c_call__indirect__0__wasm_f15(w2c_call__indirect__0__wasm*, u32);
+static u64 w2c_call__indirect__0__wasm_f16(w2c_call__indirect__0__wasm*, u64);
+static f32 w2c_call__indirect__0__wasm_f17(w2c_call__indirect__0__wasm*, f32);
+static f64 w2c_call__indirect__0__wasm_f18(w2c_call__indirect__0__wasm*, f64);
+static void w2c_call__indirect__0__wasm_f19(w2c_call__indirect__0__wasm*);
+static u32 w2c_call__indirect__0__wasm_type0x2Di32_0(w2c_call__indirect__0__wasm*);
+static u32 w2c_call__indirect__0__wasm_type0x2Di320x2Dt64_0(w2c_call__indirect__0__wasm*);
+static u64 w2c_call__indirect__0__wasm_type0x2Di64_0(w2c_call__indirect__0__wasm*);
+static f32 w2c_call__indirect__0__wasm_type0x2Df32_0(w2c_call__indirect__0__wasm*);
+static f64 w2c_call__indirect__0__wasm_type0x2Df64_0(w2c_call__indirect__0__wasm*);
+static struct wasm_multi_di w2c_call__indirect__0__wasm_type0x2Df640x2Di32_0(w2c_call__indirect__0__wasm*);
+static u64 w2c_call__indirect__0__wasm_type0x2Dindex_0(w2c_call__indirect__0__wasm*);
+static u32 w2c_call__indirect__0__wasm_type0x2Dfirst0x2Di32_0(w2c_call__indirect__0__wasm*);
+static u64 w2c_call__indirect__0__wasm_type0x2Dfirst0x2Di64_0(w2c_call__indirect__0__wasm*);
+static f32 w2c_call__indirect__0__wasm_type0x2Dfirst0x2Df32_0(w2c_call__indirect__0__wasm*);
+static f64 w2c_call__indirect__0__wasm_type0x2Dfirst0x2Df64_0(w2c_call__indirect__0__wasm*);
+static u32 w2c_call__indirect__0__wasm_type0x2Dsecond0x2Di32_0(w2c_call__indirect__0__wasm*);
+static u64 w2c_call__indirect__0__wasm_type0x2Dsecond0x2Di64_0(w2c_call__indirect__0__wasm*);
+static f32 w2c_call__indirect__0__wasm_type0x2Dsecond0x2Df32_0(w2c_call__indirect__0__wasm*);
+static f64 w2c_call__indirect__0__wasm_type0x2Dsecond0x2Df64_0(w2c_call__indirect__0__wasm*);
+static struct wasm_multi_di w2c_call__indirect__0__wasm_type0x2Dall0x2Df640x2Di32_0(w2c_call__indirect__0__wasm*);
+static struct wasm_multi_id w2c_call__indirect__0__wasm_type0x2Dall0x2Di320x2Df64_0(w2c_call__indirect__0__wasm*);
+static struct wasm_multi_ji w2c_call__indirect__0__wasm_type0x2Dall0x2Di320x2Di64_0(w2c_call__indirect__0__wasm*);
+static u64 w2c_call__indirect__0__wasm_dispatch_0(w2c_call__indirect__0__wasm*, u32, u64);
+static u64 w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Di64_0(w2c_call__indirect__0__wasm*, u32);
+static u32 w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Di32_0(w2c_call__indirect__0__wasm*, u32);
+static f32 w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Df32_0(w2c_call__indirect__0__wasm*, u32);
+static f64 w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Df64_0(w2c_call__indirect__0__wasm*, u32);
+static u64 w2c_call__indirect__0__wasm_fac0x2Di64_0(w2c_call__indirect__0__wasm*, u64);
+static u64 w2c_call__indirect__0__wasm_fib0x2Di64_0(w2c_call__indirect__0__wasm*, u64);
+static u32 w2c_call__indirect__0__wasm_fac0x2Di32_0(w2c_call__indirect__0__wasm*, u32);
+static f32 w2c_call__indirect__0__wasm_fac0x2Df32_0(w2c_call__indirect__0__wasm*, f32);
+static f64 w2c_call__indirect__0__wasm_fac0x2Df64_0(w2c_call__indirect__0__wasm*, f64);
+static u32 w2c_call__indirect__0__wasm_fib0x2Di32_0(w2c_call__indirect__0__wasm*, u32);
+static f32 w2c_call__indirect__0__wasm_fib0x2Df32_0(w2c_call__indirect__0__wasm*, f32);
+static f64 w2c_call__indirect__0__wasm_fib0x2Df64_0(w2c_call__indirect__0__wasm*, f64);
+static u32 w2c_call__indirect__0__wasm_even_0(w2c_call__indirect__0__wasm*, u32);
+static u32 w2c_call__indirect__0__wasm_odd_0(w2c_call__indirect__0__wasm*, u32);
+static void w2c_call__indirect__0__wasm_runaway_0(w2c_call__indirect__0__wasm*);
+static void w2c_call__indirect__0__wasm_mutual0x2Drunaway_0(w2c_call__indirect__0__wasm*);
+static void w2c_call__indirect__0__wasm_f55(w2c_call__indirect__0__wasm*);
+static u32 w2c_call__indirect__0__wasm_as0x2Dselect0x2Dfirst_0(w2c_call__indirect__0__wasm*);
+static u32 w2c_call__indirect__0__wasm_as0x2Dselect0x2Dmid_0(w2c_call__indirect__0__wasm*);
+static u32 w2c_call__indirect__0__wasm_as0x2Dselect0x2Dlast_0(w2c_call__indirect__0__wasm*);
+static u32 w2c_call__indirect__0__wasm_as0x2Dif0x2Dcondition_0(w2c_call__indirect__0__wasm*);
+static u64 w2c_call__indirect__0__wasm_as0x2Dbr_if0x2Dfirst_0(w2c_call__indirect__0__wasm*);
+static u32 w2c_call__indirect__0__wasm_as0x2Dbr_if0x2Dlast_0(w2c_call__indirect__0__wasm*);
+static f32 w2c_call__indirect__0__wasm_as0x2Dbr_table0x2Dfirst_0(w2c_call__indirect__0__wasm*);
+static u32 w2c_call__indirect__0__wasm_as0x2Dbr_table0x2Dlast_0(w2c_call__indirect__0__wasm*);
+static void w2c_call__indirect__0__wasm_as0x2Dstore0x2Dfirst_0(w2c_call__indirect__0__wasm*);
+static void w2c_call__indirect__0__wasm_as0x2Dstore0x2Dlast_0(w2c_call__indirect__0__wasm*);
+static u32 w2c_call__indirect__0__wasm_as0x2Dmemory0x2Egrow0x2Dvalue_0(w2c_call__indirect__0__wasm*);
+static u32 w2c_call__indirect__0__wasm_as0x2Dreturn0x2Dvalue_0(w2c_call__indirect__0__wasm*);
+static void w2c_call__indirect__0__wasm_as0x2Ddrop0x2Doperand_0(w2c_call__indirect__0__wasm*);
+static f32 w2c_call__indirect__0__wasm_as0x2Dbr0x2Dvalue_0(w2c_call__indirect__0__wasm*);
+static f64 w2c_call__indirect__0__wasm_as0x2Dlocal0x2Eset0x2Dvalue_0(w2c_call__indirect__0__wasm*);
+static f64 w2c_call__indirect__0__wasm_as0x2Dlocal0x2Etee0x2Dvalue_0(w2c_call__indirect__0__wasm*);
+static f64 w2c_call__indirect__0__wasm_as0x2Dglobal0x2Eset0x2Dvalue_0(w2c_call__indirect__0__wasm*);
+static u32 w2c_call__indirect__0__wasm_as0x2Dload0x2Doperand_0(w2c_call__indirect__0__wasm*);
+static f32 w2c_call__indirect__0__wasm_as0x2Dunary0x2Doperand_0(w2c_call__indirect__0__wasm*);
+static u32 w2c_call__indirect__0__wasm_as0x2Dbinary0x2Dleft_0(w2c_call__indirect__0__wasm*);
+static u32 w2c_call__indirect__0__wasm_as0x2Dbinary0x2Dright_0(w2c_call__indirect__0__wasm*);
+static u32 w2c_call__indirect__0__wasm_as0x2Dtest0x2Doperand_0(w2c_call__indirect__0__wasm*);
+static u32 w2c_call__indirect__0__wasm_as0x2Dcompare0x2Dleft_0(w2c_call__indirect__0__wasm*);
+static u32 w2c_call__indirect__0__wasm_as0x2Dcompare0x2Dright_0(w2c_call__indirect__0__wasm*);
+static u64 w2c_call__indirect__0__wasm_as0x2Dconvert0x2Doperand_0(w2c_call__indirect__0__wasm*);
+
+FUNC_TYPE_T(w2c_call__indirect__0__wasm_t0) = "\x36\xa9\xe7\xf1\xc9\x5b\x82\xff\xb9\x97\x43\xe0\xc5\xc4\xce\x95\xd8\x3c\x9a\x43\x0a\xac\x59\xf8\x4e\xf3\xcb\xfa\xb6\x14\x50\x68";
+FUNC_TYPE_T(w2c_call__indirect__0__wasm_t1) = "\x72\xab\x00\xdf\x20\x3d\xce\xa1\xf2\x29\xc7\x9d\x13\x40\x7e\x98\xac\x7d\x41\x4a\x53\x2e\x42\x42\x61\x55\x2e\xaa\xeb\xbe\xc6\x35";
+FUNC_TYPE_T(w2c_call__indirect__0__wasm_t2) = "\xa6\x83\x1a\x14\xc3\x06\xed\xb0\xc1\xda\x87\x2f\x07\x53\x23\x00\xfd\x3d\xd0\x1d\x58\xab\xd8\xbf\xcf\x54\xdb\xc5\x02\xc8\x07\x27";
+FUNC_TYPE_T(w2c_call__indirect__0__wasm_t3) = "\xf4\xba\x4b\xa2\x75\x09\xeb\x70\x4c\x94\x92\xc2\xc5\x75\x1a\x1a\x3e\x87\xc1\xff\x39\xe3\x21\x88\xdb\x22\x48\x89\xae\x98\x2b\xac";
+FUNC_TYPE_T(w2c_call__indirect__0__wasm_t4) = "\xa2\x6b\xdd\x6b\x8b\xf9\x1a\x68\xb2\x64\xcc\x3d\x18\x9d\x89\xa7\x92\x04\x85\x33\x0d\xe7\x95\x54\xeb\x44\xc7\xa8\xff\xf6\x68\x3a";
+FUNC_TYPE_T(w2c_call__indirect__0__wasm_t5) = "\xc2\x38\xf7\xba\xa6\x99\x9a\x29\x34\x56\x7d\xc6\x3b\xb3\x32\xb3\xf5\xa1\x04\x5a\xd0\x10\xd0\x7e\x09\x98\xd2\xff\x46\xa1\xc2\x75";
+FUNC_TYPE_T(w2c_call__indirect__0__wasm_t6) = "\x07\x80\x96\x7a\x42\xf7\x3e\xe6\x70\x5c\x2f\xac\x83\xf5\x67\xd2\xa2\xa0\x69\x41\x5f\xf8\xe7\x96\x7f\x23\xab\x00\x03\x5f\x4a\x3c";
+FUNC_TYPE_T(w2c_call__indirect__0__wasm_t7) = "\xe1\xbe\x1d\x1b\x04\xf4\x2e\xb3\xf5\x2f\x05\x8b\xda\x39\xd0\xab\x5c\xae\xfb\x73\x3c\xd0\x0f\xe5\xc6\xb0\xa8\x61\x3a\x48\x8d\xcd";
+FUNC_TYPE_T(w2c_call__indirect__0__wasm_t8) = "\xab\x97\xa1\xf3\x0e\x57\x7f\x3f\xb6\x79\xd4\xb2\xb6\x7f\xbc\x1d\xfc\x30\x70\x05\x01\xed\x79\x69\xae\x7b\xee\x28\xc6\x93\xa7\x8f";
+FUNC_TYPE_T(w2c_call__indirect__0__wasm_t9) = "\x0a\xb9\x50\x3c\x6a\xf0\x79\x2e\x9c\x53\x4a\xd4\xf1\x68\x37\xd4\xe0\xdf\x32\xf6\x00\xb4\x45\xdf\x75\x1e\xd7\x52\xa6\x86\xd7\xac";
+FUNC_TYPE_T(w2c_call__indirect__0__wasm_t10) = "\xe5\x11\x86\xc7\x24\xdb\x44\x80\xbe\xd1\xe0\x89\xbc\xc0\x20\xea\xfb\x1c\x9a\x27\xa5\xc3\xdb\xca\x5d\xb0\x05\x0f\x7c\x03\x74\x0a";
+FUNC_TYPE_T(w2c_call__indirect__0__wasm_t11) = "\xdf\xdf\xf5\xe2\xde\xff\x13\x30\x3b\x7c\x64\x96\x7a\xda\x85\xe5\xfd\x8a\xfa\x9b\x0a\x4b\x37\x18\xa9\x9c\x58\xb2\x1a\xfa\x96\xf6";
+FUNC_TYPE_T(w2c_call__indirect__0__wasm_t12) = "\xee\xd7\x52\x00\x2d\x2b\x7f\x91\x0e\x23\x41\x5a\xa1\xda\x6f\x4c\x11\x31\x43\x03\xcc\x16\x66\x0f\x65\x42\x9a\x91\x89\x54\x4f\xc1";
+FUNC_TYPE_T(w2c_call__indirect__0__wasm_t13) = "\xb7\x7b\x09\x27\x00\xd6\xf9\x20\xce\x8e\x68\xc0\x9f\x87\xc4\xe2\xe0\xd0\xc0\xd5\x5a\x8b\x45\x32\x3f\xbb\xec\xe6\xf4\x8d\xf4\x55";
+FUNC_TYPE_T(w2c_call__indirect__0__wasm_t14) = "\x41\x72\x7d\xa9\xa2\xa1\xca\xff\xbd\x40\x97\xad\xb7\xa0\x95\x79\x69\x3b\x03\x04\x73\xd4\x71\x6e\x8e\x2e\xc3\xca\x77\x68\x0c\xbf";
+FUNC_TYPE_T(w2c_call__indirect__0__wasm_t15) = "\x8c\xff\x5e\xd4\xf9\xc3\xe5\x4b\xd1\x49\x2c\x7e\x60\xc2\x76\x3a\xa1\x04\xa5\x68\xcf\x75\xd2\x15\xde\xe4\x15\x76\x0a\x02\x05\x3c";
+FUNC_TYPE_T(w2c_call__indirect__0__wasm_t20) = "\x36\xe8\xcd\xcd\x7f\x90\xda\x2c\x26\xd8\x14\xae\x0b\x2f\x96\xbd\x2f\xba\x60\x45\x88\x21\xbf\x78\x71\xf1\x9d\xee\x54\x81\xd3\xc8";
+FUNC_TYPE_T(w2c_call__indirect__0__wasm_t21) = "\x0c\x30\x56\x67\x89\xa0\xb2\x88\x14\xea\x42\xd8\x54\x37\x61\xaa\x8f\x01\x88\x43\xe4\xf0\x3d\xca\x7e\xf0\x58\x63\x50\xf7\xa7\x09";
+FUNC_TYPE_T(w2c_call__indirect__0__wasm_t22) = "\x36\xb2\x3b\x59\x0e\xe1\x68\x15\x39\xbd\x13\x39\xf5\xe5\xc8\x9b\x43\xd8\xb0\x6d\x5d\x5d\x18\xc2\x38\x45\x2d\x0e\x6b\x81\x8f\x8f";
+FUNC_TYPE_T(w2c_call__indirect__0__wasm_t23) = "\x85\x6a\xe8\xea\x0b\xb7\x19\xd3\xa7\xc9\x2f\xc2\x96\x4b\x49\x82\x29\x91\xe8\x93\x32\x0c\x28\x78\xbf\x46\x2e\xea\x6b\xff\x78\x7e";
+FUNC_TYPE_T(w2c_call__indirect__0__wasm_t24) = "\xbf\x5e\xf6\xa2\xa3\x6a\x55\x2e\x41\xc2\xe4\x70\x99\xb1\xed\xaf\xb5\xc1\x29\x22\x81\xf5\xef\x7e\x4d\xfc\x22\x64\x39\x65\x2d\xe4";
+FUNC_TYPE_T(w2c_call__indirect__0__wasm_t25) = "\x9d\x2e\x63\x95\x2d\xe0\xe4\xc3\x76\xe3\x70\x54\xe0\xcf\xf7\x9a\x33\x60\xcf\xd6\x99\x4f\xea\x86\x17\x1f\x73\x4f\xbc\x1b\x63\xc2";
+FUNC_TYPE_T(w2c_call__indirect__0__wasm_t26) = "\x34\xdb\x83\x7a\x75\x3e\xc6\x13\xe5\xf4\xea\xd1\x67\xfb\xe4\x11\x01\x6b\xcf\x7c\xac\xb1\x84\x7b\xf9\xdf\x70\xfd\xb7\x70\x78\x1b";
+FUNC_TYPE_T(w2c_call__indirect__0__wasm_t27) = "\xdf\xbb\x30\x1f\x72\x01\xbd\x57\x36\x58\x68\x8f\xf8\xb4\x8e\x09\x1c\xd5\x1e\xb5\x36\xde\x2a\x37\xfe\x62\x39\x54\xb4\x81\x72\x61";
+FUNC_TYPE_T(w2c_call__indirect__0__wasm_t28) = "\x3d\x0f\x16\xf6\x24\x19\x30\xd2\xbf\x7c\x25\x94\xb5\xdf\x90\x3d\x74\x62\xde\x34\x41\x83\xb0\xaf\x1a\xd8\x82\x63\xdc\xdf\xfe\x21";
+
+static u32 wrap_w2c_call__indirect__0__wasm_f0(void *instance) {
+  return w2c_call__indirect__0__wasm_f0((struct w2c_call__indirect__0__wasm*) instance);
+}
+static u64 wrap_w2c_call__indirect__0__wasm_f1(void *instance) {
+  return w2c_call__indirect__0__wasm_f1((struct w2c_call__indirect__0__wasm*) instance);
+}
+static f32 wrap_w2c_call__indirect__0__wasm_f2(void *instance) {
+  return w2c_call__indirect__0__wasm_f2((struct w2c_call__indirect__0__wasm*) instance);
+}
+static f64 wrap_w2c_call__indirect__0__wasm_f3(void *instance) {
+  return w2c_call__indirect__0__wasm_f3((struct w2c_call__indirect__0__wasm*) instance);
+}
+static struct wasm_multi_di wrap_w2c_call__indirect__0__wasm_f4(void *instance) {
+  return w2c_call__indirect__0__wasm_f4((struct w2c_call__indirect__0__wasm*) instance);
+}
+static u32 wrap_w2c_call__indirect__0__wasm_f5(void *instance, u32 var_0) {
+  return w2c_call__indirect__0__wasm_f5((struct w2c_call__indirect__0__wasm*) instance, var_0);
+}
+static u64 wrap_w2c_call__indirect__0__wasm_f6(void *instance, u64 var_0) {
+  return w2c_call__indirect__0__wasm_f6((struct w2c_call__indirect__0__wasm*) instance, var_0);
+}
+static f32 wrap_w2c_call__indirect__0__wasm_f7(void *instance, f32 var_0) {
+  return w2c_call__indirect__0__wasm_f7((struct w2c_call__indirect__0__wasm*) instance, var_0);
+}
+static f64 wrap_w2c_call__indirect__0__wasm_f8(void *instance, f64 var_0) {
+  return w2c_call__indirect__0__wasm_f8((struct w2c_call__indirect__0__wasm*) instance, var_0);
+}
+static struct wasm_multi_id wrap_w2c_call__indirect__0__wasm_f9(void *instance, u32 var_0, f64 var_1) {
+  return w2c_call__indirect__0__wasm_f9((struct w2c_call__indirect__0__wasm*) instance, var_0, var_1);
+}
+static struct wasm_multi_ji wrap_w2c_call__indirect__0__wasm_f10(void *instance, u32 var_0, u64 var_1) {
+  return w2c_call__indirect__0__wasm_f10((struct w2c_call__indirect__0__wasm*) instance, var_0, var_1);
+}
+static u64 wrap_w2c_call__indirect__0__wasm_f11(void *instance, u32 var_0, u64 var_1) {
+  return w2c_call__indirect__0__wasm_f11((struct w2c_call__indirect__0__wasm*) instance, var_0, var_1);
+}
+static f64 wrap_w2c_call__indirect__0__wasm_f12(void *instance, u64 var_0, f64 var_1) {
+  return w2c_call__indirect__0__wasm_f12((struct w2c_call__indirect__0__wasm*) instance, var_0, var_1);
+}
+static u32 wrap_w2c_call__indirect__0__wasm_f13(void *instance, f32 var_0, u32 var_1) {
+  return w2c_call__indirect__0__wasm_f13((struct w2c_call__indirect__0__wasm*) instance, var_0, var_1);
+}
+static f32 wrap_w2c_call__indirect__0__wasm_f14(void *instance, f64 var_0, f32 var_1) {
+  return w2c_call__indirect__0__wasm_f14((struct w2c_call__indirect__0__wasm*) instance, var_0, var_1);
+}
+static u32 wrap_w2c_call__indirect__0__wasm_f15(void *instance, u32 var_0) {
+  return w2c_call__indirect__0__wasm_f15((struct w2c_call__indirect__0__wasm*) instance, var_0);
+}
+static u64 wrap_w2c_call__indirect__0__wasm_f16(void *instance, u64 var_0) {
+  return w2c_call__indirect__0__wasm_f16((struct w2c_call__indirect__0__wasm*) instance, var_0);
+}
+static f32 wrap_w2c_call__indirect__0__wasm_f17(void *instance, f32 var_0) {
+  return w2c_call__indirect__0__wasm_f17((struct w2c_call__indirect__0__wasm*) instance, var_0);
+}
+static f64 wrap_w2c_call__indirect__0__wasm_f18(void *instance, f64 var_0) {
+  return w2c_call__indirect__0__wasm_f18((struct w2c_call__indirect__0__wasm*) instance, var_0);
+}
+static u64 wrap_w2c_call__indirect__0__wasm_fac0x2Di64_0(void *instance, u64 var_0) {
+  return w2c_call__indirect__0__wasm_fac0x2Di64_0((struct w2c_call__indirect__0__wasm*) instance, var_0);
+}
+static u64 wrap_w2c_call__indirect__0__wasm_fib0x2Di64_0(void *instance, u64 var_0) {
+  return w2c_call__indirect__0__wasm_fib0x2Di64_0((struct w2c_call__indirect__0__wasm*) instance, var_0);
+}
+static u32 wrap_w2c_call__indirect__0__wasm_fac0x2Di32_0(void *instance, u32 var_0) {
+  return w2c_call__indirect__0__wasm_fac0x2Di32_0((struct w2c_call__indirect__0__wasm*) instance, var_0);
+}
+static f32 wrap_w2c_call__indirect__0__wasm_fac0x2Df32_0(void *instance, f32 var_0) {
+  return w2c_call__indirect__0__wasm_fac0x2Df32_0((struct w2c_call__indirect__0__wasm*) instance, var_0);
+}
+static f64 wrap_w2c_call__indirect__0__wasm_fac0x2Df64_0(void *instance, f64 var_0) {
+  return w2c_call__indirect__0__wasm_fac0x2Df64_0((struct w2c_call__indirect__0__wasm*) instance, var_0);
+}
+static u32 wrap_w2c_call__indirect__0__wasm_fib0x2Di32_0(void *instance, u32 var_0) {
+  return w2c_call__indirect__0__wasm_fib0x2Di32_0((struct w2c_call__indirect__0__wasm*) instance, var_0);
+}
+static f32 wrap_w2c_call__indirect__0__wasm_fib0x2Df32_0(void *instance, f32 var_0) {
+  return w2c_call__indirect__0__wasm_fib0x2Df32_0((struct w2c_call__indirect__0__wasm*) instance, var_0);
+}
+static f64 wrap_w2c_call__indirect__0__wasm_fib0x2Df64_0(void *instance, f64 var_0) {
+  return w2c_call__indirect__0__wasm_fib0x2Df64_0((struct w2c_call__indirect__0__wasm*) instance, var_0);
+}
+static u32 wrap_w2c_call__indirect__0__wasm_even_0(void *instance, u32 var_0) {
+  return w2c_call__indirect__0__wasm_even_0((struct w2c_call__indirect__0__wasm*) instance, var_0);
+}
+static u32 wrap_w2c_call__indirect__0__wasm_odd_0(void *instance, u32 var_0) {
+  return w2c_call__indirect__0__wasm_odd_0((struct w2c_call__indirect__0__wasm*) instance, var_0);
+}
+static void wrap_w2c_call__indirect__0__wasm_runaway_0(void *instance) {
+  return w2c_call__indirect__0__wasm_runaway_0((struct w2c_call__indirect__0__wasm*) instance);
+}
+static void wrap_w2c_call__indirect__0__wasm_mutual0x2Drunaway_0(void *instance) {
+  return w2c_call__indirect__0__wasm_mutual0x2Drunaway_0((struct w2c_call__indirect__0__wasm*) instance);
+}
+static void wrap_w2c_call__indirect__0__wasm_f55(void *instance) {
+  return w2c_call__indirect__0__wasm_f55((struct w2c_call__indirect__0__wasm*) instance);
+}
+
+static void init_globals(w2c_call__indirect__0__wasm* instance) {
+  instance->w2c_g0 = 10.0;
+}
+
+static void init_memories(w2c_call__indirect__0__wasm* instance) {
+  wasm_rt_allocate_memory(&instance->w2c_M0, 1, 65536, 0, 65536);
+}
+
+static const wasm_elem_segment_expr_t elem_segment_exprs_w2c_call__indirect__0__wasm_e0[] = {
+  {RefFunc, w2c_call__indirect__0__wasm_t1, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_f0, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t2, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_f1, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t3, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_f2, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t4, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_f3, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t6, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_f5, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t7, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_f6, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t8, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_f7, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t9, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_f8, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t12, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_f13, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t13, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_f11, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t14, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_f14, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t15, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_f12, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t7, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_fac0x2Di64_0, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t7, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_fib0x2Di64_0, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t6, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_even_0, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t6, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_odd_0, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t0, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_runaway_0, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t0, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_mutual0x2Drunaway_0, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t0, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_f55, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t6, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_f15, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t7, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_f16, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t8, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_f17, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t9, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_f18, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t6, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_fac0x2Di32_0, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t8, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_fac0x2Df32_0, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t9, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_fac0x2Df64_0, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t6, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_fib0x2Di32_0, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t8, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_fib0x2Df32_0, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t9, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_fib0x2Df64_0, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t5, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_f4, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t10, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_f9, {NULL}, 0},
+  {RefFunc, w2c_call__indirect__0__wasm_t11, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_f10, {NULL}, 0},
+};
+
+static const wasm_elem_segment_expr_t elem_segment_exprs_w2c_call__indirect__0__wasm_e1[] = {
+  {RefFunc, w2c_call__indirect__0__wasm_t1, (wasm_rt_function_ptr_t)wrap_w2c_call__indirect__0__wasm_f0, {NULL}, 0},
+};
+
+static void init_tables(w2c_call__indirect__0__wasm* instance) {
+  wasm_rt_allocate_funcref_table(&instance->w2c_T0, 32, 32);
+  wasm_rt_allocate_funcref_table(&instance->w2c_T1, 1, 1);
+  funcref_table_init(&instance->w2c_T0, elem_segment_exprs_w2c_call__indirect__0__wasm_e0, 32, 0u, 0, 32, instance);
+  funcref_table_init(&instance->w2c_T1, elem_segment_exprs_w2c_call__indirect__0__wasm_e1, 1, 0ull, 0, 1, instance);
+}
+
+static void init_elem_instances(w2c_call__indirect__0__wasm *instance) {
+}
+
+/* export: 'type-i32' */
+u32 w2c_call__indirect__0__wasm_type0x2Di32(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u32 ret = w2c_call__indirect__0__wasm_type0x2Di32_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'type-i32-t64' */
+u32 w2c_call__indirect__0__wasm_type0x2Di320x2Dt64(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u32 ret = w2c_call__indirect__0__wasm_type0x2Di320x2Dt64_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'type-i64' */
+u64 w2c_call__indirect__0__wasm_type0x2Di64(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u64 ret = w2c_call__indirect__0__wasm_type0x2Di64_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'type-f32' */
+f32 w2c_call__indirect__0__wasm_type0x2Df32(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  f32 ret = w2c_call__indirect__0__wasm_type0x2Df32_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'type-f64' */
+f64 w2c_call__indirect__0__wasm_type0x2Df64(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  f64 ret = w2c_call__indirect__0__wasm_type0x2Df64_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'type-f64-i32' */
+struct wasm_multi_di w2c_call__indirect__0__wasm_type0x2Df640x2Di32(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  struct wasm_multi_di ret = w2c_call__indirect__0__wasm_type0x2Df640x2Di32_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'type-index' */
+u64 w2c_call__indirect__0__wasm_type0x2Dindex(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u64 ret = w2c_call__indirect__0__wasm_type0x2Dindex_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'type-first-i32' */
+u32 w2c_call__indirect__0__wasm_type0x2Dfirst0x2Di32(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u32 ret = w2c_call__indirect__0__wasm_type0x2Dfirst0x2Di32_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'type-first-i64' */
+u64 w2c_call__indirect__0__wasm_type0x2Dfirst0x2Di64(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u64 ret = w2c_call__indirect__0__wasm_type0x2Dfirst0x2Di64_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'type-first-f32' */
+f32 w2c_call__indirect__0__wasm_type0x2Dfirst0x2Df32(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  f32 ret = w2c_call__indirect__0__wasm_type0x2Dfirst0x2Df32_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'type-first-f64' */
+f64 w2c_call__indirect__0__wasm_type0x2Dfirst0x2Df64(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  f64 ret = w2c_call__indirect__0__wasm_type0x2Dfirst0x2Df64_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'type-second-i32' */
+u32 w2c_call__indirect__0__wasm_type0x2Dsecond0x2Di32(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u32 ret = w2c_call__indirect__0__wasm_type0x2Dsecond0x2Di32_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'type-second-i64' */
+u64 w2c_call__indirect__0__wasm_type0x2Dsecond0x2Di64(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u64 ret = w2c_call__indirect__0__wasm_type0x2Dsecond0x2Di64_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'type-second-f32' */
+f32 w2c_call__indirect__0__wasm_type0x2Dsecond0x2Df32(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  f32 ret = w2c_call__indirect__0__wasm_type0x2Dsecond0x2Df32_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'type-second-f64' */
+f64 w2c_call__indirect__0__wasm_type0x2Dsecond0x2Df64(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  f64 ret = w2c_call__indirect__0__wasm_type0x2Dsecond0x2Df64_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'type-all-f64-i32' */
+struct wasm_multi_di w2c_call__indirect__0__wasm_type0x2Dall0x2Df640x2Di32(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  struct wasm_multi_di ret = w2c_call__indirect__0__wasm_type0x2Dall0x2Df640x2Di32_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'type-all-i32-f64' */
+struct wasm_multi_id w2c_call__indirect__0__wasm_type0x2Dall0x2Di320x2Df64(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  struct wasm_multi_id ret = w2c_call__indirect__0__wasm_type0x2Dall0x2Di320x2Df64_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'type-all-i32-i64' */
+struct wasm_multi_ji w2c_call__indirect__0__wasm_type0x2Dall0x2Di320x2Di64(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  struct wasm_multi_ji ret = w2c_call__indirect__0__wasm_type0x2Dall0x2Di320x2Di64_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'dispatch' */
+u64 w2c_call__indirect__0__wasm_dispatch(w2c_call__indirect__0__wasm* instance, u32 var_p0, u64 var_p1) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u64 ret = w2c_call__indirect__0__wasm_dispatch_0(instance, var_p0, var_p1);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'dispatch-structural-i64' */
+u64 w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Di64(w2c_call__indirect__0__wasm* instance, u32 var_p0) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u64 ret = w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Di64_0(instance, var_p0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'dispatch-structural-i32' */
+u32 w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Di32(w2c_call__indirect__0__wasm* instance, u32 var_p0) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u32 ret = w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Di32_0(instance, var_p0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'dispatch-structural-f32' */
+f32 w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Df32(w2c_call__indirect__0__wasm* instance, u32 var_p0) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  f32 ret = w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Df32_0(instance, var_p0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'dispatch-structural-f64' */
+f64 w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Df64(w2c_call__indirect__0__wasm* instance, u32 var_p0) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  f64 ret = w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Df64_0(instance, var_p0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'fac-i64' */
+u64 w2c_call__indirect__0__wasm_fac0x2Di64(w2c_call__indirect__0__wasm* instance, u64 var_p0) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u64 ret = w2c_call__indirect__0__wasm_fac0x2Di64_0(instance, var_p0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'fib-i64' */
+u64 w2c_call__indirect__0__wasm_fib0x2Di64(w2c_call__indirect__0__wasm* instance, u64 var_p0) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u64 ret = w2c_call__indirect__0__wasm_fib0x2Di64_0(instance, var_p0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'fac-i32' */
+u32 w2c_call__indirect__0__wasm_fac0x2Di32(w2c_call__indirect__0__wasm* instance, u32 var_p0) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u32 ret = w2c_call__indirect__0__wasm_fac0x2Di32_0(instance, var_p0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'fac-f32' */
+f32 w2c_call__indirect__0__wasm_fac0x2Df32(w2c_call__indirect__0__wasm* instance, f32 var_p0) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  f32 ret = w2c_call__indirect__0__wasm_fac0x2Df32_0(instance, var_p0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'fac-f64' */
+f64 w2c_call__indirect__0__wasm_fac0x2Df64(w2c_call__indirect__0__wasm* instance, f64 var_p0) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  f64 ret = w2c_call__indirect__0__wasm_fac0x2Df64_0(instance, var_p0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'fib-i32' */
+u32 w2c_call__indirect__0__wasm_fib0x2Di32(w2c_call__indirect__0__wasm* instance, u32 var_p0) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u32 ret = w2c_call__indirect__0__wasm_fib0x2Di32_0(instance, var_p0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'fib-f32' */
+f32 w2c_call__indirect__0__wasm_fib0x2Df32(w2c_call__indirect__0__wasm* instance, f32 var_p0) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  f32 ret = w2c_call__indirect__0__wasm_fib0x2Df32_0(instance, var_p0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'fib-f64' */
+f64 w2c_call__indirect__0__wasm_fib0x2Df64(w2c_call__indirect__0__wasm* instance, f64 var_p0) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  f64 ret = w2c_call__indirect__0__wasm_fib0x2Df64_0(instance, var_p0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'even' */
+u32 w2c_call__indirect__0__wasm_even(w2c_call__indirect__0__wasm* instance, u32 var_p0) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u32 ret = w2c_call__indirect__0__wasm_even_0(instance, var_p0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'odd' */
+u32 w2c_call__indirect__0__wasm_odd(w2c_call__indirect__0__wasm* instance, u32 var_p0) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u32 ret = w2c_call__indirect__0__wasm_odd_0(instance, var_p0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'runaway' */
+void w2c_call__indirect__0__wasm_runaway(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  w2c_call__indirect__0__wasm_runaway_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+}
+
+/* export: 'mutual-runaway' */
+void w2c_call__indirect__0__wasm_mutual0x2Drunaway(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  w2c_call__indirect__0__wasm_mutual0x2Drunaway_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+}
+
+/* export: 'as-select-first' */
+u32 w2c_call__indirect__0__wasm_as0x2Dselect0x2Dfirst(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u32 ret = w2c_call__indirect__0__wasm_as0x2Dselect0x2Dfirst_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'as-select-mid' */
+u32 w2c_call__indirect__0__wasm_as0x2Dselect0x2Dmid(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u32 ret = w2c_call__indirect__0__wasm_as0x2Dselect0x2Dmid_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'as-select-last' */
+u32 w2c_call__indirect__0__wasm_as0x2Dselect0x2Dlast(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u32 ret = w2c_call__indirect__0__wasm_as0x2Dselect0x2Dlast_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'as-if-condition' */
+u32 w2c_call__indirect__0__wasm_as0x2Dif0x2Dcondition(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u32 ret = w2c_call__indirect__0__wasm_as0x2Dif0x2Dcondition_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'as-br_if-first' */
+u64 w2c_call__indirect__0__wasm_as0x2Dbr_if0x2Dfirst(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u64 ret = w2c_call__indirect__0__wasm_as0x2Dbr_if0x2Dfirst_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'as-br_if-last' */
+u32 w2c_call__indirect__0__wasm_as0x2Dbr_if0x2Dlast(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u32 ret = w2c_call__indirect__0__wasm_as0x2Dbr_if0x2Dlast_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'as-br_table-first' */
+f32 w2c_call__indirect__0__wasm_as0x2Dbr_table0x2Dfirst(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  f32 ret = w2c_call__indirect__0__wasm_as0x2Dbr_table0x2Dfirst_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'as-br_table-last' */
+u32 w2c_call__indirect__0__wasm_as0x2Dbr_table0x2Dlast(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u32 ret = w2c_call__indirect__0__wasm_as0x2Dbr_table0x2Dlast_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'as-store-first' */
+void w2c_call__indirect__0__wasm_as0x2Dstore0x2Dfirst(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  w2c_call__indirect__0__wasm_as0x2Dstore0x2Dfirst_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+}
+
+/* export: 'as-store-last' */
+void w2c_call__indirect__0__wasm_as0x2Dstore0x2Dlast(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  w2c_call__indirect__0__wasm_as0x2Dstore0x2Dlast_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+}
+
+/* export: 'as-memory.grow-value' */
+u32 w2c_call__indirect__0__wasm_as0x2Dmemory0x2Egrow0x2Dvalue(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u32 ret = w2c_call__indirect__0__wasm_as0x2Dmemory0x2Egrow0x2Dvalue_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'as-return-value' */
+u32 w2c_call__indirect__0__wasm_as0x2Dreturn0x2Dvalue(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u32 ret = w2c_call__indirect__0__wasm_as0x2Dreturn0x2Dvalue_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'as-drop-operand' */
+void w2c_call__indirect__0__wasm_as0x2Ddrop0x2Doperand(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  w2c_call__indirect__0__wasm_as0x2Ddrop0x2Doperand_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+}
+
+/* export: 'as-br-value' */
+f32 w2c_call__indirect__0__wasm_as0x2Dbr0x2Dvalue(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  f32 ret = w2c_call__indirect__0__wasm_as0x2Dbr0x2Dvalue_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'as-local.set-value' */
+f64 w2c_call__indirect__0__wasm_as0x2Dlocal0x2Eset0x2Dvalue(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  f64 ret = w2c_call__indirect__0__wasm_as0x2Dlocal0x2Eset0x2Dvalue_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'as-local.tee-value' */
+f64 w2c_call__indirect__0__wasm_as0x2Dlocal0x2Etee0x2Dvalue(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  f64 ret = w2c_call__indirect__0__wasm_as0x2Dlocal0x2Etee0x2Dvalue_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'as-global.set-value' */
+f64 w2c_call__indirect__0__wasm_as0x2Dglobal0x2Eset0x2Dvalue(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  f64 ret = w2c_call__indirect__0__wasm_as0x2Dglobal0x2Eset0x2Dvalue_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'as-load-operand' */
+u32 w2c_call__indirect__0__wasm_as0x2Dload0x2Doperand(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u32 ret = w2c_call__indirect__0__wasm_as0x2Dload0x2Doperand_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'as-unary-operand' */
+f32 w2c_call__indirect__0__wasm_as0x2Dunary0x2Doperand(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  f32 ret = w2c_call__indirect__0__wasm_as0x2Dunary0x2Doperand_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'as-binary-left' */
+u32 w2c_call__indirect__0__wasm_as0x2Dbinary0x2Dleft(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u32 ret = w2c_call__indirect__0__wasm_as0x2Dbinary0x2Dleft_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'as-binary-right' */
+u32 w2c_call__indirect__0__wasm_as0x2Dbinary0x2Dright(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u32 ret = w2c_call__indirect__0__wasm_as0x2Dbinary0x2Dright_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'as-test-operand' */
+u32 w2c_call__indirect__0__wasm_as0x2Dtest0x2Doperand(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u32 ret = w2c_call__indirect__0__wasm_as0x2Dtest0x2Doperand_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'as-compare-left' */
+u32 w2c_call__indirect__0__wasm_as0x2Dcompare0x2Dleft(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u32 ret = w2c_call__indirect__0__wasm_as0x2Dcompare0x2Dleft_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'as-compare-right' */
+u32 w2c_call__indirect__0__wasm_as0x2Dcompare0x2Dright(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u32 ret = w2c_call__indirect__0__wasm_as0x2Dcompare0x2Dright_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+/* export: 'as-convert-operand' */
+u64 w2c_call__indirect__0__wasm_as0x2Dconvert0x2Doperand(w2c_call__indirect__0__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u64 ret = w2c_call__indirect__0__wasm_as0x2Dconvert0x2Doperand_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+void wasm2c_call__indirect__0__wasm_instantiate(w2c_call__indirect__0__wasm* instance) {
+  assert(wasm_rt_is_initialized());
+  init_globals(instance);
+  init_tables(instance);
+  init_memories(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  init_elem_instances(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+}
+
+void wasm2c_call__indirect__0__wasm_free(w2c_call__indirect__0__wasm* instance) {
+  wasm_rt_free_funcref_table(&instance->w2c_T0);
+  wasm_rt_free_funcref_table(&instance->w2c_T1);
+  wasm_rt_free_memory(&instance->w2c_M0);
+}
+
+wasm_rt_func_type_t wasm2c_call__indirect__0__wasm_get_func_type(uint32_t param_count, uint32_t result_count, ...) {
+  va_list args;
+  
+  if (param_count == 0 && result_count == 0) {
+    va_start(args, result_count);
+    if (true) {
+      va_end(args);
+      return w2c_call__indirect__0__wasm_t0;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 0 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I32) {
+      va_end(args);
+      return w2c_call__indirect__0__wasm_t1;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 0 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I64) {
+      va_end(args);
+      return w2c_call__indirect__0__wasm_t2;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 0 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_F32) {
+      va_end(args);
+      return w2c_call__indirect__0__wasm_t3;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 0 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_F64) {
+      va_end(args);
+      return w2c_call__indirect__0__wasm_t4;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 0 && result_count == 2) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_F64 && va_arg(args, int) == WASM_RT_I32) {
+      va_end(args);
+      return w2c_call__indirect__0__wasm_t5;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 1 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_I32) {
+      va_end(args);
+      return w2c_call__indirect__0__wasm_t6;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 1 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I64 && va_arg(args, int) == WASM_RT_I64) {
+      va_end(args);
+      return w2c_call__indirect__0__wasm_t7;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 1 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_F32 && va_arg(args, int) == WASM_RT_F32) {
+      va_end(args);
+      return w2c_call__indirect__0__wasm_t8;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 1 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_F64 && va_arg(args, int) == WASM_RT_F64) {
+      va_end(args);
+      return w2c_call__indirect__0__wasm_t9;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 2 && result_count == 2) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_F64 && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_F64) {
+      va_end(args);
+      return w2c_call__indirect__0__wasm_t10;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 2 && result_count == 2) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_I64 && va_arg(args, int) == WASM_RT_I64 && va_arg(args, int) == WASM_RT_I32) {
+      va_end(args);
+      return w2c_call__indirect__0__wasm_t11;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 2 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_F32 && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_I32) {
+      va_end(args);
+      return w2c_call__indirect__0__wasm_t12;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 2 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_I64 && va_arg(args, int) == WASM_RT_I64) {
+      va_end(args);
+      return w2c_call__indirect__0__wasm_t13;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 2 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_F64 && va_arg(args, int) == WASM_RT_F32 && va_arg(args, int) == WASM_RT_F32) {
+      va_end(args);
+      return w2c_call__indirect__0__wasm_t14;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 2 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I64 && va_arg(args, int) == WASM_RT_F64 && va_arg(args, int) == WASM_RT_F64) {
+      va_end(args);
+      return w2c_call__indirect__0__wasm_t15;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 1 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_I32) {
+      va_end(args);
+      return w2c_call__indirect__0__wasm_t6;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 1 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I64 && va_arg(args, int) == WASM_RT_I64) {
+      va_end(args);
+      return w2c_call__indirect__0__wasm_t7;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 1 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_F32 && va_arg(args, int) == WASM_RT_F32) {
+      va_end(args);
+      return w2c_call__indirect__0__wasm_t8;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 1 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_F64 && va_arg(args, int) == WASM_RT_F64) {
+      va_end(args);
+      return w2c_call__indirect__0__wasm_t9;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 1 && result_count == 0) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I64) {
+      va_end(args);
+      return w2c_call__indirect__0__wasm_t20;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 4 && result_count == 0) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I64 && va_arg(args, int) == WASM_RT_F64 && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_I64) {
+      va_end(args);
+      return w2c_call__indirect__0__wasm_t21;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 1 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I64 && va_arg(args, int) == WASM_RT_I32) {
+      va_end(args);
+      return w2c_call__indirect__0__wasm_t22;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 4 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I64 && va_arg(args, int) == WASM_RT_F64 && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_I64 && va_arg(args, int) == WASM_RT_I32) {
+      va_end(args);
+      return w2c_call__indirect__0__wasm_t23;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 0 && result_count == 2) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_F64) {
+      va_end(args);
+      return w2c_call__indirect__0__wasm_t24;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 0 && result_count == 2) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I64 && va_arg(args, int) == WASM_RT_I32) {
+      va_end(args);
+      return w2c_call__indirect__0__wasm_t25;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 1 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_I64) {
+      va_end(args);
+      return w2c_call__indirect__0__wasm_t26;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 1 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_F32) {
+      va_end(args);
+      return w2c_call__indirect__0__wasm_t27;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 1 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_F64) {
+      va_end(args);
+      return w2c_call__indirect__0__wasm_t28;
+    }
+    va_end(args);
+  }
+  
+  return NULL;
+}
+
+u32 w2c_call__indirect__0__wasm_f0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  var_i0 = 306u;
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u64 w2c_call__indirect__0__wasm_f1(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u64 var_j0;
+  var_j0 = 356ull;
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+f32 w2c_call__indirect__0__wasm_f2(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  f32 var_f0;
+  var_f0 = 3890.0f;
+  FUNC_EPILOGUE;
+  return var_f0;
+}
+
+f64 w2c_call__indirect__0__wasm_f3(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  f64 var_d0;
+  var_d0 = 3940.0;
+  FUNC_EPILOGUE;
+  return var_d0;
+}
+
+struct wasm_multi_di w2c_call__indirect__0__wasm_f4(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i1;
+  f64 var_d0;
+  var_d0 = 3940.0;
+  var_i1 = 32u;
+  FUNC_EPILOGUE;
+  {
+    struct wasm_multi_di tmp;
+    tmp.d0 = var_d0;
+    tmp.i1 = var_i1;
+    return tmp;
+  }
+}
+
+u32 w2c_call__indirect__0__wasm_f5(w2c_call__indirect__0__wasm* instance, u32 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  var_i0 = var_p0;
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u64 w2c_call__indirect__0__wasm_f6(w2c_call__indirect__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u64 var_j0;
+  var_j0 = var_p0;
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+f32 w2c_call__indirect__0__wasm_f7(w2c_call__indirect__0__wasm* instance, f32 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  f32 var_f0;
+  var_f0 = var_p0;
+  FUNC_EPILOGUE;
+  return var_f0;
+}
+
+f64 w2c_call__indirect__0__wasm_f8(w2c_call__indirect__0__wasm* instance, f64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  f64 var_d0;
+  var_d0 = var_p0;
+  FUNC_EPILOGUE;
+  return var_d0;
+}
+
+struct wasm_multi_id w2c_call__indirect__0__wasm_f9(w2c_call__indirect__0__wasm* instance, u32 var_p0, f64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  f64 var_d1;
+  var_i0 = var_p0;
+  var_d1 = var_p1;
+  FUNC_EPILOGUE;
+  {
+    struct wasm_multi_id tmp;
+    tmp.i0 = var_i0;
+    tmp.d1 = var_d1;
+    return tmp;
+  }
+}
+
+struct wasm_multi_ji w2c_call__indirect__0__wasm_f10(w2c_call__indirect__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i1;
+  u64 var_j0;
+  var_j0 = var_p1;
+  var_i1 = var_p0;
+  FUNC_EPILOGUE;
+  {
+    struct wasm_multi_ji tmp;
+    tmp.j0 = var_j0;
+    tmp.i1 = var_i1;
+    return tmp;
+  }
+}
+
+u64 w2c_call__indirect__0__wasm_f11(w2c_call__indirect__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u64 var_j0;
+  var_j0 = var_p1;
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+f64 w2c_call__indirect__0__wasm_f12(w2c_call__indirect__0__wasm* instance, u64 var_p0, f64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  f64 var_d0;
+  var_d0 = var_p1;
+  FUNC_EPILOGUE;
+  return var_d0;
+}
+
+u32 w2c_call__indirect__0__wasm_f13(w2c_call__indirect__0__wasm* instance, f32 var_p0, u32 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  var_i0 = var_p1;
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+f32 w2c_call__indirect__0__wasm_f14(w2c_call__indirect__0__wasm* instance, f64 var_p0, f32 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  f32 var_f0;
+  var_f0 = var_p1;
+  FUNC_EPILOGUE;
+  return var_f0;
+}
+
+u32 w2c_call__indirect__0__wasm_f15(w2c_call__indirect__0__wasm* instance, u32 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  var_i0 = var_p0;
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u64 w2c_call__indirect__0__wasm_f16(w2c_call__indirect__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u64 var_j0;
+  var_j0 = var_p0;
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+f32 w2c_call__indirect__0__wasm_f17(w2c_call__indirect__0__wasm* instance, f32 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  f32 var_f0;
+  var_f0 = var_p0;
+  FUNC_EPILOGUE;
+  return var_f0;
+}
+
+f64 w2c_call__indirect__0__wasm_f18(w2c_call__indirect__0__wasm* instance, f64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  f64 var_d0;
+  var_d0 = var_p0;
+  FUNC_EPILOGUE;
+  return var_d0;
+}
+
+void w2c_call__indirect__0__wasm_f19(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1, var_i2, var_i4;
+  u64 var_j0, var_j3;
+  f64 var_d1;
+  var_i0 = 0u;
+  CALL_INDIRECT(instance->w2c_T0, void (*)(void*), w2c_call__indirect__0__wasm_t0, var_i0, instance->w2c_T0.data[var_i0].module_instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  var_j0 = 0ull;
+  CALL_INDIRECT(instance->w2c_T1, void (*)(void*), w2c_call__indirect__0__wasm_t0, var_j0, instance->w2c_T1.data[var_j0].module_instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  var_j0 = 0ull;
+  var_i1 = 0u;
+  CALL_INDIRECT(instance->w2c_T0, void (*)(void*, u64), w2c_call__indirect__0__wasm_t20, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_j0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  var_j0 = 0ull;
+  var_d1 = 0.0;
+  var_i2 = 0u;
+  var_j3 = 0ull;
+  var_i4 = 0u;
+  CALL_INDIRECT(instance->w2c_T0, void (*)(void*, u64, f64, u32, u64), w2c_call__indirect__0__wasm_t21, var_i4, instance->w2c_T0.data[var_i4].module_instance, var_j0, var_d1, var_i2, var_j3);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  var_i0 = 0u;
+  CALL_INDIRECT(instance->w2c_T0, void (*)(void*), w2c_call__indirect__0__wasm_t0, var_i0, instance->w2c_T0.data[var_i0].module_instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  var_i0 = 0u;
+  var_i0 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*), w2c_call__indirect__0__wasm_t1, var_i0, instance->w2c_T0.data[var_i0].module_instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  var_i0 = !(var_i0);
+  var_i0 = 0u;
+  var_i0 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*), w2c_call__indirect__0__wasm_t1, var_i0, instance->w2c_T0.data[var_i0].module_instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  var_i0 = !(var_i0);
+  var_j0 = 0ull;
+  var_i1 = 0u;
+  var_i0 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*, u64), w2c_call__indirect__0__wasm_t22, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_j0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  var_i0 = !(var_i0);
+  var_j0 = 0ull;
+  var_d1 = 0.0;
+  var_i2 = 0u;
+  var_j3 = 0ull;
+  var_i4 = 0u;
+  var_i0 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*, u64, f64, u32, u64), w2c_call__indirect__0__wasm_t23, var_i4, instance->w2c_T0.data[var_i4].module_instance, var_j0, var_d1, var_i2, var_j3);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  var_i0 = !(var_i0);
+  var_j0 = 0ull;
+  var_i1 = 0u;
+  var_j0 = CALL_INDIRECT(instance->w2c_T0, u64 (*)(void*, u64), w2c_call__indirect__0__wasm_t7, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_j0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  var_i0 = !(var_j0);
+  FUNC_EPILOGUE;
+}
+
+u32 w2c_call__indirect__0__wasm_type0x2Di32_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  var_i0 = 0u;
+  var_i0 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*), w2c_call__indirect__0__wasm_t1, var_i0, instance->w2c_T0.data[var_i0].module_instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_call__indirect__0__wasm_type0x2Di320x2Dt64_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_j0 = 0ull;
+  var_i0 = CALL_INDIRECT(instance->w2c_T1, u32 (*)(void*), w2c_call__indirect__0__wasm_t1, var_j0, instance->w2c_T1.data[var_j0].module_instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u64 w2c_call__indirect__0__wasm_type0x2Di64_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_i0 = 1u;
+  var_j0 = CALL_INDIRECT(instance->w2c_T0, u64 (*)(void*), w2c_call__indirect__0__wasm_t2, var_i0, instance->w2c_T0.data[var_i0].module_instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+f32 w2c_call__indirect__0__wasm_type0x2Df32_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  f32 var_f0;
+  var_i0 = 2u;
+  var_f0 = CALL_INDIRECT(instance->w2c_T0, f32 (*)(void*), w2c_call__indirect__0__wasm_t3, var_i0, instance->w2c_T0.data[var_i0].module_instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  FUNC_EPILOGUE;
+  return var_f0;
+}
+
+f64 w2c_call__indirect__0__wasm_type0x2Df64_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  f64 var_d0;
+  var_i0 = 3u;
+  var_d0 = CALL_INDIRECT(instance->w2c_T0, f64 (*)(void*), w2c_call__indirect__0__wasm_t4, var_i0, instance->w2c_T0.data[var_i0].module_instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  FUNC_EPILOGUE;
+  return var_d0;
+}
+
+struct wasm_multi_di w2c_call__indirect__0__wasm_type0x2Df640x2Di32_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  f64 var_d0;
+  var_i0 = 29u;
+  {
+    struct wasm_multi_di tmp = CALL_INDIRECT(instance->w2c_T0, struct wasm_multi_di (*)(void*), w2c_call__indirect__0__wasm_t5, var_i0, instance->w2c_T0.data[var_i0].module_instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+    wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+    wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+    var_d0 = tmp.d0;
+    var_i1 = tmp.i1;
+  }
+  FUNC_EPILOGUE;
+  {
+    struct wasm_multi_di tmp;
+    tmp.d0 = var_d0;
+    tmp.i1 = var_i1;
+    return tmp;
+  }
+}
+
+u64 w2c_call__indirect__0__wasm_type0x2Dindex_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i1;
+  u64 var_j0;
+  var_j0 = 100ull;
+  var_i1 = 5u;
+  var_j0 = CALL_INDIRECT(instance->w2c_T0, u64 (*)(void*, u64), w2c_call__indirect__0__wasm_t7, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_j0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u32 w2c_call__indirect__0__wasm_type0x2Dfirst0x2Di32_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = 32u;
+  var_i1 = 4u;
+  var_i0 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*, u32), w2c_call__indirect__0__wasm_t6, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_i0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u64 w2c_call__indirect__0__wasm_type0x2Dfirst0x2Di64_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i1;
+  u64 var_j0;
+  var_j0 = 64ull;
+  var_i1 = 5u;
+  var_j0 = CALL_INDIRECT(instance->w2c_T0, u64 (*)(void*, u64), w2c_call__indirect__0__wasm_t7, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_j0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+f32 w2c_call__indirect__0__wasm_type0x2Dfirst0x2Df32_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i1;
+  f32 var_f0;
+  var_f0 = 1.32000005f;
+  var_i1 = 6u;
+  var_f0 = CALL_INDIRECT(instance->w2c_T0, f32 (*)(void*, f32), w2c_call__indirect__0__wasm_t8, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_f0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  FUNC_EPILOGUE;
+  return var_f0;
+}
+
+f64 w2c_call__indirect__0__wasm_type0x2Dfirst0x2Df64_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i1;
+  f64 var_d0;
+  var_d0 = 1.6399999999999999;
+  var_i1 = 7u;
+  var_d0 = CALL_INDIRECT(instance->w2c_T0, f64 (*)(void*, f64), w2c_call__indirect__0__wasm_t9, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_d0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  FUNC_EPILOGUE;
+  return var_d0;
+}
+
+u32 w2c_call__indirect__0__wasm_type0x2Dsecond0x2Di32_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1, var_i2;
+  f32 var_f0;
+  var_f0 = 32.0999985f;
+  var_i1 = 32u;
+  var_i2 = 8u;
+  var_i0 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*, f32, u32), w2c_call__indirect__0__wasm_t12, var_i2, instance->w2c_T0.data[var_i2].module_instance, var_f0, var_i1);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u64 w2c_call__indirect__0__wasm_type0x2Dsecond0x2Di64_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i2;
+  u64 var_j0, var_j1;
+  var_i0 = 32u;
+  var_j1 = 64ull;
+  var_i2 = 9u;
+  var_j0 = CALL_INDIRECT(instance->w2c_T0, u64 (*)(void*, u32, u64), w2c_call__indirect__0__wasm_t13, var_i2, instance->w2c_T0.data[var_i2].module_instance, var_i0, var_j1);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+f32 w2c_call__indirect__0__wasm_type0x2Dsecond0x2Df32_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i2;
+  f32 var_f0, var_f1;
+  f64 var_d0;
+  var_d0 = 64.0;
+  var_f1 = 32.0f;
+  var_i2 = 10u;
+  var_f0 = CALL_INDIRECT(instance->w2c_T0, f32 (*)(void*, f64, f32), w2c_call__indirect__0__wasm_t14, var_i2, instance->w2c_T0.data[var_i2].module_instance, var_d0, var_f1);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  FUNC_EPILOGUE;
+  return var_f0;
+}
+
+f64 w2c_call__indirect__0__wasm_type0x2Dsecond0x2Df64_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i2;
+  u64 var_j0;
+  f64 var_d0, var_d1;
+  var_j0 = 64ull;
+  var_d1 = 64.099999999999994;
+  var_i2 = 11u;
+  var_d0 = CALL_INDIRECT(instance->w2c_T0, f64 (*)(void*, u64, f64), w2c_call__indirect__0__wasm_t15, var_i2, instance->w2c_T0.data[var_i2].module_instance, var_j0, var_d1);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  FUNC_EPILOGUE;
+  return var_d0;
+}
+
+struct wasm_multi_di w2c_call__indirect__0__wasm_type0x2Dall0x2Df640x2Di32_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  f64 var_d0;
+  var_i0 = 29u;
+  {
+    struct wasm_multi_di tmp = CALL_INDIRECT(instance->w2c_T0, struct wasm_multi_di (*)(void*), w2c_call__indirect__0__wasm_t5, var_i0, instance->w2c_T0.data[var_i0].module_instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+    wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+    wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+    var_d0 = tmp.d0;
+    var_i1 = tmp.i1;
+  }
+  FUNC_EPILOGUE;
+  {
+    struct wasm_multi_di tmp;
+    tmp.d0 = var_d0;
+    tmp.i1 = var_i1;
+    return tmp;
+  }
+}
+
+struct wasm_multi_id w2c_call__indirect__0__wasm_type0x2Dall0x2Di320x2Df64_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i2;
+  f64 var_d1;
+  var_i0 = 1u;
+  var_d1 = 2.0;
+  var_i2 = 30u;
+  {
+    struct wasm_multi_id tmp = CALL_INDIRECT(instance->w2c_T0, struct wasm_multi_id (*)(void*, u32, f64), w2c_call__indirect__0__wasm_t10, var_i2, instance->w2c_T0.data[var_i2].module_instance, var_i0, var_d1);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+    wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+    wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+    var_i0 = tmp.i0;
+    var_d1 = tmp.d1;
+  }
+  FUNC_EPILOGUE;
+  {
+    struct wasm_multi_id tmp;
+    tmp.i0 = var_i0;
+    tmp.d1 = var_d1;
+    return tmp;
+  }
+}
+
+struct wasm_multi_ji w2c_call__indirect__0__wasm_type0x2Dall0x2Di320x2Di64_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1, var_i2;
+  u64 var_j0, var_j1;
+  var_i0 = 1u;
+  var_j1 = 2ull;
+  var_i2 = 31u;
+  {
+    struct wasm_multi_ji tmp = CALL_INDIRECT(instance->w2c_T0, struct wasm_multi_ji (*)(void*, u32, u64), w2c_call__indirect__0__wasm_t11, var_i2, instance->w2c_T0.data[var_i2].module_instance, var_i0, var_j1);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+    wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+    wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+    var_j0 = tmp.j0;
+    var_i1 = tmp.i1;
+  }
+  FUNC_EPILOGUE;
+  {
+    struct wasm_multi_ji tmp;
+    tmp.j0 = var_j0;
+    tmp.i1 = var_i1;
+    return tmp;
+  }
+}
+
+u64 w2c_call__indirect__0__wasm_dispatch_0(w2c_call__indirect__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i1;
+  u64 var_j0;
+  var_j0 = var_p1;
+  var_i1 = var_p0;
+  var_j0 = CALL_INDIRECT(instance->w2c_T0, u64 (*)(void*, u64), w2c_call__indirect__0__wasm_t7, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_j0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u64 w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Di64_0(w2c_call__indirect__0__wasm* instance, u32 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i1;
+  u64 var_j0;
+  var_j0 = 9ull;
+  var_i1 = var_p0;
+  var_j0 = CALL_INDIRECT(instance->w2c_T0, u64 (*)(void*, u64), w2c_call__indirect__0__wasm_t7, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_j0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u32 w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Di32_0(w2c_call__indirect__0__wasm* instance, u32 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = 9u;
+  var_i1 = var_p0;
+  var_i0 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*, u32), w2c_call__indirect__0__wasm_t6, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_i0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+f32 w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Df32_0(w2c_call__indirect__0__wasm* instance, u32 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i1;
+  f32 var_f0;
+  var_f0 = 9.0f;
+  var_i1 = var_p0;
+  var_f0 = CALL_INDIRECT(instance->w2c_T0, f32 (*)(void*, f32), w2c_call__indirect__0__wasm_t8, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_f0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  FUNC_EPILOGUE;
+  return var_f0;
+}
+
+f64 w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Df64_0(w2c_call__indirect__0__wasm* instance, u32 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i1;
+  f64 var_d0;
+  var_d0 = 9.0;
+  var_i1 = var_p0;
+  var_d0 = CALL_INDIRECT(instance->w2c_T0, f64 (*)(void*, f64), w2c_call__indirect__0__wasm_t9, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_d0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  FUNC_EPILOGUE;
+  return var_d0;
+}
+
+u64 w2c_call__indirect__0__wasm_fac0x2Di64_0(w2c_call__indirect__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i2;
+  u64 var_j0, var_j1, var_j2;
+  var_j0 = var_p0;
+  var_i0 = !(var_j0);
+  if (var_i0) {
+    var_j0 = 1ull;
+  } else {
+    var_j0 = var_p0;
+    var_j1 = var_p0;
+    var_j2 = 1ull;
+    var_j1 -= var_j2;
+    var_i2 = 12u;
+    var_j1 = CALL_INDIRECT(instance->w2c_T0, u64 (*)(void*, u64), w2c_call__indirect__0__wasm_t7, var_i2, instance->w2c_T0.data[var_i2].module_instance, var_j1);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+    wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+    wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+    var_j0 *= var_j1;
+  }
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u64 w2c_call__indirect__0__wasm_fib0x2Di64_0(w2c_call__indirect__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1, var_i2;
+  u64 var_j0, var_j1, var_j2;
+  var_j0 = var_p0;
+  var_j1 = 1ull;
+  var_i0 = var_j0 <= var_j1;
+  if (var_i0) {
+    var_j0 = 1ull;
+  } else {
+    var_j0 = var_p0;
+    var_j1 = 2ull;
+    var_j0 -= var_j1;
+    var_i1 = 13u;
+    var_j0 = CALL_INDIRECT(instance->w2c_T0, u64 (*)(void*, u64), w2c_call__indirect__0__wasm_t7, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_j0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+    wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+    wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+    var_j1 = var_p0;
+    var_j2 = 1ull;
+    var_j1 -= var_j2;
+    var_i2 = 13u;
+    var_j1 = CALL_INDIRECT(instance->w2c_T0, u64 (*)(void*, u64), w2c_call__indirect__0__wasm_t7, var_i2, instance->w2c_T0.data[var_i2].module_instance, var_j1);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+    wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+    wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+    var_j0 += var_j1;
+  }
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u32 w2c_call__indirect__0__wasm_fac0x2Di32_0(w2c_call__indirect__0__wasm* instance, u32 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1, var_i2;
+  var_i0 = var_p0;
+  var_i0 = !(var_i0);
+  if (var_i0) {
+    var_i0 = 1u;
+  } else {
+    var_i0 = var_p0;
+    var_i1 = var_p0;
+    var_i2 = 1u;
+    var_i1 -= var_i2;
+    var_i2 = 23u;
+    var_i1 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*, u32), w2c_call__indirect__0__wasm_t6, var_i2, instance->w2c_T0.data[var_i2].module_instance, var_i1);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+    wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+    wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+    var_i0 *= var_i1;
+  }
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+f32 w2c_call__indirect__0__wasm_fac0x2Df32_0(w2c_call__indirect__0__wasm* instance, f32 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i2;
+  f32 var_f0, var_f1, var_f2;
+  var_f0 = var_p0;
+  var_f1 = 0.0f;
+  var_i0 = var_f0 == var_f1;
+  if (var_i0) {
+    var_f0 = 1.0f;
+  } else {
+    var_f0 = var_p0;
+    var_f1 = var_p0;
+    var_f2 = 1.0f;
+    var_f1 -= var_f2;
+    var_i2 = 24u;
+    var_f1 = CALL_INDIRECT(instance->w2c_T0, f32 (*)(void*, f32), w2c_call__indirect__0__wasm_t8, var_i2, instance->w2c_T0.data[var_i2].module_instance, var_f1);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+    wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+    wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+    var_f0 *= var_f1;
+  }
+  FUNC_EPILOGUE;
+  return var_f0;
+}
+
+f64 w2c_call__indirect__0__wasm_fac0x2Df64_0(w2c_call__indirect__0__wasm* instance, f64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i2;
+  f64 var_d0, var_d1, var_d2;
+  var_d0 = var_p0;
+  var_d1 = 0.0;
+  var_i0 = var_d0 == var_d1;
+  if (var_i0) {
+    var_d0 = 1.0;
+  } else {
+    var_d0 = var_p0;
+    var_d1 = var_p0;
+    var_d2 = 1.0;
+    var_d1 -= var_d2;
+    var_i2 = 25u;
+    var_d1 = CALL_INDIRECT(instance->w2c_T0, f64 (*)(void*, f64), w2c_call__indirect__0__wasm_t9, var_i2, instance->w2c_T0.data[var_i2].module_instance, var_d1);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+    wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+    wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+    var_d0 *= var_d1;
+  }
+  FUNC_EPILOGUE;
+  return var_d0;
+}
+
+u32 w2c_call__indirect__0__wasm_fib0x2Di32_0(w2c_call__indirect__0__wasm* instance, u32 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1, var_i2;
+  var_i0 = var_p0;
+  var_i1 = 1u;
+  var_i0 = var_i0 <= var_i1;
+  if (var_i0) {
+    var_i0 = 1u;
+  } else {
+    var_i0 = var_p0;
+    var_i1 = 2u;
+    var_i0 -= var_i1;
+    var_i1 = 26u;
+    var_i0 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*, u32), w2c_call__indirect__0__wasm_t6, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_i0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+    wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+    wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+    var_i1 = var_p0;
+    var_i2 = 1u;
+    var_i1 -= var_i2;
+    var_i2 = 26u;
+    var_i1 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*, u32), w2c_call__indirect__0__wasm_t6, var_i2, instance->w2c_T0.data[var_i2].module_instance, var_i1);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+    wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+    wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+    var_i0 += var_i1;
+  }
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+f32 w2c_call__indirect__0__wasm_fib0x2Df32_0(w2c_call__indirect__0__wasm* instance, f32 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1, var_i2;
+  f32 var_f0, var_f1, var_f2;
+  var_f0 = var_p0;
+  var_f1 = 1.0f;
+  var_i0 = var_f0 <= var_f1;
+  if (var_i0) {
+    var_f0 = 1.0f;
+  } else {
+    var_f0 = var_p0;
+    var_f1 = 2.0f;
+    var_f0 -= var_f1;
+    var_i1 = 27u;
+    var_f0 = CALL_INDIRECT(instance->w2c_T0, f32 (*)(void*, f32), w2c_call__indirect__0__wasm_t8, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_f0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+    wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+    wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+    var_f1 = var_p0;
+    var_f2 = 1.0f;
+    var_f1 -= var_f2;
+    var_i2 = 27u;
+    var_f1 = CALL_INDIRECT(instance->w2c_T0, f32 (*)(void*, f32), w2c_call__indirect__0__wasm_t8, var_i2, instance->w2c_T0.data[var_i2].module_instance, var_f1);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+    wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+    wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+    var_f0 += var_f1;
+  }
+  FUNC_EPILOGUE;
+  return var_f0;
+}
+
+f64 w2c_call__indirect__0__wasm_fib0x2Df64_0(w2c_call__indirect__0__wasm* instance, f64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1, var_i2;
+  f64 var_d0, var_d1, var_d2;
+  var_d0 = var_p0;
+  var_d1 = 1.0;
+  var_i0 = var_d0 <= var_d1;
+  if (var_i0) {
+    var_d0 = 1.0;
+  } else {
+    var_d0 = var_p0;
+    var_d1 = 2.0;
+    var_d0 -= var_d1;
+    var_i1 = 28u;
+    var_d0 = CALL_INDIRECT(instance->w2c_T0, f64 (*)(void*, f64), w2c_call__indirect__0__wasm_t9, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_d0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+    wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+    wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+    var_d1 = var_p0;
+    var_d2 = 1.0;
+    var_d1 -= var_d2;
+    var_i2 = 28u;
+    var_d1 = CALL_INDIRECT(instance->w2c_T0, f64 (*)(void*, f64), w2c_call__indirect__0__wasm_t9, var_i2, instance->w2c_T0.data[var_i2].module_instance, var_d1);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+    wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+    wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+    var_d0 += var_d1;
+  }
+  FUNC_EPILOGUE;
+  return var_d0;
+}
+
+u32 w2c_call__indirect__0__wasm_even_0(w2c_call__indirect__0__wasm* instance, u32 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = var_p0;
+  var_i0 = !(var_i0);
+  if (var_i0) {
+    var_i0 = 44u;
+  } else {
+    var_i0 = var_p0;
+    var_i1 = 1u;
+    var_i0 -= var_i1;
+    var_i1 = 15u;
+    var_i0 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*, u32), w2c_call__indirect__0__wasm_t6, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_i0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+    wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+    wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  }
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_call__indirect__0__wasm_odd_0(w2c_call__indirect__0__wasm* instance, u32 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = var_p0;
+  var_i0 = !(var_i0);
+  if (var_i0) {
+    var_i0 = 99u;
+  } else {
+    var_i0 = var_p0;
+    var_i1 = 1u;
+    var_i0 -= var_i1;
+    var_i1 = 14u;
+    var_i0 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*, u32), w2c_call__indirect__0__wasm_t6, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_i0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+    wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+    wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  }
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+void w2c_call__indirect__0__wasm_runaway_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  var_i0 = 16u;
+  CALL_INDIRECT(instance->w2c_T0, void (*)(void*), w2c_call__indirect__0__wasm_t0, var_i0, instance->w2c_T0.data[var_i0].module_instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  FUNC_EPILOGUE;
+}
+
+void w2c_call__indirect__0__wasm_mutual0x2Drunaway_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  var_i0 = 18u;
+  CALL_INDIRECT(instance->w2c_T0, void (*)(void*), w2c_call__indirect__0__wasm_t0, var_i0, instance->w2c_T0.data[var_i0].module_instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  FUNC_EPILOGUE;
+}
+
+void w2c_call__indirect__0__wasm_f55(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  var_i0 = 17u;
+  CALL_INDIRECT(instance->w2c_T0, void (*)(void*), w2c_call__indirect__0__wasm_t0, var_i0, instance->w2c_T0.data[var_i0].module_instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  FUNC_EPILOGUE;
+}
+
+u32 w2c_call__indirect__0__wasm_as0x2Dselect0x2Dfirst_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1, var_i2;
+  var_i0 = 0u;
+  var_i0 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*), w2c_call__indirect__0__wasm_t1, var_i0, instance->w2c_T0.data[var_i0].module_instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  var_i1 = 2u;
+  var_i2 = 3u;
+  var_i0 = var_i2 ? var_i0 : var_i1;
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_call__indirect__0__wasm_as0x2Dselect0x2Dmid_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1, var_i2;
+  var_i0 = 2u;
+  var_i1 = 0u;
+  var_i1 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*), w2c_call__indirect__0__wasm_t1, var_i1, instance->w2c_T0.data[var_i1].module_instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  var_i2 = 3u;
+  var_i0 = var_i2 ? var_i0 : var_i1;
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_call__indirect__0__wasm_as0x2Dselect0x2Dlast_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1, var_i2;
+  var_i0 = 2u;
+  var_i1 = 3u;
+  var_i2 = 0u;
+  var_i2 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*), w2c_call__indirect__0__wasm_t1, var_i2, instance->w2c_T0.data[var_i2].module_instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  var_i0 = var_i2 ? var_i0 : var_i1;
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_call__indirect__0__wasm_as0x2Dif0x2Dcondition_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  var_i0 = 0u;
+  var_i0 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*), w2c_call__indirect__0__wasm_t1, var_i0, instance->w2c_T0.data[var_i0].module_instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  if (var_i0) {
+    var_i0 = 1u;
+  } else {
+    var_i0 = 2u;
+  }
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u64 w2c_call__indirect__0__wasm_as0x2Dbr_if0x2Dfirst_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  u64 var_j0;
+  var_i0 = 1u;
+  var_j0 = CALL_INDIRECT(instance->w2c_T0, u64 (*)(void*), w2c_call__indirect__0__wasm_t2, var_i0, instance->w2c_T0.data[var_i0].module_instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  var_i1 = 2u;
+  if (var_i1) {goto var_B0;}
+  var_B0:;
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u32 w2c_call__indirect__0__wasm_as0x2Dbr_if0x2Dlast_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = 2u;
+  var_i1 = 0u;
+  var_i1 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*), w2c_call__indirect__0__wasm_t1, var_i1, instance->w2c_T0.data[var_i1].module_instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  if (var_i1) {goto var_B0;}
+  var_B0:;
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+f32 w2c_call__indirect__0__wasm_as0x2Dbr_table0x2Dfirst_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  f32 var_f0;
+  var_i0 = 2u;
+  var_f0 = CALL_INDIRECT(instance->w2c_T0, f32 (*)(void*), w2c_call__indirect__0__wasm_t3, var_i0, instance->w2c_T0.data[var_i0].module_instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  var_i1 = 2u;
+  switch (var_i1) {
+    case 0: goto var_B0;
+    default: goto var_B0;
+  }
+  var_B0:;
+  FUNC_EPILOGUE;
+  return var_f0;
+}
+
+u32 w2c_call__indirect__0__wasm_as0x2Dbr_table0x2Dlast_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = 2u;
+  var_i1 = 0u;
+  var_i1 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*), w2c_call__indirect__0__wasm_t1, var_i1, instance->w2c_T0.data[var_i1].module_instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  switch (var_i1) {
+    case 0: goto var_B0;
+    default: goto var_B0;
+  }
+  var_B0:;
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+void w2c_call__indirect__0__wasm_as0x2Dstore0x2Dfirst_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = 0u;
+  var_i0 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*), w2c_call__indirect__0__wasm_t1, var_i0, instance->w2c_T0.data[var_i0].module_instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  var_i1 = 1u;
+  i32_store_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_i1);
+  FUNC_EPILOGUE;
+}
+
+void w2c_call__indirect__0__wasm_as0x2Dstore0x2Dlast_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  f64 var_d1;
+  var_i0 = 10u;
+  var_i1 = 3u;
+  var_d1 = CALL_INDIRECT(instance->w2c_T0, f64 (*)(void*), w2c_call__indirect__0__wasm_t4, var_i1, instance->w2c_T0.data[var_i1].module_instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  f64_store_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_d1);
+  FUNC_EPILOGUE;
+}
+
+u32 w2c_call__indirect__0__wasm_as0x2Dmemory0x2Egrow0x2Dvalue_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  var_i0 = 0u;
+  var_i0 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*), w2c_call__indirect__0__wasm_t1, var_i0, instance->w2c_T0.data[var_i0].module_instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  var_i0 = wasm_rt_grow_memory(&instance->w2c_M0, var_i0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_call__indirect__0__wasm_as0x2Dreturn0x2Dvalue_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = 1u;
+  var_i1 = 4u;
+  var_i0 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*, u32), w2c_call__indirect__0__wasm_t6, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_i0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  goto var_Bfunc;
+  var_Bfunc:;
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+void w2c_call__indirect__0__wasm_as0x2Ddrop0x2Doperand_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i1;
+  u64 var_j0;
+  var_j0 = 1ull;
+  var_i1 = 5u;
+  var_j0 = CALL_INDIRECT(instance->w2c_T0, u64 (*)(void*, u64), w2c_call__indirect__0__wasm_t7, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_j0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  FUNC_EPILOGUE;
+}
+
+f32 w2c_call__indirect__0__wasm_as0x2Dbr0x2Dvalue_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i1;
+  f32 var_f0;
+  var_f0 = 1.0f;
+  var_i1 = 6u;
+  var_f0 = CALL_INDIRECT(instance->w2c_T0, f32 (*)(void*, f32), w2c_call__indirect__0__wasm_t8, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_f0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  goto var_B0;
+  var_B0:;
+  FUNC_EPILOGUE;
+  return var_f0;
+}
+
+f64 w2c_call__indirect__0__wasm_as0x2Dlocal0x2Eset0x2Dvalue_0(w2c_call__indirect__0__wasm* instance) {
+  f64 var_l0 = 0;
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i1;
+  f64 var_d0;
+  var_d0 = 1.0;
+  var_i1 = 7u;
+  var_d0 = CALL_INDIRECT(instance->w2c_T0, f64 (*)(void*, f64), w2c_call__indirect__0__wasm_t9, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_d0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  var_l0 = var_d0;
+  var_d0 = var_l0;
+  FUNC_EPILOGUE;
+  return var_d0;
+}
+
+f64 w2c_call__indirect__0__wasm_as0x2Dlocal0x2Etee0x2Dvalue_0(w2c_call__indirect__0__wasm* instance) {
+  f64 var_l0 = 0;
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i1;
+  f64 var_d0;
+  var_d0 = 1.0;
+  var_i1 = 7u;
+  var_d0 = CALL_INDIRECT(instance->w2c_T0, f64 (*)(void*, f64), w2c_call__indirect__0__wasm_t9, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_d0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  var_l0 = var_d0;
+  FUNC_EPILOGUE;
+  return var_d0;
+}
+
+f64 w2c_call__indirect__0__wasm_as0x2Dglobal0x2Eset0x2Dvalue_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i1;
+  f64 var_d0;
+  var_d0 = 1.0;
+  var_i1 = 7u;
+  var_d0 = CALL_INDIRECT(instance->w2c_T0, f64 (*)(void*, f64), w2c_call__indirect__0__wasm_t9, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_d0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  instance->w2c_g0 = var_d0;
+  var_d0 = instance->w2c_g0;
+  FUNC_EPILOGUE;
+  return var_d0;
+}
+
+u32 w2c_call__indirect__0__wasm_as0x2Dload0x2Doperand_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  var_i0 = 0u;
+  var_i0 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*), w2c_call__indirect__0__wasm_t1, var_i0, instance->w2c_T0.data[var_i0].module_instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  var_i0 = i32_load_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0));
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+f32 w2c_call__indirect__0__wasm_as0x2Dunary0x2Doperand_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i1;
+  f32 var_f0;
+  var_f0 = 0.0f;
+  var_i1 = 6u;
+  var_f0 = CALL_INDIRECT(instance->w2c_T0, f32 (*)(void*, f32), w2c_call__indirect__0__wasm_t8, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_f0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  var_f0 = wasm_sqrtf(var_f0);
+  FUNC_EPILOGUE;
+  return var_f0;
+}
+
+u32 w2c_call__indirect__0__wasm_as0x2Dbinary0x2Dleft_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = 1u;
+  var_i1 = 4u;
+  var_i0 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*, u32), w2c_call__indirect__0__wasm_t6, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_i0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  var_i1 = 10u;
+  var_i0 += var_i1;
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_call__indirect__0__wasm_as0x2Dbinary0x2Dright_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1, var_i2;
+  var_i0 = 10u;
+  var_i1 = 1u;
+  var_i2 = 4u;
+  var_i1 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*, u32), w2c_call__indirect__0__wasm_t6, var_i2, instance->w2c_T0.data[var_i2].module_instance, var_i1);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  var_i0 -= var_i1;
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_call__indirect__0__wasm_as0x2Dtest0x2Doperand_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = 1u;
+  var_i1 = 4u;
+  var_i0 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*, u32), w2c_call__indirect__0__wasm_t6, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_i0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  var_i0 = !(var_i0);
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_call__indirect__0__wasm_as0x2Dcompare0x2Dleft_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = 1u;
+  var_i1 = 4u;
+  var_i0 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*, u32), w2c_call__indirect__0__wasm_t6, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_i0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  var_i1 = 10u;
+  var_i0 = var_i0 <= var_i1;
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_call__indirect__0__wasm_as0x2Dcompare0x2Dright_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1, var_i2;
+  var_i0 = 10u;
+  var_i1 = 1u;
+  var_i2 = 4u;
+  var_i1 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*, u32), w2c_call__indirect__0__wasm_t6, var_i2, instance->w2c_T0.data[var_i2].module_instance, var_i1);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  var_i0 = var_i0 != var_i1;
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u64 w2c_call__indirect__0__wasm_as0x2Dconvert0x2Doperand_0(w2c_call__indirect__0__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  u64 var_j0;
+  var_i0 = 1u;
+  var_i1 = 4u;
+  var_i0 = CALL_INDIRECT(instance->w2c_T0, u32 (*)(void*, u32), w2c_call__indirect__0__wasm_t6, var_i1, instance->w2c_T0.data[var_i1].module_instance, var_i0);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  var_j0 = (u64)(s64)(s32)(var_i0);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
@@ -0,0 +1,246 @@
+/* Automatically generated by wasm2c */
+#ifndef CALL_INDIRECT_0_H_GENERATED_
+#define CALL_INDIRECT_0_H_GENERATED_
+
+#include "wasm-rt.h"
+
+#include <stdint.h>
+
+#ifndef WASM_RT_CORE_TYPES_DEFINED
+#define WASM_RT_CORE_TYPES_DEFINED
+typedef uint8_t u8;
+typedef int8_t s8;
+typedef uint16_t u16;
+typedef int16_t s16;
+typedef uint32_t u32;
+typedef int32_t s32;
+typedef uint64_t u64;
+typedef int64_t s64;
+typedef float f32;
+typedef double f64;
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct w2c_call__indirect__0__wasm {
+  f64 w2c_g0;
+  wasm_rt_memory_t w2c_M0;
+  wasm_rt_funcref_table_t w2c_T0;
+  wasm_rt_funcref_table_t w2c_T1;
+} w2c_call__indirect__0__wasm;
+
+void wasm2c_call__indirect__0__wasm_instantiate(w2c_call__indirect__0__wasm*);
+void wasm2c_call__indirect__0__wasm_free(w2c_call__indirect__0__wasm*);
+wasm_rt_func_type_t wasm2c_call__indirect__0__wasm_get_func_type(uint32_t param_count, uint32_t result_count, ...);
+
+#ifndef wasm_multi_di
+#define wasm_multi_di wasm_multi_di
+struct wasm_multi_di {
+  f64 d0;
+  u32 i1;
+};
+#endif  /* wasm_multi_di */
+
+#ifndef wasm_multi_id
+#define wasm_multi_id wasm_multi_id
+struct wasm_multi_id {
+  u32 i0;
+  f64 d1;
+};
+#endif  /* wasm_multi_id */
+
+#ifndef wasm_multi_ji
+#define wasm_multi_ji wasm_multi_ji
+struct wasm_multi_ji {
+  u64 j0;
+  u32 i1;
+};
+#endif  /* wasm_multi_ji */
+
+/* export: 'type-i32' */
+u32 w2c_call__indirect__0__wasm_type0x2Di32(w2c_call__indirect__0__wasm*);
+
+/* export: 'type-i32-t64' */
+u32 w2c_call__indirect__0__wasm_type0x2Di320x2Dt64(w2c_call__indirect__0__wasm*);
+
+/* export: 'type-i64' */
+u64 w2c_call__indirect__0__wasm_type0x2Di64(w2c_call__indirect__0__wasm*);
+
+/* export: 'type-f32' */
+f32 w2c_call__indirect__0__wasm_type0x2Df32(w2c_call__indirect__0__wasm*);
+
+/* export: 'type-f64' */
+f64 w2c_call__indirect__0__wasm_type0x2Df64(w2c_call__indirect__0__wasm*);
+
+/* export: 'type-f64-i32' */
+struct wasm_multi_di w2c_call__indirect__0__wasm_type0x2Df640x2Di32(w2c_call__indirect__0__wasm*);
+
+/* export: 'type-index' */
+u64 w2c_call__indirect__0__wasm_type0x2Dindex(w2c_call__indirect__0__wasm*);
+
+/* export: 'type-first-i32' */
+u32 w2c_call__indirect__0__wasm_type0x2Dfirst0x2Di32(w2c_call__indirect__0__wasm*);
+
+/* export: 'type-first-i64' */
+u64 w2c_call__indirect__0__wasm_type0x2Dfirst0x2Di64(w2c_call__indirect__0__wasm*);
+
+/* export: 'type-first-f32' */
+f32 w2c_call__indirect__0__wasm_type0x2Dfirst0x2Df32(w2c_call__indirect__0__wasm*);
+
+/* export: 'type-first-f64' */
+f64 w2c_call__indirect__0__wasm_type0x2Dfirst0x2Df64(w2c_call__indirect__0__wasm*);
+
+/* export: 'type-second-i32' */
+u32 w2c_call__indirect__0__wasm_type0x2Dsecond0x2Di32(w2c_call__indirect__0__wasm*);
+
+/* export: 'type-second-i64' */
+u64 w2c_call__indirect__0__wasm_type0x2Dsecond0x2Di64(w2c_call__indirect__0__wasm*);
+
+/* export: 'type-second-f32' */
+f32 w2c_call__indirect__0__wasm_type0x2Dsecond0x2Df32(w2c_call__indirect__0__wasm*);
+
+/* export: 'type-second-f64' */
+f64 w2c_call__indirect__0__wasm_type0x2Dsecond0x2Df64(w2c_call__indirect__0__wasm*);
+
+/* export: 'type-all-f64-i32' */
+struct wasm_multi_di w2c_call__indirect__0__wasm_type0x2Dall0x2Df640x2Di32(w2c_call__indirect__0__wasm*);
+
+/* export: 'type-all-i32-f64' */
+struct wasm_multi_id w2c_call__indirect__0__wasm_type0x2Dall0x2Di320x2Df64(w2c_call__indirect__0__wasm*);
+
+/* export: 'type-all-i32-i64' */
+struct wasm_multi_ji w2c_call__indirect__0__wasm_type0x2Dall0x2Di320x2Di64(w2c_call__indirect__0__wasm*);
+
+/* export: 'dispatch' */
+u64 w2c_call__indirect__0__wasm_dispatch(w2c_call__indirect__0__wasm*, u32, u64);
+
+/* export: 'dispatch-structural-i64' */
+u64 w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Di64(w2c_call__indirect__0__wasm*, u32);
+
+/* export: 'dispatch-structural-i32' */
+u32 w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Di32(w2c_call__indirect__0__wasm*, u32);
+
+/* export: 'dispatch-structural-f32' */
+f32 w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Df32(w2c_call__indirect__0__wasm*, u32);
+
+/* export: 'dispatch-structural-f64' */
+f64 w2c_call__indirect__0__wasm_dispatch0x2Dstructural0x2Df64(w2c_call__indirect__0__wasm*, u32);
+
+/* export: 'fac-i64' */
+u64 w2c_call__indirect__0__wasm_fac0x2Di64(w2c_call__indirect__0__wasm*, u64);
+
+/* export: 'fib-i64' */
+u64 w2c_call__indirect__0__wasm_fib0x2Di64(w2c_call__indirect__0__wasm*, u64);
+
+/* export: 'fac-i32' */
+u32 w2c_call__indirect__0__wasm_fac0x2Di32(w2c_call__indirect__0__wasm*, u32);
+
+/* export: 'fac-f32' */
+f32 w2c_call__indirect__0__wasm_fac0x2Df32(w2c_call__indirect__0__wasm*, f32);
+
+/* export: 'fac-f64' */
+f64 w2c_call__indirect__0__wasm_fac0x2Df64(w2c_call__indirect__0__wasm*, f64);
+
+/* export: 'fib-i32' */
+u32 w2c_call__indirect__0__wasm_fib0x2Di32(w2c_call__indirect__0__wasm*, u32);
+
+/* export: 'fib-f32' */
+f32 w2c_call__indirect__0__wasm_fib0x2Df32(w2c_call__indirect__0__wasm*, f32);
+
+/* export: 'fib-f64' */
+f64 w2c_call__indirect__0__wasm_fib0x2Df64(w2c_call__indirect__0__wasm*, f64);
+
+/* export: 'even' */
+u32 w2c_call__indirect__0__wasm_even(w2c_call__indirect__0__wasm*, u32);
+
+/* export: 'odd' */
+u32 w2c_call__indirect__0__wasm_odd(w2c_call__indirect__0__wasm*, u32);
+
+/* export: 'runaway' */
+void w2c_call__indirect__0__wasm_runaway(w2c_call__indirect__0__wasm*);
+
+/* export: 'mutual-runaway' */
+void w2c_call__indirect__0__wasm_mutual0x2Drunaway(w2c_call__indirect__0__wasm*);
+
+/* export: 'as-select-first' */
+u32 w2c_call__indirect__0__wasm_as0x2Dselect0x2Dfirst(w2c_call__indirect__0__wasm*);
+
+/* export: 'as-select-mid' */
+u32 w2c_call__indirect__0__wasm_as0x2Dselect0x2Dmid(w2c_call__indirect__0__wasm*);
+
+/* export: 'as-select-last' */
+u32 w2c_call__indirect__0__wasm_as0x2Dselect0x2Dlast(w2c_call__indirect__0__wasm*);
+
+/* export: 'as-if-condition' */
+u32 w2c_call__indirect__0__wasm_as0x2Dif0x2Dcondition(w2c_call__indirect__0__wasm*);
+
+/* export: 'as-br_if-first' */
+u64 w2c_call__indirect__0__wasm_as0x2Dbr_if0x2Dfirst(w2c_call__indirect__0__wasm*);
+
+/* export: 'as-br_if-last' */
+u32 w2c_call__indirect__0__wasm_as0x2Dbr_if0x2Dlast(w2c_call__indirect__0__wasm*);
+
+/* export: 'as-br_table-first' */
+f32 w2c_call__indirect__0__wasm_as0x2Dbr_table0x2Dfirst(w2c_call__indirect__0__wasm*);
+
+/* export: 'as-br_table-last' */
+u32 w2c_call__indirect__0__wasm_as0x2Dbr_table0x2Dlast(w2c_call__indirect__0__wasm*);
+
+/* export: 'as-store-first' */
+void w2c_call__indirect__0__wasm_as0x2Dstore0x2Dfirst(w2c_call__indirect__0__wasm*);
+
+/* export: 'as-store-last' */
+void w2c_call__indirect__0__wasm_as0x2Dstore0x2Dlast(w2c_call__indirect__0__wasm*);
+
+/* export: 'as-memory.grow-value' */
+u32 w2c_call__indirect__0__wasm_as0x2Dmemory0x2Egrow0x2Dvalue(w2c_call__indirect__0__wasm*);
+
+/* export: 'as-return-value' */
+u32 w2c_call__indirect__0__wasm_as0x2Dreturn0x2Dvalue(w2c_call__indirect__0__wasm*);
+
+/* export: 'as-drop-operand' */
+void w2c_call__indirect__0__wasm_as0x2Ddrop0x2Doperand(w2c_call__indirect__0__wasm*);
+
+/* export: 'as-br-value' */
+f32 w2c_call__indirect__0__wasm_as0x2Dbr0x2Dvalue(w2c_call__indirect__0__wasm*);
+
+/* export: 'as-local.set-value' */
+f64 w2c_call__indirect__0__wasm_as0x2Dlocal0x2Eset0x2Dvalue(w2c_call__indirect__0__wasm*);
+
+/* export: 'as-local.tee-value' */
+f64 w2c_call__indirect__0__wasm_as0x2Dlocal0x2Etee0x2Dvalue(w2c_call__indirect__0__wasm*);
+
+/* export: 'as-global.set-value' */
+f64 w2c_call__indirect__0__wasm_as0x2Dglobal0x2Eset0x2Dvalue(w2c_call__indirect__0__wasm*);
+
+/* export: 'as-load-operand' */
+u32 w2c_call__indirect__0__wasm_as0x2Dload0x2Doperand(w2c_call__indirect__0__wasm*);
+
+/* export: 'as-unary-operand' */
+f32 w2c_call__indirect__0__wasm_as0x2Dunary0x2Doperand(w2c_call__indirect__0__wasm*);
+
+/* export: 'as-binary-left' */
+u32 w2c_call__indirect__0__wasm_as0x2Dbinary0x2Dleft(w2c_call__indirect__0__wasm*);
+
+/* export: 'as-binary-right' */
+u32 w2c_call__indirect__0__wasm_as0x2Dbinary0x2Dright(w2c_call__indirect__0__wasm*);
+
+/* export: 'as-test-operand' */
+u32 w2c_call__indirect__0__wasm_as0x2Dtest0x2Doperand(w2c_call__indirect__0__wasm*);
+
+/* export: 'as-compare-left' */
+u32 w2c_call__indirect__0__wasm_as0x2Dcompare0x2Dleft(w2c_call__indirect__0__wasm*);
+
+/* export: 'as-compare-right' */
+u32 w2c_call__indirect__0__wasm_as0x2Dcompare0x2Dright(w2c_call__indirect__0__wasm*);
+
+/* export: 'as-convert-operand' */
+u64 w2c_call__indirect__0__wasm_as0x2Dconvert0x2Doperand(w2c_call__indirect__0__wasm*);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* CALL_INDIRECT_0_H_GENERATED_ */
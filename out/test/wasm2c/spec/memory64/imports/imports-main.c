@@ -0,0 +1,1114 @@
+#include "imports.0.h"
+#include "imports.1.h"
+#include "imports.3.h"
+#include "imports.4.h"
+#include "imports.5.h"
+#include "imports.6.h"
+#include "imports.7.h"
+#include "imports.8.h"
+#include "imports.9.h"
+#include "imports.10.h"
+#include "imports.11.h"
+#include "imports.42.h"
+#include "imports.43.h"
+#include "imports.44.h"
+#include "imports.45.h"
+#include "imports.66.h"
+#include "imports.67.h"
+#include "imports.68.h"
+#include "imports.69.h"
+#include "imports.70.h"
+#include "imports.71.h"
+#include "imports.72.h"
+#include "imports.73.h"
+#include "imports.74.h"
+#include "imports.75.h"
+#include "imports.76.h"
+#include "imports.77.h"
+#include "imports.78.h"
+#include "imports.79.h"
+#include "imports.80.h"
+#include "imports.81.h"
+#include "imports.82.h"
+#include "imports.83.h"
+#include "imports.84.h"
+#include "imports.85.h"
+#include "imports.86.h"
+#include "imports.87.h"
+#include "imports.88.h"
+#include "imports.89.h"
+#include "imports.90.h"
+#include "imports.91.h"
+#include "imports.92.h"
+#include "imports.93.h"
+#include "imports.94.h"
+#include "imports.95.h"
+#include "imports.96.h"
+#include "imports.97.h"
+#include "imports.98.h"
+#include "imports.99.h"
+#include "imports.100.h"
+#include "imports.121.h"
+#include "imports.122.h"
+#include "imports.123.h"
+#include "imports.124.h"
+#include "imports.125.h"
+#include "imports.126.h"
+#include "imports.127.h"
+#include "imports.128.h"
+#include "imports.129.h"
+#include "imports.130.h"
+#include "imports.131.h"
+#include "imports.132.h"
+#include "imports.133.h"
+#include "imports.134.h"
+#include "imports.135.h"
+#include "imports.136.h"
+#include "imports.137.h"
+#include "imports.138.h"
+#include "imports.139.h"
+#include "imports.140.h"
+#include "imports.141.h"
+#include "imports.142.h"
+#include "imports.143.h"
+#include "imports.144.h"
+#include "imports.145.h"
+#include "imports.146.h"
+#include "imports.147.h"
+#include "imports.148.h"
+#include "imports.149.h"
+#include "imports.150.h"
+#include "imports.151.h"
+#include "imports.204.h"
+#include "imports.221.h"
+#include <assert.h>
+#define __STDC_FORMAT_MACROS
+#include <inttypes.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "wasm-rt.h"
+#include "wasm-rt-impl.h"
+#include "wasm-rt-exceptions.h"
+
+/* NOTE: function argument evaluation order is implementation-defined in C,
+   so it SHOULD NOT be relied on by tests. */
+#if WABT_BIG_ENDIAN
+#define v128_i8x16_make(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p) \
+	simde_wasm_i8x16_make(p,o,n,m,l,k,j,i,h,g,f,e,d,c,b,a)
+#define v128_u8x16_make(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p) \
+	simde_wasm_u8x16_make(p,o,n,m,l,k,j,i,h,g,f,e,d,c,b,a)
+#define v128_i16x8_make(a,b,c,d,e,f,g,h) simde_wasm_i16x8_make(h,g,f,e,d,c,b,a)
+#define v128_u16x8_make(a,b,c,d,e,f,g,h) simde_wasm_u16x8_make(h,g,f,e,d,c,b,a)
+#define v128_i32x4_make(a,b,c,d) simde_wasm_i32x4_make(d,c,b,a)
+#define v128_u32x4_make(a,b,c,d) simde_wasm_u32x4_make(d,c,b,a)
+#define v128_i64x2_make(a,b) simde_wasm_i64x2_make(b,a)
+#define v128_u64x2_make(a,b) simde_wasm_u64x2_make(b,a)
+#define v128_f32x4_make(a,b,c,d) simde_wasm_f32x4_make(d,c,b,a)
+#define v128_f64x2_make(a,b) simde_wasm_f64x2_make(b,a)
+#define v128_i8x16_extract_lane(a,n) simde_wasm_u8x16_extract_lane(a,15-(n))
+#define v128_u8x16_extract_lane(a,n) simde_wasm_u8x16_extract_lane(a,15-(n))
+#define v128_i16x8_extract_lane(a,n) simde_wasm_u16x8_extract_lane(a,7-(n))
+#define v128_u16x8_extract_lane(a,n) simde_wasm_u16x8_extract_lane(a,7-(n))
+#define v128_i32x4_extract_lane(a,n) simde_wasm_u32x4_extract_lane(a,3-(n))
+#define v128_u32x4_extract_lane(a,n) simde_wasm_u32x4_extract_lane(a,3-(n))
+#define v128_i64x2_extract_lane(a,n) simde_wasm_u64x2_extract_lane(a,1-(n))
+#define v128_u64x2_extract_lane(a,n) simde_wasm_u64x2_extract_lane(a,1-(n))
+#define v128_f32x4_extract_lane(a,n) simde_wasm_f32x4_extract_lane(a,3-(n))
+#define v128_f64x2_extract_lane(a,n) simde_wasm_f64x2_extract_lane(a,1-(n))
+#else
+#define v128_i8x16_make simde_wasm_i8x16_make
+#define v128_u8x16_make simde_wasm_u8x16_make
+#define v128_i16x8_make simde_wasm_i16x8_make
+#define v128_u16x8_make simde_wasm_u16x8_make
+#define v128_i32x4_make simde_wasm_i32x4_make
+#define v128_u32x4_make simde_wasm_u32x4_make
+#define v128_i64x2_make simde_wasm_i64x2_make
+#define v128_u64x2_make simde_wasm_u64x2_make
+#define v128_f32x4_make simde_wasm_f32x4_make
+#define v128_f64x2_make simde_wasm_f64x2_make
+// like is_equal_TYPE below, always use unsigned for these
+#define v128_i8x16_extract_lane simde_wasm_u8x16_extract_lane
+#define v128_u8x16_extract_lane simde_wasm_u8x16_extract_lane
+#define v128_i16x8_extract_lane simde_wasm_u16x8_extract_lane
+#define v128_u16x8_extract_lane simde_wasm_u16x8_extract_lane
+#define v128_i32x4_extract_lane simde_wasm_u32x4_extract_lane
+#define v128_u32x4_extract_lane simde_wasm_u32x4_extract_lane
+#define v128_i64x2_extract_lane simde_wasm_u64x2_extract_lane
+#define v128_u64x2_extract_lane simde_wasm_u64x2_extract_lane
+#define v128_f32x4_extract_lane simde_wasm_f32x4_extract_lane
+#define v128_f64x2_extract_lane simde_wasm_f64x2_extract_lane
+#endif
+
+static int g_tests_run;
+static int g_tests_passed;
+
+static void run_spec_tests(void);
+
+static void error(const char* file, int line, const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  fprintf(stderr, "%s:%d: assertion failed: ", file, line);
+  vfprintf(stderr, format, args);
+  va_end(args);
+}
+
+#define ASSERT_EXCEPTION(f)                                               \
+  do {                                                                    \
+    g_tests_run++;                                                        \
+    if (wasm_rt_impl_try() == WASM_RT_TRAP_UNCAUGHT_EXCEPTION) {          \
+      g_tests_passed++;                                                   \
+    } else {                                                              \
+      (void)(f);                                                          \
+      error(__FILE__, __LINE__, "expected " #f " to throw exception.\n"); \
+    }                                                                     \
+  } while (0)
+
+#define ASSERT_TRAP(f)                                         \
+  do {                                                         \
+    g_tests_run++;                                             \
+    if (wasm_rt_impl_try() != 0) {                             \
+      g_tests_passed++;                                        \
+    } else {                                                   \
+      (void)(f);                                               \
+      error(__FILE__, __LINE__, "expected " #f " to trap.\n"); \
+    }                                                          \
+  } while (0)
+
+#define ASSERT_EXHAUSTION(f)                                     \
+  do {                                                           \
+    g_tests_run++;                                               \
+    wasm_rt_trap_t code = wasm_rt_impl_try();                    \
+    switch (code) {                                              \
+      case WASM_RT_TRAP_NONE:                                    \
+        (void)(f);                                               \
+        error(__FILE__, __LINE__, "expected " #f " to trap.\n"); \
+        break;                                                   \
+      case WASM_RT_TRAP_EXHAUSTION:                              \
+        g_tests_passed++;                                        \
+        break;                                                   \
+      default:                                                   \
+        error(__FILE__, __LINE__,                                \
+              "expected " #f                                     \
+              " to trap due to exhaustion, got trap code %d.\n", \
+              code);                                             \
+        break;                                                   \
+    }                                                            \
+  } while (0)
+
+#define ASSERT_RETURN(f)                               \
+  do {                                                 \
+    g_tests_run++;                                     \
+    int trap_code = wasm_rt_impl_try();                \
+    if (trap_code) {                                   \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n", \
+            wasm_rt_strerror(trap_code));              \
+    } else {                                           \
+      f;                                               \
+      g_tests_passed++;                                \
+    }                                                  \
+  } while (0)
+
+#define ASSERT_RETURN_T(type, fmt, f, expected)                          \
+  do {                                                                   \
+    g_tests_run++;                                                       \
+    int trap_code = wasm_rt_impl_try();                                  \
+    if (trap_code) {                                                     \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                   \
+            wasm_rt_strerror(trap_code));                                \
+    } else {                                                             \
+      type actual = f;                                                   \
+      if (is_equal_##type(actual, expected)) {                           \
+        g_tests_passed++;                                                \
+      } else {                                                           \
+        error(__FILE__, __LINE__,                                        \
+              "in " #f ": expected %" fmt ", got %" fmt ".\n", expected, \
+              actual);                                                   \
+      }                                                                  \
+    }                                                                    \
+  } while (0)
+
+#define ASSERT_RETURN_FUNCREF(f, expected)                                \
+  do {                                                                    \
+    g_tests_run++;                                                        \
+    int trap_code = wasm_rt_impl_try();                                   \
+    if (trap_code) {                                                      \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                    \
+            wasm_rt_strerror(trap_code));                                 \
+    } else {                                                              \
+      wasm_rt_funcref_t actual = f;                                       \
+      if (is_equal_wasm_rt_funcref_t(actual, expected)) {                 \
+        g_tests_passed++;                                                 \
+      } else {                                                            \
+        error(__FILE__, __LINE__,                                         \
+              "in " #f ": mismatch between expected and actual funcref"); \
+      }                                                                   \
+    }                                                                     \
+  } while (0)
+
+#define ASSERT_RETURN_EXNREF(f, expected)                                \
+  do {                                                                   \
+    g_tests_run++;                                                       \
+    int trap_code = wasm_rt_impl_try();                                  \
+    if (trap_code) {                                                     \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                   \
+            wasm_rt_strerror(trap_code));                                \
+    } else {                                                             \
+      wasm_rt_exnref_t actual = f;                                       \
+      if (is_equal_wasm_rt_exnref_t(actual, expected)) {                 \
+        g_tests_passed++;                                                \
+      } else {                                                           \
+        error(__FILE__, __LINE__,                                        \
+              "in " #f ": mismatch between expected and actual exnref"); \
+      }                                                                  \
+    }                                                                    \
+  } while (0)
+
+#define ASSERT_RETURN_NAN_T(type, itype, fmt, f, kind)                        \
+  do {                                                                        \
+    g_tests_run++;                                                            \
+    int trap_code = wasm_rt_impl_try();                                       \
+    if (trap_code) {                                                          \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                        \
+            wasm_rt_strerror(trap_code));                                     \
+    } else {                                                                  \
+      type actual = f;                                                        \
+      itype iactual;                                                          \
+      memcpy(&iactual, &actual, sizeof(iactual));                             \
+      if (is_##kind##_nan_##type(iactual)) {                                  \
+        g_tests_passed++;                                                     \
+      } else {                                                                \
+        error(__FILE__, __LINE__,                                             \
+              "in " #f ": expected result to be a " #kind " nan, got 0x%" fmt \
+              ".\n",                                                          \
+              iactual);                                                       \
+      }                                                                       \
+    }                                                                         \
+  } while (0)
+
+#define MULTI_T_UNPACK_(...) __VA_ARGS__
+#define MULTI_T_UNPACK(arg) MULTI_T_UNPACK_ arg
+#define MULTI_i8 "%" PRIu8 " "
+#define MULTI_i16 "%" PRIu16 " "
+#define MULTI_i32 "%u "
+#define MULTI_i64 "%" PRIu64 " "
+#define MULTI_f32 "%.9g "
+#define MULTI_f64 "%.17g "
+#define MULTI_str "%s "
+#define ASSERT_RETURN_MULTI_T(type, fmt_expected, fmt_got, f, compare,        \
+                              expected, found)                                \
+  do {                                                                        \
+    g_tests_run++;                                                            \
+    int trap_code = wasm_rt_impl_try();                                       \
+    if (trap_code) {                                                          \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                        \
+            wasm_rt_strerror(trap_code));                                     \
+    } else {                                                                  \
+      type actual = f;                                                        \
+      if (compare) {                                                          \
+        g_tests_passed++;                                                     \
+      } else {                                                                \
+        error(__FILE__, __LINE__,                                             \
+              "in " #f ": expected <" fmt_expected ">, got <" fmt_got ">.\n", \
+              MULTI_T_UNPACK(expected), MULTI_T_UNPACK(found));               \
+      }                                                                       \
+    }                                                                         \
+  } while (0)
+
+
+#define ASSERT_RETURN_I32(f, expected) ASSERT_RETURN_T(u32, "u", f, expected)
+#define ASSERT_RETURN_I64(f, expected) ASSERT_RETURN_T(u64, PRIu64, f, expected)
+#define ASSERT_RETURN_F32(f, expected) ASSERT_RETURN_T(f32, ".9g", f, expected)
+#define ASSERT_RETURN_F64(f, expected) ASSERT_RETURN_T(f64, ".17g", f, expected)
+#define ASSERT_RETURN_EXTERNREF(f, expected) \
+  ASSERT_RETURN_T(wasm_rt_externref_t, "p", f, expected);
+
+#define ASSERT_RETURN_CANONICAL_NAN_F32(f) \
+  ASSERT_RETURN_NAN_T(f32, u32, "08x", f, canonical)
+#define ASSERT_RETURN_CANONICAL_NAN_F64(f) \
+  ASSERT_RETURN_NAN_T(f64, u64, "016x", f, canonical)
+#define ASSERT_RETURN_ARITHMETIC_NAN_F32(f) \
+  ASSERT_RETURN_NAN_T(f32, u32, "08x", f, arithmetic)
+#define ASSERT_RETURN_ARITHMETIC_NAN_F64(f) \
+  ASSERT_RETURN_NAN_T(f64, u64, "016x", f, arithmetic)
+
+static bool is_equal_u8(u8 x, u8 y) {
+  return x == y;
+}
+
+static bool is_equal_u16(u16 x, u16 y) {
+  return x == y;
+}
+
+static bool is_equal_u32(u32 x, u32 y) {
+  return x == y;
+}
+
+static bool is_equal_u64(u64 x, u64 y) {
+  return x == y;
+}
+
+#define is_equal_i8 is_equal_u8
+#define is_equal_i16 is_equal_u16
+#define is_equal_i32 is_equal_u32
+#define is_equal_i64 is_equal_u64
+
+static bool is_equal_wasm_rt_externref_t(wasm_rt_externref_t x,
+                                         wasm_rt_externref_t y) {
+  return x == y;
+}
+
+static inline bool is_equal_wasm_rt_func_type_t(const wasm_rt_func_type_t a,
+                                                const wasm_rt_func_type_t b) {
+  return (a == b) || (a && b && !memcmp(a, b, 32));
+}
+
+static bool is_equal_wasm_rt_funcref_t(wasm_rt_funcref_t x,
+                                       wasm_rt_funcref_t y) {
+  return is_equal_wasm_rt_func_type_t(x.func_type, y.func_type) &&
+         (x.func == y.func) && (x.module_instance == y.module_instance);
+}
+
+#ifdef WASM_EXN_MAX_SIZE
+static bool is_equal_wasm_rt_exnref_t(wasm_rt_exnref_t x, wasm_rt_exnref_t y) {
+  return x.tag == y.tag && x.size == y.size && !memcmp(x.data, y.data, x.size);
+}
+#endif
+
+wasm_rt_externref_t spectest_make_externref(uintptr_t x) {
+  return (wasm_rt_externref_t)(x + 1);  // externref(0) is not null
+}
+
+static u32 f32_bits(f32 x) {
+  u32 ux;
+  memcpy(&ux, &x, sizeof(ux));
+  return ux;
+}
+
+static u64 f64_bits(f64 x) {
+  u64 ux;
+  memcpy(&ux, &x, sizeof(ux));
+  return ux;
+}
+
+static bool is_equal_f32(f32 x, f32 y) {
+  return f32_bits(x) == f32_bits(y);
+}
+
+static bool is_equal_f64(f64 x, f64 y) {
+  return f64_bits(x) == f64_bits(y);
+}
+
+static f32 make_nan_f32(u32 x) {
+  x |= 0x7f800000;
+  f32 res;
+  memcpy(&res, &x, sizeof(res));
+  return res;
+}
+
+static f64 make_nan_f64(u64 x) {
+  x |= 0x7ff0000000000000;
+  f64 res;
+  memcpy(&res, &x, sizeof(res));
+  return res;
+}
+
+static bool is_canonical_nan_f32(u32 x) {
+  return (x & 0x7fffffff) == 0x7fc00000;
+}
+
+static bool is_canonical_nan_f64(u64 x) {
+  return (x & 0x7fffffffffffffff) == 0x7ff8000000000000;
+}
+
+static bool is_arithmetic_nan_f32(u32 x) {
+  return (x & 0x7fc00000) == 0x7fc00000;
+}
+
+static bool is_arithmetic_nan_f64(u64 x) {
+  return (x & 0x7ff8000000000000) == 0x7ff8000000000000;
+}
+
+typedef struct w2c_spectest {
+  wasm_rt_funcref_table_t spectest_table;
+  wasm_rt_funcref_table_t spectest_table64;
+  wasm_rt_memory_t spectest_memory;
+  uint32_t spectest_global_i32;
+  uint64_t spectest_global_i64;
+  float spectest_global_f32;
+  double spectest_global_f64;
+} w2c_spectest;
+
+static w2c_spectest spectest_instance;
+
+/*
+ * spectest implementations
+ */
+void w2c_spectest_print(w2c_spectest* instance) {
+  printf("spectest.print()\n");
+}
+
+void w2c_spectest_print_i32(w2c_spectest* instance, uint32_t i) {
+  printf("spectest.print_i32(%d)\n", i);
+}
+
+void w2c_spectest_print_i64(w2c_spectest* instance, uint64_t i) {
+  printf("spectest.print_i64(%" PRIu64 ")\n", i);
+}
+
+void w2c_spectest_print_f32(w2c_spectest* instance, float f) {
+  printf("spectest.print_f32(%g)\n", f);
+}
+
+void w2c_spectest_print_i32_f32(w2c_spectest* instance, uint32_t i, float f) {
+  printf("spectest.print_i32_f32(%d %g)\n", i, f);
+}
+
+void w2c_spectest_print_f64(w2c_spectest* instance, double d) {
+  printf("spectest.print_f64(%g)\n", d);
+}
+
+void w2c_spectest_print_f64_f64(w2c_spectest* instance, double d1, double d2) {
+  printf("spectest.print_f64_f64(%g %g)\n", d1, d2);
+}
+
+wasm_rt_funcref_table_t* w2c_spectest_table(w2c_spectest* instance) {
+  return &instance->spectest_table;
+}
+
+wasm_rt_funcref_table_t* w2c_spectest_table64(w2c_spectest* instance) {
+  return &instance->spectest_table64;
+}
+
+wasm_rt_memory_t* w2c_spectest_memory(w2c_spectest* instance) {
+  return &instance->spectest_memory;
+}
+
+uint32_t* w2c_spectest_global_i32(w2c_spectest* instance) {
+  return &instance->spectest_global_i32;
+}
+
+uint64_t* w2c_spectest_global_i64(w2c_spectest* instance) {
+  return &instance->spectest_global_i64;
+}
+
+float* w2c_spectest_global_f32(w2c_spectest* instance) {
+  return &instance->spectest_global_f32;
+}
+
+double* w2c_spectest_global_f64(w2c_spectest* instance) {
+  return &instance->spectest_global_f64;
+}
+
+static void init_spectest_module(w2c_spectest* instance) {
+  instance->spectest_global_i32 = 666;
+  instance->spectest_global_i64 = 666l;
+  instance->spectest_global_f32 = 666.6;
+  instance->spectest_global_f64 = 666.6;
+  wasm_rt_allocate_memory(&instance->spectest_memory, 1, 2, false,
+                          WASM_DEFAULT_PAGE_SIZE);
+  wasm_rt_allocate_funcref_table(&instance->spectest_table, 10, 20);
+  wasm_rt_allocate_funcref_table(&instance->spectest_table64, 10, 20);
+}
+
+// POSIX-only test config where embedder handles signals instead of w2c runtime
+#ifdef WASM2C_TEST_EMBEDDER_SIGNAL_HANDLING
+#include <signal.h>
+
+static void posix_signal_handler(int sig, siginfo_t* si, void* unused) {
+  wasm_rt_trap((si->si_code == SEGV_ACCERR) ? WASM_RT_TRAP_OOB
+                                            : WASM_RT_TRAP_EXHAUSTION);
+}
+
+static void posix_install_signal_handler(void) {
+  /* install altstack */
+  stack_t ss;
+  ss.ss_sp = malloc(SIGSTKSZ);
+  ss.ss_flags = 0;
+  ss.ss_size = SIGSTKSZ;
+  if (sigaltstack(&ss, NULL) != 0) {
+    perror("sigaltstack failed");
+    abort();
+  }
+
+  /* install signal handler */
+  struct sigaction sa;
+  memset(&sa, '\0', sizeof(sa));
+  sa.sa_flags = SA_SIGINFO | SA_ONSTACK;
+  sigemptyset(&sa.sa_mask);
+  sa.sa_sigaction = posix_signal_handler;
+  if (sigaction(SIGSEGV, &sa, NULL) != 0 || sigaction(SIGBUS, &sa, NULL) != 0) {
+    perror("sigaction failed");
+    abort();
+  }
+}
+
+static void posix_cleanup_signal_handler(void) {
+  /* remove signal handler */
+  struct sigaction sa;
+  memset(&sa, '\0', sizeof(sa));
+  sa.sa_handler = SIG_DFL;
+  if (sigaction(SIGSEGV, &sa, NULL) != 0 || sigaction(SIGBUS, &sa, NULL)) {
+    perror("sigaction failed");
+    abort();
+  }
+
+  /* disable and free altstack */
+  stack_t ss;
+  ss.ss_flags = SS_DISABLE;
+  if (sigaltstack(&ss, NULL) != 0) {
+    perror("sigaltstack failed");
+    abort();
+  }
+  free(ss.ss_sp);
+}
+#endif
+
+int main(int argc, char** argv) {
+#ifdef WASM2C_TEST_EMBEDDER_SIGNAL_HANDLING
+  posix_install_signal_handler();
+#endif
+  wasm_rt_init();
+  init_spectest_module(&spectest_instance);
+  run_spec_tests();
+  printf("%u/%u tests passed.\n", g_tests_passed, g_tests_run);
+  wasm_rt_free();
+#ifdef WASM2C_TEST_EMBEDDER_SIGNAL_HANDLING
+  posix_cleanup_signal_handler();
+#endif
+  return g_tests_passed != g_tests_run;
+}
+
+w2c_test test_instance;
+w2c_imports__1__wasm imports__1__wasm_instance;
+w2c_imports__3__wasm imports__3__wasm_instance;
+w2c_imports__4__wasm imports__4__wasm_instance;
+w2c_imports__5__wasm imports__5__wasm_instance;
+w2c_imports__6__wasm imports__6__wasm_instance;
+w2c_imports__7__wasm imports__7__wasm_instance;
+w2c_imports__8__wasm imports__8__wasm_instance;
+w2c_imports__9__wasm imports__9__wasm_instance;
+w2c_imports__10__wasm imports__10__wasm_instance;
+w2c_imports__11__wasm imports__11__wasm_instance;
+w2c_imports__42__wasm imports__42__wasm_instance;
+w2c_imports__43__wasm imports__43__wasm_instance;
+w2c_imports__44__wasm imports__44__wasm_instance;
+w2c_imports__45__wasm imports__45__wasm_instance;
+w2c_imports__66__wasm imports__66__wasm_instance;
+w2c_imports__67__wasm imports__67__wasm_instance;
+w2c_imports__68__wasm imports__68__wasm_instance;
+w2c_imports__69__wasm imports__69__wasm_instance;
+w2c_imports__70__wasm imports__70__wasm_instance;
+w2c_imports__71__wasm imports__71__wasm_instance;
+w2c_imports__72__wasm imports__72__wasm_instance;
+w2c_imports__73__wasm imports__73__wasm_instance;
+w2c_imports__74__wasm imports__74__wasm_instance;
+w2c_imports__75__wasm imports__75__wasm_instance;
+w2c_imports__76__wasm imports__76__wasm_instance;
+w2c_imports__77__wasm imports__77__wasm_instance;
+w2c_imports__78__wasm imports__78__wasm_instance;
+w2c_imports__79__wasm imports__79__wasm_instance;
+w2c_imports__80__wasm imports__80__wasm_instance;
+w2c_imports__81__wasm imports__81__wasm_instance;
+w2c_imports__82__wasm imports__82__wasm_instance;
+w2c_imports__83__wasm imports__83__wasm_instance;
+w2c_imports__84__wasm imports__84__wasm_instance;
+w2c_imports__85__wasm imports__85__wasm_instance;
+w2c_imports__86__wasm imports__86__wasm_instance;
+w2c_imports__87__wasm imports__87__wasm_instance;
+w2c_imports__88__wasm imports__88__wasm_instance;
+w2c_imports__89__wasm imports__89__wasm_instance;
+w2c_imports__90__wasm imports__90__wasm_instance;
+w2c_imports__91__wasm imports__91__wasm_instance;
+w2c_imports__92__wasm imports__92__wasm_instance;
+w2c_imports__93__wasm imports__93__wasm_instance;
+w2c_imports__94__wasm imports__94__wasm_instance;
+w2c_imports__95__wasm imports__95__wasm_instance;
+w2c_imports__96__wasm imports__96__wasm_instance;
+w2c_imports__97__wasm imports__97__wasm_instance;
+w2c_imports__98__wasm imports__98__wasm_instance;
+w2c_imports__99__wasm imports__99__wasm_instance;
+w2c_imports__100__wasm imports__100__wasm_instance;
+w2c_imports__121__wasm imports__121__wasm_instance;
+w2c_imports__122__wasm imports__122__wasm_instance;
+w2c_imports__123__wasm imports__123__wasm_instance;
+w2c_imports__124__wasm imports__124__wasm_instance;
+w2c_imports__125__wasm imports__125__wasm_instance;
+w2c_imports__126__wasm imports__126__wasm_instance;
+w2c_imports__127__wasm imports__127__wasm_instance;
+w2c_imports__128__wasm imports__128__wasm_instance;
+w2c_imports__129__wasm imports__129__wasm_instance;
+w2c_imports__130__wasm imports__130__wasm_instance;
+w2c_imports__131__wasm imports__131__wasm_instance;
+w2c_imports__132__wasm imports__132__wasm_instance;
+w2c_imports__133__wasm imports__133__wasm_instance;
+w2c_imports__134__wasm imports__134__wasm_instance;
+w2c_imports__135__wasm imports__135__wasm_instance;
+w2c_imports__136__wasm imports__136__wasm_instance;
+w2c_imports__137__wasm imports__137__wasm_instance;
+w2c_imports__138__wasm imports__138__wasm_instance;
+w2c_imports__139__wasm imports__139__wasm_instance;
+w2c_imports__140__wasm imports__140__wasm_instance;
+w2c_imports__141__wasm imports__141__wasm_instance;
+w2c_imports__142__wasm imports__142__wasm_instance;
+w2c_imports__143__wasm imports__143__wasm_instance;
+w2c_imports__144__wasm imports__144__wasm_instance;
+w2c_imports__145__wasm imports__145__wasm_instance;
+w2c_imports__146__wasm imports__146__wasm_instance;
+w2c_imports__147__wasm imports__147__wasm_instance;
+w2c_imports__148__wasm imports__148__wasm_instance;
+w2c_imports__149__wasm imports__149__wasm_instance;
+w2c_imports__150__wasm imports__150__wasm_instance;
+w2c_imports__151__wasm imports__151__wasm_instance;
+w2c_imports__204__wasm imports__204__wasm_instance;
+w2c_not0x20wasm not0x20wasm_instance;
+
+void run_spec_tests_0(void) {
+
+#line 3 "imports.wast"
+wasm2c_test_instantiate(&test_instance);
+
+#line 33 "imports.wast"
+wasm2c_imports__1__wasm_instantiate(&imports__1__wasm_instance, &spectest_instance, &test_instance);
+
+#line 95 "imports.wast"
+ASSERT_RETURN(w2c_imports__1__wasm_print32(&imports__1__wasm_instance, 13u));
+
+#line 96 "imports.wast"
+ASSERT_RETURN(w2c_imports__1__wasm_print64(&imports__1__wasm_instance, 24ull));
+
+#line 107 "imports.wast"
+wasm2c_imports__3__wasm_instantiate(&imports__3__wasm_instance, &spectest_instance);
+
+#line 114 "imports.wast"
+ASSERT_RETURN(w2c_imports__3__wasm_print_i32(&imports__3__wasm_instance, 13u));
+
+#line 117 "imports.wast"
+wasm2c_imports__4__wasm_instantiate(&imports__4__wasm_instance, &spectest_instance);
+
+#line 124 "imports.wast"
+ASSERT_RETURN_I32(w2c_imports__4__wasm_print_i32(&imports__4__wasm_instance, 5u, 11u), 16u);
+
+#line 126 "imports.wast"
+wasm2c_imports__5__wasm_instantiate(&imports__5__wasm_instance, &test_instance);
+
+#line 127 "imports.wast"
+wasm2c_imports__6__wasm_instantiate(&imports__6__wasm_instance, &test_instance);
+
+#line 128 "imports.wast"
+wasm2c_imports__7__wasm_instantiate(&imports__7__wasm_instance, &test_instance);
+
+#line 129 "imports.wast"
+wasm2c_imports__8__wasm_instantiate(&imports__8__wasm_instance, &test_instance);
+
+#line 130 "imports.wast"
+wasm2c_imports__9__wasm_instantiate(&imports__9__wasm_instance, &test_instance);
+
+#line 131 "imports.wast"
+wasm2c_imports__10__wasm_instantiate(&imports__10__wasm_instance, &test_instance);
+
+#line 132 "imports.wast"
+wasm2c_imports__11__wasm_instantiate(&imports__11__wasm_instance, &test_instance);
+
+#line 261 "imports.wast"
+wasm2c_imports__42__wasm_instantiate(&imports__42__wasm_instance, &spectest_instance);
+
+#line 281 "imports.wast"
+ASSERT_RETURN_I32(w2c_imports__42__wasm_get0x2D0(&imports__42__wasm_instance), 666u);
+
+#line 282 "imports.wast"
+ASSERT_RETURN_I32(w2c_imports__42__wasm_get0x2D1(&imports__42__wasm_instance), 666u);
+
+#line 283 "imports.wast"
+ASSERT_RETURN_I32(w2c_imports__42__wasm_get0x2Dx(&imports__42__wasm_instance), 666u);
+
+#line 284 "imports.wast"
+ASSERT_RETURN_I32(w2c_imports__42__wasm_get0x2Dy(&imports__42__wasm_instance), 666u);
+
+#line 285 "imports.wast"
+ASSERT_RETURN_I64(w2c_imports__42__wasm_get0x2D4(&imports__42__wasm_instance), 666ull);
+
+#line 286 "imports.wast"
+ASSERT_RETURN_F32(w2c_imports__42__wasm_get0x2D5(&imports__42__wasm_instance), 666.599976f);
+
+#line 287 "imports.wast"
+ASSERT_RETURN_F64(w2c_imports__42__wasm_get0x2D6(&imports__42__wasm_instance), 666.60000000000002);
+
+#line 289 "imports.wast"
+wasm2c_imports__43__wasm_instantiate(&imports__43__wasm_instance, &test_instance);
+
+#line 290 "imports.wast"
+wasm2c_imports__44__wasm_instantiate(&imports__44__wasm_instance, &test_instance);
+
+#line 291 "imports.wast"
+wasm2c_imports__45__wasm_instantiate(&imports__45__wasm_instance, &test_instance);
+
+#line 379 "imports.wast"
+wasm2c_imports__66__wasm_instantiate(&imports__66__wasm_instance, &spectest_instance, &test_instance);
+
+#line 392 "imports.wast"
+ASSERT_TRAP(w2c_imports__66__wasm_call(&imports__66__wasm_instance, 0u));
+
+#line 393 "imports.wast"
+ASSERT_RETURN_I32(w2c_imports__66__wasm_call(&imports__66__wasm_instance, 1u), 11u);
+
+#line 394 "imports.wast"
+ASSERT_RETURN_I32(w2c_imports__66__wasm_call(&imports__66__wasm_instance, 2u), 22u);
+
+#line 395 "imports.wast"
+ASSERT_TRAP(w2c_imports__66__wasm_call(&imports__66__wasm_instance, 3u));
+
+#line 396 "imports.wast"
+ASSERT_TRAP(w2c_imports__66__wasm_call(&imports__66__wasm_instance, 100u));
+
+#line 399 "imports.wast"
+wasm2c_imports__67__wasm_instantiate(&imports__67__wasm_instance, &spectest_instance, &test_instance);
+
+#line 412 "imports.wast"
+ASSERT_TRAP(w2c_imports__67__wasm_call(&imports__67__wasm_instance, 0u));
+
+#line 413 "imports.wast"
+ASSERT_RETURN_I32(w2c_imports__67__wasm_call(&imports__67__wasm_instance, 1u), 11u);
+
+#line 414 "imports.wast"
+ASSERT_RETURN_I32(w2c_imports__67__wasm_call(&imports__67__wasm_instance, 2u), 22u);
+
+#line 415 "imports.wast"
+ASSERT_TRAP(w2c_imports__67__wasm_call(&imports__67__wasm_instance, 3u));
+
+#line 416 "imports.wast"
+ASSERT_TRAP(w2c_imports__67__wasm_call(&imports__67__wasm_instance, 100u));
+
+#line 418 "imports.wast"
+wasm2c_imports__68__wasm_instantiate(&imports__68__wasm_instance, &spectest_instance, &test_instance);
+
+#line 429 "imports.wast"
+wasm2c_imports__69__wasm_instantiate(&imports__69__wasm_instance, &test_instance);
+
+#line 430 "imports.wast"
+wasm2c_imports__70__wasm_instantiate(&imports__70__wasm_instance, &test_instance);
+
+#line 431 "imports.wast"
+wasm2c_imports__71__wasm_instantiate(&imports__71__wasm_instance, &test_instance);
+
+#line 432 "imports.wast"
+wasm2c_imports__72__wasm_instantiate(&imports__72__wasm_instance, &test_instance);
+
+#line 433 "imports.wast"
+wasm2c_imports__73__wasm_instantiate(&imports__73__wasm_instance, &test_instance);
+
+#line 434 "imports.wast"
+wasm2c_imports__74__wasm_instantiate(&imports__74__wasm_instance, &test_instance);
+
+#line 435 "imports.wast"
+wasm2c_imports__75__wasm_instantiate(&imports__75__wasm_instance, &test_instance);
+
+#line 436 "imports.wast"
+wasm2c_imports__76__wasm_instantiate(&imports__76__wasm_instance, &test_instance);
+
+#line 437 "imports.wast"
+wasm2c_imports__77__wasm_instantiate(&imports__77__wasm_instance, &test_instance);
+
+#line 438 "imports.wast"
+wasm2c_imports__78__wasm_instantiate(&imports__78__wasm_instance, &test_instance);
+
+#line 439 "imports.wast"
+wasm2c_imports__79__wasm_instantiate(&imports__79__wasm_instance, &test_instance);
+
+#line 440 "imports.wast"
+wasm2c_imports__80__wasm_instantiate(&imports__80__wasm_instance, &test_instance);
+
+#line 441 "imports.wast"
+wasm2c_imports__81__wasm_instantiate(&imports__81__wasm_instance, &test_instance);
+
+#line 442 "imports.wast"
+wasm2c_imports__82__wasm_instantiate(&imports__82__wasm_instance, &test_instance);
+
+#line 443 "imports.wast"
+wasm2c_imports__83__wasm_instantiate(&imports__83__wasm_instance, &test_instance);
+
+#line 444 "imports.wast"
+wasm2c_imports__84__wasm_instantiate(&imports__84__wasm_instance, &test_instance);
+
+#line 445 "imports.wast"
+wasm2c_imports__85__wasm_instantiate(&imports__85__wasm_instance, &test_instance);
+
+#line 446 "imports.wast"
+wasm2c_imports__86__wasm_instantiate(&imports__86__wasm_instance, &test_instance);
+
+#line 447 "imports.wast"
+wasm2c_imports__87__wasm_instantiate(&imports__87__wasm_instance, &test_instance);
+
+#line 448 "imports.wast"
+wasm2c_imports__88__wasm_instantiate(&imports__88__wasm_instance, &test_instance);
+
+#line 449 "imports.wast"
+wasm2c_imports__89__wasm_instantiate(&imports__89__wasm_instance, &test_instance);
+
+#line 450 "imports.wast"
+wasm2c_imports__90__wasm_instantiate(&imports__90__wasm_instance, &test_instance);
+
+#line 451 "imports.wast"
+wasm2c_imports__91__wasm_instantiate(&imports__91__wasm_instance, &test_instance);
+
+#line 452 "imports.wast"
+wasm2c_imports__92__wasm_instantiate(&imports__92__wasm_instance, &test_instance);
+
+#line 453 "imports.wast"
+wasm2c_imports__93__wasm_instantiate(&imports__93__wasm_instance, &spectest_instance);
+
+#line 454 "imports.wast"
+wasm2c_imports__94__wasm_instantiate(&imports__94__wasm_instance, &spectest_instance);
+
+#line 455 "imports.wast"
+wasm2c_imports__95__wasm_instantiate(&imports__95__wasm_instance, &spectest_instance);
+
+#line 456 "imports.wast"
+wasm2c_imports__96__wasm_instantiate(&imports__96__wasm_instance, &spectest_instance);
+
+#line 457 "imports.wast"
+wasm2c_imports__97__wasm_instantiate(&imports__97__wasm_instance, &spectest_instance);
+
+#line 458 "imports.wast"
+wasm2c_imports__98__wasm_instantiate(&imports__98__wasm_instance, &spectest_instance);
+
+#line 459 "imports.wast"
+wasm2c_imports__99__wasm_instantiate(&imports__99__wasm_instance, &spectest_instance);
+
+#line 460 "imports.wast"
+wasm2c_imports__100__wasm_instantiate(&imports__100__wasm_instance, &spectest_instance);
+
+#line 549 "imports.wast"
+wasm2c_imports__121__wasm_instantiate(&imports__121__wasm_instance, &spectest_instance, &test_instance);
+
+#line 558 "imports.wast"
+ASSERT_RETURN_I32(w2c_imports__121__wasm_load(&imports__121__wasm_instance, 0u), 0u);
+
+#line 559 "imports.wast"
+ASSERT_RETURN_I32(w2c_imports__121__wasm_load(&imports__121__wasm_instance, 10u), 16u);
+
+#line 560 "imports.wast"
+ASSERT_RETURN_I32(w2c_imports__121__wasm_load(&imports__121__wasm_instance, 8u), 1048576u);
+
+#line 561 "imports.wast"
+ASSERT_TRAP(w2c_imports__121__wasm_load(&imports__121__wasm_instance, 1000000u));
+
+#line 563 "imports.wast"
+wasm2c_imports__122__wasm_instantiate(&imports__122__wasm_instance, &spectest_instance, &test_instance);
+
+#line 571 "imports.wast"
+ASSERT_RETURN_I32(w2c_imports__122__wasm_load(&imports__122__wasm_instance, 0u), 0u);
+
+#line 572 "imports.wast"
+ASSERT_RETURN_I32(w2c_imports__122__wasm_load(&imports__122__wasm_instance, 10u), 16u);
+
+#line 573 "imports.wast"
+ASSERT_RETURN_I32(w2c_imports__122__wasm_load(&imports__122__wasm_instance, 8u), 1048576u);
+
+#line 574 "imports.wast"
+ASSERT_TRAP(w2c_imports__122__wasm_load(&imports__122__wasm_instance, 1000000u));
+
+#line 576 "imports.wast"
+wasm2c_imports__123__wasm_instantiate(&imports__123__wasm_instance, &test_instance);
+
+#line 577 "imports.wast"
+wasm2c_imports__124__wasm_instantiate(&imports__124__wasm_instance, &test_instance);
+
+#line 578 "imports.wast"
+wasm2c_imports__125__wasm_instantiate(&imports__125__wasm_instance, &test_instance);
+
+#line 579 "imports.wast"
+wasm2c_imports__126__wasm_instantiate(&imports__126__wasm_instance, &test_instance);
+
+#line 580 "imports.wast"
+wasm2c_imports__127__wasm_instantiate(&imports__127__wasm_instance, &test_instance);
+
+#line 581 "imports.wast"
+wasm2c_imports__128__wasm_instantiate(&imports__128__wasm_instance, &test_instance);
+
+#line 582 "imports.wast"
+wasm2c_imports__129__wasm_instantiate(&imports__129__wasm_instance, &test_instance);
+
+#line 583 "imports.wast"
+wasm2c_imports__130__wasm_instantiate(&imports__130__wasm_instance, &test_instance);
+
+#line 584 "imports.wast"
+wasm2c_imports__131__wasm_instantiate(&imports__131__wasm_instance, &test_instance);
+
+#line 585 "imports.wast"
+wasm2c_imports__132__wasm_instantiate(&imports__132__wasm_instance, &test_instance);
+
+#line 586 "imports.wast"
+wasm2c_imports__133__wasm_instantiate(&imports__133__wasm_instance, &test_instance);
+
+#line 587 "imports.wast"
+wasm2c_imports__134__wasm_instantiate(&imports__134__wasm_instance, &test_instance);
+
+#line 588 "imports.wast"
+wasm2c_imports__135__wasm_instantiate(&imports__135__wasm_instance, &test_instance);
+
+#line 589 "imports.wast"
+wasm2c_imports__136__wasm_instantiate(&imports__136__wasm_instance, &test_instance);
+
+#line 590 "imports.wast"
+wasm2c_imports__137__wasm_instantiate(&imports__137__wasm_instance, &test_instance);
+
+#line 591 "imports.wast"
+wasm2c_imports__138__wasm_instantiate(&imports__138__wasm_instance, &test_instance);
+
+#line 592 "imports.wast"
+wasm2c_imports__139__wasm_instantiate(&imports__139__wasm_instance, &test_instance);
+
+#line 593 "imports.wast"
+wasm2c_imports__140__wasm_instantiate(&imports__140__wasm_instance, &test_instance);
+
+#line 594 "imports.wast"
+wasm2c_imports__141__wasm_instantiate(&imports__141__wasm_instance, &test_instance);
+
+#line 595 "imports.wast"
+wasm2c_imports__142__wasm_instantiate(&imports__142__wasm_instance, &test_instance);
+
+#line 596 "imports.wast"
+wasm2c_imports__143__wasm_instantiate(&imports__143__wasm_instance, &test_instance);
+
+#line 597 "imports.wast"
+wasm2c_imports__144__wasm_instantiate(&imports__144__wasm_instance, &test_instance);
+
+#line 598 "imports.wast"
+wasm2c_imports__145__wasm_instantiate(&imports__145__wasm_instance, &test_instance);
+
+#line 599 "imports.wast"
+wasm2c_imports__146__wasm_instantiate(&imports__146__wasm_instance, &spectest_instance);
+
+#line 600 "imports.wast"
+wasm2c_imports__147__wasm_instantiate(&imports__147__wasm_instance, &spectest_instance);
+
+#line 601 "imports.wast"
+wasm2c_imports__148__wasm_instantiate(&imports__148__wasm_instance, &spectest_instance);
+
+#line 602 "imports.wast"
+wasm2c_imports__149__wasm_instantiate(&imports__149__wasm_instance, &spectest_instance);
+
+#line 603 "imports.wast"
+wasm2c_imports__150__wasm_instantiate(&imports__150__wasm_instance, &spectest_instance);
+
+#line 604 "imports.wast"
+wasm2c_imports__151__wasm_instantiate(&imports__151__wasm_instance, &spectest_instance);
+
+#line 819 "imports.wast"
+wasm2c_imports__204__wasm_instantiate(&imports__204__wasm_instance, &spectest_instance);
+
+#line 823 "imports.wast"
+ASSERT_RETURN_I32(w2c_imports__204__wasm_grow(&imports__204__wasm_instance, 0u), 1u);
+
+#line 824 "imports.wast"
+ASSERT_RETURN_I32(w2c_imports__204__wasm_grow(&imports__204__wasm_instance, 1u), 1u);
+
+#line 825 "imports.wast"
+ASSERT_RETURN_I32(w2c_imports__204__wasm_grow(&imports__204__wasm_instance, 0u), 2u);
+
+#line 826 "imports.wast"
+ASSERT_RETURN_I32(w2c_imports__204__wasm_grow(&imports__204__wasm_instance, 1u), 4294967295u);
+
+#line 827 "imports.wast"
+ASSERT_RETURN_I32(w2c_imports__204__wasm_grow(&imports__204__wasm_instance, 0u), 2u);
+
+#line 903 "imports.wast"
+wasm2c_not0x20wasm_instantiate(&not0x20wasm_instance);
+
+
+}
+
+void run_spec_tests(void) {
+
+run_spec_tests_0();
+wasm2c_test_free(&test_instance);
+wasm2c_imports__1__wasm_free(&imports__1__wasm_instance);
+wasm2c_imports__3__wasm_free(&imports__3__wasm_instance);
+wasm2c_imports__4__wasm_free(&imports__4__wasm_instance);
+wasm2c_imports__5__wasm_free(&imports__5__wasm_instance);
+wasm2c_imports__6__wasm_free(&imports__6__wasm_instance);
+wasm2c_imports__7__wasm_free(&imports__7__wasm_instance);
+wasm2c_imports__8__wasm_free(&imports__8__wasm_instance);
+wasm2c_imports__9__wasm_free(&imports__9__wasm_instance);
+wasm2c_imports__10__wasm_free(&imports__10__wasm_instance);
+wasm2c_imports__11__wasm_free(&imports__11__wasm_instance);
+wasm2c_imports__42__wasm_free(&imports__42__wasm_instance);
+wasm2c_imports__43__wasm_free(&imports__43__wasm_instance);
+wasm2c_imports__44__wasm_free(&imports__44__wasm_instance);
+wasm2c_imports__45__wasm_free(&imports__45__wasm_instance);
+wasm2c_imports__66__wasm_free(&imports__66__wasm_instance);
+wasm2c_imports__67__wasm_free(&imports__67__wasm_instance);
+wasm2c_imports__68__wasm_free(&imports__68__wasm_instance);
+wasm2c_imports__69__wasm_free(&imports__69__wasm_instance);
+wasm2c_imports__70__wasm_free(&imports__70__wasm_instance);
+wasm2c_imports__71__wasm_free(&imports__71__wasm_instance);
+wasm2c_imports__72__wasm_free(&imports__72__wasm_instance);
+wasm2c_imports__73__wasm_free(&imports__73__wasm_instance);
+wasm2c_imports__74__wasm_free(&imports__74__wasm_instance);
+wasm2c_imports__75__wasm_free(&imports__75__wasm_instance);
+wasm2c_imports__76__wasm_free(&imports__76__wasm_instance);
+wasm2c_imports__77__wasm_free(&imports__77__wasm_instance);
+wasm2c_imports__78__wasm_free(&imports__78__wasm_instance);
+wasm2c_imports__79__wasm_free(&imports__79__wasm_instance);
+wasm2c_imports__80__wasm_free(&imports__80__wasm_instance);
+wasm2c_imports__81__wasm_free(&imports__81__wasm_instance);
+wasm2c_imports__82__wasm_free(&imports__82__wasm_instance);
+wasm2c_imports__83__wasm_free(&imports__83__wasm_instance);
+wasm2c_imports__84__wasm_free(&imports__84__wasm_instance);
+wasm2c_imports__85__wasm_free(&imports__85__wasm_instance);
+wasm2c_imports__86__wasm_free(&imports__86__wasm_instance);
+wasm2c_imports__87__wasm_free(&imports__87__wasm_instance);
+wasm2c_imports__88__wasm_free(&imports__88__wasm_instance);
+wasm2c_imports__89__wasm_free(&imports__89__wasm_instance);
+wasm2c_imports__90__wasm_free(&imports__90__wasm_instance);
+wasm2c_imports__91__wasm_free(&imports__91__wasm_instance);
+wasm2c_imports__92__wasm_free(&imports__92__wasm_instance);
+wasm2c_imports__93__wasm_free(&imports__93__wasm_instance);
+wasm2c_imports__94__wasm_free(&imports__94__wasm_instance);
+wasm2c_imports__95__wasm_free(&imports__95__wasm_instance);
+wasm2c_imports__96__wasm_free(&imports__96__wasm_instance);
+wasm2c_imports__97__wasm_free(&imports__97__wasm_instance);
+wasm2c_imports__98__wasm_free(&imports__98__wasm_instance);
+wasm2c_imports__99__wasm_free(&imports__99__wasm_instance);
+wasm2c_imports__100__wasm_free(&imports__100__wasm_instance);
+wasm2c_imports__121__wasm_free(&imports__121__wasm_instance);
+wasm2c_imports__122__wasm_free(&imports__122__wasm_instance);
+wasm2c_imports__123__wasm_free(&imports__123__wasm_instance);
+wasm2c_imports__124__wasm_free(&imports__124__wasm_instance);
+wasm2c_imports__125__wasm_free(&imports__125__wasm_instance);
+wasm2c_imports__126__wasm_free(&imports__126__wasm_instance);
+wasm2c_imports__127__wasm_free(&imports__127__wasm_instance);
+wasm2c_imports__128__wasm_free(&imports__128__wasm_instance);
+wasm2c_imports__129__wasm_free(&imports__129__wasm_instance);
+wasm2c_imports__130__wasm_free(&imports__130__wasm_instance);
+wasm2c_imports__131__wasm_free(&imports__131__wasm_instance);
+wasm2c_imports__132__wasm_free(&imports__132__wasm_instance);
+wasm2c_imports__133__wasm_free(&imports__133__wasm_instance);
+wasm2c_imports__134__wasm_free(&imports__134__wasm_instance);
+wasm2c_imports__135__wasm_free(&imports__135__wasm_instance);
+wasm2c_imports__136__wasm_free(&imports__136__wasm_instance);
+wasm2c_imports__137__wasm_free(&imports__137__wasm_instance);
+wasm2c_imports__138__wasm_free(&imports__138__wasm_instance);
+wasm2c_imports__139__wasm_free(&imports__139__wasm_instance);
+wasm2c_imports__140__wasm_free(&imports__140__wasm_instance);
+wasm2c_imports__141__wasm_free(&imports__141__wasm_instance);
+wasm2c_imports__142__wasm_free(&imports__142__wasm_instance);
+wasm2c_imports__143__wasm_free(&imports__143__wasm_instance);
+wasm2c_imports__144__wasm_free(&imports__144__wasm_instance);
+wasm2c_imports__145__wasm_free(&imports__145__wasm_instance);
+wasm2c_imports__146__wasm_free(&imports__146__wasm_instance);
+wasm2c_imports__147__wasm_free(&imports__147__wasm_instance);
+wasm2c_imports__148__wasm_free(&imports__148__wasm_instance);
+wasm2c_imports__149__wasm_free(&imports__149__wasm_instance);
+wasm2c_imports__150__wasm_free(&imports__150__wasm_instance);
+wasm2c_imports__151__wasm_free(&imports__151__wasm_instance);
+wasm2c_imports__204__wasm_free(&imports__204__wasm_instance);
+wasm2c_not0x20wasm_free(&not0x20wasm_instance);
+
+}
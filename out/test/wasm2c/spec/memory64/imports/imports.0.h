@@ -0,0 +1,113 @@
+/* Automatically generated by wasm2c */
+#ifndef IMPORTS_0_H_GENERATED_
+#define IMPORTS_0_H_GENERATED_
+
+#include "wasm-rt.h"
+#include "wasm-rt-exceptions.h"
+
+#include <stdint.h>
+
+#ifndef WASM_RT_CORE_TYPES_DEFINED
+#define WASM_RT_CORE_TYPES_DEFINED
+typedef uint8_t u8;
+typedef int8_t s8;
+typedef uint16_t u16;
+typedef int16_t s16;
+typedef uint32_t u32;
+typedef int32_t s32;
+typedef uint64_t u64;
+typedef int64_t s64;
+typedef float f32;
+typedef double f64;
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct w2c_test {
+  u32 w2c_global0x2Di32;
+  f32 w2c_global0x2Df32;
+  u64 w2c_global0x2Dmut0x2Di64;
+  wasm_rt_memory_t w2c_memory0x2D20x2Dinf;
+  wasm_rt_memory_t w2c_memory0x2D20x2D4;
+  wasm_rt_memory_t w2c_memory640x2D20x2Dinf;
+  wasm_rt_memory_t w2c_memory640x2D20x2D4;
+  wasm_rt_funcref_table_t w2c_table0x2D100x2Dinf;
+  wasm_rt_funcref_table_t w2c_table0x2D100x2D20;
+  wasm_rt_funcref_table_t w2c_table640x2D100x2Dinf;
+  wasm_rt_funcref_table_t w2c_table640x2D100x2D20;
+} w2c_test;
+
+void wasm2c_test_instantiate(w2c_test*);
+void wasm2c_test_free(w2c_test*);
+wasm_rt_func_type_t wasm2c_test_get_func_type(uint32_t param_count, uint32_t result_count, ...);
+
+/* export: 'func' */
+void w2c_test_func(w2c_test*);
+
+/* export: 'func-i32' */
+void w2c_test_func0x2Di32(w2c_test*, u32);
+
+/* export: 'func-f32' */
+void w2c_test_func0x2Df32(w2c_test*, f32);
+
+/* export: 'func->i32' */
+u32 w2c_test_func0x2D0x3Ei32(w2c_test*);
+
+/* export: 'func->f32' */
+f32 w2c_test_func0x2D0x3Ef32(w2c_test*);
+
+/* export: 'func-i32->i32' */
+u32 w2c_test_func0x2Di320x2D0x3Ei32(w2c_test*, u32);
+
+/* export: 'func-i64->i64' */
+u64 w2c_test_func0x2Di640x2D0x3Ei64(w2c_test*, u64);
+
+/* export: 'global-i32' */
+u32* w2c_test_global0x2Di32(w2c_test* instance);
+
+/* export: 'global-f32' */
+f32* w2c_test_global0x2Df32(w2c_test* instance);
+
+/* export: 'global-mut-i64' */
+u64* w2c_test_global0x2Dmut0x2Di64(w2c_test* instance);
+
+/* export: 'table-10-inf' */
+wasm_rt_funcref_table_t* w2c_test_table0x2D100x2Dinf(w2c_test* instance);
+
+/* export: 'table-10-20' */
+wasm_rt_funcref_table_t* w2c_test_table0x2D100x2D20(w2c_test* instance);
+
+/* export: 'table64-10-inf' */
+wasm_rt_funcref_table_t* w2c_test_table640x2D100x2Dinf(w2c_test* instance);
+
+/* export: 'table64-10-20' */
+wasm_rt_funcref_table_t* w2c_test_table640x2D100x2D20(w2c_test* instance);
+
+/* export: 'memory-2-inf' */
+wasm_rt_memory_t* w2c_test_memory0x2D20x2Dinf(w2c_test* instance);
+
+/* export: 'memory-2-4' */
+wasm_rt_memory_t* w2c_test_memory0x2D20x2D4(w2c_test* instance);
+
+/* export: 'memory64-2-inf' */
+wasm_rt_memory_t* w2c_test_memory640x2D20x2Dinf(w2c_test* instance);
+
+/* export: 'memory64-2-4' */
+wasm_rt_memory_t* w2c_test_memory640x2D20x2D4(w2c_test* instance);
+
+/* export: 'tag' */
+extern const wasm_rt_tag_t w2c_test_tag;
+
+/* export: 'tag-i32' */
+extern const wasm_rt_tag_t w2c_test_tag0x2Di32;
+
+/* export: 'tag-f32' */
+extern const wasm_rt_tag_t w2c_test_tag0x2Df32;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* IMPORTS_0_H_GENERATED_ */
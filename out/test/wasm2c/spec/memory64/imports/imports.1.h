@@ -0,0 +1,96 @@
+/* Automatically generated by wasm2c */
+#ifndef IMPORTS_1_H_GENERATED_
+#define IMPORTS_1_H_GENERATED_
+
+#include "wasm-rt.h"
+#include "wasm-rt-exceptions.h"
+
+#include <stdint.h>
+
+#ifndef WASM_RT_CORE_TYPES_DEFINED
+#define WASM_RT_CORE_TYPES_DEFINED
+typedef uint8_t u8;
+typedef int8_t s8;
+typedef uint16_t u16;
+typedef int16_t s16;
+typedef uint32_t u32;
+typedef int32_t s32;
+typedef uint64_t u64;
+typedef int64_t s64;
+typedef float f32;
+typedef double f64;
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct w2c_spectest;
+struct w2c_test;
+
+typedef struct w2c_imports__1__wasm {
+  struct w2c_spectest* w2c_spectest_instance;
+  struct w2c_test* w2c_test_instance;
+  wasm_rt_funcref_table_t w2c_T0;
+} w2c_imports__1__wasm;
+
+void wasm2c_imports__1__wasm_instantiate(w2c_imports__1__wasm*, struct w2c_spectest*, struct w2c_test*);
+void wasm2c_imports__1__wasm_free(w2c_imports__1__wasm*);
+wasm_rt_func_type_t wasm2c_imports__1__wasm_get_func_type(uint32_t param_count, uint32_t result_count, ...);
+
+/* import: 'spectest' 'print_f32' */
+void w2c_spectest_print_f32(struct w2c_spectest*, f32);
+
+/* import: 'spectest' 'print_f64' */
+void w2c_spectest_print_f64(struct w2c_spectest*, f64);
+
+/* import: 'spectest' 'print_f64_f64' */
+void w2c_spectest_print_f64_f64(struct w2c_spectest*, f64, f64);
+
+/* import: 'spectest' 'print_i32' */
+void w2c_spectest_print_i32(struct w2c_spectest*, u32);
+
+/* import: 'spectest' 'print_i32_f32' */
+void w2c_spectest_print_i32_f32(struct w2c_spectest*, u32, f32);
+
+/* import: 'spectest' 'print_i64' */
+void w2c_spectest_print_i64(struct w2c_spectest*, u64);
+
+/* import: 'test' 'func-i64->i64' */
+u64 w2c_test_func0x2Di640x2D0x3Ei64(struct w2c_test*, u64);
+
+/* import: 'test' 'tag-f32' */
+extern const wasm_rt_tag_t w2c_test_tag0x2Df32;
+
+/* import: 'test' 'tag-i32' */
+extern const wasm_rt_tag_t w2c_test_tag0x2Di32;
+
+/* export: 'p1' */
+void w2c_imports__1__wasm_p1(w2c_imports__1__wasm*, u32);
+
+/* export: 'p2' */
+void w2c_imports__1__wasm_p2(w2c_imports__1__wasm*, u32);
+
+/* export: 'p3' */
+void w2c_imports__1__wasm_p3(w2c_imports__1__wasm*, u32);
+
+/* export: 'p4' */
+void w2c_imports__1__wasm_p4(w2c_imports__1__wasm*, u32);
+
+/* export: 'p5' */
+void w2c_imports__1__wasm_p5(w2c_imports__1__wasm*, u32);
+
+/* export: 'p6' */
+void w2c_imports__1__wasm_p6(w2c_imports__1__wasm*, u32);
+
+/* export: 'print32' */
+void w2c_imports__1__wasm_print32(w2c_imports__1__wasm*, u32);
+
+/* export: 'print64' */
+void w2c_imports__1__wasm_print64(w2c_imports__1__wasm*, u64);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* IMPORTS_1_H_GENERATED_ */
@@ -0,0 +1,46 @@
+/* Automatically generated by wasm2c */
+#ifndef IMPORTS_100_H_GENERATED_
+#define IMPORTS_100_H_GENERATED_
+
+#include "wasm-rt.h"
+
+#include <stdint.h>
+
+#ifndef WASM_RT_CORE_TYPES_DEFINED
+#define WASM_RT_CORE_TYPES_DEFINED
+typedef uint8_t u8;
+typedef int8_t s8;
+typedef uint16_t u16;
+typedef int16_t s16;
+typedef uint32_t u32;
+typedef int32_t s32;
+typedef uint64_t u64;
+typedef int64_t s64;
+typedef float f32;
+typedef double f64;
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct w2c_spectest;
+extern wasm_rt_funcref_table_t* w2c_spectest_table(struct w2c_spectest*);
+
+typedef struct w2c_imports__100__wasm {
+  /* import: 'spectest' 'table' */
+  wasm_rt_funcref_table_t *w2c_spectest_table;
+} w2c_imports__100__wasm;
+
+void wasm2c_imports__100__wasm_instantiate(w2c_imports__100__wasm*, struct w2c_spectest*);
+void wasm2c_imports__100__wasm_free(w2c_imports__100__wasm*);
+wasm_rt_func_type_t wasm2c_imports__100__wasm_get_func_type(uint32_t param_count, uint32_t result_count, ...);
+
+extern const u32 wasm2c_imports__100__wasm_min_spectest_table;
+extern const u32 wasm2c_imports__100__wasm_max_spectest_table;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* IMPORTS_100_H_GENERATED_ */
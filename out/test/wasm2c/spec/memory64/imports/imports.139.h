@@ -0,0 +1,48 @@
+/* Automatically generated by wasm2c */
+#ifndef IMPORTS_139_H_GENERATED_
+#define IMPORTS_139_H_GENERATED_
+
+#include "wasm-rt.h"
+
+#include <stdint.h>
+
+#ifndef WASM_RT_CORE_TYPES_DEFINED
+#define WASM_RT_CORE_TYPES_DEFINED
+typedef uint8_t u8;
+typedef int8_t s8;
+typedef uint16_t u16;
+typedef int16_t s16;
+typedef uint32_t u32;
+typedef int32_t s32;
+typedef uint64_t u64;
+typedef int64_t s64;
+typedef float f32;
+typedef double f64;
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct w2c_test;
+extern wasm_rt_memory_t* w2c_test_memory640x2D20x2D4(struct w2c_test*);
+
+typedef struct w2c_imports__139__wasm {
+  /* import: 'test' 'memory64-2-4' */
+  wasm_rt_memory_t *w2c_test_memory640x2D20x2D4;
+} w2c_imports__139__wasm;
+
+void wasm2c_imports__139__wasm_instantiate(w2c_imports__139__wasm*, struct w2c_test*);
+void wasm2c_imports__139__wasm_free(w2c_imports__139__wasm*);
+wasm_rt_func_type_t wasm2c_imports__139__wasm_get_func_type(uint32_t param_count, uint32_t result_count, ...);
+
+extern const u64 wasm2c_imports__139__wasm_min_test_memory640x2D20x2D4;
+extern const u64 wasm2c_imports__139__wasm_max_test_memory640x2D20x2D4;
+extern const u8 wasm2c_imports__139__wasm_is64_test_memory640x2D20x2D4;
+extern const u32 wasm2c_imports__139__wasm_pagesize_test_memory640x2D20x2D4;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* IMPORTS_139_H_GENERATED_ */
@@ -0,0 +1 @@
+(func) (import "" "" (func))
\ No newline at end of file
@@ -0,0 +1 @@
+(func) (import "" "" (global i64))
\ No newline at end of file
@@ -0,0 +1 @@
+(func) (import "" "" (table 0 funcref))
\ No newline at end of file
@@ -0,0 +1 @@
+(func) (import "" "" (memory 0))
\ No newline at end of file
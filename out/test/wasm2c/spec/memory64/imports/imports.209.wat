@@ -0,0 +1 @@
+(global i64 (i64.const 0)) (import "" "" (func))
\ No newline at end of file
@@ -0,0 +1 @@
+(global i64 (i64.const 0)) (import "" "" (table 0 funcref))
\ No newline at end of file
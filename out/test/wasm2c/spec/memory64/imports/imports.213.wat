@@ -0,0 +1 @@
+(table 0 funcref) (import "" "" (func))
\ No newline at end of file
@@ -0,0 +1 @@
+(table 0 funcref) (import "" "" (global i32))
\ No newline at end of file
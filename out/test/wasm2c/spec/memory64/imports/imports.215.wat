@@ -0,0 +1 @@
+(table 0 funcref) (import "" "" (table 0 funcref))
\ No newline at end of file
@@ -0,0 +1 @@
+(table 0 funcref) (import "" "" (memory 0))
\ No newline at end of file
@@ -0,0 +1 @@
+(memory 0) (import "" "" (func))
\ No newline at end of file
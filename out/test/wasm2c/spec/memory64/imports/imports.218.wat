@@ -0,0 +1 @@
+(memory 0) (import "" "" (global i32))
\ No newline at end of file
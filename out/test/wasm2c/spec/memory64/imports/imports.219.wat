@@ -0,0 +1 @@
+(memory 0) (import "" "" (table 1 3 funcref))
\ No newline at end of file
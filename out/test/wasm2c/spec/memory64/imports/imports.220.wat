@@ -0,0 +1 @@
+(memory 0) (import "" "" (memory 1 2))
\ No newline at end of file
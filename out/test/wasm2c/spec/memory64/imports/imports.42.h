@@ -0,0 +1,73 @@
+/* Automatically generated by wasm2c */
+#ifndef IMPORTS_42_H_GENERATED_
+#define IMPORTS_42_H_GENERATED_
+
+#include "wasm-rt.h"
+
+#include <stdint.h>
+
+#ifndef WASM_RT_CORE_TYPES_DEFINED
+#define WASM_RT_CORE_TYPES_DEFINED
+typedef uint8_t u8;
+typedef int8_t s8;
+typedef uint16_t u16;
+typedef int16_t s16;
+typedef uint32_t u32;
+typedef int32_t s32;
+typedef uint64_t u64;
+typedef int64_t s64;
+typedef float f32;
+typedef double f64;
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct w2c_spectest;
+extern f32* w2c_spectest_global_f32(struct w2c_spectest*);
+extern f64* w2c_spectest_global_f64(struct w2c_spectest*);
+extern u32* w2c_spectest_global_i32(struct w2c_spectest*);
+extern u64* w2c_spectest_global_i64(struct w2c_spectest*);
+
+typedef struct w2c_imports__42__wasm {
+  /* import: 'spectest' 'global_f32' */
+  f32 *w2c_spectest_global_f32;
+  /* import: 'spectest' 'global_f64' */
+  f64 *w2c_spectest_global_f64;
+  /* import: 'spectest' 'global_i32' */
+  u32 *w2c_spectest_global_i32;
+  /* import: 'spectest' 'global_i64' */
+  u64 *w2c_spectest_global_i64;
+} w2c_imports__42__wasm;
+
+void wasm2c_imports__42__wasm_instantiate(w2c_imports__42__wasm*, struct w2c_spectest*);
+void wasm2c_imports__42__wasm_free(w2c_imports__42__wasm*);
+wasm_rt_func_type_t wasm2c_imports__42__wasm_get_func_type(uint32_t param_count, uint32_t result_count, ...);
+
+/* export: 'get-0' */
+u32 w2c_imports__42__wasm_get0x2D0(w2c_imports__42__wasm*);
+
+/* export: 'get-1' */
+u32 w2c_imports__42__wasm_get0x2D1(w2c_imports__42__wasm*);
+
+/* export: 'get-x' */
+u32 w2c_imports__42__wasm_get0x2Dx(w2c_imports__42__wasm*);
+
+/* export: 'get-y' */
+u32 w2c_imports__42__wasm_get0x2Dy(w2c_imports__42__wasm*);
+
+/* export: 'get-4' */
+u64 w2c_imports__42__wasm_get0x2D4(w2c_imports__42__wasm*);
+
+/* export: 'get-5' */
+f32 w2c_imports__42__wasm_get0x2D5(w2c_imports__42__wasm*);
+
+/* export: 'get-6' */
+f64 w2c_imports__42__wasm_get0x2D6(w2c_imports__42__wasm*);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* IMPORTS_42_H_GENERATED_ */
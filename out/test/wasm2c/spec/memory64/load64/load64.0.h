@@ -0,0 +1,152 @@
+/* Automatically generated by wasm2c */
+#ifndef LOAD64_0_H_GENERATED_
+#define LOAD64_0_H_GENERATED_
+
+#include "wasm-rt.h"
+
+#include <stdint.h>
+
+#ifndef WASM_RT_CORE_TYPES_DEFINED
+#define WASM_RT_CORE_TYPES_DEFINED
+typedef uint8_t u8;
+typedef int8_t s8;
+typedef uint16_t u16;
+typedef int16_t s16;
+typedef uint32_t u32;
+typedef int32_t s32;
+typedef uint64_t u64;
+typedef int64_t s64;
+typedef float f32;
+typedef double f64;
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct w2c_load64__0__wasm {
+  u32 w2c_g0;
+  wasm_rt_memory_t w2c_M0;
+  wasm_rt_funcref_table_t w2c_T0;
+} w2c_load64__0__wasm;
+
+void wasm2c_load64__0__wasm_instantiate(w2c_load64__0__wasm*);
+void wasm2c_load64__0__wasm_free(w2c_load64__0__wasm*);
+wasm_rt_func_type_t wasm2c_load64__0__wasm_get_func_type(uint32_t param_count, uint32_t result_count, ...);
+
+/* export: 'as-br-value' */
+u32 w2c_load64__0__wasm_as0x2Dbr0x2Dvalue(w2c_load64__0__wasm*);
+
+/* export: 'as-br_if-cond' */
+void w2c_load64__0__wasm_as0x2Dbr_if0x2Dcond(w2c_load64__0__wasm*);
+
+/* export: 'as-br_if-value' */
+u32 w2c_load64__0__wasm_as0x2Dbr_if0x2Dvalue(w2c_load64__0__wasm*);
+
+/* export: 'as-br_if-value-cond' */
+u32 w2c_load64__0__wasm_as0x2Dbr_if0x2Dvalue0x2Dcond(w2c_load64__0__wasm*);
+
+/* export: 'as-br_table-index' */
+void w2c_load64__0__wasm_as0x2Dbr_table0x2Dindex(w2c_load64__0__wasm*);
+
+/* export: 'as-br_table-value' */
+u32 w2c_load64__0__wasm_as0x2Dbr_table0x2Dvalue(w2c_load64__0__wasm*);
+
+/* export: 'as-br_table-value-index' */
+u32 w2c_load64__0__wasm_as0x2Dbr_table0x2Dvalue0x2Dindex(w2c_load64__0__wasm*);
+
+/* export: 'as-return-value' */
+u32 w2c_load64__0__wasm_as0x2Dreturn0x2Dvalue(w2c_load64__0__wasm*);
+
+/* export: 'as-if-cond' */
+u32 w2c_load64__0__wasm_as0x2Dif0x2Dcond(w2c_load64__0__wasm*);
+
+/* export: 'as-if-then' */
+u32 w2c_load64__0__wasm_as0x2Dif0x2Dthen(w2c_load64__0__wasm*);
+
+/* export: 'as-if-else' */
+u32 w2c_load64__0__wasm_as0x2Dif0x2Delse(w2c_load64__0__wasm*);
+
+/* export: 'as-select-first' */
+u32 w2c_load64__0__wasm_as0x2Dselect0x2Dfirst(w2c_load64__0__wasm*, u32, u32);
+
+/* export: 'as-select-second' */
+u32 w2c_load64__0__wasm_as0x2Dselect0x2Dsecond(w2c_load64__0__wasm*, u32, u32);
+
+/* export: 'as-select-cond' */
+u32 w2c_load64__0__wasm_as0x2Dselect0x2Dcond(w2c_load64__0__wasm*);
+
+/* export: 'as-call-first' */
+u32 w2c_load64__0__wasm_as0x2Dcall0x2Dfirst(w2c_load64__0__wasm*);
+
+/* export: 'as-call-mid' */
+u32 w2c_load64__0__wasm_as0x2Dcall0x2Dmid(w2c_load64__0__wasm*);
+
+/* export: 'as-call-last' */
+u32 w2c_load64__0__wasm_as0x2Dcall0x2Dlast(w2c_load64__0__wasm*);
+
+/* export: 'as-call_indirect-first' */
+u32 w2c_load64__0__wasm_as0x2Dcall_indirect0x2Dfirst(w2c_load64__0__wasm*);
+
+/* export: 'as-call_indirect-mid' */
+u32 w2c_load64__0__wasm_as0x2Dcall_indirect0x2Dmid(w2c_load64__0__wasm*);
+
+/* export: 'as-call_indirect-last' */
+u32 w2c_load64__0__wasm_as0x2Dcall_indirect0x2Dlast(w2c_load64__0__wasm*);
+
+/* export: 'as-call_indirect-index' */
+u32 w2c_load64__0__wasm_as0x2Dcall_indirect0x2Dindex(w2c_load64__0__wasm*);
+
+/* export: 'as-local.set-value' */
+void w2c_load64__0__wasm_as0x2Dlocal0x2Eset0x2Dvalue(w2c_load64__0__wasm*);
+
+/* export: 'as-local.tee-value' */
+u32 w2c_load64__0__wasm_as0x2Dlocal0x2Etee0x2Dvalue(w2c_load64__0__wasm*);
+
+/* export: 'as-global.set-value' */
+void w2c_load64__0__wasm_as0x2Dglobal0x2Eset0x2Dvalue(w2c_load64__0__wasm*);
+
+/* export: 'as-load-address' */
+u32 w2c_load64__0__wasm_as0x2Dload0x2Daddress(w2c_load64__0__wasm*);
+
+/* export: 'as-loadN-address' */
+u32 w2c_load64__0__wasm_as0x2DloadN0x2Daddress(w2c_load64__0__wasm*);
+
+/* export: 'as-store-address' */
+void w2c_load64__0__wasm_as0x2Dstore0x2Daddress(w2c_load64__0__wasm*);
+
+/* export: 'as-store-value' */
+void w2c_load64__0__wasm_as0x2Dstore0x2Dvalue(w2c_load64__0__wasm*);
+
+/* export: 'as-storeN-address' */
+void w2c_load64__0__wasm_as0x2DstoreN0x2Daddress(w2c_load64__0__wasm*);
+
+/* export: 'as-storeN-value' */
+void w2c_load64__0__wasm_as0x2DstoreN0x2Dvalue(w2c_load64__0__wasm*);
+
+/* export: 'as-unary-operand' */
+u32 w2c_load64__0__wasm_as0x2Dunary0x2Doperand(w2c_load64__0__wasm*);
+
+/* export: 'as-binary-left' */
+u32 w2c_load64__0__wasm_as0x2Dbinary0x2Dleft(w2c_load64__0__wasm*);
+
+/* export: 'as-binary-right' */
+u32 w2c_load64__0__wasm_as0x2Dbinary0x2Dright(w2c_load64__0__wasm*);
+
+/* export: 'as-test-operand' */
+u32 w2c_load64__0__wasm_as0x2Dtest0x2Doperand(w2c_load64__0__wasm*);
+
+/* export: 'as-compare-left' */
+u32 w2c_load64__0__wasm_as0x2Dcompare0x2Dleft(w2c_load64__0__wasm*);
+
+/* export: 'as-compare-right' */
+u32 w2c_load64__0__wasm_as0x2Dcompare0x2Dright(w2c_load64__0__wasm*);
+
+/* export: 'as-memory.grow-size' */
+u64 w2c_load64__0__wasm_as0x2Dmemory0x2Egrow0x2Dsize(w2c_load64__0__wasm*);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* LOAD64_0_H_GENERATED_ */
@@ -0,0 +1 @@
+(memory i64 1)(func (param i64) (result f32) (f32.load32 (local.get 0)))
\ No newline at end of file
@@ -0,0 +1 @@
+(memory i64 1)(func (param i64) (result i64) (i64.load64 (local.get 0)))
\ No newline at end of file
@@ -0,0 +1 @@
+(memory $foo 1)(memory $foo 1)
\ No newline at end of file
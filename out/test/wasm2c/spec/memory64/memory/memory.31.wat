@@ -0,0 +1 @@
+(import "" "" (memory $foo 1))(import "" "" (memory $foo 1))
\ No newline at end of file
@@ -0,0 +1,1744 @@
+/* Automatically generated by wasm2c */
+#include <assert.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <string.h>
+#if defined(__MINGW32__)
+#include <malloc.h>
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#include <malloc.h>
+#define alloca _alloca
+#elif defined(__FreeBSD__) || defined(__OpenBSD__)
+#include <stdlib.h>
+#else
+#include <alloca.h>
+#endif
+
+#include "memory_copy.193.h"
+
+// Computes a pointer to an object of the given size in a little-endian memory.
+//
+// On a little-endian host, this is just &mem->data[addr] - the object's size is
+// unused. On a big-endian host, it's &mem->data[mem->size - addr - n], where n
+// is the object's size.
+//
+// Note that mem may be evaluated multiple times.
+//
+// Parameters:
+// mem - The memory.
+// addr - The address.
+// n - The size of the object.
+//
+// Result:
+// A pointer for an object of size n.
+#if WABT_BIG_ENDIAN
+#define MEM_ADDR(mem, addr, n) ((mem)->data_end - (addr) - (n))
+#else
+#define MEM_ADDR(mem, addr, n) &((mem)->data[addr])
+#endif
+
+// We can only use Segue for this module if it uses a single unshared,
+// default-page, 32-bit imported or exported memory.
+#if WASM_RT_USE_SEGUE && IS_SINGLE_UNSHARED_DEFAULT32_MEMORY
+#define WASM_RT_USE_SEGUE_FOR_THIS_MODULE 1
+#else
+#define WASM_RT_USE_SEGUE_FOR_THIS_MODULE 0
+#endif
+
+#ifndef WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE
+#define WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE 1
+#endif
+
+#if WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE && WASM_RT_USE_MMAP && \
+    IS_SINGLE_UNSHARED_DEFAULT32_MEMORY && !WABT_BIG_ENDIAN
+#define WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE_FOR_THIS_MODULE 1
+#else
+#define WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE_FOR_THIS_MODULE 0
+#endif
+
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+// POSIX uses FS for TLS, GS is free
+static inline void* wasm_rt_segue_read_base() {
+  if (wasm_rt_fsgsbase_inst_supported) {
+    return (void*)__builtin_ia32_rdgsbase64();
+  } else {
+    return wasm_rt_syscall_get_segue_base();
+  }
+}
+static inline void wasm_rt_segue_write_base(void* base) {
+#if WASM_RT_SEGUE_FREE_SEGMENT
+  if (wasm_rt_last_segment_val == base) {
+    return;
+  }
+
+  wasm_rt_last_segment_val = base;
+#endif
+
+  if (wasm_rt_fsgsbase_inst_supported) {
+    __builtin_ia32_wrgsbase64((uintptr_t)base);
+  } else {
+    wasm_rt_syscall_set_segue_base(base);
+  }
+}
+#define MEM_ADDR_MEMOP(mem, addr, n) ((uint8_t __seg_gs*)(uintptr_t)addr)
+#elif WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE_FOR_THIS_MODULE
+#define MEM_ADDR_MEMOP(mem, addr, n) (&wasm_rt_local_memory_base[(addr)])
+#else
+#define MEM_ADDR_MEMOP(mem, addr, n) MEM_ADDR(mem, addr, n)
+#endif
+
+#define TRAP(x) (wasm_rt_trap(WASM_RT_TRAP_##x), 0)
+
+#if WASM_RT_STACK_DEPTH_COUNT
+#define FUNC_PROLOGUE                                            \
+  if (++wasm_rt_call_stack_depth > WASM_RT_MAX_CALL_STACK_DEPTH) \
+    TRAP(EXHAUSTION);
+
+#define FUNC_EPILOGUE --wasm_rt_call_stack_depth
+#else
+#define FUNC_PROLOGUE
+
+#define FUNC_EPILOGUE
+#endif
+
+#define UNREACHABLE TRAP(UNREACHABLE)
+
+#if defined(__clang__) || defined(__GNUC__)
+#define W2C_COLD_FUNC __attribute__((noinline, cold))
+#elif defined(_MSC_VER)
+#define W2C_COLD_FUNC __declspec(noinline)
+#else
+#define W2C_COLD_FUNC
+#endif
+
+W2C_COLD_FUNC static bool func_types_eq_slowpath(
+    const wasm_rt_funcref_table_t* table,
+    const wasm_rt_func_type_t expected_type,
+    uint32_t index) {
+  const size_t sha256size = 32;
+  if (index >= table->size) {
+    // Table index out of bounds. Raise Wasm trap.
+    TRAP(CALL_INDIRECT);
+    return false;
+  }
+  const wasm_rt_funcref_t* const func_ref = &table->data[index];
+  if (!expected_type || !func_ref->func || !func_ref->func_type ||
+      memcmp(expected_type, func_ref->func_type, sha256size) != 0) {
+    // Type check failed. Raise Wasm trap.
+    TRAP(CALL_INDIRECT);
+    return false;
+  }
+  return true;
+}
+
+#define CHECK_CALL_INDIRECT(table, ft, x)                       \
+  (LIKELY((x) < table.size && ft == table.data[x].func_type) || \
+   func_types_eq_slowpath(&(table), ft, x))
+
+#define DO_CALL_INDIRECT(table, t, x, ...) ((t)table.data[x].func)(__VA_ARGS__)
+
+#define CALL_INDIRECT(table, t, ft, x, ...) \
+  (CHECK_CALL_INDIRECT(table, ft, x),       \
+   DO_CALL_INDIRECT(table, t, x, __VA_ARGS__))
+
+static inline uint64_t checked_add_u64(uint64_t a, uint64_t b) {
+  uint64_t ret;
+#if __has_builtin(__builtin_add_overflow)
+  if (__builtin_add_overflow(a, b, &ret))
+    TRAP(OOB);
+#elif defined(_MSC_VER)
+  if (_addcarry_u64(0, a, b, &ret))
+    TRAP(OOB);
+#else
+  ret = a + b;
+  if (ret < a)
+    TRAP(OOB);
+#endif
+  return ret;
+}
+
+#define RANGE_CHECK(mem, offset, len)            \
+  do {                                           \
+    uint64_t res = checked_add_u64(offset, len); \
+    if (UNLIKELY(res > (mem)->size))             \
+      TRAP(OOB);                                 \
+  } while (0);
+
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && WASM_RT_SANITY_CHECKS
+#include <stdio.h>
+#define WASM_RT_CHECK_BASE(mem)                                               \
+  if (((uintptr_t)((mem)->data)) != ((uintptr_t)wasm_rt_segue_read_base())) { \
+    puts("Segment register mismatch\n");                                      \
+    abort();                                                                  \
+  }
+#else
+#define WASM_RT_CHECK_BASE(mem)
+#endif
+
+// MEMCHECK_DEFAULT32 is an "accelerated" MEMCHECK used only for
+// default-page-size, 32-bit memories. It may do nothing at all
+// (if hardware bounds-checking is enabled via guard pages)
+// or it may do a slightly faster RANGE_CHECK.
+#if WASM_RT_MEMCHECK_GUARD_PAGES
+#define MEMCHECK_DEFAULT32(mem, local_memory_size, a, t) \
+  WASM_RT_CHECK_BASE(mem);
+#else
+#if WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE_FOR_THIS_MODULE
+#define MEMCHECK_DEFAULT32(mem, local_memory_size, a, t)     \
+  WASM_RT_CHECK_BASE(mem);                                   \
+  if (UNLIKELY(a + (uint64_t)sizeof(t) > local_memory_size)) \
+    TRAP(OOB);
+#else
+#define MEMCHECK_DEFAULT32(mem, local_memory_size, a, t) \
+  WASM_RT_CHECK_BASE(mem);                               \
+  if (UNLIKELY(a + (uint64_t)sizeof(t) > mem->size))     \
+    TRAP(OOB);
+#endif
+#endif
+
+// MEMCHECK_GENERAL can be used for any memory
+#define MEMCHECK_GENERAL(mem, a, t) \
+  WASM_RT_CHECK_BASE(mem);          \
+  RANGE_CHECK(mem, a, sizeof(t));
+
+// When using guard pages, reads have to be immediately consumed so that OOB
+// trap checks are applied in the right place, and not optimized away. This is
+// done using FORCE_READ_INT/FORCE_READ_FLOAT
+#if WASM_RT_MEMCHECK_BOUNDS_CHECK || \
+    WASM_RT_NONCONFORMING_ALLOW_OOB_READ_ELIMINATION
+#define FORCE_READ_INT(var)
+#define FORCE_READ_FLOAT(var)
+#elif defined(__GNUC__) && WASM_RT_MEMCHECK_GUARD_PAGES
+#define FORCE_READ_INT(var) __asm__("" ::"r"(var))
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define FORCE_READ_FLOAT_CONSTRAINT "x"
+#elif defined(__aarch64__) && defined(__ARM_FP) && ((__ARM_FP & 0x4) != 0)
+#define FORCE_READ_FLOAT_CONSTRAINT "w"
+#elif defined(__mips__) && defined(__clang__) && !defined(__mips_soft_float)
+// Clang before v18 uses hard floats which has a different constraint
+#define FORCE_READ_FLOAT_CONSTRAINT "f"
+#elif (defined(__powerpc__) || defined(__ppc__) || defined(__PPC__)) && \
+    !(defined(_SOFT_FLOAT) || defined(__NO_FPRS__))
+#define FORCE_READ_FLOAT_CONSTRAINT "f"
+#elif defined(__riscv) && defined(__riscv_flen) && (__riscv_flen >= 32)
+#define FORCE_READ_FLOAT_CONSTRAINT "f"
+#elif defined(__s390__) || defined(__s390x__)
+#define FORCE_READ_FLOAT_CONSTRAINT "f"
+#else
+#define FORCE_READ_FLOAT_CONSTRAINT "r"
+#endif
+
+#define FORCE_READ_FLOAT(var) __asm__("" ::FORCE_READ_FLOAT_CONSTRAINT(var))
+#else
+#error \
+    "Guard page mode for Wasm not supported on this platform because FORCE_READ_INT/FORCE_READ_FLOAT could not be instantiated." \
+   "Either enable specify -DWASM_RT_NONCONFORMING_ALLOW_OOB_READ_ELIMINATION=1 during compilation or use -DWASM_RT_MEMCHECK_BOUNDS_CHECK=1 to use bounds check mode"
+#endif
+
+static inline void load_data(u8* dest, const u8* src, size_t n) {
+  if (!n) {
+    return;
+  }
+#if WABT_BIG_ENDIAN
+  for (size_t i = 0; i < n; i++) {
+    dest[i] = src[n - i - 1];
+  }
+#else
+  wasm_rt_memcpy(dest, src, n);
+#endif
+}
+
+#define LOAD_DATA(m, o, i, s)            \
+  do {                                   \
+    RANGE_CHECK((&m), o, s);             \
+    load_data(MEM_ADDR(&m, o, s), i, s); \
+  } while (0)
+
+#define DEF_MEM_CHECKS0(name, shared, mem_type, ret_kw, return_type)         \
+  static inline return_type name##_default32(                                \
+      uint8_t* const wasm_rt_local_memory_base,                              \
+      uint64_t wasm_rt_local_memory_size, wasm_rt##shared##memory_t* mem,    \
+      u64 addr) {                                                            \
+    MEMCHECK_DEFAULT32(mem, wasm_rt_local_memory_size, addr, mem_type);      \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr);           \
+  }                                                                          \
+  static inline return_type name(uint8_t* const wasm_rt_local_memory_base,   \
+                                 uint64_t wasm_rt_local_memory_size,         \
+                                 wasm_rt##shared##memory_t* mem, u64 addr) { \
+    MEMCHECK_GENERAL(mem, addr, mem_type);                                   \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr);           \
+  }
+
+#define DEF_MEM_CHECKS1(name, shared, mem_type, ret_kw, return_type,       \
+                        val_type1)                                         \
+  static inline return_type name##_default32(                              \
+      uint8_t* const wasm_rt_local_memory_base,                            \
+      uint64_t wasm_rt_local_memory_size, wasm_rt##shared##memory_t* mem,  \
+      u64 addr, val_type1 val1) {                                          \
+    MEMCHECK_DEFAULT32(mem, wasm_rt_local_memory_size, addr, mem_type);    \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr, val1);   \
+  }                                                                        \
+  static inline return_type name(uint8_t* const wasm_rt_local_memory_base, \
+                                 uint64_t wasm_rt_local_memory_size,       \
+                                 wasm_rt##shared##memory_t* mem, u64 addr, \
+                                 val_type1 val1) {                         \
+    MEMCHECK_GENERAL(mem, addr, mem_type);                                 \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr, val1);   \
+  }
+
+#define DEF_MEM_CHECKS2(name, shared, mem_type, ret_kw, return_type,           \
+                        val_type1, val_type2)                                  \
+  static inline return_type name##_default32(                                  \
+      uint8_t* const wasm_rt_local_memory_base,                                \
+      uint64_t wasm_rt_local_memory_size, wasm_rt##shared##memory_t* mem,      \
+      u64 addr, val_type1 val1, val_type2 val2) {                              \
+    MEMCHECK_DEFAULT32(mem, wasm_rt_local_memory_size, addr, mem_type);        \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr, val1, val2); \
+  }                                                                            \
+  static inline return_type name(uint8_t* const wasm_rt_local_memory_base,     \
+                                 uint64_t wasm_rt_local_memory_size,           \
+                                 wasm_rt##shared##memory_t* mem, u64 addr,     \
+                                 val_type1 val1, val_type2 val2) {             \
+    MEMCHECK_GENERAL(mem, addr, mem_type);                                     \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr, val1, val2); \
+  }
+
+#define DEFINE_LOAD(name, t1, t2, t3, force_read)                             \
+  static inline t3 name##_unchecked(uint8_t* const wasm_rt_local_memory_base, \
+                                    wasm_rt_memory_t* mem, u64 addr) {        \
+    t1 result;                                                                \
+    wasm_rt_memcpy(&result, MEM_ADDR_MEMOP(mem, addr, sizeof(t1)),            \
+                   sizeof(t1));                                               \
+    t3 ret = (t3)(t2)result;                                                  \
+    force_read(ret);                                                          \
+    return ret;                                                               \
+  }                                                                           \
+  DEF_MEM_CHECKS0(name, _, t1, return, t3)
+
+#define DEFINE_STORE(name, t1, t2)                                     \
+  static inline void name##_unchecked(                                 \
+      uint8_t* const wasm_rt_local_memory_base, wasm_rt_memory_t* mem, \
+      u64 addr, t2 value) {                                            \
+    t1 wrapped = (t1)value;                                            \
+    wasm_rt_memcpy(MEM_ADDR_MEMOP(mem, addr, sizeof(t1)), &wrapped,    \
+                   sizeof(t1));                                        \
+  }                                                                    \
+  DEF_MEM_CHECKS1(name, _, t1, , void, t2)
+
+DEFINE_LOAD(i32_load, u32, u32, u32, FORCE_READ_INT)
+DEFINE_LOAD(i64_load, u64, u64, u64, FORCE_READ_INT)
+DEFINE_LOAD(f32_load, f32, f32, f32, FORCE_READ_FLOAT)
+DEFINE_LOAD(f64_load, f64, f64, f64, FORCE_READ_FLOAT)
+DEFINE_LOAD(i32_load8_s, s8, s32, u32, FORCE_READ_INT)
+DEFINE_LOAD(i64_load8_s, s8, s64, u64, FORCE_READ_INT)
+DEFINE_LOAD(i32_load8_u, u8, u32, u32, FORCE_READ_INT)
+DEFINE_LOAD(i64_load8_u, u8, u64, u64, FORCE_READ_INT)
+DEFINE_LOAD(i32_load16_s, s16, s32, u32, FORCE_READ_INT)
+DEFINE_LOAD(i64_load16_s, s16, s64, u64, FORCE_READ_INT)
+DEFINE_LOAD(i32_load16_u, u16, u32, u32, FORCE_READ_INT)
+DEFINE_LOAD(i64_load16_u, u16, u64, u64, FORCE_READ_INT)
+DEFINE_LOAD(i64_load32_s, s32, s64, u64, FORCE_READ_INT)
+DEFINE_LOAD(i64_load32_u, u32, u64, u64, FORCE_READ_INT)
+DEFINE_STORE(i32_store, u32, u32)
+DEFINE_STORE(i64_store, u64, u64)
+DEFINE_STORE(f32_store, f32, f32)
+DEFINE_STORE(f64_store, f64, f64)
+DEFINE_STORE(i32_store8, u8, u32)
+DEFINE_STORE(i32_store16, u16, u32)
+DEFINE_STORE(i64_store8, u8, u64)
+DEFINE_STORE(i64_store16, u16, u64)
+DEFINE_STORE(i64_store32, u32, u64)
+
+#if defined(_MSC_VER)
+
+// Adapted from
+// https://github.com/nemequ/portable-snippets/blob/master/builtin/builtin.h
+
+static inline int I64_CLZ(unsigned long long v) {
+  unsigned long r = 0;
+#if defined(_M_AMD64) || defined(_M_ARM)
+  if (_BitScanReverse64(&r, v)) {
+    return 63 - r;
+  }
+#else
+  if (_BitScanReverse(&r, (unsigned long)(v >> 32))) {
+    return 31 - r;
+  } else if (_BitScanReverse(&r, (unsigned long)v)) {
+    return 63 - r;
+  }
+#endif
+  return 64;
+}
+
+static inline int I32_CLZ(unsigned long v) {
+  unsigned long r = 0;
+  if (_BitScanReverse(&r, v)) {
+    return 31 - r;
+  }
+  return 32;
+}
+
+static inline int I64_CTZ(unsigned long long v) {
+  if (!v) {
+    return 64;
+  }
+  unsigned long r = 0;
+#if defined(_M_AMD64) || defined(_M_ARM)
+  _BitScanForward64(&r, v);
+  return (int)r;
+#else
+  if (_BitScanForward(&r, (unsigned int)(v))) {
+    return (int)(r);
+  }
+
+  _BitScanForward(&r, (unsigned int)(v >> 32));
+  return (int)(r + 32);
+#endif
+}
+
+static inline int I32_CTZ(unsigned long v) {
+  if (!v) {
+    return 32;
+  }
+  unsigned long r = 0;
+  _BitScanForward(&r, v);
+  return (int)r;
+}
+
+#define POPCOUNT_DEFINE_PORTABLE(f_n, T)                            \
+  static inline u32 f_n(T x) {                                      \
+    x = x - ((x >> 1) & (T) ~(T)0 / 3);                             \
+    x = (x & (T) ~(T)0 / 15 * 3) + ((x >> 2) & (T) ~(T)0 / 15 * 3); \
+    x = (x + (x >> 4)) & (T) ~(T)0 / 255 * 15;                      \
+    return (T)(x * ((T) ~(T)0 / 255)) >> (sizeof(T) - 1) * 8;       \
+  }
+
+POPCOUNT_DEFINE_PORTABLE(I32_POPCNT, u32)
+POPCOUNT_DEFINE_PORTABLE(I64_POPCNT, u64)
+
+#undef POPCOUNT_DEFINE_PORTABLE
+
+#else
+
+#define I32_CLZ(x) ((x) ? __builtin_clz(x) : 32)
+#define I64_CLZ(x) ((x) ? __builtin_clzll(x) : 64)
+#define I32_CTZ(x) ((x) ? __builtin_ctz(x) : 32)
+#define I64_CTZ(x) ((x) ? __builtin_ctzll(x) : 64)
+#define I32_POPCNT(x) (__builtin_popcount(x))
+#define I64_POPCNT(x) (__builtin_popcountll(x))
+
+#endif
+
+#define DIV_S(ut, min, x, y)                                  \
+  ((UNLIKELY((y) == 0))                  ? TRAP(DIV_BY_ZERO)  \
+   : (UNLIKELY((x) == min && (y) == -1)) ? TRAP(INT_OVERFLOW) \
+                                         : (ut)((x) / (y)))
+
+#define REM_S(ut, min, x, y)                                 \
+  ((UNLIKELY((y) == 0))                  ? TRAP(DIV_BY_ZERO) \
+   : (UNLIKELY((x) == min && (y) == -1)) ? 0                 \
+                                         : (ut)((x) % (y)))
+
+#define I32_DIV_S(x, y) DIV_S(u32, INT32_MIN, (s32)x, (s32)y)
+#define I64_DIV_S(x, y) DIV_S(u64, INT64_MIN, (s64)x, (s64)y)
+#define I32_REM_S(x, y) REM_S(u32, INT32_MIN, (s32)x, (s32)y)
+#define I64_REM_S(x, y) REM_S(u64, INT64_MIN, (s64)x, (s64)y)
+
+#define DIVREM_U(op, x, y) \
+  ((UNLIKELY((y) == 0)) ? TRAP(DIV_BY_ZERO) : ((x)op(y)))
+
+#define DIV_U(x, y) DIVREM_U(/, x, y)
+#define REM_U(x, y) DIVREM_U(%, x, y)
+
+#define ROTL(x, y, mask) \
+  (((x) << ((y) & (mask))) | ((x) >> (((mask) - (y) + 1) & (mask))))
+#define ROTR(x, y, mask) \
+  (((x) >> ((y) & (mask))) | ((x) << (((mask) - (y) + 1) & (mask))))
+
+#define I32_ROTL(x, y) ROTL(x, y, 31)
+#define I64_ROTL(x, y) ROTL(x, y, 63)
+#define I32_ROTR(x, y) ROTR(x, y, 31)
+#define I64_ROTR(x, y) ROTR(x, y, 63)
+
+#define FMIN(x, y)                                           \
+  ((UNLIKELY((x) != (x)))             ? NAN                  \
+   : (UNLIKELY((y) != (y)))           ? NAN                  \
+   : (UNLIKELY((x) == 0 && (y) == 0)) ? (signbit(x) ? x : y) \
+   : (x < y)                          ? x                    \
+                                      : y)
+
+#define FMAX(x, y)                                           \
+  ((UNLIKELY((x) != (x)))             ? NAN                  \
+   : (UNLIKELY((y) != (y)))           ? NAN                  \
+   : (UNLIKELY((x) == 0 && (y) == 0)) ? (signbit(x) ? y : x) \
+   : (x > y)                          ? x                    \
+                                      : y)
+
+#define TRUNC_S(ut, st, ft, min, minop, max, x)                             \
+  ((UNLIKELY((x) != (x)))                        ? TRAP(INVALID_CONVERSION) \
+   : (UNLIKELY(!((x)minop(min) && (x) < (max)))) ? TRAP(INT_OVERFLOW)       \
+                                                 : (ut)(st)(x))
+
+#define I32_TRUNC_S_F32(x) \
+  TRUNC_S(u32, s32, f32, (f32)INT32_MIN, >=, 2147483648.f, x)
+#define I64_TRUNC_S_F32(x) \
+  TRUNC_S(u64, s64, f32, (f32)INT64_MIN, >=, (f32)INT64_MAX, x)
+#define I32_TRUNC_S_F64(x) \
+  TRUNC_S(u32, s32, f64, -2147483649., >, 2147483648., x)
+#define I64_TRUNC_S_F64(x) \
+  TRUNC_S(u64, s64, f64, (f64)INT64_MIN, >=, (f64)INT64_MAX, x)
+
+#define TRUNC_U(ut, ft, max, x)                                              \
+  ((UNLIKELY((x) != (x)))                         ? TRAP(INVALID_CONVERSION) \
+   : (UNLIKELY(!((x) > (ft) - 1 && (x) < (max)))) ? TRAP(INT_OVERFLOW)       \
+                                                  : (ut)(x))
+
+#define I32_TRUNC_U_F32(x) TRUNC_U(u32, f32, 4294967296.f, x)
+#define I64_TRUNC_U_F32(x) TRUNC_U(u64, f32, (f32)UINT64_MAX, x)
+#define I32_TRUNC_U_F64(x) TRUNC_U(u32, f64, 4294967296., x)
+#define I64_TRUNC_U_F64(x) TRUNC_U(u64, f64, (f64)UINT64_MAX, x)
+
+#define TRUNC_SAT_S(ut, st, ft, min, smin, minop, max, smax, x) \
+  ((UNLIKELY((x) != (x)))         ? 0                           \
+   : (UNLIKELY(!((x)minop(min)))) ? smin                        \
+   : (UNLIKELY(!((x) < (max))))   ? smax                        \
+                                  : (ut)(st)(x))
+
+#define I32_TRUNC_SAT_S_F32(x)                                            \
+  TRUNC_SAT_S(u32, s32, f32, (f32)INT32_MIN, INT32_MIN, >=, 2147483648.f, \
+              INT32_MAX, x)
+#define I64_TRUNC_SAT_S_F32(x)                                              \
+  TRUNC_SAT_S(u64, s64, f32, (f32)INT64_MIN, INT64_MIN, >=, (f32)INT64_MAX, \
+              INT64_MAX, x)
+#define I32_TRUNC_SAT_S_F64(x)                                        \
+  TRUNC_SAT_S(u32, s32, f64, -2147483649., INT32_MIN, >, 2147483648., \
+              INT32_MAX, x)
+#define I64_TRUNC_SAT_S_F64(x)                                              \
+  TRUNC_SAT_S(u64, s64, f64, (f64)INT64_MIN, INT64_MIN, >=, (f64)INT64_MAX, \
+              INT64_MAX, x)
+
+#define TRUNC_SAT_U(ut, ft, max, smax, x) \
+  ((UNLIKELY((x) != (x)))          ? 0    \
+   : (UNLIKELY(!((x) > (ft) - 1))) ? 0    \
+   : (UNLIKELY(!((x) < (max))))    ? smax \
+                                   : (ut)(x))
+
+#define I32_TRUNC_SAT_U_F32(x) \
+  TRUNC_SAT_U(u32, f32, 4294967296.f, UINT32_MAX, x)
+#define I64_TRUNC_SAT_U_F32(x) \
+  TRUNC_SAT_U(u64, f32, (f32)UINT64_MAX, UINT64_MAX, x)
+#define I32_TRUNC_SAT_U_F64(x) TRUNC_SAT_U(u32, f64, 4294967296., UINT32_MAX, x)
+#define I64_TRUNC_SAT_U_F64(x) \
+  TRUNC_SAT_U(u64, f64, (f64)UINT64_MAX, UINT64_MAX, x)
+
+#define DEFINE_REINTERPRET(name, t1, t2)         \
+  static inline t2 name(t1 x) {                  \
+    t2 result;                                   \
+    wasm_rt_memcpy(&result, &x, sizeof(result)); \
+    return result;                               \
+  }
+
+DEFINE_REINTERPRET(f32_reinterpret_i32, u32, f32)
+DEFINE_REINTERPRET(i32_reinterpret_f32, f32, u32)
+DEFINE_REINTERPRET(f64_reinterpret_i64, u64, f64)
+DEFINE_REINTERPRET(i64_reinterpret_f64, f64, u64)
+
+static float quiet_nanf(float x) {
+  uint32_t tmp;
+  wasm_rt_memcpy(&tmp, &x, 4);
+  tmp |= 0x7fc00000lu;
+  wasm_rt_memcpy(&x, &tmp, 4);
+  return x;
+}
+
+static double quiet_nan(double x) {
+  uint64_t tmp;
+  wasm_rt_memcpy(&tmp, &x, 8);
+  tmp |= 0x7ff8000000000000llu;
+  wasm_rt_memcpy(&x, &tmp, 8);
+  return x;
+}
+
+static double wasm_quiet(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+  return x;
+}
+
+static float wasm_quietf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+  return x;
+}
+
+static double wasm_floor(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+  return floor(x);
+}
+
+static float wasm_floorf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+  return floorf(x);
+}
+
+static double wasm_ceil(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+  return ceil(x);
+}
+
+static float wasm_ceilf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+  return ceilf(x);
+}
+
+static double wasm_trunc(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+  return trunc(x);
+}
+
+static float wasm_truncf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+  return truncf(x);
+}
+
+static float wasm_nearbyintf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+  return nearbyintf(x);
+}
+
+static double wasm_nearbyint(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+  return nearbyint(x);
+}
+
+static float wasm_fabsf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    uint32_t tmp;
+    wasm_rt_memcpy(&tmp, &x, 4);
+    tmp = tmp & ~(1UL << 31);
+    wasm_rt_memcpy(&x, &tmp, 4);
+    return x;
+  }
+  return fabsf(x);
+}
+
+static double wasm_fabs(double x) {
+  if (UNLIKELY(isnan(x))) {
+    uint64_t tmp;
+    wasm_rt_memcpy(&tmp, &x, 8);
+    tmp = tmp & ~(1ULL << 63);
+    wasm_rt_memcpy(&x, &tmp, 8);
+    return x;
+  }
+  return fabs(x);
+}
+
+static double wasm_sqrt(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+
+#if __has_builtin(__builtin_elementwise_sqrt)
+  // Fastest option: doesn't set errno
+  return __builtin_elementwise_sqrt(x);
+#elif __has_builtin(__builtin_sqrt)
+  // Optimized if -fno-math-errno is set
+  return __builtin_sqrt(x);
+#else
+  // Libc call. May/may not be optimized
+  return sqrt(x);
+#endif
+}
+
+static float wasm_sqrtf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+
+#if __has_builtin(__builtin_elementwise_sqrt)
+  // Fastest option: doesn't set errno
+  return __builtin_elementwise_sqrt(x);
+#elif __has_builtin(__builtin_sqrt)
+  // Optimized if -fno-math-errno is set
+  return __builtin_sqrtf(x);
+#else
+  // Libc call. May/may not be optimized
+  return sqrtf(x);
+#endif
+}
+
+static inline void memory_fill(wasm_rt_memory_t* mem, u64 d, u32 val, u64 n) {
+  RANGE_CHECK(mem, d, n);
+  memset(MEM_ADDR(mem, d, n), val, n);
+}
+
+static inline void memory_copy(wasm_rt_memory_t* dest,
+                               const wasm_rt_memory_t* src,
+                               u64 dest_addr,
+                               u64 src_addr,
+                               u64 n) {
+  RANGE_CHECK(dest, dest_addr, n);
+  RANGE_CHECK(src, src_addr, n);
+  memmove(MEM_ADDR(dest, dest_addr, n), MEM_ADDR(src, src_addr, n), n);
+}
+
+static inline void memory_init(wasm_rt_memory_t* dest,
+                               const u8* src,
+                               u32 src_size,
+                               u64 dest_addr,
+                               u32 src_addr,
+                               u32 n) {
+  if (UNLIKELY(src_addr + (uint64_t)n > src_size))
+    TRAP(OOB);
+  LOAD_DATA((*dest), dest_addr, src + src_addr, n);
+}
+
+typedef enum { RefFunc, RefNull, GlobalGet } wasm_elem_segment_expr_type_t;
+
+typedef struct {
+  wasm_elem_segment_expr_type_t expr_type;
+  wasm_rt_func_type_t type;
+  wasm_rt_function_ptr_t func;
+  wasm_rt_tailcallee_t func_tailcallee;
+  size_t module_offset;
+} wasm_elem_segment_expr_t;
+
+static inline void funcref_table_init(wasm_rt_funcref_table_t* dest,
+                                      const wasm_elem_segment_expr_t* src,
+                                      u32 src_size,
+                                      u64 dest_addr,
+                                      u32 src_addr,
+                                      u32 n,
+                                      void* module_instance) {
+  if (UNLIKELY(src_addr + (uint64_t)n > src_size))
+    TRAP(OOB);
+  RANGE_CHECK(dest, dest_addr, n);
+  for (u32 i = 0; i < n; i++) {
+    const wasm_elem_segment_expr_t* const src_expr = &src[src_addr + i];
+    wasm_rt_funcref_t* const dest_val = &(dest->data[dest_addr + i]);
+    switch (src_expr->expr_type) {
+      case RefFunc:
+        *dest_val = (wasm_rt_funcref_t){
+            src_expr->type, src_expr->func, src_expr->func_tailcallee,
+            (char*)module_instance + src_expr->module_offset};
+        break;
+      case RefNull:
+        *dest_val = wasm_rt_funcref_null_value;
+        break;
+      case GlobalGet:
+        *dest_val = **(wasm_rt_funcref_t**)((char*)module_instance +
+                                            src_expr->module_offset);
+        break;
+    }
+  }
+}
+
+// Currently wasm2c only supports initializing externref tables with ref.null.
+static inline void externref_table_init(wasm_rt_externref_table_t* dest,
+                                        u32 src_size,
+                                        u64 dest_addr,
+                                        u32 src_addr,
+                                        u32 n) {
+  if (UNLIKELY(src_addr + (uint64_t)n > src_size))
+    TRAP(OOB);
+  RANGE_CHECK(dest, dest_addr, n);
+  for (u32 i = 0; i < n; i++) {
+    dest->data[dest_addr + i] = wasm_rt_externref_null_value;
+  }
+}
+
+#define DEFINE_TABLE_COPY(type)                                              \
+  static inline void type##_table_copy(wasm_rt_##type##_table_t* dest,       \
+                                       const wasm_rt_##type##_table_t* src,  \
+                                       u64 dest_addr, u64 src_addr, u64 n) { \
+    RANGE_CHECK(dest, dest_addr, n);                                         \
+    RANGE_CHECK(src, src_addr, n);                                           \
+    memmove(dest->data + dest_addr, src->data + src_addr,                    \
+            n * sizeof(wasm_rt_##type##_t));                                 \
+  }
+
+DEFINE_TABLE_COPY(funcref)
+DEFINE_TABLE_COPY(externref)
+
+#define DEFINE_TABLE_GET(type)                        \
+  static inline wasm_rt_##type##_t type##_table_get(  \
+      const wasm_rt_##type##_table_t* table, u64 i) { \
+    if (UNLIKELY(i >= table->size))                   \
+      TRAP(OOB);                                      \
+    return table->data[i];                            \
+  }
+
+DEFINE_TABLE_GET(funcref)
+DEFINE_TABLE_GET(externref)
+
+#define DEFINE_TABLE_SET(type)                                               \
+  static inline void type##_table_set(const wasm_rt_##type##_table_t* table, \
+                                      u64 i, const wasm_rt_##type##_t val) { \
+    if (UNLIKELY(i >= table->size))                                          \
+      TRAP(OOB);                                                             \
+    table->data[i] = val;                                                    \
+  }
+
+DEFINE_TABLE_SET(funcref)
+DEFINE_TABLE_SET(externref)
+
+#define DEFINE_TABLE_FILL(type)                                               \
+  static inline void type##_table_fill(const wasm_rt_##type##_table_t* table, \
+                                       u64 d, const wasm_rt_##type##_t val,   \
+                                       u64 n) {                               \
+    RANGE_CHECK(table, d, n);                                                 \
+    for (uint32_t i = d; i < d + n; i++) {                                    \
+      table->data[i] = val;                                                   \
+    }                                                                         \
+  }
+
+DEFINE_TABLE_FILL(funcref)
+DEFINE_TABLE_FILL(externref)
+
+#if defined(__GNUC__) || defined(__clang__)
+#define FUNC_TYPE_DECL_EXTERN_T(x) extern const char* const x
+#define FUNC_TYPE_EXTERN_T(x) const char* const x
+#define FUNC_TYPE_T(x) static const char* const x
+#else
+#define FUNC_TYPE_DECL_EXTERN_T(x) extern const char x[]
+#define FUNC_TYPE_EXTERN_T(x) const char x[]
+#define FUNC_TYPE_T(x) static const char x[]
+#endif
+
+#if (__STDC_VERSION__ < 201112L) && !defined(static_assert)
+#define static_assert(X) \
+  extern int(*assertion(void))[!!sizeof(struct { int x : (X) ? 2 : -1; })];
+#endif
+
+#ifdef _MSC_VER
+#define WEAK_FUNC_DECL(func, fallback)                             \
+  __pragma(comment(linker, "/alternatename:" #func "=" #fallback)) \
+                                                                   \
+      void                                                         \
+      fallback(void** instance_ptr, void* tail_call_stack,         \
+               wasm_rt_tailcallee_t* next)
+#else
+#define WEAK_FUNC_DECL(func, fallback)                                        \
+  __attribute__((weak)) void func(void** instance_ptr, void* tail_call_stack, \
+                                  wasm_rt_tailcallee_t* next)
+#endif
+
+static void w2c_memory__copy__193__wasm_test_0(w2c_memory__copy__193__wasm*);
+static u64 w2c_memory__copy__193__wasm_checkRange_0(w2c_memory__copy__193__wasm*, u64, u64, u32);
+
+FUNC_TYPE_T(w2c_memory__copy__193__wasm_t0) = "\x36\xa9\xe7\xf1\xc9\x5b\x82\xff\xb9\x97\x43\xe0\xc5\xc4\xce\x95\xd8\x3c\x9a\x43\x0a\xac\x59\xf8\x4e\xf3\xcb\xfa\xb6\x14\x50\x68";
+FUNC_TYPE_T(w2c_memory__copy__193__wasm_t1) = "\x27\xd0\xa7\xd3\xe8\x18\x04\x07\x1a\x03\xe9\x11\x50\x3f\x96\xa4\xfe\x1e\x2a\x2a\x04\x38\x0f\xa5\x5a\xa2\x46\xa8\x79\xc4\x9c\x4f";
+
+static void init_memories(w2c_memory__copy__193__wasm* instance) {
+  wasm_rt_allocate_memory(&instance->w2c_M0, 1, 1, 1, 65536);
+}
+
+/* export: 'test' */
+void w2c_memory__copy__193__wasm_test(w2c_memory__copy__193__wasm* instance) {
+  w2c_memory__copy__193__wasm_test_0(instance);
+}
+
+/* export: 'checkRange' */
+u64 w2c_memory__copy__193__wasm_checkRange(w2c_memory__copy__193__wasm* instance, u64 var_p0, u64 var_p1, u32 var_p2) {
+  u64 ret = w2c_memory__copy__193__wasm_checkRange_0(instance, var_p0, var_p1, var_p2);
+  return ret;
+}
+
+void wasm2c_memory__copy__193__wasm_instantiate(w2c_memory__copy__193__wasm* instance) {
+  assert(wasm_rt_is_initialized());
+  init_memories(instance);
+}
+
+void wasm2c_memory__copy__193__wasm_free(w2c_memory__copy__193__wasm* instance) {
+  wasm_rt_free_memory(&instance->w2c_M0);
+}
+
+wasm_rt_func_type_t wasm2c_memory__copy__193__wasm_get_func_type(uint32_t param_count, uint32_t result_count, ...) {
+  va_list args;
+  
+  if (param_count == 0 && result_count == 0) {
+    va_start(args, result_count);
+    if (true) {
+      va_end(args);
+      return w2c_memory__copy__193__wasm_t0;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 3 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I64 && va_arg(args, int) == WASM_RT_I64 && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_I64) {
+      va_end(args);
+      return w2c_memory__copy__193__wasm_t1;
+    }
+    va_end(args);
+  }
+  
+  return NULL;
+}
+
+void w2c_memory__copy__193__wasm_test_0(w2c_memory__copy__193__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i1;
+  u64 var_j0, var_j1, var_j2;
+  var_j0 = 17767ull;
+  var_i1 = 1u;
+  var_j2 = 1344ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 39017ull;
+  var_i1 = 2u;
+  var_j2 = 1055ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 56401ull;
+  var_i1 = 3u;
+  var_j2 = 988ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 37962ull;
+  var_i1 = 4u;
+  var_j2 = 322ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 7977ull;
+  var_i1 = 5u;
+  var_j2 = 1994ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 22714ull;
+  var_i1 = 6u;
+  var_j2 = 3036ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 16882ull;
+  var_i1 = 7u;
+  var_j2 = 2372ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 43491ull;
+  var_i1 = 8u;
+  var_j2 = 835ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 124ull;
+  var_i1 = 9u;
+  var_j2 = 1393ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 2132ull;
+  var_i1 = 10u;
+  var_j2 = 2758ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 8987ull;
+  var_i1 = 11u;
+  var_j2 = 3098ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 52711ull;
+  var_i1 = 12u;
+  var_j2 = 741ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 3958ull;
+  var_i1 = 13u;
+  var_j2 = 2823ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 49715ull;
+  var_i1 = 14u;
+  var_j2 = 1280ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 50377ull;
+  var_i1 = 15u;
+  var_j2 = 1466ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 20493ull;
+  var_i1 = 16u;
+  var_j2 = 3158ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 47665ull;
+  var_i1 = 17u;
+  var_j2 = 544ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 12451ull;
+  var_i1 = 18u;
+  var_j2 = 2669ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 24869ull;
+  var_i1 = 19u;
+  var_j2 = 2651ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 45317ull;
+  var_i1 = 20u;
+  var_j2 = 1570ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 43096ull;
+  var_i1 = 21u;
+  var_j2 = 1691ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 33886ull;
+  var_i1 = 22u;
+  var_j2 = 646ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 48555ull;
+  var_i1 = 23u;
+  var_j2 = 1858ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 53453ull;
+  var_i1 = 24u;
+  var_j2 = 2657ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 30363ull;
+  var_i1 = 25u;
+  var_j2 = 981ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 9300ull;
+  var_i1 = 26u;
+  var_j2 = 1807ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 50190ull;
+  var_i1 = 27u;
+  var_j2 = 487ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 62753ull;
+  var_i1 = 28u;
+  var_j2 = 530ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 36316ull;
+  var_i1 = 29u;
+  var_j2 = 943ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 6768ull;
+  var_i1 = 30u;
+  var_j2 = 381ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 51262ull;
+  var_i1 = 31u;
+  var_j2 = 3089ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 49729ull;
+  var_i1 = 32u;
+  var_j2 = 658ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 44540ull;
+  var_i1 = 33u;
+  var_j2 = 1702ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 33342ull;
+  var_i1 = 34u;
+  var_j2 = 1092ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 50814ull;
+  var_i1 = 35u;
+  var_j2 = 1410ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 47594ull;
+  var_i1 = 36u;
+  var_j2 = 2204ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 54123ull;
+  var_i1 = 37u;
+  var_j2 = 2394ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 55183ull;
+  var_i1 = 38u;
+  var_j2 = 250ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 22620ull;
+  var_i1 = 39u;
+  var_j2 = 2097ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 17132ull;
+  var_i1 = 40u;
+  var_j2 = 3264ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 54331ull;
+  var_i1 = 41u;
+  var_j2 = 3299ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 39474ull;
+  var_i1 = 42u;
+  var_j2 = 2796ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 36156ull;
+  var_i1 = 43u;
+  var_j2 = 2070ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 35308ull;
+  var_i1 = 44u;
+  var_j2 = 2763ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 32731ull;
+  var_i1 = 45u;
+  var_j2 = 312ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 63746ull;
+  var_i1 = 46u;
+  var_j2 = 192ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 30974ull;
+  var_i1 = 47u;
+  var_j2 = 596ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 16635ull;
+  var_i1 = 48u;
+  var_j2 = 501ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 57002ull;
+  var_i1 = 49u;
+  var_j2 = 686ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 34299ull;
+  var_i1 = 50u;
+  var_j2 = 385ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 60881ull;
+  var_i1 = 51u;
+  var_j2 = 903ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 61445ull;
+  var_i1 = 52u;
+  var_j2 = 2390ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 46972ull;
+  var_i1 = 53u;
+  var_j2 = 1441ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 25973ull;
+  var_i1 = 54u;
+  var_j2 = 3162ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 5566ull;
+  var_i1 = 55u;
+  var_j2 = 2135ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 35977ull;
+  var_i1 = 56u;
+  var_j2 = 519ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 44892ull;
+  var_i1 = 57u;
+  var_j2 = 3280ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 46760ull;
+  var_i1 = 58u;
+  var_j2 = 1678ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 46607ull;
+  var_i1 = 59u;
+  var_j2 = 3168ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 22449ull;
+  var_i1 = 60u;
+  var_j2 = 1441ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 58609ull;
+  var_i1 = 61u;
+  var_j2 = 663ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 32261ull;
+  var_i1 = 62u;
+  var_j2 = 1671ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 3063ull;
+  var_i1 = 63u;
+  var_j2 = 721ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 34025ull;
+  var_i1 = 64u;
+  var_j2 = 84ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 33338ull;
+  var_i1 = 65u;
+  var_j2 = 2029ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 36810ull;
+  var_i1 = 66u;
+  var_j2 = 29ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 19147ull;
+  var_i1 = 67u;
+  var_j2 = 3034ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 12616ull;
+  var_i1 = 68u;
+  var_j2 = 1043ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 18276ull;
+  var_i1 = 69u;
+  var_j2 = 3324ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 4639ull;
+  var_i1 = 70u;
+  var_j2 = 1091ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 16158ull;
+  var_i1 = 71u;
+  var_j2 = 1997ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 18204ull;
+  var_i1 = 72u;
+  var_j2 = 2259ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 50532ull;
+  var_i1 = 73u;
+  var_j2 = 3189ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 11028ull;
+  var_i1 = 74u;
+  var_j2 = 1968ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 15962ull;
+  var_i1 = 75u;
+  var_j2 = 1455ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 45406ull;
+  var_i1 = 76u;
+  var_j2 = 1177ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 54137ull;
+  var_i1 = 77u;
+  var_j2 = 1568ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 33083ull;
+  var_i1 = 78u;
+  var_j2 = 1642ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 61028ull;
+  var_i1 = 79u;
+  var_j2 = 3284ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 51729ull;
+  var_i1 = 80u;
+  var_j2 = 223ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 4361ull;
+  var_i1 = 81u;
+  var_j2 = 2171ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 57514ull;
+  var_i1 = 82u;
+  var_j2 = 1322ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 55724ull;
+  var_i1 = 83u;
+  var_j2 = 2648ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 24091ull;
+  var_i1 = 84u;
+  var_j2 = 1045ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 43183ull;
+  var_i1 = 85u;
+  var_j2 = 3097ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 32307ull;
+  var_i1 = 86u;
+  var_j2 = 2796ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 3811ull;
+  var_i1 = 87u;
+  var_j2 = 2010ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 54856ull;
+  var_i1 = 88u;
+  var_j2 = 0ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 49941ull;
+  var_i1 = 89u;
+  var_j2 = 2069ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 20411ull;
+  var_i1 = 90u;
+  var_j2 = 2896ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 33826ull;
+  var_i1 = 91u;
+  var_j2 = 192ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 9402ull;
+  var_i1 = 92u;
+  var_j2 = 2195ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 12413ull;
+  var_i1 = 93u;
+  var_j2 = 24ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 14091ull;
+  var_i1 = 94u;
+  var_j2 = 577ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 44058ull;
+  var_i1 = 95u;
+  var_j2 = 2089ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 36735ull;
+  var_i1 = 96u;
+  var_j2 = 3436ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 23288ull;
+  var_i1 = 97u;
+  var_j2 = 2765ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 6392ull;
+  var_i1 = 98u;
+  var_j2 = 830ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 33307ull;
+  var_i1 = 99u;
+  var_j2 = 1938ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 21941ull;
+  var_i1 = 100u;
+  var_j2 = 2750ull;
+  memory_fill(&instance->w2c_M0, var_j0, var_i1, var_j2);
+  var_j0 = 59214ull;
+  var_j1 = 54248ull;
+  var_j2 = 2098ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 63026ull;
+  var_j1 = 39224ull;
+  var_j2 = 230ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 51833ull;
+  var_j1 = 23629ull;
+  var_j2 = 2300ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 6708ull;
+  var_j1 = 23996ull;
+  var_j2 = 639ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 6990ull;
+  var_j1 = 33399ull;
+  var_j2 = 1097ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 19403ull;
+  var_j1 = 10348ull;
+  var_j2 = 3197ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 27308ull;
+  var_j1 = 54406ull;
+  var_j2 = 100ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 27221ull;
+  var_j1 = 43682ull;
+  var_j2 = 1717ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 60528ull;
+  var_j1 = 8629ull;
+  var_j2 = 119ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 5947ull;
+  var_j1 = 2308ull;
+  var_j2 = 658ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 4787ull;
+  var_j1 = 51631ull;
+  var_j2 = 2269ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 12617ull;
+  var_j1 = 19197ull;
+  var_j2 = 833ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 11854ull;
+  var_j1 = 46505ull;
+  var_j2 = 3300ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 11376ull;
+  var_j1 = 45012ull;
+  var_j2 = 2281ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 34186ull;
+  var_j1 = 6697ull;
+  var_j2 = 2572ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 4936ull;
+  var_j1 = 1690ull;
+  var_j2 = 1328ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 63164ull;
+  var_j1 = 7637ull;
+  var_j2 = 1670ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 44568ull;
+  var_j1 = 18344ull;
+  var_j2 = 33ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 43918ull;
+  var_j1 = 22348ull;
+  var_j2 = 1427ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 46637ull;
+  var_j1 = 49819ull;
+  var_j2 = 1434ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 63684ull;
+  var_j1 = 8755ull;
+  var_j2 = 834ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 33485ull;
+  var_j1 = 20131ull;
+  var_j2 = 3317ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 40575ull;
+  var_j1 = 54317ull;
+  var_j2 = 3201ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 25812ull;
+  var_j1 = 59254ull;
+  var_j2 = 2452ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 19678ull;
+  var_j1 = 56882ull;
+  var_j2 = 346ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 15852ull;
+  var_j1 = 35914ull;
+  var_j2 = 2430ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 11824ull;
+  var_j1 = 35574ull;
+  var_j2 = 300ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 59427ull;
+  var_j1 = 13957ull;
+  var_j2 = 3153ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 34299ull;
+  var_j1 = 60594ull;
+  var_j2 = 1281ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 8964ull;
+  var_j1 = 12276ull;
+  var_j2 = 943ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 2827ull;
+  var_j1 = 10425ull;
+  var_j2 = 1887ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 43194ull;
+  var_j1 = 43910ull;
+  var_j2 = 738ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 63038ull;
+  var_j1 = 18949ull;
+  var_j2 = 122ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 24044ull;
+  var_j1 = 44761ull;
+  var_j2 = 1755ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 22608ull;
+  var_j1 = 14755ull;
+  var_j2 = 702ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 11284ull;
+  var_j1 = 26579ull;
+  var_j2 = 1830ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 23092ull;
+  var_j1 = 20471ull;
+  var_j2 = 1064ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 57248ull;
+  var_j1 = 54770ull;
+  var_j2 = 2631ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 25492ull;
+  var_j1 = 1025ull;
+  var_j2 = 3113ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 49588ull;
+  var_j1 = 44220ull;
+  var_j2 = 975ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 28280ull;
+  var_j1 = 41722ull;
+  var_j2 = 2336ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 61289ull;
+  var_j1 = 230ull;
+  var_j2 = 2872ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 22480ull;
+  var_j1 = 52506ull;
+  var_j2 = 2197ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 40553ull;
+  var_j1 = 9578ull;
+  var_j2 = 1958ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 29004ull;
+  var_j1 = 20862ull;
+  var_j2 = 2186ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 53029ull;
+  var_j1 = 43955ull;
+  var_j2 = 1037ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 25476ull;
+  var_j1 = 35667ull;
+  var_j2 = 1650ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 58516ull;
+  var_j1 = 45819ull;
+  var_j2 = 1986ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 38297ull;
+  var_j1 = 5776ull;
+  var_j2 = 1955ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 28503ull;
+  var_j1 = 55364ull;
+  var_j2 = 2368ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 62619ull;
+  var_j1 = 18108ull;
+  var_j2 = 1356ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 50149ull;
+  var_j1 = 13861ull;
+  var_j2 = 382ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 16904ull;
+  var_j1 = 36341ull;
+  var_j2 = 1900ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 48098ull;
+  var_j1 = 11358ull;
+  var_j2 = 2807ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 28512ull;
+  var_j1 = 40362ull;
+  var_j2 = 323ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 35506ull;
+  var_j1 = 27856ull;
+  var_j2 = 1670ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 62970ull;
+  var_j1 = 53332ull;
+  var_j2 = 1341ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 14133ull;
+  var_j1 = 46312ull;
+  var_j2 = 644ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 29030ull;
+  var_j1 = 19074ull;
+  var_j2 = 496ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 44952ull;
+  var_j1 = 47577ull;
+  var_j2 = 2784ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 39559ull;
+  var_j1 = 44661ull;
+  var_j2 = 1350ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 10352ull;
+  var_j1 = 29274ull;
+  var_j2 = 1475ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 46911ull;
+  var_j1 = 46178ull;
+  var_j2 = 1467ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 4905ull;
+  var_j1 = 28740ull;
+  var_j2 = 1895ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 38012ull;
+  var_j1 = 57253ull;
+  var_j2 = 1751ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 26446ull;
+  var_j1 = 27223ull;
+  var_j2 = 1127ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 58835ull;
+  var_j1 = 24657ull;
+  var_j2 = 1063ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 61356ull;
+  var_j1 = 38790ull;
+  var_j2 = 766ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 44160ull;
+  var_j1 = 2284ull;
+  var_j2 = 1520ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 32740ull;
+  var_j1 = 47237ull;
+  var_j2 = 3014ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 11148ull;
+  var_j1 = 21260ull;
+  var_j2 = 1011ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 7665ull;
+  var_j1 = 31612ull;
+  var_j2 = 3034ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 18044ull;
+  var_j1 = 12987ull;
+  var_j2 = 3320ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 57306ull;
+  var_j1 = 55905ull;
+  var_j2 = 308ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 24675ull;
+  var_j1 = 16815ull;
+  var_j2 = 1155ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 19900ull;
+  var_j1 = 10115ull;
+  var_j2 = 722ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 2921ull;
+  var_j1 = 5935ull;
+  var_j2 = 2370ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 32255ull;
+  var_j1 = 50095ull;
+  var_j2 = 2926ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 15126ull;
+  var_j1 = 17299ull;
+  var_j2 = 2607ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 45575ull;
+  var_j1 = 28447ull;
+  var_j2 = 2045ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 55149ull;
+  var_j1 = 36113ull;
+  var_j2 = 2596ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 28461ull;
+  var_j1 = 54157ull;
+  var_j2 = 1168ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 47951ull;
+  var_j1 = 53385ull;
+  var_j2 = 3137ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 30646ull;
+  var_j1 = 45155ull;
+  var_j2 = 2649ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 5057ull;
+  var_j1 = 4295ull;
+  var_j2 = 52ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 6692ull;
+  var_j1 = 24195ull;
+  var_j2 = 441ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 32984ull;
+  var_j1 = 27117ull;
+  var_j2 = 3445ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 32530ull;
+  var_j1 = 59372ull;
+  var_j2 = 2785ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 34361ull;
+  var_j1 = 8962ull;
+  var_j2 = 2406ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 17893ull;
+  var_j1 = 54538ull;
+  var_j2 = 3381ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 22685ull;
+  var_j1 = 44151ull;
+  var_j2 = 136ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 59089ull;
+  var_j1 = 7077ull;
+  var_j2 = 1045ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 42945ull;
+  var_j1 = 55028ull;
+  var_j2 = 2389ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 44693ull;
+  var_j1 = 20138ull;
+  var_j2 = 877ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 36810ull;
+  var_j1 = 25196ull;
+  var_j2 = 3447ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 45742ull;
+  var_j1 = 31888ull;
+  var_j2 = 854ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 24236ull;
+  var_j1 = 31866ull;
+  var_j2 = 1377ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 33778ull;
+  var_j1 = 692ull;
+  var_j2 = 1594ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 60618ull;
+  var_j1 = 18585ull;
+  var_j2 = 2987ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  var_j0 = 50370ull;
+  var_j1 = 41271ull;
+  var_j2 = 1406ull;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_j0, var_j1, var_j2);
+  FUNC_EPILOGUE;
+}
+
+u64 w2c_memory__copy__193__wasm_checkRange_0(w2c_memory__copy__193__wasm* instance, u64 var_p0, u64 var_p1, u32 var_p2) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  u64 var_j0, var_j1;
+  var_L0: 
+    var_j0 = var_p0;
+    var_j1 = var_p1;
+    var_i0 = var_j0 == var_j1;
+    if (var_i0) {
+      var_j0 = 18446744073709551615ull;
+      goto var_Bfunc;
+    }
+    var_j0 = var_p0;
+    var_i0 = i32_load8_u(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_j0));
+    var_i1 = var_p2;
+    var_i0 = var_i0 == var_i1;
+    if (var_i0) {
+      var_j0 = var_p0;
+      var_j1 = 1ull;
+      var_j0 += var_j1;
+      var_p0 = var_j0;
+      goto var_L0;
+    }
+  var_j0 = var_p0;
+  goto var_Bfunc;
+  var_Bfunc:;
+  FUNC_EPILOGUE;
+  return var_j0;
+}
@@ -0,0 +1,48 @@
+/* Automatically generated by wasm2c */
+#ifndef MEMORY_COPY_2_H_GENERATED_
+#define MEMORY_COPY_2_H_GENERATED_
+
+#include "wasm-rt.h"
+
+#include <stdint.h>
+
+#ifndef WASM_RT_CORE_TYPES_DEFINED
+#define WASM_RT_CORE_TYPES_DEFINED
+typedef uint8_t u8;
+typedef int8_t s8;
+typedef uint16_t u16;
+typedef int16_t s16;
+typedef uint32_t u32;
+typedef int32_t s32;
+typedef uint64_t u64;
+typedef int64_t s64;
+typedef float f32;
+typedef double f64;
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct w2c_memory__copy__2__wasm {
+  wasm_rt_memory_t w2c_memory0;
+} w2c_memory__copy__2__wasm;
+
+void wasm2c_memory__copy__2__wasm_instantiate(w2c_memory__copy__2__wasm*);
+void wasm2c_memory__copy__2__wasm_free(w2c_memory__copy__2__wasm*);
+wasm_rt_func_type_t wasm2c_memory__copy__2__wasm_get_func_type(uint32_t param_count, uint32_t result_count, ...);
+
+/* export: 'memory0' */
+wasm_rt_memory_t* w2c_memory__copy__2__wasm_memory0(w2c_memory__copy__2__wasm* instance);
+
+/* export: 'test' */
+void w2c_memory__copy__2__wasm_test(w2c_memory__copy__2__wasm*);
+
+/* export: 'load8_u' */
+u32 w2c_memory__copy__2__wasm_load8_u(w2c_memory__copy__2__wasm*, u32);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* MEMORY_COPY_2_H_GENERATED_ */
@@ -0,0 +1,1770 @@
+/* Automatically generated by wasm2c */
+#include <assert.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <string.h>
+#if defined(__MINGW32__)
+#include <malloc.h>
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#include <malloc.h>
+#define alloca _alloca
+#elif defined(__FreeBSD__) || defined(__OpenBSD__)
+#include <stdlib.h>
+#else
+#include <alloca.h>
+#endif
+
+#include "memory_copy.96.h"
+#define IS_SINGLE_UNSHARED_DEFAULT32_MEMORY 1
+
+// Computes a pointer to an object of the given size in a little-endian memory.
+//
+// On a little-endian host, this is just &mem->data[addr] - the object's size is
+// unused. On a big-endian host, it's &mem->data[mem->size - addr - n], where n
+// is the object's size.
+//
+// Note that mem may be evaluated multiple times.
+//
+// Parameters:
+// mem - The memory.
+// addr - The address.
+// n - The size of the object.
+//
+// Result:
+// A pointer for an object of size n.
+#if WABT_BIG_ENDIAN
+#define MEM_ADDR(mem, addr, n) ((mem)->data_end - (addr) - (n))
+#else
+#define MEM_ADDR(mem, addr, n) &((mem)->data[addr])
+#endif
+
+// We can only use Segue for this module if it uses a single unshared,
+// default-page, 32-bit imported or exported memory.
+#if WASM_RT_USE_SEGUE && IS_SINGLE_UNSHARED_DEFAULT32_MEMORY
+#define WASM_RT_USE_SEGUE_FOR_THIS_MODULE 1
+#else
+#define WASM_RT_USE_SEGUE_FOR_THIS_MODULE 0
+#endif
+
+#ifndef WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE
+#define WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE 1
+#endif
+
+#if WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE && WASM_RT_USE_MMAP && \
+    IS_SINGLE_UNSHARED_DEFAULT32_MEMORY && !WABT_BIG_ENDIAN
+#define WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE_FOR_THIS_MODULE 1
+#else
+#define WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE_FOR_THIS_MODULE 0
+#endif
+
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+// POSIX uses FS for TLS, GS is free
+static inline void* wasm_rt_segue_read_base() {
+  if (wasm_rt_fsgsbase_inst_supported) {
+    return (void*)__builtin_ia32_rdgsbase64();
+  } else {
+    return wasm_rt_syscall_get_segue_base();
+  }
+}
+static inline void wasm_rt_segue_write_base(void* base) {
+#if WASM_RT_SEGUE_FREE_SEGMENT
+  if (wasm_rt_last_segment_val == base) {
+    return;
+  }
+
+  wasm_rt_last_segment_val = base;
+#endif
+
+  if (wasm_rt_fsgsbase_inst_supported) {
+    __builtin_ia32_wrgsbase64((uintptr_t)base);
+  } else {
+    wasm_rt_syscall_set_segue_base(base);
+  }
+}
+#define MEM_ADDR_MEMOP(mem, addr, n) ((uint8_t __seg_gs*)(uintptr_t)addr)
+#elif WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE_FOR_THIS_MODULE
+#define MEM_ADDR_MEMOP(mem, addr, n) (&wasm_rt_local_memory_base[(addr)])
+#else
+#define MEM_ADDR_MEMOP(mem, addr, n) MEM_ADDR(mem, addr, n)
+#endif
+
+#define TRAP(x) (wasm_rt_trap(WASM_RT_TRAP_##x), 0)
+
+#if WASM_RT_STACK_DEPTH_COUNT
+#define FUNC_PROLOGUE                                            \
+  if (++wasm_rt_call_stack_depth > WASM_RT_MAX_CALL_STACK_DEPTH) \
+    TRAP(EXHAUSTION);
+
+#define FUNC_EPILOGUE --wasm_rt_call_stack_depth
+#else
+#define FUNC_PROLOGUE
+
+#define FUNC_EPILOGUE
+#endif
+
+#define UNREACHABLE TRAP(UNREACHABLE)
+
+#if defined(__clang__) || defined(__GNUC__)
+#define W2C_COLD_FUNC __attribute__((noinline, cold))
+#elif defined(_MSC_VER)
+#define W2C_COLD_FUNC __declspec(noinline)
+#else
+#define W2C_COLD_FUNC
+#endif
+
+W2C_COLD_FUNC static bool func_types_eq_slowpath(
+    const wasm_rt_funcref_table_t* table,
+    const wasm_rt_func_type_t expected_type,
+    uint32_t index) {
+  const size_t sha256size = 32;
+  if (index >= table->size) {
+    // Table index out of bounds. Raise Wasm trap.
+    TRAP(CALL_INDIRECT);
+    return false;
+  }
+  const wasm_rt_funcref_t* const func_ref = &table->data[index];
+  if (!expected_type || !func_ref->func || !func_ref->func_type ||
+      memcmp(expected_type, func_ref->func_type, sha256size) != 0) {
+    // Type check failed. Raise Wasm trap.
+    TRAP(CALL_INDIRECT);
+    return false;
+  }
+  return true;
+}
+
+#define CHECK_CALL_INDIRECT(table, ft, x)                       \
+  (LIKELY((x) < table.size && ft == table.data[x].func_type) || \
+   func_types_eq_slowpath(&(table), ft, x))
+
+#define DO_CALL_INDIRECT(table, t, x, ...) ((t)table.data[x].func)(__VA_ARGS__)
+
+#define CALL_INDIRECT(table, t, ft, x, ...) \
+  (CHECK_CALL_INDIRECT(table, ft, x),       \
+   DO_CALL_INDIRECT(table, t, x, __VA_ARGS__))
+
+static inline uint64_t checked_add_u64(uint64_t a, uint64_t b) {
+  uint64_t ret;
+#if __has_builtin(__builtin_add_overflow)
+  if (__builtin_add_overflow(a, b, &ret))
+    TRAP(OOB);
+#elif defined(_MSC_VER)
+  if (_addcarry_u64(0, a, b, &ret))
+    TRAP(OOB);
+#else
+  ret = a + b;
+  if (ret < a)
+    TRAP(OOB);
+#endif
+  return ret;
+}
+
+#define RANGE_CHECK(mem, offset, len)            \
+  do {                                           \
+    uint64_t res = checked_add_u64(offset, len); \
+    if (UNLIKELY(res > (mem)->size))             \
+      TRAP(OOB);                                 \
+  } while (0);
+
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && WASM_RT_SANITY_CHECKS
+#include <stdio.h>
+#define WASM_RT_CHECK_BASE(mem)                                               \
+  if (((uintptr_t)((mem)->data)) != ((uintptr_t)wasm_rt_segue_read_base())) { \
+    puts("Segment register mismatch\n");                                      \
+    abort();                                                                  \
+  }
+#else
+#define WASM_RT_CHECK_BASE(mem)
+#endif
+
+// MEMCHECK_DEFAULT32 is an "accelerated" MEMCHECK used only for
+// default-page-size, 32-bit memories. It may do nothing at all
+// (if hardware bounds-checking is enabled via guard pages)
+// or it may do a slightly faster RANGE_CHECK.
+#if WASM_RT_MEMCHECK_GUARD_PAGES
+#define MEMCHECK_DEFAULT32(mem, local_memory_size, a, t) \
+  WASM_RT_CHECK_BASE(mem);
+#else
+#if WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE_FOR_THIS_MODULE
+#define MEMCHECK_DEFAULT32(mem, local_memory_size, a, t)     \
+  WASM_RT_CHECK_BASE(mem);                                   \
+  if (UNLIKELY(a + (uint64_t)sizeof(t) > local_memory_size)) \
+    TRAP(OOB);
+#else
+#define MEMCHECK_DEFAULT32(mem, local_memory_size, a, t) \
+  WASM_RT_CHECK_BASE(mem);                               \
+  if (UNLIKELY(a + (uint64_t)sizeof(t) > mem->size))     \
+    TRAP(OOB);
+#endif
+#endif
+
+// MEMCHECK_GENERAL can be used for any memory
+#define MEMCHECK_GENERAL(mem, a, t) \
+  WASM_RT_CHECK_BASE(mem);          \
+  RANGE_CHECK(mem, a, sizeof(t));
+
+// When using guard pages, reads have to be immediately consumed so that OOB
+// trap checks are applied in the right place, and not optimized away. This is
+// done using FORCE_READ_INT/FORCE_READ_FLOAT
+#if WASM_RT_MEMCHECK_BOUNDS_CHECK || \
+    WASM_RT_NONCONFORMING_ALLOW_OOB_READ_ELIMINATION
+#define FORCE_READ_INT(var)
+#define FORCE_READ_FLOAT(var)
+#elif defined(__GNUC__) && WASM_RT_MEMCHECK_GUARD_PAGES
+#define FORCE_READ_INT(var) __asm__("" ::"r"(var))
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define FORCE_READ_FLOAT_CONSTRAINT "x"
+#elif defined(__aarch64__) && defined(__ARM_FP) && ((__ARM_FP & 0x4) != 0)
+#define FORCE_READ_FLOAT_CONSTRAINT "w"
+#elif defined(__mips__) && defined(__clang__) && !defined(__mips_soft_float)
+// Clang before v18 uses hard floats which has a different constraint
+#define FORCE_READ_FLOAT_CONSTRAINT "f"
+#elif (defined(__powerpc__) || defined(__ppc__) || defined(__PPC__)) && \
+    !(defined(_SOFT_FLOAT) || defined(__NO_FPRS__))
+#define FORCE_READ_FLOAT_CONSTRAINT "f"
+#elif defined(__riscv) && defined(__riscv_flen) && (__riscv_flen >= 32)
+#define FORCE_READ_FLOAT_CONSTRAINT "f"
+#elif defined(__s390__) || defined(__s390x__)
+#define FORCE_READ_FLOAT_CONSTRAINT "f"
+#else
+#define FORCE_READ_FLOAT_CONSTRAINT "r"
+#endif
+
+#define FORCE_READ_FLOAT(var) __asm__("" ::FORCE_READ_FLOAT_CONSTRAINT(var))
+#else
+#error \
+    "Guard page mode for Wasm not supported on this platform because FORCE_READ_INT/FORCE_READ_FLOAT could not be instantiated." \
+   "Either enable specify -DWASM_RT_NONCONFORMING_ALLOW_OOB_READ_ELIMINATION=1 during compilation or use -DWASM_RT_MEMCHECK_BOUNDS_CHECK=1 to use bounds check mode"
+#endif
+
+static inline void load_data(u8* dest, const u8* src, size_t n) {
+  if (!n) {
+    return;
+  }
+#if WABT_BIG_ENDIAN
+  for (size_t i = 0; i < n; i++) {
+    dest[i] = src[n - i - 1];
+  }
+#else
+  wasm_rt_memcpy(dest, src, n);
+#endif
+}
+
+#define LOAD_DATA(m, o, i, s)            \
+  do {                                   \
+    RANGE_CHECK((&m), o, s);             \
+    load_data(MEM_ADDR(&m, o, s), i, s); \
+  } while (0)
+
+#define DEF_MEM_CHECKS0(name, shared, mem_type, ret_kw, return_type)         \
+  static inline return_type name##_default32(                                \
+      uint8_t* const wasm_rt_local_memory_base,                              \
+      uint64_t wasm_rt_local_memory_size, wasm_rt##shared##memory_t* mem,    \
+      u64 addr) {                                                            \
+    MEMCHECK_DEFAULT32(mem, wasm_rt_local_memory_size, addr, mem_type);      \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr);           \
+  }                                                                          \
+  static inline return_type name(uint8_t* const wasm_rt_local_memory_base,   \
+                                 uint64_t wasm_rt_local_memory_size,         \
+                                 wasm_rt##shared##memory_t* mem, u64 addr) { \
+    MEMCHECK_GENERAL(mem, addr, mem_type);                                   \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr);           \
+  }
+
+#define DEF_MEM_CHECKS1(name, shared, mem_type, ret_kw, return_type,       \
+                        val_type1)                                         \
+  static inline return_type name##_default32(                              \
+      uint8_t* const wasm_rt_local_memory_base,                            \
+      uint64_t wasm_rt_local_memory_size, wasm_rt##shared##memory_t* mem,  \
+      u64 addr, val_type1 val1) {                                          \
+    MEMCHECK_DEFAULT32(mem, wasm_rt_local_memory_size, addr, mem_type);    \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr, val1);   \
+  }                                                                        \
+  static inline return_type name(uint8_t* const wasm_rt_local_memory_base, \
+                                 uint64_t wasm_rt_local_memory_size,       \
+                                 wasm_rt##shared##memory_t* mem, u64 addr, \
+                                 val_type1 val1) {                         \
+    MEMCHECK_GENERAL(mem, addr, mem_type);                                 \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr, val1);   \
+  }
+
+#define DEF_MEM_CHECKS2(name, shared, mem_type, ret_kw, return_type,           \
+                        val_type1, val_type2)                                  \
+  static inline return_type name##_default32(                                  \
+      uint8_t* const wasm_rt_local_memory_base,                                \
+      uint64_t wasm_rt_local_memory_size, wasm_rt##shared##memory_t* mem,      \
+      u64 addr, val_type1 val1, val_type2 val2) {                              \
+    MEMCHECK_DEFAULT32(mem, wasm_rt_local_memory_size, addr, mem_type);        \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr, val1, val2); \
+  }                                                                            \
+  static inline return_type name(uint8_t* const wasm_rt_local_memory_base,     \
+                                 uint64_t wasm_rt_local_memory_size,           \
+                                 wasm_rt##shared##memory_t* mem, u64 addr,     \
+                                 val_type1 val1, val_type2 val2) {             \
+    MEMCHECK_GENERAL(mem, addr, mem_type);                                     \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr, val1, val2); \
+  }
+
+#define DEFINE_LOAD(name, t1, t2, t3, force_read)                             \
+  static inline t3 name##_unchecked(uint8_t* const wasm_rt_local_memory_base, \
+                                    wasm_rt_memory_t* mem, u64 addr) {        \
+    t1 result;                                                                \
+    wasm_rt_memcpy(&result, MEM_ADDR_MEMOP(mem, addr, sizeof(t1)),            \
+                   sizeof(t1));                                               \
+    t3 ret = (t3)(t2)result;                                                  \
+    force_read(ret);                                                          \
+    return ret;                                                               \
+  }                                                                           \
+  DEF_MEM_CHECKS0(name, _, t1, return, t3)
+
+#define DEFINE_STORE(name, t1, t2)                                     \
+  static inline void name##_unchecked(                                 \
+      uint8_t* const wasm_rt_local_memory_base, wasm_rt_memory_t* mem, \
+      u64 addr, t2 value) {                                            \
+    t1 wrapped = (t1)value;                                            \
+    wasm_rt_memcpy(MEM_ADDR_MEMOP(mem, addr, sizeof(t1)), &wrapped,    \
+                   sizeof(t1));                                        \
+  }                                                                    \
+  DEF_MEM_CHECKS1(name, _, t1, , void, t2)
+
+DEFINE_LOAD(i32_load, u32, u32, u32, FORCE_READ_INT)
+DEFINE_LOAD(i64_load, u64, u64, u64, FORCE_READ_INT)
+DEFINE_LOAD(f32_load, f32, f32, f32, FORCE_READ_FLOAT)
+DEFINE_LOAD(f64_load, f64, f64, f64, FORCE_READ_FLOAT)
+DEFINE_LOAD(i32_load8_s, s8, s32, u32, FORCE_READ_INT)
+DEFINE_LOAD(i64_load8_s, s8, s64, u64, FORCE_READ_INT)
+DEFINE_LOAD(i32_load8_u, u8, u32, u32, FORCE_READ_INT)
+DEFINE_LOAD(i64_load8_u, u8, u64, u64, FORCE_READ_INT)
+DEFINE_LOAD(i32_load16_s, s16, s32, u32, FORCE_READ_INT)
+DEFINE_LOAD(i64_load16_s, s16, s64, u64, FORCE_READ_INT)
+DEFINE_LOAD(i32_load16_u, u16, u32, u32, FORCE_READ_INT)
+DEFINE_LOAD(i64_load16_u, u16, u64, u64, FORCE_READ_INT)
+DEFINE_LOAD(i64_load32_s, s32, s64, u64, FORCE_READ_INT)
+DEFINE_LOAD(i64_load32_u, u32, u64, u64, FORCE_READ_INT)
+DEFINE_STORE(i32_store, u32, u32)
+DEFINE_STORE(i64_store, u64, u64)
+DEFINE_STORE(f32_store, f32, f32)
+DEFINE_STORE(f64_store, f64, f64)
+DEFINE_STORE(i32_store8, u8, u32)
+DEFINE_STORE(i32_store16, u16, u32)
+DEFINE_STORE(i64_store8, u8, u64)
+DEFINE_STORE(i64_store16, u16, u64)
+DEFINE_STORE(i64_store32, u32, u64)
+
+#if defined(_MSC_VER)
+
+// Adapted from
+// https://github.com/nemequ/portable-snippets/blob/master/builtin/builtin.h
+
+static inline int I64_CLZ(unsigned long long v) {
+  unsigned long r = 0;
+#if defined(_M_AMD64) || defined(_M_ARM)
+  if (_BitScanReverse64(&r, v)) {
+    return 63 - r;
+  }
+#else
+  if (_BitScanReverse(&r, (unsigned long)(v >> 32))) {
+    return 31 - r;
+  } else if (_BitScanReverse(&r, (unsigned long)v)) {
+    return 63 - r;
+  }
+#endif
+  return 64;
+}
+
+static inline int I32_CLZ(unsigned long v) {
+  unsigned long r = 0;
+  if (_BitScanReverse(&r, v)) {
+    return 31 - r;
+  }
+  return 32;
+}
+
+static inline int I64_CTZ(unsigned long long v) {
+  if (!v) {
+    return 64;
+  }
+  unsigned long r = 0;
+#if defined(_M_AMD64) || defined(_M_ARM)
+  _BitScanForward64(&r, v);
+  return (int)r;
+#else
+  if (_BitScanForward(&r, (unsigned int)(v))) {
+    return (int)(r);
+  }
+
+  _BitScanForward(&r, (unsigned int)(v >> 32));
+  return (int)(r + 32);
+#endif
+}
+
+static inline int I32_CTZ(unsigned long v) {
+  if (!v) {
+    return 32;
+  }
+  unsigned long r = 0;
+  _BitScanForward(&r, v);
+  return (int)r;
+}
+
+#define POPCOUNT_DEFINE_PORTABLE(f_n, T)                            \
+  static inline u32 f_n(T x) {                                      \
+    x = x - ((x >> 1) & (T) ~(T)0 / 3);                             \
+    x = (x & (T) ~(T)0 / 15 * 3) + ((x >> 2) & (T) ~(T)0 / 15 * 3); \
+    x = (x + (x >> 4)) & (T) ~(T)0 / 255 * 15;                      \
+    return (T)(x * ((T) ~(T)0 / 255)) >> (sizeof(T) - 1) * 8;       \
+  }
+
+POPCOUNT_DEFINE_PORTABLE(I32_POPCNT, u32)
+POPCOUNT_DEFINE_PORTABLE(I64_POPCNT, u64)
+
+#undef POPCOUNT_DEFINE_PORTABLE
+
+#else
+
+#define I32_CLZ(x) ((x) ? __builtin_clz(x) : 32)
+#define I64_CLZ(x) ((x) ? __builtin_clzll(x) : 64)
+#define I32_CTZ(x) ((x) ? __builtin_ctz(x) : 32)
+#define I64_CTZ(x) ((x) ? __builtin_ctzll(x) : 64)
+#define I32_POPCNT(x) (__builtin_popcount(x))
+#define I64_POPCNT(x) (__builtin_popcountll(x))
+
+#endif
+
+#define DIV_S(ut, min, x, y)                                  \
+  ((UNLIKELY((y) == 0))                  ? TRAP(DIV_BY_ZERO)  \
+   : (UNLIKELY((x) == min && (y) == -1)) ? TRAP(INT_OVERFLOW) \
+                                         : (ut)((x) / (y)))
+
+#define REM_S(ut, min, x, y)                                 \
+  ((UNLIKELY((y) == 0))                  ? TRAP(DIV_BY_ZERO) \
+   : (UNLIKELY((x) == min && (y) == -1)) ? 0                 \
+                                         : (ut)((x) % (y)))
+
+#define I32_DIV_S(x, y) DIV_S(u32, INT32_MIN, (s32)x, (s32)y)
+#define I64_DIV_S(x, y) DIV_S(u64, INT64_MIN, (s64)x, (s64)y)
+#define I32_REM_S(x, y) REM_S(u32, INT32_MIN, (s32)x, (s32)y)
+#define I64_REM_S(x, y) REM_S(u64, INT64_MIN, (s64)x, (s64)y)
+
+#define DIVREM_U(op, x, y) \
+  ((UNLIKELY((y) == 0)) ? TRAP(DIV_BY_ZERO) : ((x)op(y)))
+
+#define DIV_U(x, y) DIVREM_U(/, x, y)
+#define REM_U(x, y) DIVREM_U(%, x, y)
+
+#define ROTL(x, y, mask) \
+  (((x) << ((y) & (mask))) | ((x) >> (((mask) - (y) + 1) & (mask))))
+#define ROTR(x, y, mask) \
+  (((x) >> ((y) & (mask))) | ((x) << (((mask) - (y) + 1) & (mask))))
+
+#define I32_ROTL(x, y) ROTL(x, y, 31)
+#define I64_ROTL(x, y) ROTL(x, y, 63)
+#define I32_ROTR(x, y) ROTR(x, y, 31)
+#define I64_ROTR(x, y) ROTR(x, y, 63)
+
+#define FMIN(x, y)                                           \
+  ((UNLIKELY((x) != (x)))             ? NAN                  \
+   : (UNLIKELY((y) != (y)))           ? NAN                  \
+   : (UNLIKELY((x) == 0 && (y) == 0)) ? (signbit(x) ? x : y) \
+   : (x < y)                          ? x                    \
+                                      : y)
+
+#define FMAX(x, y)                                           \
+  ((UNLIKELY((x) != (x)))             ? NAN                  \
+   : (UNLIKELY((y) != (y)))           ? NAN                  \
+   : (UNLIKELY((x) == 0 && (y) == 0)) ? (signbit(x) ? y : x) \
+   : (x > y)                          ? x                    \
+                                      : y)
+
+#define TRUNC_S(ut, st, ft, min, minop, max, x)                             \
+  ((UNLIKELY((x) != (x)))                        ? TRAP(INVALID_CONVERSION) \
+   : (UNLIKELY(!((x)minop(min) && (x) < (max)))) ? TRAP(INT_OVERFLOW)       \
+                                                 : (ut)(st)(x))
+
+#define I32_TRUNC_S_F32(x) \
+  TRUNC_S(u32, s32, f32, (f32)INT32_MIN, >=, 2147483648.f, x)
+#define I64_TRUNC_S_F32(x) \
+  TRUNC_S(u64, s64, f32, (f32)INT64_MIN, >=, (f32)INT64_MAX, x)
+#define I32_TRUNC_S_F64(x) \
+  TRUNC_S(u32, s32, f64, -2147483649., >, 2147483648., x)
+#define I64_TRUNC_S_F64(x) \
+  TRUNC_S(u64, s64, f64, (f64)INT64_MIN, >=, (f64)INT64_MAX, x)
+
+#define TRUNC_U(ut, ft, max, x)                                              \
+  ((UNLIKELY((x) != (x)))                         ? TRAP(INVALID_CONVERSION) \
+   : (UNLIKELY(!((x) > (ft) - 1 && (x) < (max)))) ? TRAP(INT_OVERFLOW)       \
+                                                  : (ut)(x))
+
+#define I32_TRUNC_U_F32(x) TRUNC_U(u32, f32, 4294967296.f, x)
+#define I64_TRUNC_U_F32(x) TRUNC_U(u64, f32, (f32)UINT64_MAX, x)
+#define I32_TRUNC_U_F64(x) TRUNC_U(u32, f64, 4294967296., x)
+#define I64_TRUNC_U_F64(x) TRUNC_U(u64, f64, (f64)UINT64_MAX, x)
+
+#define TRUNC_SAT_S(ut, st, ft, min, smin, minop, max, smax, x) \
+  ((UNLIKELY((x) != (x)))         ? 0                           \
+   : (UNLIKELY(!((x)minop(min)))) ? smin                        \
+   : (UNLIKELY(!((x) < (max))))   ? smax                        \
+                                  : (ut)(st)(x))
+
+#define I32_TRUNC_SAT_S_F32(x)                                            \
+  TRUNC_SAT_S(u32, s32, f32, (f32)INT32_MIN, INT32_MIN, >=, 2147483648.f, \
+              INT32_MAX, x)
+#define I64_TRUNC_SAT_S_F32(x)                                              \
+  TRUNC_SAT_S(u64, s64, f32, (f32)INT64_MIN, INT64_MIN, >=, (f32)INT64_MAX, \
+              INT64_MAX, x)
+#define I32_TRUNC_SAT_S_F64(x)                                        \
+  TRUNC_SAT_S(u32, s32, f64, -2147483649., INT32_MIN, >, 2147483648., \
+              INT32_MAX, x)
+#define I64_TRUNC_SAT_S_F64(x)                                              \
+  TRUNC_SAT_S(u64, s64, f64, (f64)INT64_MIN, INT64_MIN, >=, (f64)INT64_MAX, \
+              INT64_MAX, x)
+
+#define TRUNC_SAT_U(ut, ft, max, smax, x) \
+  ((UNLIKELY((x) != (x)))          ? 0    \
+   : (UNLIKELY(!((x) > (ft) - 1))) ? 0    \
+   : (UNLIKELY(!((x) < (max))))    ? smax \
+                                   : (ut)(x))
+
+#define I32_TRUNC_SAT_U_F32(x) \
+  TRUNC_SAT_U(u32, f32, 4294967296.f, UINT32_MAX, x)
+#define I64_TRUNC_SAT_U_F32(x) \
+  TRUNC_SAT_U(u64, f32, (f32)UINT64_MAX, UINT64_MAX, x)
+#define I32_TRUNC_SAT_U_F64(x) TRUNC_SAT_U(u32, f64, 4294967296., UINT32_MAX, x)
+#define I64_TRUNC_SAT_U_F64(x) \
+  TRUNC_SAT_U(u64, f64, (f64)UINT64_MAX, UINT64_MAX, x)
+
+#define DEFINE_REINTERPRET(name, t1, t2)         \
+  static inline t2 name(t1 x) {                  \
+    t2 result;                                   \
+    wasm_rt_memcpy(&result, &x, sizeof(result)); \
+    return result;                               \
+  }
+
+DEFINE_REINTERPRET(f32_reinterpret_i32, u32, f32)
+DEFINE_REINTERPRET(i32_reinterpret_f32, f32, u32)
+DEFINE_REINTERPRET(f64_reinterpret_i64, u64, f64)
+DEFINE_REINTERPRET(i64_reinterpret_f64, f64, u64)
+
+static float quiet_nanf(float x) {
+  uint32_t tmp;
+  wasm_rt_memcpy(&tmp, &x, 4);
+  tmp |= 0x7fc00000lu;
+  wasm_rt_memcpy(&x, &tmp, 4);
+  return x;
+}
+
+static double quiet_nan(double x) {
+  uint64_t tmp;
+  wasm_rt_memcpy(&tmp, &x, 8);
+  tmp |= 0x7ff8000000000000llu;
+  wasm_rt_memcpy(&x, &tmp, 8);
+  return x;
+}
+
+static double wasm_quiet(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+  return x;
+}
+
+static float wasm_quietf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+  return x;
+}
+
+static double wasm_floor(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+  return floor(x);
+}
+
+static float wasm_floorf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+  return floorf(x);
+}
+
+static double wasm_ceil(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+  return ceil(x);
+}
+
+static float wasm_ceilf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+  return ceilf(x);
+}
+
+static double wasm_trunc(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+  return trunc(x);
+}
+
+static float wasm_truncf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+  return truncf(x);
+}
+
+static float wasm_nearbyintf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+  return nearbyintf(x);
+}
+
+static double wasm_nearbyint(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+  return nearbyint(x);
+}
+
+static float wasm_fabsf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    uint32_t tmp;
+    wasm_rt_memcpy(&tmp, &x, 4);
+    tmp = tmp & ~(1UL << 31);
+    wasm_rt_memcpy(&x, &tmp, 4);
+    return x;
+  }
+  return fabsf(x);
+}
+
+static double wasm_fabs(double x) {
+  if (UNLIKELY(isnan(x))) {
+    uint64_t tmp;
+    wasm_rt_memcpy(&tmp, &x, 8);
+    tmp = tmp & ~(1ULL << 63);
+    wasm_rt_memcpy(&x, &tmp, 8);
+    return x;
+  }
+  return fabs(x);
+}
+
+static double wasm_sqrt(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+
+#if __has_builtin(__builtin_elementwise_sqrt)
+  // Fastest option: doesn't set errno
+  return __builtin_elementwise_sqrt(x);
+#elif __has_builtin(__builtin_sqrt)
+  // Optimized if -fno-math-errno is set
+  return __builtin_sqrt(x);
+#else
+  // Libc call. May/may not be optimized
+  return sqrt(x);
+#endif
+}
+
+static float wasm_sqrtf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+
+#if __has_builtin(__builtin_elementwise_sqrt)
+  // Fastest option: doesn't set errno
+  return __builtin_elementwise_sqrt(x);
+#elif __has_builtin(__builtin_sqrt)
+  // Optimized if -fno-math-errno is set
+  return __builtin_sqrtf(x);
+#else
+  // Libc call. May/may not be optimized
+  return sqrtf(x);
+#endif
+}
+
+static inline void memory_fill(wasm_rt_memory_t* mem, u64 d, u32 val, u64 n) {
+  RANGE_CHECK(mem, d, n);
+  memset(MEM_ADDR(mem, d, n), val, n);
+}
+
+static inline void memory_copy(wasm_rt_memory_t* dest,
+                               const wasm_rt_memory_t* src,
+                               u64 dest_addr,
+                               u64 src_addr,
+                               u64 n) {
+  RANGE_CHECK(dest, dest_addr, n);
+  RANGE_CHECK(src, src_addr, n);
+  memmove(MEM_ADDR(dest, dest_addr, n), MEM_ADDR(src, src_addr, n), n);
+}
+
+static inline void memory_init(wasm_rt_memory_t* dest,
+                               const u8* src,
+                               u32 src_size,
+                               u64 dest_addr,
+                               u32 src_addr,
+                               u32 n) {
+  if (UNLIKELY(src_addr + (uint64_t)n > src_size))
+    TRAP(OOB);
+  LOAD_DATA((*dest), dest_addr, src + src_addr, n);
+}
+
+typedef enum { RefFunc, RefNull, GlobalGet } wasm_elem_segment_expr_type_t;
+
+typedef struct {
+  wasm_elem_segment_expr_type_t expr_type;
+  wasm_rt_func_type_t type;
+  wasm_rt_function_ptr_t func;
+  wasm_rt_tailcallee_t func_tailcallee;
+  size_t module_offset;
+} wasm_elem_segment_expr_t;
+
+static inline void funcref_table_init(wasm_rt_funcref_table_t* dest,
+                                      const wasm_elem_segment_expr_t* src,
+                                      u32 src_size,
+                                      u64 dest_addr,
+                                      u32 src_addr,
+                                      u32 n,
+                                      void* module_instance) {
+  if (UNLIKELY(src_addr + (uint64_t)n > src_size))
+    TRAP(OOB);
+  RANGE_CHECK(dest, dest_addr, n);
+  for (u32 i = 0; i < n; i++) {
+    const wasm_elem_segment_expr_t* const src_expr = &src[src_addr + i];
+    wasm_rt_funcref_t* const dest_val = &(dest->data[dest_addr + i]);
+    switch (src_expr->expr_type) {
+      case RefFunc:
+        *dest_val = (wasm_rt_funcref_t){
+            src_expr->type, src_expr->func, src_expr->func_tailcallee,
+            (char*)module_instance + src_expr->module_offset};
+        break;
+      case RefNull:
+        *dest_val = wasm_rt_funcref_null_value;
+        break;
+      case GlobalGet:
+        *dest_val = **(wasm_rt_funcref_t**)((char*)module_instance +
+                                            src_expr->module_offset);
+        break;
+    }
+  }
+}
+
+// Currently wasm2c only supports initializing externref tables with ref.null.
+static inline void externref_table_init(wasm_rt_externref_table_t* dest,
+                                        u32 src_size,
+                                        u64 dest_addr,
+                                        u32 src_addr,
+                                        u32 n) {
+  if (UNLIKELY(src_addr + (uint64_t)n > src_size))
+    TRAP(OOB);
+  RANGE_CHECK(dest, dest_addr, n);
+  for (u32 i = 0; i < n; i++) {
+    dest->data[dest_addr + i] = wasm_rt_externref_null_value;
+  }
+}
+
+#define DEFINE_TABLE_COPY(type)                                              \
+  static inline void type##_table_copy(wasm_rt_##type##_table_t* dest,       \
+                                       const wasm_rt_##type##_table_t* src,  \
+                                       u64 dest_addr, u64 src_addr, u64 n) { \
+    RANGE_CHECK(dest, dest_addr, n);                                         \
+    RANGE_CHECK(src, src_addr, n);                                           \
+    memmove(dest->data + dest_addr, src->data + src_addr,                    \
+            n * sizeof(wasm_rt_##type##_t));                                 \
+  }
+
+DEFINE_TABLE_COPY(funcref)
+DEFINE_TABLE_COPY(externref)
+
+#define DEFINE_TABLE_GET(type)                        \
+  static inline wasm_rt_##type##_t type##_table_get(  \
+      const wasm_rt_##type##_table_t* table, u64 i) { \
+    if (UNLIKELY(i >= table->size))                   \
+      TRAP(OOB);                                      \
+    return table->data[i];                            \
+  }
+
+DEFINE_TABLE_GET(funcref)
+DEFINE_TABLE_GET(externref)
+
+#define DEFINE_TABLE_SET(type)                                               \
+  static inline void type##_table_set(const wasm_rt_##type##_table_t* table, \
+                                      u64 i, const wasm_rt_##type##_t val) { \
+    if (UNLIKELY(i >= table->size))                                          \
+      TRAP(OOB);                                                             \
+    table->data[i] = val;                                                    \
+  }
+
+DEFINE_TABLE_SET(funcref)
+DEFINE_TABLE_SET(externref)
+
+#define DEFINE_TABLE_FILL(type)                                               \
+  static inline void type##_table_fill(const wasm_rt_##type##_table_t* table, \
+                                       u64 d, const wasm_rt_##type##_t val,   \
+                                       u64 n) {                               \
+    RANGE_CHECK(table, d, n);                                                 \
+    for (uint32_t i = d; i < d + n; i++) {                                    \
+      table->data[i] = val;                                                   \
+    }                                                                         \
+  }
+
+DEFINE_TABLE_FILL(funcref)
+DEFINE_TABLE_FILL(externref)
+
+#if defined(__GNUC__) || defined(__clang__)
+#define FUNC_TYPE_DECL_EXTERN_T(x) extern const char* const x
+#define FUNC_TYPE_EXTERN_T(x) const char* const x
+#define FUNC_TYPE_T(x) static const char* const x
+#else
+#define FUNC_TYPE_DECL_EXTERN_T(x) extern const char x[]
+#define FUNC_TYPE_EXTERN_T(x) const char x[]
+#define FUNC_TYPE_T(x) static const char x[]
+#endif
+
+#if (__STDC_VERSION__ < 201112L) && !defined(static_assert)
+#define static_assert(X) \
+  extern int(*assertion(void))[!!sizeof(struct { int x : (X) ? 2 : -1; })];
+#endif
+
+#ifdef _MSC_VER
+#define WEAK_FUNC_DECL(func, fallback)                             \
+  __pragma(comment(linker, "/alternatename:" #func "=" #fallback)) \
+                                                                   \
+      void                                                         \
+      fallback(void** instance_ptr, void* tail_call_stack,         \
+               wasm_rt_tailcallee_t* next)
+#else
+#define WEAK_FUNC_DECL(func, fallback)                                        \
+  __attribute__((weak)) void func(void** instance_ptr, void* tail_call_stack, \
+                                  wasm_rt_tailcallee_t* next)
+#endif
+
+static void w2c_memory__copy__96__wasm_test_0(w2c_memory__copy__96__wasm*);
+static u32 w2c_memory__copy__96__wasm_checkRange_0(w2c_memory__copy__96__wasm*, u32, u32, u32);
+
+FUNC_TYPE_T(w2c_memory__copy__96__wasm_t0) = "\x36\xa9\xe7\xf1\xc9\x5b\x82\xff\xb9\x97\x43\xe0\xc5\xc4\xce\x95\xd8\x3c\x9a\x43\x0a\xac\x59\xf8\x4e\xf3\xcb\xfa\xb6\x14\x50\x68";
+FUNC_TYPE_T(w2c_memory__copy__96__wasm_t1) = "\xcd\xad\x8f\x6a\xaf\x3e\xd0\x86\xf0\x9a\xd7\xf0\xc7\x0d\x48\x9f\x27\x59\xf3\x8d\x71\xa1\x81\xa8\xcc\x06\x53\x98\x62\x34\xaa\xf5";
+
+static void init_memories(w2c_memory__copy__96__wasm* instance) {
+  wasm_rt_allocate_memory(&instance->w2c_M0, 1, 1, 0, 65536);
+}
+
+/* export: 'test' */
+void w2c_memory__copy__96__wasm_test(w2c_memory__copy__96__wasm* instance) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  w2c_memory__copy__96__wasm_test_0(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+}
+
+/* export: 'checkRange' */
+u32 w2c_memory__copy__96__wasm_checkRange(w2c_memory__copy__96__wasm* instance, u32 var_p0, u32 var_p1, u32 var_p2) {
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+  u32 ret = w2c_memory__copy__96__wasm_checkRange_0(instance, var_p0, var_p1, var_p2);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+  return ret;
+}
+
+void wasm2c_memory__copy__96__wasm_instantiate(w2c_memory__copy__96__wasm* instance) {
+  assert(wasm_rt_is_initialized());
+  init_memories(instance);
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+#if !WASM_RT_SEGUE_FREE_SEGMENT
+  void* segue_saved_base = wasm_rt_segue_read_base();
+#endif
+  wasm_rt_segue_write_base(instance->w2c_M0.data);
+#endif
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && !WASM_RT_SEGUE_FREE_SEGMENT
+  wasm_rt_segue_write_base(segue_saved_base);
+#endif
+}
+
+void wasm2c_memory__copy__96__wasm_free(w2c_memory__copy__96__wasm* instance) {
+  wasm_rt_free_memory(&instance->w2c_M0);
+}
+
+wasm_rt_func_type_t wasm2c_memory__copy__96__wasm_get_func_type(uint32_t param_count, uint32_t result_count, ...) {
+  va_list args;
+  
+  if (param_count == 0 && result_count == 0) {
+    va_start(args, result_count);
+    if (true) {
+      va_end(args);
+      return w2c_memory__copy__96__wasm_t0;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 3 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_I32) {
+      va_end(args);
+      return w2c_memory__copy__96__wasm_t1;
+    }
+    va_end(args);
+  }
+  
+  return NULL;
+}
+
+void w2c_memory__copy__96__wasm_test_0(w2c_memory__copy__96__wasm* instance) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1, var_i2;
+  var_i0 = 17767u;
+  var_i1 = 1u;
+  var_i2 = 1344u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 39017u;
+  var_i1 = 2u;
+  var_i2 = 1055u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 56401u;
+  var_i1 = 3u;
+  var_i2 = 988u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 37962u;
+  var_i1 = 4u;
+  var_i2 = 322u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 7977u;
+  var_i1 = 5u;
+  var_i2 = 1994u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 22714u;
+  var_i1 = 6u;
+  var_i2 = 3036u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 16882u;
+  var_i1 = 7u;
+  var_i2 = 2372u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 43491u;
+  var_i1 = 8u;
+  var_i2 = 835u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 124u;
+  var_i1 = 9u;
+  var_i2 = 1393u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 2132u;
+  var_i1 = 10u;
+  var_i2 = 2758u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 8987u;
+  var_i1 = 11u;
+  var_i2 = 3098u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 52711u;
+  var_i1 = 12u;
+  var_i2 = 741u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 3958u;
+  var_i1 = 13u;
+  var_i2 = 2823u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 49715u;
+  var_i1 = 14u;
+  var_i2 = 1280u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 50377u;
+  var_i1 = 15u;
+  var_i2 = 1466u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 20493u;
+  var_i1 = 16u;
+  var_i2 = 3158u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 47665u;
+  var_i1 = 17u;
+  var_i2 = 544u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 12451u;
+  var_i1 = 18u;
+  var_i2 = 2669u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 24869u;
+  var_i1 = 19u;
+  var_i2 = 2651u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 45317u;
+  var_i1 = 20u;
+  var_i2 = 1570u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 43096u;
+  var_i1 = 21u;
+  var_i2 = 1691u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 33886u;
+  var_i1 = 22u;
+  var_i2 = 646u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 48555u;
+  var_i1 = 23u;
+  var_i2 = 1858u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 53453u;
+  var_i1 = 24u;
+  var_i2 = 2657u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 30363u;
+  var_i1 = 25u;
+  var_i2 = 981u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 9300u;
+  var_i1 = 26u;
+  var_i2 = 1807u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 50190u;
+  var_i1 = 27u;
+  var_i2 = 487u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 62753u;
+  var_i1 = 28u;
+  var_i2 = 530u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 36316u;
+  var_i1 = 29u;
+  var_i2 = 943u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 6768u;
+  var_i1 = 30u;
+  var_i2 = 381u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 51262u;
+  var_i1 = 31u;
+  var_i2 = 3089u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 49729u;
+  var_i1 = 32u;
+  var_i2 = 658u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 44540u;
+  var_i1 = 33u;
+  var_i2 = 1702u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 33342u;
+  var_i1 = 34u;
+  var_i2 = 1092u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 50814u;
+  var_i1 = 35u;
+  var_i2 = 1410u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 47594u;
+  var_i1 = 36u;
+  var_i2 = 2204u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 54123u;
+  var_i1 = 37u;
+  var_i2 = 2394u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 55183u;
+  var_i1 = 38u;
+  var_i2 = 250u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 22620u;
+  var_i1 = 39u;
+  var_i2 = 2097u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 17132u;
+  var_i1 = 40u;
+  var_i2 = 3264u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 54331u;
+  var_i1 = 41u;
+  var_i2 = 3299u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 39474u;
+  var_i1 = 42u;
+  var_i2 = 2796u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 36156u;
+  var_i1 = 43u;
+  var_i2 = 2070u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 35308u;
+  var_i1 = 44u;
+  var_i2 = 2763u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 32731u;
+  var_i1 = 45u;
+  var_i2 = 312u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 63746u;
+  var_i1 = 46u;
+  var_i2 = 192u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 30974u;
+  var_i1 = 47u;
+  var_i2 = 596u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 16635u;
+  var_i1 = 48u;
+  var_i2 = 501u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 57002u;
+  var_i1 = 49u;
+  var_i2 = 686u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 34299u;
+  var_i1 = 50u;
+  var_i2 = 385u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 60881u;
+  var_i1 = 51u;
+  var_i2 = 903u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 61445u;
+  var_i1 = 52u;
+  var_i2 = 2390u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 46972u;
+  var_i1 = 53u;
+  var_i2 = 1441u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 25973u;
+  var_i1 = 54u;
+  var_i2 = 3162u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 5566u;
+  var_i1 = 55u;
+  var_i2 = 2135u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 35977u;
+  var_i1 = 56u;
+  var_i2 = 519u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 44892u;
+  var_i1 = 57u;
+  var_i2 = 3280u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 46760u;
+  var_i1 = 58u;
+  var_i2 = 1678u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 46607u;
+  var_i1 = 59u;
+  var_i2 = 3168u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 22449u;
+  var_i1 = 60u;
+  var_i2 = 1441u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 58609u;
+  var_i1 = 61u;
+  var_i2 = 663u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 32261u;
+  var_i1 = 62u;
+  var_i2 = 1671u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 3063u;
+  var_i1 = 63u;
+  var_i2 = 721u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 34025u;
+  var_i1 = 64u;
+  var_i2 = 84u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 33338u;
+  var_i1 = 65u;
+  var_i2 = 2029u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 36810u;
+  var_i1 = 66u;
+  var_i2 = 29u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 19147u;
+  var_i1 = 67u;
+  var_i2 = 3034u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 12616u;
+  var_i1 = 68u;
+  var_i2 = 1043u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 18276u;
+  var_i1 = 69u;
+  var_i2 = 3324u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 4639u;
+  var_i1 = 70u;
+  var_i2 = 1091u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 16158u;
+  var_i1 = 71u;
+  var_i2 = 1997u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 18204u;
+  var_i1 = 72u;
+  var_i2 = 2259u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 50532u;
+  var_i1 = 73u;
+  var_i2 = 3189u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 11028u;
+  var_i1 = 74u;
+  var_i2 = 1968u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 15962u;
+  var_i1 = 75u;
+  var_i2 = 1455u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 45406u;
+  var_i1 = 76u;
+  var_i2 = 1177u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 54137u;
+  var_i1 = 77u;
+  var_i2 = 1568u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 33083u;
+  var_i1 = 78u;
+  var_i2 = 1642u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 61028u;
+  var_i1 = 79u;
+  var_i2 = 3284u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 51729u;
+  var_i1 = 80u;
+  var_i2 = 223u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 4361u;
+  var_i1 = 81u;
+  var_i2 = 2171u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 57514u;
+  var_i1 = 82u;
+  var_i2 = 1322u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 55724u;
+  var_i1 = 83u;
+  var_i2 = 2648u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 24091u;
+  var_i1 = 84u;
+  var_i2 = 1045u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 43183u;
+  var_i1 = 85u;
+  var_i2 = 3097u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 32307u;
+  var_i1 = 86u;
+  var_i2 = 2796u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 3811u;
+  var_i1 = 87u;
+  var_i2 = 2010u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 54856u;
+  var_i1 = 88u;
+  var_i2 = 0u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 49941u;
+  var_i1 = 89u;
+  var_i2 = 2069u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 20411u;
+  var_i1 = 90u;
+  var_i2 = 2896u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 33826u;
+  var_i1 = 91u;
+  var_i2 = 192u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 9402u;
+  var_i1 = 92u;
+  var_i2 = 2195u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 12413u;
+  var_i1 = 93u;
+  var_i2 = 24u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 14091u;
+  var_i1 = 94u;
+  var_i2 = 577u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 44058u;
+  var_i1 = 95u;
+  var_i2 = 2089u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 36735u;
+  var_i1 = 96u;
+  var_i2 = 3436u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 23288u;
+  var_i1 = 97u;
+  var_i2 = 2765u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 6392u;
+  var_i1 = 98u;
+  var_i2 = 830u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 33307u;
+  var_i1 = 99u;
+  var_i2 = 1938u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 21941u;
+  var_i1 = 100u;
+  var_i2 = 2750u;
+  memory_fill(&instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 59214u;
+  var_i1 = 54248u;
+  var_i2 = 2098u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 63026u;
+  var_i1 = 39224u;
+  var_i2 = 230u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 51833u;
+  var_i1 = 23629u;
+  var_i2 = 2300u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 6708u;
+  var_i1 = 23996u;
+  var_i2 = 639u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 6990u;
+  var_i1 = 33399u;
+  var_i2 = 1097u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 19403u;
+  var_i1 = 10348u;
+  var_i2 = 3197u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 27308u;
+  var_i1 = 54406u;
+  var_i2 = 100u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 27221u;
+  var_i1 = 43682u;
+  var_i2 = 1717u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 60528u;
+  var_i1 = 8629u;
+  var_i2 = 119u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 5947u;
+  var_i1 = 2308u;
+  var_i2 = 658u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 4787u;
+  var_i1 = 51631u;
+  var_i2 = 2269u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 12617u;
+  var_i1 = 19197u;
+  var_i2 = 833u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 11854u;
+  var_i1 = 46505u;
+  var_i2 = 3300u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 11376u;
+  var_i1 = 45012u;
+  var_i2 = 2281u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 34186u;
+  var_i1 = 6697u;
+  var_i2 = 2572u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 4936u;
+  var_i1 = 1690u;
+  var_i2 = 1328u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 63164u;
+  var_i1 = 7637u;
+  var_i2 = 1670u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 44568u;
+  var_i1 = 18344u;
+  var_i2 = 33u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 43918u;
+  var_i1 = 22348u;
+  var_i2 = 1427u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 46637u;
+  var_i1 = 49819u;
+  var_i2 = 1434u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 63684u;
+  var_i1 = 8755u;
+  var_i2 = 834u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 33485u;
+  var_i1 = 20131u;
+  var_i2 = 3317u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 40575u;
+  var_i1 = 54317u;
+  var_i2 = 3201u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 25812u;
+  var_i1 = 59254u;
+  var_i2 = 2452u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 19678u;
+  var_i1 = 56882u;
+  var_i2 = 346u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 15852u;
+  var_i1 = 35914u;
+  var_i2 = 2430u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 11824u;
+  var_i1 = 35574u;
+  var_i2 = 300u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 59427u;
+  var_i1 = 13957u;
+  var_i2 = 3153u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 34299u;
+  var_i1 = 60594u;
+  var_i2 = 1281u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 8964u;
+  var_i1 = 12276u;
+  var_i2 = 943u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 2827u;
+  var_i1 = 10425u;
+  var_i2 = 1887u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 43194u;
+  var_i1 = 43910u;
+  var_i2 = 738u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 63038u;
+  var_i1 = 18949u;
+  var_i2 = 122u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 24044u;
+  var_i1 = 44761u;
+  var_i2 = 1755u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 22608u;
+  var_i1 = 14755u;
+  var_i2 = 702u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 11284u;
+  var_i1 = 26579u;
+  var_i2 = 1830u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 23092u;
+  var_i1 = 20471u;
+  var_i2 = 1064u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 57248u;
+  var_i1 = 54770u;
+  var_i2 = 2631u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 25492u;
+  var_i1 = 1025u;
+  var_i2 = 3113u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 49588u;
+  var_i1 = 44220u;
+  var_i2 = 975u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 28280u;
+  var_i1 = 41722u;
+  var_i2 = 2336u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 61289u;
+  var_i1 = 230u;
+  var_i2 = 2872u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 22480u;
+  var_i1 = 52506u;
+  var_i2 = 2197u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 40553u;
+  var_i1 = 9578u;
+  var_i2 = 1958u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 29004u;
+  var_i1 = 20862u;
+  var_i2 = 2186u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 53029u;
+  var_i1 = 43955u;
+  var_i2 = 1037u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 25476u;
+  var_i1 = 35667u;
+  var_i2 = 1650u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 58516u;
+  var_i1 = 45819u;
+  var_i2 = 1986u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 38297u;
+  var_i1 = 5776u;
+  var_i2 = 1955u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 28503u;
+  var_i1 = 55364u;
+  var_i2 = 2368u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 62619u;
+  var_i1 = 18108u;
+  var_i2 = 1356u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 50149u;
+  var_i1 = 13861u;
+  var_i2 = 382u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 16904u;
+  var_i1 = 36341u;
+  var_i2 = 1900u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 48098u;
+  var_i1 = 11358u;
+  var_i2 = 2807u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 28512u;
+  var_i1 = 40362u;
+  var_i2 = 323u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 35506u;
+  var_i1 = 27856u;
+  var_i2 = 1670u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 62970u;
+  var_i1 = 53332u;
+  var_i2 = 1341u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 14133u;
+  var_i1 = 46312u;
+  var_i2 = 644u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 29030u;
+  var_i1 = 19074u;
+  var_i2 = 496u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 44952u;
+  var_i1 = 47577u;
+  var_i2 = 2784u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 39559u;
+  var_i1 = 44661u;
+  var_i2 = 1350u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 10352u;
+  var_i1 = 29274u;
+  var_i2 = 1475u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 46911u;
+  var_i1 = 46178u;
+  var_i2 = 1467u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 4905u;
+  var_i1 = 28740u;
+  var_i2 = 1895u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 38012u;
+  var_i1 = 57253u;
+  var_i2 = 1751u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 26446u;
+  var_i1 = 27223u;
+  var_i2 = 1127u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 58835u;
+  var_i1 = 24657u;
+  var_i2 = 1063u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 61356u;
+  var_i1 = 38790u;
+  var_i2 = 766u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 44160u;
+  var_i1 = 2284u;
+  var_i2 = 1520u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 32740u;
+  var_i1 = 47237u;
+  var_i2 = 3014u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 11148u;
+  var_i1 = 21260u;
+  var_i2 = 1011u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 7665u;
+  var_i1 = 31612u;
+  var_i2 = 3034u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 18044u;
+  var_i1 = 12987u;
+  var_i2 = 3320u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 57306u;
+  var_i1 = 55905u;
+  var_i2 = 308u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 24675u;
+  var_i1 = 16815u;
+  var_i2 = 1155u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 19900u;
+  var_i1 = 10115u;
+  var_i2 = 722u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 2921u;
+  var_i1 = 5935u;
+  var_i2 = 2370u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 32255u;
+  var_i1 = 50095u;
+  var_i2 = 2926u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 15126u;
+  var_i1 = 17299u;
+  var_i2 = 2607u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 45575u;
+  var_i1 = 28447u;
+  var_i2 = 2045u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 55149u;
+  var_i1 = 36113u;
+  var_i2 = 2596u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 28461u;
+  var_i1 = 54157u;
+  var_i2 = 1168u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 47951u;
+  var_i1 = 53385u;
+  var_i2 = 3137u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 30646u;
+  var_i1 = 45155u;
+  var_i2 = 2649u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 5057u;
+  var_i1 = 4295u;
+  var_i2 = 52u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 6692u;
+  var_i1 = 24195u;
+  var_i2 = 441u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 32984u;
+  var_i1 = 27117u;
+  var_i2 = 3445u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 32530u;
+  var_i1 = 59372u;
+  var_i2 = 2785u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 34361u;
+  var_i1 = 8962u;
+  var_i2 = 2406u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 17893u;
+  var_i1 = 54538u;
+  var_i2 = 3381u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 22685u;
+  var_i1 = 44151u;
+  var_i2 = 136u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 59089u;
+  var_i1 = 7077u;
+  var_i2 = 1045u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 42945u;
+  var_i1 = 55028u;
+  var_i2 = 2389u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 44693u;
+  var_i1 = 20138u;
+  var_i2 = 877u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 36810u;
+  var_i1 = 25196u;
+  var_i2 = 3447u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 45742u;
+  var_i1 = 31888u;
+  var_i2 = 854u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 24236u;
+  var_i1 = 31866u;
+  var_i2 = 1377u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 33778u;
+  var_i1 = 692u;
+  var_i2 = 1594u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 60618u;
+  var_i1 = 18585u;
+  var_i2 = 2987u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  var_i0 = 50370u;
+  var_i1 = 41271u;
+  var_i2 = 1406u;
+  memory_copy(&instance->w2c_M0, &instance->w2c_M0, var_i0, var_i1, var_i2);
+  FUNC_EPILOGUE;
+}
+
+u32 w2c_memory__copy__96__wasm_checkRange_0(w2c_memory__copy__96__wasm* instance, u32 var_p0, u32 var_p1, u32 var_p2) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = (&instance->w2c_M0)->data;
+  uint64_t wasm_rt_local_memory_size = (&instance->w2c_M0)->size;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_L0: 
+    var_i0 = var_p0;
+    var_i1 = var_p1;
+    var_i0 = var_i0 == var_i1;
+    if (var_i0) {
+      var_i0 = 4294967295u;
+      goto var_Bfunc;
+    }
+    var_i0 = var_p0;
+    var_i0 = i32_load8_u_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0));
+    var_i1 = var_p2;
+    var_i0 = var_i0 == var_i1;
+    if (var_i0) {
+      var_i0 = var_p0;
+      var_i1 = 1u;
+      var_i0 += var_i1;
+      var_p0 = var_i0;
+      goto var_L0;
+    }
+  var_i0 = var_p0;
+  goto var_Bfunc;
+  var_Bfunc:;
+  FUNC_EPILOGUE;
+  return var_i0;
+}
@@ -0,0 +1,1696 @@
+#include "memory_init.0.h"
+#include "memory_init.1.h"
+#include "memory_init.2.h"
+#include "memory_init.3.h"
+#include "memory_init.6.h"
+#include "memory_init.7.h"
+#include "memory_init.8.h"
+#include "memory_init.11.h"
+#include "memory_init.12.h"
+#include "memory_init.13.h"
+#include "memory_init.14.h"
+#include "memory_init.15.h"
+#include "memory_init.16.h"
+#include "memory_init.17.h"
+#include "memory_init.18.h"
+#include "memory_init.19.h"
+#include "memory_init.20.h"
+#include "memory_init.84.h"
+#include "memory_init.85.h"
+#include "memory_init.86.h"
+#include "memory_init.87.h"
+#include "memory_init.88.h"
+#include "memory_init.89.h"
+#include "memory_init.90.h"
+#include "memory_init.91.h"
+#include "memory_init.92.h"
+#include "memory_init.93.h"
+#include "memory_init.94.h"
+#include "memory_init.97.h"
+#include "memory_init.98.h"
+#include "memory_init.99.h"
+#include "memory_init.102.h"
+#include "memory_init.103.h"
+#include "memory_init.104.h"
+#include "memory_init.105.h"
+#include "memory_init.106.h"
+#include "memory_init.107.h"
+#include "memory_init.108.h"
+#include "memory_init.109.h"
+#include "memory_init.110.h"
+#include "memory_init.111.h"
+#include "memory_init.175.h"
+#include "memory_init.176.h"
+#include "memory_init.177.h"
+#include "memory_init.178.h"
+#include "memory_init.179.h"
+#include "memory_init.180.h"
+#include "memory_init.181.h"
+#include <assert.h>
+#define __STDC_FORMAT_MACROS
+#include <inttypes.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "wasm-rt.h"
+#include "wasm-rt-impl.h"
+#include "wasm-rt-exceptions.h"
+
+/* NOTE: function argument evaluation order is implementation-defined in C,
+   so it SHOULD NOT be relied on by tests. */
+#if WABT_BIG_ENDIAN
+#define v128_i8x16_make(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p) \
+	simde_wasm_i8x16_make(p,o,n,m,l,k,j,i,h,g,f,e,d,c,b,a)
+#define v128_u8x16_make(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p) \
+	simde_wasm_u8x16_make(p,o,n,m,l,k,j,i,h,g,f,e,d,c,b,a)
+#define v128_i16x8_make(a,b,c,d,e,f,g,h) simde_wasm_i16x8_make(h,g,f,e,d,c,b,a)
+#define v128_u16x8_make(a,b,c,d,e,f,g,h) simde_wasm_u16x8_make(h,g,f,e,d,c,b,a)
+#define v128_i32x4_make(a,b,c,d) simde_wasm_i32x4_make(d,c,b,a)
+#define v128_u32x4_make(a,b,c,d) simde_wasm_u32x4_make(d,c,b,a)
+#define v128_i64x2_make(a,b) simde_wasm_i64x2_make(b,a)
+#define v128_u64x2_make(a,b) simde_wasm_u64x2_make(b,a)
+#define v128_f32x4_make(a,b,c,d) simde_wasm_f32x4_make(d,c,b,a)
+#define v128_f64x2_make(a,b) simde_wasm_f64x2_make(b,a)
+#define v128_i8x16_extract_lane(a,n) simde_wasm_u8x16_extract_lane(a,15-(n))
+#define v128_u8x16_extract_lane(a,n) simde_wasm_u8x16_extract_lane(a,15-(n))
+#define v128_i16x8_extract_lane(a,n) simde_wasm_u16x8_extract_lane(a,7-(n))
+#define v128_u16x8_extract_lane(a,n) simde_wasm_u16x8_extract_lane(a,7-(n))
+#define v128_i32x4_extract_lane(a,n) simde_wasm_u32x4_extract_lane(a,3-(n))
+#define v128_u32x4_extract_lane(a,n) simde_wasm_u32x4_extract_lane(a,3-(n))
+#define v128_i64x2_extract_lane(a,n) simde_wasm_u64x2_extract_lane(a,1-(n))
+#define v128_u64x2_extract_lane(a,n) simde_wasm_u64x2_extract_lane(a,1-(n))
+#define v128_f32x4_extract_lane(a,n) simde_wasm_f32x4_extract_lane(a,3-(n))
+#define v128_f64x2_extract_lane(a,n) simde_wasm_f64x2_extract_lane(a,1-(n))
+#else
+#define v128_i8x16_make simde_wasm_i8x16_make
+#define v128_u8x16_make simde_wasm_u8x16_make
+#define v128_i16x8_make simde_wasm_i16x8_make
+#define v128_u16x8_make simde_wasm_u16x8_make
+#define v128_i32x4_make simde_wasm_i32x4_make
+#define v128_u32x4_make simde_wasm_u32x4_make
+#define v128_i64x2_make simde_wasm_i64x2_make
+#define v128_u64x2_make simde_wasm_u64x2_make
+#define v128_f32x4_make simde_wasm_f32x4_make
+#define v128_f64x2_make simde_wasm_f64x2_make
+// like is_equal_TYPE below, always use unsigned for these
+#define v128_i8x16_extract_lane simde_wasm_u8x16_extract_lane
+#define v128_u8x16_extract_lane simde_wasm_u8x16_extract_lane
+#define v128_i16x8_extract_lane simde_wasm_u16x8_extract_lane
+#define v128_u16x8_extract_lane simde_wasm_u16x8_extract_lane
+#define v128_i32x4_extract_lane simde_wasm_u32x4_extract_lane
+#define v128_u32x4_extract_lane simde_wasm_u32x4_extract_lane
+#define v128_i64x2_extract_lane simde_wasm_u64x2_extract_lane
+#define v128_u64x2_extract_lane simde_wasm_u64x2_extract_lane
+#define v128_f32x4_extract_lane simde_wasm_f32x4_extract_lane
+#define v128_f64x2_extract_lane simde_wasm_f64x2_extract_lane
+#endif
+
+static int g_tests_run;
+static int g_tests_passed;
+
+static void run_spec_tests(void);
+
+static void error(const char* file, int line, const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  fprintf(stderr, "%s:%d: assertion failed: ", file, line);
+  vfprintf(stderr, format, args);
+  va_end(args);
+}
+
+#define ASSERT_EXCEPTION(f)                                               \
+  do {                                                                    \
+    g_tests_run++;                                                        \
+    if (wasm_rt_impl_try() == WASM_RT_TRAP_UNCAUGHT_EXCEPTION) {          \
+      g_tests_passed++;                                                   \
+    } else {                                                              \
+      (void)(f);                                                          \
+      error(__FILE__, __LINE__, "expected " #f " to throw exception.\n"); \
+    }                                                                     \
+  } while (0)
+
+#define ASSERT_TRAP(f)                                         \
+  do {                                                         \
+    g_tests_run++;                                             \
+    if (wasm_rt_impl_try() != 0) {                             \
+      g_tests_passed++;                                        \
+    } else {                                                   \
+      (void)(f);                                               \
+      error(__FILE__, __LINE__, "expected " #f " to trap.\n"); \
+    }                                                          \
+  } while (0)
+
+#define ASSERT_EXHAUSTION(f)                                     \
+  do {                                                           \
+    g_tests_run++;                                               \
+    wasm_rt_trap_t code = wasm_rt_impl_try();                    \
+    switch (code) {                                              \
+      case WASM_RT_TRAP_NONE:                                    \
+        (void)(f);                                               \
+        error(__FILE__, __LINE__, "expected " #f " to trap.\n"); \
+        break;                                                   \
+      case WASM_RT_TRAP_EXHAUSTION:                              \
+        g_tests_passed++;                                        \
+        break;                                                   \
+      default:                                                   \
+        error(__FILE__, __LINE__,                                \
+              "expected " #f                                     \
+              " to trap due to exhaustion, got trap code %d.\n", \
+              code);                                             \
+        break;                                                   \
+    }                                                            \
+  } while (0)
+
+#define ASSERT_RETURN(f)                               \
+  do {                                                 \
+    g_tests_run++;                                     \
+    int trap_code = wasm_rt_impl_try();                \
+    if (trap_code) {                                   \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n", \
+            wasm_rt_strerror(trap_code));              \
+    } else {                                           \
+      f;                                               \
+      g_tests_passed++;                                \
+    }                                                  \
+  } while (0)
+
+#define ASSERT_RETURN_T(type, fmt, f, expected)                          \
+  do {                                                                   \
+    g_tests_run++;                                                       \
+    int trap_code = wasm_rt_impl_try();                                  \
+    if (trap_code) {                                                     \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                   \
+            wasm_rt_strerror(trap_code));                                \
+    } else {                                                             \
+      type actual = f;                                                   \
+      if (is_equal_##type(actual, expected)) {                           \
+        g_tests_passed++;                                                \
+      } else {                                                           \
+        error(__FILE__, __LINE__,                                        \
+              "in " #f ": expected %" fmt ", got %" fmt ".\n", expected, \
+              actual);                                                   \
+      }                                                                  \
+    }                                                                    \
+  } while (0)
+
+#define ASSERT_RETURN_FUNCREF(f, expected)                                \
+  do {                                                                    \
+    g_tests_run++;                                                        \
+    int trap_code = wasm_rt_impl_try();                                   \
+    if (trap_code) {                                                      \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                    \
+            wasm_rt_strerror(trap_code));                                 \
+    } else {                                                              \
+      wasm_rt_funcref_t actual = f;                                       \
+      if (is_equal_wasm_rt_funcref_t(actual, expected)) {                 \
+        g_tests_passed++;                                                 \
+      } else {                                                            \
+        error(__FILE__, __LINE__,                                         \
+              "in " #f ": mismatch between expected and actual funcref"); \
+      }                                                                   \
+    }                                                                     \
+  } while (0)
+
+#define ASSERT_RETURN_EXNREF(f, expected)                                \
+  do {                                                                   \
+    g_tests_run++;                                                       \
+    int trap_code = wasm_rt_impl_try();                                  \
+    if (trap_code) {                                                     \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                   \
+            wasm_rt_strerror(trap_code));                                \
+    } else {                                                             \
+      wasm_rt_exnref_t actual = f;                                       \
+      if (is_equal_wasm_rt_exnref_t(actual, expected)) {                 \
+        g_tests_passed++;                                                \
+      } else {                                                           \
+        error(__FILE__, __LINE__,                                        \
+              "in " #f ": mismatch between expected and actual exnref"); \
+      }                                                                  \
+    }                                                                    \
+  } while (0)
+
+#define ASSERT_RETURN_NAN_T(type, itype, fmt, f, kind)                        \
+  do {                                                                        \
+    g_tests_run++;                                                            \
+    int trap_code = wasm_rt_impl_try();                                       \
+    if (trap_code) {                                                          \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                        \
+            wasm_rt_strerror(trap_code));                                     \
+    } else {                                                                  \
+      type actual = f;                                                        \
+      itype iactual;                                                          \
+      memcpy(&iactual, &actual, sizeof(iactual));                             \
+      if (is_##kind##_nan_##type(iactual)) {                                  \
+        g_tests_passed++;                                                     \
+      } else {                                                                \
+        error(__FILE__, __LINE__,                                             \
+              "in " #f ": expected result to be a " #kind " nan, got 0x%" fmt \
+              ".\n",                                                          \
+              iactual);                                                       \
+      }                                                                       \
+    }                                                                         \
+  } while (0)
+
+#define MULTI_T_UNPACK_(...) __VA_ARGS__
+#define MULTI_T_UNPACK(arg) MULTI_T_UNPACK_ arg
+#define MULTI_i8 "%" PRIu8 " "
+#define MULTI_i16 "%" PRIu16 " "
+#define MULTI_i32 "%u "
+#define MULTI_i64 "%" PRIu64 " "
+#define MULTI_f32 "%.9g "
+#define MULTI_f64 "%.17g "
+#define MULTI_str "%s "
+#define ASSERT_RETURN_MULTI_T(type, fmt_expected, fmt_got, f, compare,        \
+                              expected, found)                                \
+  do {                                                                        \
+    g_tests_run++;                                                            \
+    int trap_code = wasm_rt_impl_try();                                       \
+    if (trap_code) {                                                          \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                        \
+            wasm_rt_strerror(trap_code));                                     \
+    } else {                                                                  \
+      type actual = f;                                                        \
+      if (compare) {                                                          \
+        g_tests_passed++;                                                     \
+      } else {                                                                \
+        error(__FILE__, __LINE__,                                             \
+              "in " #f ": expected <" fmt_expected ">, got <" fmt_got ">.\n", \
+              MULTI_T_UNPACK(expected), MULTI_T_UNPACK(found));               \
+      }                                                                       \
+    }                                                                         \
+  } while (0)
+
+
+#define ASSERT_RETURN_I32(f, expected) ASSERT_RETURN_T(u32, "u", f, expected)
+#define ASSERT_RETURN_I64(f, expected) ASSERT_RETURN_T(u64, PRIu64, f, expected)
+#define ASSERT_RETURN_F32(f, expected) ASSERT_RETURN_T(f32, ".9g", f, expected)
+#define ASSERT_RETURN_F64(f, expected) ASSERT_RETURN_T(f64, ".17g", f, expected)
+#define ASSERT_RETURN_EXTERNREF(f, expected) \
+  ASSERT_RETURN_T(wasm_rt_externref_t, "p", f, expected);
+
+#define ASSERT_RETURN_CANONICAL_NAN_F32(f) \
+  ASSERT_RETURN_NAN_T(f32, u32, "08x", f, canonical)
+#define ASSERT_RETURN_CANONICAL_NAN_F64(f) \
+  ASSERT_RETURN_NAN_T(f64, u64, "016x", f, canonical)
+#define ASSERT_RETURN_ARITHMETIC_NAN_F32(f) \
+  ASSERT_RETURN_NAN_T(f32, u32, "08x", f, arithmetic)
+#define ASSERT_RETURN_ARITHMETIC_NAN_F64(f) \
+  ASSERT_RETURN_NAN_T(f64, u64, "016x", f, arithmetic)
+
+static bool is_equal_u8(u8 x, u8 y) {
+  return x == y;
+}
+
+static bool is_equal_u16(u16 x, u16 y) {
+  return x == y;
+}
+
+static bool is_equal_u32(u32 x, u32 y) {
+  return x == y;
+}
+
+static bool is_equal_u64(u64 x, u64 y) {
+  return x == y;
+}
+
+#define is_equal_i8 is_equal_u8
+#define is_equal_i16 is_equal_u16
+#define is_equal_i32 is_equal_u32
+#define is_equal_i64 is_equal_u64
+
+static bool is_equal_wasm_rt_externref_t(wasm_rt_externref_t x,
+                                         wasm_rt_externref_t y) {
+  return x == y;
+}
+
+static inline bool is_equal_wasm_rt_func_type_t(const wasm_rt_func_type_t a,
+                                                const wasm_rt_func_type_t b) {
+  return (a == b) || (a && b && !memcmp(a, b, 32));
+}
+
+static bool is_equal_wasm_rt_funcref_t(wasm_rt_funcref_t x,
+                                       wasm_rt_funcref_t y) {
+  return is_equal_wasm_rt_func_type_t(x.func_type, y.func_type) &&
+         (x.func == y.func) && (x.module_instance == y.module_instance);
+}
+
+#ifdef WASM_EXN_MAX_SIZE
+static bool is_equal_wasm_rt_exnref_t(wasm_rt_exnref_t x, wasm_rt_exnref_t y) {
+  return x.tag == y.tag && x.size == y.size && !memcmp(x.data, y.data, x.size);
+}
+#endif
+
+wasm_rt_externref_t spectest_make_externref(uintptr_t x) {
+  return (wasm_rt_externref_t)(x + 1);  // externref(0) is not null
+}
+
+static u32 f32_bits(f32 x) {
+  u32 ux;
+  memcpy(&ux, &x, sizeof(ux));
+  return ux;
+}
+
+static u64 f64_bits(f64 x) {
+  u64 ux;
+  memcpy(&ux, &x, sizeof(ux));
+  return ux;
+}
+
+static bool is_equal_f32(f32 x, f32 y) {
+  return f32_bits(x) == f32_bits(y);
+}
+
+static bool is_equal_f64(f64 x, f64 y) {
+  return f64_bits(x) == f64_bits(y);
+}
+
+static f32 make_nan_f32(u32 x) {
+  x |= 0x7f800000;
+  f32 res;
+  memcpy(&res, &x, sizeof(res));
+  return res;
+}
+
+static f64 make_nan_f64(u64 x) {
+  x |= 0x7ff0000000000000;
+  f64 res;
+  memcpy(&res, &x, sizeof(res));
+  return res;
+}
+
+static bool is_canonical_nan_f32(u32 x) {
+  return (x & 0x7fffffff) == 0x7fc00000;
+}
+
+static bool is_canonical_nan_f64(u64 x) {
+  return (x & 0x7fffffffffffffff) == 0x7ff8000000000000;
+}
+
+static bool is_arithmetic_nan_f32(u32 x) {
+  return (x & 0x7fc00000) == 0x7fc00000;
+}
+
+static bool is_arithmetic_nan_f64(u64 x) {
+  return (x & 0x7ff8000000000000) == 0x7ff8000000000000;
+}
+
+typedef struct w2c_spectest {
+  wasm_rt_funcref_table_t spectest_table;
+  wasm_rt_funcref_table_t spectest_table64;
+  wasm_rt_memory_t spectest_memory;
+  uint32_t spectest_global_i32;
+  uint64_t spectest_global_i64;
+  float spectest_global_f32;
+  double spectest_global_f64;
+} w2c_spectest;
+
+static w2c_spectest spectest_instance;
+
+/*
+ * spectest implementations
+ */
+void w2c_spectest_print(w2c_spectest* instance) {
+  printf("spectest.print()\n");
+}
+
+void w2c_spectest_print_i32(w2c_spectest* instance, uint32_t i) {
+  printf("spectest.print_i32(%d)\n", i);
+}
+
+void w2c_spectest_print_i64(w2c_spectest* instance, uint64_t i) {
+  printf("spectest.print_i64(%" PRIu64 ")\n", i);
+}
+
+void w2c_spectest_print_f32(w2c_spectest* instance, float f) {
+  printf("spectest.print_f32(%g)\n", f);
+}
+
+void w2c_spectest_print_i32_f32(w2c_spectest* instance, uint32_t i, float f) {
+  printf("spectest.print_i32_f32(%d %g)\n", i, f);
+}
+
+void w2c_spectest_print_f64(w2c_spectest* instance, double d) {
+  printf("spectest.print_f64(%g)\n", d);
+}
+
+void w2c_spectest_print_f64_f64(w2c_spectest* instance, double d1, double d2) {
+  printf("spectest.print_f64_f64(%g %g)\n", d1, d2);
+}
+
+wasm_rt_funcref_table_t* w2c_spectest_table(w2c_spectest* instance) {
+  return &instance->spectest_table;
+}
+
+wasm_rt_funcref_table_t* w2c_spectest_table64(w2c_spectest* instance) {
+  return &instance->spectest_table64;
+}
+
+wasm_rt_memory_t* w2c_spectest_memory(w2c_spectest* instance) {
+  return &instance->spectest_memory;
+}
+
+uint32_t* w2c_spectest_global_i32(w2c_spectest* instance) {
+  return &instance->spectest_global_i32;
+}
+
+uint64_t* w2c_spectest_global_i64(w2c_spectest* instance) {
+  return &instance->spectest_global_i64;
+}
+
+float* w2c_spectest_global_f32(w2c_spectest* instance) {
+  return &instance->spectest_global_f32;
+}
+
+double* w2c_spectest_global_f64(w2c_spectest* instance) {
+  return &instance->spectest_global_f64;
+}
+
+static void init_spectest_module(w2c_spectest* instance) {
+  instance->spectest_global_i32 = 666;
+  instance->spectest_global_i64 = 666l;
+  instance->spectest_global_f32 = 666.6;
+  instance->spectest_global_f64 = 666.6;
+  wasm_rt_allocate_memory(&instance->spectest_memory, 1, 2, false,
+                          WASM_DEFAULT_PAGE_SIZE);
+  wasm_rt_allocate_funcref_table(&instance->spectest_table, 10, 20);
+  wasm_rt_allocate_funcref_table(&instance->spectest_table64, 10, 20);
+}
+
+// POSIX-only test config where embedder handles signals instead of w2c runtime
+#ifdef WASM2C_TEST_EMBEDDER_SIGNAL_HANDLING
+#include <signal.h>
+
+static void posix_signal_handler(int sig, siginfo_t* si, void* unused) {
+  wasm_rt_trap((si->si_code == SEGV_ACCERR) ? WASM_RT_TRAP_OOB
+                                            : WASM_RT_TRAP_EXHAUSTION);
+}
+
+static void posix_install_signal_handler(void) {
+  /* install altstack */
+  stack_t ss;
+  ss.ss_sp = malloc(SIGSTKSZ);
+  ss.ss_flags = 0;
+  ss.ss_size = SIGSTKSZ;
+  if (sigaltstack(&ss, NULL) != 0) {
+    perror("sigaltstack failed");
+    abort();
+  }
+
+  /* install signal handler */
+  struct sigaction sa;
+  memset(&sa, '\0', sizeof(sa));
+  sa.sa_flags = SA_SIGINFO | SA_ONSTACK;
+  sigemptyset(&sa.sa_mask);
+  sa.sa_sigaction = posix_signal_handler;
+  if (sigaction(SIGSEGV, &sa, NULL) != 0 || sigaction(SIGBUS, &sa, NULL) != 0) {
+    perror("sigaction failed");
+    abort();
+  }
+}
+
+static void posix_cleanup_signal_handler(void) {
+  /* remove signal handler */
+  struct sigaction sa;
+  memset(&sa, '\0', sizeof(sa));
+  sa.sa_handler = SIG_DFL;
+  if (sigaction(SIGSEGV, &sa, NULL) != 0 || sigaction(SIGBUS, &sa, NULL)) {
+    perror("sigaction failed");
+    abort();
+  }
+
+  /* disable and free altstack */
+  stack_t ss;
+  ss.ss_flags = SS_DISABLE;
+  if (sigaltstack(&ss, NULL) != 0) {
+    perror("sigaltstack failed");
+    abort();
+  }
+  free(ss.ss_sp);
+}
+#endif
+
+int main(int argc, char** argv) {
+#ifdef WASM2C_TEST_EMBEDDER_SIGNAL_HANDLING
+  posix_install_signal_handler();
+#endif
+  wasm_rt_init();
+  init_spectest_module(&spectest_instance);
+  run_spec_tests();
+  printf("%u/%u tests passed.\n", g_tests_passed, g_tests_run);
+  wasm_rt_free();
+#ifdef WASM2C_TEST_EMBEDDER_SIGNAL_HANDLING
+  posix_cleanup_signal_handler();
+#endif
+  return g_tests_passed != g_tests_run;
+}
+
+w2c_memory__init__0__wasm memory__init__0__wasm_instance;
+w2c_memory__init__1__wasm memory__init__1__wasm_instance;
+w2c_memory__init__2__wasm memory__init__2__wasm_instance;
+w2c_memory__init__3__wasm memory__init__3__wasm_instance;
+w2c_memory__init__6__wasm memory__init__6__wasm_instance;
+w2c_memory__init__7__wasm memory__init__7__wasm_instance;
+w2c_memory__init__8__wasm memory__init__8__wasm_instance;
+w2c_memory__init__11__wasm memory__init__11__wasm_instance;
+w2c_memory__init__12__wasm memory__init__12__wasm_instance;
+w2c_memory__init__13__wasm memory__init__13__wasm_instance;
+w2c_memory__init__14__wasm memory__init__14__wasm_instance;
+w2c_memory__init__15__wasm memory__init__15__wasm_instance;
+w2c_memory__init__16__wasm memory__init__16__wasm_instance;
+w2c_memory__init__17__wasm memory__init__17__wasm_instance;
+w2c_memory__init__18__wasm memory__init__18__wasm_instance;
+w2c_memory__init__19__wasm memory__init__19__wasm_instance;
+w2c_memory__init__20__wasm memory__init__20__wasm_instance;
+w2c_memory__init__84__wasm memory__init__84__wasm_instance;
+w2c_memory__init__85__wasm memory__init__85__wasm_instance;
+w2c_memory__init__86__wasm memory__init__86__wasm_instance;
+w2c_memory__init__87__wasm memory__init__87__wasm_instance;
+w2c_memory__init__88__wasm memory__init__88__wasm_instance;
+w2c_memory__init__89__wasm memory__init__89__wasm_instance;
+w2c_memory__init__90__wasm memory__init__90__wasm_instance;
+w2c_memory__init__91__wasm memory__init__91__wasm_instance;
+w2c_memory__init__92__wasm memory__init__92__wasm_instance;
+w2c_memory__init__93__wasm memory__init__93__wasm_instance;
+w2c_memory__init__94__wasm memory__init__94__wasm_instance;
+w2c_memory__init__97__wasm memory__init__97__wasm_instance;
+w2c_memory__init__98__wasm memory__init__98__wasm_instance;
+w2c_memory__init__99__wasm memory__init__99__wasm_instance;
+w2c_memory__init__102__wasm memory__init__102__wasm_instance;
+w2c_memory__init__103__wasm memory__init__103__wasm_instance;
+w2c_memory__init__104__wasm memory__init__104__wasm_instance;
+w2c_memory__init__105__wasm memory__init__105__wasm_instance;
+w2c_memory__init__106__wasm memory__init__106__wasm_instance;
+w2c_memory__init__107__wasm memory__init__107__wasm_instance;
+w2c_memory__init__108__wasm memory__init__108__wasm_instance;
+w2c_memory__init__109__wasm memory__init__109__wasm_instance;
+w2c_memory__init__110__wasm memory__init__110__wasm_instance;
+w2c_memory__init__111__wasm memory__init__111__wasm_instance;
+w2c_memory__init__175__wasm memory__init__175__wasm_instance;
+w2c_memory__init__176__wasm memory__init__176__wasm_instance;
+w2c_memory__init__177__wasm memory__init__177__wasm_instance;
+w2c_memory__init__178__wasm memory__init__178__wasm_instance;
+w2c_memory__init__179__wasm memory__init__179__wasm_instance;
+w2c_memory__init__180__wasm memory__init__180__wasm_instance;
+w2c_memory__init__181__wasm memory__init__181__wasm_instance;
+
+void run_spec_tests_0(void) {
+
+#line 6 "memory_init.wast"
+wasm2c_memory__init__0__wasm_instantiate(&memory__init__0__wasm_instance);
+
+#line 17 "memory_init.wast"
+w2c_memory__init__0__wasm_test(&memory__init__0__wasm_instance);
+
+#line 19 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 0u), 0u);
+
+#line 20 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 1u), 0u);
+
+#line 21 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 2u), 3u);
+
+#line 22 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 3u), 1u);
+
+#line 23 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 4u), 4u);
+
+#line 24 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 5u), 1u);
+
+#line 25 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 6u), 0u);
+
+#line 26 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 7u), 0u);
+
+#line 27 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 8u), 0u);
+
+#line 28 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 9u), 0u);
+
+#line 29 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 10u), 0u);
+
+#line 30 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 11u), 0u);
+
+#line 31 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 12u), 7u);
+
+#line 32 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 13u), 5u);
+
+#line 33 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 14u), 2u);
+
+#line 34 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 15u), 3u);
+
+#line 35 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 16u), 6u);
+
+#line 36 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 17u), 0u);
+
+#line 37 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 18u), 0u);
+
+#line 38 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 19u), 0u);
+
+#line 39 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 20u), 0u);
+
+#line 40 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 21u), 0u);
+
+#line 41 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 22u), 0u);
+
+#line 42 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 23u), 0u);
+
+#line 43 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 24u), 0u);
+
+#line 44 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 25u), 0u);
+
+#line 45 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 26u), 0u);
+
+#line 46 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 27u), 0u);
+
+#line 47 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 28u), 0u);
+
+#line 48 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__0__wasm_load8_u(&memory__init__0__wasm_instance, 29u), 0u);
+
+#line 50 "memory_init.wast"
+wasm2c_memory__init__1__wasm_instantiate(&memory__init__1__wasm_instance);
+
+#line 61 "memory_init.wast"
+w2c_memory__init__1__wasm_test(&memory__init__1__wasm_instance);
+
+#line 63 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 0u), 0u);
+
+#line 64 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 1u), 0u);
+
+#line 65 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 2u), 3u);
+
+#line 66 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 3u), 1u);
+
+#line 67 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 4u), 4u);
+
+#line 68 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 5u), 1u);
+
+#line 69 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 6u), 0u);
+
+#line 70 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 7u), 2u);
+
+#line 71 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 8u), 7u);
+
+#line 72 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 9u), 1u);
+
+#line 73 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 10u), 8u);
+
+#line 74 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 11u), 0u);
+
+#line 75 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 12u), 7u);
+
+#line 76 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 13u), 5u);
+
+#line 77 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 14u), 2u);
+
+#line 78 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 15u), 3u);
+
+#line 79 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 16u), 6u);
+
+#line 80 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 17u), 0u);
+
+#line 81 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 18u), 0u);
+
+#line 82 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 19u), 0u);
+
+#line 83 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 20u), 0u);
+
+#line 84 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 21u), 0u);
+
+#line 85 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 22u), 0u);
+
+#line 86 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 23u), 0u);
+
+#line 87 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 24u), 0u);
+
+#line 88 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 25u), 0u);
+
+#line 89 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 26u), 0u);
+
+#line 90 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 27u), 0u);
+
+#line 91 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 28u), 0u);
+
+#line 92 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__1__wasm_load8_u(&memory__init__1__wasm_instance, 29u), 0u);
+
+#line 94 "memory_init.wast"
+wasm2c_memory__init__2__wasm_instantiate(&memory__init__2__wasm_instance);
+
+#line 105 "memory_init.wast"
+w2c_memory__init__2__wasm_test(&memory__init__2__wasm_instance);
+
+#line 107 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 0u), 0u);
+
+#line 108 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 1u), 0u);
+
+#line 109 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 2u), 3u);
+
+#line 110 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 3u), 1u);
+
+#line 111 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 4u), 4u);
+
+#line 112 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 5u), 1u);
+
+#line 113 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 6u), 0u);
+
+#line 114 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 7u), 0u);
+
+#line 115 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 8u), 0u);
+
+#line 116 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 9u), 0u);
+
+#line 117 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 10u), 0u);
+
+#line 118 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 11u), 0u);
+
+#line 119 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 12u), 7u);
+
+#line 120 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 13u), 5u);
+
+#line 121 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 14u), 2u);
+
+#line 122 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 15u), 9u);
+
+#line 123 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 16u), 2u);
+
+#line 124 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 17u), 7u);
+
+#line 125 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 18u), 0u);
+
+#line 126 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 19u), 0u);
+
+#line 127 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 20u), 0u);
+
+#line 128 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 21u), 0u);
+
+#line 129 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 22u), 0u);
+
+#line 130 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 23u), 0u);
+
+#line 131 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 24u), 0u);
+
+#line 132 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 25u), 0u);
+
+#line 133 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 26u), 0u);
+
+#line 134 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 27u), 0u);
+
+#line 135 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 28u), 0u);
+
+#line 136 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__2__wasm_load8_u(&memory__init__2__wasm_instance, 29u), 0u);
+
+#line 138 "memory_init.wast"
+wasm2c_memory__init__3__wasm_instantiate(&memory__init__3__wasm_instance);
+
+#line 157 "memory_init.wast"
+w2c_memory__init__3__wasm_test(&memory__init__3__wasm_instance);
+
+#line 159 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 0u), 0u);
+
+#line 160 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 1u), 0u);
+
+#line 161 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 2u), 3u);
+
+#line 162 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 3u), 1u);
+
+#line 163 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 4u), 4u);
+
+#line 164 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 5u), 1u);
+
+#line 165 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 6u), 0u);
+
+#line 166 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 7u), 2u);
+
+#line 167 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 8u), 7u);
+
+#line 168 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 9u), 1u);
+
+#line 169 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 10u), 8u);
+
+#line 170 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 11u), 0u);
+
+#line 171 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 12u), 7u);
+
+#line 172 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 13u), 0u);
+
+#line 173 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 14u), 7u);
+
+#line 174 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 15u), 5u);
+
+#line 175 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 16u), 2u);
+
+#line 176 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 17u), 7u);
+
+#line 177 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 18u), 0u);
+
+#line 178 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 19u), 9u);
+
+#line 179 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 20u), 0u);
+
+#line 180 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 21u), 7u);
+
+#line 181 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 22u), 0u);
+
+#line 182 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 23u), 8u);
+
+#line 183 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 24u), 8u);
+
+#line 184 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 25u), 0u);
+
+#line 185 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 26u), 0u);
+
+#line 186 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 27u), 0u);
+
+#line 187 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 28u), 0u);
+
+#line 188 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__3__wasm_load8_u(&memory__init__3__wasm_instance, 29u), 0u);
+
+#line 203 "memory_init.wast"
+wasm2c_memory__init__6__wasm_instantiate(&memory__init__6__wasm_instance);
+
+#line 209 "memory_init.wast"
+w2c_memory__init__6__wasm_test(&memory__init__6__wasm_instance);
+
+#line 211 "memory_init.wast"
+wasm2c_memory__init__7__wasm_instantiate(&memory__init__7__wasm_instance);
+
+#line 217 "memory_init.wast"
+ASSERT_TRAP(w2c_memory__init__7__wasm_test(&memory__init__7__wasm_instance));
+
+#line 219 "memory_init.wast"
+wasm2c_memory__init__8__wasm_instantiate(&memory__init__8__wasm_instance);
+
+#line 224 "memory_init.wast"
+ASSERT_TRAP(w2c_memory__init__8__wasm_test(&memory__init__8__wasm_instance));
+
+#line 240 "memory_init.wast"
+wasm2c_memory__init__11__wasm_instantiate(&memory__init__11__wasm_instance);
+
+#line 246 "memory_init.wast"
+w2c_memory__init__11__wasm_test(&memory__init__11__wasm_instance);
+
+#line 248 "memory_init.wast"
+wasm2c_memory__init__12__wasm_instantiate(&memory__init__12__wasm_instance);
+
+#line 253 "memory_init.wast"
+ASSERT_TRAP(w2c_memory__init__12__wasm_test(&memory__init__12__wasm_instance));
+
+#line 255 "memory_init.wast"
+wasm2c_memory__init__13__wasm_instantiate(&memory__init__13__wasm_instance);
+
+#line 260 "memory_init.wast"
+ASSERT_TRAP(w2c_memory__init__13__wasm_test(&memory__init__13__wasm_instance));
+
+#line 262 "memory_init.wast"
+wasm2c_memory__init__14__wasm_instantiate(&memory__init__14__wasm_instance);
+
+#line 267 "memory_init.wast"
+ASSERT_TRAP(w2c_memory__init__14__wasm_test(&memory__init__14__wasm_instance));
+
+#line 269 "memory_init.wast"
+wasm2c_memory__init__15__wasm_instantiate(&memory__init__15__wasm_instance);
+
+#line 274 "memory_init.wast"
+ASSERT_TRAP(w2c_memory__init__15__wasm_test(&memory__init__15__wasm_instance));
+
+#line 276 "memory_init.wast"
+wasm2c_memory__init__16__wasm_instantiate(&memory__init__16__wasm_instance);
+
+#line 281 "memory_init.wast"
+w2c_memory__init__16__wasm_test(&memory__init__16__wasm_instance);
+
+#line 283 "memory_init.wast"
+wasm2c_memory__init__17__wasm_instantiate(&memory__init__17__wasm_instance);
+
+#line 288 "memory_init.wast"
+ASSERT_TRAP(w2c_memory__init__17__wasm_test(&memory__init__17__wasm_instance));
+
+#line 290 "memory_init.wast"
+wasm2c_memory__init__18__wasm_instantiate(&memory__init__18__wasm_instance);
+
+#line 295 "memory_init.wast"
+w2c_memory__init__18__wasm_test(&memory__init__18__wasm_instance);
+
+#line 297 "memory_init.wast"
+wasm2c_memory__init__19__wasm_instantiate(&memory__init__19__wasm_instance);
+
+#line 302 "memory_init.wast"
+w2c_memory__init__19__wasm_test(&memory__init__19__wasm_instance);
+
+#line 304 "memory_init.wast"
+wasm2c_memory__init__20__wasm_instantiate(&memory__init__20__wasm_instance);
+
+#line 309 "memory_init.wast"
+ASSERT_TRAP(w2c_memory__init__20__wasm_test(&memory__init__20__wasm_instance));
+
+#line 815 "memory_init.wast"
+wasm2c_memory__init__84__wasm_instantiate(&memory__init__84__wasm_instance);
+
+#line 833 "memory_init.wast"
+ASSERT_TRAP(w2c_memory__init__84__wasm_run(&memory__init__84__wasm_instance, 65528u, 16u));
+
+#line 836 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__84__wasm_checkRange(&memory__init__84__wasm_instance, 0u, 1u, 0u), 4294967295u);
+
+#line 838 "memory_init.wast"
+wasm2c_memory__init__85__wasm_instantiate(&memory__init__85__wasm_instance);
+
+#line 856 "memory_init.wast"
+ASSERT_TRAP(w2c_memory__init__85__wasm_run(&memory__init__85__wasm_instance, 65527u, 16u));
+
+#line 859 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__85__wasm_checkRange(&memory__init__85__wasm_instance, 0u, 1u, 0u), 4294967295u);
+
+#line 861 "memory_init.wast"
+wasm2c_memory__init__86__wasm_instantiate(&memory__init__86__wasm_instance);
+
+#line 879 "memory_init.wast"
+ASSERT_TRAP(w2c_memory__init__86__wasm_run(&memory__init__86__wasm_instance, 65472u, 30u));
+
+#line 882 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__86__wasm_checkRange(&memory__init__86__wasm_instance, 0u, 1u, 0u), 4294967295u);
+
+#line 884 "memory_init.wast"
+wasm2c_memory__init__87__wasm_instantiate(&memory__init__87__wasm_instance);
+
+#line 902 "memory_init.wast"
+ASSERT_TRAP(w2c_memory__init__87__wasm_run(&memory__init__87__wasm_instance, 65473u, 31u));
+
+#line 905 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__87__wasm_checkRange(&memory__init__87__wasm_instance, 0u, 1u, 0u), 4294967295u);
+
+#line 907 "memory_init.wast"
+wasm2c_memory__init__88__wasm_instantiate(&memory__init__88__wasm_instance);
+
+#line 925 "memory_init.wast"
+ASSERT_TRAP(w2c_memory__init__88__wasm_run(&memory__init__88__wasm_instance, 65528u, 4294967040u));
+
+#line 928 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__88__wasm_checkRange(&memory__init__88__wasm_instance, 0u, 1u, 0u), 4294967295u);
+
+#line 930 "memory_init.wast"
+wasm2c_memory__init__89__wasm_instantiate(&memory__init__89__wasm_instance);
+
+#line 948 "memory_init.wast"
+ASSERT_TRAP(w2c_memory__init__89__wasm_run(&memory__init__89__wasm_instance, 0u, 4294967292u));
+
+#line 951 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__89__wasm_checkRange(&memory__init__89__wasm_instance, 0u, 1u, 0u), 4294967295u);
+
+#line 954 "memory_init.wast"
+wasm2c_memory__init__90__wasm_instantiate(&memory__init__90__wasm_instance);
+
+#line 969 "memory_init.wast"
+wasm2c_memory__init__91__wasm_instantiate(&memory__init__91__wasm_instance);
+
+#line 980 "memory_init.wast"
+w2c_memory__init__91__wasm_test(&memory__init__91__wasm_instance);
+
+#line 982 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 0ull), 0u);
+
+#line 983 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 1ull), 0u);
+
+#line 984 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 2ull), 3u);
+
+#line 985 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 3ull), 1u);
+
+#line 986 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 4ull), 4u);
+
+#line 987 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 5ull), 1u);
+
+#line 988 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 6ull), 0u);
+
+#line 989 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 7ull), 0u);
+
+#line 990 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 8ull), 0u);
+
+#line 991 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 9ull), 0u);
+
+#line 992 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 10ull), 0u);
+
+#line 993 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 11ull), 0u);
+
+#line 994 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 12ull), 7u);
+
+#line 995 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 13ull), 5u);
+
+#line 996 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 14ull), 2u);
+
+#line 997 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 15ull), 3u);
+
+#line 998 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 16ull), 6u);
+
+#line 999 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 17ull), 0u);
+
+#line 1000 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 18ull), 0u);
+
+#line 1001 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 19ull), 0u);
+
+#line 1002 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 20ull), 0u);
+
+#line 1003 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 21ull), 0u);
+
+#line 1004 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 22ull), 0u);
+
+#line 1005 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 23ull), 0u);
+
+#line 1006 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 24ull), 0u);
+
+#line 1007 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 25ull), 0u);
+
+#line 1008 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 26ull), 0u);
+
+#line 1009 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 27ull), 0u);
+
+#line 1010 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 28ull), 0u);
+
+#line 1011 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__91__wasm_load8_u(&memory__init__91__wasm_instance, 29ull), 0u);
+
+#line 1013 "memory_init.wast"
+wasm2c_memory__init__92__wasm_instantiate(&memory__init__92__wasm_instance);
+
+#line 1024 "memory_init.wast"
+w2c_memory__init__92__wasm_test(&memory__init__92__wasm_instance);
+
+#line 1026 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 0ull), 0u);
+
+#line 1027 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 1ull), 0u);
+
+#line 1028 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 2ull), 3u);
+
+#line 1029 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 3ull), 1u);
+
+#line 1030 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 4ull), 4u);
+
+#line 1031 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 5ull), 1u);
+
+#line 1032 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 6ull), 0u);
+
+#line 1033 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 7ull), 2u);
+
+#line 1034 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 8ull), 7u);
+
+#line 1035 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 9ull), 1u);
+
+#line 1036 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 10ull), 8u);
+
+#line 1037 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 11ull), 0u);
+
+#line 1038 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 12ull), 7u);
+
+#line 1039 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 13ull), 5u);
+
+#line 1040 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 14ull), 2u);
+
+#line 1041 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 15ull), 3u);
+
+#line 1042 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 16ull), 6u);
+
+#line 1043 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 17ull), 0u);
+
+#line 1044 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 18ull), 0u);
+
+#line 1045 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 19ull), 0u);
+
+#line 1046 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 20ull), 0u);
+
+#line 1047 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 21ull), 0u);
+
+#line 1048 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 22ull), 0u);
+
+#line 1049 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 23ull), 0u);
+
+#line 1050 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 24ull), 0u);
+
+#line 1051 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 25ull), 0u);
+
+#line 1052 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 26ull), 0u);
+
+#line 1053 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 27ull), 0u);
+
+#line 1054 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 28ull), 0u);
+
+#line 1055 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__92__wasm_load8_u(&memory__init__92__wasm_instance, 29ull), 0u);
+
+#line 1057 "memory_init.wast"
+wasm2c_memory__init__93__wasm_instantiate(&memory__init__93__wasm_instance);
+
+#line 1068 "memory_init.wast"
+w2c_memory__init__93__wasm_test(&memory__init__93__wasm_instance);
+
+#line 1070 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 0ull), 0u);
+
+#line 1071 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 1ull), 0u);
+
+#line 1072 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 2ull), 3u);
+
+#line 1073 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 3ull), 1u);
+
+#line 1074 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 4ull), 4u);
+
+#line 1075 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 5ull), 1u);
+
+#line 1076 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 6ull), 0u);
+
+#line 1077 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 7ull), 0u);
+
+#line 1078 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 8ull), 0u);
+
+#line 1079 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 9ull), 0u);
+
+#line 1080 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 10ull), 0u);
+
+#line 1081 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 11ull), 0u);
+
+#line 1082 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 12ull), 7u);
+
+#line 1083 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 13ull), 5u);
+
+#line 1084 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 14ull), 2u);
+
+#line 1085 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 15ull), 9u);
+
+#line 1086 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 16ull), 2u);
+
+#line 1087 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 17ull), 7u);
+
+#line 1088 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 18ull), 0u);
+
+#line 1089 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 19ull), 0u);
+
+#line 1090 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 20ull), 0u);
+
+#line 1091 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 21ull), 0u);
+
+#line 1092 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 22ull), 0u);
+
+#line 1093 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 23ull), 0u);
+
+#line 1094 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 24ull), 0u);
+
+#line 1095 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 25ull), 0u);
+
+#line 1096 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 26ull), 0u);
+
+#line 1097 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 27ull), 0u);
+
+#line 1098 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 28ull), 0u);
+
+#line 1099 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__93__wasm_load8_u(&memory__init__93__wasm_instance, 29ull), 0u);
+
+#line 1101 "memory_init.wast"
+wasm2c_memory__init__94__wasm_instantiate(&memory__init__94__wasm_instance);
+
+#line 1120 "memory_init.wast"
+w2c_memory__init__94__wasm_test(&memory__init__94__wasm_instance);
+
+#line 1122 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 0ull), 0u);
+
+#line 1123 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 1ull), 0u);
+
+#line 1124 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 2ull), 3u);
+
+#line 1125 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 3ull), 1u);
+
+#line 1126 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 4ull), 4u);
+
+#line 1127 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 5ull), 1u);
+
+#line 1128 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 6ull), 0u);
+
+#line 1129 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 7ull), 2u);
+
+#line 1130 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 8ull), 7u);
+
+#line 1131 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 9ull), 1u);
+
+#line 1132 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 10ull), 8u);
+
+#line 1133 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 11ull), 0u);
+
+#line 1134 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 12ull), 7u);
+
+#line 1135 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 13ull), 0u);
+
+#line 1136 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 14ull), 7u);
+
+#line 1137 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 15ull), 5u);
+
+#line 1138 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 16ull), 2u);
+
+#line 1139 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 17ull), 7u);
+
+#line 1140 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 18ull), 0u);
+
+#line 1141 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 19ull), 9u);
+
+#line 1142 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 20ull), 0u);
+
+#line 1143 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 21ull), 7u);
+
+#line 1144 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 22ull), 0u);
+
+#line 1145 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 23ull), 8u);
+
+#line 1146 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 24ull), 8u);
+
+#line 1147 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 25ull), 0u);
+
+#line 1148 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 26ull), 0u);
+
+#line 1149 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 27ull), 0u);
+
+#line 1150 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 28ull), 0u);
+
+#line 1151 "memory_init.wast"
+ASSERT_RETURN_I32(w2c_memory__init__94__wasm_load8_u(&memory__init__94__wasm_instance, 29ull), 0u);
+
+#line 1166 "memory_init.wast"
+wasm2c_memory__init__97__wasm_instantiate(&memory__init__97__wasm_instance);
+
+#line 1172 "memory_init.wast"
+w2c_memory__init__97__wasm_test(&memory__init__97__wasm_instance);
+
+#line 1174 "memory_init.wast"
+wasm2c_memory__init__98__wasm_instantiate(&memory__init__98__wasm_instance);
+
+#line 1180 "memory_init.wast"
+ASSERT_TRAP(w2c_memory__init__98__wasm_test(&memory__init__98__wasm_instance));
+
+#line 1182 "memory_init.wast"
+wasm2c_memory__init__99__wasm_instantiate(&memory__init__99__wasm_instance);
+
+#line 1187 "memory_init.wast"
+ASSERT_TRAP(w2c_memory__init__99__wasm_test(&memory__init__99__wasm_instance));
+
+#line 1203 "memory_init.wast"
+wasm2c_memory__init__102__wasm_instantiate(&memory__init__102__wasm_instance);
+
+#line 1209 "memory_init.wast"
+w2c_memory__init__102__wasm_test(&memory__init__102__wasm_instance);
+
+#line 1211 "memory_init.wast"
+wasm2c_memory__init__103__wasm_instantiate(&memory__init__103__wasm_instance);
+
+#line 1216 "memory_init.wast"
+ASSERT_TRAP(w2c_memory__init__103__wasm_test(&memory__init__103__wasm_instance));
+
+#line 1218 "memory_init.wast"
+wasm2c_memory__init__104__wasm_instantiate(&memory__init__104__wasm_instance);
+
+#line 1223 "memory_init.wast"
+ASSERT_TRAP(w2c_memory__init__104__wasm_test(&memory__init__104__wasm_instance));
+
+#line 1225 "memory_init.wast"
+wasm2c_memory__init__105__wasm_instantiate(&memory__init__105__wasm_instance);
+
+#line 1230 "memory_init.wast"
+ASSERT_TRAP(w2c_memory__init__105__wasm_test(&memory__init__105__wasm_instance));
+
+#line 1232 "memory_init.wast"
+wasm2c_memory__init__106__wasm_instantiate(&memory__init__106__wasm_instance);
+
+#line 1237 "memory_init.wast"
+ASSERT_TRAP(w2c_memory__init__106__wasm_test(&memory__init__106__wasm_instance));
+
+#line 1239 "memory_init.wast"
+wasm2c_memory__init__107__wasm_instantiate(&memory__init__107__wasm_instance);
+
+#line 1244 "memory_init.wast"
+w2c_memory__init__107__wasm_test(&memory__init__107__wasm_instance);
+
+#line 1246 "memory_init.wast"
+wasm2c_memory__init__108__wasm_instantiate(&memory__init__108__wasm_instance);
+
+#line 1251 "memory_init.wast"
+ASSERT_TRAP(w2c_memory__init__108__wasm_test(&memory__init__108__wasm_instance));
+
+#line 1253 "memory_init.wast"
+wasm2c_memory__init__109__wasm_instantiate(&memory__init__109__wasm_instance);
+
+#line 1258 "memory_init.wast"
+w2c_memory__init__109__wasm_test(&memory__init__109__wasm_instance);
+
+#line 1260 "memory_init.wast"
+wasm2c_memory__init__110__wasm_instantiate(&memory__init__110__wasm_instance);
+
+#line 1265 "memory_init.wast"
+w2c_memory__init__110__wasm_test(&memory__init__110__wasm_instance);
+
+#line 1267 "memory_init.wast"
+wasm2c_memory__init__111__wasm_instantiate(&memory__init__111__wasm_instance);
+
+#line 1272 "memory_init.wast"
+ASSERT_TRAP(w2c_memory__init__111__wasm_test(&memory__init__111__wasm_instance));
+
+#line 1778 "memory_init.wast"
+wasm2c_memory__init__175__wasm_instantiate(&memory__init__175__wasm_instance);
+
+#line 1796 "memory_init.wast"
+ASSERT_TRAP(w2c_memory__init__175__wasm_run(&memory__init__175__wasm_instance, 65528ull, 16u));
+
+#line 1799 "memory_init.wast"
+ASSERT_RETURN_I64(w2c_memory__init__175__wasm_checkRange(&memory__init__175__wasm_instance, 0ull, 1ull, 0u), 18446744073709551615ull);
+
+#line 1801 "memory_init.wast"
+wasm2c_memory__init__176__wasm_instantiate(&memory__init__176__wasm_instance);
+
+#line 1819 "memory_init.wast"
+ASSERT_TRAP(w2c_memory__init__176__wasm_run(&memory__init__176__wasm_instance, 65527ull, 16u));
+
+#line 1822 "memory_init.wast"
+ASSERT_RETURN_I64(w2c_memory__init__176__wasm_checkRange(&memory__init__176__wasm_instance, 0ull, 1ull, 0u), 18446744073709551615ull);
+
+#line 1824 "memory_init.wast"
+wasm2c_memory__init__177__wasm_instantiate(&memory__init__177__wasm_instance);
+
+#line 1842 "memory_init.wast"
+ASSERT_TRAP(w2c_memory__init__177__wasm_run(&memory__init__177__wasm_instance, 65472ull, 30u));
+
+#line 1845 "memory_init.wast"
+ASSERT_RETURN_I64(w2c_memory__init__177__wasm_checkRange(&memory__init__177__wasm_instance, 0ull, 1ull, 0u), 18446744073709551615ull);
+
+#line 1847 "memory_init.wast"
+wasm2c_memory__init__178__wasm_instantiate(&memory__init__178__wasm_instance);
+
+#line 1865 "memory_init.wast"
+ASSERT_TRAP(w2c_memory__init__178__wasm_run(&memory__init__178__wasm_instance, 65473ull, 31u));
+
+#line 1868 "memory_init.wast"
+ASSERT_RETURN_I64(w2c_memory__init__178__wasm_checkRange(&memory__init__178__wasm_instance, 0ull, 1ull, 0u), 18446744073709551615ull);
+
+#line 1870 "memory_init.wast"
+wasm2c_memory__init__179__wasm_instantiate(&memory__init__179__wasm_instance);
+
+#line 1888 "memory_init.wast"
+ASSERT_TRAP(w2c_memory__init__179__wasm_run(&memory__init__179__wasm_instance, 65528ull, 4294967040u));
+
+#line 1891 "memory_init.wast"
+ASSERT_RETURN_I64(w2c_memory__init__179__wasm_checkRange(&memory__init__179__wasm_instance, 0ull, 1ull, 0u), 18446744073709551615ull);
+
+#line 1893 "memory_init.wast"
+wasm2c_memory__init__180__wasm_instantiate(&memory__init__180__wasm_instance);
+
+#line 1911 "memory_init.wast"
+ASSERT_TRAP(w2c_memory__init__180__wasm_run(&memory__init__180__wasm_instance, 0ull, 4294967292u));
+
+#line 1914 "memory_init.wast"
+ASSERT_RETURN_I64(w2c_memory__init__180__wasm_checkRange(&memory__init__180__wasm_instance, 0ull, 1ull, 0u), 18446744073709551615ull);
+
+#line 1917 "memory_init.wast"
+wasm2c_memory__init__181__wasm_instantiate(&memory__init__181__wasm_instance);
+
+
+}
+
+void run_spec_tests(void) {
+
+run_spec_tests_0();
+wasm2c_memory__init__0__wasm_free(&memory__init__0__wasm_instance);
+wasm2c_memory__init__1__wasm_free(&memory__init__1__wasm_instance);
+wasm2c_memory__init__2__wasm_free(&memory__init__2__wasm_instance);
+wasm2c_memory__init__3__wasm_free(&memory__init__3__wasm_instance);
+wasm2c_memory__init__6__wasm_free(&memory__init__6__wasm_instance);
+wasm2c_memory__init__7__wasm_free(&memory__init__7__wasm_instance);
+wasm2c_memory__init__8__wasm_free(&memory__init__8__wasm_instance);
+wasm2c_memory__init__11__wasm_free(&memory__init__11__wasm_instance);
+wasm2c_memory__init__12__wasm_free(&memory__init__12__wasm_instance);
+wasm2c_memory__init__13__wasm_free(&memory__init__13__wasm_instance);
+wasm2c_memory__init__14__wasm_free(&memory__init__14__wasm_instance);
+wasm2c_memory__init__15__wasm_free(&memory__init__15__wasm_instance);
+wasm2c_memory__init__16__wasm_free(&memory__init__16__wasm_instance);
+wasm2c_memory__init__17__wasm_free(&memory__init__17__wasm_instance);
+wasm2c_memory__init__18__wasm_free(&memory__init__18__wasm_instance);
+wasm2c_memory__init__19__wasm_free(&memory__init__19__wasm_instance);
+wasm2c_memory__init__20__wasm_free(&memory__init__20__wasm_instance);
+wasm2c_memory__init__84__wasm_free(&memory__init__84__wasm_instance);
+wasm2c_memory__init__85__wasm_free(&memory__init__85__wasm_instance);
+wasm2c_memory__init__86__wasm_free(&memory__init__86__wasm_instance);
+wasm2c_memory__init__87__wasm_free(&memory__init__87__wasm_instance);
+wasm2c_memory__init__88__wasm_free(&memory__init__88__wasm_instance);
+wasm2c_memory__init__89__wasm_free(&memory__init__89__wasm_instance);
+wasm2c_memory__init__90__wasm_free(&memory__init__90__wasm_instance);
+wasm2c_memory__init__91__wasm_free(&memory__init__91__wasm_instance);
+wasm2c_memory__init__92__wasm_free(&memory__init__92__wasm_instance);
+wasm2c_memory__init__93__wasm_free(&memory__init__93__wasm_instance);
+wasm2c_memory__init__94__wasm_free(&memory__init__94__wasm_instance);
+wasm2c_memory__init__97__wasm_free(&memory__init__97__wasm_instance);
+wasm2c_memory__init__98__wasm_free(&memory__init__98__wasm_instance);
+wasm2c_memory__init__99__wasm_free(&memory__init__99__wasm_instance);
+wasm2c_memory__init__102__wasm_free(&memory__init__102__wasm_instance);
+wasm2c_memory__init__103__wasm_free(&memory__init__103__wasm_instance);
+wasm2c_memory__init__104__wasm_free(&memory__init__104__wasm_instance);
+wasm2c_memory__init__105__wasm_free(&memory__init__105__wasm_instance);
+wasm2c_memory__init__106__wasm_free(&memory__init__106__wasm_instance);
+wasm2c_memory__init__107__wasm_free(&memory__init__107__wasm_instance);
+wasm2c_memory__init__108__wasm_free(&memory__init__108__wasm_instance);
+wasm2c_memory__init__109__wasm_free(&memory__init__109__wasm_instance);
+wasm2c_memory__init__110__wasm_free(&memory__init__110__wasm_instance);
+wasm2c_memory__init__111__wasm_free(&memory__init__111__wasm_instance);
+wasm2c_memory__init__175__wasm_free(&memory__init__175__wasm_instance);
+wasm2c_memory__init__176__wasm_free(&memory__init__176__wasm_instance);
+wasm2c_memory__init__177__wasm_free(&memory__init__177__wasm_instance);
+wasm2c_memory__init__178__wasm_free(&memory__init__178__wasm_instance);
+wasm2c_memory__init__179__wasm_free(&memory__init__179__wasm_instance);
+wasm2c_memory__init__180__wasm_free(&memory__init__180__wasm_instance);
+wasm2c_memory__init__181__wasm_free(&memory__init__181__wasm_instance);
+
+}
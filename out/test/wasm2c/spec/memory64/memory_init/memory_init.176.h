@@ -0,0 +1,46 @@
+/* Automatically generated by wasm2c */
+#ifndef MEMORY_INIT_176_H_GENERATED_
+#define MEMORY_INIT_176_H_GENERATED_
+
+#include "wasm-rt.h"
+
+#include <stdint.h>
+
+#ifndef WASM_RT_CORE_TYPES_DEFINED
+#define WASM_RT_CORE_TYPES_DEFINED
+typedef uint8_t u8;
+typedef int8_t s8;
+typedef uint16_t u16;
+typedef int16_t s16;
+typedef uint32_t u32;
+typedef int32_t s32;
+typedef uint64_t u64;
+typedef int64_t s64;
+typedef float f32;
+typedef double f64;
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct w2c_memory__init__176__wasm {
+  wasm_rt_memory_t w2c_M0;
+  bool data_segment_dropped_w2c_memory__init__176__wasm_d0 : 1;
+} w2c_memory__init__176__wasm;
+
+void wasm2c_memory__init__176__wasm_instantiate(w2c_memory__init__176__wasm*);
+void wasm2c_memory__init__176__wasm_free(w2c_memory__init__176__wasm*);
+wasm_rt_func_type_t wasm2c_memory__init__176__wasm_get_func_type(uint32_t param_count, uint32_t result_count, ...);
+
+/* export: 'checkRange' */
+u64 w2c_memory__init__176__wasm_checkRange(w2c_memory__init__176__wasm*, u64, u64, u32);
+
+/* export: 'run' */
+void w2c_memory__init__176__wasm_run(w2c_memory__init__176__wasm*, u64, u32);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* MEMORY_INIT_176_H_GENERATED_ */
@@ -0,0 +1,108 @@
+/* Automatically generated by wasm2c */
+#ifndef MEMORY_TRAP64_1_H_GENERATED_
+#define MEMORY_TRAP64_1_H_GENERATED_
+
+#include "wasm-rt.h"
+
+#include <stdint.h>
+
+#ifndef WASM_RT_CORE_TYPES_DEFINED
+#define WASM_RT_CORE_TYPES_DEFINED
+typedef uint8_t u8;
+typedef int8_t s8;
+typedef uint16_t u16;
+typedef int16_t s16;
+typedef uint32_t u32;
+typedef int32_t s32;
+typedef uint64_t u64;
+typedef int64_t s64;
+typedef float f32;
+typedef double f64;
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct w2c_memory__trap64__1__wasm {
+  wasm_rt_memory_t w2c_M0;
+} w2c_memory__trap64__1__wasm;
+
+void wasm2c_memory__trap64__1__wasm_instantiate(w2c_memory__trap64__1__wasm*);
+void wasm2c_memory__trap64__1__wasm_free(w2c_memory__trap64__1__wasm*);
+wasm_rt_func_type_t wasm2c_memory__trap64__1__wasm_get_func_type(uint32_t param_count, uint32_t result_count, ...);
+
+/* export: 'i32.load' */
+u32 w2c_memory__trap64__1__wasm_i320x2Eload(w2c_memory__trap64__1__wasm*, u64);
+
+/* export: 'i64.load' */
+u64 w2c_memory__trap64__1__wasm_i640x2Eload(w2c_memory__trap64__1__wasm*, u64);
+
+/* export: 'f32.load' */
+f32 w2c_memory__trap64__1__wasm_f320x2Eload(w2c_memory__trap64__1__wasm*, u64);
+
+/* export: 'f64.load' */
+f64 w2c_memory__trap64__1__wasm_f640x2Eload(w2c_memory__trap64__1__wasm*, u64);
+
+/* export: 'i32.load8_s' */
+u32 w2c_memory__trap64__1__wasm_i320x2Eload8_s(w2c_memory__trap64__1__wasm*, u64);
+
+/* export: 'i32.load8_u' */
+u32 w2c_memory__trap64__1__wasm_i320x2Eload8_u(w2c_memory__trap64__1__wasm*, u64);
+
+/* export: 'i32.load16_s' */
+u32 w2c_memory__trap64__1__wasm_i320x2Eload16_s(w2c_memory__trap64__1__wasm*, u64);
+
+/* export: 'i32.load16_u' */
+u32 w2c_memory__trap64__1__wasm_i320x2Eload16_u(w2c_memory__trap64__1__wasm*, u64);
+
+/* export: 'i64.load8_s' */
+u64 w2c_memory__trap64__1__wasm_i640x2Eload8_s(w2c_memory__trap64__1__wasm*, u64);
+
+/* export: 'i64.load8_u' */
+u64 w2c_memory__trap64__1__wasm_i640x2Eload8_u(w2c_memory__trap64__1__wasm*, u64);
+
+/* export: 'i64.load16_s' */
+u64 w2c_memory__trap64__1__wasm_i640x2Eload16_s(w2c_memory__trap64__1__wasm*, u64);
+
+/* export: 'i64.load16_u' */
+u64 w2c_memory__trap64__1__wasm_i640x2Eload16_u(w2c_memory__trap64__1__wasm*, u64);
+
+/* export: 'i64.load32_s' */
+u64 w2c_memory__trap64__1__wasm_i640x2Eload32_s(w2c_memory__trap64__1__wasm*, u64);
+
+/* export: 'i64.load32_u' */
+u64 w2c_memory__trap64__1__wasm_i640x2Eload32_u(w2c_memory__trap64__1__wasm*, u64);
+
+/* export: 'i32.store' */
+void w2c_memory__trap64__1__wasm_i320x2Estore(w2c_memory__trap64__1__wasm*, u64, u32);
+
+/* export: 'i64.store' */
+void w2c_memory__trap64__1__wasm_i640x2Estore(w2c_memory__trap64__1__wasm*, u64, u64);
+
+/* export: 'f32.store' */
+void w2c_memory__trap64__1__wasm_f320x2Estore(w2c_memory__trap64__1__wasm*, u64, f32);
+
+/* export: 'f64.store' */
+void w2c_memory__trap64__1__wasm_f640x2Estore(w2c_memory__trap64__1__wasm*, u64, f64);
+
+/* export: 'i32.store8' */
+void w2c_memory__trap64__1__wasm_i320x2Estore8(w2c_memory__trap64__1__wasm*, u64, u32);
+
+/* export: 'i32.store16' */
+void w2c_memory__trap64__1__wasm_i320x2Estore16(w2c_memory__trap64__1__wasm*, u64, u32);
+
+/* export: 'i64.store8' */
+void w2c_memory__trap64__1__wasm_i640x2Estore8(w2c_memory__trap64__1__wasm*, u64, u64);
+
+/* export: 'i64.store16' */
+void w2c_memory__trap64__1__wasm_i640x2Estore16(w2c_memory__trap64__1__wasm*, u64, u64);
+
+/* export: 'i64.store32' */
+void w2c_memory__trap64__1__wasm_i640x2Estore32(w2c_memory__trap64__1__wasm*, u64, u64);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* MEMORY_TRAP64_1_H_GENERATED_ */
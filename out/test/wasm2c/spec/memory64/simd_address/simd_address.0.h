@@ -0,0 +1,81 @@
+/* Automatically generated by wasm2c */
+#ifndef SIMD_ADDRESS_0_H_GENERATED_
+#define SIMD_ADDRESS_0_H_GENERATED_
+
+#include "wasm-rt.h"
+#include <simde/wasm/simd128.h>
+
+#ifndef WASM_RT_SIMD_TYPE_DEFINED
+#define WASM_RT_SIMD_TYPE_DEFINED
+typedef simde_v128_t v128;
+#endif
+
+#include <stdint.h>
+
+#ifndef WASM_RT_CORE_TYPES_DEFINED
+#define WASM_RT_CORE_TYPES_DEFINED
+typedef uint8_t u8;
+typedef int8_t s8;
+typedef uint16_t u16;
+typedef int16_t s16;
+typedef uint32_t u32;
+typedef int32_t s32;
+typedef uint64_t u64;
+typedef int64_t s64;
+typedef float f32;
+typedef double f64;
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct w2c_simd__address__0__wasm {
+  wasm_rt_memory_t w2c_M0;
+} w2c_simd__address__0__wasm;
+
+void wasm2c_simd__address__0__wasm_instantiate(w2c_simd__address__0__wasm*);
+void wasm2c_simd__address__0__wasm_free(w2c_simd__address__0__wasm*);
+wasm_rt_func_type_t wasm2c_simd__address__0__wasm_get_func_type(uint32_t param_count, uint32_t result_count, ...);
+
+/* export: 'load_data_1' */
+v128 w2c_simd__address__0__wasm_load_data_1(w2c_simd__address__0__wasm*, u32);
+
+/* export: 'load_data_2' */
+v128 w2c_simd__address__0__wasm_load_data_2(w2c_simd__address__0__wasm*, u32);
+
+/* export: 'load_data_3' */
+v128 w2c_simd__address__0__wasm_load_data_3(w2c_simd__address__0__wasm*, u32);
+
+/* export: 'load_data_4' */
+v128 w2c_simd__address__0__wasm_load_data_4(w2c_simd__address__0__wasm*, u32);
+
+/* export: 'load_data_5' */
+v128 w2c_simd__address__0__wasm_load_data_5(w2c_simd__address__0__wasm*, u32);
+
+/* export: 'store_data_0' */
+v128 w2c_simd__address__0__wasm_store_data_0(w2c_simd__address__0__wasm*);
+
+/* export: 'store_data_1' */
+v128 w2c_simd__address__0__wasm_store_data_1(w2c_simd__address__0__wasm*);
+
+/* export: 'store_data_2' */
+v128 w2c_simd__address__0__wasm_store_data_2(w2c_simd__address__0__wasm*);
+
+/* export: 'store_data_3' */
+v128 w2c_simd__address__0__wasm_store_data_3(w2c_simd__address__0__wasm*);
+
+/* export: 'store_data_4' */
+v128 w2c_simd__address__0__wasm_store_data_4(w2c_simd__address__0__wasm*);
+
+/* export: 'store_data_5' */
+v128 w2c_simd__address__0__wasm_store_data_5(w2c_simd__address__0__wasm*);
+
+/* export: 'store_data_6' */
+void w2c_simd__address__0__wasm_store_data_6(w2c_simd__address__0__wasm*, u32);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* SIMD_ADDRESS_0_H_GENERATED_ */
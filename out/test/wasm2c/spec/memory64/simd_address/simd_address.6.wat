@@ -0,0 +1 @@
+(memory 1)(func (v128.store offset=4294967296 (i32.const 0) (v128.const i32x4 0 0 0 0)))
\ No newline at end of file
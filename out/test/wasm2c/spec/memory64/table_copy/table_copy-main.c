@@ -0,0 +1,6055 @@
+#include "table_copy.0.h"
+#include "table_copy.1.h"
+#include "table_copy.2.h"
+#include "table_copy.3.h"
+#include "table_copy.4.h"
+#include "table_copy.5.h"
+#include "table_copy.6.h"
+#include "table_copy.7.h"
+#include "table_copy.8.h"
+#include "table_copy.9.h"
+#include "table_copy.10.h"
+#include "table_copy.11.h"
+#include "table_copy.12.h"
+#include "table_copy.13.h"
+#include "table_copy.14.h"
+#include "table_copy.15.h"
+#include "table_copy.16.h"
+#include "table_copy.17.h"
+#include "table_copy.18.h"
+#include "table_copy.19.h"
+#include "table_copy.20.h"
+#include "table_copy.21.h"
+#include "table_copy.22.h"
+#include "table_copy.23.h"
+#include "table_copy.24.h"
+#include "table_copy.25.h"
+#include "table_copy.26.h"
+#include "table_copy.27.h"
+#include "table_copy.28.h"
+#include "table_copy.29.h"
+#include "table_copy.30.h"
+#include "table_copy.31.h"
+#include "table_copy.32.h"
+#include "table_copy.33.h"
+#include "table_copy.34.h"
+#include "table_copy.35.h"
+#include "table_copy.36.h"
+#include "table_copy.37.h"
+#include "table_copy.38.h"
+#include "table_copy.39.h"
+#include "table_copy.40.h"
+#include "table_copy.41.h"
+#include "table_copy.42.h"
+#include "table_copy.43.h"
+#include "table_copy.44.h"
+#include "table_copy.45.h"
+#include "table_copy.46.h"
+#include "table_copy.47.h"
+#include "table_copy.48.h"
+#include "table_copy.49.h"
+#include "table_copy.50.h"
+#include "table_copy.51.h"
+#include "table_copy.52.h"
+#include "table_copy.53.h"
+#include "table_copy.54.h"
+#include "table_copy.55.h"
+#include "table_copy.56.h"
+#include "table_copy.57.h"
+#include "table_copy.58.h"
+#include "table_copy.59.h"
+#include "table_copy.60.h"
+#include "table_copy.61.h"
+#include "table_copy.62.h"
+#include "table_copy.63.h"
+#include "table_copy.64.h"
+#include "table_copy.65.h"
+#include "table_copy.66.h"
+#include "table_copy.67.h"
+#include "table_copy.68.h"
+#include "table_copy.69.h"
+#include "table_copy.70.h"
+#include "table_copy.71.h"
+#include "table_copy.72.h"
+#include "table_copy.73.h"
+#include <assert.h>
+#define __STDC_FORMAT_MACROS
+#include <inttypes.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "wasm-rt.h"
+#include "wasm-rt-impl.h"
+#include "wasm-rt-exceptions.h"
+
+/* NOTE: function argument evaluation order is implementation-defined in C,
+   so it SHOULD NOT be relied on by tests. */
+#if WABT_BIG_ENDIAN
+#define v128_i8x16_make(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p) \
+	simde_wasm_i8x16_make(p,o,n,m,l,k,j,i,h,g,f,e,d,c,b,a)
+#define v128_u8x16_make(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p) \
+	simde_wasm_u8x16_make(p,o,n,m,l,k,j,i,h,g,f,e,d,c,b,a)
+#define v128_i16x8_make(a,b,c,d,e,f,g,h) simde_wasm_i16x8_make(h,g,f,e,d,c,b,a)
+#define v128_u16x8_make(a,b,c,d,e,f,g,h) simde_wasm_u16x8_make(h,g,f,e,d,c,b,a)
+#define v128_i32x4_make(a,b,c,d) simde_wasm_i32x4_make(d,c,b,a)
+#define v128_u32x4_make(a,b,c,d) simde_wasm_u32x4_make(d,c,b,a)
+#define v128_i64x2_make(a,b) simde_wasm_i64x2_make(b,a)
+#define v128_u64x2_make(a,b) simde_wasm_u64x2_make(b,a)
+#define v128_f32x4_make(a,b,c,d) simde_wasm_f32x4_make(d,c,b,a)
+#define v128_f64x2_make(a,b) simde_wasm_f64x2_make(b,a)
+#define v128_i8x16_extract_lane(a,n) simde_wasm_u8x16_extract_lane(a,15-(n))
+#define v128_u8x16_extract_lane(a,n) simde_wasm_u8x16_extract_lane(a,15-(n))
+#define v128_i16x8_extract_lane(a,n) simde_wasm_u16x8_extract_lane(a,7-(n))
+#define v128_u16x8_extract_lane(a,n) simde_wasm_u16x8_extract_lane(a,7-(n))
+#define v128_i32x4_extract_lane(a,n) simde_wasm_u32x4_extract_lane(a,3-(n))
+#define v128_u32x4_extract_lane(a,n) simde_wasm_u32x4_extract_lane(a,3-(n))
+#define v128_i64x2_extract_lane(a,n) simde_wasm_u64x2_extract_lane(a,1-(n))
+#define v128_u64x2_extract_lane(a,n) simde_wasm_u64x2_extract_lane(a,1-(n))
+#define v128_f32x4_extract_lane(a,n) simde_wasm_f32x4_extract_lane(a,3-(n))
+#define v128_f64x2_extract_lane(a,n) simde_wasm_f64x2_extract_lane(a,1-(n))
+#else
+#define v128_i8x16_make simde_wasm_i8x16_make
+#define v128_u8x16_make simde_wasm_u8x16_make
+#define v128_i16x8_make simde_wasm_i16x8_make
+#define v128_u16x8_make simde_wasm_u16x8_make
+#define v128_i32x4_make simde_wasm_i32x4_make
+#define v128_u32x4_make simde_wasm_u32x4_make
+#define v128_i64x2_make simde_wasm_i64x2_make
+#define v128_u64x2_make simde_wasm_u64x2_make
+#define v128_f32x4_make simde_wasm_f32x4_make
+#define v128_f64x2_make simde_wasm_f64x2_make
+// like is_equal_TYPE below, always use unsigned for these
+#define v128_i8x16_extract_lane simde_wasm_u8x16_extract_lane
+#define v128_u8x16_extract_lane simde_wasm_u8x16_extract_lane
+#define v128_i16x8_extract_lane simde_wasm_u16x8_extract_lane
+#define v128_u16x8_extract_lane simde_wasm_u16x8_extract_lane
+#define v128_i32x4_extract_lane simde_wasm_u32x4_extract_lane
+#define v128_u32x4_extract_lane simde_wasm_u32x4_extract_lane
+#define v128_i64x2_extract_lane simde_wasm_u64x2_extract_lane
+#define v128_u64x2_extract_lane simde_wasm_u64x2_extract_lane
+#define v128_f32x4_extract_lane simde_wasm_f32x4_extract_lane
+#define v128_f64x2_extract_lane simde_wasm_f64x2_extract_lane
+#endif
+
+static int g_tests_run;
+static int g_tests_passed;
+
+static void run_spec_tests(void);
+
+static void error(const char* file, int line, const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  fprintf(stderr, "%s:%d: assertion failed: ", file, line);
+  vfprintf(stderr, format, args);
+  va_end(args);
+}
+
+#define ASSERT_EXCEPTION(f)                                               \
+  do {                                                                    \
+    g_tests_run++;                                                        \
+    if (wasm_rt_impl_try() == WASM_RT_TRAP_UNCAUGHT_EXCEPTION) {          \
+      g_tests_passed++;                                                   \
+    } else {                                                              \
+      (void)(f);                                                          \
+      error(__FILE__, __LINE__, "expected " #f " to throw exception.\n"); \
+    }                                                                     \
+  } while (0)
+
+#define ASSERT_TRAP(f)                                         \
+  do {                                                         \
+    g_tests_run++;                                             \
+    if (wasm_rt_impl_try() != 0) {                             \
+      g_tests_passed++;                                        \
+    } else {                                                   \
+      (void)(f);                                               \
+      error(__FILE__, __LINE__, "expected " #f " to trap.\n"); \
+    }                                                          \
+  } while (0)
+
+#define ASSERT_EXHAUSTION(f)                                     \
+  do {                                                           \
+    g_tests_run++;                                               \
+    wasm_rt_trap_t code = wasm_rt_impl_try();                    \
+    switch (code) {                                              \
+      case WASM_RT_TRAP_NONE:                                    \
+        (void)(f);                                               \
+        error(__FILE__, __LINE__, "expected " #f " to trap.\n"); \
+        break;                                                   \
+      case WASM_RT_TRAP_EXHAUSTION:                              \
+        g_tests_passed++;                                        \
+        break;                                                   \
+      default:                                                   \
+        error(__FILE__, __LINE__,                                \
+              "expected " #f                                     \
+              " to trap due to exhaustion, got trap code %d.\n", \
+              code);                                             \
+        break;                                                   \
+    }                                                            \
+  } while (0)
+
+#define ASSERT_RETURN(f)                               \
+  do {                                                 \
+    g_tests_run++;                                     \
+    int trap_code = wasm_rt_impl_try();                \
+    if (trap_code) {                                   \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n", \
+            wasm_rt_strerror(trap_code));              \
+    } else {                                           \
+      f;                                               \
+      g_tests_passed++;                                \
+    }                                                  \
+  } while (0)
+
+#define ASSERT_RETURN_T(type, fmt, f, expected)                          \
+  do {                                                                   \
+    g_tests_run++;                                                       \
+    int trap_code = wasm_rt_impl_try();                                  \
+    if (trap_code) {                                                     \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                   \
+            wasm_rt_strerror(trap_code));                                \
+    } else {                                                             \
+      type actual = f;                                                   \
+      if (is_equal_##type(actual, expected)) {                           \
+        g_tests_passed++;                                                \
+      } else {                                                           \
+        error(__FILE__, __LINE__,                                        \
+              "in " #f ": expected %" fmt ", got %" fmt ".\n", expected, \
+              actual);                                                   \
+      }                                                                  \
+    }                                                                    \
+  } while (0)
+
+#define ASSERT_RETURN_FUNCREF(f, expected)                                \
+  do {                                                                    \
+    g_tests_run++;                                                        \
+    int trap_code = wasm_rt_impl_try();                                   \
+    if (trap_code) {                                                      \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                    \
+            wasm_rt_strerror(trap_code));                                 \
+    } else {                                                              \
+      wasm_rt_funcref_t actual = f;                                       \
+      if (is_equal_wasm_rt_funcref_t(actual, expected)) {                 \
+        g_tests_passed++;                                                 \
+      } else {                                                            \
+        error(__FILE__, __LINE__,                                         \
+              "in " #f ": mismatch between expected and actual funcref"); \
+      }                                                                   \
+    }                                                                     \
+  } while (0)
+
+#define ASSERT_RETURN_EXNREF(f, expected)                                \
+  do {                                                                   \
+    g_tests_run++;                                                       \
+    int trap_code = wasm_rt_impl_try();                                  \
+    if (trap_code) {                                                     \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                   \
+            wasm_rt_strerror(trap_code));                                \
+    } else {                                                             \
+      wasm_rt_exnref_t actual = f;                                       \
+      if (is_equal_wasm_rt_exnref_t(actual, expected)) {                 \
+        g_tests_passed++;                                                \
+      } else {                                                           \
+        error(__FILE__, __LINE__,                                        \
+              "in " #f ": mismatch between expected and actual exnref"); \
+      }                                                                  \
+    }                                                                    \
+  } while (0)
+
+#define ASSERT_RETURN_NAN_T(type, itype, fmt, f, kind)                        \
+  do {                                                                        \
+    g_tests_run++;                                                            \
+    int trap_code = wasm_rt_impl_try();                                       \
+    if (trap_code) {                                                          \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                        \
+            wasm_rt_strerror(trap_code));                                     \
+    } else {                                                                  \
+      type actual = f;                                                        \
+      itype iactual;                                                          \
+      memcpy(&iactual, &actual, sizeof(iactual));                             \
+      if (is_##kind##_nan_##type(iactual)) {                                  \
+        g_tests_passed++;                                                     \
+      } else {                                                                \
+        error(__FILE__, __LINE__,                                             \
+              "in " #f ": expected result to be a " #kind " nan, got 0x%" fmt \
+              ".\n",                                                          \
+              iactual);                                                       \
+      }                                                                       \
+    }                                                                         \
+  } while (0)
+
+#define MULTI_T_UNPACK_(...) __VA_ARGS__
+#define MULTI_T_UNPACK(arg) MULTI_T_UNPACK_ arg
+#define MULTI_i8 "%" PRIu8 " "
+#define MULTI_i16 "%" PRIu16 " "
+#define MULTI_i32 "%u "
+#define MULTI_i64 "%" PRIu64 " "
+#define MULTI_f32 "%.9g "
+#define MULTI_f64 "%.17g "
+#define MULTI_str "%s "
+#define ASSERT_RETURN_MULTI_T(type, fmt_expected, fmt_got, f, compare,        \
+                              expected, found)                                \
+  do {                                                                        \
+    g_tests_run++;                                                            \
+    int trap_code = wasm_rt_impl_try();                                       \
+    if (trap_code) {                                                          \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                        \
+            wasm_rt_strerror(trap_code));                                     \
+    } else {                                                                  \
+      type actual = f;                                                        \
+      if (compare) {                                                          \
+        g_tests_passed++;                                                     \
+      } else {                                                                \
+        error(__FILE__, __LINE__,                                             \
+              "in " #f ": expected <" fmt_expected ">, got <" fmt_got ">.\n", \
+              MULTI_T_UNPACK(expected), MULTI_T_UNPACK(found));               \
+      }                                                                       \
+    }                                                                         \
+  } while (0)
+
+
+#define ASSERT_RETURN_I32(f, expected) ASSERT_RETURN_T(u32, "u", f, expected)
+#define ASSERT_RETURN_I64(f, expected) ASSERT_RETURN_T(u64, PRIu64, f, expected)
+#define ASSERT_RETURN_F32(f, expected) ASSERT_RETURN_T(f32, ".9g", f, expected)
+#define ASSERT_RETURN_F64(f, expected) ASSERT_RETURN_T(f64, ".17g", f, expected)
+#define ASSERT_RETURN_EXTERNREF(f, expected) \
+  ASSERT_RETURN_T(wasm_rt_externref_t, "p", f, expected);
+
+#define ASSERT_RETURN_CANONICAL_NAN_F32(f) \
+  ASSERT_RETURN_NAN_T(f32, u32, "08x", f, canonical)
+#define ASSERT_RETURN_CANONICAL_NAN_F64(f) \
+  ASSERT_RETURN_NAN_T(f64, u64, "016x", f, canonical)
+#define ASSERT_RETURN_ARITHMETIC_NAN_F32(f) \
+  ASSERT_RETURN_NAN_T(f32, u32, "08x", f, arithmetic)
+#define ASSERT_RETURN_ARITHMETIC_NAN_F64(f) \
+  ASSERT_RETURN_NAN_T(f64, u64, "016x", f, arithmetic)
+
+static bool is_equal_u8(u8 x, u8 y) {
+  return x == y;
+}
+
+static bool is_equal_u16(u16 x, u16 y) {
+  return x == y;
+}
+
+static bool is_equal_u32(u32 x, u32 y) {
+  return x == y;
+}
+
+static bool is_equal_u64(u64 x, u64 y) {
+  return x == y;
+}
+
+#define is_equal_i8 is_equal_u8
+#define is_equal_i16 is_equal_u16
+#define is_equal_i32 is_equal_u32
+#define is_equal_i64 is_equal_u64
+
+static bool is_equal_wasm_rt_externref_t(wasm_rt_externref_t x,
+                                         wasm_rt_externref_t y) {
+  return x == y;
+}
+
+static inline bool is_equal_wasm_rt_func_type_t(const wasm_rt_func_type_t a,
+                                                const wasm_rt_func_type_t b) {
+  return (a == b) || (a && b && !memcmp(a, b, 32));
+}
+
+static bool is_equal_wasm_rt_funcref_t(wasm_rt_funcref_t x,
+                                       wasm_rt_funcref_t y) {
+  return is_equal_wasm_rt_func_type_t(x.func_type, y.func_type) &&
+         (x.func == y.func) && (x.module_instance == y.module_instance);
+}
+
+#ifdef WASM_EXN_MAX_SIZE
+static bool is_equal_wasm_rt_exnref_t(wasm_rt_exnref_t x, wasm_rt_exnref_t y) {
+  return x.tag == y.tag && x.size == y.size && !memcmp(x.data, y.data, x.size);
+}
+#endif
+
+wasm_rt_externref_t spectest_make_externref(uintptr_t x) {
+  return (wasm_rt_externref_t)(x + 1);  // externref(0) is not null
+}
+
+static u32 f32_bits(f32 x) {
+  u32 ux;
+  memcpy(&ux, &x, sizeof(ux));
+  return ux;
+}
+
+static u64 f64_bits(f64 x) {
+  u64 ux;
+  memcpy(&ux, &x, sizeof(ux));
+  return ux;
+}
+
+static bool is_equal_f32(f32 x, f32 y) {
+  return f32_bits(x) == f32_bits(y);
+}
+
+static bool is_equal_f64(f64 x, f64 y) {
+  return f64_bits(x) == f64_bits(y);
+}
+
+static f32 make_nan_f32(u32 x) {
+  x |= 0x7f800000;
+  f32 res;
+  memcpy(&res, &x, sizeof(res));
+  return res;
+}
+
+static f64 make_nan_f64(u64 x) {
+  x |= 0x7ff0000000000000;
+  f64 res;
+  memcpy(&res, &x, sizeof(res));
+  return res;
+}
+
+static bool is_canonical_nan_f32(u32 x) {
+  return (x & 0x7fffffff) == 0x7fc00000;
+}
+
+static bool is_canonical_nan_f64(u64 x) {
+  return (x & 0x7fffffffffffffff) == 0x7ff8000000000000;
+}
+
+static bool is_arithmetic_nan_f32(u32 x) {
+  return (x & 0x7fc00000) == 0x7fc00000;
+}
+
+static bool is_arithmetic_nan_f64(u64 x) {
+  return (x & 0x7ff8000000000000) == 0x7ff8000000000000;
+}
+
+typedef struct w2c_spectest {
+  wasm_rt_funcref_table_t spectest_table;
+  wasm_rt_funcref_table_t spectest_table64;
+  wasm_rt_memory_t spectest_memory;
+  uint32_t spectest_global_i32;
+  uint64_t spectest_global_i64;
+  float spectest_global_f32;
+  double spectest_global_f64;
+} w2c_spectest;
+
+static w2c_spectest spectest_instance;
+
+/*
+ * spectest implementations
+ */
+void w2c_spectest_print(w2c_spectest* instance) {
+  printf("spectest.print()\n");
+}
+
+void w2c_spectest_print_i32(w2c_spectest* instance, uint32_t i) {
+  printf("spectest.print_i32(%d)\n", i);
+}
+
+void w2c_spectest_print_i64(w2c_spectest* instance, uint64_t i) {
+  printf("spectest.print_i64(%" PRIu64 ")\n", i);
+}
+
+void w2c_spectest_print_f32(w2c_spectest* instance, float f) {
+  printf("spectest.print_f32(%g)\n", f);
+}
+
+void w2c_spectest_print_i32_f32(w2c_spectest* instance, uint32_t i, float f) {
+  printf("spectest.print_i32_f32(%d %g)\n", i, f);
+}
+
+void w2c_spectest_print_f64(w2c_spectest* instance, double d) {
+  printf("spectest.print_f64(%g)\n", d);
+}
+
+void w2c_spectest_print_f64_f64(w2c_spectest* instance, double d1, double d2) {
+  printf("spectest.print_f64_f64(%g %g)\n", d1, d2);
+}
+
+wasm_rt_funcref_table_t* w2c_spectest_table(w2c_spectest* instance) {
+  return &instance->spectest_table;
+}
+
+wasm_rt_funcref_table_t* w2c_spectest_table64(w2c_spectest* instance) {
+  return &instance->spectest_table64;
+}
+
+wasm_rt_memory_t* w2c_spectest_memory(w2c_spectest* instance) {
+  return &instance->spectest_memory;
+}
+
+uint32_t* w2c_spectest_global_i32(w2c_spectest* instance) {
+  return &instance->spectest_global_i32;
+}
+
+uint64_t* w2c_spectest_global_i64(w2c_spectest* instance) {
+  return &instance->spectest_global_i64;
+}
+
+float* w2c_spectest_global_f32(w2c_spectest* instance) {
+  return &instance->spectest_global_f32;
+}
+
+double* w2c_spectest_global_f64(w2c_spectest* instance) {
+  return &instance->spectest_global_f64;
+}
+
+static void init_spectest_module(w2c_spectest* instance) {
+  instance->spectest_global_i32 = 666;
+  instance->spectest_global_i64 = 666l;
+  instance->spectest_global_f32 = 666.6;
+  instance->spectest_global_f64 = 666.6;
+  wasm_rt_allocate_memory(&instance->spectest_memory, 1, 2, false,
+                          WASM_DEFAULT_PAGE_SIZE);
+  wasm_rt_allocate_funcref_table(&instance->spectest_table, 10, 20);
+  wasm_rt_allocate_funcref_table(&instance->spectest_table64, 10, 20);
+}
+
+// POSIX-only test config where embedder handles signals instead of w2c runtime
+#ifdef WASM2C_TEST_EMBEDDER_SIGNAL_HANDLING
+#include <signal.h>
+
+static void posix_signal_handler(int sig, siginfo_t* si, void* unused) {
+  wasm_rt_trap((si->si_code == SEGV_ACCERR) ? WASM_RT_TRAP_OOB
+                                            : WASM_RT_TRAP_EXHAUSTION);
+}
+
+static void posix_install_signal_handler(void) {
+  /* install altstack */
+  stack_t ss;
+  ss.ss_sp = malloc(SIGSTKSZ);
+  ss.ss_flags = 0;
+  ss.ss_size = SIGSTKSZ;
+  if (sigaltstack(&ss, NULL) != 0) {
+    perror("sigaltstack failed");
+    abort();
+  }
+
+  /* install signal handler */
+  struct sigaction sa;
+  memset(&sa, '\0', sizeof(sa));
+  sa.sa_flags = SA_SIGINFO | SA_ONSTACK;
+  sigemptyset(&sa.sa_mask);
+  sa.sa_sigaction = posix_signal_handler;
+  if (sigaction(SIGSEGV, &sa, NULL) != 0 || sigaction(SIGBUS, &sa, NULL) != 0) {
+    perror("sigaction failed");
+    abort();
+  }
+}
+
+static void posix_cleanup_signal_handler(void) {
+  /* remove signal handler */
+  struct sigaction sa;
+  memset(&sa, '\0', sizeof(sa));
+  sa.sa_handler = SIG_DFL;
+  if (sigaction(SIGSEGV, &sa, NULL) != 0 || sigaction(SIGBUS, &sa, NULL)) {
+    perror("sigaction failed");
+    abort();
+  }
+
+  /* disable and free altstack */
+  stack_t ss;
+  ss.ss_flags = SS_DISABLE;
+  if (sigaltstack(&ss, NULL) != 0) {
+    perror("sigaltstack failed");
+    abort();
+  }
+  free(ss.ss_sp);
+}
+#endif
+
+int main(int argc, char** argv) {
+#ifdef WASM2C_TEST_EMBEDDER_SIGNAL_HANDLING
+  posix_install_signal_handler();
+#endif
+  wasm_rt_init();
+  init_spectest_module(&spectest_instance);
+  run_spec_tests();
+  printf("%u/%u tests passed.\n", g_tests_passed, g_tests_run);
+  wasm_rt_free();
+#ifdef WASM2C_TEST_EMBEDDER_SIGNAL_HANDLING
+  posix_cleanup_signal_handler();
+#endif
+  return g_tests_passed != g_tests_run;
+}
+
+w2c_a a_instance;
+w2c_table__copy__1__wasm table__copy__1__wasm_instance;
+w2c_table__copy__2__wasm table__copy__2__wasm_instance;
+w2c_table__copy__3__wasm table__copy__3__wasm_instance;
+w2c_table__copy__4__wasm table__copy__4__wasm_instance;
+w2c_table__copy__5__wasm table__copy__5__wasm_instance;
+w2c_table__copy__6__wasm table__copy__6__wasm_instance;
+w2c_table__copy__7__wasm table__copy__7__wasm_instance;
+w2c_table__copy__8__wasm table__copy__8__wasm_instance;
+w2c_table__copy__9__wasm table__copy__9__wasm_instance;
+w2c_table__copy__10__wasm table__copy__10__wasm_instance;
+w2c_table__copy__11__wasm table__copy__11__wasm_instance;
+w2c_table__copy__12__wasm table__copy__12__wasm_instance;
+w2c_table__copy__13__wasm table__copy__13__wasm_instance;
+w2c_table__copy__14__wasm table__copy__14__wasm_instance;
+w2c_table__copy__15__wasm table__copy__15__wasm_instance;
+w2c_table__copy__16__wasm table__copy__16__wasm_instance;
+w2c_table__copy__17__wasm table__copy__17__wasm_instance;
+w2c_table__copy__18__wasm table__copy__18__wasm_instance;
+w2c_table__copy__19__wasm table__copy__19__wasm_instance;
+w2c_table__copy__20__wasm table__copy__20__wasm_instance;
+w2c_table__copy__21__wasm table__copy__21__wasm_instance;
+w2c_table__copy__22__wasm table__copy__22__wasm_instance;
+w2c_table__copy__23__wasm table__copy__23__wasm_instance;
+w2c_table__copy__24__wasm table__copy__24__wasm_instance;
+w2c_table__copy__25__wasm table__copy__25__wasm_instance;
+w2c_table__copy__26__wasm table__copy__26__wasm_instance;
+w2c_table__copy__27__wasm table__copy__27__wasm_instance;
+w2c_table__copy__28__wasm table__copy__28__wasm_instance;
+w2c_table__copy__29__wasm table__copy__29__wasm_instance;
+w2c_table__copy__30__wasm table__copy__30__wasm_instance;
+w2c_table__copy__31__wasm table__copy__31__wasm_instance;
+w2c_table__copy__32__wasm table__copy__32__wasm_instance;
+w2c_table__copy__33__wasm table__copy__33__wasm_instance;
+w2c_table__copy__34__wasm table__copy__34__wasm_instance;
+w2c_table__copy__35__wasm table__copy__35__wasm_instance;
+w2c_table__copy__36__wasm table__copy__36__wasm_instance;
+w2c_table__copy__37__wasm table__copy__37__wasm_instance;
+w2c_table__copy__38__wasm table__copy__38__wasm_instance;
+w2c_table__copy__39__wasm table__copy__39__wasm_instance;
+w2c_table__copy__40__wasm table__copy__40__wasm_instance;
+w2c_table__copy__41__wasm table__copy__41__wasm_instance;
+w2c_table__copy__42__wasm table__copy__42__wasm_instance;
+w2c_table__copy__43__wasm table__copy__43__wasm_instance;
+w2c_table__copy__44__wasm table__copy__44__wasm_instance;
+w2c_table__copy__45__wasm table__copy__45__wasm_instance;
+w2c_table__copy__46__wasm table__copy__46__wasm_instance;
+w2c_table__copy__47__wasm table__copy__47__wasm_instance;
+w2c_table__copy__48__wasm table__copy__48__wasm_instance;
+w2c_table__copy__49__wasm table__copy__49__wasm_instance;
+w2c_table__copy__50__wasm table__copy__50__wasm_instance;
+w2c_table__copy__51__wasm table__copy__51__wasm_instance;
+w2c_table__copy__52__wasm table__copy__52__wasm_instance;
+w2c_table__copy__53__wasm table__copy__53__wasm_instance;
+w2c_table__copy__54__wasm table__copy__54__wasm_instance;
+w2c_table__copy__55__wasm table__copy__55__wasm_instance;
+w2c_table__copy__56__wasm table__copy__56__wasm_instance;
+w2c_table__copy__57__wasm table__copy__57__wasm_instance;
+w2c_table__copy__58__wasm table__copy__58__wasm_instance;
+w2c_table__copy__59__wasm table__copy__59__wasm_instance;
+w2c_table__copy__60__wasm table__copy__60__wasm_instance;
+w2c_table__copy__61__wasm table__copy__61__wasm_instance;
+w2c_table__copy__62__wasm table__copy__62__wasm_instance;
+w2c_table__copy__63__wasm table__copy__63__wasm_instance;
+w2c_table__copy__64__wasm table__copy__64__wasm_instance;
+w2c_table__copy__65__wasm table__copy__65__wasm_instance;
+w2c_table__copy__66__wasm table__copy__66__wasm_instance;
+w2c_table__copy__67__wasm table__copy__67__wasm_instance;
+w2c_table__copy__68__wasm table__copy__68__wasm_instance;
+w2c_table__copy__69__wasm table__copy__69__wasm_instance;
+w2c_table__copy__70__wasm table__copy__70__wasm_instance;
+w2c_table__copy__71__wasm table__copy__71__wasm_instance;
+w2c_table__copy__72__wasm table__copy__72__wasm_instance;
+w2c_table__copy__73__wasm table__copy__73__wasm_instance;
+
+void run_spec_tests_0(void) {
+
+#line 6 "table_copy.wast"
+wasm2c_a_instantiate(&a_instance);
+
+#line 15 "table_copy.wast"
+wasm2c_table__copy__1__wasm_instantiate(&table__copy__1__wasm_instance, &a_instance);
+
+#line 45 "table_copy.wast"
+w2c_table__copy__1__wasm_test(&table__copy__1__wasm_instance);
+
+#line 46 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 0u));
+
+#line 47 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 1u));
+
+#line 48 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 2u), 3u);
+
+#line 49 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 3u), 1u);
+
+#line 50 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 4u), 4u);
+
+#line 51 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 5u), 1u);
+
+#line 52 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 6u));
+
+#line 53 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 7u));
+
+#line 54 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 8u));
+
+#line 55 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 9u));
+
+#line 56 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 10u));
+
+#line 57 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 11u));
+
+#line 58 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 12u), 7u);
+
+#line 59 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 13u), 5u);
+
+#line 60 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 14u), 2u);
+
+#line 61 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 15u), 3u);
+
+#line 62 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 16u), 6u);
+
+#line 63 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 17u));
+
+#line 64 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 18u));
+
+#line 65 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 19u));
+
+#line 66 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 20u));
+
+#line 67 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 21u));
+
+#line 68 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 22u));
+
+#line 69 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 23u));
+
+#line 70 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 24u));
+
+#line 71 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 25u));
+
+#line 72 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 26u));
+
+#line 73 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 27u));
+
+#line 74 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 28u));
+
+#line 75 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t0(&table__copy__1__wasm_instance, 29u));
+
+#line 76 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 0u));
+
+#line 77 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 1u));
+
+#line 78 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 2u));
+
+#line 79 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 3u), 1u);
+
+#line 80 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 4u), 3u);
+
+#line 81 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 5u), 1u);
+
+#line 82 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 6u), 4u);
+
+#line 83 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 7u));
+
+#line 84 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 8u));
+
+#line 85 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 9u));
+
+#line 86 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 10u));
+
+#line 87 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 11u), 6u);
+
+#line 88 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 12u), 3u);
+
+#line 89 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 13u), 2u);
+
+#line 90 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 14u), 5u);
+
+#line 91 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 15u), 7u);
+
+#line 92 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 16u));
+
+#line 93 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 17u));
+
+#line 94 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 18u));
+
+#line 95 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 19u));
+
+#line 96 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 20u));
+
+#line 97 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 21u));
+
+#line 98 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 22u));
+
+#line 99 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 23u));
+
+#line 100 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 24u));
+
+#line 101 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 25u));
+
+#line 102 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 26u));
+
+#line 103 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 27u));
+
+#line 104 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 28u));
+
+#line 105 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__1__wasm_check_t1(&table__copy__1__wasm_instance, 29u));
+
+#line 107 "table_copy.wast"
+wasm2c_table__copy__2__wasm_instantiate(&table__copy__2__wasm_instance, &a_instance);
+
+#line 137 "table_copy.wast"
+w2c_table__copy__2__wasm_test(&table__copy__2__wasm_instance);
+
+#line 138 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 0u));
+
+#line 139 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 1u));
+
+#line 140 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 2u), 3u);
+
+#line 141 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 3u), 1u);
+
+#line 142 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 4u), 4u);
+
+#line 143 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 5u), 1u);
+
+#line 144 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 6u));
+
+#line 145 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 7u));
+
+#line 146 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 8u));
+
+#line 147 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 9u));
+
+#line 148 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 10u));
+
+#line 149 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 11u));
+
+#line 150 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 12u), 7u);
+
+#line 151 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 13u), 3u);
+
+#line 152 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 14u), 1u);
+
+#line 153 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 15u), 4u);
+
+#line 154 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 16u), 6u);
+
+#line 155 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 17u));
+
+#line 156 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 18u));
+
+#line 157 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 19u));
+
+#line 158 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 20u));
+
+#line 159 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 21u));
+
+#line 160 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 22u));
+
+#line 161 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 23u));
+
+#line 162 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 24u));
+
+#line 163 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 25u));
+
+#line 164 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 26u));
+
+#line 165 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 27u));
+
+#line 166 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 28u));
+
+#line 167 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t0(&table__copy__2__wasm_instance, 29u));
+
+#line 168 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 0u));
+
+#line 169 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 1u));
+
+#line 170 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 2u));
+
+#line 171 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 3u), 1u);
+
+#line 172 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 4u), 3u);
+
+#line 173 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 5u), 1u);
+
+#line 174 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 6u), 4u);
+
+#line 175 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 7u));
+
+#line 176 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 8u));
+
+#line 177 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 9u));
+
+#line 178 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 10u));
+
+#line 179 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 11u), 6u);
+
+#line 180 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 12u), 3u);
+
+#line 181 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 13u), 2u);
+
+#line 182 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 14u), 5u);
+
+#line 183 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 15u), 7u);
+
+#line 184 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 16u));
+
+#line 185 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 17u));
+
+#line 186 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 18u));
+
+#line 187 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 19u));
+
+#line 188 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 20u));
+
+#line 189 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 21u));
+
+#line 190 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 22u));
+
+#line 191 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 23u));
+
+#line 192 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 24u));
+
+#line 193 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 25u));
+
+#line 194 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 26u));
+
+#line 195 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 27u));
+
+#line 196 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 28u));
+
+#line 197 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__2__wasm_check_t1(&table__copy__2__wasm_instance, 29u));
+
+#line 199 "table_copy.wast"
+wasm2c_table__copy__3__wasm_instantiate(&table__copy__3__wasm_instance, &a_instance);
+
+#line 229 "table_copy.wast"
+w2c_table__copy__3__wasm_test(&table__copy__3__wasm_instance);
+
+#line 230 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 0u));
+
+#line 231 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 1u));
+
+#line 232 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 2u), 3u);
+
+#line 233 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 3u), 1u);
+
+#line 234 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 4u), 4u);
+
+#line 235 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 5u), 1u);
+
+#line 236 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 6u));
+
+#line 237 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 7u));
+
+#line 238 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 8u));
+
+#line 239 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 9u));
+
+#line 240 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 10u));
+
+#line 241 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 11u));
+
+#line 242 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 12u), 7u);
+
+#line 243 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 13u), 5u);
+
+#line 244 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 14u), 2u);
+
+#line 245 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 15u), 3u);
+
+#line 246 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 16u), 6u);
+
+#line 247 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 17u));
+
+#line 248 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 18u));
+
+#line 249 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 19u));
+
+#line 250 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 20u));
+
+#line 251 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 21u));
+
+#line 252 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 22u));
+
+#line 253 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 23u));
+
+#line 254 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 24u));
+
+#line 255 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 25u), 3u);
+
+#line 256 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 26u), 6u);
+
+#line 257 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 27u));
+
+#line 258 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 28u));
+
+#line 259 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t0(&table__copy__3__wasm_instance, 29u));
+
+#line 260 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 0u));
+
+#line 261 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 1u));
+
+#line 262 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 2u));
+
+#line 263 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 3u), 1u);
+
+#line 264 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 4u), 3u);
+
+#line 265 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 5u), 1u);
+
+#line 266 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 6u), 4u);
+
+#line 267 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 7u));
+
+#line 268 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 8u));
+
+#line 269 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 9u));
+
+#line 270 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 10u));
+
+#line 271 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 11u), 6u);
+
+#line 272 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 12u), 3u);
+
+#line 273 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 13u), 2u);
+
+#line 274 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 14u), 5u);
+
+#line 275 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 15u), 7u);
+
+#line 276 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 16u));
+
+#line 277 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 17u));
+
+#line 278 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 18u));
+
+#line 279 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 19u));
+
+#line 280 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 20u));
+
+#line 281 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 21u));
+
+#line 282 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 22u));
+
+#line 283 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 23u));
+
+#line 284 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 24u));
+
+#line 285 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 25u));
+
+#line 286 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 26u));
+
+#line 287 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 27u));
+
+#line 288 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 28u));
+
+#line 289 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__3__wasm_check_t1(&table__copy__3__wasm_instance, 29u));
+
+#line 291 "table_copy.wast"
+wasm2c_table__copy__4__wasm_instantiate(&table__copy__4__wasm_instance, &a_instance);
+
+#line 321 "table_copy.wast"
+w2c_table__copy__4__wasm_test(&table__copy__4__wasm_instance);
+
+#line 322 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 0u));
+
+#line 323 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 1u));
+
+#line 324 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 2u), 3u);
+
+#line 325 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 3u), 1u);
+
+#line 326 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 4u), 4u);
+
+#line 327 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 5u), 1u);
+
+#line 328 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 6u));
+
+#line 329 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 7u));
+
+#line 330 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 8u));
+
+#line 331 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 9u));
+
+#line 332 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 10u));
+
+#line 333 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 11u));
+
+#line 334 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 12u), 7u);
+
+#line 335 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 13u));
+
+#line 336 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 14u));
+
+#line 337 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 15u));
+
+#line 338 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 16u), 6u);
+
+#line 339 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 17u));
+
+#line 340 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 18u));
+
+#line 341 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 19u));
+
+#line 342 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 20u));
+
+#line 343 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 21u));
+
+#line 344 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 22u));
+
+#line 345 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 23u));
+
+#line 346 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 24u));
+
+#line 347 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 25u));
+
+#line 348 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 26u));
+
+#line 349 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 27u));
+
+#line 350 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 28u));
+
+#line 351 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t0(&table__copy__4__wasm_instance, 29u));
+
+#line 352 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 0u));
+
+#line 353 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 1u));
+
+#line 354 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 2u));
+
+#line 355 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 3u), 1u);
+
+#line 356 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 4u), 3u);
+
+#line 357 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 5u), 1u);
+
+#line 358 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 6u), 4u);
+
+#line 359 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 7u));
+
+#line 360 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 8u));
+
+#line 361 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 9u));
+
+#line 362 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 10u));
+
+#line 363 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 11u), 6u);
+
+#line 364 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 12u), 3u);
+
+#line 365 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 13u), 2u);
+
+#line 366 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 14u), 5u);
+
+#line 367 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 15u), 7u);
+
+#line 368 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 16u));
+
+#line 369 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 17u));
+
+#line 370 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 18u));
+
+#line 371 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 19u));
+
+#line 372 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 20u));
+
+#line 373 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 21u));
+
+#line 374 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 22u));
+
+#line 375 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 23u));
+
+#line 376 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 24u));
+
+#line 377 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 25u));
+
+#line 378 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 26u));
+
+#line 379 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 27u));
+
+#line 380 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 28u));
+
+#line 381 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__4__wasm_check_t1(&table__copy__4__wasm_instance, 29u));
+
+#line 383 "table_copy.wast"
+wasm2c_table__copy__5__wasm_instantiate(&table__copy__5__wasm_instance, &a_instance);
+
+#line 413 "table_copy.wast"
+w2c_table__copy__5__wasm_test(&table__copy__5__wasm_instance);
+
+#line 414 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 0u));
+
+#line 415 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 1u));
+
+#line 416 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 2u), 3u);
+
+#line 417 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 3u), 1u);
+
+#line 418 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 4u), 4u);
+
+#line 419 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 5u), 1u);
+
+#line 420 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 6u));
+
+#line 421 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 7u));
+
+#line 422 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 8u));
+
+#line 423 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 9u));
+
+#line 424 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 10u));
+
+#line 425 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 11u));
+
+#line 426 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 12u), 7u);
+
+#line 427 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 13u), 5u);
+
+#line 428 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 14u), 2u);
+
+#line 429 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 15u), 3u);
+
+#line 430 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 16u), 6u);
+
+#line 431 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 17u));
+
+#line 432 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 18u));
+
+#line 433 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 19u));
+
+#line 434 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 20u));
+
+#line 435 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 21u));
+
+#line 436 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 22u));
+
+#line 437 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 23u));
+
+#line 438 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 24u));
+
+#line 439 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 25u));
+
+#line 440 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 26u));
+
+#line 441 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 27u));
+
+#line 442 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 28u));
+
+#line 443 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t0(&table__copy__5__wasm_instance, 29u));
+
+#line 444 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 0u));
+
+#line 445 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 1u));
+
+#line 446 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 2u));
+
+#line 447 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 3u), 1u);
+
+#line 448 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 4u), 3u);
+
+#line 449 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 5u), 1u);
+
+#line 450 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 6u), 4u);
+
+#line 451 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 7u));
+
+#line 452 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 8u));
+
+#line 453 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 9u));
+
+#line 454 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 10u));
+
+#line 455 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 11u), 6u);
+
+#line 456 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 12u), 3u);
+
+#line 457 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 13u), 2u);
+
+#line 458 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 14u), 5u);
+
+#line 459 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 15u), 7u);
+
+#line 460 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 16u));
+
+#line 461 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 17u));
+
+#line 462 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 18u));
+
+#line 463 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 19u));
+
+#line 464 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 20u));
+
+#line 465 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 21u));
+
+#line 466 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 22u));
+
+#line 467 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 23u));
+
+#line 468 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 24u));
+
+#line 469 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 25u));
+
+#line 470 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 26u));
+
+#line 471 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 27u));
+
+#line 472 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 28u));
+
+#line 473 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__5__wasm_check_t1(&table__copy__5__wasm_instance, 29u));
+
+#line 475 "table_copy.wast"
+wasm2c_table__copy__6__wasm_instantiate(&table__copy__6__wasm_instance, &a_instance);
+
+#line 505 "table_copy.wast"
+w2c_table__copy__6__wasm_test(&table__copy__6__wasm_instance);
+
+#line 506 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 0u));
+
+#line 507 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 1u));
+
+#line 508 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 2u), 3u);
+
+#line 509 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 3u), 1u);
+
+#line 510 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 4u), 4u);
+
+#line 511 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 5u), 1u);
+
+#line 512 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 6u));
+
+#line 513 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 7u));
+
+#line 514 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 8u));
+
+#line 515 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 9u));
+
+#line 516 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 10u));
+
+#line 517 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 11u));
+
+#line 518 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 12u), 7u);
+
+#line 519 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 13u), 5u);
+
+#line 520 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 14u), 2u);
+
+#line 521 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 15u), 3u);
+
+#line 522 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 16u), 6u);
+
+#line 523 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 17u));
+
+#line 524 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 18u));
+
+#line 525 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 19u));
+
+#line 526 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 20u));
+
+#line 527 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 21u));
+
+#line 528 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 22u));
+
+#line 529 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 23u));
+
+#line 530 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 24u));
+
+#line 531 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 25u));
+
+#line 532 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 26u), 3u);
+
+#line 533 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 27u), 1u);
+
+#line 534 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 28u));
+
+#line 535 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t0(&table__copy__6__wasm_instance, 29u));
+
+#line 536 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 0u));
+
+#line 537 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 1u));
+
+#line 538 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 2u));
+
+#line 539 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 3u), 1u);
+
+#line 540 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 4u), 3u);
+
+#line 541 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 5u), 1u);
+
+#line 542 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 6u), 4u);
+
+#line 543 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 7u));
+
+#line 544 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 8u));
+
+#line 545 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 9u));
+
+#line 546 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 10u));
+
+#line 547 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 11u), 6u);
+
+#line 548 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 12u), 3u);
+
+#line 549 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 13u), 2u);
+
+#line 550 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 14u), 5u);
+
+#line 551 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 15u), 7u);
+
+#line 552 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 16u));
+
+#line 553 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 17u));
+
+#line 554 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 18u));
+
+#line 555 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 19u));
+
+#line 556 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 20u));
+
+#line 557 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 21u));
+
+#line 558 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 22u));
+
+#line 559 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 23u));
+
+#line 560 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 24u));
+
+#line 561 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 25u));
+
+#line 562 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 26u));
+
+#line 563 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 27u));
+
+#line 564 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 28u));
+
+#line 565 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__6__wasm_check_t1(&table__copy__6__wasm_instance, 29u));
+
+#line 567 "table_copy.wast"
+wasm2c_table__copy__7__wasm_instantiate(&table__copy__7__wasm_instance, &a_instance);
+
+#line 597 "table_copy.wast"
+w2c_table__copy__7__wasm_test(&table__copy__7__wasm_instance);
+
+#line 598 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 0u));
+
+#line 599 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 1u));
+
+#line 600 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 2u), 3u);
+
+#line 601 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 3u), 1u);
+
+#line 602 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 4u), 4u);
+
+#line 603 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 5u), 1u);
+
+#line 604 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 6u));
+
+#line 605 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 7u));
+
+#line 606 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 8u));
+
+#line 607 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 9u));
+
+#line 608 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 10u), 7u);
+
+#line 609 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 11u), 5u);
+
+#line 610 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 12u), 2u);
+
+#line 611 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 13u), 3u);
+
+#line 612 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 14u), 6u);
+
+#line 613 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 15u));
+
+#line 614 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 16u));
+
+#line 615 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 17u));
+
+#line 616 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 18u));
+
+#line 617 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 19u));
+
+#line 618 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 20u));
+
+#line 619 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 21u));
+
+#line 620 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 22u));
+
+#line 621 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 23u));
+
+#line 622 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 24u));
+
+#line 623 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 25u));
+
+#line 624 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 26u));
+
+#line 625 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 27u));
+
+#line 626 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 28u));
+
+#line 627 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t0(&table__copy__7__wasm_instance, 29u));
+
+#line 628 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 0u));
+
+#line 629 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 1u));
+
+#line 630 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 2u));
+
+#line 631 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 3u), 1u);
+
+#line 632 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 4u), 3u);
+
+#line 633 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 5u), 1u);
+
+#line 634 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 6u), 4u);
+
+#line 635 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 7u));
+
+#line 636 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 8u));
+
+#line 637 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 9u));
+
+#line 638 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 10u));
+
+#line 639 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 11u), 6u);
+
+#line 640 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 12u), 3u);
+
+#line 641 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 13u), 2u);
+
+#line 642 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 14u), 5u);
+
+#line 643 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 15u), 7u);
+
+#line 644 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 16u));
+
+#line 645 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 17u));
+
+#line 646 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 18u));
+
+#line 647 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 19u));
+
+#line 648 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 20u));
+
+#line 649 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 21u));
+
+#line 650 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 22u));
+
+#line 651 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 23u));
+
+#line 652 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 24u));
+
+#line 653 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 25u));
+
+#line 654 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 26u));
+
+#line 655 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 27u));
+
+#line 656 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 28u));
+
+#line 657 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__7__wasm_check_t1(&table__copy__7__wasm_instance, 29u));
+
+#line 659 "table_copy.wast"
+wasm2c_table__copy__8__wasm_instantiate(&table__copy__8__wasm_instance, &a_instance);
+
+#line 689 "table_copy.wast"
+w2c_table__copy__8__wasm_test(&table__copy__8__wasm_instance);
+
+#line 690 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 0u));
+
+#line 691 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 1u));
+
+#line 692 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 2u), 3u);
+
+#line 693 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 3u), 1u);
+
+#line 694 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 4u), 4u);
+
+#line 695 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 5u), 1u);
+
+#line 696 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 6u));
+
+#line 697 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 7u));
+
+#line 698 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 8u));
+
+#line 699 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 9u));
+
+#line 700 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 10u));
+
+#line 701 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 11u));
+
+#line 702 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 12u));
+
+#line 703 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 13u));
+
+#line 704 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 14u), 7u);
+
+#line 705 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 15u), 5u);
+
+#line 706 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 16u), 2u);
+
+#line 707 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 17u), 3u);
+
+#line 708 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 18u), 6u);
+
+#line 709 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 19u));
+
+#line 710 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 20u));
+
+#line 711 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 21u));
+
+#line 712 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 22u));
+
+#line 713 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 23u));
+
+#line 714 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 24u));
+
+#line 715 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 25u));
+
+#line 716 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 26u));
+
+#line 717 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 27u));
+
+#line 718 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 28u));
+
+#line 719 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t0(&table__copy__8__wasm_instance, 29u));
+
+#line 720 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 0u));
+
+#line 721 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 1u));
+
+#line 722 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 2u));
+
+#line 723 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 3u), 1u);
+
+#line 724 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 4u), 3u);
+
+#line 725 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 5u), 1u);
+
+#line 726 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 6u), 4u);
+
+#line 727 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 7u));
+
+#line 728 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 8u));
+
+#line 729 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 9u));
+
+#line 730 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 10u));
+
+#line 731 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 11u), 6u);
+
+#line 732 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 12u), 3u);
+
+#line 733 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 13u), 2u);
+
+#line 734 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 14u), 5u);
+
+#line 735 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 15u), 7u);
+
+#line 736 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 16u));
+
+#line 737 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 17u));
+
+#line 738 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 18u));
+
+#line 739 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 19u));
+
+#line 740 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 20u));
+
+#line 741 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 21u));
+
+#line 742 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 22u));
+
+#line 743 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 23u));
+
+#line 744 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 24u));
+
+#line 745 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 25u));
+
+#line 746 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 26u));
+
+#line 747 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 27u));
+
+#line 748 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 28u));
+
+#line 749 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__8__wasm_check_t1(&table__copy__8__wasm_instance, 29u));
+
+#line 751 "table_copy.wast"
+wasm2c_table__copy__9__wasm_instantiate(&table__copy__9__wasm_instance, &a_instance);
+
+#line 781 "table_copy.wast"
+w2c_table__copy__9__wasm_test(&table__copy__9__wasm_instance);
+
+#line 782 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 0u));
+
+#line 783 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 1u));
+
+#line 784 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 2u), 3u);
+
+#line 785 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 3u), 1u);
+
+#line 786 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 4u), 4u);
+
+#line 787 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 5u), 1u);
+
+#line 788 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 6u));
+
+#line 789 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 7u));
+
+#line 790 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 8u));
+
+#line 791 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 9u));
+
+#line 792 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 10u));
+
+#line 793 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 11u));
+
+#line 794 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 12u), 7u);
+
+#line 795 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 13u), 5u);
+
+#line 796 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 14u), 2u);
+
+#line 797 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 15u), 3u);
+
+#line 798 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 16u), 6u);
+
+#line 799 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 17u));
+
+#line 800 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 18u));
+
+#line 801 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 19u));
+
+#line 802 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 20u));
+
+#line 803 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 21u));
+
+#line 804 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 22u));
+
+#line 805 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 23u));
+
+#line 806 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 24u));
+
+#line 807 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 25u));
+
+#line 808 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 26u));
+
+#line 809 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 27u));
+
+#line 810 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 28u));
+
+#line 811 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t0(&table__copy__9__wasm_instance, 29u));
+
+#line 812 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 0u));
+
+#line 813 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 1u));
+
+#line 814 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 2u));
+
+#line 815 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 3u), 1u);
+
+#line 816 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 4u), 3u);
+
+#line 817 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 5u), 1u);
+
+#line 818 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 6u), 4u);
+
+#line 819 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 7u));
+
+#line 820 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 8u));
+
+#line 821 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 9u));
+
+#line 822 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 10u));
+
+#line 823 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 11u));
+
+#line 824 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 12u), 3u);
+
+#line 825 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 13u), 1u);
+
+#line 826 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 14u), 4u);
+
+#line 827 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 15u), 1u);
+
+#line 828 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 16u));
+
+#line 829 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 17u));
+
+#line 830 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 18u));
+
+#line 831 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 19u));
+
+#line 832 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 20u));
+
+#line 833 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 21u));
+
+#line 834 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 22u), 7u);
+
+#line 835 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 23u), 5u);
+
+#line 836 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 24u), 2u);
+
+#line 837 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 25u), 3u);
+
+#line 838 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 26u), 6u);
+
+#line 839 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 27u));
+
+#line 840 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 28u));
+
+#line 841 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__9__wasm_check_t1(&table__copy__9__wasm_instance, 29u));
+
+#line 843 "table_copy.wast"
+wasm2c_table__copy__10__wasm_instantiate(&table__copy__10__wasm_instance, &a_instance);
+
+#line 873 "table_copy.wast"
+w2c_table__copy__10__wasm_test(&table__copy__10__wasm_instance);
+
+#line 874 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 0u));
+
+#line 875 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 1u));
+
+#line 876 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 2u), 3u);
+
+#line 877 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 3u), 1u);
+
+#line 878 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 4u), 4u);
+
+#line 879 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 5u), 1u);
+
+#line 880 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 6u));
+
+#line 881 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 7u));
+
+#line 882 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 8u));
+
+#line 883 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 9u));
+
+#line 884 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 10u));
+
+#line 885 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 11u));
+
+#line 886 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 12u), 7u);
+
+#line 887 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 13u), 5u);
+
+#line 888 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 14u), 2u);
+
+#line 889 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 15u), 3u);
+
+#line 890 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 16u), 6u);
+
+#line 891 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 17u));
+
+#line 892 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 18u));
+
+#line 893 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 19u));
+
+#line 894 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 20u));
+
+#line 895 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 21u));
+
+#line 896 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 22u));
+
+#line 897 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 23u));
+
+#line 898 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 24u));
+
+#line 899 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 25u));
+
+#line 900 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 26u));
+
+#line 901 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 27u));
+
+#line 902 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 28u));
+
+#line 903 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t0(&table__copy__10__wasm_instance, 29u));
+
+#line 904 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 0u));
+
+#line 905 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 1u));
+
+#line 906 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 2u));
+
+#line 907 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 3u), 1u);
+
+#line 908 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 4u), 3u);
+
+#line 909 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 5u), 1u);
+
+#line 910 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 6u), 4u);
+
+#line 911 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 7u));
+
+#line 912 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 8u));
+
+#line 913 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 9u));
+
+#line 914 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 10u));
+
+#line 915 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 11u), 6u);
+
+#line 916 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 12u), 3u);
+
+#line 917 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 13u), 2u);
+
+#line 918 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 14u), 5u);
+
+#line 919 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 15u), 7u);
+
+#line 920 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 16u));
+
+#line 921 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 17u));
+
+#line 922 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 18u));
+
+#line 923 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 19u));
+
+#line 924 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 20u));
+
+#line 925 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 21u));
+
+#line 926 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 22u));
+
+#line 927 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 23u));
+
+#line 928 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 24u));
+
+#line 929 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 25u));
+
+#line 930 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 26u));
+
+#line 931 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 27u));
+
+#line 932 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 28u));
+
+#line 933 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__10__wasm_check_t1(&table__copy__10__wasm_instance, 29u));
+
+#line 935 "table_copy.wast"
+wasm2c_table__copy__11__wasm_instantiate(&table__copy__11__wasm_instance, &a_instance);
+
+#line 965 "table_copy.wast"
+w2c_table__copy__11__wasm_test(&table__copy__11__wasm_instance);
+
+#line 966 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 0u));
+
+#line 967 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 1u));
+
+#line 968 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 2u), 3u);
+
+#line 969 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 3u), 1u);
+
+#line 970 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 4u), 4u);
+
+#line 971 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 5u), 1u);
+
+#line 972 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 6u));
+
+#line 973 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 7u));
+
+#line 974 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 8u));
+
+#line 975 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 9u));
+
+#line 976 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 10u));
+
+#line 977 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 11u));
+
+#line 978 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 12u), 7u);
+
+#line 979 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 13u), 3u);
+
+#line 980 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 14u), 1u);
+
+#line 981 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 15u), 4u);
+
+#line 982 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 16u), 6u);
+
+#line 983 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 17u));
+
+#line 984 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 18u));
+
+#line 985 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 19u));
+
+#line 986 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 20u));
+
+#line 987 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 21u));
+
+#line 988 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 22u));
+
+#line 989 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 23u));
+
+#line 990 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 24u));
+
+#line 991 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 25u));
+
+#line 992 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 26u));
+
+#line 993 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 27u));
+
+#line 994 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 28u));
+
+#line 995 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t0(&table__copy__11__wasm_instance, 29u));
+
+#line 996 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 0u));
+
+#line 997 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 1u));
+
+#line 998 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 2u));
+
+#line 999 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 3u), 1u);
+
+#line 1000 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 4u), 3u);
+
+#line 1001 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 5u), 1u);
+
+#line 1002 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 6u), 4u);
+
+#line 1003 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 7u));
+
+#line 1004 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 8u));
+
+#line 1005 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 9u));
+
+#line 1006 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 10u));
+
+#line 1007 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 11u), 6u);
+
+#line 1008 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 12u), 3u);
+
+#line 1009 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 13u), 2u);
+
+#line 1010 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 14u), 5u);
+
+#line 1011 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 15u), 7u);
+
+#line 1012 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 16u));
+
+#line 1013 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 17u));
+
+#line 1014 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 18u));
+
+#line 1015 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 19u));
+
+#line 1016 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 20u));
+
+#line 1017 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 21u));
+
+#line 1018 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 22u));
+
+#line 1019 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 23u));
+
+#line 1020 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 24u));
+
+#line 1021 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 25u));
+
+#line 1022 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 26u));
+
+#line 1023 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 27u));
+
+#line 1024 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 28u));
+
+#line 1025 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__11__wasm_check_t1(&table__copy__11__wasm_instance, 29u));
+
+#line 1027 "table_copy.wast"
+wasm2c_table__copy__12__wasm_instantiate(&table__copy__12__wasm_instance, &a_instance);
+
+#line 1057 "table_copy.wast"
+w2c_table__copy__12__wasm_test(&table__copy__12__wasm_instance);
+
+#line 1058 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 0u));
+
+#line 1059 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 1u));
+
+#line 1060 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 2u), 3u);
+
+#line 1061 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 3u), 1u);
+
+#line 1062 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 4u), 4u);
+
+#line 1063 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 5u), 1u);
+
+#line 1064 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 6u));
+
+#line 1065 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 7u));
+
+#line 1066 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 8u));
+
+#line 1067 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 9u));
+
+#line 1068 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 10u));
+
+#line 1069 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 11u));
+
+#line 1070 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 12u), 7u);
+
+#line 1071 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 13u), 5u);
+
+#line 1072 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 14u), 2u);
+
+#line 1073 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 15u), 3u);
+
+#line 1074 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 16u), 6u);
+
+#line 1075 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 17u));
+
+#line 1076 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 18u));
+
+#line 1077 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 19u));
+
+#line 1078 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 20u));
+
+#line 1079 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 21u));
+
+#line 1080 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 22u));
+
+#line 1081 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 23u));
+
+#line 1082 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 24u));
+
+#line 1083 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 25u), 3u);
+
+#line 1084 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 26u), 6u);
+
+#line 1085 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 27u));
+
+#line 1086 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 28u));
+
+#line 1087 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t0(&table__copy__12__wasm_instance, 29u));
+
+#line 1088 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 0u));
+
+#line 1089 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 1u));
+
+#line 1090 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 2u));
+
+#line 1091 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 3u), 1u);
+
+#line 1092 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 4u), 3u);
+
+#line 1093 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 5u), 1u);
+
+#line 1094 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 6u), 4u);
+
+#line 1095 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 7u));
+
+#line 1096 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 8u));
+
+#line 1097 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 9u));
+
+#line 1098 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 10u));
+
+#line 1099 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 11u), 6u);
+
+#line 1100 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 12u), 3u);
+
+#line 1101 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 13u), 2u);
+
+#line 1102 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 14u), 5u);
+
+#line 1103 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 15u), 7u);
+
+#line 1104 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 16u));
+
+#line 1105 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 17u));
+
+#line 1106 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 18u));
+
+#line 1107 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 19u));
+
+#line 1108 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 20u));
+
+#line 1109 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 21u));
+
+#line 1110 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 22u));
+
+#line 1111 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 23u));
+
+#line 1112 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 24u));
+
+#line 1113 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 25u));
+
+#line 1114 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 26u));
+
+#line 1115 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 27u));
+
+#line 1116 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 28u));
+
+#line 1117 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__12__wasm_check_t1(&table__copy__12__wasm_instance, 29u));
+
+#line 1119 "table_copy.wast"
+wasm2c_table__copy__13__wasm_instantiate(&table__copy__13__wasm_instance, &a_instance);
+
+#line 1149 "table_copy.wast"
+w2c_table__copy__13__wasm_test(&table__copy__13__wasm_instance);
+
+#line 1150 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 0u));
+
+#line 1151 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 1u));
+
+#line 1152 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 2u), 3u);
+
+#line 1153 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 3u), 1u);
+
+#line 1154 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 4u), 4u);
+
+#line 1155 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 5u), 1u);
+
+#line 1156 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 6u));
+
+#line 1157 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 7u));
+
+#line 1158 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 8u));
+
+#line 1159 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 9u));
+
+#line 1160 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 10u));
+
+#line 1161 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 11u));
+
+#line 1162 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 12u), 7u);
+
+#line 1163 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 13u));
+
+#line 1164 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 14u));
+
+#line 1165 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 15u));
+
+#line 1166 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 16u), 6u);
+
+#line 1167 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 17u));
+
+#line 1168 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 18u));
+
+#line 1169 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 19u));
+
+#line 1170 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 20u));
+
+#line 1171 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 21u));
+
+#line 1172 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 22u));
+
+#line 1173 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 23u));
+
+#line 1174 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 24u));
+
+#line 1175 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 25u));
+
+#line 1176 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 26u));
+
+#line 1177 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 27u));
+
+#line 1178 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 28u));
+
+#line 1179 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t0(&table__copy__13__wasm_instance, 29u));
+
+#line 1180 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 0u));
+
+#line 1181 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 1u));
+
+#line 1182 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 2u));
+
+#line 1183 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 3u), 1u);
+
+#line 1184 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 4u), 3u);
+
+#line 1185 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 5u), 1u);
+
+#line 1186 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 6u), 4u);
+
+#line 1187 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 7u));
+
+#line 1188 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 8u));
+
+#line 1189 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 9u));
+
+#line 1190 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 10u));
+
+#line 1191 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 11u), 6u);
+
+#line 1192 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 12u), 3u);
+
+#line 1193 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 13u), 2u);
+
+#line 1194 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 14u), 5u);
+
+#line 1195 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 15u), 7u);
+
+#line 1196 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 16u));
+
+#line 1197 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 17u));
+
+#line 1198 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 18u));
+
+#line 1199 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 19u));
+
+#line 1200 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 20u));
+
+#line 1201 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 21u));
+
+#line 1202 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 22u));
+
+#line 1203 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 23u));
+
+#line 1204 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 24u));
+
+#line 1205 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 25u));
+
+#line 1206 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 26u));
+
+#line 1207 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 27u));
+
+#line 1208 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 28u));
+
+#line 1209 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__13__wasm_check_t1(&table__copy__13__wasm_instance, 29u));
+
+#line 1211 "table_copy.wast"
+wasm2c_table__copy__14__wasm_instantiate(&table__copy__14__wasm_instance, &a_instance);
+
+#line 1241 "table_copy.wast"
+w2c_table__copy__14__wasm_test(&table__copy__14__wasm_instance);
+
+#line 1242 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 0u));
+
+#line 1243 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 1u));
+
+#line 1244 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 2u), 3u);
+
+#line 1245 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 3u), 1u);
+
+#line 1246 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 4u), 4u);
+
+#line 1247 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 5u), 1u);
+
+#line 1248 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 6u));
+
+#line 1249 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 7u));
+
+#line 1250 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 8u));
+
+#line 1251 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 9u));
+
+#line 1252 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 10u));
+
+#line 1253 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 11u));
+
+#line 1254 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 12u), 7u);
+
+#line 1255 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 13u), 5u);
+
+#line 1256 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 14u), 2u);
+
+#line 1257 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 15u), 3u);
+
+#line 1258 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 16u), 6u);
+
+#line 1259 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 17u));
+
+#line 1260 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 18u));
+
+#line 1261 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 19u));
+
+#line 1262 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 20u));
+
+#line 1263 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 21u));
+
+#line 1264 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 22u));
+
+#line 1265 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 23u));
+
+#line 1266 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 24u));
+
+#line 1267 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 25u));
+
+#line 1268 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 26u));
+
+#line 1269 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 27u));
+
+#line 1270 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 28u));
+
+#line 1271 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t0(&table__copy__14__wasm_instance, 29u));
+
+#line 1272 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 0u));
+
+#line 1273 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 1u));
+
+#line 1274 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 2u));
+
+#line 1275 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 3u), 1u);
+
+#line 1276 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 4u), 3u);
+
+#line 1277 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 5u), 1u);
+
+#line 1278 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 6u), 4u);
+
+#line 1279 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 7u));
+
+#line 1280 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 8u));
+
+#line 1281 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 9u));
+
+#line 1282 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 10u));
+
+#line 1283 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 11u), 6u);
+
+#line 1284 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 12u), 3u);
+
+#line 1285 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 13u), 2u);
+
+#line 1286 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 14u), 5u);
+
+#line 1287 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 15u), 7u);
+
+#line 1288 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 16u));
+
+#line 1289 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 17u));
+
+#line 1290 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 18u));
+
+#line 1291 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 19u));
+
+#line 1292 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 20u));
+
+#line 1293 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 21u));
+
+#line 1294 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 22u));
+
+#line 1295 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 23u));
+
+#line 1296 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 24u));
+
+#line 1297 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 25u));
+
+#line 1298 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 26u));
+
+#line 1299 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 27u));
+
+#line 1300 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 28u));
+
+#line 1301 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__14__wasm_check_t1(&table__copy__14__wasm_instance, 29u));
+
+#line 1303 "table_copy.wast"
+wasm2c_table__copy__15__wasm_instantiate(&table__copy__15__wasm_instance, &a_instance);
+
+#line 1333 "table_copy.wast"
+w2c_table__copy__15__wasm_test(&table__copy__15__wasm_instance);
+
+#line 1334 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 0u));
+
+#line 1335 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 1u));
+
+#line 1336 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 2u), 3u);
+
+#line 1337 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 3u), 1u);
+
+#line 1338 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 4u), 4u);
+
+#line 1339 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 5u), 1u);
+
+#line 1340 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 6u));
+
+#line 1341 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 7u));
+
+#line 1342 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 8u));
+
+#line 1343 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 9u));
+
+#line 1344 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 10u));
+
+#line 1345 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 11u));
+
+#line 1346 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 12u), 7u);
+
+#line 1347 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 13u), 5u);
+
+#line 1348 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 14u), 2u);
+
+#line 1349 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 15u), 3u);
+
+#line 1350 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 16u), 6u);
+
+#line 1351 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 17u));
+
+#line 1352 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 18u));
+
+#line 1353 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 19u));
+
+#line 1354 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 20u));
+
+#line 1355 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 21u));
+
+#line 1356 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 22u));
+
+#line 1357 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 23u));
+
+#line 1358 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 24u));
+
+#line 1359 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 25u));
+
+#line 1360 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 26u), 3u);
+
+#line 1361 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 27u), 1u);
+
+#line 1362 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 28u));
+
+#line 1363 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t0(&table__copy__15__wasm_instance, 29u));
+
+#line 1364 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 0u));
+
+#line 1365 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 1u));
+
+#line 1366 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 2u));
+
+#line 1367 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 3u), 1u);
+
+#line 1368 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 4u), 3u);
+
+#line 1369 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 5u), 1u);
+
+#line 1370 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 6u), 4u);
+
+#line 1371 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 7u));
+
+#line 1372 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 8u));
+
+#line 1373 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 9u));
+
+#line 1374 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 10u));
+
+#line 1375 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 11u), 6u);
+
+#line 1376 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 12u), 3u);
+
+#line 1377 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 13u), 2u);
+
+#line 1378 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 14u), 5u);
+
+#line 1379 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 15u), 7u);
+
+#line 1380 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 16u));
+
+#line 1381 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 17u));
+
+#line 1382 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 18u));
+
+#line 1383 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 19u));
+
+#line 1384 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 20u));
+
+#line 1385 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 21u));
+
+#line 1386 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 22u));
+
+#line 1387 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 23u));
+
+#line 1388 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 24u));
+
+#line 1389 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 25u));
+
+#line 1390 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 26u));
+
+#line 1391 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 27u));
+
+#line 1392 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 28u));
+
+#line 1393 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__15__wasm_check_t1(&table__copy__15__wasm_instance, 29u));
+
+#line 1395 "table_copy.wast"
+wasm2c_table__copy__16__wasm_instantiate(&table__copy__16__wasm_instance, &a_instance);
+
+#line 1425 "table_copy.wast"
+w2c_table__copy__16__wasm_test(&table__copy__16__wasm_instance);
+
+#line 1426 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 0u));
+
+#line 1427 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 1u));
+
+#line 1428 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 2u), 3u);
+
+#line 1429 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 3u), 1u);
+
+#line 1430 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 4u), 4u);
+
+#line 1431 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 5u), 1u);
+
+#line 1432 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 6u));
+
+#line 1433 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 7u));
+
+#line 1434 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 8u));
+
+#line 1435 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 9u));
+
+#line 1436 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 10u), 7u);
+
+#line 1437 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 11u), 5u);
+
+#line 1438 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 12u), 2u);
+
+#line 1439 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 13u), 3u);
+
+#line 1440 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 14u), 6u);
+
+#line 1441 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 15u));
+
+#line 1442 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 16u));
+
+#line 1443 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 17u));
+
+#line 1444 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 18u));
+
+#line 1445 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 19u));
+
+#line 1446 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 20u));
+
+#line 1447 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 21u));
+
+#line 1448 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 22u));
+
+#line 1449 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 23u));
+
+#line 1450 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 24u));
+
+#line 1451 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 25u));
+
+#line 1452 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 26u));
+
+#line 1453 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 27u));
+
+#line 1454 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 28u));
+
+#line 1455 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t0(&table__copy__16__wasm_instance, 29u));
+
+#line 1456 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 0u));
+
+#line 1457 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 1u));
+
+#line 1458 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 2u));
+
+#line 1459 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 3u), 1u);
+
+#line 1460 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 4u), 3u);
+
+#line 1461 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 5u), 1u);
+
+#line 1462 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 6u), 4u);
+
+#line 1463 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 7u));
+
+#line 1464 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 8u));
+
+#line 1465 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 9u));
+
+#line 1466 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 10u));
+
+#line 1467 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 11u), 6u);
+
+#line 1468 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 12u), 3u);
+
+#line 1469 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 13u), 2u);
+
+#line 1470 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 14u), 5u);
+
+#line 1471 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 15u), 7u);
+
+#line 1472 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 16u));
+
+#line 1473 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 17u));
+
+#line 1474 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 18u));
+
+#line 1475 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 19u));
+
+#line 1476 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 20u));
+
+#line 1477 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 21u));
+
+#line 1478 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 22u));
+
+#line 1479 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 23u));
+
+#line 1480 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 24u));
+
+#line 1481 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 25u));
+
+#line 1482 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 26u));
+
+#line 1483 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 27u));
+
+#line 1484 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 28u));
+
+#line 1485 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__16__wasm_check_t1(&table__copy__16__wasm_instance, 29u));
+
+#line 1487 "table_copy.wast"
+wasm2c_table__copy__17__wasm_instantiate(&table__copy__17__wasm_instance, &a_instance);
+
+#line 1517 "table_copy.wast"
+w2c_table__copy__17__wasm_test(&table__copy__17__wasm_instance);
+
+#line 1518 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 0u));
+
+#line 1519 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 1u));
+
+#line 1520 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 2u), 3u);
+
+#line 1521 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 3u), 1u);
+
+#line 1522 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 4u), 4u);
+
+#line 1523 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 5u), 1u);
+
+#line 1524 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 6u));
+
+#line 1525 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 7u));
+
+#line 1526 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 8u));
+
+#line 1527 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 9u));
+
+#line 1528 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 10u));
+
+#line 1529 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 11u));
+
+#line 1530 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 12u));
+
+#line 1531 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 13u));
+
+#line 1532 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 14u), 7u);
+
+#line 1533 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 15u), 5u);
+
+#line 1534 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 16u), 2u);
+
+#line 1535 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 17u), 3u);
+
+#line 1536 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 18u), 6u);
+
+#line 1537 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 19u));
+
+#line 1538 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 20u));
+
+#line 1539 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 21u));
+
+#line 1540 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 22u));
+
+#line 1541 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 23u));
+
+#line 1542 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 24u));
+
+#line 1543 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 25u));
+
+#line 1544 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 26u));
+
+#line 1545 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 27u));
+
+
+}
+
+void run_spec_tests_1(void) {
+
+#line 1546 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 28u));
+
+#line 1547 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t0(&table__copy__17__wasm_instance, 29u));
+
+#line 1548 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 0u));
+
+#line 1549 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 1u));
+
+#line 1550 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 2u));
+
+#line 1551 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 3u), 1u);
+
+#line 1552 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 4u), 3u);
+
+#line 1553 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 5u), 1u);
+
+#line 1554 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 6u), 4u);
+
+#line 1555 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 7u));
+
+#line 1556 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 8u));
+
+#line 1557 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 9u));
+
+#line 1558 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 10u));
+
+#line 1559 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 11u), 6u);
+
+#line 1560 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 12u), 3u);
+
+#line 1561 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 13u), 2u);
+
+#line 1562 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 14u), 5u);
+
+#line 1563 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 15u), 7u);
+
+#line 1564 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 16u));
+
+#line 1565 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 17u));
+
+#line 1566 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 18u));
+
+#line 1567 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 19u));
+
+#line 1568 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 20u));
+
+#line 1569 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 21u));
+
+#line 1570 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 22u));
+
+#line 1571 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 23u));
+
+#line 1572 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 24u));
+
+#line 1573 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 25u));
+
+#line 1574 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 26u));
+
+#line 1575 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 27u));
+
+#line 1576 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 28u));
+
+#line 1577 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__17__wasm_check_t1(&table__copy__17__wasm_instance, 29u));
+
+#line 1579 "table_copy.wast"
+wasm2c_table__copy__18__wasm_instantiate(&table__copy__18__wasm_instance, &a_instance);
+
+#line 1609 "table_copy.wast"
+w2c_table__copy__18__wasm_test(&table__copy__18__wasm_instance);
+
+#line 1610 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 0u));
+
+#line 1611 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 1u));
+
+#line 1612 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 2u), 3u);
+
+#line 1613 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 3u), 1u);
+
+#line 1614 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 4u), 4u);
+
+#line 1615 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 5u), 1u);
+
+#line 1616 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 6u));
+
+#line 1617 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 7u));
+
+#line 1618 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 8u));
+
+#line 1619 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 9u));
+
+#line 1620 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 10u));
+
+#line 1621 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 11u));
+
+#line 1622 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 12u), 7u);
+
+#line 1623 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 13u), 5u);
+
+#line 1624 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 14u), 2u);
+
+#line 1625 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 15u), 3u);
+
+#line 1626 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 16u), 6u);
+
+#line 1627 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 17u));
+
+#line 1628 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 18u));
+
+#line 1629 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 19u));
+
+#line 1630 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 20u));
+
+#line 1631 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 21u));
+
+#line 1632 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 22u));
+
+#line 1633 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 23u));
+
+#line 1634 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 24u));
+
+#line 1635 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 25u));
+
+#line 1636 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 26u));
+
+#line 1637 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 27u));
+
+#line 1638 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 28u));
+
+#line 1639 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t0(&table__copy__18__wasm_instance, 29u));
+
+#line 1640 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 0u));
+
+#line 1641 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 1u));
+
+#line 1642 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 2u));
+
+#line 1643 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 3u), 1u);
+
+#line 1644 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 4u), 3u);
+
+#line 1645 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 5u), 1u);
+
+#line 1646 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 6u), 4u);
+
+#line 1647 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 7u));
+
+#line 1648 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 8u));
+
+#line 1649 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 9u));
+
+#line 1650 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 10u));
+
+#line 1651 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 11u));
+
+#line 1652 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 12u), 3u);
+
+#line 1653 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 13u), 1u);
+
+#line 1654 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 14u), 4u);
+
+#line 1655 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 15u), 1u);
+
+#line 1656 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 16u));
+
+#line 1657 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 17u));
+
+#line 1658 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 18u));
+
+#line 1659 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 19u));
+
+#line 1660 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 20u));
+
+#line 1661 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 21u));
+
+#line 1662 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 22u), 7u);
+
+#line 1663 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 23u), 5u);
+
+#line 1664 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 24u), 2u);
+
+#line 1665 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 25u), 3u);
+
+#line 1666 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 26u), 6u);
+
+#line 1667 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 27u));
+
+#line 1668 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 28u));
+
+#line 1669 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__18__wasm_check_t1(&table__copy__18__wasm_instance, 29u));
+
+#line 1671 "table_copy.wast"
+wasm2c_table__copy__19__wasm_instantiate(&table__copy__19__wasm_instance);
+
+#line 1694 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__19__wasm_test(&table__copy__19__wasm_instance));
+
+#line 1696 "table_copy.wast"
+wasm2c_table__copy__20__wasm_instantiate(&table__copy__20__wasm_instance);
+
+#line 1719 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__20__wasm_test(&table__copy__20__wasm_instance));
+
+#line 1721 "table_copy.wast"
+wasm2c_table__copy__21__wasm_instantiate(&table__copy__21__wasm_instance);
+
+#line 1744 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__21__wasm_test(&table__copy__21__wasm_instance));
+
+#line 1746 "table_copy.wast"
+wasm2c_table__copy__22__wasm_instantiate(&table__copy__22__wasm_instance);
+
+#line 1769 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__22__wasm_test(&table__copy__22__wasm_instance));
+
+#line 1771 "table_copy.wast"
+wasm2c_table__copy__23__wasm_instantiate(&table__copy__23__wasm_instance);
+
+#line 1794 "table_copy.wast"
+w2c_table__copy__23__wasm_test(&table__copy__23__wasm_instance);
+
+#line 1796 "table_copy.wast"
+wasm2c_table__copy__24__wasm_instantiate(&table__copy__24__wasm_instance);
+
+#line 1819 "table_copy.wast"
+w2c_table__copy__24__wasm_test(&table__copy__24__wasm_instance);
+
+#line 1821 "table_copy.wast"
+wasm2c_table__copy__25__wasm_instantiate(&table__copy__25__wasm_instance);
+
+#line 1844 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__25__wasm_test(&table__copy__25__wasm_instance));
+
+#line 1846 "table_copy.wast"
+wasm2c_table__copy__26__wasm_instantiate(&table__copy__26__wasm_instance);
+
+#line 1869 "table_copy.wast"
+w2c_table__copy__26__wasm_test(&table__copy__26__wasm_instance);
+
+#line 1871 "table_copy.wast"
+wasm2c_table__copy__27__wasm_instantiate(&table__copy__27__wasm_instance);
+
+#line 1894 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__27__wasm_test(&table__copy__27__wasm_instance));
+
+#line 1896 "table_copy.wast"
+wasm2c_table__copy__28__wasm_instantiate(&table__copy__28__wasm_instance);
+
+#line 1919 "table_copy.wast"
+w2c_table__copy__28__wasm_test(&table__copy__28__wasm_instance);
+
+#line 1921 "table_copy.wast"
+wasm2c_table__copy__29__wasm_instantiate(&table__copy__29__wasm_instance);
+
+#line 1944 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__29__wasm_test(&table__copy__29__wasm_instance));
+
+#line 1946 "table_copy.wast"
+wasm2c_table__copy__30__wasm_instantiate(&table__copy__30__wasm_instance);
+
+#line 1969 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__30__wasm_test(&table__copy__30__wasm_instance));
+
+#line 1971 "table_copy.wast"
+wasm2c_table__copy__31__wasm_instantiate(&table__copy__31__wasm_instance);
+
+#line 1994 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__31__wasm_test(&table__copy__31__wasm_instance));
+
+#line 1996 "table_copy.wast"
+wasm2c_table__copy__32__wasm_instantiate(&table__copy__32__wasm_instance);
+
+#line 2019 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__32__wasm_test(&table__copy__32__wasm_instance));
+
+#line 2021 "table_copy.wast"
+wasm2c_table__copy__33__wasm_instantiate(&table__copy__33__wasm_instance);
+
+#line 2044 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__33__wasm_test(&table__copy__33__wasm_instance));
+
+#line 2046 "table_copy.wast"
+wasm2c_table__copy__34__wasm_instantiate(&table__copy__34__wasm_instance);
+
+#line 2069 "table_copy.wast"
+w2c_table__copy__34__wasm_test(&table__copy__34__wasm_instance);
+
+#line 2071 "table_copy.wast"
+wasm2c_table__copy__35__wasm_instantiate(&table__copy__35__wasm_instance);
+
+#line 2094 "table_copy.wast"
+w2c_table__copy__35__wasm_test(&table__copy__35__wasm_instance);
+
+#line 2096 "table_copy.wast"
+wasm2c_table__copy__36__wasm_instantiate(&table__copy__36__wasm_instance);
+
+#line 2119 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__36__wasm_test(&table__copy__36__wasm_instance));
+
+#line 2121 "table_copy.wast"
+wasm2c_table__copy__37__wasm_instantiate(&table__copy__37__wasm_instance);
+
+#line 2144 "table_copy.wast"
+w2c_table__copy__37__wasm_test(&table__copy__37__wasm_instance);
+
+#line 2146 "table_copy.wast"
+wasm2c_table__copy__38__wasm_instantiate(&table__copy__38__wasm_instance);
+
+#line 2169 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__38__wasm_test(&table__copy__38__wasm_instance));
+
+#line 2171 "table_copy.wast"
+wasm2c_table__copy__39__wasm_instantiate(&table__copy__39__wasm_instance);
+
+#line 2194 "table_copy.wast"
+w2c_table__copy__39__wasm_test(&table__copy__39__wasm_instance);
+
+#line 2196 "table_copy.wast"
+wasm2c_table__copy__40__wasm_instantiate(&table__copy__40__wasm_instance);
+
+#line 2219 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__40__wasm_test(&table__copy__40__wasm_instance));
+
+#line 2221 "table_copy.wast"
+wasm2c_table__copy__41__wasm_instantiate(&table__copy__41__wasm_instance);
+
+#line 2244 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__41__wasm_test(&table__copy__41__wasm_instance));
+
+#line 2246 "table_copy.wast"
+wasm2c_table__copy__42__wasm_instantiate(&table__copy__42__wasm_instance);
+
+#line 2269 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__42__wasm_test(&table__copy__42__wasm_instance));
+
+#line 2271 "table_copy.wast"
+wasm2c_table__copy__43__wasm_instantiate(&table__copy__43__wasm_instance);
+
+#line 2294 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__43__wasm_test(&table__copy__43__wasm_instance));
+
+#line 2296 "table_copy.wast"
+wasm2c_table__copy__44__wasm_instantiate(&table__copy__44__wasm_instance);
+
+#line 2319 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__44__wasm_test(&table__copy__44__wasm_instance));
+
+#line 2321 "table_copy.wast"
+wasm2c_table__copy__45__wasm_instantiate(&table__copy__45__wasm_instance);
+
+#line 2344 "table_copy.wast"
+w2c_table__copy__45__wasm_test(&table__copy__45__wasm_instance);
+
+#line 2346 "table_copy.wast"
+wasm2c_table__copy__46__wasm_instantiate(&table__copy__46__wasm_instance);
+
+#line 2369 "table_copy.wast"
+w2c_table__copy__46__wasm_test(&table__copy__46__wasm_instance);
+
+#line 2371 "table_copy.wast"
+wasm2c_table__copy__47__wasm_instantiate(&table__copy__47__wasm_instance);
+
+#line 2394 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__47__wasm_test(&table__copy__47__wasm_instance));
+
+#line 2396 "table_copy.wast"
+wasm2c_table__copy__48__wasm_instantiate(&table__copy__48__wasm_instance);
+
+#line 2419 "table_copy.wast"
+w2c_table__copy__48__wasm_test(&table__copy__48__wasm_instance);
+
+#line 2421 "table_copy.wast"
+wasm2c_table__copy__49__wasm_instantiate(&table__copy__49__wasm_instance);
+
+#line 2444 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__49__wasm_test(&table__copy__49__wasm_instance));
+
+#line 2446 "table_copy.wast"
+wasm2c_table__copy__50__wasm_instantiate(&table__copy__50__wasm_instance);
+
+#line 2469 "table_copy.wast"
+w2c_table__copy__50__wasm_test(&table__copy__50__wasm_instance);
+
+#line 2471 "table_copy.wast"
+wasm2c_table__copy__51__wasm_instantiate(&table__copy__51__wasm_instance);
+
+#line 2494 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__51__wasm_test(&table__copy__51__wasm_instance));
+
+#line 2496 "table_copy.wast"
+wasm2c_table__copy__52__wasm_instantiate(&table__copy__52__wasm_instance);
+
+#line 2519 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__52__wasm_test(&table__copy__52__wasm_instance));
+
+#line 2521 "table_copy.wast"
+wasm2c_table__copy__53__wasm_instantiate(&table__copy__53__wasm_instance);
+
+#line 2544 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__53__wasm_test(&table__copy__53__wasm_instance));
+
+#line 2546 "table_copy.wast"
+wasm2c_table__copy__54__wasm_instantiate(&table__copy__54__wasm_instance);
+
+#line 2569 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__54__wasm_test(&table__copy__54__wasm_instance));
+
+#line 2571 "table_copy.wast"
+wasm2c_table__copy__55__wasm_instantiate(&table__copy__55__wasm_instance);
+
+#line 2594 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__55__wasm_test(&table__copy__55__wasm_instance));
+
+#line 2596 "table_copy.wast"
+wasm2c_table__copy__56__wasm_instantiate(&table__copy__56__wasm_instance);
+
+#line 2619 "table_copy.wast"
+w2c_table__copy__56__wasm_test(&table__copy__56__wasm_instance);
+
+#line 2621 "table_copy.wast"
+wasm2c_table__copy__57__wasm_instantiate(&table__copy__57__wasm_instance);
+
+#line 2644 "table_copy.wast"
+w2c_table__copy__57__wasm_test(&table__copy__57__wasm_instance);
+
+#line 2646 "table_copy.wast"
+wasm2c_table__copy__58__wasm_instantiate(&table__copy__58__wasm_instance);
+
+#line 2669 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__58__wasm_test(&table__copy__58__wasm_instance));
+
+#line 2671 "table_copy.wast"
+wasm2c_table__copy__59__wasm_instantiate(&table__copy__59__wasm_instance);
+
+#line 2694 "table_copy.wast"
+w2c_table__copy__59__wasm_test(&table__copy__59__wasm_instance);
+
+#line 2696 "table_copy.wast"
+wasm2c_table__copy__60__wasm_instantiate(&table__copy__60__wasm_instance);
+
+#line 2719 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__60__wasm_test(&table__copy__60__wasm_instance));
+
+#line 2721 "table_copy.wast"
+wasm2c_table__copy__61__wasm_instantiate(&table__copy__61__wasm_instance);
+
+#line 2744 "table_copy.wast"
+w2c_table__copy__61__wasm_test(&table__copy__61__wasm_instance);
+
+#line 2746 "table_copy.wast"
+wasm2c_table__copy__62__wasm_instantiate(&table__copy__62__wasm_instance);
+
+#line 2769 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__62__wasm_test(&table__copy__62__wasm_instance));
+
+#line 2771 "table_copy.wast"
+wasm2c_table__copy__63__wasm_instantiate(&table__copy__63__wasm_instance);
+
+#line 2797 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__63__wasm_run(&table__copy__63__wasm_instance, 24u, 0u, 16u));
+
+#line 2799 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 0u), 0u);
+
+#line 2800 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 1u), 1u);
+
+#line 2801 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 2u), 2u);
+
+#line 2802 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 3u), 3u);
+
+#line 2803 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 4u), 4u);
+
+#line 2804 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 5u), 5u);
+
+#line 2805 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 6u), 6u);
+
+#line 2806 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 7u), 7u);
+
+#line 2807 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 8u));
+
+#line 2808 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 9u));
+
+#line 2809 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 10u));
+
+#line 2810 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 11u));
+
+#line 2811 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 12u));
+
+#line 2812 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 13u));
+
+#line 2813 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 14u));
+
+#line 2814 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 15u));
+
+#line 2815 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 16u));
+
+#line 2816 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 17u));
+
+#line 2817 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 18u));
+
+#line 2818 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 19u));
+
+#line 2819 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 20u));
+
+#line 2820 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 21u));
+
+#line 2821 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 22u));
+
+#line 2822 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 23u));
+
+#line 2823 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 24u));
+
+#line 2824 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 25u));
+
+#line 2825 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 26u));
+
+#line 2826 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 27u));
+
+#line 2827 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 28u));
+
+#line 2828 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 29u));
+
+#line 2829 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 30u));
+
+#line 2830 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__63__wasm_test(&table__copy__63__wasm_instance, 31u));
+
+#line 2832 "table_copy.wast"
+wasm2c_table__copy__64__wasm_instantiate(&table__copy__64__wasm_instance);
+
+#line 2858 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__64__wasm_run(&table__copy__64__wasm_instance, 23u, 0u, 15u));
+
+#line 2860 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 0u), 0u);
+
+#line 2861 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 1u), 1u);
+
+#line 2862 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 2u), 2u);
+
+#line 2863 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 3u), 3u);
+
+#line 2864 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 4u), 4u);
+
+#line 2865 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 5u), 5u);
+
+#line 2866 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 6u), 6u);
+
+#line 2867 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 7u), 7u);
+
+#line 2868 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 8u), 8u);
+
+#line 2869 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 9u));
+
+#line 2870 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 10u));
+
+#line 2871 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 11u));
+
+#line 2872 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 12u));
+
+#line 2873 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 13u));
+
+#line 2874 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 14u));
+
+#line 2875 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 15u));
+
+#line 2876 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 16u));
+
+#line 2877 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 17u));
+
+#line 2878 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 18u));
+
+#line 2879 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 19u));
+
+#line 2880 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 20u));
+
+#line 2881 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 21u));
+
+#line 2882 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 22u));
+
+#line 2883 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 23u));
+
+#line 2884 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 24u));
+
+#line 2885 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 25u));
+
+#line 2886 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 26u));
+
+#line 2887 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 27u));
+
+#line 2888 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 28u));
+
+#line 2889 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 29u));
+
+#line 2890 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 30u));
+
+#line 2891 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__64__wasm_test(&table__copy__64__wasm_instance, 31u));
+
+#line 2893 "table_copy.wast"
+wasm2c_table__copy__65__wasm_instantiate(&table__copy__65__wasm_instance);
+
+#line 2919 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__65__wasm_run(&table__copy__65__wasm_instance, 0u, 24u, 16u));
+
+#line 2921 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 0u));
+
+#line 2922 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 1u));
+
+#line 2923 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 2u));
+
+#line 2924 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 3u));
+
+#line 2925 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 4u));
+
+#line 2926 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 5u));
+
+#line 2927 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 6u));
+
+#line 2928 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 7u));
+
+#line 2929 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 8u));
+
+#line 2930 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 9u));
+
+#line 2931 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 10u));
+
+#line 2932 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 11u));
+
+#line 2933 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 12u));
+
+#line 2934 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 13u));
+
+#line 2935 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 14u));
+
+#line 2936 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 15u));
+
+#line 2937 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 16u));
+
+#line 2938 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 17u));
+
+#line 2939 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 18u));
+
+#line 2940 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 19u));
+
+#line 2941 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 20u));
+
+#line 2942 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 21u));
+
+#line 2943 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 22u));
+
+#line 2944 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 23u));
+
+#line 2945 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 24u), 0u);
+
+#line 2946 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 25u), 1u);
+
+#line 2947 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 26u), 2u);
+
+#line 2948 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 27u), 3u);
+
+#line 2949 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 28u), 4u);
+
+#line 2950 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 29u), 5u);
+
+#line 2951 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 30u), 6u);
+
+#line 2952 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__65__wasm_test(&table__copy__65__wasm_instance, 31u), 7u);
+
+#line 2954 "table_copy.wast"
+wasm2c_table__copy__66__wasm_instantiate(&table__copy__66__wasm_instance);
+
+#line 2980 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__66__wasm_run(&table__copy__66__wasm_instance, 0u, 23u, 15u));
+
+#line 2982 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 0u));
+
+#line 2983 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 1u));
+
+#line 2984 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 2u));
+
+#line 2985 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 3u));
+
+#line 2986 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 4u));
+
+#line 2987 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 5u));
+
+#line 2988 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 6u));
+
+#line 2989 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 7u));
+
+#line 2990 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 8u));
+
+#line 2991 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 9u));
+
+#line 2992 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 10u));
+
+#line 2993 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 11u));
+
+#line 2994 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 12u));
+
+#line 2995 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 13u));
+
+#line 2996 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 14u));
+
+#line 2997 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 15u));
+
+#line 2998 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 16u));
+
+#line 2999 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 17u));
+
+#line 3000 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 18u));
+
+#line 3001 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 19u));
+
+#line 3002 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 20u));
+
+#line 3003 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 21u));
+
+#line 3004 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 22u));
+
+#line 3005 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 23u), 0u);
+
+#line 3006 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 24u), 1u);
+
+#line 3007 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 25u), 2u);
+
+#line 3008 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 26u), 3u);
+
+#line 3009 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 27u), 4u);
+
+#line 3010 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 28u), 5u);
+
+#line 3011 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 29u), 6u);
+
+#line 3012 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 30u), 7u);
+
+#line 3013 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__66__wasm_test(&table__copy__66__wasm_instance, 31u), 8u);
+
+#line 3015 "table_copy.wast"
+wasm2c_table__copy__67__wasm_instantiate(&table__copy__67__wasm_instance);
+
+#line 3041 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__67__wasm_run(&table__copy__67__wasm_instance, 24u, 11u, 16u));
+
+#line 3043 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 0u));
+
+#line 3044 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 1u));
+
+#line 3045 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 2u));
+
+#line 3046 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 3u));
+
+#line 3047 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 4u));
+
+#line 3048 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 5u));
+
+#line 3049 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 6u));
+
+#line 3050 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 7u));
+
+#line 3051 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 8u));
+
+#line 3052 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 9u));
+
+#line 3053 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 10u));
+
+#line 3054 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 11u), 0u);
+
+#line 3055 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 12u), 1u);
+
+#line 3056 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 13u), 2u);
+
+#line 3057 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 14u), 3u);
+
+#line 3058 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 15u), 4u);
+
+#line 3059 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 16u), 5u);
+
+#line 3060 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 17u), 6u);
+
+#line 3061 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 18u), 7u);
+
+#line 3062 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 19u));
+
+#line 3063 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 20u));
+
+#line 3064 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 21u));
+
+#line 3065 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 22u));
+
+#line 3066 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 23u));
+
+#line 3067 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 24u));
+
+#line 3068 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 25u));
+
+#line 3069 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 26u));
+
+#line 3070 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 27u));
+
+#line 3071 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 28u));
+
+#line 3072 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 29u));
+
+#line 3073 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 30u));
+
+#line 3074 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__67__wasm_test(&table__copy__67__wasm_instance, 31u));
+
+#line 3076 "table_copy.wast"
+wasm2c_table__copy__68__wasm_instantiate(&table__copy__68__wasm_instance);
+
+#line 3102 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__68__wasm_run(&table__copy__68__wasm_instance, 11u, 24u, 16u));
+
+#line 3104 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 0u));
+
+#line 3105 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 1u));
+
+#line 3106 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 2u));
+
+#line 3107 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 3u));
+
+#line 3108 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 4u));
+
+#line 3109 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 5u));
+
+#line 3110 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 6u));
+
+#line 3111 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 7u));
+
+#line 3112 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 8u));
+
+#line 3113 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 9u));
+
+#line 3114 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 10u));
+
+#line 3115 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 11u));
+
+#line 3116 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 12u));
+
+#line 3117 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 13u));
+
+#line 3118 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 14u));
+
+#line 3119 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 15u));
+
+#line 3120 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 16u));
+
+#line 3121 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 17u));
+
+#line 3122 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 18u));
+
+#line 3123 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 19u));
+
+#line 3124 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 20u));
+
+#line 3125 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 21u));
+
+#line 3126 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 22u));
+
+#line 3127 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 23u));
+
+#line 3128 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 24u), 0u);
+
+#line 3129 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 25u), 1u);
+
+#line 3130 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 26u), 2u);
+
+#line 3131 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 27u), 3u);
+
+#line 3132 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 28u), 4u);
+
+#line 3133 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 29u), 5u);
+
+#line 3134 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 30u), 6u);
+
+#line 3135 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__68__wasm_test(&table__copy__68__wasm_instance, 31u), 7u);
+
+#line 3137 "table_copy.wast"
+wasm2c_table__copy__69__wasm_instantiate(&table__copy__69__wasm_instance);
+
+#line 3163 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__69__wasm_run(&table__copy__69__wasm_instance, 24u, 21u, 16u));
+
+#line 3165 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 0u));
+
+#line 3166 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 1u));
+
+#line 3167 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 2u));
+
+#line 3168 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 3u));
+
+#line 3169 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 4u));
+
+#line 3170 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 5u));
+
+#line 3171 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 6u));
+
+#line 3172 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 7u));
+
+#line 3173 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 8u));
+
+#line 3174 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 9u));
+
+#line 3175 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 10u));
+
+#line 3176 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 11u));
+
+#line 3177 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 12u));
+
+#line 3178 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 13u));
+
+#line 3179 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 14u));
+
+#line 3180 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 15u));
+
+#line 3181 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 16u));
+
+#line 3182 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 17u));
+
+#line 3183 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 18u));
+
+#line 3184 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 19u));
+
+#line 3185 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 20u));
+
+#line 3186 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 21u), 0u);
+
+#line 3187 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 22u), 1u);
+
+#line 3188 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 23u), 2u);
+
+#line 3189 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 24u), 3u);
+
+#line 3190 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 25u), 4u);
+
+#line 3191 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 26u), 5u);
+
+#line 3192 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 27u), 6u);
+
+#line 3193 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 28u), 7u);
+
+#line 3194 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 29u));
+
+#line 3195 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 30u));
+
+#line 3196 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__69__wasm_test(&table__copy__69__wasm_instance, 31u));
+
+#line 3198 "table_copy.wast"
+wasm2c_table__copy__70__wasm_instantiate(&table__copy__70__wasm_instance);
+
+#line 3224 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__70__wasm_run(&table__copy__70__wasm_instance, 21u, 24u, 16u));
+
+#line 3226 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 0u));
+
+#line 3227 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 1u));
+
+#line 3228 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 2u));
+
+#line 3229 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 3u));
+
+#line 3230 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 4u));
+
+#line 3231 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 5u));
+
+#line 3232 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 6u));
+
+#line 3233 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 7u));
+
+#line 3234 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 8u));
+
+#line 3235 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 9u));
+
+#line 3236 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 10u));
+
+#line 3237 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 11u));
+
+#line 3238 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 12u));
+
+#line 3239 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 13u));
+
+#line 3240 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 14u));
+
+#line 3241 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 15u));
+
+#line 3242 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 16u));
+
+#line 3243 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 17u));
+
+#line 3244 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 18u));
+
+#line 3245 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 19u));
+
+#line 3246 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 20u));
+
+#line 3247 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 21u));
+
+#line 3248 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 22u));
+
+#line 3249 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 23u));
+
+#line 3250 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 24u), 0u);
+
+#line 3251 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 25u), 1u);
+
+#line 3252 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 26u), 2u);
+
+#line 3253 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 27u), 3u);
+
+#line 3254 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 28u), 4u);
+
+#line 3255 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 29u), 5u);
+
+#line 3256 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 30u), 6u);
+
+#line 3257 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__70__wasm_test(&table__copy__70__wasm_instance, 31u), 7u);
+
+#line 3259 "table_copy.wast"
+wasm2c_table__copy__71__wasm_instantiate(&table__copy__71__wasm_instance);
+
+#line 3285 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__71__wasm_run(&table__copy__71__wasm_instance, 21u, 21u, 16u));
+
+#line 3287 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 0u));
+
+#line 3288 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 1u));
+
+#line 3289 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 2u));
+
+#line 3290 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 3u));
+
+#line 3291 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 4u));
+
+#line 3292 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 5u));
+
+#line 3293 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 6u));
+
+#line 3294 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 7u));
+
+#line 3295 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 8u));
+
+#line 3296 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 9u));
+
+#line 3297 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 10u));
+
+#line 3298 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 11u));
+
+#line 3299 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 12u));
+
+#line 3300 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 13u));
+
+#line 3301 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 14u));
+
+#line 3302 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 15u));
+
+#line 3303 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 16u));
+
+#line 3304 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 17u));
+
+#line 3305 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 18u));
+
+#line 3306 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 19u));
+
+#line 3307 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 20u));
+
+#line 3308 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 21u), 0u);
+
+#line 3309 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 22u), 1u);
+
+#line 3310 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 23u), 2u);
+
+#line 3311 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 24u), 3u);
+
+#line 3312 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 25u), 4u);
+
+#line 3313 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 26u), 5u);
+
+#line 3314 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 27u), 6u);
+
+#line 3315 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 28u), 7u);
+
+#line 3316 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 29u), 8u);
+
+#line 3317 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 30u), 9u);
+
+#line 3318 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__71__wasm_test(&table__copy__71__wasm_instance, 31u), 10u);
+
+#line 3320 "table_copy.wast"
+wasm2c_table__copy__72__wasm_instantiate(&table__copy__72__wasm_instance);
+
+#line 3346 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_run(&table__copy__72__wasm_instance, 0u, 112u, 4294967264u));
+
+#line 3348 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 0u));
+
+#line 3349 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 1u));
+
+#line 3350 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 2u));
+
+#line 3351 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 3u));
+
+#line 3352 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 4u));
+
+#line 3353 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 5u));
+
+#line 3354 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 6u));
+
+#line 3355 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 7u));
+
+#line 3356 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 8u));
+
+#line 3357 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 9u));
+
+#line 3358 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 10u));
+
+#line 3359 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 11u));
+
+#line 3360 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 12u));
+
+#line 3361 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 13u));
+
+#line 3362 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 14u));
+
+#line 3363 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 15u));
+
+#line 3364 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 16u));
+
+#line 3365 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 17u));
+
+#line 3366 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 18u));
+
+#line 3367 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 19u));
+
+#line 3368 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 20u));
+
+#line 3369 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 21u));
+
+#line 3370 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 22u));
+
+#line 3371 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 23u));
+
+#line 3372 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 24u));
+
+#line 3373 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 25u));
+
+#line 3374 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 26u));
+
+#line 3375 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 27u));
+
+#line 3376 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 28u));
+
+#line 3377 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 29u));
+
+#line 3378 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 30u));
+
+#line 3379 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 31u));
+
+#line 3380 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 32u));
+
+#line 3381 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 33u));
+
+#line 3382 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 34u));
+
+#line 3383 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 35u));
+
+#line 3384 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 36u));
+
+#line 3385 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 37u));
+
+#line 3386 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 38u));
+
+#line 3387 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 39u));
+
+#line 3388 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 40u));
+
+#line 3389 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 41u));
+
+#line 3390 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 42u));
+
+#line 3391 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 43u));
+
+#line 3392 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 44u));
+
+#line 3393 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 45u));
+
+#line 3394 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 46u));
+
+#line 3395 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 47u));
+
+#line 3396 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 48u));
+
+#line 3397 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 49u));
+
+#line 3398 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 50u));
+
+#line 3399 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 51u));
+
+#line 3400 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 52u));
+
+#line 3401 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 53u));
+
+#line 3402 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 54u));
+
+#line 3403 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 55u));
+
+#line 3404 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 56u));
+
+#line 3405 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 57u));
+
+#line 3406 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 58u));
+
+#line 3407 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 59u));
+
+#line 3408 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 60u));
+
+#line 3409 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 61u));
+
+#line 3410 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 62u));
+
+#line 3411 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 63u));
+
+#line 3412 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 64u));
+
+#line 3413 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 65u));
+
+#line 3414 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 66u));
+
+#line 3415 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 67u));
+
+#line 3416 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 68u));
+
+#line 3417 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 69u));
+
+#line 3418 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 70u));
+
+#line 3419 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 71u));
+
+#line 3420 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 72u));
+
+#line 3421 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 73u));
+
+#line 3422 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 74u));
+
+#line 3423 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 75u));
+
+#line 3424 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 76u));
+
+#line 3425 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 77u));
+
+#line 3426 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 78u));
+
+#line 3427 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 79u));
+
+#line 3428 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 80u));
+
+#line 3429 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 81u));
+
+#line 3430 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 82u));
+
+#line 3431 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 83u));
+
+#line 3432 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 84u));
+
+#line 3433 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 85u));
+
+#line 3434 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 86u));
+
+#line 3435 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 87u));
+
+#line 3436 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 88u));
+
+#line 3437 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 89u));
+
+#line 3438 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 90u));
+
+#line 3439 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 91u));
+
+#line 3440 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 92u));
+
+#line 3441 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 93u));
+
+#line 3442 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 94u));
+
+#line 3443 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 95u));
+
+#line 3444 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 96u));
+
+#line 3445 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 97u));
+
+#line 3446 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 98u));
+
+#line 3447 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 99u));
+
+#line 3448 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 100u));
+
+#line 3449 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 101u));
+
+#line 3450 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 102u));
+
+#line 3451 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 103u));
+
+#line 3452 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 104u));
+
+#line 3453 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 105u));
+
+#line 3454 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 106u));
+
+#line 3455 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 107u));
+
+#line 3456 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 108u));
+
+#line 3457 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 109u));
+
+#line 3458 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 110u));
+
+#line 3459 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 111u));
+
+#line 3460 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 112u), 0u);
+
+#line 3461 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 113u), 1u);
+
+#line 3462 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 114u), 2u);
+
+#line 3463 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 115u), 3u);
+
+#line 3464 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 116u), 4u);
+
+#line 3465 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 117u), 5u);
+
+#line 3466 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 118u), 6u);
+
+#line 3467 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 119u), 7u);
+
+#line 3468 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 120u), 8u);
+
+#line 3469 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 121u), 9u);
+
+#line 3470 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 122u), 10u);
+
+#line 3471 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 123u), 11u);
+
+#line 3472 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 124u), 12u);
+
+#line 3473 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 125u), 13u);
+
+#line 3474 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 126u), 14u);
+
+#line 3475 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__72__wasm_test(&table__copy__72__wasm_instance, 127u), 15u);
+
+#line 3477 "table_copy.wast"
+wasm2c_table__copy__73__wasm_instantiate(&table__copy__73__wasm_instance);
+
+#line 3503 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_run(&table__copy__73__wasm_instance, 112u, 0u, 4294967264u));
+
+#line 3505 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 0u), 0u);
+
+#line 3506 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 1u), 1u);
+
+#line 3507 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 2u), 2u);
+
+#line 3508 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 3u), 3u);
+
+#line 3509 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 4u), 4u);
+
+#line 3510 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 5u), 5u);
+
+#line 3511 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 6u), 6u);
+
+#line 3512 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 7u), 7u);
+
+#line 3513 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 8u), 8u);
+
+#line 3514 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 9u), 9u);
+
+#line 3515 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 10u), 10u);
+
+#line 3516 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 11u), 11u);
+
+#line 3517 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 12u), 12u);
+
+#line 3518 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 13u), 13u);
+
+#line 3519 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 14u), 14u);
+
+#line 3520 "table_copy.wast"
+ASSERT_RETURN_I32(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 15u), 15u);
+
+#line 3521 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 16u));
+
+#line 3522 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 17u));
+
+#line 3523 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 18u));
+
+#line 3524 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 19u));
+
+#line 3525 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 20u));
+
+#line 3526 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 21u));
+
+#line 3527 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 22u));
+
+#line 3528 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 23u));
+
+#line 3529 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 24u));
+
+#line 3530 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 25u));
+
+#line 3531 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 26u));
+
+#line 3532 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 27u));
+
+#line 3533 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 28u));
+
+#line 3534 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 29u));
+
+#line 3535 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 30u));
+
+#line 3536 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 31u));
+
+#line 3537 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 32u));
+
+#line 3538 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 33u));
+
+#line 3539 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 34u));
+
+#line 3540 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 35u));
+
+#line 3541 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 36u));
+
+#line 3542 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 37u));
+
+#line 3543 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 38u));
+
+#line 3544 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 39u));
+
+#line 3545 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 40u));
+
+#line 3546 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 41u));
+
+#line 3547 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 42u));
+
+#line 3548 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 43u));
+
+#line 3549 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 44u));
+
+#line 3550 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 45u));
+
+#line 3551 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 46u));
+
+#line 3552 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 47u));
+
+#line 3553 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 48u));
+
+#line 3554 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 49u));
+
+#line 3555 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 50u));
+
+#line 3556 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 51u));
+
+#line 3557 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 52u));
+
+#line 3558 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 53u));
+
+#line 3559 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 54u));
+
+#line 3560 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 55u));
+
+#line 3561 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 56u));
+
+#line 3562 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 57u));
+
+#line 3563 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 58u));
+
+#line 3564 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 59u));
+
+#line 3565 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 60u));
+
+#line 3566 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 61u));
+
+#line 3567 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 62u));
+
+#line 3568 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 63u));
+
+#line 3569 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 64u));
+
+#line 3570 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 65u));
+
+#line 3571 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 66u));
+
+#line 3572 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 67u));
+
+#line 3573 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 68u));
+
+#line 3574 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 69u));
+
+#line 3575 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 70u));
+
+#line 3576 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 71u));
+
+#line 3577 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 72u));
+
+#line 3578 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 73u));
+
+#line 3579 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 74u));
+
+#line 3580 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 75u));
+
+#line 3581 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 76u));
+
+#line 3582 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 77u));
+
+#line 3583 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 78u));
+
+#line 3584 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 79u));
+
+#line 3585 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 80u));
+
+#line 3586 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 81u));
+
+#line 3587 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 82u));
+
+#line 3588 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 83u));
+
+#line 3589 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 84u));
+
+#line 3590 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 85u));
+
+#line 3591 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 86u));
+
+#line 3592 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 87u));
+
+#line 3593 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 88u));
+
+#line 3594 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 89u));
+
+#line 3595 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 90u));
+
+#line 3596 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 91u));
+
+#line 3597 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 92u));
+
+#line 3598 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 93u));
+
+#line 3599 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 94u));
+
+#line 3600 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 95u));
+
+#line 3601 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 96u));
+
+#line 3602 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 97u));
+
+#line 3603 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 98u));
+
+#line 3604 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 99u));
+
+#line 3605 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 100u));
+
+#line 3606 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 101u));
+
+#line 3607 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 102u));
+
+#line 3608 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 103u));
+
+#line 3609 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 104u));
+
+#line 3610 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 105u));
+
+#line 3611 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 106u));
+
+#line 3612 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 107u));
+
+#line 3613 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 108u));
+
+#line 3614 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 109u));
+
+#line 3615 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 110u));
+
+#line 3616 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 111u));
+
+#line 3617 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 112u));
+
+#line 3618 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 113u));
+
+#line 3619 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 114u));
+
+#line 3620 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 115u));
+
+#line 3621 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 116u));
+
+#line 3622 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 117u));
+
+#line 3623 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 118u));
+
+#line 3624 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 119u));
+
+#line 3625 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 120u));
+
+#line 3626 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 121u));
+
+#line 3627 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 122u));
+
+#line 3628 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 123u));
+
+#line 3629 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 124u));
+
+#line 3630 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 125u));
+
+#line 3631 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 126u));
+
+#line 3632 "table_copy.wast"
+ASSERT_TRAP(w2c_table__copy__73__wasm_test(&table__copy__73__wasm_instance, 127u));
+
+
+}
+
+void run_spec_tests(void) {
+
+run_spec_tests_0();
+run_spec_tests_1();
+wasm2c_a_free(&a_instance);
+wasm2c_table__copy__1__wasm_free(&table__copy__1__wasm_instance);
+wasm2c_table__copy__2__wasm_free(&table__copy__2__wasm_instance);
+wasm2c_table__copy__3__wasm_free(&table__copy__3__wasm_instance);
+wasm2c_table__copy__4__wasm_free(&table__copy__4__wasm_instance);
+wasm2c_table__copy__5__wasm_free(&table__copy__5__wasm_instance);
+wasm2c_table__copy__6__wasm_free(&table__copy__6__wasm_instance);
+wasm2c_table__copy__7__wasm_free(&table__copy__7__wasm_instance);
+wasm2c_table__copy__8__wasm_free(&table__copy__8__wasm_instance);
+wasm2c_table__copy__9__wasm_free(&table__copy__9__wasm_instance);
+wasm2c_table__copy__10__wasm_free(&table__copy__10__wasm_instance);
+wasm2c_table__copy__11__wasm_free(&table__copy__11__wasm_instance);
+wasm2c_table__copy__12__wasm_free(&table__copy__12__wasm_instance);
+wasm2c_table__copy__13__wasm_free(&table__copy__13__wasm_instance);
+wasm2c_table__copy__14__wasm_free(&table__copy__14__wasm_instance);
+wasm2c_table__copy__15__wasm_free(&table__copy__15__wasm_instance);
+wasm2c_table__copy__16__wasm_free(&table__copy__16__wasm_instance);
+wasm2c_table__copy__17__wasm_free(&table__copy__17__wasm_instance);
+wasm2c_table__copy__18__wasm_free(&table__copy__18__wasm_instance);
+wasm2c_table__copy__19__wasm_free(&table__copy__19__wasm_instance);
+wasm2c_table__copy__20__wasm_free(&table__copy__20__wasm_instance);
+wasm2c_table__copy__21__wasm_free(&table__copy__21__wasm_instance);
+wasm2c_table__copy__22__wasm_free(&table__copy__22__wasm_instance);
+wasm2c_table__copy__23__wasm_free(&table__copy__23__wasm_instance);
+wasm2c_table__copy__24__wasm_free(&table__copy__24__wasm_instance);
+wasm2c_table__copy__25__wasm_free(&table__copy__25__wasm_instance);
+wasm2c_table__copy__26__wasm_free(&table__copy__26__wasm_instance);
+wasm2c_table__copy__27__wasm_free(&table__copy__27__wasm_instance);
+wasm2c_table__copy__28__wasm_free(&table__copy__28__wasm_instance);
+wasm2c_table__copy__29__wasm_free(&table__copy__29__wasm_instance);
+wasm2c_table__copy__30__wasm_free(&table__copy__30__wasm_instance);
+wasm2c_table__copy__31__wasm_free(&table__copy__31__wasm_instance);
+wasm2c_table__copy__32__wasm_free(&table__copy__32__wasm_instance);
+wasm2c_table__copy__33__wasm_free(&table__copy__33__wasm_instance);
+wasm2c_table__copy__34__wasm_free(&table__copy__34__wasm_instance);
+wasm2c_table__copy__35__wasm_free(&table__copy__35__wasm_instance);
+wasm2c_table__copy__36__wasm_free(&table__copy__36__wasm_instance);
+wasm2c_table__copy__37__wasm_free(&table__copy__37__wasm_instance);
+wasm2c_table__copy__38__wasm_free(&table__copy__38__wasm_instance);
+wasm2c_table__copy__39__wasm_free(&table__copy__39__wasm_instance);
+wasm2c_table__copy__40__wasm_free(&table__copy__40__wasm_instance);
+wasm2c_table__copy__41__wasm_free(&table__copy__41__wasm_instance);
+wasm2c_table__copy__42__wasm_free(&table__copy__42__wasm_instance);
+wasm2c_table__copy__43__wasm_free(&table__copy__43__wasm_instance);
+wasm2c_table__copy__44__wasm_free(&table__copy__44__wasm_instance);
+wasm2c_table__copy__45__wasm_free(&table__copy__45__wasm_instance);
+wasm2c_table__copy__46__wasm_free(&table__copy__46__wasm_instance);
+wasm2c_table__copy__47__wasm_free(&table__copy__47__wasm_instance);
+wasm2c_table__copy__48__wasm_free(&table__copy__48__wasm_instance);
+wasm2c_table__copy__49__wasm_free(&table__copy__49__wasm_instance);
+wasm2c_table__copy__50__wasm_free(&table__copy__50__wasm_instance);
+wasm2c_table__copy__51__wasm_free(&table__copy__51__wasm_instance);
+wasm2c_table__copy__52__wasm_free(&table__copy__52__wasm_instance);
+wasm2c_table__copy__53__wasm_free(&table__copy__53__wasm_instance);
+wasm2c_table__copy__54__wasm_free(&table__copy__54__wasm_instance);
+wasm2c_table__copy__55__wasm_free(&table__copy__55__wasm_instance);
+wasm2c_table__copy__56__wasm_free(&table__copy__56__wasm_instance);
+wasm2c_table__copy__57__wasm_free(&table__copy__57__wasm_instance);
+wasm2c_table__copy__58__wasm_free(&table__copy__58__wasm_instance);
+wasm2c_table__copy__59__wasm_free(&table__copy__59__wasm_instance);
+wasm2c_table__copy__60__wasm_free(&table__copy__60__wasm_instance);
+wasm2c_table__copy__61__wasm_free(&table__copy__61__wasm_instance);
+wasm2c_table__copy__62__wasm_free(&table__copy__62__wasm_instance);
+wasm2c_table__copy__63__wasm_free(&table__copy__63__wasm_instance);
+wasm2c_table__copy__64__wasm_free(&table__copy__64__wasm_instance);
+wasm2c_table__copy__65__wasm_free(&table__copy__65__wasm_instance);
+wasm2c_table__copy__66__wasm_free(&table__copy__66__wasm_instance);
+wasm2c_table__copy__67__wasm_free(&table__copy__67__wasm_instance);
+wasm2c_table__copy__68__wasm_free(&table__copy__68__wasm_instance);
+wasm2c_table__copy__69__wasm_free(&table__copy__69__wasm_instance);
+wasm2c_table__copy__70__wasm_free(&table__copy__70__wasm_instance);
+wasm2c_table__copy__71__wasm_free(&table__copy__71__wasm_instance);
+wasm2c_table__copy__72__wasm_free(&table__copy__72__wasm_instance);
+wasm2c_table__copy__73__wasm_free(&table__copy__73__wasm_instance);
+
+}
@@ -0,0 +1,69 @@
+/* Automatically generated by wasm2c */
+#ifndef TABLE_COPY_18_H_GENERATED_
+#define TABLE_COPY_18_H_GENERATED_
+
+#include "wasm-rt.h"
+
+#include <stdint.h>
+
+#ifndef WASM_RT_CORE_TYPES_DEFINED
+#define WASM_RT_CORE_TYPES_DEFINED
+typedef uint8_t u8;
+typedef int8_t s8;
+typedef uint16_t u16;
+typedef int16_t s16;
+typedef uint32_t u32;
+typedef int32_t s32;
+typedef uint64_t u64;
+typedef int64_t s64;
+typedef float f32;
+typedef double f64;
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct w2c_a;
+
+typedef struct w2c_table__copy__18__wasm {
+  struct w2c_a* w2c_a_instance;
+  wasm_rt_funcref_table_t w2c_T0;
+  wasm_rt_funcref_table_t w2c_T1;
+  bool elem_segment_dropped_w2c_table__copy__18__wasm_e1 : 1;
+  bool elem_segment_dropped_w2c_table__copy__18__wasm_e3 : 1;
+} w2c_table__copy__18__wasm;
+
+void wasm2c_table__copy__18__wasm_instantiate(w2c_table__copy__18__wasm*, struct w2c_a*);
+void wasm2c_table__copy__18__wasm_free(w2c_table__copy__18__wasm*);
+wasm_rt_func_type_t wasm2c_table__copy__18__wasm_get_func_type(uint32_t param_count, uint32_t result_count, ...);
+
+/* import: 'a' 'ef0' */
+u32 w2c_a_ef0(struct w2c_a*);
+
+/* import: 'a' 'ef1' */
+u32 w2c_a_ef1(struct w2c_a*);
+
+/* import: 'a' 'ef2' */
+u32 w2c_a_ef2(struct w2c_a*);
+
+/* import: 'a' 'ef3' */
+u32 w2c_a_ef3(struct w2c_a*);
+
+/* import: 'a' 'ef4' */
+u32 w2c_a_ef4(struct w2c_a*);
+
+/* export: 'test' */
+void w2c_table__copy__18__wasm_test(w2c_table__copy__18__wasm*);
+
+/* export: 'check_t0' */
+u32 w2c_table__copy__18__wasm_check_t0(w2c_table__copy__18__wasm*, u32);
+
+/* export: 'check_t1' */
+u32 w2c_table__copy__18__wasm_check_t1(w2c_table__copy__18__wasm*, u32);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* TABLE_COPY_18_H_GENERATED_ */
@@ -0,0 +1,93 @@
+/* Automatically generated by wasm2c */
+#ifndef TABLE_COPY_73_H_GENERATED_
+#define TABLE_COPY_73_H_GENERATED_
+
+#include "wasm-rt.h"
+
+#include <stdint.h>
+
+#ifndef WASM_RT_CORE_TYPES_DEFINED
+#define WASM_RT_CORE_TYPES_DEFINED
+typedef uint8_t u8;
+typedef int8_t s8;
+typedef uint16_t u16;
+typedef int16_t s16;
+typedef uint32_t u32;
+typedef int32_t s32;
+typedef uint64_t u64;
+typedef int64_t s64;
+typedef float f32;
+typedef double f64;
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct w2c_table__copy__73__wasm {
+  wasm_rt_funcref_table_t w2c_T0;
+} w2c_table__copy__73__wasm;
+
+void wasm2c_table__copy__73__wasm_instantiate(w2c_table__copy__73__wasm*);
+void wasm2c_table__copy__73__wasm_free(w2c_table__copy__73__wasm*);
+wasm_rt_func_type_t wasm2c_table__copy__73__wasm_get_func_type(uint32_t param_count, uint32_t result_count, ...);
+
+/* export: 'f0' */
+u32 w2c_table__copy__73__wasm_f0(w2c_table__copy__73__wasm*);
+
+/* export: 'f1' */
+u32 w2c_table__copy__73__wasm_f1(w2c_table__copy__73__wasm*);
+
+/* export: 'f2' */
+u32 w2c_table__copy__73__wasm_f2(w2c_table__copy__73__wasm*);
+
+/* export: 'f3' */
+u32 w2c_table__copy__73__wasm_f3(w2c_table__copy__73__wasm*);
+
+/* export: 'f4' */
+u32 w2c_table__copy__73__wasm_f4(w2c_table__copy__73__wasm*);
+
+/* export: 'f5' */
+u32 w2c_table__copy__73__wasm_f5(w2c_table__copy__73__wasm*);
+
+/* export: 'f6' */
+u32 w2c_table__copy__73__wasm_f6(w2c_table__copy__73__wasm*);
+
+/* export: 'f7' */
+u32 w2c_table__copy__73__wasm_f7(w2c_table__copy__73__wasm*);
+
+/* export: 'f8' */
+u32 w2c_table__copy__73__wasm_f8(w2c_table__copy__73__wasm*);
+
+/* export: 'f9' */
+u32 w2c_table__copy__73__wasm_f9(w2c_table__copy__73__wasm*);
+
+/* export: 'f10' */
+u32 w2c_table__copy__73__wasm_f10(w2c_table__copy__73__wasm*);
+
+/* export: 'f11' */
+u32 w2c_table__copy__73__wasm_f11(w2c_table__copy__73__wasm*);
+
+/* export: 'f12' */
+u32 w2c_table__copy__73__wasm_f12(w2c_table__copy__73__wasm*);
+
+/* export: 'f13' */
+u32 w2c_table__copy__73__wasm_f13(w2c_table__copy__73__wasm*);
+
+/* export: 'f14' */
+u32 w2c_table__copy__73__wasm_f14(w2c_table__copy__73__wasm*);
+
+/* export: 'f15' */
+u32 w2c_table__copy__73__wasm_f15(w2c_table__copy__73__wasm*);
+
+/* export: 'test' */
+u32 w2c_table__copy__73__wasm_test(w2c_table__copy__73__wasm*, u32);
+
+/* export: 'run' */
+void w2c_table__copy__73__wasm_run(w2c_table__copy__73__wasm*, u32, u32, u32);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* TABLE_COPY_73_H_GENERATED_ */
@@ -0,0 +1,56 @@
+/* Automatically generated by wasm2c */
+#ifndef TABLE_GET_0_H_GENERATED_
+#define TABLE_GET_0_H_GENERATED_
+
+#include "wasm-rt.h"
+
+#include <stdint.h>
+
+#ifndef WASM_RT_CORE_TYPES_DEFINED
+#define WASM_RT_CORE_TYPES_DEFINED
+typedef uint8_t u8;
+typedef int8_t s8;
+typedef uint16_t u16;
+typedef int16_t s16;
+typedef uint32_t u32;
+typedef int32_t s32;
+typedef uint64_t u64;
+typedef int64_t s64;
+typedef float f32;
+typedef double f64;
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct w2c_table__get__0__wasm {
+  wasm_rt_externref_table_t w2c_T0;
+  wasm_rt_funcref_table_t w2c_T1;
+  wasm_rt_funcref_table_t w2c_T2;
+} w2c_table__get__0__wasm;
+
+void wasm2c_table__get__0__wasm_instantiate(w2c_table__get__0__wasm*);
+void wasm2c_table__get__0__wasm_free(w2c_table__get__0__wasm*);
+wasm_rt_func_type_t wasm2c_table__get__0__wasm_get_func_type(uint32_t param_count, uint32_t result_count, ...);
+
+/* export: 'init' */
+void w2c_table__get__0__wasm_init(w2c_table__get__0__wasm*, wasm_rt_externref_t);
+
+/* export: 'get-externref' */
+wasm_rt_externref_t w2c_table__get__0__wasm_get0x2Dexternref(w2c_table__get__0__wasm*, u32);
+
+/* export: 'get-funcref' */
+wasm_rt_funcref_t w2c_table__get__0__wasm_get0x2Dfuncref(w2c_table__get__0__wasm*, u32);
+
+/* export: 'get-funcref-t64' */
+wasm_rt_funcref_t w2c_table__get__0__wasm_get0x2Dfuncref0x2Dt64(w2c_table__get__0__wasm*, u64);
+
+/* export: 'is_null-funcref' */
+u32 w2c_table__get__0__wasm_is_null0x2Dfuncref(w2c_table__get__0__wasm*, u32);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* TABLE_GET_0_H_GENERATED_ */
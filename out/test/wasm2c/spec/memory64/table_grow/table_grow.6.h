@@ -0,0 +1,52 @@
+/* Automatically generated by wasm2c */
+#ifndef TABLE_GROW_6_H_GENERATED_
+#define TABLE_GROW_6_H_GENERATED_
+
+#include "wasm-rt.h"
+
+#include <stdint.h>
+
+#ifndef WASM_RT_CORE_TYPES_DEFINED
+#define WASM_RT_CORE_TYPES_DEFINED
+typedef uint8_t u8;
+typedef int8_t s8;
+typedef uint16_t u16;
+typedef int16_t s16;
+typedef uint32_t u32;
+typedef int32_t s32;
+typedef uint64_t u64;
+typedef int64_t s64;
+typedef float f32;
+typedef double f64;
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct w2c_grown0x2Dtable;
+extern wasm_rt_funcref_table_t* w2c_grown0x2Dtable_table(struct w2c_grown0x2Dtable*);
+
+typedef struct w2c_grown0x2Dimported0x2Dtable {
+  /* import: 'grown-table' 'table' */
+  wasm_rt_funcref_table_t *w2c_grown0x2Dtable_table;
+} w2c_grown0x2Dimported0x2Dtable;
+
+void wasm2c_grown0x2Dimported0x2Dtable_instantiate(w2c_grown0x2Dimported0x2Dtable*, struct w2c_grown0x2Dtable*);
+void wasm2c_grown0x2Dimported0x2Dtable_free(w2c_grown0x2Dimported0x2Dtable*);
+wasm_rt_func_type_t wasm2c_grown0x2Dimported0x2Dtable_get_func_type(uint32_t param_count, uint32_t result_count, ...);
+
+extern const u32 wasm2c_grown0x2Dimported0x2Dtable_min_grown0x2Dtable_table;
+extern const u32 wasm2c_grown0x2Dimported0x2Dtable_max_grown0x2Dtable_table;
+
+/* export: 'table' */
+wasm_rt_funcref_table_t* w2c_grown0x2Dimported0x2Dtable_table(w2c_grown0x2Dimported0x2Dtable* instance);
+
+/* export: 'grow' */
+u32 w2c_grown0x2Dimported0x2Dtable_grow(w2c_grown0x2Dimported0x2Dtable*);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* TABLE_GROW_6_H_GENERATED_ */
@@ -0,0 +1,49 @@
+/* Automatically generated by wasm2c */
+#ifndef TABLE_GROW_7_H_GENERATED_
+#define TABLE_GROW_7_H_GENERATED_
+
+#include "wasm-rt.h"
+
+#include <stdint.h>
+
+#ifndef WASM_RT_CORE_TYPES_DEFINED
+#define WASM_RT_CORE_TYPES_DEFINED
+typedef uint8_t u8;
+typedef int8_t s8;
+typedef uint16_t u16;
+typedef int16_t s16;
+typedef uint32_t u32;
+typedef int32_t s32;
+typedef uint64_t u64;
+typedef int64_t s64;
+typedef float f32;
+typedef double f64;
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct w2c_grown0x2Dimported0x2Dtable;
+extern wasm_rt_funcref_table_t* w2c_grown0x2Dimported0x2Dtable_table(struct w2c_grown0x2Dimported0x2Dtable*);
+
+typedef struct w2c_table__grow__7__wasm {
+  /* import: 'grown-imported-table' 'table' */
+  wasm_rt_funcref_table_t *w2c_grown0x2Dimported0x2Dtable_table;
+} w2c_table__grow__7__wasm;
+
+void wasm2c_table__grow__7__wasm_instantiate(w2c_table__grow__7__wasm*, struct w2c_grown0x2Dimported0x2Dtable*);
+void wasm2c_table__grow__7__wasm_free(w2c_table__grow__7__wasm*);
+wasm_rt_func_type_t wasm2c_table__grow__7__wasm_get_func_type(uint32_t param_count, uint32_t result_count, ...);
+
+extern const u32 wasm2c_table__grow__7__wasm_min_grown0x2Dimported0x2Dtable_table;
+extern const u32 wasm2c_table__grow__7__wasm_max_grown0x2Dimported0x2Dtable_table;
+
+/* export: 'size' */
+u32 w2c_table__grow__7__wasm_size(w2c_table__grow__7__wasm*);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* TABLE_GROW_7_H_GENERATED_ */
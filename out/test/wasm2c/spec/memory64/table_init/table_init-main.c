@@ -0,0 +1,3052 @@
+#include "table_init.0.h"
+#include "table_init.1.h"
+#include "table_init.2.h"
+#include "table_init.3.h"
+#include "table_init.4.h"
+#include "table_init.5.h"
+#include "table_init.6.h"
+#include "table_init.7.h"
+#include "table_init.8.h"
+#include "table_init.9.h"
+#include "table_init.14.h"
+#include "table_init.15.h"
+#include "table_init.16.h"
+#include "table_init.17.h"
+#include "table_init.18.h"
+#include "table_init.19.h"
+#include "table_init.20.h"
+#include "table_init.21.h"
+#include "table_init.22.h"
+#include "table_init.23.h"
+#include "table_init.24.h"
+#include "table_init.25.h"
+#include "table_init.26.h"
+#include "table_init.27.h"
+#include "table_init.28.h"
+#include "table_init.29.h"
+#include "table_init.30.h"
+#include "table_init.31.h"
+#include "table_init.32.h"
+#include "table_init.33.h"
+#include "table_init.34.h"
+#include "table_init.98.h"
+#include "table_init.99.h"
+#include "table_init.100.h"
+#include "table_init.101.h"
+#include "table_init.102.h"
+#include "table_init.103.h"
+#include "table_init.104.h"
+#include <assert.h>
+#define __STDC_FORMAT_MACROS
+#include <inttypes.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "wasm-rt.h"
+#include "wasm-rt-impl.h"
+#include "wasm-rt-exceptions.h"
+
+/* NOTE: function argument evaluation order is implementation-defined in C,
+   so it SHOULD NOT be relied on by tests. */
+#if WABT_BIG_ENDIAN
+#define v128_i8x16_make(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p) \
+	simde_wasm_i8x16_make(p,o,n,m,l,k,j,i,h,g,f,e,d,c,b,a)
+#define v128_u8x16_make(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p) \
+	simde_wasm_u8x16_make(p,o,n,m,l,k,j,i,h,g,f,e,d,c,b,a)
+#define v128_i16x8_make(a,b,c,d,e,f,g,h) simde_wasm_i16x8_make(h,g,f,e,d,c,b,a)
+#define v128_u16x8_make(a,b,c,d,e,f,g,h) simde_wasm_u16x8_make(h,g,f,e,d,c,b,a)
+#define v128_i32x4_make(a,b,c,d) simde_wasm_i32x4_make(d,c,b,a)
+#define v128_u32x4_make(a,b,c,d) simde_wasm_u32x4_make(d,c,b,a)
+#define v128_i64x2_make(a,b) simde_wasm_i64x2_make(b,a)
+#define v128_u64x2_make(a,b) simde_wasm_u64x2_make(b,a)
+#define v128_f32x4_make(a,b,c,d) simde_wasm_f32x4_make(d,c,b,a)
+#define v128_f64x2_make(a,b) simde_wasm_f64x2_make(b,a)
+#define v128_i8x16_extract_lane(a,n) simde_wasm_u8x16_extract_lane(a,15-(n))
+#define v128_u8x16_extract_lane(a,n) simde_wasm_u8x16_extract_lane(a,15-(n))
+#define v128_i16x8_extract_lane(a,n) simde_wasm_u16x8_extract_lane(a,7-(n))
+#define v128_u16x8_extract_lane(a,n) simde_wasm_u16x8_extract_lane(a,7-(n))
+#define v128_i32x4_extract_lane(a,n) simde_wasm_u32x4_extract_lane(a,3-(n))
+#define v128_u32x4_extract_lane(a,n) simde_wasm_u32x4_extract_lane(a,3-(n))
+#define v128_i64x2_extract_lane(a,n) simde_wasm_u64x2_extract_lane(a,1-(n))
+#define v128_u64x2_extract_lane(a,n) simde_wasm_u64x2_extract_lane(a,1-(n))
+#define v128_f32x4_extract_lane(a,n) simde_wasm_f32x4_extract_lane(a,3-(n))
+#define v128_f64x2_extract_lane(a,n) simde_wasm_f64x2_extract_lane(a,1-(n))
+#else
+#define v128_i8x16_make simde_wasm_i8x16_make
+#define v128_u8x16_make simde_wasm_u8x16_make
+#define v128_i16x8_make simde_wasm_i16x8_make
+#define v128_u16x8_make simde_wasm_u16x8_make
+#define v128_i32x4_make simde_wasm_i32x4_make
+#define v128_u32x4_make simde_wasm_u32x4_make
+#define v128_i64x2_make simde_wasm_i64x2_make
+#define v128_u64x2_make simde_wasm_u64x2_make
+#define v128_f32x4_make simde_wasm_f32x4_make
+#define v128_f64x2_make simde_wasm_f64x2_make
+// like is_equal_TYPE below, always use unsigned for these
+#define v128_i8x16_extract_lane simde_wasm_u8x16_extract_lane
+#define v128_u8x16_extract_lane simde_wasm_u8x16_extract_lane
+#define v128_i16x8_extract_lane simde_wasm_u16x8_extract_lane
+#define v128_u16x8_extract_lane simde_wasm_u16x8_extract_lane
+#define v128_i32x4_extract_lane simde_wasm_u32x4_extract_lane
+#define v128_u32x4_extract_lane simde_wasm_u32x4_extract_lane
+#define v128_i64x2_extract_lane simde_wasm_u64x2_extract_lane
+#define v128_u64x2_extract_lane simde_wasm_u64x2_extract_lane
+#define v128_f32x4_extract_lane simde_wasm_f32x4_extract_lane
+#define v128_f64x2_extract_lane simde_wasm_f64x2_extract_lane
+#endif
+
+static int g_tests_run;
+static int g_tests_passed;
+
+static void run_spec_tests(void);
+
+static void error(const char* file, int line, const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  fprintf(stderr, "%s:%d: assertion failed: ", file, line);
+  vfprintf(stderr, format, args);
+  va_end(args);
+}
+
+#define ASSERT_EXCEPTION(f)                                               \
+  do {                                                                    \
+    g_tests_run++;                                                        \
+    if (wasm_rt_impl_try() == WASM_RT_TRAP_UNCAUGHT_EXCEPTION) {          \
+      g_tests_passed++;                                                   \
+    } else {                                                              \
+      (void)(f);                                                          \
+      error(__FILE__, __LINE__, "expected " #f " to throw exception.\n"); \
+    }                                                                     \
+  } while (0)
+
+#define ASSERT_TRAP(f)                                         \
+  do {                                                         \
+    g_tests_run++;                                             \
+    if (wasm_rt_impl_try() != 0) {                             \
+      g_tests_passed++;                                        \
+    } else {                                                   \
+      (void)(f);                                               \
+      error(__FILE__, __LINE__, "expected " #f " to trap.\n"); \
+    }                                                          \
+  } while (0)
+
+#define ASSERT_EXHAUSTION(f)                                     \
+  do {                                                           \
+    g_tests_run++;                                               \
+    wasm_rt_trap_t code = wasm_rt_impl_try();                    \
+    switch (code) {                                              \
+      case WASM_RT_TRAP_NONE:                                    \
+        (void)(f);                                               \
+        error(__FILE__, __LINE__, "expected " #f " to trap.\n"); \
+        break;                                                   \
+      case WASM_RT_TRAP_EXHAUSTION:                              \
+        g_tests_passed++;                                        \
+        break;                                                   \
+      default:                                                   \
+        error(__FILE__, __LINE__,                                \
+              "expected " #f                                     \
+              " to trap due to exhaustion, got trap code %d.\n", \
+              code);                                             \
+        break;                                                   \
+    }                                                            \
+  } while (0)
+
+#define ASSERT_RETURN(f)                               \
+  do {                                                 \
+    g_tests_run++;                                     \
+    int trap_code = wasm_rt_impl_try();                \
+    if (trap_code) {                                   \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n", \
+            wasm_rt_strerror(trap_code));              \
+    } else {                                           \
+      f;                                               \
+      g_tests_passed++;                                \
+    }                                                  \
+  } while (0)
+
+#define ASSERT_RETURN_T(type, fmt, f, expected)                          \
+  do {                                                                   \
+    g_tests_run++;                                                       \
+    int trap_code = wasm_rt_impl_try();                                  \
+    if (trap_code) {                                                     \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                   \
+            wasm_rt_strerror(trap_code));                                \
+    } else {                                                             \
+      type actual = f;                                                   \
+      if (is_equal_##type(actual, expected)) {                           \
+        g_tests_passed++;                                                \
+      } else {                                                           \
+        error(__FILE__, __LINE__,                                        \
+              "in " #f ": expected %" fmt ", got %" fmt ".\n", expected, \
+              actual);                                                   \
+      }                                                                  \
+    }                                                                    \
+  } while (0)
+
+#define ASSERT_RETURN_FUNCREF(f, expected)                                \
+  do {                                                                    \
+    g_tests_run++;                                                        \
+    int trap_code = wasm_rt_impl_try();                                   \
+    if (trap_code) {                                                      \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                    \
+            wasm_rt_strerror(trap_code));                                 \
+    } else {                                                              \
+      wasm_rt_funcref_t actual = f;                                       \
+      if (is_equal_wasm_rt_funcref_t(actual, expected)) {                 \
+        g_tests_passed++;                                                 \
+      } else {                                                            \
+        error(__FILE__, __LINE__,                                         \
+              "in " #f ": mismatch between expected and actual funcref"); \
+      }                                                                   \
+    }                                                                     \
+  } while (0)
+
+#define ASSERT_RETURN_EXNREF(f, expected)                                \
+  do {                                                                   \
+    g_tests_run++;                                                       \
+    int trap_code = wasm_rt_impl_try();                                  \
+    if (trap_code) {                                                     \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                   \
+            wasm_rt_strerror(trap_code));                                \
+    } else {                                                             \
+      wasm_rt_exnref_t actual = f;                                       \
+      if (is_equal_wasm_rt_exnref_t(actual, expected)) {                 \
+        g_tests_passed++;                                                \
+      } else {                                                           \
+        error(__FILE__, __LINE__,                                        \
+              "in " #f ": mismatch between expected and actual exnref"); \
+      }                                                                  \
+    }                                                                    \
+  } while (0)
+
+#define ASSERT_RETURN_NAN_T(type, itype, fmt, f, kind)                        \
+  do {                                                                        \
+    g_tests_run++;                                                            \
+    int trap_code = wasm_rt_impl_try();                                       \
+    if (trap_code) {                                                          \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                        \
+            wasm_rt_strerror(trap_code));                                     \
+    } else {                                                                  \
+      type actual = f;                                                        \
+      itype iactual;                                                          \
+      memcpy(&iactual, &actual, sizeof(iactual));                             \
+      if (is_##kind##_nan_##type(iactual)) {                                  \
+        g_tests_passed++;                                                     \
+      } else {                                                                \
+        error(__FILE__, __LINE__,                                             \
+              "in " #f ": expected result to be a " #kind " nan, got 0x%" fmt \
+              ".\n",                                                          \
+              iactual);                                                       \
+      }                                                                       \
+    }                                                                         \
+  } while (0)
+
+#define MULTI_T_UNPACK_(...) __VA_ARGS__
+#define MULTI_T_UNPACK(arg) MULTI_T_UNPACK_ arg
+#define MULTI_i8 "%" PRIu8 " "
+#define MULTI_i16 "%" PRIu16 " "
+#define MULTI_i32 "%u "
+#define MULTI_i64 "%" PRIu64 " "
+#define MULTI_f32 "%.9g "
+#define MULTI_f64 "%.17g "
+#define MULTI_str "%s "
+#define ASSERT_RETURN_MULTI_T(type, fmt_expected, fmt_got, f, compare,        \
+                              expected, found)                                \
+  do {                                                                        \
+    g_tests_run++;                                                            \
+    int trap_code = wasm_rt_impl_try();                                       \
+    if (trap_code) {                                                          \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                        \
+            wasm_rt_strerror(trap_code));                                     \
+    } else {                                                                  \
+      type actual = f;                                                        \
+      if (compare) {                                                          \
+        g_tests_passed++;                                                     \
+      } else {                                                                \
+        error(__FILE__, __LINE__,                                             \
+              "in " #f ": expected <" fmt_expected ">, got <" fmt_got ">.\n", \
+              MULTI_T_UNPACK(expected), MULTI_T_UNPACK(found));               \
+      }                                                                       \
+    }                                                                         \
+  } while (0)
+
+
+#define ASSERT_RETURN_I32(f, expected) ASSERT_RETURN_T(u32, "u", f, expected)
+#define ASSERT_RETURN_I64(f, expected) ASSERT_RETURN_T(u64, PRIu64, f, expected)
+#define ASSERT_RETURN_F32(f, expected) ASSERT_RETURN_T(f32, ".9g", f, expected)
+#define ASSERT_RETURN_F64(f, expected) ASSERT_RETURN_T(f64, ".17g", f, expected)
+#define ASSERT_RETURN_EXTERNREF(f, expected) \
+  ASSERT_RETURN_T(wasm_rt_externref_t, "p", f, expected);
+
+#define ASSERT_RETURN_CANONICAL_NAN_F32(f) \
+  ASSERT_RETURN_NAN_T(f32, u32, "08x", f, canonical)
+#define ASSERT_RETURN_CANONICAL_NAN_F64(f) \
+  ASSERT_RETURN_NAN_T(f64, u64, "016x", f, canonical)
+#define ASSERT_RETURN_ARITHMETIC_NAN_F32(f) \
+  ASSERT_RETURN_NAN_T(f32, u32, "08x", f, arithmetic)
+#define ASSERT_RETURN_ARITHMETIC_NAN_F64(f) \
+  ASSERT_RETURN_NAN_T(f64, u64, "016x", f, arithmetic)
+
+static bool is_equal_u8(u8 x, u8 y) {
+  return x == y;
+}
+
+static bool is_equal_u16(u16 x, u16 y) {
+  return x == y;
+}
+
+static bool is_equal_u32(u32 x, u32 y) {
+  return x == y;
+}
+
+static bool is_equal_u64(u64 x, u64 y) {
+  return x == y;
+}
+
+#define is_equal_i8 is_equal_u8
+#define is_equal_i16 is_equal_u16
+#define is_equal_i32 is_equal_u32
+#define is_equal_i64 is_equal_u64
+
+static bool is_equal_wasm_rt_externref_t(wasm_rt_externref_t x,
+                                         wasm_rt_externref_t y) {
+  return x == y;
+}
+
+static inline bool is_equal_wasm_rt_func_type_t(const wasm_rt_func_type_t a,
+                                                const wasm_rt_func_type_t b) {
+  return (a == b) || (a && b && !memcmp(a, b, 32));
+}
+
+static bool is_equal_wasm_rt_funcref_t(wasm_rt_funcref_t x,
+                                       wasm_rt_funcref_t y) {
+  return is_equal_wasm_rt_func_type_t(x.func_type, y.func_type) &&
+         (x.func == y.func) && (x.module_instance == y.module_instance);
+}
+
+#ifdef WASM_EXN_MAX_SIZE
+static bool is_equal_wasm_rt_exnref_t(wasm_rt_exnref_t x, wasm_rt_exnref_t y) {
+  return x.tag == y.tag && x.size == y.size && !memcmp(x.data, y.data, x.size);
+}
+#endif
+
+wasm_rt_externref_t spectest_make_externref(uintptr_t x) {
+  return (wasm_rt_externref_t)(x + 1);  // externref(0) is not null
+}
+
+static u32 f32_bits(f32 x) {
+  u32 ux;
+  memcpy(&ux, &x, sizeof(ux));
+  return ux;
+}
+
+static u64 f64_bits(f64 x) {
+  u64 ux;
+  memcpy(&ux, &x, sizeof(ux));
+  return ux;
+}
+
+static bool is_equal_f32(f32 x, f32 y) {
+  return f32_bits(x) == f32_bits(y);
+}
+
+static bool is_equal_f64(f64 x, f64 y) {
+  return f64_bits(x) == f64_bits(y);
+}
+
+static f32 make_nan_f32(u32 x) {
+  x |= 0x7f800000;
+  f32 res;
+  memcpy(&res, &x, sizeof(res));
+  return res;
+}
+
+static f64 make_nan_f64(u64 x) {
+  x |= 0x7ff0000000000000;
+  f64 res;
+  memcpy(&res, &x, sizeof(res));
+  return res;
+}
+
+static bool is_canonical_nan_f32(u32 x) {
+  return (x & 0x7fffffff) == 0x7fc00000;
+}
+
+static bool is_canonical_nan_f64(u64 x) {
+  return (x & 0x7fffffffffffffff) == 0x7ff8000000000000;
+}
+
+static bool is_arithmetic_nan_f32(u32 x) {
+  return (x & 0x7fc00000) == 0x7fc00000;
+}
+
+static bool is_arithmetic_nan_f64(u64 x) {
+  return (x & 0x7ff8000000000000) == 0x7ff8000000000000;
+}
+
+typedef struct w2c_spectest {
+  wasm_rt_funcref_table_t spectest_table;
+  wasm_rt_funcref_table_t spectest_table64;
+  wasm_rt_memory_t spectest_memory;
+  uint32_t spectest_global_i32;
+  uint64_t spectest_global_i64;
+  float spectest_global_f32;
+  double spectest_global_f64;
+} w2c_spectest;
+
+static w2c_spectest spectest_instance;
+
+/*
+ * spectest implementations
+ */
+void w2c_spectest_print(w2c_spectest* instance) {
+  printf("spectest.print()\n");
+}
+
+void w2c_spectest_print_i32(w2c_spectest* instance, uint32_t i) {
+  printf("spectest.print_i32(%d)\n", i);
+}
+
+void w2c_spectest_print_i64(w2c_spectest* instance, uint64_t i) {
+  printf("spectest.print_i64(%" PRIu64 ")\n", i);
+}
+
+void w2c_spectest_print_f32(w2c_spectest* instance, float f) {
+  printf("spectest.print_f32(%g)\n", f);
+}
+
+void w2c_spectest_print_i32_f32(w2c_spectest* instance, uint32_t i, float f) {
+  printf("spectest.print_i32_f32(%d %g)\n", i, f);
+}
+
+void w2c_spectest_print_f64(w2c_spectest* instance, double d) {
+  printf("spectest.print_f64(%g)\n", d);
+}
+
+void w2c_spectest_print_f64_f64(w2c_spectest* instance, double d1, double d2) {
+  printf("spectest.print_f64_f64(%g %g)\n", d1, d2);
+}
+
+wasm_rt_funcref_table_t* w2c_spectest_table(w2c_spectest* instance) {
+  return &instance->spectest_table;
+}
+
+wasm_rt_funcref_table_t* w2c_spectest_table64(w2c_spectest* instance) {
+  return &instance->spectest_table64;
+}
+
+wasm_rt_memory_t* w2c_spectest_memory(w2c_spectest* instance) {
+  return &instance->spectest_memory;
+}
+
+uint32_t* w2c_spectest_global_i32(w2c_spectest* instance) {
+  return &instance->spectest_global_i32;
+}
+
+uint64_t* w2c_spectest_global_i64(w2c_spectest* instance) {
+  return &instance->spectest_global_i64;
+}
+
+float* w2c_spectest_global_f32(w2c_spectest* instance) {
+  return &instance->spectest_global_f32;
+}
+
+double* w2c_spectest_global_f64(w2c_spectest* instance) {
+  return &instance->spectest_global_f64;
+}
+
+static void init_spectest_module(w2c_spectest* instance) {
+  instance->spectest_global_i32 = 666;
+  instance->spectest_global_i64 = 666l;
+  instance->spectest_global_f32 = 666.6;
+  instance->spectest_global_f64 = 666.6;
+  wasm_rt_allocate_memory(&instance->spectest_memory, 1, 2, false,
+                          WASM_DEFAULT_PAGE_SIZE);
+  wasm_rt_allocate_funcref_table(&instance->spectest_table, 10, 20);
+  wasm_rt_allocate_funcref_table(&instance->spectest_table64, 10, 20);
+}
+
+// POSIX-only test config where embedder handles signals instead of w2c runtime
+#ifdef WASM2C_TEST_EMBEDDER_SIGNAL_HANDLING
+#include <signal.h>
+
+static void posix_signal_handler(int sig, siginfo_t* si, void* unused) {
+  wasm_rt_trap((si->si_code == SEGV_ACCERR) ? WASM_RT_TRAP_OOB
+                                            : WASM_RT_TRAP_EXHAUSTION);
+}
+
+static void posix_install_signal_handler(void) {
+  /* install altstack */
+  stack_t ss;
+  ss.ss_sp = malloc(SIGSTKSZ);
+  ss.ss_flags = 0;
+  ss.ss_size = SIGSTKSZ;
+  if (sigaltstack(&ss, NULL) != 0) {
+    perror("sigaltstack failed");
+    abort();
+  }
+
+  /* install signal handler */
+  struct sigaction sa;
+  memset(&sa, '\0', sizeof(sa));
+  sa.sa_flags = SA_SIGINFO | SA_ONSTACK;
+  sigemptyset(&sa.sa_mask);
+  sa.sa_sigaction = posix_signal_handler;
+  if (sigaction(SIGSEGV, &sa, NULL) != 0 || sigaction(SIGBUS, &sa, NULL) != 0) {
+    perror("sigaction failed");
+    abort();
+  }
+}
+
+static void posix_cleanup_signal_handler(void) {
+  /* remove signal handler */
+  struct sigaction sa;
+  memset(&sa, '\0', sizeof(sa));
+  sa.sa_handler = SIG_DFL;
+  if (sigaction(SIGSEGV, &sa, NULL) != 0 || sigaction(SIGBUS, &sa, NULL)) {
+    perror("sigaction failed");
+    abort();
+  }
+
+  /* disable and free altstack */
+  stack_t ss;
+  ss.ss_flags = SS_DISABLE;
+  if (sigaltstack(&ss, NULL) != 0) {
+    perror("sigaltstack failed");
+    abort();
+  }
+  free(ss.ss_sp);
+}
+#endif
+
+int main(int argc, char** argv) {
+#ifdef WASM2C_TEST_EMBEDDER_SIGNAL_HANDLING
+  posix_install_signal_handler();
+#endif
+  wasm_rt_init();
+  init_spectest_module(&spectest_instance);
+  run_spec_tests();
+  printf("%u/%u tests passed.\n", g_tests_passed, g_tests_run);
+  wasm_rt_free();
+#ifdef WASM2C_TEST_EMBEDDER_SIGNAL_HANDLING
+  posix_cleanup_signal_handler();
+#endif
+  return g_tests_passed != g_tests_run;
+}
+
+w2c_a a_instance;
+w2c_table__init__1__wasm table__init__1__wasm_instance;
+w2c_table__init__2__wasm table__init__2__wasm_instance;
+w2c_table__init__3__wasm table__init__3__wasm_instance;
+w2c_table__init__4__wasm table__init__4__wasm_instance;
+w2c_table__init__5__wasm table__init__5__wasm_instance;
+w2c_table__init__6__wasm table__init__6__wasm_instance;
+w2c_table__init__7__wasm table__init__7__wasm_instance;
+w2c_table__init__8__wasm table__init__8__wasm_instance;
+w2c_table__init__9__wasm table__init__9__wasm_instance;
+w2c_table__init__14__wasm table__init__14__wasm_instance;
+w2c_table__init__15__wasm table__init__15__wasm_instance;
+w2c_table__init__16__wasm table__init__16__wasm_instance;
+w2c_table__init__17__wasm table__init__17__wasm_instance;
+w2c_table__init__18__wasm table__init__18__wasm_instance;
+w2c_table__init__19__wasm table__init__19__wasm_instance;
+w2c_table__init__20__wasm table__init__20__wasm_instance;
+w2c_table__init__21__wasm table__init__21__wasm_instance;
+w2c_table__init__22__wasm table__init__22__wasm_instance;
+w2c_table__init__23__wasm table__init__23__wasm_instance;
+w2c_table__init__24__wasm table__init__24__wasm_instance;
+w2c_table__init__25__wasm table__init__25__wasm_instance;
+w2c_table__init__26__wasm table__init__26__wasm_instance;
+w2c_table__init__27__wasm table__init__27__wasm_instance;
+w2c_table__init__28__wasm table__init__28__wasm_instance;
+w2c_table__init__29__wasm table__init__29__wasm_instance;
+w2c_table__init__30__wasm table__init__30__wasm_instance;
+w2c_table__init__31__wasm table__init__31__wasm_instance;
+w2c_table__init__32__wasm table__init__32__wasm_instance;
+w2c_table__init__33__wasm table__init__33__wasm_instance;
+w2c_table__init__34__wasm table__init__34__wasm_instance;
+w2c_table__init__98__wasm table__init__98__wasm_instance;
+w2c_table__init__99__wasm table__init__99__wasm_instance;
+w2c_table__init__100__wasm table__init__100__wasm_instance;
+w2c_table__init__101__wasm table__init__101__wasm_instance;
+w2c_table__init__102__wasm table__init__102__wasm_instance;
+w2c_table__init__103__wasm table__init__103__wasm_instance;
+w2c_table__init__104__wasm table__init__104__wasm_instance;
+
+void run_spec_tests_0(void) {
+
+#line 6 "table_init.wast"
+wasm2c_a_instantiate(&a_instance);
+
+#line 15 "table_init.wast"
+wasm2c_table__init__1__wasm_instantiate(&table__init__1__wasm_instance, &a_instance);
+
+#line 42 "table_init.wast"
+w2c_table__init__1__wasm_test(&table__init__1__wasm_instance);
+
+#line 43 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 0u));
+
+#line 44 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 1u));
+
+#line 45 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 2u), 3u);
+
+#line 46 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 3u), 1u);
+
+#line 47 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 4u), 4u);
+
+#line 48 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 5u), 1u);
+
+#line 49 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 6u));
+
+#line 50 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 7u), 2u);
+
+#line 51 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 8u), 7u);
+
+#line 52 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 9u), 1u);
+
+#line 53 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 10u), 8u);
+
+#line 54 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 11u));
+
+#line 55 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 12u), 7u);
+
+#line 56 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 13u), 5u);
+
+#line 57 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 14u), 2u);
+
+#line 58 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 15u), 3u);
+
+#line 59 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 16u), 6u);
+
+#line 60 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 17u));
+
+#line 61 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 18u));
+
+#line 62 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 19u));
+
+#line 63 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 20u));
+
+#line 64 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 21u));
+
+#line 65 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 22u));
+
+#line 66 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 23u));
+
+#line 67 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 24u));
+
+#line 68 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 25u));
+
+#line 69 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 26u));
+
+#line 70 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 27u));
+
+#line 71 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 28u));
+
+#line 72 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__1__wasm_check(&table__init__1__wasm_instance, 29u));
+
+#line 74 "table_init.wast"
+wasm2c_table__init__2__wasm_instantiate(&table__init__2__wasm_instance, &a_instance);
+
+#line 101 "table_init.wast"
+w2c_table__init__2__wasm_test(&table__init__2__wasm_instance);
+
+#line 102 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 0u));
+
+#line 103 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 1u));
+
+#line 104 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 2u), 3u);
+
+#line 105 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 3u), 1u);
+
+#line 106 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 4u), 4u);
+
+#line 107 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 5u), 1u);
+
+#line 108 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 6u));
+
+#line 109 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 7u));
+
+#line 110 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 8u));
+
+#line 111 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 9u));
+
+#line 112 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 10u));
+
+#line 113 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 11u));
+
+#line 114 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 12u), 7u);
+
+#line 115 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 13u), 5u);
+
+#line 116 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 14u), 2u);
+
+#line 117 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 15u), 9u);
+
+#line 118 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 16u), 2u);
+
+#line 119 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 17u), 7u);
+
+#line 120 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 18u));
+
+#line 121 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 19u));
+
+#line 122 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 20u));
+
+#line 123 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 21u));
+
+#line 124 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 22u));
+
+#line 125 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 23u));
+
+#line 126 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 24u));
+
+#line 127 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 25u));
+
+#line 128 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 26u));
+
+#line 129 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 27u));
+
+#line 130 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 28u));
+
+#line 131 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__2__wasm_check(&table__init__2__wasm_instance, 29u));
+
+#line 133 "table_init.wast"
+wasm2c_table__init__3__wasm_instantiate(&table__init__3__wasm_instance, &a_instance);
+
+#line 168 "table_init.wast"
+w2c_table__init__3__wasm_test(&table__init__3__wasm_instance);
+
+#line 169 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 0u));
+
+#line 170 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 1u));
+
+#line 171 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 2u), 3u);
+
+#line 172 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 3u), 1u);
+
+#line 173 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 4u), 4u);
+
+#line 174 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 5u), 1u);
+
+#line 175 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 6u));
+
+#line 176 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 7u), 2u);
+
+#line 177 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 8u), 7u);
+
+#line 178 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 9u), 1u);
+
+#line 179 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 10u), 8u);
+
+#line 180 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 11u));
+
+#line 181 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 12u), 7u);
+
+#line 182 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 13u));
+
+#line 183 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 14u), 7u);
+
+#line 184 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 15u), 5u);
+
+#line 185 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 16u), 2u);
+
+#line 186 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 17u), 7u);
+
+#line 187 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 18u));
+
+#line 188 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 19u), 9u);
+
+#line 189 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 20u));
+
+#line 190 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 21u), 7u);
+
+#line 191 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 22u));
+
+#line 192 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 23u), 8u);
+
+#line 193 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 24u), 8u);
+
+#line 194 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 25u));
+
+#line 195 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 26u));
+
+#line 196 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 27u));
+
+#line 197 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 28u));
+
+#line 198 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__3__wasm_check(&table__init__3__wasm_instance, 29u));
+
+#line 200 "table_init.wast"
+wasm2c_table__init__4__wasm_instantiate(&table__init__4__wasm_instance, &a_instance);
+
+#line 227 "table_init.wast"
+w2c_table__init__4__wasm_test(&table__init__4__wasm_instance);
+
+#line 228 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 0u));
+
+#line 229 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 1u));
+
+#line 230 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 2u), 3u);
+
+#line 231 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 3u), 1u);
+
+#line 232 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 4u), 4u);
+
+#line 233 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 5u), 1u);
+
+#line 234 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 6u));
+
+#line 235 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 7u), 2u);
+
+#line 236 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 8u), 7u);
+
+#line 237 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 9u), 1u);
+
+#line 238 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 10u), 8u);
+
+#line 239 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 11u));
+
+#line 240 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 12u), 7u);
+
+#line 241 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 13u), 5u);
+
+#line 242 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 14u), 2u);
+
+#line 243 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 15u), 3u);
+
+#line 244 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 16u), 6u);
+
+#line 245 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 17u));
+
+#line 246 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 18u));
+
+#line 247 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 19u));
+
+#line 248 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 20u));
+
+#line 249 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 21u));
+
+#line 250 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 22u));
+
+#line 251 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 23u));
+
+#line 252 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 24u));
+
+#line 253 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 25u));
+
+#line 254 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 26u));
+
+#line 255 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 27u));
+
+#line 256 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 28u));
+
+#line 257 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__4__wasm_check(&table__init__4__wasm_instance, 29u));
+
+#line 259 "table_init.wast"
+wasm2c_table__init__5__wasm_instantiate(&table__init__5__wasm_instance, &a_instance);
+
+#line 286 "table_init.wast"
+w2c_table__init__5__wasm_test(&table__init__5__wasm_instance);
+
+#line 287 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 0u));
+
+#line 288 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 1u));
+
+#line 289 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 2u), 3u);
+
+#line 290 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 3u), 1u);
+
+#line 291 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 4u), 4u);
+
+#line 292 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 5u), 1u);
+
+#line 293 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 6u));
+
+#line 294 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 7u));
+
+#line 295 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 8u));
+
+#line 296 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 9u));
+
+#line 297 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 10u));
+
+#line 298 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 11u));
+
+#line 299 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 12u), 7u);
+
+#line 300 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 13u), 5u);
+
+#line 301 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 14u), 2u);
+
+#line 302 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 15u), 9u);
+
+#line 303 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 16u), 2u);
+
+#line 304 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 17u), 7u);
+
+#line 305 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 18u));
+
+#line 306 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 19u));
+
+#line 307 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 20u));
+
+#line 308 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 21u));
+
+#line 309 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 22u));
+
+#line 310 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 23u));
+
+#line 311 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 24u));
+
+#line 312 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 25u));
+
+#line 313 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 26u));
+
+#line 314 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 27u));
+
+#line 315 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 28u));
+
+#line 316 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__5__wasm_check(&table__init__5__wasm_instance, 29u));
+
+#line 318 "table_init.wast"
+wasm2c_table__init__6__wasm_instantiate(&table__init__6__wasm_instance, &a_instance);
+
+#line 353 "table_init.wast"
+w2c_table__init__6__wasm_test(&table__init__6__wasm_instance);
+
+#line 354 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 0u));
+
+#line 355 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 1u));
+
+#line 356 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 2u), 3u);
+
+#line 357 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 3u), 1u);
+
+#line 358 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 4u), 4u);
+
+#line 359 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 5u), 1u);
+
+#line 360 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 6u));
+
+#line 361 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 7u), 2u);
+
+#line 362 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 8u), 7u);
+
+#line 363 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 9u), 1u);
+
+#line 364 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 10u), 8u);
+
+#line 365 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 11u));
+
+#line 366 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 12u), 7u);
+
+#line 367 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 13u));
+
+#line 368 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 14u), 7u);
+
+#line 369 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 15u), 5u);
+
+#line 370 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 16u), 2u);
+
+#line 371 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 17u), 7u);
+
+#line 372 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 18u));
+
+#line 373 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 19u), 9u);
+
+#line 374 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 20u));
+
+#line 375 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 21u), 7u);
+
+#line 376 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 22u));
+
+#line 377 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 23u), 8u);
+
+#line 378 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 24u), 8u);
+
+#line 379 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 25u));
+
+#line 380 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 26u));
+
+#line 381 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 27u));
+
+#line 382 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 28u));
+
+#line 383 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__6__wasm_check(&table__init__6__wasm_instance, 29u));
+
+#line 385 "table_init.wast"
+wasm2c_table__init__7__wasm_instantiate(&table__init__7__wasm_instance, &a_instance);
+
+#line 412 "table_init.wast"
+w2c_table__init__7__wasm_test(&table__init__7__wasm_instance);
+
+#line 413 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 0ull));
+
+#line 414 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 1ull));
+
+#line 415 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 2ull), 3u);
+
+#line 416 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 3ull), 1u);
+
+#line 417 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 4ull), 4u);
+
+#line 418 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 5ull), 1u);
+
+#line 419 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 6ull));
+
+#line 420 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 7ull), 2u);
+
+#line 421 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 8ull), 7u);
+
+#line 422 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 9ull), 1u);
+
+#line 423 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 10ull), 8u);
+
+#line 424 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 11ull));
+
+#line 425 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 12ull), 7u);
+
+#line 426 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 13ull), 5u);
+
+#line 427 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 14ull), 2u);
+
+#line 428 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 15ull), 3u);
+
+#line 429 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 16ull), 6u);
+
+#line 430 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 17ull));
+
+#line 431 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 18ull));
+
+#line 432 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 19ull));
+
+#line 433 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 20ull));
+
+#line 434 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 21ull));
+
+#line 435 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 22ull));
+
+#line 436 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 23ull));
+
+#line 437 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 24ull));
+
+#line 438 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 25ull));
+
+#line 439 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 26ull));
+
+#line 440 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 27ull));
+
+#line 441 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 28ull));
+
+#line 442 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__7__wasm_check(&table__init__7__wasm_instance, 29ull));
+
+#line 444 "table_init.wast"
+wasm2c_table__init__8__wasm_instantiate(&table__init__8__wasm_instance, &a_instance);
+
+#line 471 "table_init.wast"
+w2c_table__init__8__wasm_test(&table__init__8__wasm_instance);
+
+#line 472 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 0ull));
+
+#line 473 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 1ull));
+
+#line 474 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 2ull), 3u);
+
+#line 475 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 3ull), 1u);
+
+#line 476 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 4ull), 4u);
+
+#line 477 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 5ull), 1u);
+
+#line 478 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 6ull));
+
+#line 479 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 7ull));
+
+#line 480 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 8ull));
+
+#line 481 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 9ull));
+
+#line 482 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 10ull));
+
+#line 483 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 11ull));
+
+#line 484 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 12ull), 7u);
+
+#line 485 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 13ull), 5u);
+
+#line 486 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 14ull), 2u);
+
+#line 487 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 15ull), 9u);
+
+#line 488 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 16ull), 2u);
+
+#line 489 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 17ull), 7u);
+
+#line 490 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 18ull));
+
+#line 491 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 19ull));
+
+#line 492 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 20ull));
+
+#line 493 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 21ull));
+
+#line 494 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 22ull));
+
+#line 495 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 23ull));
+
+#line 496 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 24ull));
+
+#line 497 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 25ull));
+
+#line 498 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 26ull));
+
+#line 499 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 27ull));
+
+#line 500 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 28ull));
+
+#line 501 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__8__wasm_check(&table__init__8__wasm_instance, 29ull));
+
+#line 503 "table_init.wast"
+wasm2c_table__init__9__wasm_instantiate(&table__init__9__wasm_instance, &a_instance);
+
+#line 538 "table_init.wast"
+w2c_table__init__9__wasm_test(&table__init__9__wasm_instance);
+
+#line 539 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 0ull));
+
+#line 540 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 1ull));
+
+#line 541 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 2ull), 3u);
+
+#line 542 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 3ull), 1u);
+
+#line 543 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 4ull), 4u);
+
+#line 544 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 5ull), 1u);
+
+#line 545 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 6ull));
+
+#line 546 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 7ull), 2u);
+
+#line 547 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 8ull), 7u);
+
+#line 548 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 9ull), 1u);
+
+#line 549 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 10ull), 8u);
+
+#line 550 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 11ull));
+
+#line 551 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 12ull), 7u);
+
+#line 552 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 13ull));
+
+#line 553 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 14ull), 7u);
+
+#line 554 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 15ull), 5u);
+
+#line 555 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 16ull), 2u);
+
+#line 556 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 17ull), 7u);
+
+#line 557 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 18ull));
+
+#line 558 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 19ull), 9u);
+
+#line 559 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 20ull));
+
+#line 560 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 21ull), 7u);
+
+#line 561 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 22ull));
+
+#line 562 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 23ull), 8u);
+
+#line 563 "table_init.wast"
+ASSERT_RETURN_I32(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 24ull), 8u);
+
+#line 564 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 25ull));
+
+#line 565 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 26ull));
+
+#line 566 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 27ull));
+
+#line 567 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 28ull));
+
+#line 568 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__9__wasm_check(&table__init__9__wasm_instance, 29ull));
+
+#line 598 "table_init.wast"
+wasm2c_table__init__14__wasm_instantiate(&table__init__14__wasm_instance);
+
+#line 620 "table_init.wast"
+w2c_table__init__14__wasm_test(&table__init__14__wasm_instance);
+
+#line 622 "table_init.wast"
+wasm2c_table__init__15__wasm_instantiate(&table__init__15__wasm_instance);
+
+#line 644 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__15__wasm_test(&table__init__15__wasm_instance));
+
+#line 646 "table_init.wast"
+wasm2c_table__init__16__wasm_instantiate(&table__init__16__wasm_instance);
+
+#line 668 "table_init.wast"
+w2c_table__init__16__wasm_test(&table__init__16__wasm_instance);
+
+#line 670 "table_init.wast"
+wasm2c_table__init__17__wasm_instantiate(&table__init__17__wasm_instance);
+
+#line 692 "table_init.wast"
+w2c_table__init__17__wasm_test(&table__init__17__wasm_instance);
+
+#line 694 "table_init.wast"
+wasm2c_table__init__18__wasm_instantiate(&table__init__18__wasm_instance);
+
+#line 716 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__18__wasm_test(&table__init__18__wasm_instance));
+
+#line 718 "table_init.wast"
+wasm2c_table__init__19__wasm_instantiate(&table__init__19__wasm_instance);
+
+#line 740 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__19__wasm_test(&table__init__19__wasm_instance));
+
+#line 742 "table_init.wast"
+wasm2c_table__init__20__wasm_instantiate(&table__init__20__wasm_instance);
+
+#line 764 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__20__wasm_test(&table__init__20__wasm_instance));
+
+#line 766 "table_init.wast"
+wasm2c_table__init__21__wasm_instantiate(&table__init__21__wasm_instance);
+
+#line 788 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__21__wasm_test(&table__init__21__wasm_instance));
+
+#line 790 "table_init.wast"
+wasm2c_table__init__22__wasm_instantiate(&table__init__22__wasm_instance);
+
+#line 812 "table_init.wast"
+w2c_table__init__22__wasm_test(&table__init__22__wasm_instance);
+
+#line 814 "table_init.wast"
+wasm2c_table__init__23__wasm_instantiate(&table__init__23__wasm_instance);
+
+#line 836 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__23__wasm_test(&table__init__23__wasm_instance));
+
+#line 838 "table_init.wast"
+wasm2c_table__init__24__wasm_instantiate(&table__init__24__wasm_instance);
+
+#line 860 "table_init.wast"
+w2c_table__init__24__wasm_test(&table__init__24__wasm_instance);
+
+#line 862 "table_init.wast"
+wasm2c_table__init__25__wasm_instantiate(&table__init__25__wasm_instance);
+
+#line 884 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__25__wasm_test(&table__init__25__wasm_instance));
+
+#line 886 "table_init.wast"
+wasm2c_table__init__26__wasm_instantiate(&table__init__26__wasm_instance);
+
+#line 908 "table_init.wast"
+w2c_table__init__26__wasm_test(&table__init__26__wasm_instance);
+
+#line 910 "table_init.wast"
+wasm2c_table__init__27__wasm_instantiate(&table__init__27__wasm_instance);
+
+#line 932 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__27__wasm_test(&table__init__27__wasm_instance));
+
+#line 934 "table_init.wast"
+wasm2c_table__init__28__wasm_instantiate(&table__init__28__wasm_instance);
+
+#line 956 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__28__wasm_test(&table__init__28__wasm_instance));
+
+#line 958 "table_init.wast"
+wasm2c_table__init__29__wasm_instantiate(&table__init__29__wasm_instance);
+
+#line 980 "table_init.wast"
+w2c_table__init__29__wasm_test(&table__init__29__wasm_instance);
+
+#line 982 "table_init.wast"
+wasm2c_table__init__30__wasm_instantiate(&table__init__30__wasm_instance);
+
+#line 1004 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__30__wasm_test(&table__init__30__wasm_instance));
+
+#line 1006 "table_init.wast"
+wasm2c_table__init__31__wasm_instantiate(&table__init__31__wasm_instance);
+
+#line 1028 "table_init.wast"
+w2c_table__init__31__wasm_test(&table__init__31__wasm_instance);
+
+#line 1030 "table_init.wast"
+wasm2c_table__init__32__wasm_instantiate(&table__init__32__wasm_instance);
+
+#line 1052 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__32__wasm_test(&table__init__32__wasm_instance));
+
+#line 1054 "table_init.wast"
+wasm2c_table__init__33__wasm_instantiate(&table__init__33__wasm_instance);
+
+#line 1076 "table_init.wast"
+w2c_table__init__33__wasm_test(&table__init__33__wasm_instance);
+
+#line 1078 "table_init.wast"
+wasm2c_table__init__34__wasm_instantiate(&table__init__34__wasm_instance);
+
+#line 1100 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__34__wasm_test(&table__init__34__wasm_instance));
+
+#line 1669 "table_init.wast"
+wasm2c_table__init__98__wasm_instantiate(&table__init__98__wasm_instance);
+
+#line 1697 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_run(&table__init__98__wasm_instance, 24u, 16u));
+
+#line 1698 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 0u));
+
+#line 1699 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 1u));
+
+#line 1700 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 2u));
+
+#line 1701 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 3u));
+
+#line 1702 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 4u));
+
+#line 1703 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 5u));
+
+#line 1704 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 6u));
+
+#line 1705 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 7u));
+
+#line 1706 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 8u));
+
+#line 1707 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 9u));
+
+#line 1708 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 10u));
+
+#line 1709 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 11u));
+
+#line 1710 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 12u));
+
+#line 1711 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 13u));
+
+#line 1712 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 14u));
+
+#line 1713 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 15u));
+
+#line 1714 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 16u));
+
+#line 1715 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 17u));
+
+#line 1716 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 18u));
+
+#line 1717 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 19u));
+
+#line 1718 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 20u));
+
+#line 1719 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 21u));
+
+#line 1720 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 22u));
+
+#line 1721 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 23u));
+
+#line 1722 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 24u));
+
+#line 1723 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 25u));
+
+#line 1724 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 26u));
+
+#line 1725 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 27u));
+
+#line 1726 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 28u));
+
+#line 1727 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 29u));
+
+#line 1728 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 30u));
+
+#line 1729 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__98__wasm_test(&table__init__98__wasm_instance, 31u));
+
+#line 1731 "table_init.wast"
+wasm2c_table__init__99__wasm_instantiate(&table__init__99__wasm_instance);
+
+#line 1759 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_run(&table__init__99__wasm_instance, 25u, 16u));
+
+#line 1760 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 0u));
+
+#line 1761 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 1u));
+
+#line 1762 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 2u));
+
+#line 1763 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 3u));
+
+#line 1764 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 4u));
+
+#line 1765 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 5u));
+
+#line 1766 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 6u));
+
+#line 1767 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 7u));
+
+#line 1768 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 8u));
+
+#line 1769 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 9u));
+
+#line 1770 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 10u));
+
+#line 1771 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 11u));
+
+#line 1772 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 12u));
+
+#line 1773 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 13u));
+
+#line 1774 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 14u));
+
+#line 1775 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 15u));
+
+#line 1776 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 16u));
+
+#line 1777 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 17u));
+
+#line 1778 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 18u));
+
+#line 1779 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 19u));
+
+#line 1780 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 20u));
+
+#line 1781 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 21u));
+
+#line 1782 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 22u));
+
+#line 1783 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 23u));
+
+#line 1784 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 24u));
+
+#line 1785 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 25u));
+
+#line 1786 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 26u));
+
+#line 1787 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 27u));
+
+#line 1788 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 28u));
+
+#line 1789 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 29u));
+
+#line 1790 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 30u));
+
+#line 1791 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__99__wasm_test(&table__init__99__wasm_instance, 31u));
+
+#line 1793 "table_init.wast"
+wasm2c_table__init__100__wasm_instantiate(&table__init__100__wasm_instance);
+
+#line 1821 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_run(&table__init__100__wasm_instance, 96u, 32u));
+
+#line 1822 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 0u));
+
+#line 1823 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 1u));
+
+#line 1824 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 2u));
+
+#line 1825 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 3u));
+
+#line 1826 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 4u));
+
+#line 1827 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 5u));
+
+#line 1828 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 6u));
+
+#line 1829 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 7u));
+
+#line 1830 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 8u));
+
+#line 1831 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 9u));
+
+#line 1832 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 10u));
+
+#line 1833 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 11u));
+
+#line 1834 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 12u));
+
+#line 1835 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 13u));
+
+#line 1836 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 14u));
+
+#line 1837 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 15u));
+
+#line 1838 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 16u));
+
+#line 1839 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 17u));
+
+#line 1840 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 18u));
+
+#line 1841 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 19u));
+
+#line 1842 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 20u));
+
+#line 1843 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 21u));
+
+#line 1844 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 22u));
+
+#line 1845 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 23u));
+
+#line 1846 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 24u));
+
+#line 1847 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 25u));
+
+#line 1848 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 26u));
+
+#line 1849 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 27u));
+
+#line 1850 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 28u));
+
+#line 1851 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 29u));
+
+#line 1852 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 30u));
+
+#line 1853 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 31u));
+
+#line 1854 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 32u));
+
+#line 1855 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 33u));
+
+#line 1856 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 34u));
+
+#line 1857 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 35u));
+
+#line 1858 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 36u));
+
+#line 1859 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 37u));
+
+#line 1860 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 38u));
+
+#line 1861 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 39u));
+
+#line 1862 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 40u));
+
+#line 1863 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 41u));
+
+#line 1864 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 42u));
+
+#line 1865 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 43u));
+
+#line 1866 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 44u));
+
+#line 1867 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 45u));
+
+#line 1868 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 46u));
+
+#line 1869 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 47u));
+
+#line 1870 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 48u));
+
+#line 1871 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 49u));
+
+#line 1872 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 50u));
+
+#line 1873 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 51u));
+
+#line 1874 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 52u));
+
+#line 1875 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 53u));
+
+#line 1876 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 54u));
+
+#line 1877 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 55u));
+
+#line 1878 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 56u));
+
+#line 1879 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 57u));
+
+#line 1880 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 58u));
+
+#line 1881 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 59u));
+
+#line 1882 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 60u));
+
+#line 1883 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 61u));
+
+#line 1884 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 62u));
+
+#line 1885 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 63u));
+
+#line 1886 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 64u));
+
+#line 1887 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 65u));
+
+#line 1888 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 66u));
+
+#line 1889 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 67u));
+
+#line 1890 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 68u));
+
+#line 1891 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 69u));
+
+#line 1892 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 70u));
+
+#line 1893 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 71u));
+
+#line 1894 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 72u));
+
+#line 1895 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 73u));
+
+#line 1896 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 74u));
+
+#line 1897 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 75u));
+
+#line 1898 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 76u));
+
+#line 1899 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 77u));
+
+#line 1900 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 78u));
+
+#line 1901 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 79u));
+
+#line 1902 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 80u));
+
+#line 1903 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 81u));
+
+#line 1904 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 82u));
+
+#line 1905 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 83u));
+
+#line 1906 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 84u));
+
+#line 1907 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 85u));
+
+#line 1908 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 86u));
+
+#line 1909 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 87u));
+
+#line 1910 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 88u));
+
+#line 1911 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 89u));
+
+#line 1912 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 90u));
+
+#line 1913 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 91u));
+
+#line 1914 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 92u));
+
+#line 1915 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 93u));
+
+#line 1916 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 94u));
+
+#line 1917 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 95u));
+
+#line 1918 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 96u));
+
+#line 1919 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 97u));
+
+#line 1920 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 98u));
+
+#line 1921 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 99u));
+
+#line 1922 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 100u));
+
+#line 1923 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 101u));
+
+#line 1924 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 102u));
+
+#line 1925 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 103u));
+
+#line 1926 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 104u));
+
+#line 1927 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 105u));
+
+#line 1928 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 106u));
+
+#line 1929 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 107u));
+
+#line 1930 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 108u));
+
+#line 1931 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 109u));
+
+#line 1932 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 110u));
+
+#line 1933 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 111u));
+
+#line 1934 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 112u));
+
+#line 1935 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 113u));
+
+#line 1936 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 114u));
+
+#line 1937 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 115u));
+
+#line 1938 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 116u));
+
+#line 1939 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 117u));
+
+#line 1940 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 118u));
+
+#line 1941 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 119u));
+
+#line 1942 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 120u));
+
+#line 1943 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 121u));
+
+#line 1944 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 122u));
+
+#line 1945 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 123u));
+
+#line 1946 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 124u));
+
+#line 1947 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 125u));
+
+#line 1948 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 126u));
+
+#line 1949 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 127u));
+
+#line 1950 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 128u));
+
+#line 1951 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 129u));
+
+#line 1952 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 130u));
+
+#line 1953 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 131u));
+
+#line 1954 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 132u));
+
+#line 1955 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 133u));
+
+#line 1956 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 134u));
+
+#line 1957 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 135u));
+
+#line 1958 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 136u));
+
+#line 1959 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 137u));
+
+#line 1960 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 138u));
+
+#line 1961 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 139u));
+
+#line 1962 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 140u));
+
+#line 1963 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 141u));
+
+#line 1964 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 142u));
+
+#line 1965 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 143u));
+
+#line 1966 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 144u));
+
+#line 1967 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 145u));
+
+#line 1968 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 146u));
+
+#line 1969 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 147u));
+
+#line 1970 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 148u));
+
+#line 1971 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 149u));
+
+#line 1972 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 150u));
+
+#line 1973 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 151u));
+
+#line 1974 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 152u));
+
+#line 1975 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 153u));
+
+#line 1976 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 154u));
+
+#line 1977 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 155u));
+
+#line 1978 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 156u));
+
+#line 1979 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 157u));
+
+#line 1980 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 158u));
+
+#line 1981 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__100__wasm_test(&table__init__100__wasm_instance, 159u));
+
+#line 1983 "table_init.wast"
+wasm2c_table__init__101__wasm_instantiate(&table__init__101__wasm_instance);
+
+#line 2011 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_run(&table__init__101__wasm_instance, 97u, 31u));
+
+#line 2012 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 0u));
+
+#line 2013 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 1u));
+
+#line 2014 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 2u));
+
+#line 2015 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 3u));
+
+#line 2016 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 4u));
+
+#line 2017 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 5u));
+
+#line 2018 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 6u));
+
+#line 2019 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 7u));
+
+#line 2020 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 8u));
+
+#line 2021 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 9u));
+
+#line 2022 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 10u));
+
+#line 2023 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 11u));
+
+#line 2024 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 12u));
+
+#line 2025 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 13u));
+
+#line 2026 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 14u));
+
+#line 2027 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 15u));
+
+#line 2028 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 16u));
+
+#line 2029 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 17u));
+
+#line 2030 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 18u));
+
+#line 2031 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 19u));
+
+#line 2032 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 20u));
+
+#line 2033 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 21u));
+
+#line 2034 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 22u));
+
+#line 2035 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 23u));
+
+#line 2036 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 24u));
+
+#line 2037 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 25u));
+
+#line 2038 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 26u));
+
+#line 2039 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 27u));
+
+#line 2040 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 28u));
+
+#line 2041 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 29u));
+
+#line 2042 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 30u));
+
+#line 2043 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 31u));
+
+#line 2044 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 32u));
+
+#line 2045 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 33u));
+
+#line 2046 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 34u));
+
+#line 2047 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 35u));
+
+#line 2048 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 36u));
+
+#line 2049 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 37u));
+
+#line 2050 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 38u));
+
+#line 2051 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 39u));
+
+#line 2052 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 40u));
+
+#line 2053 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 41u));
+
+#line 2054 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 42u));
+
+#line 2055 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 43u));
+
+#line 2056 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 44u));
+
+#line 2057 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 45u));
+
+#line 2058 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 46u));
+
+#line 2059 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 47u));
+
+#line 2060 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 48u));
+
+#line 2061 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 49u));
+
+#line 2062 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 50u));
+
+#line 2063 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 51u));
+
+#line 2064 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 52u));
+
+#line 2065 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 53u));
+
+#line 2066 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 54u));
+
+#line 2067 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 55u));
+
+#line 2068 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 56u));
+
+#line 2069 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 57u));
+
+#line 2070 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 58u));
+
+#line 2071 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 59u));
+
+#line 2072 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 60u));
+
+#line 2073 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 61u));
+
+#line 2074 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 62u));
+
+#line 2075 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 63u));
+
+#line 2076 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 64u));
+
+#line 2077 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 65u));
+
+#line 2078 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 66u));
+
+#line 2079 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 67u));
+
+#line 2080 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 68u));
+
+#line 2081 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 69u));
+
+#line 2082 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 70u));
+
+#line 2083 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 71u));
+
+#line 2084 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 72u));
+
+#line 2085 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 73u));
+
+#line 2086 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 74u));
+
+#line 2087 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 75u));
+
+#line 2088 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 76u));
+
+#line 2089 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 77u));
+
+#line 2090 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 78u));
+
+#line 2091 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 79u));
+
+#line 2092 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 80u));
+
+#line 2093 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 81u));
+
+#line 2094 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 82u));
+
+#line 2095 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 83u));
+
+#line 2096 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 84u));
+
+#line 2097 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 85u));
+
+#line 2098 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 86u));
+
+#line 2099 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 87u));
+
+#line 2100 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 88u));
+
+#line 2101 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 89u));
+
+#line 2102 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 90u));
+
+#line 2103 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 91u));
+
+#line 2104 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 92u));
+
+#line 2105 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 93u));
+
+#line 2106 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 94u));
+
+#line 2107 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 95u));
+
+#line 2108 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 96u));
+
+#line 2109 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 97u));
+
+#line 2110 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 98u));
+
+#line 2111 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 99u));
+
+#line 2112 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 100u));
+
+#line 2113 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 101u));
+
+#line 2114 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 102u));
+
+#line 2115 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 103u));
+
+#line 2116 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 104u));
+
+#line 2117 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 105u));
+
+#line 2118 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 106u));
+
+#line 2119 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 107u));
+
+#line 2120 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 108u));
+
+#line 2121 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 109u));
+
+#line 2122 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 110u));
+
+#line 2123 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 111u));
+
+#line 2124 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 112u));
+
+#line 2125 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 113u));
+
+#line 2126 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 114u));
+
+#line 2127 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 115u));
+
+#line 2128 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 116u));
+
+#line 2129 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 117u));
+
+#line 2130 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 118u));
+
+#line 2131 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 119u));
+
+#line 2132 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 120u));
+
+#line 2133 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 121u));
+
+#line 2134 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 122u));
+
+#line 2135 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 123u));
+
+#line 2136 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 124u));
+
+#line 2137 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 125u));
+
+#line 2138 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 126u));
+
+#line 2139 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 127u));
+
+#line 2140 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 128u));
+
+#line 2141 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 129u));
+
+#line 2142 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 130u));
+
+#line 2143 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 131u));
+
+#line 2144 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 132u));
+
+#line 2145 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 133u));
+
+#line 2146 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 134u));
+
+#line 2147 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 135u));
+
+#line 2148 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 136u));
+
+#line 2149 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 137u));
+
+#line 2150 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 138u));
+
+#line 2151 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 139u));
+
+#line 2152 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 140u));
+
+#line 2153 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 141u));
+
+#line 2154 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 142u));
+
+#line 2155 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 143u));
+
+#line 2156 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 144u));
+
+#line 2157 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 145u));
+
+#line 2158 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 146u));
+
+#line 2159 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 147u));
+
+#line 2160 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 148u));
+
+#line 2161 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 149u));
+
+#line 2162 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 150u));
+
+#line 2163 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 151u));
+
+#line 2164 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 152u));
+
+#line 2165 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 153u));
+
+#line 2166 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 154u));
+
+#line 2167 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 155u));
+
+#line 2168 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 156u));
+
+#line 2169 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 157u));
+
+#line 2170 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 158u));
+
+#line 2171 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__101__wasm_test(&table__init__101__wasm_instance, 159u));
+
+#line 2173 "table_init.wast"
+wasm2c_table__init__102__wasm_instantiate(&table__init__102__wasm_instance);
+
+#line 2201 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_run(&table__init__102__wasm_instance, 48u, 4294967280u));
+
+#line 2202 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 0u));
+
+#line 2203 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 1u));
+
+#line 2204 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 2u));
+
+#line 2205 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 3u));
+
+#line 2206 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 4u));
+
+#line 2207 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 5u));
+
+#line 2208 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 6u));
+
+#line 2209 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 7u));
+
+#line 2210 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 8u));
+
+#line 2211 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 9u));
+
+#line 2212 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 10u));
+
+#line 2213 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 11u));
+
+#line 2214 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 12u));
+
+#line 2215 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 13u));
+
+#line 2216 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 14u));
+
+#line 2217 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 15u));
+
+#line 2218 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 16u));
+
+#line 2219 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 17u));
+
+#line 2220 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 18u));
+
+#line 2221 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 19u));
+
+#line 2222 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 20u));
+
+#line 2223 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 21u));
+
+#line 2224 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 22u));
+
+#line 2225 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 23u));
+
+#line 2226 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 24u));
+
+#line 2227 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 25u));
+
+#line 2228 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 26u));
+
+#line 2229 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 27u));
+
+#line 2230 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 28u));
+
+#line 2231 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 29u));
+
+#line 2232 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 30u));
+
+#line 2233 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 31u));
+
+#line 2234 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 32u));
+
+#line 2235 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 33u));
+
+#line 2236 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 34u));
+
+#line 2237 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 35u));
+
+#line 2238 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 36u));
+
+#line 2239 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 37u));
+
+#line 2240 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 38u));
+
+#line 2241 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 39u));
+
+#line 2242 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 40u));
+
+#line 2243 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 41u));
+
+#line 2244 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 42u));
+
+#line 2245 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 43u));
+
+#line 2246 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 44u));
+
+#line 2247 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 45u));
+
+#line 2248 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 46u));
+
+#line 2249 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 47u));
+
+#line 2250 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 48u));
+
+#line 2251 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 49u));
+
+#line 2252 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 50u));
+
+#line 2253 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 51u));
+
+#line 2254 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 52u));
+
+#line 2255 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 53u));
+
+#line 2256 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 54u));
+
+#line 2257 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 55u));
+
+#line 2258 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 56u));
+
+#line 2259 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 57u));
+
+#line 2260 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 58u));
+
+#line 2261 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 59u));
+
+#line 2262 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 60u));
+
+#line 2263 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 61u));
+
+#line 2264 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 62u));
+
+#line 2265 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__102__wasm_test(&table__init__102__wasm_instance, 63u));
+
+#line 2267 "table_init.wast"
+wasm2c_table__init__103__wasm_instantiate(&table__init__103__wasm_instance);
+
+#line 2295 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__103__wasm_run(&table__init__103__wasm_instance, 0u, 4294967292u));
+
+#line 2296 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__103__wasm_test(&table__init__103__wasm_instance, 0u));
+
+#line 2297 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__103__wasm_test(&table__init__103__wasm_instance, 1u));
+
+#line 2298 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__103__wasm_test(&table__init__103__wasm_instance, 2u));
+
+#line 2299 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__103__wasm_test(&table__init__103__wasm_instance, 3u));
+
+#line 2300 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__103__wasm_test(&table__init__103__wasm_instance, 4u));
+
+#line 2301 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__103__wasm_test(&table__init__103__wasm_instance, 5u));
+
+#line 2302 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__103__wasm_test(&table__init__103__wasm_instance, 6u));
+
+#line 2303 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__103__wasm_test(&table__init__103__wasm_instance, 7u));
+
+#line 2304 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__103__wasm_test(&table__init__103__wasm_instance, 8u));
+
+#line 2305 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__103__wasm_test(&table__init__103__wasm_instance, 9u));
+
+#line 2306 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__103__wasm_test(&table__init__103__wasm_instance, 10u));
+
+#line 2307 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__103__wasm_test(&table__init__103__wasm_instance, 11u));
+
+#line 2308 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__103__wasm_test(&table__init__103__wasm_instance, 12u));
+
+#line 2309 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__103__wasm_test(&table__init__103__wasm_instance, 13u));
+
+#line 2310 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__103__wasm_test(&table__init__103__wasm_instance, 14u));
+
+#line 2311 "table_init.wast"
+ASSERT_TRAP(w2c_table__init__103__wasm_test(&table__init__103__wasm_instance, 15u));
+
+#line 2313 "table_init.wast"
+wasm2c_table__init__104__wasm_instantiate(&table__init__104__wasm_instance);
+
+
+}
+
+void run_spec_tests(void) {
+
+run_spec_tests_0();
+wasm2c_a_free(&a_instance);
+wasm2c_table__init__1__wasm_free(&table__init__1__wasm_instance);
+wasm2c_table__init__2__wasm_free(&table__init__2__wasm_instance);
+wasm2c_table__init__3__wasm_free(&table__init__3__wasm_instance);
+wasm2c_table__init__4__wasm_free(&table__init__4__wasm_instance);
+wasm2c_table__init__5__wasm_free(&table__init__5__wasm_instance);
+wasm2c_table__init__6__wasm_free(&table__init__6__wasm_instance);
+wasm2c_table__init__7__wasm_free(&table__init__7__wasm_instance);
+wasm2c_table__init__8__wasm_free(&table__init__8__wasm_instance);
+wasm2c_table__init__9__wasm_free(&table__init__9__wasm_instance);
+wasm2c_table__init__14__wasm_free(&table__init__14__wasm_instance);
+wasm2c_table__init__15__wasm_free(&table__init__15__wasm_instance);
+wasm2c_table__init__16__wasm_free(&table__init__16__wasm_instance);
+wasm2c_table__init__17__wasm_free(&table__init__17__wasm_instance);
+wasm2c_table__init__18__wasm_free(&table__init__18__wasm_instance);
+wasm2c_table__init__19__wasm_free(&table__init__19__wasm_instance);
+wasm2c_table__init__20__wasm_free(&table__init__20__wasm_instance);
+wasm2c_table__init__21__wasm_free(&table__init__21__wasm_instance);
+wasm2c_table__init__22__wasm_free(&table__init__22__wasm_instance);
+wasm2c_table__init__23__wasm_free(&table__init__23__wasm_instance);
+wasm2c_table__init__24__wasm_free(&table__init__24__wasm_instance);
+wasm2c_table__init__25__wasm_free(&table__init__25__wasm_instance);
+wasm2c_table__init__26__wasm_free(&table__init__26__wasm_instance);
+wasm2c_table__init__27__wasm_free(&table__init__27__wasm_instance);
+wasm2c_table__init__28__wasm_free(&table__init__28__wasm_instance);
+wasm2c_table__init__29__wasm_free(&table__init__29__wasm_instance);
+wasm2c_table__init__30__wasm_free(&table__init__30__wasm_instance);
+wasm2c_table__init__31__wasm_free(&table__init__31__wasm_instance);
+wasm2c_table__init__32__wasm_free(&table__init__32__wasm_instance);
+wasm2c_table__init__33__wasm_free(&table__init__33__wasm_instance);
+wasm2c_table__init__34__wasm_free(&table__init__34__wasm_instance);
+wasm2c_table__init__98__wasm_free(&table__init__98__wasm_instance);
+wasm2c_table__init__99__wasm_free(&table__init__99__wasm_instance);
+wasm2c_table__init__100__wasm_free(&table__init__100__wasm_instance);
+wasm2c_table__init__101__wasm_free(&table__init__101__wasm_instance);
+wasm2c_table__init__102__wasm_free(&table__init__102__wasm_instance);
+wasm2c_table__init__103__wasm_free(&table__init__103__wasm_instance);
+wasm2c_table__init__104__wasm_free(&table__init__104__wasm_instance);
+
+}
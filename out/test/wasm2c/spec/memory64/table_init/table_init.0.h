@@ -0,0 +1,54 @@
+/* Automatically generated by wasm2c */
+#ifndef TABLE_INIT_0_H_GENERATED_
+#define TABLE_INIT_0_H_GENERATED_
+
+#include "wasm-rt.h"
+
+#include <stdint.h>
+
+#ifndef WASM_RT_CORE_TYPES_DEFINED
+#define WASM_RT_CORE_TYPES_DEFINED
+typedef uint8_t u8;
+typedef int8_t s8;
+typedef uint16_t u16;
+typedef int16_t s16;
+typedef uint32_t u32;
+typedef int32_t s32;
+typedef uint64_t u64;
+typedef int64_t s64;
+typedef float f32;
+typedef double f64;
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct w2c_a {
+  char dummy_member;
+} w2c_a;
+
+void wasm2c_a_instantiate(w2c_a*);
+void wasm2c_a_free(w2c_a*);
+wasm_rt_func_type_t wasm2c_a_get_func_type(uint32_t param_count, uint32_t result_count, ...);
+
+/* export: 'ef0' */
+u32 w2c_a_ef0(w2c_a*);
+
+/* export: 'ef1' */
+u32 w2c_a_ef1(w2c_a*);
+
+/* export: 'ef2' */
+u32 w2c_a_ef2(w2c_a*);
+
+/* export: 'ef3' */
+u32 w2c_a_ef3(w2c_a*);
+
+/* export: 'ef4' */
+u32 w2c_a_ef4(w2c_a*);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* TABLE_INIT_0_H_GENERATED_ */
@@ -0,0 +1,45 @@
+/* Automatically generated by wasm2c */
+#ifndef TABLE_INIT_19_H_GENERATED_
+#define TABLE_INIT_19_H_GENERATED_
+
+#include "wasm-rt.h"
+
+#include <stdint.h>
+
+#ifndef WASM_RT_CORE_TYPES_DEFINED
+#define WASM_RT_CORE_TYPES_DEFINED
+typedef uint8_t u8;
+typedef int8_t s8;
+typedef uint16_t u16;
+typedef int16_t s16;
+typedef uint32_t u32;
+typedef int32_t s32;
+typedef uint64_t u64;
+typedef int64_t s64;
+typedef float f32;
+typedef double f64;
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct w2c_table__init__19__wasm {
+  wasm_rt_funcref_table_t w2c_T0;
+  wasm_rt_funcref_table_t w2c_T1;
+  bool elem_segment_dropped_w2c_table__init__19__wasm_e1 : 1;
+  bool elem_segment_dropped_w2c_table__init__19__wasm_e3 : 1;
+} w2c_table__init__19__wasm;
+
+void wasm2c_table__init__19__wasm_instantiate(w2c_table__init__19__wasm*);
+void wasm2c_table__init__19__wasm_free(w2c_table__init__19__wasm*);
+wasm_rt_func_type_t wasm2c_table__init__19__wasm_get_func_type(uint32_t param_count, uint32_t result_count, ...);
+
+/* export: 'test' */
+void w2c_table__init__19__wasm_test(w2c_table__init__19__wasm*);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* TABLE_INIT_19_H_GENERATED_ */
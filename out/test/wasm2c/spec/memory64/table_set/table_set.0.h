@@ -0,0 +1,65 @@
+/* Automatically generated by wasm2c */
+#ifndef TABLE_SET_0_H_GENERATED_
+#define TABLE_SET_0_H_GENERATED_
+
+#include "wasm-rt.h"
+
+#include <stdint.h>
+
+#ifndef WASM_RT_CORE_TYPES_DEFINED
+#define WASM_RT_CORE_TYPES_DEFINED
+typedef uint8_t u8;
+typedef int8_t s8;
+typedef uint16_t u16;
+typedef int16_t s16;
+typedef uint32_t u32;
+typedef int32_t s32;
+typedef uint64_t u64;
+typedef int64_t s64;
+typedef float f32;
+typedef double f64;
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct w2c_table__set__0__wasm {
+  wasm_rt_externref_table_t w2c_T0;
+  wasm_rt_funcref_table_t w2c_T1;
+  wasm_rt_funcref_table_t w2c_T2;
+} w2c_table__set__0__wasm;
+
+void wasm2c_table__set__0__wasm_instantiate(w2c_table__set__0__wasm*);
+void wasm2c_table__set__0__wasm_free(w2c_table__set__0__wasm*);
+wasm_rt_func_type_t wasm2c_table__set__0__wasm_get_func_type(uint32_t param_count, uint32_t result_count, ...);
+
+/* export: 'get-externref' */
+wasm_rt_externref_t w2c_table__set__0__wasm_get0x2Dexternref(w2c_table__set__0__wasm*, u32);
+
+/* export: 'get-funcref' */
+wasm_rt_funcref_t w2c_table__set__0__wasm_get0x2Dfuncref(w2c_table__set__0__wasm*, u32);
+
+/* export: 'get-funcref-t64' */
+wasm_rt_funcref_t w2c_table__set__0__wasm_get0x2Dfuncref0x2Dt64(w2c_table__set__0__wasm*, u64);
+
+/* export: 'set-externref' */
+void w2c_table__set__0__wasm_set0x2Dexternref(w2c_table__set__0__wasm*, u32, wasm_rt_externref_t);
+
+/* export: 'set-funcref' */
+void w2c_table__set__0__wasm_set0x2Dfuncref(w2c_table__set__0__wasm*, u32, wasm_rt_funcref_t);
+
+/* export: 'set-funcref-from' */
+void w2c_table__set__0__wasm_set0x2Dfuncref0x2Dfrom(w2c_table__set__0__wasm*, u32, u32);
+
+/* export: 'set-funcref-t64' */
+void w2c_table__set__0__wasm_set0x2Dfuncref0x2Dt64(w2c_table__set__0__wasm*, u64, wasm_rt_funcref_t);
+
+/* export: 'is_null-funcref' */
+u32 w2c_table__set__0__wasm_is_null0x2Dfuncref(w2c_table__set__0__wasm*, u32);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* TABLE_SET_0_H_GENERATED_ */
@@ -0,0 +1,70 @@
+/* Automatically generated by wasm2c */
+#ifndef TABLE_SIZE_0_H_GENERATED_
+#define TABLE_SIZE_0_H_GENERATED_
+
+#include "wasm-rt.h"
+
+#include <stdint.h>
+
+#ifndef WASM_RT_CORE_TYPES_DEFINED
+#define WASM_RT_CORE_TYPES_DEFINED
+typedef uint8_t u8;
+typedef int8_t s8;
+typedef uint16_t u16;
+typedef int16_t s16;
+typedef uint32_t u32;
+typedef int32_t s32;
+typedef uint64_t u64;
+typedef int64_t s64;
+typedef float f32;
+typedef double f64;
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct w2c_table__size__0__wasm {
+  wasm_rt_externref_table_t w2c_T0;
+  wasm_rt_externref_table_t w2c_T1;
+  wasm_rt_externref_table_t w2c_T2;
+  wasm_rt_externref_table_t w2c_T3;
+  wasm_rt_externref_table_t w2c_T4;
+} w2c_table__size__0__wasm;
+
+void wasm2c_table__size__0__wasm_instantiate(w2c_table__size__0__wasm*);
+void wasm2c_table__size__0__wasm_free(w2c_table__size__0__wasm*);
+wasm_rt_func_type_t wasm2c_table__size__0__wasm_get_func_type(uint32_t param_count, uint32_t result_count, ...);
+
+/* export: 'size-t0' */
+u32 w2c_table__size__0__wasm_size0x2Dt0(w2c_table__size__0__wasm*);
+
+/* export: 'size-t1' */
+u32 w2c_table__size__0__wasm_size0x2Dt1(w2c_table__size__0__wasm*);
+
+/* export: 'size-t2' */
+u32 w2c_table__size__0__wasm_size0x2Dt2(w2c_table__size__0__wasm*);
+
+/* export: 'size-t3' */
+u32 w2c_table__size__0__wasm_size0x2Dt3(w2c_table__size__0__wasm*);
+
+/* export: 'size-t64' */
+u64 w2c_table__size__0__wasm_size0x2Dt64(w2c_table__size__0__wasm*);
+
+/* export: 'grow-t0' */
+void w2c_table__size__0__wasm_grow0x2Dt0(w2c_table__size__0__wasm*, u32);
+
+/* export: 'grow-t1' */
+void w2c_table__size__0__wasm_grow0x2Dt1(w2c_table__size__0__wasm*, u32);
+
+/* export: 'grow-t2' */
+void w2c_table__size__0__wasm_grow0x2Dt2(w2c_table__size__0__wasm*, u32);
+
+/* export: 'grow-t3' */
+void w2c_table__size__0__wasm_grow0x2Dt3(w2c_table__size__0__wasm*, u32);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* TABLE_SIZE_0_H_GENERATED_ */
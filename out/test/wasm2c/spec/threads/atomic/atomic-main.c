@@ -0,0 +1,1312 @@
+#include "atomic.0.h"
+#include "atomic.1.h"
+#include "atomic.2.h"
+#include "atomic.3.h"
+#include <assert.h>
+#define __STDC_FORMAT_MACROS
+#include <inttypes.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "wasm-rt.h"
+#include "wasm-rt-impl.h"
+#include "wasm-rt-exceptions.h"
+
+/* NOTE: function argument evaluation order is implementation-defined in C,
+   so it SHOULD NOT be relied on by tests. */
+#if WABT_BIG_ENDIAN
+#define v128_i8x16_make(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p) \
+	simde_wasm_i8x16_make(p,o,n,m,l,k,j,i,h,g,f,e,d,c,b,a)
+#define v128_u8x16_make(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p) \
+	simde_wasm_u8x16_make(p,o,n,m,l,k,j,i,h,g,f,e,d,c,b,a)
+#define v128_i16x8_make(a,b,c,d,e,f,g,h) simde_wasm_i16x8_make(h,g,f,e,d,c,b,a)
+#define v128_u16x8_make(a,b,c,d,e,f,g,h) simde_wasm_u16x8_make(h,g,f,e,d,c,b,a)
+#define v128_i32x4_make(a,b,c,d) simde_wasm_i32x4_make(d,c,b,a)
+#define v128_u32x4_make(a,b,c,d) simde_wasm_u32x4_make(d,c,b,a)
+#define v128_i64x2_make(a,b) simde_wasm_i64x2_make(b,a)
+#define v128_u64x2_make(a,b) simde_wasm_u64x2_make(b,a)
+#define v128_f32x4_make(a,b,c,d) simde_wasm_f32x4_make(d,c,b,a)
+#define v128_f64x2_make(a,b) simde_wasm_f64x2_make(b,a)
+#define v128_i8x16_extract_lane(a,n) simde_wasm_u8x16_extract_lane(a,15-(n))
+#define v128_u8x16_extract_lane(a,n) simde_wasm_u8x16_extract_lane(a,15-(n))
+#define v128_i16x8_extract_lane(a,n) simde_wasm_u16x8_extract_lane(a,7-(n))
+#define v128_u16x8_extract_lane(a,n) simde_wasm_u16x8_extract_lane(a,7-(n))
+#define v128_i32x4_extract_lane(a,n) simde_wasm_u32x4_extract_lane(a,3-(n))
+#define v128_u32x4_extract_lane(a,n) simde_wasm_u32x4_extract_lane(a,3-(n))
+#define v128_i64x2_extract_lane(a,n) simde_wasm_u64x2_extract_lane(a,1-(n))
+#define v128_u64x2_extract_lane(a,n) simde_wasm_u64x2_extract_lane(a,1-(n))
+#define v128_f32x4_extract_lane(a,n) simde_wasm_f32x4_extract_lane(a,3-(n))
+#define v128_f64x2_extract_lane(a,n) simde_wasm_f64x2_extract_lane(a,1-(n))
+#else
+#define v128_i8x16_make simde_wasm_i8x16_make
+#define v128_u8x16_make simde_wasm_u8x16_make
+#define v128_i16x8_make simde_wasm_i16x8_make
+#define v128_u16x8_make simde_wasm_u16x8_make
+#define v128_i32x4_make simde_wasm_i32x4_make
+#define v128_u32x4_make simde_wasm_u32x4_make
+#define v128_i64x2_make simde_wasm_i64x2_make
+#define v128_u64x2_make simde_wasm_u64x2_make
+#define v128_f32x4_make simde_wasm_f32x4_make
+#define v128_f64x2_make simde_wasm_f64x2_make
+// like is_equal_TYPE below, always use unsigned for these
+#define v128_i8x16_extract_lane simde_wasm_u8x16_extract_lane
+#define v128_u8x16_extract_lane simde_wasm_u8x16_extract_lane
+#define v128_i16x8_extract_lane simde_wasm_u16x8_extract_lane
+#define v128_u16x8_extract_lane simde_wasm_u16x8_extract_lane
+#define v128_i32x4_extract_lane simde_wasm_u32x4_extract_lane
+#define v128_u32x4_extract_lane simde_wasm_u32x4_extract_lane
+#define v128_i64x2_extract_lane simde_wasm_u64x2_extract_lane
+#define v128_u64x2_extract_lane simde_wasm_u64x2_extract_lane
+#define v128_f32x4_extract_lane simde_wasm_f32x4_extract_lane
+#define v128_f64x2_extract_lane simde_wasm_f64x2_extract_lane
+#endif
+
+static int g_tests_run;
+static int g_tests_passed;
+
+static void run_spec_tests(void);
+
+static void error(const char* file, int line, const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  fprintf(stderr, "%s:%d: assertion failed: ", file, line);
+  vfprintf(stderr, format, args);
+  va_end(args);
+}
+
+#define ASSERT_EXCEPTION(f)                                               \
+  do {                                                                    \
+    g_tests_run++;                                                        \
+    if (wasm_rt_impl_try() == WASM_RT_TRAP_UNCAUGHT_EXCEPTION) {          \
+      g_tests_passed++;                                                   \
+    } else {                                                              \
+      (void)(f);                                                          \
+      error(__FILE__, __LINE__, "expected " #f " to throw exception.\n"); \
+    }                                                                     \
+  } while (0)
+
+#define ASSERT_TRAP(f)                                         \
+  do {                                                         \
+    g_tests_run++;                                             \
+    if (wasm_rt_impl_try() != 0) {                             \
+      g_tests_passed++;                                        \
+    } else {                                                   \
+      (void)(f);                                               \
+      error(__FILE__, __LINE__, "expected " #f " to trap.\n"); \
+    }                                                          \
+  } while (0)
+
+#define ASSERT_EXHAUSTION(f)                                     \
+  do {                                                           \
+    g_tests_run++;                                               \
+    wasm_rt_trap_t code = wasm_rt_impl_try();                    \
+    switch (code) {                                              \
+      case WASM_RT_TRAP_NONE:                                    \
+        (void)(f);                                               \
+        error(__FILE__, __LINE__, "expected " #f " to trap.\n"); \
+        break;                                                   \
+      case WASM_RT_TRAP_EXHAUSTION:                              \
+        g_tests_passed++;                                        \
+        break;                                                   \
+      default:                                                   \
+        error(__FILE__, __LINE__,                                \
+              "expected " #f                                     \
+              " to trap due to exhaustion, got trap code %d.\n", \
+              code);                                             \
+        break;                                                   \
+    }                                                            \
+  } while (0)
+
+#define ASSERT_RETURN(f)                               \
+  do {                                                 \
+    g_tests_run++;                                     \
+    int trap_code = wasm_rt_impl_try();                \
+    if (trap_code) {                                   \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n", \
+            wasm_rt_strerror(trap_code));              \
+    } else {                                           \
+      f;                                               \
+      g_tests_passed++;                                \
+    }                                                  \
+  } while (0)
+
+#define ASSERT_RETURN_T(type, fmt, f, expected)                          \
+  do {                                                                   \
+    g_tests_run++;                                                       \
+    int trap_code = wasm_rt_impl_try();                                  \
+    if (trap_code) {                                                     \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                   \
+            wasm_rt_strerror(trap_code));                                \
+    } else {                                                             \
+      type actual = f;                                                   \
+      if (is_equal_##type(actual, expected)) {                           \
+        g_tests_passed++;                                                \
+      } else {                                                           \
+        error(__FILE__, __LINE__,                                        \
+              "in " #f ": expected %" fmt ", got %" fmt ".\n", expected, \
+              actual);                                                   \
+      }                                                                  \
+    }                                                                    \
+  } while (0)
+
+#define ASSERT_RETURN_FUNCREF(f, expected)                                \
+  do {                                                                    \
+    g_tests_run++;                                                        \
+    int trap_code = wasm_rt_impl_try();                                   \
+    if (trap_code) {                                                      \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                    \
+            wasm_rt_strerror(trap_code));                                 \
+    } else {                                                              \
+      wasm_rt_funcref_t actual = f;                                       \
+      if (is_equal_wasm_rt_funcref_t(actual, expected)) {                 \
+        g_tests_passed++;                                                 \
+      } else {                                                            \
+        error(__FILE__, __LINE__,                                         \
+              "in " #f ": mismatch between expected and actual funcref"); \
+      }                                                                   \
+    }                                                                     \
+  } while (0)
+
+#define ASSERT_RETURN_EXNREF(f, expected)                                \
+  do {                                                                   \
+    g_tests_run++;                                                       \
+    int trap_code = wasm_rt_impl_try();                                  \
+    if (trap_code) {                                                     \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                   \
+            wasm_rt_strerror(trap_code));                                \
+    } else {                                                             \
+      wasm_rt_exnref_t actual = f;                                       \
+      if (is_equal_wasm_rt_exnref_t(actual, expected)) {                 \
+        g_tests_passed++;                                                \
+      } else {                                                           \
+        error(__FILE__, __LINE__,                                        \
+              "in " #f ": mismatch between expected and actual exnref"); \
+      }                                                                  \
+    }                                                                    \
+  } while (0)
+
+#define ASSERT_RETURN_NAN_T(type, itype, fmt, f, kind)                        \
+  do {                                                                        \
+    g_tests_run++;                                                            \
+    int trap_code = wasm_rt_impl_try();                                       \
+    if (trap_code) {                                                          \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                        \
+            wasm_rt_strerror(trap_code));                                     \
+    } else {                                                                  \
+      type actual = f;                                                        \
+      itype iactual;                                                          \
+      memcpy(&iactual, &actual, sizeof(iactual));                             \
+      if (is_##kind##_nan_##type(iactual)) {                                  \
+        g_tests_passed++;                                                     \
+      } else {                                                                \
+        error(__FILE__, __LINE__,                                             \
+              "in " #f ": expected result to be a " #kind " nan, got 0x%" fmt \
+              ".\n",                                                          \
+              iactual);                                                       \
+      }                                                                       \
+    }                                                                         \
+  } while (0)
+
+#define MULTI_T_UNPACK_(...) __VA_ARGS__
+#define MULTI_T_UNPACK(arg) MULTI_T_UNPACK_ arg
+#define MULTI_i8 "%" PRIu8 " "
+#define MULTI_i16 "%" PRIu16 " "
+#define MULTI_i32 "%u "
+#define MULTI_i64 "%" PRIu64 " "
+#define MULTI_f32 "%.9g "
+#define MULTI_f64 "%.17g "
+#define MULTI_str "%s "
+#define ASSERT_RETURN_MULTI_T(type, fmt_expected, fmt_got, f, compare,        \
+                              expected, found)                                \
+  do {                                                                        \
+    g_tests_run++;                                                            \
+    int trap_code = wasm_rt_impl_try();                                       \
+    if (trap_code) {                                                          \
+      error(__FILE__, __LINE__, #f " trapped (%s).\n",                        \
+            wasm_rt_strerror(trap_code));                                     \
+    } else {                                                                  \
+      type actual = f;                                                        \
+      if (compare) {                                                          \
+        g_tests_passed++;                                                     \
+      } else {                                                                \
+        error(__FILE__, __LINE__,                                             \
+              "in " #f ": expected <" fmt_expected ">, got <" fmt_got ">.\n", \
+              MULTI_T_UNPACK(expected), MULTI_T_UNPACK(found));               \
+      }                                                                       \
+    }                                                                         \
+  } while (0)
+
+
+#define ASSERT_RETURN_I32(f, expected) ASSERT_RETURN_T(u32, "u", f, expected)
+#define ASSERT_RETURN_I64(f, expected) ASSERT_RETURN_T(u64, PRIu64, f, expected)
+#define ASSERT_RETURN_F32(f, expected) ASSERT_RETURN_T(f32, ".9g", f, expected)
+#define ASSERT_RETURN_F64(f, expected) ASSERT_RETURN_T(f64, ".17g", f, expected)
+#define ASSERT_RETURN_EXTERNREF(f, expected) \
+  ASSERT_RETURN_T(wasm_rt_externref_t, "p", f, expected);
+
+#define ASSERT_RETURN_CANONICAL_NAN_F32(f) \
+  ASSERT_RETURN_NAN_T(f32, u32, "08x", f, canonical)
+#define ASSERT_RETURN_CANONICAL_NAN_F64(f) \
+  ASSERT_RETURN_NAN_T(f64, u64, "016x", f, canonical)
+#define ASSERT_RETURN_ARITHMETIC_NAN_F32(f) \
+  ASSERT_RETURN_NAN_T(f32, u32, "08x", f, arithmetic)
+#define ASSERT_RETURN_ARITHMETIC_NAN_F64(f) \
+  ASSERT_RETURN_NAN_T(f64, u64, "016x", f, arithmetic)
+
+static bool is_equal_u8(u8 x, u8 y) {
+  return x == y;
+}
+
+static bool is_equal_u16(u16 x, u16 y) {
+  return x == y;
+}
+
+static bool is_equal_u32(u32 x, u32 y) {
+  return x == y;
+}
+
+static bool is_equal_u64(u64 x, u64 y) {
+  return x == y;
+}
+
+#define is_equal_i8 is_equal_u8
+#define is_equal_i16 is_equal_u16
+#define is_equal_i32 is_equal_u32
+#define is_equal_i64 is_equal_u64
+
+static bool is_equal_wasm_rt_externref_t(wasm_rt_externref_t x,
+                                         wasm_rt_externref_t y) {
+  return x == y;
+}
+
+static inline bool is_equal_wasm_rt_func_type_t(const wasm_rt_func_type_t a,
+                                                const wasm_rt_func_type_t b) {
+  return (a == b) || (a && b && !memcmp(a, b, 32));
+}
+
+static bool is_equal_wasm_rt_funcref_t(wasm_rt_funcref_t x,
+                                       wasm_rt_funcref_t y) {
+  return is_equal_wasm_rt_func_type_t(x.func_type, y.func_type) &&
+         (x.func == y.func) && (x.module_instance == y.module_instance);
+}
+
+#ifdef WASM_EXN_MAX_SIZE
+static bool is_equal_wasm_rt_exnref_t(wasm_rt_exnref_t x, wasm_rt_exnref_t y) {
+  return x.tag == y.tag && x.size == y.size && !memcmp(x.data, y.data, x.size);
+}
+#endif
+
+wasm_rt_externref_t spectest_make_externref(uintptr_t x) {
+  return (wasm_rt_externref_t)(x + 1);  // externref(0) is not null
+}
+
+static u32 f32_bits(f32 x) {
+  u32 ux;
+  memcpy(&ux, &x, sizeof(ux));
+  return ux;
+}
+
+static u64 f64_bits(f64 x) {
+  u64 ux;
+  memcpy(&ux, &x, sizeof(ux));
+  return ux;
+}
+
+static bool is_equal_f32(f32 x, f32 y) {
+  return f32_bits(x) == f32_bits(y);
+}
+
+static bool is_equal_f64(f64 x, f64 y) {
+  return f64_bits(x) == f64_bits(y);
+}
+
+static f32 make_nan_f32(u32 x) {
+  x |= 0x7f800000;
+  f32 res;
+  memcpy(&res, &x, sizeof(res));
+  return res;
+}
+
+static f64 make_nan_f64(u64 x) {
+  x |= 0x7ff0000000000000;
+  f64 res;
+  memcpy(&res, &x, sizeof(res));
+  return res;
+}
+
+static bool is_canonical_nan_f32(u32 x) {
+  return (x & 0x7fffffff) == 0x7fc00000;
+}
+
+static bool is_canonical_nan_f64(u64 x) {
+  return (x & 0x7fffffffffffffff) == 0x7ff8000000000000;
+}
+
+static bool is_arithmetic_nan_f32(u32 x) {
+  return (x & 0x7fc00000) == 0x7fc00000;
+}
+
+static bool is_arithmetic_nan_f64(u64 x) {
+  return (x & 0x7ff8000000000000) == 0x7ff8000000000000;
+}
+
+typedef struct w2c_spectest {
+  wasm_rt_funcref_table_t spectest_table;
+  wasm_rt_funcref_table_t spectest_table64;
+  wasm_rt_memory_t spectest_memory;
+  uint32_t spectest_global_i32;
+  uint64_t spectest_global_i64;
+  float spectest_global_f32;
+  double spectest_global_f64;
+} w2c_spectest;
+
+static w2c_spectest spectest_instance;
+
+/*
+ * spectest implementations
+ */
+void w2c_spectest_print(w2c_spectest* instance) {
+  printf("spectest.print()\n");
+}
+
+void w2c_spectest_print_i32(w2c_spectest* instance, uint32_t i) {
+  printf("spectest.print_i32(%d)\n", i);
+}
+
+void w2c_spectest_print_i64(w2c_spectest* instance, uint64_t i) {
+  printf("spectest.print_i64(%" PRIu64 ")\n", i);
+}
+
+void w2c_spectest_print_f32(w2c_spectest* instance, float f) {
+  printf("spectest.print_f32(%g)\n", f);
+}
+
+void w2c_spectest_print_i32_f32(w2c_spectest* instance, uint32_t i, float f) {
+  printf("spectest.print_i32_f32(%d %g)\n", i, f);
+}
+
+void w2c_spectest_print_f64(w2c_spectest* instance, double d) {
+  printf("spectest.print_f64(%g)\n", d);
+}
+
+void w2c_spectest_print_f64_f64(w2c_spectest* instance, double d1, double d2) {
+  printf("spectest.print_f64_f64(%g %g)\n", d1, d2);
+}
+
+wasm_rt_funcref_table_t* w2c_spectest_table(w2c_spectest* instance) {
+  return &instance->spectest_table;
+}
+
+wasm_rt_funcref_table_t* w2c_spectest_table64(w2c_spectest* instance) {
+  return &instance->spectest_table64;
+}
+
+wasm_rt_memory_t* w2c_spectest_memory(w2c_spectest* instance) {
+  return &instance->spectest_memory;
+}
+
+uint32_t* w2c_spectest_global_i32(w2c_spectest* instance) {
+  return &instance->spectest_global_i32;
+}
+
+uint64_t* w2c_spectest_global_i64(w2c_spectest* instance) {
+  return &instance->spectest_global_i64;
+}
+
+float* w2c_spectest_global_f32(w2c_spectest* instance) {
+  return &instance->spectest_global_f32;
+}
+
+double* w2c_spectest_global_f64(w2c_spectest* instance) {
+  return &instance->spectest_global_f64;
+}
+
+static void init_spectest_module(w2c_spectest* instance) {
+  instance->spectest_global_i32 = 666;
+  instance->spectest_global_i64 = 666l;
+  instance->spectest_global_f32 = 666.6;
+  instance->spectest_global_f64 = 666.6;
+  wasm_rt_allocate_memory(&instance->spectest_memory, 1, 2, false,
+                          WASM_DEFAULT_PAGE_SIZE);
+  wasm_rt_allocate_funcref_table(&instance->spectest_table, 10, 20);
+  wasm_rt_allocate_funcref_table(&instance->spectest_table64, 10, 20);
+}
+
+// POSIX-only test config where embedder handles signals instead of w2c runtime
+#ifdef WASM2C_TEST_EMBEDDER_SIGNAL_HANDLING
+#include <signal.h>
+
+static void posix_signal_handler(int sig, siginfo_t* si, void* unused) {
+  wasm_rt_trap((si->si_code == SEGV_ACCERR) ? WASM_RT_TRAP_OOB
+                                            : WASM_RT_TRAP_EXHAUSTION);
+}
+
+static void posix_install_signal_handler(void) {
+  /* install altstack */
+  stack_t ss;
+  ss.ss_sp = malloc(SIGSTKSZ);
+  ss.ss_flags = 0;
+  ss.ss_size = SIGSTKSZ;
+  if (sigaltstack(&ss, NULL) != 0) {
+    perror("sigaltstack failed");
+    abort();
+  }
+
+  /* install signal handler */
+  struct sigaction sa;
+  memset(&sa, '\0', sizeof(sa));
+  sa.sa_flags = SA_SIGINFO | SA_ONSTACK;
+  sigemptyset(&sa.sa_mask);
+  sa.sa_sigaction = posix_signal_handler;
+  if (sigaction(SIGSEGV, &sa, NULL) != 0 || sigaction(SIGBUS, &sa, NULL) != 0) {
+    perror("sigaction failed");
+    abort();
+  }
+}
+
+static void posix_cleanup_signal_handler(void) {
+  /* remove signal handler */
+  struct sigaction sa;
+  memset(&sa, '\0', sizeof(sa));
+  sa.sa_handler = SIG_DFL;
+  if (sigaction(SIGSEGV, &sa, NULL) != 0 || sigaction(SIGBUS, &sa, NULL)) {
+    perror("sigaction failed");
+    abort();
+  }
+
+  /* disable and free altstack */
+  stack_t ss;
+  ss.ss_flags = SS_DISABLE;
+  if (sigaltstack(&ss, NULL) != 0) {
+    perror("sigaltstack failed");
+    abort();
+  }
+  free(ss.ss_sp);
+}
+#endif
+
+int main(int argc, char** argv) {
+#ifdef WASM2C_TEST_EMBEDDER_SIGNAL_HANDLING
+  posix_install_signal_handler();
+#endif
+  wasm_rt_init();
+  init_spectest_module(&spectest_instance);
+  run_spec_tests();
+  printf("%u/%u tests passed.\n", g_tests_passed, g_tests_run);
+  wasm_rt_free();
+#ifdef WASM2C_TEST_EMBEDDER_SIGNAL_HANDLING
+  posix_cleanup_signal_handler();
+#endif
+  return g_tests_passed != g_tests_run;
+}
+
+w2c_atomic__0__wasm atomic__0__wasm_instance;
+w2c_atomic__1__wasm atomic__1__wasm_instance;
+w2c_atomic__2__wasm atomic__2__wasm_instance;
+w2c_atomic__3__wasm atomic__3__wasm_instance;
+
+void run_spec_tests_0(void) {
+
+#line 6 "atomic.txt"
+wasm2c_atomic__0__wasm_instantiate(&atomic__0__wasm_instance);
+
+#line 87 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 506097522914230528ull);
+
+#line 89 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 50462976u);
+
+#line 90 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Eload(&atomic__0__wasm_instance, 4u), 117835012u);
+
+#line 92 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 506097522914230528ull);
+
+#line 94 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Eload8_u(&atomic__0__wasm_instance, 0u), 0u);
+
+#line 95 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Eload8_u(&atomic__0__wasm_instance, 5u), 5u);
+
+#line 97 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Eload16_u(&atomic__0__wasm_instance, 0u), 256u);
+
+#line 98 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Eload16_u(&atomic__0__wasm_instance, 6u), 1798u);
+
+#line 100 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload8_u(&atomic__0__wasm_instance, 0u), 0ull);
+
+#line 101 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload8_u(&atomic__0__wasm_instance, 5u), 5ull);
+
+#line 103 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload16_u(&atomic__0__wasm_instance, 0u), 256ull);
+
+#line 104 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload16_u(&atomic__0__wasm_instance, 6u), 1798ull);
+
+#line 106 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload32_u(&atomic__0__wasm_instance, 0u), 50462976ull);
+
+#line 107 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload32_u(&atomic__0__wasm_instance, 4u), 117835012ull);
+
+#line 111 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 0ull);
+
+#line 113 "atomic.txt"
+ASSERT_RETURN(w2c_atomic__0__wasm_i320x2Eatomic0x2Estore(&atomic__0__wasm_instance, 0u, 4293844428u));
+
+#line 114 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 4293844428ull);
+
+#line 116 "atomic.txt"
+ASSERT_RETURN(w2c_atomic__0__wasm_i640x2Eatomic0x2Estore(&atomic__0__wasm_instance, 0u, 81985529216486895ull));
+
+#line 117 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 81985529216486895ull);
+
+#line 119 "atomic.txt"
+ASSERT_RETURN(w2c_atomic__0__wasm_i320x2Eatomic0x2Estore8(&atomic__0__wasm_instance, 1u, 66u));
+
+#line 120 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 81985529216451311ull);
+
+#line 122 "atomic.txt"
+ASSERT_RETURN(w2c_atomic__0__wasm_i320x2Eatomic0x2Estore16(&atomic__0__wasm_instance, 4u, 34884u));
+
+#line 123 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 82059046171656943ull);
+
+#line 125 "atomic.txt"
+ASSERT_RETURN(w2c_atomic__0__wasm_i640x2Eatomic0x2Estore8(&atomic__0__wasm_instance, 1u, 153ull));
+
+#line 126 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 82059046171679215ull);
+
+#line 128 "atomic.txt"
+ASSERT_RETURN(w2c_atomic__0__wasm_i640x2Eatomic0x2Estore16(&atomic__0__wasm_instance, 4u, 51966ull));
+
+#line 129 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 82132412803029487ull);
+
+#line 131 "atomic.txt"
+ASSERT_RETURN(w2c_atomic__0__wasm_i640x2Eatomic0x2Estore32(&atomic__0__wasm_instance, 4u, 3735928559ull));
+
+#line 132 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 16045690983407131119ull);
+
+#line 136 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 137 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Eadd(&atomic__0__wasm_instance, 0u, 305419896u), 286331153u);
+
+#line 138 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938552723337ull);
+
+#line 140 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 141 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Eadd(&atomic__0__wasm_instance, 0u, 72340172854919682ull), 1229782938247303441ull);
+
+#line 142 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1302123111102223123ull);
+
+#line 144 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 145 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Eadd_u(&atomic__0__wasm_instance, 0u, 3452816845u), 17u);
+
+#line 146 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247303646ull);
+
+#line 148 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 149 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Eadd_u(&atomic__0__wasm_instance, 0u, 3405695742u), 4369u);
+
+#line 150 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247355407ull);
+
+#line 152 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 153 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Eadd_u(&atomic__0__wasm_instance, 0u, 4774451407313060418ull), 17ull);
+
+#line 154 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247303507ull);
+
+#line 156 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 157 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Eadd_u(&atomic__0__wasm_instance, 0u, 13758425323549998831ull), 4369ull);
+
+#line 158 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247352320ull);
+
+#line 160 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 161 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Eadd_u(&atomic__0__wasm_instance, 0u, 14608453322185352933ull), 286331153ull);
+
+#line 162 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782941648599030ull);
+
+#line 166 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 167 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Esub(&atomic__0__wasm_instance, 0u, 305419896u), 286331153u);
+
+#line 168 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782942236850841ull);
+
+#line 170 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 171 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Esub(&atomic__0__wasm_instance, 0u, 72340172854919682ull), 1229782938247303441ull);
+
+#line 172 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1157442765392383759ull);
+
+#line 174 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 175 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Esub_u(&atomic__0__wasm_instance, 0u, 3452816845u), 17u);
+
+#line 176 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247303492ull);
+
+#line 178 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 179 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Esub_u(&atomic__0__wasm_instance, 0u, 3405695742u), 4369u);
+
+#line 180 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247317011ull);
+
+#line 182 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 183 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Esub_u(&atomic__0__wasm_instance, 0u, 4774451407313060418ull), 17ull);
+
+#line 184 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247303631ull);
+
+#line 186 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 187 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Esub_u(&atomic__0__wasm_instance, 0u, 13758425323549998831ull), 4369ull);
+
+#line 188 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247320098ull);
+
+#line 190 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 191 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Esub_u(&atomic__0__wasm_instance, 0u, 14608453322185352933ull), 286331153ull);
+
+#line 192 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782939140975148ull);
+
+#line 196 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 197 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Eand(&atomic__0__wasm_instance, 0u, 305419896u), 286331153u);
+
+#line 198 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938230460432ull);
+
+#line 200 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 201 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Eand(&atomic__0__wasm_instance, 0u, 72340172854919682ull), 1229782938247303441ull);
+
+#line 202 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 72340172821233664ull);
+
+#line 204 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 205 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Eand_u(&atomic__0__wasm_instance, 0u, 3452816845u), 17u);
+
+#line 206 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247303425ull);
+
+#line 208 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 209 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Eand_u(&atomic__0__wasm_instance, 0u, 3405695742u), 4369u);
+
+#line 210 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247299088ull);
+
+#line 212 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 213 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Eand_u(&atomic__0__wasm_instance, 0u, 4774451407313060418ull), 17ull);
+
+#line 214 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247303424ull);
+
+#line 216 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 217 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Eand_u(&atomic__0__wasm_instance, 0u, 13758425323549998831ull), 4369ull);
+
+#line 218 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247303169ull);
+
+#line 220 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 221 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Eand_u(&atomic__0__wasm_instance, 0u, 14608453322185352933ull), 286331153ull);
+
+#line 222 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782937962086401ull);
+
+#line 226 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 227 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Eor(&atomic__0__wasm_instance, 0u, 305419896u), 286331153u);
+
+#line 228 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938283235193ull);
+
+#line 230 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 231 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Eor(&atomic__0__wasm_instance, 0u, 72340172854919682ull), 1229782938247303441ull);
+
+#line 232 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938280989459ull);
+
+#line 234 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 235 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Eor_u(&atomic__0__wasm_instance, 0u, 3452816845u), 17u);
+
+#line 236 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247303645ull);
+
+#line 238 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 239 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Eor_u(&atomic__0__wasm_instance, 0u, 3405695742u), 4369u);
+
+#line 240 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247355391ull);
+
+#line 242 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 243 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Eor_u(&atomic__0__wasm_instance, 0u, 4774451407313060418ull), 17ull);
+
+#line 244 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247303507ull);
+
+#line 246 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 247 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Eor_u(&atomic__0__wasm_instance, 0u, 13758425323549998831ull), 4369ull);
+
+#line 248 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247348223ull);
+
+#line 250 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 251 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Eor_u(&atomic__0__wasm_instance, 0u, 14608453322185352933ull), 286331153ull);
+
+#line 252 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782941647484917ull);
+
+#line 256 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 257 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Exor(&atomic__0__wasm_instance, 0u, 305419896u), 286331153u);
+
+#line 258 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938013747049ull);
+
+#line 260 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 261 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Exor(&atomic__0__wasm_instance, 0u, 72340172854919682ull), 1229782938247303441ull);
+
+#line 262 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1157442765459755795ull);
+
+#line 264 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 265 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Exor_u(&atomic__0__wasm_instance, 0u, 3452816845u), 17u);
+
+#line 266 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247303644ull);
+
+#line 268 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 269 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Exor_u(&atomic__0__wasm_instance, 0u, 3405695742u), 4369u);
+
+#line 270 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247355375ull);
+
+#line 272 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 273 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Exor_u(&atomic__0__wasm_instance, 0u, 4774451407313060418ull), 17ull);
+
+#line 274 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247303507ull);
+
+#line 276 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 277 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Exor_u(&atomic__0__wasm_instance, 0u, 13758425323549998831ull), 4369ull);
+
+#line 278 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247344126ull);
+
+#line 280 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 281 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Exor_u(&atomic__0__wasm_instance, 0u, 14608453322185352933ull), 286331153ull);
+
+#line 282 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782941646370804ull);
+
+#line 286 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 287 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Exchg(&atomic__0__wasm_instance, 0u, 305419896u), 286331153u);
+
+#line 288 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938266392184ull);
+
+#line 290 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 291 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Exchg(&atomic__0__wasm_instance, 0u, 72340172854919682ull), 1229782938247303441ull);
+
+#line 292 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 72340172854919682ull);
+
+#line 294 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 295 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Exchg_u(&atomic__0__wasm_instance, 0u, 3452816845u), 17u);
+
+#line 296 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247303629ull);
+
+#line 298 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 299 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Exchg_u(&atomic__0__wasm_instance, 0u, 3405695742u), 4369u);
+
+#line 300 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247351038ull);
+
+#line 302 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 303 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Exchg_u(&atomic__0__wasm_instance, 0u, 4774451407313060418ull), 17ull);
+
+#line 304 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247303490ull);
+
+#line 306 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 307 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Exchg_u(&atomic__0__wasm_instance, 0u, 13758425323549998831ull), 4369ull);
+
+#line 308 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247347951ull);
+
+#line 310 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 311 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Exchg_u(&atomic__0__wasm_instance, 0u, 14608453322185352933ull), 286331153ull);
+
+#line 312 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782941362267877ull);
+
+#line 316 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 317 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Ecmpxchg(&atomic__0__wasm_instance, 0u, 0u, 305419896u), 286331153u);
+
+#line 318 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247303441ull);
+
+#line 320 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 321 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Ecmpxchg(&atomic__0__wasm_instance, 0u, 0ull, 72340172854919682ull), 1229782938247303441ull);
+
+#line 322 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247303441ull);
+
+#line 324 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 325 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Ecmpxchg_u(&atomic__0__wasm_instance, 0u, 0u, 3452816845u), 17u);
+
+#line 326 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247303441ull);
+
+#line 328 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 329 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Ecmpxchg_u(&atomic__0__wasm_instance, 0u, 286331153u, 3452816845u), 17u);
+
+#line 330 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247303629ull);
+
+#line 332 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 333 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Ecmpxchg_u(&atomic__0__wasm_instance, 0u, 0u, 3405695742u), 4369u);
+
+#line 334 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247303441ull);
+
+#line 336 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 337 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Ecmpxchg_u(&atomic__0__wasm_instance, 0u, 286331153u, 3405695742u), 4369u);
+
+#line 338 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247351038ull);
+
+#line 340 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 341 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Ecmpxchg_u(&atomic__0__wasm_instance, 0u, 0ull, 4774451407313060418ull), 17ull);
+
+#line 342 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247303441ull);
+
+#line 344 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 345 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Ecmpxchg_u(&atomic__0__wasm_instance, 0u, 1229782938247303441ull, 4774451407313060418ull), 17ull);
+
+#line 346 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247303490ull);
+
+#line 348 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 349 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Ecmpxchg_u(&atomic__0__wasm_instance, 0u, 0ull, 13758425323549998831ull), 4369ull);
+
+#line 350 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247303441ull);
+
+#line 352 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 353 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Ecmpxchg_u(&atomic__0__wasm_instance, 0u, 1229782938247303441ull, 13758425323549998831ull), 4369ull);
+
+#line 354 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247347951ull);
+
+#line 356 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 357 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Ecmpxchg_u(&atomic__0__wasm_instance, 0u, 0ull, 14608453322185352933ull), 286331153ull);
+
+#line 358 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247303441ull);
+
+#line 360 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 361 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Ecmpxchg_u(&atomic__0__wasm_instance, 0u, 1229782938247303441ull, 14608453322185352933ull), 286331153ull);
+
+#line 362 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782941362267877ull);
+
+#line 366 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 367 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Ecmpxchg(&atomic__0__wasm_instance, 0u, 286331153u, 305419896u), 286331153u);
+
+#line 368 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938266392184ull);
+
+#line 370 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 371 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Ecmpxchg(&atomic__0__wasm_instance, 0u, 1229782938247303441ull, 72340172854919682ull), 1229782938247303441ull);
+
+#line 372 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 72340172854919682ull);
+
+#line 374 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 375 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Ecmpxchg_u(&atomic__0__wasm_instance, 0u, 17u, 3452816845u), 17u);
+
+#line 376 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247303629ull);
+
+#line 378 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 379 "atomic.txt"
+ASSERT_RETURN_I32(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Ecmpxchg_u(&atomic__0__wasm_instance, 0u, 4369u, 3405695742u), 4369u);
+
+#line 380 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247351038ull);
+
+#line 382 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 383 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Ecmpxchg_u(&atomic__0__wasm_instance, 0u, 17ull, 4774451407313060418ull), 17ull);
+
+#line 384 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247303490ull);
+
+#line 386 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 387 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Ecmpxchg_u(&atomic__0__wasm_instance, 0u, 4369ull, 13758425323549998831ull), 4369ull);
+
+#line 388 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782938247347951ull);
+
+#line 390 "atomic.txt"
+w2c_atomic__0__wasm_init(&atomic__0__wasm_instance, 1229782938247303441ull);
+
+#line 391 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Ecmpxchg_u(&atomic__0__wasm_instance, 0u, 286331153ull, 14608453322185352933ull), 286331153ull);
+
+#line 392 "atomic.txt"
+ASSERT_RETURN_I64(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 0u), 1229782941362267877ull);
+
+#line 397 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i320x2Eatomic0x2Eload(&atomic__0__wasm_instance, 1u));
+
+#line 398 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(&atomic__0__wasm_instance, 1u));
+
+#line 399 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i320x2Eatomic0x2Eload16_u(&atomic__0__wasm_instance, 1u));
+
+#line 400 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload16_u(&atomic__0__wasm_instance, 1u));
+
+#line 401 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i640x2Eatomic0x2Eload32_u(&atomic__0__wasm_instance, 1u));
+
+#line 402 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i320x2Eatomic0x2Estore(&atomic__0__wasm_instance, 1u, 0u));
+
+#line 403 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i640x2Eatomic0x2Estore(&atomic__0__wasm_instance, 1u, 0ull));
+
+#line 404 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i320x2Eatomic0x2Estore16(&atomic__0__wasm_instance, 1u, 0u));
+
+#line 405 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i640x2Eatomic0x2Estore16(&atomic__0__wasm_instance, 1u, 0ull));
+
+#line 406 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i640x2Eatomic0x2Estore32(&atomic__0__wasm_instance, 1u, 0ull));
+
+#line 407 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Eadd(&atomic__0__wasm_instance, 1u, 0u));
+
+#line 408 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Eadd(&atomic__0__wasm_instance, 1u, 0ull));
+
+#line 409 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Eadd_u(&atomic__0__wasm_instance, 1u, 0u));
+
+#line 410 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Eadd_u(&atomic__0__wasm_instance, 1u, 0ull));
+
+#line 411 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Eadd_u(&atomic__0__wasm_instance, 1u, 0ull));
+
+#line 412 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Esub(&atomic__0__wasm_instance, 1u, 0u));
+
+#line 413 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Esub(&atomic__0__wasm_instance, 1u, 0ull));
+
+#line 414 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Esub_u(&atomic__0__wasm_instance, 1u, 0u));
+
+#line 415 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Esub_u(&atomic__0__wasm_instance, 1u, 0ull));
+
+#line 416 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Esub_u(&atomic__0__wasm_instance, 1u, 0ull));
+
+#line 417 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Eand(&atomic__0__wasm_instance, 1u, 0u));
+
+#line 418 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Eand(&atomic__0__wasm_instance, 1u, 0ull));
+
+#line 419 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Eand_u(&atomic__0__wasm_instance, 1u, 0u));
+
+#line 420 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Eand_u(&atomic__0__wasm_instance, 1u, 0ull));
+
+#line 421 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Eand_u(&atomic__0__wasm_instance, 1u, 0ull));
+
+#line 422 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Eor(&atomic__0__wasm_instance, 1u, 0u));
+
+#line 423 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Eor(&atomic__0__wasm_instance, 1u, 0ull));
+
+#line 424 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Eor_u(&atomic__0__wasm_instance, 1u, 0u));
+
+#line 425 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Eor_u(&atomic__0__wasm_instance, 1u, 0ull));
+
+#line 426 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Eor_u(&atomic__0__wasm_instance, 1u, 0ull));
+
+#line 427 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Exor(&atomic__0__wasm_instance, 1u, 0u));
+
+#line 428 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Exor(&atomic__0__wasm_instance, 1u, 0ull));
+
+#line 429 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Exor_u(&atomic__0__wasm_instance, 1u, 0u));
+
+#line 430 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Exor_u(&atomic__0__wasm_instance, 1u, 0ull));
+
+#line 431 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Exor_u(&atomic__0__wasm_instance, 1u, 0ull));
+
+#line 432 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Exchg(&atomic__0__wasm_instance, 1u, 0u));
+
+#line 433 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Exchg(&atomic__0__wasm_instance, 1u, 0ull));
+
+#line 434 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Exchg_u(&atomic__0__wasm_instance, 1u, 0u));
+
+#line 435 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Exchg_u(&atomic__0__wasm_instance, 1u, 0ull));
+
+#line 436 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Exchg_u(&atomic__0__wasm_instance, 1u, 0ull));
+
+#line 437 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Ecmpxchg(&atomic__0__wasm_instance, 1u, 0u, 0u));
+
+#line 438 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Ecmpxchg(&atomic__0__wasm_instance, 1u, 0ull, 0ull));
+
+#line 439 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Ecmpxchg_u(&atomic__0__wasm_instance, 1u, 0u, 0u));
+
+#line 440 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Ecmpxchg_u(&atomic__0__wasm_instance, 1u, 0ull, 0ull));
+
+#line 441 "atomic.txt"
+ASSERT_TRAP(w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Ecmpxchg_u(&atomic__0__wasm_instance, 1u, 0ull, 0ull));
+
+#line 443 "atomic.txt"
+wasm2c_atomic__1__wasm_instantiate(&atomic__1__wasm_instance);
+
+#line 450 "atomic.txt"
+wasm2c_atomic__2__wasm_instantiate(&atomic__2__wasm_instance);
+
+#line 500 "atomic.txt"
+wasm2c_atomic__3__wasm_instantiate(&atomic__3__wasm_instance);
+
+#line 504 "atomic.txt"
+ASSERT_RETURN(w2c_atomic__3__wasm_fence(&atomic__3__wasm_instance));
+
+
+}
+
+void run_spec_tests(void) {
+
+run_spec_tests_0();
+wasm2c_atomic__0__wasm_free(&atomic__0__wasm_instance);
+wasm2c_atomic__1__wasm_free(&atomic__1__wasm_instance);
+wasm2c_atomic__2__wasm_free(&atomic__2__wasm_instance);
+wasm2c_atomic__3__wasm_free(&atomic__3__wasm_instance);
+
+}
@@ -0,0 +1,2628 @@
+/* Automatically generated by wasm2c */
+#include <assert.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <string.h>
+#if defined(__MINGW32__)
+#include <malloc.h>
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#include <malloc.h>
+#define alloca _alloca
+#elif defined(__FreeBSD__) || defined(__OpenBSD__)
+#include <stdlib.h>
+#else
+#include <alloca.h>
+#endif
+
+#include "atomic.0.h"
+
+// Computes a pointer to an object of the given size in a little-endian memory.
+//
+// On a little-endian host, this is just &mem->data[addr] - the object's size is
+// unused. On a big-endian host, it's &mem->data[mem->size - addr - n], where n
+// is the object's size.
+//
+// Note that mem may be evaluated multiple times.
+//
+// Parameters:
+// mem - The memory.
+// addr - The address.
+// n - The size of the object.
+//
+// Result:
+// A pointer for an object of size n.
+#if WABT_BIG_ENDIAN
+#define MEM_ADDR(mem, addr, n) ((mem)->data_end - (addr) - (n))
+#else
+#define MEM_ADDR(mem, addr, n) &((mem)->data[addr])
+#endif
+
+// We can only use Segue for this module if it uses a single unshared,
+// default-page, 32-bit imported or exported memory.
+#if WASM_RT_USE_SEGUE && IS_SINGLE_UNSHARED_DEFAULT32_MEMORY
+#define WASM_RT_USE_SEGUE_FOR_THIS_MODULE 1
+#else
+#define WASM_RT_USE_SEGUE_FOR_THIS_MODULE 0
+#endif
+
+#ifndef WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE
+#define WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE 1
+#endif
+
+#if WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE && WASM_RT_USE_MMAP && \
+    IS_SINGLE_UNSHARED_DEFAULT32_MEMORY && !WABT_BIG_ENDIAN
+#define WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE_FOR_THIS_MODULE 1
+#else
+#define WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE_FOR_THIS_MODULE 0
+#endif
+
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE
+// POSIX uses FS for TLS, GS is free
+static inline void* wasm_rt_segue_read_base() {
+  if (wasm_rt_fsgsbase_inst_supported) {
+    return (void*)__builtin_ia32_rdgsbase64();
+  } else {
+    return wasm_rt_syscall_get_segue_base();
+  }
+}
+static inline void wasm_rt_segue_write_base(void* base) {
+#if WASM_RT_SEGUE_FREE_SEGMENT
+  if (wasm_rt_last_segment_val == base) {
+    return;
+  }
+
+  wasm_rt_last_segment_val = base;
+#endif
+
+  if (wasm_rt_fsgsbase_inst_supported) {
+    __builtin_ia32_wrgsbase64((uintptr_t)base);
+  } else {
+    wasm_rt_syscall_set_segue_base(base);
+  }
+}
+#define MEM_ADDR_MEMOP(mem, addr, n) ((uint8_t __seg_gs*)(uintptr_t)addr)
+#elif WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE_FOR_THIS_MODULE
+#define MEM_ADDR_MEMOP(mem, addr, n) (&wasm_rt_local_memory_base[(addr)])
+#else
+#define MEM_ADDR_MEMOP(mem, addr, n) MEM_ADDR(mem, addr, n)
+#endif
+
+#define TRAP(x) (wasm_rt_trap(WASM_RT_TRAP_##x), 0)
+
+#if WASM_RT_STACK_DEPTH_COUNT
+#define FUNC_PROLOGUE                                            \
+  if (++wasm_rt_call_stack_depth > WASM_RT_MAX_CALL_STACK_DEPTH) \
+    TRAP(EXHAUSTION);
+
+#define FUNC_EPILOGUE --wasm_rt_call_stack_depth
+#else
+#define FUNC_PROLOGUE
+
+#define FUNC_EPILOGUE
+#endif
+
+#define UNREACHABLE TRAP(UNREACHABLE)
+
+#if defined(__clang__) || defined(__GNUC__)
+#define W2C_COLD_FUNC __attribute__((noinline, cold))
+#elif defined(_MSC_VER)
+#define W2C_COLD_FUNC __declspec(noinline)
+#else
+#define W2C_COLD_FUNC
+#endif
+
+W2C_COLD_FUNC static bool func_types_eq_slowpath(
+    const wasm_rt_funcref_table_t* table,
+    const wasm_rt_func_type_t expected_type,
+    uint32_t index) {
+  const size_t sha256size = 32;
+  if (index >= table->size) {
+    // Table index out of bounds. Raise Wasm trap.
+    TRAP(CALL_INDIRECT);
+    return false;
+  }
+  const wasm_rt_funcref_t* const func_ref = &table->data[index];
+  if (!expected_type || !func_ref->func || !func_ref->func_type ||
+      memcmp(expected_type, func_ref->func_type, sha256size) != 0) {
+    // Type check failed. Raise Wasm trap.
+    TRAP(CALL_INDIRECT);
+    return false;
+  }
+  return true;
+}
+
+#define CHECK_CALL_INDIRECT(table, ft, x)                       \
+  (LIKELY((x) < table.size && ft == table.data[x].func_type) || \
+   func_types_eq_slowpath(&(table), ft, x))
+
+#define DO_CALL_INDIRECT(table, t, x, ...) ((t)table.data[x].func)(__VA_ARGS__)
+
+#define CALL_INDIRECT(table, t, ft, x, ...) \
+  (CHECK_CALL_INDIRECT(table, ft, x),       \
+   DO_CALL_INDIRECT(table, t, x, __VA_ARGS__))
+
+static inline uint64_t checked_add_u64(uint64_t a, uint64_t b) {
+  uint64_t ret;
+#if __has_builtin(__builtin_add_overflow)
+  if (__builtin_add_overflow(a, b, &ret))
+    TRAP(OOB);
+#elif defined(_MSC_VER)
+  if (_addcarry_u64(0, a, b, &ret))
+    TRAP(OOB);
+#else
+  ret = a + b;
+  if (ret < a)
+    TRAP(OOB);
+#endif
+  return ret;
+}
+
+#define RANGE_CHECK(mem, offset, len)            \
+  do {                                           \
+    uint64_t res = checked_add_u64(offset, len); \
+    if (UNLIKELY(res > (mem)->size))             \
+      TRAP(OOB);                                 \
+  } while (0);
+
+#if WASM_RT_USE_SEGUE_FOR_THIS_MODULE && WASM_RT_SANITY_CHECKS
+#include <stdio.h>
+#define WASM_RT_CHECK_BASE(mem)                                               \
+  if (((uintptr_t)((mem)->data)) != ((uintptr_t)wasm_rt_segue_read_base())) { \
+    puts("Segment register mismatch\n");                                      \
+    abort();                                                                  \
+  }
+#else
+#define WASM_RT_CHECK_BASE(mem)
+#endif
+
+// MEMCHECK_DEFAULT32 is an "accelerated" MEMCHECK used only for
+// default-page-size, 32-bit memories. It may do nothing at all
+// (if hardware bounds-checking is enabled via guard pages)
+// or it may do a slightly faster RANGE_CHECK.
+#if WASM_RT_MEMCHECK_GUARD_PAGES
+#define MEMCHECK_DEFAULT32(mem, local_memory_size, a, t) \
+  WASM_RT_CHECK_BASE(mem);
+#else
+#if WASM_RT_USE_LOCAL_MEMORY_BASE_SIZE_FOR_THIS_MODULE
+#define MEMCHECK_DEFAULT32(mem, local_memory_size, a, t)     \
+  WASM_RT_CHECK_BASE(mem);                                   \
+  if (UNLIKELY(a + (uint64_t)sizeof(t) > local_memory_size)) \
+    TRAP(OOB);
+#else
+#define MEMCHECK_DEFAULT32(mem, local_memory_size, a, t) \
+  WASM_RT_CHECK_BASE(mem);                               \
+  if (UNLIKELY(a + (uint64_t)sizeof(t) > mem->size))     \
+    TRAP(OOB);
+#endif
+#endif
+
+// MEMCHECK_GENERAL can be used for any memory
+#define MEMCHECK_GENERAL(mem, a, t) \
+  WASM_RT_CHECK_BASE(mem);          \
+  RANGE_CHECK(mem, a, sizeof(t));
+
+// When using guard pages, reads have to be immediately consumed so that OOB
+// trap checks are applied in the right place, and not optimized away. This is
+// done using FORCE_READ_INT/FORCE_READ_FLOAT
+#if WASM_RT_MEMCHECK_BOUNDS_CHECK || \
+    WASM_RT_NONCONFORMING_ALLOW_OOB_READ_ELIMINATION
+#define FORCE_READ_INT(var)
+#define FORCE_READ_FLOAT(var)
+#elif defined(__GNUC__) && WASM_RT_MEMCHECK_GUARD_PAGES
+#define FORCE_READ_INT(var) __asm__("" ::"r"(var))
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define FORCE_READ_FLOAT_CONSTRAINT "x"
+#elif defined(__aarch64__) && defined(__ARM_FP) && ((__ARM_FP & 0x4) != 0)
+#define FORCE_READ_FLOAT_CONSTRAINT "w"
+#elif defined(__mips__) && defined(__clang__) && !defined(__mips_soft_float)
+// Clang before v18 uses hard floats which has a different constraint
+#define FORCE_READ_FLOAT_CONSTRAINT "f"
+#elif (defined(__powerpc__) || defined(__ppc__) || defined(__PPC__)) && \
+    !(defined(_SOFT_FLOAT) || defined(__NO_FPRS__))
+#define FORCE_READ_FLOAT_CONSTRAINT "f"
+#elif defined(__riscv) && defined(__riscv_flen) && (__riscv_flen >= 32)
+#define FORCE_READ_FLOAT_CONSTRAINT "f"
+#elif defined(__s390__) || defined(__s390x__)
+#define FORCE_READ_FLOAT_CONSTRAINT "f"
+#else
+#define FORCE_READ_FLOAT_CONSTRAINT "r"
+#endif
+
+#define FORCE_READ_FLOAT(var) __asm__("" ::FORCE_READ_FLOAT_CONSTRAINT(var))
+#else
+#error \
+    "Guard page mode for Wasm not supported on this platform because FORCE_READ_INT/FORCE_READ_FLOAT could not be instantiated." \
+   "Either enable specify -DWASM_RT_NONCONFORMING_ALLOW_OOB_READ_ELIMINATION=1 during compilation or use -DWASM_RT_MEMCHECK_BOUNDS_CHECK=1 to use bounds check mode"
+#endif
+
+static inline void load_data(u8* dest, const u8* src, size_t n) {
+  if (!n) {
+    return;
+  }
+#if WABT_BIG_ENDIAN
+  for (size_t i = 0; i < n; i++) {
+    dest[i] = src[n - i - 1];
+  }
+#else
+  wasm_rt_memcpy(dest, src, n);
+#endif
+}
+
+#define LOAD_DATA(m, o, i, s)            \
+  do {                                   \
+    RANGE_CHECK((&m), o, s);             \
+    load_data(MEM_ADDR(&m, o, s), i, s); \
+  } while (0)
+
+#define DEF_MEM_CHECKS0(name, shared, mem_type, ret_kw, return_type)         \
+  static inline return_type name##_default32(                                \
+      uint8_t* const wasm_rt_local_memory_base,                              \
+      uint64_t wasm_rt_local_memory_size, wasm_rt##shared##memory_t* mem,    \
+      u64 addr) {                                                            \
+    MEMCHECK_DEFAULT32(mem, wasm_rt_local_memory_size, addr, mem_type);      \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr);           \
+  }                                                                          \
+  static inline return_type name(uint8_t* const wasm_rt_local_memory_base,   \
+                                 uint64_t wasm_rt_local_memory_size,         \
+                                 wasm_rt##shared##memory_t* mem, u64 addr) { \
+    MEMCHECK_GENERAL(mem, addr, mem_type);                                   \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr);           \
+  }
+
+#define DEF_MEM_CHECKS1(name, shared, mem_type, ret_kw, return_type,       \
+                        val_type1)                                         \
+  static inline return_type name##_default32(                              \
+      uint8_t* const wasm_rt_local_memory_base,                            \
+      uint64_t wasm_rt_local_memory_size, wasm_rt##shared##memory_t* mem,  \
+      u64 addr, val_type1 val1) {                                          \
+    MEMCHECK_DEFAULT32(mem, wasm_rt_local_memory_size, addr, mem_type);    \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr, val1);   \
+  }                                                                        \
+  static inline return_type name(uint8_t* const wasm_rt_local_memory_base, \
+                                 uint64_t wasm_rt_local_memory_size,       \
+                                 wasm_rt##shared##memory_t* mem, u64 addr, \
+                                 val_type1 val1) {                         \
+    MEMCHECK_GENERAL(mem, addr, mem_type);                                 \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr, val1);   \
+  }
+
+#define DEF_MEM_CHECKS2(name, shared, mem_type, ret_kw, return_type,           \
+                        val_type1, val_type2)                                  \
+  static inline return_type name##_default32(                                  \
+      uint8_t* const wasm_rt_local_memory_base,                                \
+      uint64_t wasm_rt_local_memory_size, wasm_rt##shared##memory_t* mem,      \
+      u64 addr, val_type1 val1, val_type2 val2) {                              \
+    MEMCHECK_DEFAULT32(mem, wasm_rt_local_memory_size, addr, mem_type);        \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr, val1, val2); \
+  }                                                                            \
+  static inline return_type name(uint8_t* const wasm_rt_local_memory_base,     \
+                                 uint64_t wasm_rt_local_memory_size,           \
+                                 wasm_rt##shared##memory_t* mem, u64 addr,     \
+                                 val_type1 val1, val_type2 val2) {             \
+    MEMCHECK_GENERAL(mem, addr, mem_type);                                     \
+    ret_kw name##_unchecked(wasm_rt_local_memory_base, mem, addr, val1, val2); \
+  }
+
+#define DEFINE_LOAD(name, t1, t2, t3, force_read)                             \
+  static inline t3 name##_unchecked(uint8_t* const wasm_rt_local_memory_base, \
+                                    wasm_rt_memory_t* mem, u64 addr) {        \
+    t1 result;                                                                \
+    wasm_rt_memcpy(&result, MEM_ADDR_MEMOP(mem, addr, sizeof(t1)),            \
+                   sizeof(t1));                                               \
+    t3 ret = (t3)(t2)result;                                                  \
+    force_read(ret);                                                          \
+    return ret;                                                               \
+  }                                                                           \
+  DEF_MEM_CHECKS0(name, _, t1, return, t3)
+
+#define DEFINE_STORE(name, t1, t2)                                     \
+  static inline void name##_unchecked(                                 \
+      uint8_t* const wasm_rt_local_memory_base, wasm_rt_memory_t* mem, \
+      u64 addr, t2 value) {                                            \
+    t1 wrapped = (t1)value;                                            \
+    wasm_rt_memcpy(MEM_ADDR_MEMOP(mem, addr, sizeof(t1)), &wrapped,    \
+                   sizeof(t1));                                        \
+  }                                                                    \
+  DEF_MEM_CHECKS1(name, _, t1, , void, t2)
+
+DEFINE_LOAD(i32_load, u32, u32, u32, FORCE_READ_INT)
+DEFINE_LOAD(i64_load, u64, u64, u64, FORCE_READ_INT)
+DEFINE_LOAD(f32_load, f32, f32, f32, FORCE_READ_FLOAT)
+DEFINE_LOAD(f64_load, f64, f64, f64, FORCE_READ_FLOAT)
+DEFINE_LOAD(i32_load8_s, s8, s32, u32, FORCE_READ_INT)
+DEFINE_LOAD(i64_load8_s, s8, s64, u64, FORCE_READ_INT)
+DEFINE_LOAD(i32_load8_u, u8, u32, u32, FORCE_READ_INT)
+DEFINE_LOAD(i64_load8_u, u8, u64, u64, FORCE_READ_INT)
+DEFINE_LOAD(i32_load16_s, s16, s32, u32, FORCE_READ_INT)
+DEFINE_LOAD(i64_load16_s, s16, s64, u64, FORCE_READ_INT)
+DEFINE_LOAD(i32_load16_u, u16, u32, u32, FORCE_READ_INT)
+DEFINE_LOAD(i64_load16_u, u16, u64, u64, FORCE_READ_INT)
+DEFINE_LOAD(i64_load32_s, s32, s64, u64, FORCE_READ_INT)
+DEFINE_LOAD(i64_load32_u, u32, u64, u64, FORCE_READ_INT)
+DEFINE_STORE(i32_store, u32, u32)
+DEFINE_STORE(i64_store, u64, u64)
+DEFINE_STORE(f32_store, f32, f32)
+DEFINE_STORE(f64_store, f64, f64)
+DEFINE_STORE(i32_store8, u8, u32)
+DEFINE_STORE(i32_store16, u16, u32)
+DEFINE_STORE(i64_store8, u8, u64)
+DEFINE_STORE(i64_store16, u16, u64)
+DEFINE_STORE(i64_store32, u32, u64)
+
+#if defined(_MSC_VER)
+
+// Adapted from
+// https://github.com/nemequ/portable-snippets/blob/master/builtin/builtin.h
+
+static inline int I64_CLZ(unsigned long long v) {
+  unsigned long r = 0;
+#if defined(_M_AMD64) || defined(_M_ARM)
+  if (_BitScanReverse64(&r, v)) {
+    return 63 - r;
+  }
+#else
+  if (_BitScanReverse(&r, (unsigned long)(v >> 32))) {
+    return 31 - r;
+  } else if (_BitScanReverse(&r, (unsigned long)v)) {
+    return 63 - r;
+  }
+#endif
+  return 64;
+}
+
+static inline int I32_CLZ(unsigned long v) {
+  unsigned long r = 0;
+  if (_BitScanReverse(&r, v)) {
+    return 31 - r;
+  }
+  return 32;
+}
+
+static inline int I64_CTZ(unsigned long long v) {
+  if (!v) {
+    return 64;
+  }
+  unsigned long r = 0;
+#if defined(_M_AMD64) || defined(_M_ARM)
+  _BitScanForward64(&r, v);
+  return (int)r;
+#else
+  if (_BitScanForward(&r, (unsigned int)(v))) {
+    return (int)(r);
+  }
+
+  _BitScanForward(&r, (unsigned int)(v >> 32));
+  return (int)(r + 32);
+#endif
+}
+
+static inline int I32_CTZ(unsigned long v) {
+  if (!v) {
+    return 32;
+  }
+  unsigned long r = 0;
+  _BitScanForward(&r, v);
+  return (int)r;
+}
+
+#define POPCOUNT_DEFINE_PORTABLE(f_n, T)                            \
+  static inline u32 f_n(T x) {                                      \
+    x = x - ((x >> 1) & (T) ~(T)0 / 3);                             \
+    x = (x & (T) ~(T)0 / 15 * 3) + ((x >> 2) & (T) ~(T)0 / 15 * 3); \
+    x = (x + (x >> 4)) & (T) ~(T)0 / 255 * 15;                      \
+    return (T)(x * ((T) ~(T)0 / 255)) >> (sizeof(T) - 1) * 8;       \
+  }
+
+POPCOUNT_DEFINE_PORTABLE(I32_POPCNT, u32)
+POPCOUNT_DEFINE_PORTABLE(I64_POPCNT, u64)
+
+#undef POPCOUNT_DEFINE_PORTABLE
+
+#else
+
+#define I32_CLZ(x) ((x) ? __builtin_clz(x) : 32)
+#define I64_CLZ(x) ((x) ? __builtin_clzll(x) : 64)
+#define I32_CTZ(x) ((x) ? __builtin_ctz(x) : 32)
+#define I64_CTZ(x) ((x) ? __builtin_ctzll(x) : 64)
+#define I32_POPCNT(x) (__builtin_popcount(x))
+#define I64_POPCNT(x) (__builtin_popcountll(x))
+
+#endif
+
+#define DIV_S(ut, min, x, y)                                  \
+  ((UNLIKELY((y) == 0))                  ? TRAP(DIV_BY_ZERO)  \
+   : (UNLIKELY((x) == min && (y) == -1)) ? TRAP(INT_OVERFLOW) \
+                                         : (ut)((x) / (y)))
+
+#define REM_S(ut, min, x, y)                                 \
+  ((UNLIKELY((y) == 0))                  ? TRAP(DIV_BY_ZERO) \
+   : (UNLIKELY((x) == min && (y) == -1)) ? 0                 \
+                                         : (ut)((x) % (y)))
+
+#define I32_DIV_S(x, y) DIV_S(u32, INT32_MIN, (s32)x, (s32)y)
+#define I64_DIV_S(x, y) DIV_S(u64, INT64_MIN, (s64)x, (s64)y)
+#define I32_REM_S(x, y) REM_S(u32, INT32_MIN, (s32)x, (s32)y)
+#define I64_REM_S(x, y) REM_S(u64, INT64_MIN, (s64)x, (s64)y)
+
+#define DIVREM_U(op, x, y) \
+  ((UNLIKELY((y) == 0)) ? TRAP(DIV_BY_ZERO) : ((x)op(y)))
+
+#define DIV_U(x, y) DIVREM_U(/, x, y)
+#define REM_U(x, y) DIVREM_U(%, x, y)
+
+#define ROTL(x, y, mask) \
+  (((x) << ((y) & (mask))) | ((x) >> (((mask) - (y) + 1) & (mask))))
+#define ROTR(x, y, mask) \
+  (((x) >> ((y) & (mask))) | ((x) << (((mask) - (y) + 1) & (mask))))
+
+#define I32_ROTL(x, y) ROTL(x, y, 31)
+#define I64_ROTL(x, y) ROTL(x, y, 63)
+#define I32_ROTR(x, y) ROTR(x, y, 31)
+#define I64_ROTR(x, y) ROTR(x, y, 63)
+
+#define FMIN(x, y)                                           \
+  ((UNLIKELY((x) != (x)))             ? NAN                  \
+   : (UNLIKELY((y) != (y)))           ? NAN                  \
+   : (UNLIKELY((x) == 0 && (y) == 0)) ? (signbit(x) ? x : y) \
+   : (x < y)                          ? x                    \
+                                      : y)
+
+#define FMAX(x, y)                                           \
+  ((UNLIKELY((x) != (x)))             ? NAN                  \
+   : (UNLIKELY((y) != (y)))           ? NAN                  \
+   : (UNLIKELY((x) == 0 && (y) == 0)) ? (signbit(x) ? y : x) \
+   : (x > y)                          ? x                    \
+                                      : y)
+
+#define TRUNC_S(ut, st, ft, min, minop, max, x)                             \
+  ((UNLIKELY((x) != (x)))                        ? TRAP(INVALID_CONVERSION) \
+   : (UNLIKELY(!((x)minop(min) && (x) < (max)))) ? TRAP(INT_OVERFLOW)       \
+                                                 : (ut)(st)(x))
+
+#define I32_TRUNC_S_F32(x) \
+  TRUNC_S(u32, s32, f32, (f32)INT32_MIN, >=, 2147483648.f, x)
+#define I64_TRUNC_S_F32(x) \
+  TRUNC_S(u64, s64, f32, (f32)INT64_MIN, >=, (f32)INT64_MAX, x)
+#define I32_TRUNC_S_F64(x) \
+  TRUNC_S(u32, s32, f64, -2147483649., >, 2147483648., x)
+#define I64_TRUNC_S_F64(x) \
+  TRUNC_S(u64, s64, f64, (f64)INT64_MIN, >=, (f64)INT64_MAX, x)
+
+#define TRUNC_U(ut, ft, max, x)                                              \
+  ((UNLIKELY((x) != (x)))                         ? TRAP(INVALID_CONVERSION) \
+   : (UNLIKELY(!((x) > (ft) - 1 && (x) < (max)))) ? TRAP(INT_OVERFLOW)       \
+                                                  : (ut)(x))
+
+#define I32_TRUNC_U_F32(x) TRUNC_U(u32, f32, 4294967296.f, x)
+#define I64_TRUNC_U_F32(x) TRUNC_U(u64, f32, (f32)UINT64_MAX, x)
+#define I32_TRUNC_U_F64(x) TRUNC_U(u32, f64, 4294967296., x)
+#define I64_TRUNC_U_F64(x) TRUNC_U(u64, f64, (f64)UINT64_MAX, x)
+
+#define TRUNC_SAT_S(ut, st, ft, min, smin, minop, max, smax, x) \
+  ((UNLIKELY((x) != (x)))         ? 0                           \
+   : (UNLIKELY(!((x)minop(min)))) ? smin                        \
+   : (UNLIKELY(!((x) < (max))))   ? smax                        \
+                                  : (ut)(st)(x))
+
+#define I32_TRUNC_SAT_S_F32(x)                                            \
+  TRUNC_SAT_S(u32, s32, f32, (f32)INT32_MIN, INT32_MIN, >=, 2147483648.f, \
+              INT32_MAX, x)
+#define I64_TRUNC_SAT_S_F32(x)                                              \
+  TRUNC_SAT_S(u64, s64, f32, (f32)INT64_MIN, INT64_MIN, >=, (f32)INT64_MAX, \
+              INT64_MAX, x)
+#define I32_TRUNC_SAT_S_F64(x)                                        \
+  TRUNC_SAT_S(u32, s32, f64, -2147483649., INT32_MIN, >, 2147483648., \
+              INT32_MAX, x)
+#define I64_TRUNC_SAT_S_F64(x)                                              \
+  TRUNC_SAT_S(u64, s64, f64, (f64)INT64_MIN, INT64_MIN, >=, (f64)INT64_MAX, \
+              INT64_MAX, x)
+
+#define TRUNC_SAT_U(ut, ft, max, smax, x) \
+  ((UNLIKELY((x) != (x)))          ? 0    \
+   : (UNLIKELY(!((x) > (ft) - 1))) ? 0    \
+   : (UNLIKELY(!((x) < (max))))    ? smax \
+                                   : (ut)(x))
+
+#define I32_TRUNC_SAT_U_F32(x) \
+  TRUNC_SAT_U(u32, f32, 4294967296.f, UINT32_MAX, x)
+#define I64_TRUNC_SAT_U_F32(x) \
+  TRUNC_SAT_U(u64, f32, (f32)UINT64_MAX, UINT64_MAX, x)
+#define I32_TRUNC_SAT_U_F64(x) TRUNC_SAT_U(u32, f64, 4294967296., UINT32_MAX, x)
+#define I64_TRUNC_SAT_U_F64(x) \
+  TRUNC_SAT_U(u64, f64, (f64)UINT64_MAX, UINT64_MAX, x)
+
+#define DEFINE_REINTERPRET(name, t1, t2)         \
+  static inline t2 name(t1 x) {                  \
+    t2 result;                                   \
+    wasm_rt_memcpy(&result, &x, sizeof(result)); \
+    return result;                               \
+  }
+
+DEFINE_REINTERPRET(f32_reinterpret_i32, u32, f32)
+DEFINE_REINTERPRET(i32_reinterpret_f32, f32, u32)
+DEFINE_REINTERPRET(f64_reinterpret_i64, u64, f64)
+DEFINE_REINTERPRET(i64_reinterpret_f64, f64, u64)
+
+static float quiet_nanf(float x) {
+  uint32_t tmp;
+  wasm_rt_memcpy(&tmp, &x, 4);
+  tmp |= 0x7fc00000lu;
+  wasm_rt_memcpy(&x, &tmp, 4);
+  return x;
+}
+
+static double quiet_nan(double x) {
+  uint64_t tmp;
+  wasm_rt_memcpy(&tmp, &x, 8);
+  tmp |= 0x7ff8000000000000llu;
+  wasm_rt_memcpy(&x, &tmp, 8);
+  return x;
+}
+
+static double wasm_quiet(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+  return x;
+}
+
+static float wasm_quietf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+  return x;
+}
+
+static double wasm_floor(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+  return floor(x);
+}
+
+static float wasm_floorf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+  return floorf(x);
+}
+
+static double wasm_ceil(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+  return ceil(x);
+}
+
+static float wasm_ceilf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+  return ceilf(x);
+}
+
+static double wasm_trunc(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+  return trunc(x);
+}
+
+static float wasm_truncf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+  return truncf(x);
+}
+
+static float wasm_nearbyintf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+  return nearbyintf(x);
+}
+
+static double wasm_nearbyint(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+  return nearbyint(x);
+}
+
+static float wasm_fabsf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    uint32_t tmp;
+    wasm_rt_memcpy(&tmp, &x, 4);
+    tmp = tmp & ~(1UL << 31);
+    wasm_rt_memcpy(&x, &tmp, 4);
+    return x;
+  }
+  return fabsf(x);
+}
+
+static double wasm_fabs(double x) {
+  if (UNLIKELY(isnan(x))) {
+    uint64_t tmp;
+    wasm_rt_memcpy(&tmp, &x, 8);
+    tmp = tmp & ~(1ULL << 63);
+    wasm_rt_memcpy(&x, &tmp, 8);
+    return x;
+  }
+  return fabs(x);
+}
+
+static double wasm_sqrt(double x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nan(x);
+  }
+
+#if __has_builtin(__builtin_elementwise_sqrt)
+  // Fastest option: doesn't set errno
+  return __builtin_elementwise_sqrt(x);
+#elif __has_builtin(__builtin_sqrt)
+  // Optimized if -fno-math-errno is set
+  return __builtin_sqrt(x);
+#else
+  // Libc call. May/may not be optimized
+  return sqrt(x);
+#endif
+}
+
+static float wasm_sqrtf(float x) {
+  if (UNLIKELY(isnan(x))) {
+    return quiet_nanf(x);
+  }
+
+#if __has_builtin(__builtin_elementwise_sqrt)
+  // Fastest option: doesn't set errno
+  return __builtin_elementwise_sqrt(x);
+#elif __has_builtin(__builtin_sqrt)
+  // Optimized if -fno-math-errno is set
+  return __builtin_sqrtf(x);
+#else
+  // Libc call. May/may not be optimized
+  return sqrtf(x);
+#endif
+}
+
+static inline void memory_fill(wasm_rt_memory_t* mem, u64 d, u32 val, u64 n) {
+  RANGE_CHECK(mem, d, n);
+  memset(MEM_ADDR(mem, d, n), val, n);
+}
+
+static inline void memory_copy(wasm_rt_memory_t* dest,
+                               const wasm_rt_memory_t* src,
+                               u64 dest_addr,
+                               u64 src_addr,
+                               u64 n) {
+  RANGE_CHECK(dest, dest_addr, n);
+  RANGE_CHECK(src, src_addr, n);
+  memmove(MEM_ADDR(dest, dest_addr, n), MEM_ADDR(src, src_addr, n), n);
+}
+
+static inline void memory_init(wasm_rt_memory_t* dest,
+                               const u8* src,
+                               u32 src_size,
+                               u64 dest_addr,
+                               u32 src_addr,
+                               u32 n) {
+  if (UNLIKELY(src_addr + (uint64_t)n > src_size))
+    TRAP(OOB);
+  LOAD_DATA((*dest), dest_addr, src + src_addr, n);
+}
+
+typedef enum { RefFunc, RefNull, GlobalGet } wasm_elem_segment_expr_type_t;
+
+typedef struct {
+  wasm_elem_segment_expr_type_t expr_type;
+  wasm_rt_func_type_t type;
+  wasm_rt_function_ptr_t func;
+  wasm_rt_tailcallee_t func_tailcallee;
+  size_t module_offset;
+} wasm_elem_segment_expr_t;
+
+static inline void funcref_table_init(wasm_rt_funcref_table_t* dest,
+                                      const wasm_elem_segment_expr_t* src,
+                                      u32 src_size,
+                                      u64 dest_addr,
+                                      u32 src_addr,
+                                      u32 n,
+                                      void* module_instance) {
+  if (UNLIKELY(src_addr + (uint64_t)n > src_size))
+    TRAP(OOB);
+  RANGE_CHECK(dest, dest_addr, n);
+  for (u32 i = 0; i < n; i++) {
+    const wasm_elem_segment_expr_t* const src_expr = &src[src_addr + i];
+    wasm_rt_funcref_t* const dest_val = &(dest->data[dest_addr + i]);
+    switch (src_expr->expr_type) {
+      case RefFunc:
+        *dest_val = (wasm_rt_funcref_t){
+            src_expr->type, src_expr->func, src_expr->func_tailcallee,
+            (char*)module_instance + src_expr->module_offset};
+        break;
+      case RefNull:
+        *dest_val = wasm_rt_funcref_null_value;
+        break;
+      case GlobalGet:
+        *dest_val = **(wasm_rt_funcref_t**)((char*)module_instance +
+                                            src_expr->module_offset);
+        break;
+    }
+  }
+}
+
+// Currently wasm2c only supports initializing externref tables with ref.null.
+static inline void externref_table_init(wasm_rt_externref_table_t* dest,
+                                        u32 src_size,
+                                        u64 dest_addr,
+                                        u32 src_addr,
+                                        u32 n) {
+  if (UNLIKELY(src_addr + (uint64_t)n > src_size))
+    TRAP(OOB);
+  RANGE_CHECK(dest, dest_addr, n);
+  for (u32 i = 0; i < n; i++) {
+    dest->data[dest_addr + i] = wasm_rt_externref_null_value;
+  }
+}
+
+#define DEFINE_TABLE_COPY(type)                                              \
+  static inline void type##_table_copy(wasm_rt_##type##_table_t* dest,       \
+                                       const wasm_rt_##type##_table_t* src,  \
+                                       u64 dest_addr, u64 src_addr, u64 n) { \
+    RANGE_CHECK(dest, dest_addr, n);                                         \
+    RANGE_CHECK(src, src_addr, n);                                           \
+    memmove(dest->data + dest_addr, src->data + src_addr,                    \
+            n * sizeof(wasm_rt_##type##_t));                                 \
+  }
+
+DEFINE_TABLE_COPY(funcref)
+DEFINE_TABLE_COPY(externref)
+
+#define DEFINE_TABLE_GET(type)                        \
+  static inline wasm_rt_##type##_t type##_table_get(  \
+      const wasm_rt_##type##_table_t* table, u64 i) { \
+    if (UNLIKELY(i >= table->size))                   \
+      TRAP(OOB);                                      \
+    return table->data[i];                            \
+  }
+
+DEFINE_TABLE_GET(funcref)
+DEFINE_TABLE_GET(externref)
+
+#define DEFINE_TABLE_SET(type)                                               \
+  static inline void type##_table_set(const wasm_rt_##type##_table_t* table, \
+                                      u64 i, const wasm_rt_##type##_t val) { \
+    if (UNLIKELY(i >= table->size))                                          \
+      TRAP(OOB);                                                             \
+    table->data[i] = val;                                                    \
+  }
+
+DEFINE_TABLE_SET(funcref)
+DEFINE_TABLE_SET(externref)
+
+#define DEFINE_TABLE_FILL(type)                                               \
+  static inline void type##_table_fill(const wasm_rt_##type##_table_t* table, \
+                                       u64 d, const wasm_rt_##type##_t val,   \
+                                       u64 n) {                               \
+    RANGE_CHECK(table, d, n);                                                 \
+    for (uint32_t i = d; i < d + n; i++) {                                    \
+      table->data[i] = val;                                                   \
+    }                                                                         \
+  }
+
+DEFINE_TABLE_FILL(funcref)
+DEFINE_TABLE_FILL(externref)
+
+#if defined(__GNUC__) || defined(__clang__)
+#define FUNC_TYPE_DECL_EXTERN_T(x) extern const char* const x
+#define FUNC_TYPE_EXTERN_T(x) const char* const x
+#define FUNC_TYPE_T(x) static const char* const x
+#else
+#define FUNC_TYPE_DECL_EXTERN_T(x) extern const char x[]
+#define FUNC_TYPE_EXTERN_T(x) const char x[]
+#define FUNC_TYPE_T(x) static const char x[]
+#endif
+
+#if (__STDC_VERSION__ < 201112L) && !defined(static_assert)
+#define static_assert(X) \
+  extern int(*assertion(void))[!!sizeof(struct { int x : (X) ? 2 : -1; })];
+#endif
+
+#ifdef _MSC_VER
+#define WEAK_FUNC_DECL(func, fallback)                             \
+  __pragma(comment(linker, "/alternatename:" #func "=" #fallback)) \
+                                                                   \
+      void                                                         \
+      fallback(void** instance_ptr, void* tail_call_stack,         \
+               wasm_rt_tailcallee_t* next)
+#else
+#define WEAK_FUNC_DECL(func, fallback)                                        \
+  __attribute__((weak)) void func(void** instance_ptr, void* tail_call_stack, \
+                                  wasm_rt_tailcallee_t* next)
+#endif
+
+#include <stdatomic.h>
+
+#ifndef WASM_RT_C11_AVAILABLE
+#error "C11 is required for Wasm threads and shared memory support"
+#endif
+
+#define ATOMIC_ALIGNMENT_CHECK(addr, t1) \
+  if (UNLIKELY(addr % sizeof(t1))) {     \
+    TRAP(UNALIGNED);                     \
+  }
+
+#define DEFINE_SHARED_LOAD(name, t1, t2, t3, force_read)                      \
+  static inline t3 name##_unchecked(uint8_t* const wasm_rt_local_memory_base, \
+                                    wasm_rt_shared_memory_t* mem, u64 addr) { \
+    t1 result;                                                                \
+    result = atomic_load_explicit(                                            \
+        (_Atomic volatile t1*)MEM_ADDR(mem, addr, sizeof(t1)),                \
+        memory_order_relaxed);                                                \
+    t3 ret = (t3)(t2)result;                                                  \
+    force_read(ret);                                                          \
+    return ret;                                                               \
+  }                                                                           \
+  DEF_MEM_CHECKS0(name, _shared_, t1, return, t3)
+
+DEFINE_SHARED_LOAD(i32_load_shared, u32, u32, u32, FORCE_READ_INT)
+DEFINE_SHARED_LOAD(i64_load_shared, u64, u64, u64, FORCE_READ_INT)
+DEFINE_SHARED_LOAD(f32_load_shared, f32, f32, f32, FORCE_READ_FLOAT)
+DEFINE_SHARED_LOAD(f64_load_shared, f64, f64, f64, FORCE_READ_FLOAT)
+DEFINE_SHARED_LOAD(i32_load8_s_shared, s8, s32, u32, FORCE_READ_INT)
+DEFINE_SHARED_LOAD(i64_load8_s_shared, s8, s64, u64, FORCE_READ_INT)
+DEFINE_SHARED_LOAD(i32_load8_u_shared, u8, u32, u32, FORCE_READ_INT)
+DEFINE_SHARED_LOAD(i64_load8_u_shared, u8, u64, u64, FORCE_READ_INT)
+DEFINE_SHARED_LOAD(i32_load16_s_shared, s16, s32, u32, FORCE_READ_INT)
+DEFINE_SHARED_LOAD(i64_load16_s_shared, s16, s64, u64, FORCE_READ_INT)
+DEFINE_SHARED_LOAD(i32_load16_u_shared, u16, u32, u32, FORCE_READ_INT)
+DEFINE_SHARED_LOAD(i64_load16_u_shared, u16, u64, u64, FORCE_READ_INT)
+DEFINE_SHARED_LOAD(i64_load32_s_shared, s32, s64, u64, FORCE_READ_INT)
+DEFINE_SHARED_LOAD(i64_load32_u_shared, u32, u64, u64, FORCE_READ_INT)
+
+#define DEFINE_SHARED_STORE(name, t1, t2)                                     \
+  static inline void name##_unchecked(                                        \
+      uint8_t* const wasm_rt_local_memory_base, wasm_rt_shared_memory_t* mem, \
+      u64 addr, t2 value) {                                                   \
+    t1 wrapped = (t1)value;                                                   \
+    atomic_store_explicit(                                                    \
+        (_Atomic volatile t1*)MEM_ADDR(mem, addr, sizeof(t1)), wrapped,       \
+        memory_order_relaxed);                                                \
+  }                                                                           \
+  DEF_MEM_CHECKS1(name, _shared_, t1, , void, t2)
+
+DEFINE_SHARED_STORE(i32_store_shared, u32, u32)
+DEFINE_SHARED_STORE(i64_store_shared, u64, u64)
+DEFINE_SHARED_STORE(f32_store_shared, f32, f32)
+DEFINE_SHARED_STORE(f64_store_shared, f64, f64)
+DEFINE_SHARED_STORE(i32_store8_shared, u8, u32)
+DEFINE_SHARED_STORE(i32_store16_shared, u16, u32)
+DEFINE_SHARED_STORE(i64_store8_shared, u8, u64)
+DEFINE_SHARED_STORE(i64_store16_shared, u16, u64)
+DEFINE_SHARED_STORE(i64_store32_shared, u32, u64)
+
+#define DEFINE_ATOMIC_LOAD(name, t1, t2, t3, force_read)                      \
+  static inline t3 name##_unchecked(uint8_t* const wasm_rt_local_memory_base, \
+                                    wasm_rt_memory_t* mem, u64 addr) {        \
+    ATOMIC_ALIGNMENT_CHECK(addr, t1);                                         \
+    t1 result;                                                                \
+    wasm_rt_memcpy(&result, MEM_ADDR_MEMOP(mem, addr, sizeof(t1)),            \
+                   sizeof(t1));                                               \
+    t3 ret = (t3)(t2)result;                                                  \
+    force_read(ret);                                                          \
+    return ret;                                                               \
+  }                                                                           \
+  DEF_MEM_CHECKS0(name, _, t1, return, t3)                                    \
+  static inline t3 name##_shared_unchecked(                                   \
+      uint8_t* const wasm_rt_local_memory_base, wasm_rt_shared_memory_t* mem, \
+      u64 addr) {                                                             \
+    ATOMIC_ALIGNMENT_CHECK(addr, t1);                                         \
+    t1 result;                                                                \
+    result =                                                                  \
+        atomic_load((_Atomic volatile t1*)MEM_ADDR(mem, addr, sizeof(t1)));   \
+    t3 ret = (t3)(t2)result;                                                  \
+    force_read(ret);                                                          \
+    return ret;                                                               \
+  }                                                                           \
+  DEF_MEM_CHECKS0(name##_shared, _shared_, t1, return, t3)
+
+DEFINE_ATOMIC_LOAD(i32_atomic_load, u32, u32, u32, FORCE_READ_INT)
+DEFINE_ATOMIC_LOAD(i64_atomic_load, u64, u64, u64, FORCE_READ_INT)
+DEFINE_ATOMIC_LOAD(i32_atomic_load8_u, u8, u32, u32, FORCE_READ_INT)
+DEFINE_ATOMIC_LOAD(i64_atomic_load8_u, u8, u64, u64, FORCE_READ_INT)
+DEFINE_ATOMIC_LOAD(i32_atomic_load16_u, u16, u32, u32, FORCE_READ_INT)
+DEFINE_ATOMIC_LOAD(i64_atomic_load16_u, u16, u64, u64, FORCE_READ_INT)
+DEFINE_ATOMIC_LOAD(i64_atomic_load32_u, u32, u64, u64, FORCE_READ_INT)
+
+#define DEFINE_ATOMIC_STORE(name, t1, t2)                                     \
+  static inline void name##_unchecked(                                        \
+      uint8_t* const wasm_rt_local_memory_base, wasm_rt_memory_t* mem,        \
+      u64 addr, t2 value) {                                                   \
+    ATOMIC_ALIGNMENT_CHECK(addr, t1);                                         \
+    t1 wrapped = (t1)value;                                                   \
+    wasm_rt_memcpy(MEM_ADDR_MEMOP(mem, addr, sizeof(t1)), &wrapped,           \
+                   sizeof(t1));                                               \
+  }                                                                           \
+  DEF_MEM_CHECKS1(name, _, t1, , void, t2)                                    \
+  static inline void name##_shared_unchecked(                                 \
+      uint8_t* const wasm_rt_local_memory_base, wasm_rt_shared_memory_t* mem, \
+      u64 addr, t2 value) {                                                   \
+    ATOMIC_ALIGNMENT_CHECK(addr, t1);                                         \
+    t1 wrapped = (t1)value;                                                   \
+    atomic_store((_Atomic volatile t1*)MEM_ADDR(mem, addr, sizeof(t1)),       \
+                 wrapped);                                                    \
+  }                                                                           \
+  DEF_MEM_CHECKS1(name##_shared, _shared_, t1, , void, t2)
+
+DEFINE_ATOMIC_STORE(i32_atomic_store, u32, u32)
+DEFINE_ATOMIC_STORE(i64_atomic_store, u64, u64)
+DEFINE_ATOMIC_STORE(i32_atomic_store8, u8, u32)
+DEFINE_ATOMIC_STORE(i32_atomic_store16, u16, u32)
+DEFINE_ATOMIC_STORE(i64_atomic_store8, u8, u64)
+DEFINE_ATOMIC_STORE(i64_atomic_store16, u16, u64)
+DEFINE_ATOMIC_STORE(i64_atomic_store32, u32, u64)
+
+#define DEFINE_ATOMIC_RMW(name, opname, op, t1, t2)                           \
+  static inline t2 name##_unchecked(uint8_t* const wasm_rt_local_memory_base, \
+                                    wasm_rt_memory_t* mem, u64 addr,          \
+                                    t2 value) {                               \
+    ATOMIC_ALIGNMENT_CHECK(addr, t1);                                         \
+    t1 wrapped = (t1)value;                                                   \
+    t1 ret;                                                                   \
+    wasm_rt_memcpy(&ret, MEM_ADDR_MEMOP(mem, addr, sizeof(t1)), sizeof(t1));  \
+    t1 newval = ret op wrapped;                                               \
+    wasm_rt_memcpy(MEM_ADDR_MEMOP(mem, addr, sizeof(t1)), &newval,            \
+                   sizeof(t1));                                               \
+    return (t2)ret;                                                           \
+  }                                                                           \
+  DEF_MEM_CHECKS1(name, _, t1, return, t2, t2)                                \
+  static inline t2 name##_shared_unchecked(                                   \
+      uint8_t* const wasm_rt_local_memory_base, wasm_rt_shared_memory_t* mem, \
+      u64 addr, t2 value) {                                                   \
+    ATOMIC_ALIGNMENT_CHECK(addr, t1);                                         \
+    t1 wrapped = (t1)value;                                                   \
+    t1 ret = atomic_##opname(                                                 \
+        (_Atomic volatile t1*)MEM_ADDR(mem, addr, sizeof(t1)), wrapped);      \
+    return (t2)ret;                                                           \
+  }                                                                           \
+  DEF_MEM_CHECKS1(name##_shared, _shared_, t1, return, t2, t2)
+
+DEFINE_ATOMIC_RMW(i32_atomic_rmw8_add_u, fetch_add, +, u8, u32)
+DEFINE_ATOMIC_RMW(i32_atomic_rmw16_add_u, fetch_add, +, u16, u32)
+DEFINE_ATOMIC_RMW(i32_atomic_rmw_add, fetch_add, +, u32, u32)
+DEFINE_ATOMIC_RMW(i64_atomic_rmw8_add_u, fetch_add, +, u8, u64)
+DEFINE_ATOMIC_RMW(i64_atomic_rmw16_add_u, fetch_add, +, u16, u64)
+DEFINE_ATOMIC_RMW(i64_atomic_rmw32_add_u, fetch_add, +, u32, u64)
+DEFINE_ATOMIC_RMW(i64_atomic_rmw_add, fetch_add, +, u64, u64)
+
+DEFINE_ATOMIC_RMW(i32_atomic_rmw8_sub_u, fetch_sub, -, u8, u32)
+DEFINE_ATOMIC_RMW(i32_atomic_rmw16_sub_u, fetch_sub, -, u16, u32)
+DEFINE_ATOMIC_RMW(i32_atomic_rmw_sub, fetch_sub, -, u32, u32)
+DEFINE_ATOMIC_RMW(i64_atomic_rmw8_sub_u, fetch_sub, -, u8, u64)
+DEFINE_ATOMIC_RMW(i64_atomic_rmw16_sub_u, fetch_sub, -, u16, u64)
+DEFINE_ATOMIC_RMW(i64_atomic_rmw32_sub_u, fetch_sub, -, u32, u64)
+DEFINE_ATOMIC_RMW(i64_atomic_rmw_sub, fetch_sub, -, u64, u64)
+
+DEFINE_ATOMIC_RMW(i32_atomic_rmw8_and_u, fetch_and, &, u8, u32)
+DEFINE_ATOMIC_RMW(i32_atomic_rmw16_and_u, fetch_and, &, u16, u32)
+DEFINE_ATOMIC_RMW(i32_atomic_rmw_and, fetch_and, &, u32, u32)
+DEFINE_ATOMIC_RMW(i64_atomic_rmw8_and_u, fetch_and, &, u8, u64)
+DEFINE_ATOMIC_RMW(i64_atomic_rmw16_and_u, fetch_and, &, u16, u64)
+DEFINE_ATOMIC_RMW(i64_atomic_rmw32_and_u, fetch_and, &, u32, u64)
+DEFINE_ATOMIC_RMW(i64_atomic_rmw_and, fetch_and, &, u64, u64)
+
+DEFINE_ATOMIC_RMW(i32_atomic_rmw8_or_u, fetch_or, |, u8, u32)
+DEFINE_ATOMIC_RMW(i32_atomic_rmw16_or_u, fetch_or, |, u16, u32)
+DEFINE_ATOMIC_RMW(i32_atomic_rmw_or, fetch_or, |, u32, u32)
+DEFINE_ATOMIC_RMW(i64_atomic_rmw8_or_u, fetch_or, |, u8, u64)
+DEFINE_ATOMIC_RMW(i64_atomic_rmw16_or_u, fetch_or, |, u16, u64)
+DEFINE_ATOMIC_RMW(i64_atomic_rmw32_or_u, fetch_or, |, u32, u64)
+DEFINE_ATOMIC_RMW(i64_atomic_rmw_or, fetch_or, |, u64, u64)
+
+DEFINE_ATOMIC_RMW(i32_atomic_rmw8_xor_u, fetch_xor, ^, u8, u32)
+DEFINE_ATOMIC_RMW(i32_atomic_rmw16_xor_u, fetch_xor, ^, u16, u32)
+DEFINE_ATOMIC_RMW(i32_atomic_rmw_xor, fetch_xor, ^, u32, u32)
+DEFINE_ATOMIC_RMW(i64_atomic_rmw8_xor_u, fetch_xor, ^, u8, u64)
+DEFINE_ATOMIC_RMW(i64_atomic_rmw16_xor_u, fetch_xor, ^, u16, u64)
+DEFINE_ATOMIC_RMW(i64_atomic_rmw32_xor_u, fetch_xor, ^, u32, u64)
+DEFINE_ATOMIC_RMW(i64_atomic_rmw_xor, fetch_xor, ^, u64, u64)
+
+#define DEFINE_ATOMIC_XCHG(name, opname, t1, t2)                              \
+  static inline t2 name##_unchecked(uint8_t* const wasm_rt_local_memory_base, \
+                                    wasm_rt_memory_t* mem, u64 addr,          \
+                                    t2 value) {                               \
+    ATOMIC_ALIGNMENT_CHECK(addr, t1);                                         \
+    t1 wrapped = (t1)value;                                                   \
+    t1 ret;                                                                   \
+    wasm_rt_memcpy(&ret, MEM_ADDR_MEMOP(mem, addr, sizeof(t1)), sizeof(t1));  \
+    wasm_rt_memcpy(MEM_ADDR_MEMOP(mem, addr, sizeof(t1)), &wrapped,           \
+                   sizeof(t1));                                               \
+    return (t2)ret;                                                           \
+  }                                                                           \
+  DEF_MEM_CHECKS1(name, _, t1, return, t2, t2)                                \
+  static inline t2 name##_shared_unchecked(                                   \
+      uint8_t* const wasm_rt_local_memory_base, wasm_rt_shared_memory_t* mem, \
+      u64 addr, t2 value) {                                                   \
+    ATOMIC_ALIGNMENT_CHECK(addr, t1);                                         \
+    t1 wrapped = (t1)value;                                                   \
+    t1 ret = atomic_##opname(                                                 \
+        (_Atomic volatile t1*)MEM_ADDR(mem, addr, sizeof(t1)), wrapped);      \
+    return (t2)ret;                                                           \
+  }                                                                           \
+  DEF_MEM_CHECKS1(name##_shared, _shared_, t1, return, t2, t2)
+
+DEFINE_ATOMIC_XCHG(i32_atomic_rmw8_xchg_u, exchange, u8, u32)
+DEFINE_ATOMIC_XCHG(i32_atomic_rmw16_xchg_u, exchange, u16, u32)
+DEFINE_ATOMIC_XCHG(i32_atomic_rmw_xchg, exchange, u32, u32)
+DEFINE_ATOMIC_XCHG(i64_atomic_rmw8_xchg_u, exchange, u8, u64)
+DEFINE_ATOMIC_XCHG(i64_atomic_rmw16_xchg_u, exchange, u16, u64)
+DEFINE_ATOMIC_XCHG(i64_atomic_rmw32_xchg_u, exchange, u32, u64)
+DEFINE_ATOMIC_XCHG(i64_atomic_rmw_xchg, exchange, u64, u64)
+
+#define DEFINE_ATOMIC_CMP_XCHG(name, t1, t2)                                  \
+  static inline t1 name##_unchecked(uint8_t* const wasm_rt_local_memory_base, \
+                                    wasm_rt_memory_t* mem, u64 addr,          \
+                                    t1 expected, t1 replacement) {            \
+    ATOMIC_ALIGNMENT_CHECK(addr, t2);                                         \
+    t2 expected_wrapped = (t2)expected;                                       \
+    t2 replacement_wrapped = (t2)replacement;                                 \
+    t2 ret;                                                                   \
+    wasm_rt_memcpy(&ret, MEM_ADDR_MEMOP(mem, addr, sizeof(t2)), sizeof(t2));  \
+    if (ret == expected_wrapped) {                                            \
+      wasm_rt_memcpy(MEM_ADDR_MEMOP(mem, addr, sizeof(t2)),                   \
+                     &replacement_wrapped, sizeof(t2));                       \
+    }                                                                         \
+    return (t1)ret;                                                           \
+  }                                                                           \
+  DEF_MEM_CHECKS2(name, _, t2, return, t1, t1, t1)                            \
+  static inline t1 name##_shared_unchecked(                                   \
+      uint8_t* const wasm_rt_local_memory_base, wasm_rt_shared_memory_t* mem, \
+      u64 addr, t1 expected, t1 replacement) {                                \
+    ATOMIC_ALIGNMENT_CHECK(addr, t2);                                         \
+    t2 expected_wrapped = (t2)expected;                                       \
+    t2 replacement_wrapped = (t2)replacement;                                 \
+    atomic_compare_exchange_strong(                                           \
+        (_Atomic volatile t2*)MEM_ADDR(mem, addr, sizeof(t2)),                \
+        &expected_wrapped, replacement_wrapped);                              \
+    return (t1)expected_wrapped;                                              \
+  }                                                                           \
+  DEF_MEM_CHECKS2(name##_shared, _shared_, t2, return, t1, t1, t1)
+
+DEFINE_ATOMIC_CMP_XCHG(i32_atomic_rmw8_cmpxchg_u, u32, u8);
+DEFINE_ATOMIC_CMP_XCHG(i32_atomic_rmw16_cmpxchg_u, u32, u16);
+DEFINE_ATOMIC_CMP_XCHG(i32_atomic_rmw_cmpxchg, u32, u32);
+DEFINE_ATOMIC_CMP_XCHG(i64_atomic_rmw8_cmpxchg_u, u64, u8);
+DEFINE_ATOMIC_CMP_XCHG(i64_atomic_rmw16_cmpxchg_u, u64, u16);
+DEFINE_ATOMIC_CMP_XCHG(i64_atomic_rmw32_cmpxchg_u, u64, u32);
+DEFINE_ATOMIC_CMP_XCHG(i64_atomic_rmw_cmpxchg, u64, u64);
+
+// Wait and notify don't access the memory in the Wasm thread, so they can't
+// rely on guard pages to trap out-of-bounds accesses. The runtime must not
+// fault either, since it accesses the memory with a lock held.
+#define DEFINE_ATOMIC_WAIT(name, rt_name, t)                                  \
+  static inline u32 name##_unchecked(uint8_t* const wasm_rt_local_memory_base, \
+                                     wasm_rt_memory_t* mem, u64 addr,          \
+                                     t expected, s64 timeout) {                \
+    RANGE_CHECK(mem, addr, sizeof(t));                                         \
+    ATOMIC_ALIGNMENT_CHECK(addr, t);                                           \
+    TRAP(UNSHARED_WAIT);                                                       \
+  }                                                                            \
+  DEF_MEM_CHECKS2(name, _, t, return, u32, t, s64)                             \
+  static inline u32 name##_shared_unchecked(                                   \
+      uint8_t* const wasm_rt_local_memory_base, wasm_rt_shared_memory_t* mem,  \
+      u64 addr, t expected, s64 timeout) {                                     \
+    RANGE_CHECK(mem, addr, sizeof(t));                                         \
+    ATOMIC_ALIGNMENT_CHECK(addr, t);                                           \
+    return rt_name((_Atomic volatile t*)MEM_ADDR(mem, addr, sizeof(t)),        \
+                   expected, timeout);                                         \
+  }                                                                            \
+  DEF_MEM_CHECKS2(name##_shared, _shared_, t, return, u32, t, s64)
+
+DEFINE_ATOMIC_WAIT(memory_atomic_wait32, wasm_rt_atomic_wait32, u32)
+DEFINE_ATOMIC_WAIT(memory_atomic_wait64, wasm_rt_atomic_wait64, u64)
+
+static inline u32 memory_atomic_notify_unchecked(
+    uint8_t* const wasm_rt_local_memory_base,
+    wasm_rt_memory_t* mem,
+    u64 addr,
+    u32 count) {
+  RANGE_CHECK(mem, addr, sizeof(u32));
+  ATOMIC_ALIGNMENT_CHECK(addr, u32);
+  /* No thread can wait on an unshared memory. */
+  return 0;
+}
+DEF_MEM_CHECKS1(memory_atomic_notify, _, u32, return, u32, u32)
+
+static inline u32 memory_atomic_notify_shared_unchecked(
+    uint8_t* const wasm_rt_local_memory_base,
+    wasm_rt_shared_memory_t* mem,
+    u64 addr,
+    u32 count) {
+  RANGE_CHECK(mem, addr, sizeof(u32));
+  ATOMIC_ALIGNMENT_CHECK(addr, u32);
+  return wasm_rt_atomic_notify((volatile void*)MEM_ADDR(mem, addr, sizeof(u32)),
+                               count);
+}
+DEF_MEM_CHECKS1(memory_atomic_notify_shared, _shared_, u32, return, u32, u32)
+
+#define atomic_fence() atomic_thread_fence(memory_order_seq_cst)
+
+
+static void w2c_atomic__0__wasm_init_0(w2c_atomic__0__wasm*, u64);
+static u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Eload_0(w2c_atomic__0__wasm*, u32);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Eload_0(w2c_atomic__0__wasm*, u32);
+static u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Eload8_u_0(w2c_atomic__0__wasm*, u32);
+static u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Eload16_u_0(w2c_atomic__0__wasm*, u32);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Eload8_u_0(w2c_atomic__0__wasm*, u32);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Eload16_u_0(w2c_atomic__0__wasm*, u32);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Eload32_u_0(w2c_atomic__0__wasm*, u32);
+static void w2c_atomic__0__wasm_i320x2Eatomic0x2Estore_0(w2c_atomic__0__wasm*, u32, u32);
+static void w2c_atomic__0__wasm_i640x2Eatomic0x2Estore_0(w2c_atomic__0__wasm*, u32, u64);
+static void w2c_atomic__0__wasm_i320x2Eatomic0x2Estore8_0(w2c_atomic__0__wasm*, u32, u32);
+static void w2c_atomic__0__wasm_i320x2Eatomic0x2Estore16_0(w2c_atomic__0__wasm*, u32, u32);
+static void w2c_atomic__0__wasm_i640x2Eatomic0x2Estore8_0(w2c_atomic__0__wasm*, u32, u64);
+static void w2c_atomic__0__wasm_i640x2Eatomic0x2Estore16_0(w2c_atomic__0__wasm*, u32, u64);
+static void w2c_atomic__0__wasm_i640x2Eatomic0x2Estore32_0(w2c_atomic__0__wasm*, u32, u64);
+static u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Eadd_0(w2c_atomic__0__wasm*, u32, u32);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Eadd_0(w2c_atomic__0__wasm*, u32, u64);
+static u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Eadd_u_0(w2c_atomic__0__wasm*, u32, u32);
+static u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Eadd_u_0(w2c_atomic__0__wasm*, u32, u32);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Eadd_u_0(w2c_atomic__0__wasm*, u32, u64);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Eadd_u_0(w2c_atomic__0__wasm*, u32, u64);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Eadd_u_0(w2c_atomic__0__wasm*, u32, u64);
+static u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Esub_0(w2c_atomic__0__wasm*, u32, u32);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Esub_0(w2c_atomic__0__wasm*, u32, u64);
+static u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Esub_u_0(w2c_atomic__0__wasm*, u32, u32);
+static u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Esub_u_0(w2c_atomic__0__wasm*, u32, u32);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Esub_u_0(w2c_atomic__0__wasm*, u32, u64);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Esub_u_0(w2c_atomic__0__wasm*, u32, u64);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Esub_u_0(w2c_atomic__0__wasm*, u32, u64);
+static u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Eand_0(w2c_atomic__0__wasm*, u32, u32);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Eand_0(w2c_atomic__0__wasm*, u32, u64);
+static u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Eand_u_0(w2c_atomic__0__wasm*, u32, u32);
+static u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Eand_u_0(w2c_atomic__0__wasm*, u32, u32);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Eand_u_0(w2c_atomic__0__wasm*, u32, u64);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Eand_u_0(w2c_atomic__0__wasm*, u32, u64);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Eand_u_0(w2c_atomic__0__wasm*, u32, u64);
+static u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Eor_0(w2c_atomic__0__wasm*, u32, u32);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Eor_0(w2c_atomic__0__wasm*, u32, u64);
+static u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Eor_u_0(w2c_atomic__0__wasm*, u32, u32);
+static u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Eor_u_0(w2c_atomic__0__wasm*, u32, u32);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Eor_u_0(w2c_atomic__0__wasm*, u32, u64);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Eor_u_0(w2c_atomic__0__wasm*, u32, u64);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Eor_u_0(w2c_atomic__0__wasm*, u32, u64);
+static u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Exor_0(w2c_atomic__0__wasm*, u32, u32);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Exor_0(w2c_atomic__0__wasm*, u32, u64);
+static u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Exor_u_0(w2c_atomic__0__wasm*, u32, u32);
+static u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Exor_u_0(w2c_atomic__0__wasm*, u32, u32);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Exor_u_0(w2c_atomic__0__wasm*, u32, u64);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Exor_u_0(w2c_atomic__0__wasm*, u32, u64);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Exor_u_0(w2c_atomic__0__wasm*, u32, u64);
+static u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Exchg_0(w2c_atomic__0__wasm*, u32, u32);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Exchg_0(w2c_atomic__0__wasm*, u32, u64);
+static u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Exchg_u_0(w2c_atomic__0__wasm*, u32, u32);
+static u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Exchg_u_0(w2c_atomic__0__wasm*, u32, u32);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Exchg_u_0(w2c_atomic__0__wasm*, u32, u64);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Exchg_u_0(w2c_atomic__0__wasm*, u32, u64);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Exchg_u_0(w2c_atomic__0__wasm*, u32, u64);
+static u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Ecmpxchg_0(w2c_atomic__0__wasm*, u32, u32, u32);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Ecmpxchg_0(w2c_atomic__0__wasm*, u32, u64, u64);
+static u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Ecmpxchg_u_0(w2c_atomic__0__wasm*, u32, u32, u32);
+static u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Ecmpxchg_u_0(w2c_atomic__0__wasm*, u32, u32, u32);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Ecmpxchg_u_0(w2c_atomic__0__wasm*, u32, u64, u64);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Ecmpxchg_u_0(w2c_atomic__0__wasm*, u32, u64, u64);
+static u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Ecmpxchg_u_0(w2c_atomic__0__wasm*, u32, u64, u64);
+
+FUNC_TYPE_T(w2c_atomic__0__wasm_t0) = "\x36\xe8\xcd\xcd\x7f\x90\xda\x2c\x26\xd8\x14\xae\x0b\x2f\x96\xbd\x2f\xba\x60\x45\x88\x21\xbf\x78\x71\xf1\x9d\xee\x54\x81\xd3\xc8";
+FUNC_TYPE_T(w2c_atomic__0__wasm_t1) = "\x07\x80\x96\x7a\x42\xf7\x3e\xe6\x70\x5c\x2f\xac\x83\xf5\x67\xd2\xa2\xa0\x69\x41\x5f\xf8\xe7\x96\x7f\x23\xab\x00\x03\x5f\x4a\x3c";
+FUNC_TYPE_T(w2c_atomic__0__wasm_t2) = "\x34\xdb\x83\x7a\x75\x3e\xc6\x13\xe5\xf4\xea\xd1\x67\xfb\xe4\x11\x01\x6b\xcf\x7c\xac\xb1\x84\x7b\xf9\xdf\x70\xfd\xb7\x70\x78\x1b";
+FUNC_TYPE_T(w2c_atomic__0__wasm_t3) = "\x26\x10\x81\xe2\x21\x43\xd6\x01\x3e\x2d\x2f\x16\x17\x78\x6f\xba\xb3\x2f\x4d\x54\x9b\x8a\xa9\xdd\xbf\x53\x92\x3c\xd3\x71\xc6\xb2";
+FUNC_TYPE_T(w2c_atomic__0__wasm_t4) = "\x7f\x47\x50\x5e\x2a\xc9\x8c\xbb\x0d\x5a\x44\xd7\xde\x46\xaf\xcd\x6f\xc9\x16\x0a\xf6\xcb\x4d\xa9\xa5\xa1\x1a\x60\x6a\x14\x3e\x9f";
+FUNC_TYPE_T(w2c_atomic__0__wasm_t5) = "\x92\xfb\x6a\xdf\x49\x07\x0a\x83\xbe\x08\x02\x68\xcd\xf6\x95\x27\x4a\xc2\xf3\xe5\xe4\x7d\x29\x49\xe8\xed\x42\x92\x6a\x9d\xda\xf0";
+FUNC_TYPE_T(w2c_atomic__0__wasm_t6) = "\xb7\x7b\x09\x27\x00\xd6\xf9\x20\xce\x8e\x68\xc0\x9f\x87\xc4\xe2\xe0\xd0\xc0\xd5\x5a\x8b\x45\x32\x3f\xbb\xec\xe6\xf4\x8d\xf4\x55";
+FUNC_TYPE_T(w2c_atomic__0__wasm_t7) = "\xcd\xad\x8f\x6a\xaf\x3e\xd0\x86\xf0\x9a\xd7\xf0\xc7\x0d\x48\x9f\x27\x59\xf3\x8d\x71\xa1\x81\xa8\xcc\x06\x53\x98\x62\x34\xaa\xf5";
+FUNC_TYPE_T(w2c_atomic__0__wasm_t8) = "\xf6\x25\x5f\x22\xad\xf8\xf5\x29\x15\x3f\x31\xf6\x5a\x51\x62\xeb\x35\xb9\xfd\x6d\xe2\xbf\xbf\x69\x68\x91\x91\x72\x88\x23\xdf\xac";
+
+static void init_memories(w2c_atomic__0__wasm* instance) {
+  wasm_rt_allocate_memory_shared(&instance->w2c_M0, 1, 1, 0, 65536);
+}
+
+/* export: 'init' */
+void w2c_atomic__0__wasm_init(w2c_atomic__0__wasm* instance, u64 var_p0) {
+  w2c_atomic__0__wasm_init_0(instance, var_p0);
+}
+
+/* export: 'i32.atomic.load' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Eload(w2c_atomic__0__wasm* instance, u32 var_p0) {
+  u32 ret = w2c_atomic__0__wasm_i320x2Eatomic0x2Eload_0(instance, var_p0);
+  return ret;
+}
+
+/* export: 'i64.atomic.load' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(w2c_atomic__0__wasm* instance, u32 var_p0) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Eload_0(instance, var_p0);
+  return ret;
+}
+
+/* export: 'i32.atomic.load8_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Eload8_u(w2c_atomic__0__wasm* instance, u32 var_p0) {
+  u32 ret = w2c_atomic__0__wasm_i320x2Eatomic0x2Eload8_u_0(instance, var_p0);
+  return ret;
+}
+
+/* export: 'i32.atomic.load16_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Eload16_u(w2c_atomic__0__wasm* instance, u32 var_p0) {
+  u32 ret = w2c_atomic__0__wasm_i320x2Eatomic0x2Eload16_u_0(instance, var_p0);
+  return ret;
+}
+
+/* export: 'i64.atomic.load8_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Eload8_u(w2c_atomic__0__wasm* instance, u32 var_p0) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Eload8_u_0(instance, var_p0);
+  return ret;
+}
+
+/* export: 'i64.atomic.load16_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Eload16_u(w2c_atomic__0__wasm* instance, u32 var_p0) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Eload16_u_0(instance, var_p0);
+  return ret;
+}
+
+/* export: 'i64.atomic.load32_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Eload32_u(w2c_atomic__0__wasm* instance, u32 var_p0) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Eload32_u_0(instance, var_p0);
+  return ret;
+}
+
+/* export: 'i32.atomic.store' */
+void w2c_atomic__0__wasm_i320x2Eatomic0x2Estore(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  w2c_atomic__0__wasm_i320x2Eatomic0x2Estore_0(instance, var_p0, var_p1);
+}
+
+/* export: 'i64.atomic.store' */
+void w2c_atomic__0__wasm_i640x2Eatomic0x2Estore(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  w2c_atomic__0__wasm_i640x2Eatomic0x2Estore_0(instance, var_p0, var_p1);
+}
+
+/* export: 'i32.atomic.store8' */
+void w2c_atomic__0__wasm_i320x2Eatomic0x2Estore8(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  w2c_atomic__0__wasm_i320x2Eatomic0x2Estore8_0(instance, var_p0, var_p1);
+}
+
+/* export: 'i32.atomic.store16' */
+void w2c_atomic__0__wasm_i320x2Eatomic0x2Estore16(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  w2c_atomic__0__wasm_i320x2Eatomic0x2Estore16_0(instance, var_p0, var_p1);
+}
+
+/* export: 'i64.atomic.store8' */
+void w2c_atomic__0__wasm_i640x2Eatomic0x2Estore8(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  w2c_atomic__0__wasm_i640x2Eatomic0x2Estore8_0(instance, var_p0, var_p1);
+}
+
+/* export: 'i64.atomic.store16' */
+void w2c_atomic__0__wasm_i640x2Eatomic0x2Estore16(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  w2c_atomic__0__wasm_i640x2Eatomic0x2Estore16_0(instance, var_p0, var_p1);
+}
+
+/* export: 'i64.atomic.store32' */
+void w2c_atomic__0__wasm_i640x2Eatomic0x2Estore32(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  w2c_atomic__0__wasm_i640x2Eatomic0x2Estore32_0(instance, var_p0, var_p1);
+}
+
+/* export: 'i32.atomic.rmw.add' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Eadd(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  u32 ret = w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Eadd_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i64.atomic.rmw.add' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Eadd(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Eadd_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i32.atomic.rmw8.add_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Eadd_u(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  u32 ret = w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Eadd_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i32.atomic.rmw16.add_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Eadd_u(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  u32 ret = w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Eadd_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i64.atomic.rmw8.add_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Eadd_u(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Eadd_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i64.atomic.rmw16.add_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Eadd_u(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Eadd_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i64.atomic.rmw32.add_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Eadd_u(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Eadd_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i32.atomic.rmw.sub' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Esub(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  u32 ret = w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Esub_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i64.atomic.rmw.sub' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Esub(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Esub_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i32.atomic.rmw8.sub_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Esub_u(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  u32 ret = w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Esub_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i32.atomic.rmw16.sub_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Esub_u(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  u32 ret = w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Esub_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i64.atomic.rmw8.sub_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Esub_u(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Esub_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i64.atomic.rmw16.sub_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Esub_u(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Esub_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i64.atomic.rmw32.sub_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Esub_u(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Esub_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i32.atomic.rmw.and' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Eand(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  u32 ret = w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Eand_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i64.atomic.rmw.and' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Eand(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Eand_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i32.atomic.rmw8.and_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Eand_u(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  u32 ret = w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Eand_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i32.atomic.rmw16.and_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Eand_u(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  u32 ret = w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Eand_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i64.atomic.rmw8.and_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Eand_u(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Eand_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i64.atomic.rmw16.and_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Eand_u(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Eand_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i64.atomic.rmw32.and_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Eand_u(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Eand_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i32.atomic.rmw.or' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Eor(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  u32 ret = w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Eor_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i64.atomic.rmw.or' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Eor(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Eor_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i32.atomic.rmw8.or_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Eor_u(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  u32 ret = w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Eor_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i32.atomic.rmw16.or_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Eor_u(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  u32 ret = w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Eor_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i64.atomic.rmw8.or_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Eor_u(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Eor_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i64.atomic.rmw16.or_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Eor_u(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Eor_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i64.atomic.rmw32.or_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Eor_u(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Eor_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i32.atomic.rmw.xor' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Exor(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  u32 ret = w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Exor_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i64.atomic.rmw.xor' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Exor(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Exor_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i32.atomic.rmw8.xor_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Exor_u(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  u32 ret = w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Exor_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i32.atomic.rmw16.xor_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Exor_u(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  u32 ret = w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Exor_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i64.atomic.rmw8.xor_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Exor_u(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Exor_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i64.atomic.rmw16.xor_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Exor_u(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Exor_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i64.atomic.rmw32.xor_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Exor_u(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Exor_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i32.atomic.rmw.xchg' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Exchg(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  u32 ret = w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Exchg_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i64.atomic.rmw.xchg' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Exchg(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Exchg_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i32.atomic.rmw8.xchg_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Exchg_u(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  u32 ret = w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Exchg_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i32.atomic.rmw16.xchg_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Exchg_u(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  u32 ret = w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Exchg_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i64.atomic.rmw8.xchg_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Exchg_u(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Exchg_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i64.atomic.rmw16.xchg_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Exchg_u(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Exchg_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i64.atomic.rmw32.xchg_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Exchg_u(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Exchg_u_0(instance, var_p0, var_p1);
+  return ret;
+}
+
+/* export: 'i32.atomic.rmw.cmpxchg' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Ecmpxchg(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1, u32 var_p2) {
+  u32 ret = w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Ecmpxchg_0(instance, var_p0, var_p1, var_p2);
+  return ret;
+}
+
+/* export: 'i64.atomic.rmw.cmpxchg' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Ecmpxchg(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1, u64 var_p2) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Ecmpxchg_0(instance, var_p0, var_p1, var_p2);
+  return ret;
+}
+
+/* export: 'i32.atomic.rmw8.cmpxchg_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Ecmpxchg_u(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1, u32 var_p2) {
+  u32 ret = w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Ecmpxchg_u_0(instance, var_p0, var_p1, var_p2);
+  return ret;
+}
+
+/* export: 'i32.atomic.rmw16.cmpxchg_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Ecmpxchg_u(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1, u32 var_p2) {
+  u32 ret = w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Ecmpxchg_u_0(instance, var_p0, var_p1, var_p2);
+  return ret;
+}
+
+/* export: 'i64.atomic.rmw8.cmpxchg_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Ecmpxchg_u(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1, u64 var_p2) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Ecmpxchg_u_0(instance, var_p0, var_p1, var_p2);
+  return ret;
+}
+
+/* export: 'i64.atomic.rmw16.cmpxchg_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Ecmpxchg_u(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1, u64 var_p2) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Ecmpxchg_u_0(instance, var_p0, var_p1, var_p2);
+  return ret;
+}
+
+/* export: 'i64.atomic.rmw32.cmpxchg_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Ecmpxchg_u(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1, u64 var_p2) {
+  u64 ret = w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Ecmpxchg_u_0(instance, var_p0, var_p1, var_p2);
+  return ret;
+}
+
+void wasm2c_atomic__0__wasm_instantiate(w2c_atomic__0__wasm* instance) {
+  assert(wasm_rt_is_initialized());
+  init_memories(instance);
+}
+
+void wasm2c_atomic__0__wasm_free(w2c_atomic__0__wasm* instance) {
+  wasm_rt_free_memory_shared(&instance->w2c_M0);
+}
+
+wasm_rt_func_type_t wasm2c_atomic__0__wasm_get_func_type(uint32_t param_count, uint32_t result_count, ...) {
+  va_list args;
+  
+  if (param_count == 1 && result_count == 0) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I64) {
+      va_end(args);
+      return w2c_atomic__0__wasm_t0;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 1 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_I32) {
+      va_end(args);
+      return w2c_atomic__0__wasm_t1;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 1 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_I64) {
+      va_end(args);
+      return w2c_atomic__0__wasm_t2;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 2 && result_count == 0) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_I32) {
+      va_end(args);
+      return w2c_atomic__0__wasm_t3;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 2 && result_count == 0) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_I64) {
+      va_end(args);
+      return w2c_atomic__0__wasm_t4;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 2 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_I32) {
+      va_end(args);
+      return w2c_atomic__0__wasm_t5;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 2 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_I64 && va_arg(args, int) == WASM_RT_I64) {
+      va_end(args);
+      return w2c_atomic__0__wasm_t6;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 3 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_I32) {
+      va_end(args);
+      return w2c_atomic__0__wasm_t7;
+    }
+    va_end(args);
+  }
+  
+  if (param_count == 3 && result_count == 1) {
+    va_start(args, result_count);
+    if (true && va_arg(args, int) == WASM_RT_I32 && va_arg(args, int) == WASM_RT_I64 && va_arg(args, int) == WASM_RT_I64 && va_arg(args, int) == WASM_RT_I64) {
+      va_end(args);
+      return w2c_atomic__0__wasm_t8;
+    }
+    va_end(args);
+  }
+  
+  return NULL;
+}
+
+void w2c_atomic__0__wasm_init_0(w2c_atomic__0__wasm* instance, u64 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j1;
+  var_i0 = 0u;
+  var_j1 = var_p0;
+  i64_store_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1);
+  FUNC_EPILOGUE;
+}
+
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Eload_0(w2c_atomic__0__wasm* instance, u32 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  var_i0 = var_p0;
+  var_i0 = i32_atomic_load_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0));
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Eload_0(w2c_atomic__0__wasm* instance, u32 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_i0 = var_p0;
+  var_j0 = i64_atomic_load_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0));
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Eload8_u_0(w2c_atomic__0__wasm* instance, u32 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  var_i0 = var_p0;
+  var_i0 = i32_atomic_load8_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0));
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Eload16_u_0(w2c_atomic__0__wasm* instance, u32 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  var_i0 = var_p0;
+  var_i0 = i32_atomic_load16_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0));
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Eload8_u_0(w2c_atomic__0__wasm* instance, u32 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_i0 = var_p0;
+  var_j0 = i64_atomic_load8_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0));
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Eload16_u_0(w2c_atomic__0__wasm* instance, u32 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_i0 = var_p0;
+  var_j0 = i64_atomic_load16_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0));
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Eload32_u_0(w2c_atomic__0__wasm* instance, u32 var_p0) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0;
+  var_i0 = var_p0;
+  var_j0 = i64_atomic_load32_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0));
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+void w2c_atomic__0__wasm_i320x2Eatomic0x2Estore_0(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = var_p0;
+  var_i1 = var_p1;
+  i32_atomic_store_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_i1);
+  FUNC_EPILOGUE;
+}
+
+void w2c_atomic__0__wasm_i640x2Eatomic0x2Estore_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j1;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  i64_atomic_store_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1);
+  FUNC_EPILOGUE;
+}
+
+void w2c_atomic__0__wasm_i320x2Eatomic0x2Estore8_0(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = var_p0;
+  var_i1 = var_p1;
+  i32_atomic_store8_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_i1);
+  FUNC_EPILOGUE;
+}
+
+void w2c_atomic__0__wasm_i320x2Eatomic0x2Estore16_0(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = var_p0;
+  var_i1 = var_p1;
+  i32_atomic_store16_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_i1);
+  FUNC_EPILOGUE;
+}
+
+void w2c_atomic__0__wasm_i640x2Eatomic0x2Estore8_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j1;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  i64_atomic_store8_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1);
+  FUNC_EPILOGUE;
+}
+
+void w2c_atomic__0__wasm_i640x2Eatomic0x2Estore16_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j1;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  i64_atomic_store16_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1);
+  FUNC_EPILOGUE;
+}
+
+void w2c_atomic__0__wasm_i640x2Eatomic0x2Estore32_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j1;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  i64_atomic_store32_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1);
+  FUNC_EPILOGUE;
+}
+
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Eadd_0(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = var_p0;
+  var_i1 = var_p1;
+  var_i0 = i32_atomic_rmw_add_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_i1);
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Eadd_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0, var_j1;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  var_j0 = i64_atomic_rmw_add_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Eadd_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = var_p0;
+  var_i1 = var_p1;
+  var_i0 = i32_atomic_rmw8_add_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_i1);
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Eadd_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = var_p0;
+  var_i1 = var_p1;
+  var_i0 = i32_atomic_rmw16_add_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_i1);
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Eadd_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0, var_j1;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  var_j0 = i64_atomic_rmw8_add_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Eadd_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0, var_j1;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  var_j0 = i64_atomic_rmw16_add_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Eadd_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0, var_j1;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  var_j0 = i64_atomic_rmw32_add_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Esub_0(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = var_p0;
+  var_i1 = var_p1;
+  var_i0 = i32_atomic_rmw_sub_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_i1);
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Esub_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0, var_j1;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  var_j0 = i64_atomic_rmw_sub_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Esub_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = var_p0;
+  var_i1 = var_p1;
+  var_i0 = i32_atomic_rmw8_sub_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_i1);
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Esub_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = var_p0;
+  var_i1 = var_p1;
+  var_i0 = i32_atomic_rmw16_sub_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_i1);
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Esub_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0, var_j1;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  var_j0 = i64_atomic_rmw8_sub_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Esub_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0, var_j1;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  var_j0 = i64_atomic_rmw16_sub_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Esub_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0, var_j1;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  var_j0 = i64_atomic_rmw32_sub_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Eand_0(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = var_p0;
+  var_i1 = var_p1;
+  var_i0 = i32_atomic_rmw_and_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_i1);
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Eand_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0, var_j1;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  var_j0 = i64_atomic_rmw_and_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Eand_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = var_p0;
+  var_i1 = var_p1;
+  var_i0 = i32_atomic_rmw8_and_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_i1);
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Eand_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = var_p0;
+  var_i1 = var_p1;
+  var_i0 = i32_atomic_rmw16_and_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_i1);
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Eand_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0, var_j1;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  var_j0 = i64_atomic_rmw8_and_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Eand_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0, var_j1;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  var_j0 = i64_atomic_rmw16_and_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Eand_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0, var_j1;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  var_j0 = i64_atomic_rmw32_and_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Eor_0(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = var_p0;
+  var_i1 = var_p1;
+  var_i0 = i32_atomic_rmw_or_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_i1);
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Eor_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0, var_j1;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  var_j0 = i64_atomic_rmw_or_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Eor_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = var_p0;
+  var_i1 = var_p1;
+  var_i0 = i32_atomic_rmw8_or_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_i1);
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Eor_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = var_p0;
+  var_i1 = var_p1;
+  var_i0 = i32_atomic_rmw16_or_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_i1);
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Eor_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0, var_j1;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  var_j0 = i64_atomic_rmw8_or_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Eor_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0, var_j1;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  var_j0 = i64_atomic_rmw16_or_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Eor_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0, var_j1;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  var_j0 = i64_atomic_rmw32_or_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Exor_0(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = var_p0;
+  var_i1 = var_p1;
+  var_i0 = i32_atomic_rmw_xor_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_i1);
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Exor_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0, var_j1;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  var_j0 = i64_atomic_rmw_xor_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Exor_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = var_p0;
+  var_i1 = var_p1;
+  var_i0 = i32_atomic_rmw8_xor_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_i1);
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Exor_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = var_p0;
+  var_i1 = var_p1;
+  var_i0 = i32_atomic_rmw16_xor_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_i1);
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Exor_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0, var_j1;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  var_j0 = i64_atomic_rmw8_xor_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Exor_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0, var_j1;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  var_j0 = i64_atomic_rmw16_xor_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Exor_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0, var_j1;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  var_j0 = i64_atomic_rmw32_xor_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Exchg_0(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = var_p0;
+  var_i1 = var_p1;
+  var_i0 = i32_atomic_rmw_xchg_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_i1);
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Exchg_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0, var_j1;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  var_j0 = i64_atomic_rmw_xchg_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Exchg_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = var_p0;
+  var_i1 = var_p1;
+  var_i0 = i32_atomic_rmw8_xchg_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_i1);
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Exchg_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1;
+  var_i0 = var_p0;
+  var_i1 = var_p1;
+  var_i0 = i32_atomic_rmw16_xchg_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_i1);
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Exchg_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0, var_j1;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  var_j0 = i64_atomic_rmw8_xchg_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Exchg_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0, var_j1;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  var_j0 = i64_atomic_rmw16_xchg_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Exchg_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0, var_j1;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  var_j0 = i64_atomic_rmw32_xchg_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Ecmpxchg_0(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1, u32 var_p2) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1, var_i2;
+  var_i0 = var_p0;
+  var_i1 = var_p1;
+  var_i2 = var_p2;
+  var_i0 = i32_atomic_rmw_cmpxchg_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_i1, var_i2);
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Ecmpxchg_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1, u64 var_p2) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0, var_j1, var_j2;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  var_j2 = var_p2;
+  var_j0 = i64_atomic_rmw_cmpxchg_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1, var_j2);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Ecmpxchg_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1, u32 var_p2) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1, var_i2;
+  var_i0 = var_p0;
+  var_i1 = var_p1;
+  var_i2 = var_p2;
+  var_i0 = i32_atomic_rmw8_cmpxchg_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_i1, var_i2);
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Ecmpxchg_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u32 var_p1, u32 var_p2) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0, var_i1, var_i2;
+  var_i0 = var_p0;
+  var_i1 = var_p1;
+  var_i2 = var_p2;
+  var_i0 = i32_atomic_rmw16_cmpxchg_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_i1, var_i2);
+  FUNC_EPILOGUE;
+  return var_i0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Ecmpxchg_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1, u64 var_p2) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0, var_j1, var_j2;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  var_j2 = var_p2;
+  var_j0 = i64_atomic_rmw8_cmpxchg_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1, var_j2);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Ecmpxchg_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1, u64 var_p2) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0, var_j1, var_j2;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  var_j2 = var_p2;
+  var_j0 = i64_atomic_rmw16_cmpxchg_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1, var_j2);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
+
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Ecmpxchg_u_0(w2c_atomic__0__wasm* instance, u32 var_p0, u64 var_p1, u64 var_p2) {
+  FUNC_PROLOGUE;
+  uint8_t* const wasm_rt_local_memory_base = NULL;
+  uint64_t wasm_rt_local_memory_size = 0;
+  (void)wasm_rt_local_memory_base;
+  (void)wasm_rt_local_memory_size;
+  u32 var_i0;
+  u64 var_j0, var_j1, var_j2;
+  var_i0 = var_p0;
+  var_j1 = var_p1;
+  var_j2 = var_p2;
+  var_j0 = i64_atomic_rmw32_cmpxchg_u_shared_default32(wasm_rt_local_memory_base, wasm_rt_local_memory_size, &instance->w2c_M0, (u64)(var_i0), var_j1, var_j2);
+  FUNC_EPILOGUE;
+  return var_j0;
+}
@@ -0,0 +1,231 @@
+/* Automatically generated by wasm2c */
+#ifndef ATOMIC_0_H_GENERATED_
+#define ATOMIC_0_H_GENERATED_
+
+#include "wasm-rt.h"
+
+#include <stdint.h>
+
+#ifndef WASM_RT_CORE_TYPES_DEFINED
+#define WASM_RT_CORE_TYPES_DEFINED
+typedef uint8_t u8;
+typedef int8_t s8;
+typedef uint16_t u16;
+typedef int16_t s16;
+typedef uint32_t u32;
+typedef int32_t s32;
+typedef uint64_t u64;
+typedef int64_t s64;
+typedef float f32;
+typedef double f64;
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct w2c_atomic__0__wasm {
+  wasm_rt_shared_memory_t w2c_M0;
+} w2c_atomic__0__wasm;
+
+void wasm2c_atomic__0__wasm_instantiate(w2c_atomic__0__wasm*);
+void wasm2c_atomic__0__wasm_free(w2c_atomic__0__wasm*);
+wasm_rt_func_type_t wasm2c_atomic__0__wasm_get_func_type(uint32_t param_count, uint32_t result_count, ...);
+
+/* export: 'init' */
+void w2c_atomic__0__wasm_init(w2c_atomic__0__wasm*, u64);
+
+/* export: 'i32.atomic.load' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Eload(w2c_atomic__0__wasm*, u32);
+
+/* export: 'i64.atomic.load' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Eload(w2c_atomic__0__wasm*, u32);
+
+/* export: 'i32.atomic.load8_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Eload8_u(w2c_atomic__0__wasm*, u32);
+
+/* export: 'i32.atomic.load16_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Eload16_u(w2c_atomic__0__wasm*, u32);
+
+/* export: 'i64.atomic.load8_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Eload8_u(w2c_atomic__0__wasm*, u32);
+
+/* export: 'i64.atomic.load16_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Eload16_u(w2c_atomic__0__wasm*, u32);
+
+/* export: 'i64.atomic.load32_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Eload32_u(w2c_atomic__0__wasm*, u32);
+
+/* export: 'i32.atomic.store' */
+void w2c_atomic__0__wasm_i320x2Eatomic0x2Estore(w2c_atomic__0__wasm*, u32, u32);
+
+/* export: 'i64.atomic.store' */
+void w2c_atomic__0__wasm_i640x2Eatomic0x2Estore(w2c_atomic__0__wasm*, u32, u64);
+
+/* export: 'i32.atomic.store8' */
+void w2c_atomic__0__wasm_i320x2Eatomic0x2Estore8(w2c_atomic__0__wasm*, u32, u32);
+
+/* export: 'i32.atomic.store16' */
+void w2c_atomic__0__wasm_i320x2Eatomic0x2Estore16(w2c_atomic__0__wasm*, u32, u32);
+
+/* export: 'i64.atomic.store8' */
+void w2c_atomic__0__wasm_i640x2Eatomic0x2Estore8(w2c_atomic__0__wasm*, u32, u64);
+
+/* export: 'i64.atomic.store16' */
+void w2c_atomic__0__wasm_i640x2Eatomic0x2Estore16(w2c_atomic__0__wasm*, u32, u64);
+
+/* export: 'i64.atomic.store32' */
+void w2c_atomic__0__wasm_i640x2Eatomic0x2Estore32(w2c_atomic__0__wasm*, u32, u64);
+
+/* export: 'i32.atomic.rmw.add' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Eadd(w2c_atomic__0__wasm*, u32, u32);
+
+/* export: 'i64.atomic.rmw.add' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Eadd(w2c_atomic__0__wasm*, u32, u64);
+
+/* export: 'i32.atomic.rmw8.add_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Eadd_u(w2c_atomic__0__wasm*, u32, u32);
+
+/* export: 'i32.atomic.rmw16.add_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Eadd_u(w2c_atomic__0__wasm*, u32, u32);
+
+/* export: 'i64.atomic.rmw8.add_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Eadd_u(w2c_atomic__0__wasm*, u32, u64);
+
+/* export: 'i64.atomic.rmw16.add_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Eadd_u(w2c_atomic__0__wasm*, u32, u64);
+
+/* export: 'i64.atomic.rmw32.add_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Eadd_u(w2c_atomic__0__wasm*, u32, u64);
+
+/* export: 'i32.atomic.rmw.sub' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Esub(w2c_atomic__0__wasm*, u32, u32);
+
+/* export: 'i64.atomic.rmw.sub' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Esub(w2c_atomic__0__wasm*, u32, u64);
+
+/* export: 'i32.atomic.rmw8.sub_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Esub_u(w2c_atomic__0__wasm*, u32, u32);
+
+/* export: 'i32.atomic.rmw16.sub_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Esub_u(w2c_atomic__0__wasm*, u32, u32);
+
+/* export: 'i64.atomic.rmw8.sub_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Esub_u(w2c_atomic__0__wasm*, u32, u64);
+
+/* export: 'i64.atomic.rmw16.sub_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Esub_u(w2c_atomic__0__wasm*, u32, u64);
+
+/* export: 'i64.atomic.rmw32.sub_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Esub_u(w2c_atomic__0__wasm*, u32, u64);
+
+/* export: 'i32.atomic.rmw.and' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Eand(w2c_atomic__0__wasm*, u32, u32);
+
+/* export: 'i64.atomic.rmw.and' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Eand(w2c_atomic__0__wasm*, u32, u64);
+
+/* export: 'i32.atomic.rmw8.and_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Eand_u(w2c_atomic__0__wasm*, u32, u32);
+
+/* export: 'i32.atomic.rmw16.and_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Eand_u(w2c_atomic__0__wasm*, u32, u32);
+
+/* export: 'i64.atomic.rmw8.and_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Eand_u(w2c_atomic__0__wasm*, u32, u64);
+
+/* export: 'i64.atomic.rmw16.and_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Eand_u(w2c_atomic__0__wasm*, u32, u64);
+
+/* export: 'i64.atomic.rmw32.and_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Eand_u(w2c_atomic__0__wasm*, u32, u64);
+
+/* export: 'i32.atomic.rmw.or' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Eor(w2c_atomic__0__wasm*, u32, u32);
+
+/* export: 'i64.atomic.rmw.or' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Eor(w2c_atomic__0__wasm*, u32, u64);
+
+/* export: 'i32.atomic.rmw8.or_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Eor_u(w2c_atomic__0__wasm*, u32, u32);
+
+/* export: 'i32.atomic.rmw16.or_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Eor_u(w2c_atomic__0__wasm*, u32, u32);
+
+/* export: 'i64.atomic.rmw8.or_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Eor_u(w2c_atomic__0__wasm*, u32, u64);
+
+/* export: 'i64.atomic.rmw16.or_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Eor_u(w2c_atomic__0__wasm*, u32, u64);
+
+/* export: 'i64.atomic.rmw32.or_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Eor_u(w2c_atomic__0__wasm*, u32, u64);
+
+/* export: 'i32.atomic.rmw.xor' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Exor(w2c_atomic__0__wasm*, u32, u32);
+
+/* export: 'i64.atomic.rmw.xor' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Exor(w2c_atomic__0__wasm*, u32, u64);
+
+/* export: 'i32.atomic.rmw8.xor_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Exor_u(w2c_atomic__0__wasm*, u32, u32);
+
+/* export: 'i32.atomic.rmw16.xor_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Exor_u(w2c_atomic__0__wasm*, u32, u32);
+
+/* export: 'i64.atomic.rmw8.xor_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Exor_u(w2c_atomic__0__wasm*, u32, u64);
+
+/* export: 'i64.atomic.rmw16.xor_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Exor_u(w2c_atomic__0__wasm*, u32, u64);
+
+/* export: 'i64.atomic.rmw32.xor_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Exor_u(w2c_atomic__0__wasm*, u32, u64);
+
+/* export: 'i32.atomic.rmw.xchg' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Exchg(w2c_atomic__0__wasm*, u32, u32);
+
+/* export: 'i64.atomic.rmw.xchg' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Exchg(w2c_atomic__0__wasm*, u32, u64);
+
+/* export: 'i32.atomic.rmw8.xchg_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Exchg_u(w2c_atomic__0__wasm*, u32, u32);
+
+/* export: 'i32.atomic.rmw16.xchg_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Exchg_u(w2c_atomic__0__wasm*, u32, u32);
+
+/* export: 'i64.atomic.rmw8.xchg_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Exchg_u(w2c_atomic__0__wasm*, u32, u64);
+
+/* export: 'i64.atomic.rmw16.xchg_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Exchg_u(w2c_atomic__0__wasm*, u32, u64);
+
+/* export: 'i64.atomic.rmw32.xchg_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Exchg_u(w2c_atomic__0__wasm*, u32, u64);
+
+/* export: 'i32.atomic.rmw.cmpxchg' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw0x2Ecmpxchg(w2c_atomic__0__wasm*, u32, u32, u32);
+
+/* export: 'i64.atomic.rmw.cmpxchg' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw0x2Ecmpxchg(w2c_atomic__0__wasm*, u32, u64, u64);
+
+/* export: 'i32.atomic.rmw8.cmpxchg_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw80x2Ecmpxchg_u(w2c_atomic__0__wasm*, u32, u32, u32);
+
+/* export: 'i32.atomic.rmw16.cmpxchg_u' */
+u32 w2c_atomic__0__wasm_i320x2Eatomic0x2Ermw160x2Ecmpxchg_u(w2c_atomic__0__wasm*, u32, u32, u32);
+
+/* export: 'i64.atomic.rmw8.cmpxchg_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw80x2Ecmpxchg_u(w2c_atomic__0__wasm*, u32, u64, u64);
+
+/* export: 'i64.atomic.rmw16.cmpxchg_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw160x2Ecmpxchg_u(w2c_atomic__0__wasm*, u32, u64, u64);
+
+/* export: 'i64.atomic.rmw32.cmpxchg_u' */
+u64 w2c_atomic__0__wasm_i640x2Eatomic0x2Ermw320x2Ecmpxchg_u(w2c_atomic__0__wasm*, u32, u64, u64);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* ATOMIC_0_H_GENERATED_ */
@@ -0,0 +1,136 @@
+#!/usr/bin/env python3
+#
+# Copyright 2026 WebAssembly Community Group participants
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+"""Counts the instruction sequences that run in an interpreter trace.
+
+The sequences in superinstructions.def are chosen from the most frequent
+ones in src/interp/superinstruction-counts.txt, which is regenerated from
+the Dhrystone benchmark with fusion disabled. From the repository root:
+
+  interp-benchmark --trace dhrystone \\
+    | scripts/count-superinstructions.py --update
+
+Each sequence of 2 to 4 instructions is counted every time it runs, summed
+over all of the given traces, and the most frequent ones are written most
+frequent first. The sequences in superinstructions.def that aren't in the
+table are reported, since their fusion no longer pays for itself.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+REPO_ROOT_DIR = os.path.dirname(SCRIPT_DIR)
+INTERP_DIR = os.path.join(REPO_ROOT_DIR, 'src', 'interp')
+DEF_FILE = os.path.join(INTERP_DIR, 'superinstructions.def')
+TABLE_FILE = os.path.join(INTERP_DIR, 'superinstruction-counts.txt')
+
+ENTRY_RE = re.compile(r'^WABT_SUPERINSTRUCTION\((\w+),\s*"([^"]*)"\)\s*$')
+# A trace line looks like `#0.   12: V:1  | i32.add 1, 2`.
+TRACE_RE = re.compile(r'^#\d+\.\s+(\d+): V:\d+\s*\| (\S+)')
+# Instructions after which the next one to run isn't the next one in the
+# istream, so no sequence continues past them.
+BRANCH_RE = re.compile(r'^(br|call|return|unreachable|throw)')
+
+MIN_LENGTH = 2
+MAX_LENGTH = 4
+TABLE_SIZE = 100
+
+HEADER = """\
+# Generated by scripts/count-superinstructions.py from
+#
+#   interp-benchmark --trace dhrystone
+#
+# The most frequent instruction sequences, with the number of times each one
+# ran. Sequences that cross a loop label are counted too, but can't be fused.
+#
+#      count  sequence
+"""
+
+
+def ReadDef(path):
+    entries = []
+    with open(path) as f:
+        for line in f:
+            m = ENTRY_RE.match(line)
+            if m:
+                entries.append((m.group(1), m.group(2)))
+    return entries
+
+
+def CountSequences(lines, counts):
+    window = []
+    last_offset = -1
+    for line in lines:
+        m = TRACE_RE.match(line)
+        if not m:
+            continue
+        offset, opcode = int(m.group(1)), m.group(2)
+        if offset <= last_offset:
+            window = []
+        last_offset = offset
+        window.append(opcode)
+        if len(window) > MAX_LENGTH:
+            del window[0]
+        for length in range(MIN_LENGTH, len(window) + 1):
+            seq = ' '.join(window[-length:])
+            counts[seq] = counts.get(seq, 0) + 1
+        if BRANCH_RE.match(opcode):
+            window = []
+
+
+def main(args):
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawTextHelpFormatter)
+    parser.add_argument('traces', nargs='*',
+                        help='trace files to combine (default: stdin)')
+    parser.add_argument('--update', action='store_true',
+                        help='write the table to %s instead of stdout' %
+                        os.path.relpath(TABLE_FILE, REPO_ROOT_DIR))
+    options = parser.parse_args(args)
+
+    counts = {}
+    if options.traces:
+        for trace in options.traces:
+            with open(trace) as f:
+                CountSequences(f, counts)
+    else:
+        CountSequences(sys.stdin, counts)
+
+    table = sorted(counts.items(), key=lambda x: (-x[1], x[0]))[:TABLE_SIZE]
+    lines = ['%12d  %s\n' % (count, seq) for seq, count in table]
+    if options.update:
+        with open(TABLE_FILE, 'w') as f:
+            f.write(HEADER)
+            f.writelines(lines)
+    else:
+        sys.stdout.writelines(lines)
+
+    listed = set(seq for seq, _ in table)
+    result = 0
+    for opcode, seq in ReadDef(DEF_FILE):
+        if seq not in listed:
+            print('%s: "%s" is not in the table' % (opcode, seq),
+                  file=sys.stderr)
+            result = 1
+    return result
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,96 @@
+/*
+ * Copyright 2026 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "wabt/arena.h"
+
+#include <new>
+
+namespace wabt {
+
+namespace {
+
+// Each ArenaAllocated object is preceded by the Arena it was allocated from,
+// or nullptr if it was allocated from the heap. The header is padded so that
+// the object stays aligned.
+constexpr size_t kHeaderSize = Arena::kAlignment;
+static_assert(sizeof(Arena*) <= kHeaderSize, "header too small");
+
+thread_local Arena* s_current_arena = nullptr;
+
+size_t AlignUp(size_t size) {
+  return (size + Arena::kAlignment - 1) & ~(Arena::kAlignment - 1);
+}
+
+}  // end anonymous namespace
+
+Arena::Scope::Scope(Arena* arena) : prev_(s_current_arena) {
+  s_current_arena = arena;
+}
+
+Arena::Scope::~Scope() {
+  s_current_arena = prev_;
+}
+
+Arena::Arena() = default;
+
+Arena::~Arena() = default;
+
+void* Arena::Allocate(size_t size) {
+  size = AlignUp(size);
+  if (size > static_cast<size_t>(end_ - next_)) {
+    // Large objects get a block of their own, so that the rest of the
+    // current block isn't wasted.
+    if (size > kBlockSize / 4) {
+      blocks_.emplace_back(new char[size]);
+      capacity_ += size;
+      return blocks_.back().get();
+    }
+    blocks_.emplace_back(new char[kBlockSize]);
+    capacity_ += kBlockSize;
+    next_ = blocks_.back().get();
+    end_ = next_ + kBlockSize;
+  }
+  void* result = next_;
+  next_ += size;
+  return result;
+}
+
+// static
+Arena* Arena::current() {
+  return s_current_arena;
+}
+
+// static
+void* Arena::NewObject(size_t size) {
+  Arena* arena = Arena::current();
+  size += kHeaderSize;
+  void* header = arena ? arena->Allocate(size) : ::operator new(size);
+  *static_cast<Arena**>(header) = arena;
+  return static_cast<char*>(header) + kHeaderSize;
+}
+
+// static
+void Arena::DeleteObject(void* p) {
+  if (!p) {
+    return;
+  }
+  void* header = static_cast<char*>(p) - kHeaderSize;
+  if (!*static_cast<Arena**>(header)) {
+    ::operator delete(header);
+  }
+}
+
+}  // namespace wabt
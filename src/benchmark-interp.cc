@@ -0,0 +1,349 @@
+/*
+ * Copyright 2026 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Timing benchmarks for the interpreter. These are kept out of
+// wabt-unittests, which only checks behavior; run them with
+//
+//   interp-benchmark [--trace] [name...]
+//
+// from the root of the repository, to run the named benchmarks, or all of
+// them if no name is given. With --trace, the dhrystone benchmark runs
+// without superinstructions and traces every instruction to stdout; see
+// scripts/count-superinstructions.py.
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "wabt/binary-reader.h"
+#include "wabt/common.h"
+#include "wabt/error-formatter.h"
+#include "wabt/stream.h"
+
+#include "wabt/interp/binary-reader-interp.h"
+#include "wabt/interp/interp.h"
+
+using namespace wabt;
+using namespace wabt::interp;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+bool s_trace;
+
+Module::Ptr ReadModule(Store& store,
+                       const std::vector<u8>& data,
+                       const CompileOptions& compile_options) {
+  Errors errors;
+  ReadBinaryOptions options;
+  options.features = store.features();
+  ModuleDesc module_desc;
+  if (Failed(ReadBinaryInterp("<internal>", data, options, compile_options,
+                              &errors, &module_desc))) {
+    fprintf(stderr, "%s",
+            FormatErrorsToString(errors, Location::Type::Binary).c_str());
+    exit(1);
+  }
+  return Module::New(store, module_desc);
+}
+
+Instance::Ptr Instantiate(Store& store,
+                          const Module::Ptr& mod,
+                          const RefVec& imports) {
+  Trap::Ptr trap;
+  auto inst = Instance::Instantiate(store, mod.ref(), imports, &trap);
+  if (!inst) {
+    fprintf(stderr, "%s\n", trap->message().c_str());
+    exit(1);
+  }
+  return inst;
+}
+
+Instance::Ptr Instantiate(Store& store, const std::vector<u8>& data) {
+  return Instantiate(store, ReadModule(store, data, CompileOptions()),
+                     RefVec{});
+}
+
+void Check(RunResult expected, RunResult actual) {
+  if (actual != expected) {
+    fprintf(stderr, "unexpected run result\n");
+    exit(1);
+  }
+}
+
+// Measures the threaded dispatch loop of Thread::Run. Superinstructions are
+// disabled, so the istream is the one that the switch-based loop ran before
+// threaded dispatch was added; to compare the two, build this function against
+// that commit's libwabt. Single-stepping goes through the same dispatch code as
+// Run, so it is only used to count the instructions.
+void BenchmarkDispatch() {
+  // (func (export "sum") (param $n i32) (result i32)
+  //   (local $sum i32)
+  //   (block $done
+  //     (loop $loop
+  //       (br_if $done (i32.eqz (local.get $n)))
+  //       (local.set $sum (i32.add (local.get $sum) (local.get $n)))
+  //       (local.set $n (i32.sub (local.get $n) (i32.const 1)))
+  //       (br $loop)))
+  //   (local.get $sum))
+  const std::vector<u8> data = {
+      0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x06, 0x01,
+      0x60, 0x01, 0x7f, 0x01, 0x7f, 0x03, 0x02, 0x01, 0x00, 0x07, 0x07,
+      0x01, 0x03, 0x73, 0x75, 0x6d, 0x00, 0x00, 0x0a, 0x23, 0x01, 0x21,
+      0x01, 0x01, 0x7f, 0x02, 0x40, 0x03, 0x40, 0x20, 0x00, 0x45, 0x0d,
+      0x01, 0x20, 0x01, 0x20, 0x00, 0x6a, 0x21, 0x01, 0x20, 0x00, 0x41,
+      0x01, 0x6b, 0x21, 0x00, 0x0c, 0x00, 0x0b, 0x0b, 0x20, 0x01, 0x0b,
+  };
+  Store store;
+  CompileOptions compile_options;
+  compile_options.superinstructions = false;
+  auto inst =
+      Instantiate(store, ReadModule(store, data, compile_options), RefVec{});
+  auto func = store.UnsafeGet<DefinedFunc>(inst->exports()[0]);
+
+  const u32 kIterations = 1000000;
+  const Values params = {Value::Make(kIterations)};
+  Trap::Ptr trap;
+  RunResult result;
+
+  Thread step_thread(store);
+  Check(RunResult::Ok, step_thread.PushCall(*func, params, &trap));
+  u64 num_instructions = 0;
+  do {
+    result = step_thread.Step(&trap);
+    ++num_instructions;
+  } while (result == RunResult::Ok);
+  Check(RunResult::Return, result);
+
+  Thread run_thread(store);
+  Check(RunResult::Ok, run_thread.PushCall(*func, params, &trap));
+  auto start = Clock::now();
+  result = run_thread.Run(&trap);
+  std::chrono::duration<double> run_time = Clock::now() - start;
+  Check(RunResult::Return, result);
+
+  printf("dispatch: %" PRIu64 " instructions: run %.0f instr/s\n",
+         num_instructions, num_instructions / run_time.count());
+}
+
+// Throws and catches exceptions with automatic collection, so that the pool
+// slabs of the exceptions are freed and reused as the loop runs.
+void BenchmarkExceptions() {
+  // (tag $e (param i32))
+  // (func $thrower (param i32) (throw $e (local.get 0)))
+  // (func (export "f") (param $n i32) (result i32)
+  //   (local $sum i32)
+  //   (loop $loop
+  //     (block $h (result i32)
+  //       (try_table (catch $e $h) (call $thrower (local.get $n)))
+  //       (unreachable))
+  //     (local.set $sum (i32.add (local.get $sum)))
+  //     (br_if $loop (local.tee $n (i32.sub (local.get $n) (i32.const 1)))))
+  //   (local.get $sum))
+  Features features;
+  features.enable_exceptions();
+  Store store(features);
+  auto inst = Instantiate(
+      store,
+      {
+          0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0a, 0x02,
+          0x60, 0x01, 0x7f, 0x00, 0x60, 0x01, 0x7f, 0x01, 0x7f, 0x03, 0x03,
+          0x02, 0x00, 0x01, 0x0d, 0x03, 0x01, 0x00, 0x00, 0x07, 0x05, 0x01,
+          0x01, 0x66, 0x00, 0x01, 0x0a, 0x2f, 0x02, 0x06, 0x00, 0x20, 0x00,
+          0x08, 0x00, 0x0b, 0x26, 0x01, 0x01, 0x7f, 0x03, 0x40, 0x02, 0x7f,
+          0x1f, 0x40, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x10, 0x00, 0x0b,
+          0x00, 0x0b, 0x20, 0x01, 0x6a, 0x21, 0x01, 0x20, 0x00, 0x41, 0x01,
+          0x6b, 0x22, 0x00, 0x0d, 0x00, 0x0b, 0x20, 0x01, 0x0b,
+      });
+  auto func = store.UnsafeGet<DefinedFunc>(inst->exports()[0]);
+
+  Store::GCOptions options;
+  options.automatic = true;
+  store.SetGCOptions(options);
+
+  const u32 kIterations = 100000;
+  Values results;
+  Trap::Ptr trap;
+  auto start = Clock::now();
+  if (Failed(func->Call(store, {Value::Make(kIterations)}, results, &trap))) {
+    fprintf(stderr, "%s\n", trap->message().c_str());
+    exit(1);
+  }
+  std::chrono::duration<double> time = Clock::now() - start;
+
+  const Store::GCStats& stats = store.gc_stats();
+  printf("exceptions: %u throws: %.0f throws/s, %" PRIu64
+         " collections, %zu slabs\n",
+         kIterations, kIterations / time.count(), stats.collections,
+         store.object_pool_slab_count());
+}
+
+// Runs one round of Dhrystone (wasm2c/benchmarks/dhrystone), with just enough
+// of WASI for it to run. The clock advances 6 seconds each time it is read,
+// so the benchmark stops after its first round of runs.
+void BenchmarkDhrystone() {
+  const char kFilename[] = "wasm2c/benchmarks/dhrystone/dhrystone.wasm";
+  std::vector<u8> data;
+  if (Failed(ReadFile(kFilename, &data))) {
+    exit(1);
+  }
+
+  Store store;
+  CompileOptions compile_options;
+  compile_options.superinstructions = !s_trace;
+  auto mod = ReadModule(store, data, compile_options);
+
+  Memory::Ptr memory;
+  u64 clock = 0;
+  auto write = [&](u32 ptr, auto value) {
+    return memory->Store(ptr, 0, value);
+  };
+  auto wasi = [&](std::string_view name) -> HostFunc::Callback {
+    if (name == "args_sizes_get") {
+      return [&](Thread&, const Values& params, Values& results, Trap::Ptr*) {
+        results[0] = Value::Make(u32{0});
+        return write(params[0].Get<u32>(), u32{0}) |
+               write(params[1].Get<u32>(), u32{0});
+      };
+    } else if (name == "clock_time_get") {
+      return [&](Thread&, const Values& params, Values& results, Trap::Ptr*) {
+        clock += 6000000000;
+        results[0] = Value::Make(u32{0});
+        return write(params[2].Get<u32>(), clock);
+      };
+    } else if (name == "fd_fdstat_get") {
+      return [&](Thread&, const Values& params, Values& results, Trap::Ptr*) {
+        results[0] = Value::Make(u32{0});
+        return write(params[1].Get<u32>(), u64{0}) |
+               write(params[1].Get<u32>() + 8, u64{0}) |
+               write(params[1].Get<u32>() + 16, u64{0});
+      };
+    } else if (name == "fd_seek") {
+      return [&](Thread&, const Values& params, Values& results, Trap::Ptr*) {
+        results[0] = Value::Make(u32{0});
+        return write(params[3].Get<u32>(), u64{0});
+      };
+    } else if (name == "fd_write") {
+      // The output is dropped, but all of it is reported as written.
+      return [&](Thread&, const Values& params, Values& results,
+                 Trap::Ptr*) -> Result {
+        u32 iovs = params[1].Get<u32>();
+        u32 written = 0;
+        for (u32 i = 0; i < params[2].Get<u32>(); ++i) {
+          u32 len;
+          if (Failed(memory->Load(iovs + i * 8, 4, &len))) {
+            return Result::Error;
+          }
+          written += len;
+        }
+        results[0] = Value::Make(u32{0});
+        return write(params[3].Get<u32>(), written);
+      };
+    } else if (name == "proc_exit") {
+      return [&](Thread&, const Values&, Values&, Trap::Ptr* out_trap) {
+        *out_trap = Trap::New(store, "proc_exit");
+        return Result::Error;
+      };
+    }
+    // args_get and fd_close have nothing to do.
+    return [](Thread&, const Values&, Values& results, Trap::Ptr*) {
+      results[0] = Value::Make(u32{0});
+      return Result::Ok;
+    };
+  };
+
+  RefVec imports;
+  for (const ImportType& import : mod->import_types()) {
+    auto func_type = *cast<FuncType>(import.type.get());
+    imports.push_back(HostFunc::New(store, func_type, wasi(import.name)).ref());
+  }
+  auto inst = Instantiate(store, mod, imports);
+  Func::Ptr start;
+  for (size_t i = 0; i < mod->export_types().size(); ++i) {
+    const ExportType& export_ = mod->export_types()[i];
+    if (export_.name == "memory") {
+      memory = store.UnsafeGet<Memory>(inst->exports()[i]);
+    } else if (export_.name == "_start") {
+      start = store.UnsafeGet<Func>(inst->exports()[i]);
+    }
+  }
+
+  std::unique_ptr<FileStream> trace_stream;
+  if (s_trace) {
+    trace_stream = FileStream::CreateStdout();
+  }
+  Thread thread(store, trace_stream.get());
+  Values results;
+  Trap::Ptr trap;
+  auto start_time = Clock::now();
+  Result result = start->Call(thread, {}, results, &trap);
+  std::chrono::duration<double> time = Clock::now() - start_time;
+  if (Failed(result) && trap->message() != "proc_exit") {
+    fprintf(stderr, "%s\n", trap->message().c_str());
+    exit(1);
+  }
+
+  if (!s_trace) {
+    printf("dhrystone: %.3fs\n", time.count());
+  }
+}
+
+struct Benchmark {
+  const char* name;
+  void (*run)();
+};
+
+const Benchmark kBenchmarks[] = {
+    {"dhrystone", BenchmarkDhrystone},
+    {"dispatch", BenchmarkDispatch},
+    {"exceptions", BenchmarkExceptions},
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  std::vector<const char*> names;
+  for (int i = 1; i < argc; ++i) {
+    if (strcmp(argv[i], "--trace") == 0) {
+      s_trace = true;
+      continue;
+    }
+    bool found = false;
+    for (const Benchmark& benchmark : kBenchmarks) {
+      found |= strcmp(argv[i], benchmark.name) == 0;
+    }
+    if (!found) {
+      fprintf(stderr, "unknown benchmark: %s\n", argv[i]);
+      return 1;
+    }
+    names.push_back(argv[i]);
+  }
+
+  for (const Benchmark& benchmark : kBenchmarks) {
+    bool selected = names.empty();
+    for (const char* name : names) {
+      selected |= strcmp(name, benchmark.name) == 0;
+    }
+    if (selected) {
+      benchmark.run();
+    }
+  }
+  return 0;
+}
@@ -16,12 +16,15 @@
 
 #include "wabt/binary-reader-ir.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cinttypes>
 #include <cstdarg>
 #include <cstdint>
 #include <cstdio>
 #include <deque>
+#include <thread>
 #include <vector>
 
 #include "wabt/binary-reader-nop.h"
@@ -55,6 +58,7 @@ class CodeMetadataExprQueue {
 
  public:
   CodeMetadataExprQueue() {}
+  bool empty() const { return entries.empty(); }
   void push_func(Func* f) { entries.emplace_back(f); }
   void push_metadata(std::unique_ptr<CodeMetadataExpr> meta) {
     assert(!entries.empty());
@@ -99,6 +103,11 @@ class BinaryReaderIR : public BinaryReaderNop {
  public:
   BinaryReaderIR(Module* out_module, const char* filename, Errors* errors);
 
+  // Skip the function bodies while the module is read, and decode them on
+  // `options.num_threads` threads at the end of the code section. The
+  // ReadBinary call must use skip_function_bodies.
+  void DeferFunctionBodies(ByteSpan data, const ReadBinaryOptions& options);
+
   bool OnError(const Error&) override;
 
   Result OnTypeCount(Index count) override;
@@ -170,6 +179,7 @@ class BinaryReaderIR : public BinaryReaderNop {
   Result OnStartFunction(Index func_index) override;
 
   Result OnFunctionBodyCount(Index count) override;
+  Result EndCodeSection() override;
   Result BeginFunctionBody(Index index, Offset size) override;
   Result OnLocalDecl(Index decl_index, Index count, Type type) override;
 
@@ -306,6 +316,7 @@ class BinaryReaderIR : public BinaryReaderNop {
   Result BeginElemExpr(Index elem_index, Index expr_index) override;
   Result EndElemExpr(Index elem_index, Index expr_index) override;
 
+  Result OnDataCount(Index count) override;
   Result OnDataSegmentCount(Index count) override;
   Result BeginDataSegment(Index index,
                           Index memory_index,
@@ -366,6 +377,12 @@ class BinaryReaderIR : public BinaryReaderNop {
                        Index table_index) override;
 
  private:
+  struct FuncBody {
+    Index func_index;
+    Offset offset;
+    Offset size;
+  };
+
   Location GetLocation() const;
   void PrintError(const char* format, ...);
   Result PushLabel(LabelType label_type,
@@ -393,6 +410,9 @@ class BinaryReaderIR : public BinaryReaderNop {
   std::string GetUniqueName(BindingHash* bindings,
                             const std::string& original_name);
 
+  Result DecodeFunctionBodies();
+  Result DecodeFunctionBodiesInParallel();
+
   Errors* errors_ = nullptr;
   Module* module_ = nullptr;
 
@@ -401,6 +421,14 @@ class BinaryReaderIR : public BinaryReaderNop {
 
   CodeMetadataExprQueue code_metadata_queue_;
   std::string_view current_metadata_name_;
+
+  // Set by DeferFunctionBodies.
+  bool defer_function_bodies_ = false;
+  ByteSpan data_;
+  ReadBinaryOptions body_options_;
+  std::vector<FuncBody> func_bodies_;
+  Index data_count_ = kInvalidIndex;
+  bool function_bodies_failed_ = false;
 };
 
 BinaryReaderIR::BinaryReaderIR(Module* out_module,
@@ -410,6 +438,13 @@ BinaryReaderIR::BinaryReaderIR(Module* out_module,
   out_module->filename = filename;
 }
 
+void BinaryReaderIR::DeferFunctionBodies(ByteSpan data,
+                                         const ReadBinaryOptions& options) {
+  defer_function_bodies_ = true;
+  data_ = data;
+  body_options_ = options;
+}
+
 Location BinaryReaderIR::GetLocation() const {
   Location loc;
   loc.offset = state->offset;
@@ -510,6 +545,12 @@ std::string BinaryReaderIR::GetUniqueName(BindingHash* bindings,
 }
 
 bool BinaryReaderIR::OnError(const Error& error) {
+  // The errors of the deferred function bodies have been reported already,
+  // so the reader's "EndCodeSection callback failed" adds nothing.
+  if (function_bodies_failed_) {
+    function_bodies_failed_ = false;
+    return true;
+  }
   errors_->push_back(error);
   return true;
 }
@@ -811,7 +852,136 @@ Result BinaryReaderIR::OnFunctionBodyCount(Index count) {
   return Result::Ok;
 }
 
+Result BinaryReaderIR::EndCodeSection() {
+  if (defer_function_bodies_ && Failed(DecodeFunctionBodies())) {
+    function_bodies_failed_ = true;
+    return Result::Error;
+  }
+  return Result::Ok;
+}
+
+Result BinaryReaderIR::DecodeFunctionBodies() {
+  defer_function_bodies_ = false;
+  // The code metadata is matched to the bodies in order, so it can't be
+  // split between threads.
+  if (body_options_.num_threads > 1 && code_metadata_queue_.empty()) {
+    return DecodeFunctionBodiesInParallel();
+  }
+
+  // The bodies are read by another BinaryReader, whose state is only valid
+  // while it reads.
+  const State* module_state = state;
+  Result result = Result::Ok;
+  for (const FuncBody& body : func_bodies_) {
+    result = ReadBinaryFunctionBody(data_, body.func_index, body.offset,
+                                    body.size, data_count_, this,
+                                    body_options_);
+    if (Failed(result)) {
+      break;
+    }
+  }
+  state = module_state;
+  return result;
+}
+
+// The bodies are split into contiguous chunks, which are decoded by a reader
+// on each thread. Each reader has its own view of the module, so that the
+// module-level state it updates (features_used and used_func_refs) can be
+// merged afterward. The chunks' errors are merged in order, so the result is
+// the same as that of a sequential read.
+Result BinaryReaderIR::DecodeFunctionBodiesInParallel() {
+  // More chunks than threads, so that a few large functions don't leave the
+  // other threads idle.
+  static constexpr size_t kChunksPerThread = 4;
+
+  struct Chunk {
+    size_t begin;
+    size_t end;
+    Errors errors;
+    Result result = Result::Ok;
+  };
+
+  size_t num_threads = body_options_.num_threads;
+  size_t num_chunks = std::min(func_bodies_.size(),
+                               num_threads * kChunksPerThread);
+  std::vector<Chunk> chunks(num_chunks);
+  for (size_t i = 0; i < num_chunks; ++i) {
+    chunks[i].begin = func_bodies_.size() * i / num_chunks;
+    chunks[i].end = func_bodies_.size() * (i + 1) / num_chunks;
+  }
+  num_threads = std::min(num_threads, num_chunks);
+
+  // Only the fields that are read while decoding a body are shared with the
+  // views; they don't own anything.
+  std::vector<Module> views(num_threads);
+  for (Module& view : views) {
+    view.funcs = module_->funcs;
+    view.types = module_->types;
+  }
+
+  // Arenas aren't thread-safe, so each thread allocates the expressions it
+  // reads from an arena of its own.
+  std::vector<Arena*> arenas;
+  for (size_t i = 0; i < num_threads; ++i) {
+    module_->arenas.push_back(std::make_unique<Arena>());
+    arenas.push_back(module_->arenas.back().get());
+  }
+
+  std::atomic<size_t> next_chunk{0};
+  auto decode_chunks = [&](Module* view, Arena* arena) {
+    Arena::Scope arena_scope(arena);
+    BinaryReaderIR reader(view, module_->filename.data(), nullptr);
+    size_t i;
+    while ((i = next_chunk++) < chunks.size()) {
+      Chunk& chunk = chunks[i];
+      reader.errors_ = &chunk.errors;
+      reader.label_stack_.clear();
+      for (size_t j = chunk.begin; j < chunk.end; ++j) {
+        const FuncBody& body = func_bodies_[j];
+        chunk.result = ReadBinaryFunctionBody(
+            data_, body.func_index, body.offset, body.size, data_count_,
+            &reader, body_options_);
+        if (Failed(chunk.result)) {
+          break;
+        }
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < num_threads; ++i) {
+    threads.emplace_back(decode_chunks, &views[i], arenas[i]);
+  }
+  if (num_threads > 0) {
+    decode_chunks(&views[0], arenas[0]);
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  for (Module& view : views) {
+    module_->features_used.simd |= view.features_used.simd;
+    module_->features_used.exceptions |= view.features_used.exceptions;
+    module_->features_used.threads |= view.features_used.threads;
+    module_->used_func_refs.insert(view.used_func_refs.begin(),
+                                   view.used_func_refs.end());
+  }
+  // A sequential read stops at the first body that fails.
+  for (Chunk& chunk : chunks) {
+    errors_->insert(errors_->end(), chunk.errors.begin(), chunk.errors.end());
+    if (Failed(chunk.result)) {
+      return Result::Error;
+    }
+  }
+  return Result::Ok;
+}
+
 Result BinaryReaderIR::BeginFunctionBody(Index index, Offset size) {
+  if (defer_function_bodies_) {
+    func_bodies_.push_back(FuncBody{index, state->offset, size});
+    return Result::Ok;
+  }
+
   current_func_ = module_->funcs[index];
   current_func_->loc = GetLocation();
   return PushLabel(LabelType::Func, &current_func_->exprs);
@@ -1361,6 +1531,10 @@ Result BinaryReaderIR::OnUnreachableExpr() {
 }
 
 Result BinaryReaderIR::EndFunctionBody(Index index) {
+  if (defer_function_bodies_) {
+    return Result::Ok;
+  }
+
   current_func_ = nullptr;
   if (!label_stack_.empty()) {
     PrintError("function %" PRIindex " missing end marker", index);
@@ -1487,6 +1661,11 @@ Result BinaryReaderIR::EndElemExpr(Index elem_index, Index expr_index) {
   return EndInitExpr();
 }
 
+Result BinaryReaderIR::OnDataCount(Index count) {
+  data_count_ = count;
+  return Result::Ok;
+}
+
 Result BinaryReaderIR::OnDataSegmentCount(Index count) {
   WABT_TRY
   module_->data_segments.reserve(count);
@@ -1899,7 +2078,16 @@ Result ReadBinaryIr(const char* filename,
   // bodies here leaves each function's label unclosed, because the end marker
   // that would pop it is never read.
   assert(!options.skip_function_bodies);
+  out_module->arenas.push_back(std::make_unique<Arena>());
+  Arena::Scope arena_scope(out_module->arenas.back().get());
   BinaryReaderIR reader(out_module, filename, errors);
+  // The log would interleave the bodies that are read on different threads.
+  if (options.num_threads > 1 && !options.log_stream) {
+    ReadBinaryOptions module_options = options;
+    module_options.skip_function_bodies = true;
+    reader.DeferFunctionBodies(data, options);
+    return ReadBinary(data, &reader, module_options);
+  }
   return ReadBinary(data, &reader, options);
 }
 
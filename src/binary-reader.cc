@@ -81,6 +81,10 @@ class BinaryReader {
                         const ReadBinaryOptions& options);
 
   Result ReadModule(const ReadModuleOptions& options);
+  Result ReadSingleFunctionBody(Index func_index,
+                                Offset offset,
+                                Offset size,
+                                Index data_count);
 
  private:
   template <typename T, T BinaryReader::*member>
@@ -756,6 +760,21 @@ Result BinaryReader::ReadFunctionBody(Offset end_offset) {
   return Result::Ok;
 }
 
+Result BinaryReader::ReadSingleFunctionBody(Index func_index,
+                                            Offset offset,
+                                            Offset size,
+                                            Index data_count) {
+  data_count_ = data_count;
+  state_.offset = offset;
+  Offset end_offset = offset + size;
+  ERROR_UNLESS(end_offset >= offset && end_offset <= read_end_,
+               "invalid function body size: extends past end");
+  CALLBACK(BeginFunctionBody, func_index, size);
+  CHECK_RESULT(ReadFunctionBody(end_offset));
+  CALLBACK(EndFunctionBody, func_index);
+  return Result::Ok;
+}
+
 Result BinaryReader::ReadInstructions(Offset end_offset, const char* context) {
   std::stack<Opcode> nested_blocks;
   while (state_.offset < end_offset) {
@@ -3300,4 +3319,15 @@ Result ReadBinary(ByteSpan data,
       BinaryReader::ReadModuleOptions{options.stop_on_first_error});
 }
 
+Result ReadBinaryFunctionBody(ByteSpan data,
+                              Index func_index,
+                              Offset offset,
+                              Offset size,
+                              Index data_count,
+                              BinaryReaderDelegate* delegate,
+                              const ReadBinaryOptions& options) {
+  BinaryReader reader(data, delegate, options);
+  return reader.ReadSingleFunctionBody(func_index, offset, size, data_count);
+}
+
 }  // namespace wabt
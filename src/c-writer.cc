@@ -16,7 +16,10 @@
 
 #include "wabt/c-writer.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cctype>
+#include <chrono>
 #include <cinttypes>
 #include <clocale>
 #include <cstring>
@@ -25,6 +28,7 @@
 #include <map>
 #include <set>
 #include <string_view>
+#include <thread>
 #include <vector>
 
 #include "wabt/cast.h"
@@ -183,7 +187,7 @@ int GetShiftMask(Type type) {
 }
 
 /*
- * This function is the default behavior for name_to_output_file_index_. For
+ * This function is the default behavior for name_to_output_file_index. For
  * single .c output, this function returns a vector filled with 0. For multiple
  * .c outputs, this function sorts all non-imported functions in the module by
  * their names, and then divides all non-imported functions into equal-sized
@@ -228,17 +232,20 @@ class CWriter {
           const char* header_name,
           const char* header_impl_name,
           const WriteCOptions& options)
-      : options_(options),
-        c_streams_(std::move(c_streams)),
-        h_stream_(h_stream),
-        h_impl_stream_(h_impl_stream),
-        header_name_(header_name),
-        header_impl_name_(header_impl_name) {
-    module_prefix_ = MangleModuleName(options_.module_name);
-    if (c_streams_.size() != 1 && options.name_to_output_file_index) {
-      name_to_output_file_index_ = options.name_to_output_file_index;
+      : owned_state_(std::make_unique<ModuleState>(options)),
+        state_(*owned_state_) {
+    owned_state_->c_streams = std::move(c_streams);
+    owned_state_->h_stream = h_stream;
+    owned_state_->h_impl_stream = h_impl_stream;
+    owned_state_->header_name = header_name;
+    owned_state_->header_impl_name = header_impl_name;
+    owned_state_->module_prefix = MangleModuleName(options.module_name);
+    if (state_.c_streams.size() != 1 && options.name_to_output_file_index) {
+      owned_state_->name_to_output_file_index =
+          options.name_to_output_file_index;
     } else {
-      name_to_output_file_index_ = default_name_to_output_file_index;
+      owned_state_->name_to_output_file_index =
+          default_name_to_output_file_index;
     }
   }
 
@@ -246,7 +253,54 @@ class CWriter {
 
  private:
   using SymbolSet = std::set<std::string>;
+  // The table slots holding each function a call_indirect can reach.
+  using StaticCallTargets =
+      std::vector<std::pair<const Func*, std::vector<Index>>>;
   using SymbolMap = std::map<std::string, std::string>;
+
+  // The module-wide names, types and analysis. They are computed while
+  // writing the header and the top of the source, and only read after that,
+  // by the writers of the function bodies.
+  struct ModuleState {
+    explicit ModuleState(const WriteCOptions& options) : options(options) {}
+
+    const WriteCOptions& options;
+    const Module* module = nullptr;
+    std::vector<Stream*> c_streams;
+    Stream* h_stream = nullptr;
+    Stream* h_impl_stream = nullptr;
+    std::string header_name;
+    std::string header_impl_name;
+
+    SymbolMap global_sym_map;
+    SymbolMap import_module_sym_map;
+    SymbolSet global_syms;
+    std::string module_prefix;
+    SymbolSet typevector_structs;
+
+    std::vector<const Import*> unique_imports;
+    SymbolSet import_module_set;       // modules that are imported from
+    SymbolSet import_func_module_set;  // modules that funcs are imported from
+    SymbolMap import_func_module_map;  // mapping between imported functions
+                                       // and their modules
+
+    std::vector<std::string> unique_func_type_names;
+
+    // The contents of every funcref table that cannot change after
+    // instantiation, as a map from slot to function; null slots are omitted.
+    std::map<const Table*, std::map<Index, const Func*>> static_tables;
+
+    std::function<std::vector<size_t>(std::vector<Func*>::const_iterator,
+                                      std::vector<Func*>::const_iterator,
+                                      size_t,
+                                      size_t)>
+        name_to_output_file_index;
+
+    bool simd_used_in_header = false;
+  };
+
+  // Creates a writer for function bodies, which only reads `state`.
+  explicit CWriter(const ModuleState& state) : state_(state) {}
   using StackTypePair = std::pair<Index, Type>;
   using StackVarSymbolMap = std::map<StackTypePair, std::string>;
 
@@ -392,6 +446,13 @@ class CWriter {
   void WriteCallIndirectFuncDeclaration(const FuncDeclaration&,
                                         const std::string&);
   void ComputeSimdScope();
+  void ComputeStaticTables();
+  bool GetStaticCallTargets(const Table*,
+                            const FuncType*,
+                            StaticCallTargets*) const;
+  void WriteStaticCallIndirect(const FuncDeclaration&,
+                               const StaticCallTargets&);
+  void WriteDirectCallee(const Func&);
   void WriteHeaderIncludes();
   void WriteV128Decl();
   void WriteModuleInstance();
@@ -410,6 +471,12 @@ class CWriter {
   void WriteGlobalInitializers();
   void WriteDataInitializerDecls();
   void WriteDataInitializers();
+  bool CanLoadMemoryImages() const;
+  void WriteMemoryImageDecls();
+  void WriteMemoryImageLoads();
+  std::string DataFileSymbolName() const;
+  void WriteDataFileDecls();
+  void WriteDataFile();
   void WriteElemInitializerDecls();
   void WriteElemInitializers();
   void WriteFuncRefWrappers();
@@ -431,6 +498,7 @@ class CWriter {
   void WriteInitInstanceImport();
   void WriteImportProperties(CWriterPhase);
   void WriteFuncs();
+  void WriteFuncs(const std::vector<const Func*>&, Stream*);
   void BeginFunction(const Func&);
   void FinishFunction(size_t);
   void Write(const Func&);
@@ -491,6 +559,8 @@ class CWriter {
   void Write(const AtomicStoreExpr& expr);
   void Write(const AtomicRmwExpr& expr);
   void Write(const AtomicRmwCmpxchgExpr& expr);
+  void Write(const AtomicWaitExpr& expr);
+  void Write(const AtomicNotifyExpr& expr);
 
   size_t BeginTry(const Block& block);
   void WriteTryCatch(const TryExpr& tryexpr);
@@ -507,52 +577,28 @@ class CWriter {
 
   bool IsImport(const std::string& name) const;
 
-  const WriteCOptions& options_;
-  const Module* module_ = nullptr;
+  // Null in a writer for function bodies.
+  std::unique_ptr<ModuleState> owned_state_;
+  const ModuleState& state_;
+
   const Func* func_ = nullptr;
   Stream* stream_ = nullptr;
-  std::vector<Stream*> c_streams_;
-  Stream* h_stream_ = nullptr;
-  Stream* h_impl_stream_ = nullptr;
-  std::string header_name_;
-  std::string header_impl_name_;
   Result result_ = Result::Ok;
   int indent_ = 0;
   bool should_write_indent_next_ = false;
   int consecutive_newline_count_ = 0;
 
-  SymbolMap global_sym_map_;
   SymbolMap local_sym_map_;
-  SymbolMap import_module_sym_map_;
   StackVarSymbolMap stack_var_sym_map_;
-  SymbolSet global_syms_;
   SymbolSet local_syms_;
   TypeVector type_stack_;
   std::vector<Label> label_stack_;
   std::vector<TryCatchLabel> try_catch_stack_;
-  std::string module_prefix_;
-  SymbolSet typevector_structs_;
-
-  std::vector<const Import*> unique_imports_;
-  SymbolSet import_module_set_;       // modules that are imported from
-  SymbolSet import_func_module_set_;  // modules that funcs are imported from
-  SymbolMap import_func_module_map_;  // mapping between imported functions and
-                                      // their modules
 
   std::vector<std::pair<std::string, MemoryStream>> func_sections_;
   SymbolSet func_includes_;
 
-  std::vector<std::string> unique_func_type_names_;
-
-  std::function<std::vector<size_t>(std::vector<Func*>::const_iterator,
-                                    std::vector<Func*>::const_iterator,
-                                    size_t,
-                                    size_t)>
-      name_to_output_file_index_;
-
-  bool simd_used_in_header_;
-
-  bool in_tail_callee_;
+  bool in_tail_callee_ = false;
 };
 
 // TODO: if WABT begins supporting debug names for labels,
@@ -714,7 +760,8 @@ std::string CWriter::MangleTypes(const TypeVector& types) {
 
 /* The C symbol for an export from this module. */
 std::string CWriter::ExportName(std::string_view export_name) const {
-  return kGlobalSymbolPrefix + module_prefix_ + '_' + MangleName(export_name);
+  return kGlobalSymbolPrefix + state_.module_prefix + '_' +
+         MangleName(export_name);
 }
 
 /* The C symbol for an export from an arbitrary module. */
@@ -739,7 +786,7 @@ std::string CWriter::TailCallExportName(std::string_view module_name,
 
 /* The type name of an instance of this module. */
 std::string CWriter::ModuleInstanceTypeName() const {
-  return kGlobalSymbolPrefix + module_prefix_;
+  return kGlobalSymbolPrefix + state_.module_prefix;
 }
 
 /* The type name of an instance of an arbitrary module. */
@@ -997,11 +1044,12 @@ void CWriter::DefineImportName(const Import* import,
       break;
   }
 
-  import_module_sym_map_.emplace(name, import->module_name);
+  owned_state_->import_module_sym_map.emplace(name, import->module_name);
 
   const std::string mangled = ExportName(module, field_name);
-  global_syms_.erase(mangled);  // duplicate imports are allowed
-  ClaimName(global_syms_, global_sym_map_, MangleField(type), name, mangled);
+  owned_state_->global_syms.erase(mangled);  // duplicate imports are allowed
+  ClaimName(owned_state_->global_syms, owned_state_->global_sym_map,
+            MangleField(type), name, mangled);
 }
 
 /*
@@ -1011,8 +1059,8 @@ void CWriter::DefineImportName(const Import* import,
  * other names from shadowing/overlapping the exports.
  */
 void CWriter::ReserveExportName(std::string_view name) {
-  ClaimName(global_syms_, global_sym_map_, MangleField(ModuleFieldType::Export),
-            name, ExportName(name));
+  ClaimName(owned_state_->global_syms, owned_state_->global_sym_map,
+            MangleField(ModuleFieldType::Export), name, ExportName(name));
 }
 
 /*
@@ -1022,15 +1070,16 @@ void CWriter::ReserveExportName(std::string_view name) {
  */
 std::string CWriter::DefineGlobalScopeName(ModuleFieldType type,
                                            std::string_view name) {
-  return ClaimUniqueName(global_syms_, global_sym_map_, MangleField(type), name,
+  return ClaimUniqueName(owned_state_->global_syms,
+                         owned_state_->global_sym_map, MangleField(type), name,
                          ExportName(StripLeadingDollar(name)));
 }
 
 std::string CWriter::GetGlobalName(ModuleFieldType type,
                                    const std::string& name) const {
   std::string mangled = name + MangleField(type);
-  assert(global_sym_map_.contains(mangled));
-  return global_sym_map_.at(mangled);
+  assert(state_.global_sym_map.contains(mangled));
+  return state_.global_sym_map.at(mangled);
 }
 
 /* Names for params, locals, and stack vars are formatted as "var_" + name. */
@@ -1079,7 +1128,8 @@ std::string CWriter::DefineStackVarName(Index index,
 std::string CWriter::DefineInstanceMemberName(ModuleFieldType type,
                                               std::string_view name) {
   return ClaimUniqueName(
-      global_syms_, global_sym_map_, MangleField(type), name,
+      owned_state_->global_syms, owned_state_->global_sym_map,
+      MangleField(type), name,
       kGlobalSymbolPrefix + MangleName(StripLeadingDollar(name)));
 }
 
@@ -1089,7 +1139,8 @@ std::string CWriter::DefineInstanceMemberName(ModuleFieldType type,
  * module prefix + "_instance".
  */
 std::string CWriter::DefineImportedModuleInstanceName(std::string_view name) {
-  return ClaimUniqueName(global_syms_, global_sym_map_,
+  return ClaimUniqueName(owned_state_->global_syms,
+                         owned_state_->global_sym_map,
                          MangleField(ModuleFieldType::Import), name,
                          ExportName(name, "instance"));
 }
@@ -1419,21 +1470,21 @@ void CWriter::Write(const Const& const_) {
 }
 
 void CWriter::WriteInitDecl() {
-  Write("void ", kAdminSymbolPrefix, module_prefix_, "_instantiate(",
+  Write("void ", kAdminSymbolPrefix, state_.module_prefix, "_instantiate(",
         ModuleInstanceTypeName(), "*");
-  for (const auto& import_module_name : import_module_set_) {
+  for (const auto& import_module_name : state_.import_module_set) {
     Write(", struct ", ModuleInstanceTypeName(import_module_name), "*");
   }
   Write(");", Newline());
 }
 
 void CWriter::WriteFreeDecl() {
-  Write("void ", kAdminSymbolPrefix, module_prefix_, "_free(",
+  Write("void ", kAdminSymbolPrefix, state_.module_prefix, "_free(",
         ModuleInstanceTypeName(), "*);", Newline());
 }
 
 void CWriter::WriteGetFuncTypeDecl() {
-  Write("wasm_rt_func_type_t ", kAdminSymbolPrefix, module_prefix_,
+  Write("wasm_rt_func_type_t ", kAdminSymbolPrefix, state_.module_prefix,
         "_get_func_type(uint32_t param_count, uint32_t result_count, ...);",
         Newline());
 }
@@ -1545,15 +1596,15 @@ void CWriter::WriteInitExprTerminal(const Expr* expr) {
       break;
 
     case ExprType::RefFunc: {
-      const Func* func = module_->GetFunc(cast<RefFuncExpr>(expr)->var);
+      const Func* func = state_.module->GetFunc(cast<RefFuncExpr>(expr)->var);
       const FuncDeclaration& decl = func->decl;
 
       assert(decl.has_func_type);
-      const FuncType* func_type = module_->GetFuncType(decl.type_var);
+      const FuncType* func_type = state_.module->GetFuncType(decl.type_var);
 
       Write("(wasm_rt_funcref_t){", FuncTypeExpr(func_type), ", ",
             "(wasm_rt_function_ptr_t)", WrapperRef(func->name), ", {");
-      if (options_.features.tail_call_enabled() &&
+      if (state_.options.features.tail_call_enabled() &&
           (IsImport(func->name) || func->features_used.tailcall)) {
         Write(TailCallRef(func->name));
       } else {
@@ -1562,8 +1613,9 @@ void CWriter::WriteInitExprTerminal(const Expr* expr) {
       Write("}, ");
 
       if (IsImport(func->name)) {
-        Write("instance->", GlobalName(ModuleFieldType::Import,
-                                       import_module_sym_map_[func->name]));
+        Write("instance->",
+              GlobalName(ModuleFieldType::Import,
+                         state_.import_module_sym_map.at(func->name)));
       } else {
         Write("instance");
       }
@@ -1581,7 +1633,7 @@ void CWriter::WriteInitExprTerminal(const Expr* expr) {
 
 std::string CWriter::GenerateHeaderGuard() const {
   std::string result;
-  for (char c : header_name_) {
+  for (char c : state_.header_name) {
     if (internal_isalnum(c) || c == '_') {
       result += internal_toupper(c);
     } else {
@@ -1594,7 +1646,7 @@ std::string CWriter::GenerateHeaderGuard() const {
 
 void CWriter::WriteSourceTop() {
   Write(s_source_includes);
-  Write(Newline(), "#include \"", header_name_, "\"", Newline());
+  Write(Newline(), "#include \"", state_.header_name, "\"", Newline());
 
   if (IsSingleUnsharedDefault32Memory()) {
     Write("#define IS_SINGLE_UNSHARED_DEFAULT32_MEMORY 1", Newline());
@@ -1602,28 +1654,28 @@ void CWriter::WriteSourceTop() {
 
   Write(s_source_declarations, Newline());
 
-  if (module_->features_used.simd) {
-    if (!simd_used_in_header_) {
+  if (state_.module->features_used.simd) {
+    if (!state_.simd_used_in_header) {
       WriteV128Decl();
     }
     Write(s_simd_source_declarations);
   }
 
-  if (module_->features_used.threads) {
+  if (state_.module->features_used.threads) {
     Write(s_atomicops_source_declarations);
   }
 }
 
 void CWriter::WriteMultiCTop() {
-  if (c_streams_.size() > 1) {
-    assert(header_impl_name_.size() > 0);
+  if (state_.c_streams.size() > 1) {
+    assert(state_.header_impl_name.size() > 0);
     Write("/* Automatically generated by wasm2c */", Newline());
-    Write("#include \"", header_impl_name_, "\"", Newline());
+    Write("#include \"", state_.header_impl_name, "\"", Newline());
   }
 }
 
 void CWriter::WriteMultiCTopEmpty() {
-  for (auto& stream : c_streams_) {
+  for (auto& stream : state_.c_streams) {
     if (stream->offset() == 0) {
       stream_ = stream;
       Write("/* Empty wasm2c generated file */\n");
@@ -1634,7 +1686,7 @@ void CWriter::WriteMultiCTopEmpty() {
 
 void CWriter::DeclareStruct(const TypeVector& types) {
   const std::string name = MangleTypes(types);
-  if (!typevector_structs_.insert(name).second) {
+  if (!owned_state_->typevector_structs.insert(name).second) {
     return;
   }
 
@@ -1658,7 +1710,7 @@ void CWriter::WriteTailcalleeParamTypes() {
   // interface, in case the exporting module doesn't generate one itself), and
   // for any type entry referenced in a return_call_indirect instruction.
 
-  for (const Func* func : module_->funcs) {
+  for (const Func* func : state_.module->funcs) {
     if (IsImport(func->name) || func->features_used.tailcall) {
       if (func->decl.sig.GetNumParams() > 1) {
         DeclareStruct(func->decl.sig.param_types);
@@ -1666,7 +1718,7 @@ void CWriter::WriteTailcalleeParamTypes() {
     }
   }
 
-  for (TypeEntry* type : module_->types) {
+  for (TypeEntry* type : state_.module->types) {
     FuncType* func_type = cast<FuncType>(type);
     if (func_type->GetNumParams() > 1 && func_type->features_used.tailcall) {
       DeclareStruct(func_type->sig.param_types);
@@ -1675,7 +1727,7 @@ void CWriter::WriteTailcalleeParamTypes() {
 }
 
 void CWriter::WriteMultivalueResultTypes() {
-  for (TypeEntry* type : module_->types) {
+  for (TypeEntry* type : state_.module->types) {
     FuncType* func_type = cast<FuncType>(type);
     if (func_type->GetNumResults() > 1) {
       DeclareStruct(func_type->sig.result_types);
@@ -1684,7 +1736,7 @@ void CWriter::WriteMultivalueResultTypes() {
 }
 
 void CWriter::WriteTagTypes() {
-  for (const Tag* tag : module_->tags) {
+  for (const Tag* tag : state_.module->tags) {
     const FuncDeclaration& tag_type = tag->decl;
     Index num_params = tag_type.GetNumParams();
     if (num_params <= 1) {
@@ -1695,61 +1747,74 @@ void CWriter::WriteTagTypes() {
 }
 
 void CWriter::WriteFuncTypeDecls() {
-  if (module_->types.empty()) {
+  if (state_.module->types.empty()) {
     return;
   }
 
   Write(Newline());
 
   std::string serialized_type;
-  for (const TypeEntry* type : module_->types) {
+  for (const TypeEntry* type : state_.module->types) {
     const std::string name =
         DefineGlobalScopeName(ModuleFieldType::Type, type->name);
 
-    if (c_streams_.size() > 1) {
+    if (state_.c_streams.size() > 1) {
       Write("FUNC_TYPE_DECL_EXTERN_T(", name, ");", Newline());
     }
   }
 }
 
 void CWriter::WriteFuncTypes() {
-  if (module_->types.empty()) {
+  if (state_.module->types.empty()) {
     return;
   }
 
   Write(Newline());
 
   std::unordered_map<std::string, std::string> type_hash;
+  std::vector<std::pair<std::string, std::string>> serialized_types;
 
   std::string serialized_type;
-  for (const TypeEntry* type : module_->types) {
+  for (const TypeEntry* type : state_.module->types) {
     const std::string name = GetGlobalName(ModuleFieldType::Type, type->name);
     SerializeFuncType(*cast<FuncType>(type), serialized_type);
 
     auto prior_type = type_hash.find(serialized_type);
     if (prior_type != type_hash.end()) {
       /* duplicate function type */
-      unique_func_type_names_.push_back(prior_type->second);
+      owned_state_->unique_func_type_names.push_back(prior_type->second);
     } else {
-      unique_func_type_names_.push_back(name);
+      owned_state_->unique_func_type_names.push_back(name);
       type_hash.emplace(serialized_type, name);
-      if (c_streams_.size() > 1) {
+      if (state_.c_streams.size() > 1) {
         Write("FUNC_TYPE_EXTERN_T(");
       } else {
         Write("FUNC_TYPE_T(");
       }
-      Write(name, ") = \"");
-      for (uint8_t x : serialized_type) {
-        Writef("\\x%02x", x);
-      }
-      Write("\";", Newline());
+      Write(name, ");", Newline());
+      serialized_types.emplace_back(name, serialized_type);
+    }
+  }
+
+  Write(Newline(), "static void init_func_types(void) ", OpenBrace());
+  Write("static bool interned;", Newline());
+  Write("static const wasm_rt_func_type_init_t types[] = ", OpenBrace());
+  for (const auto& [name, serialized] : serialized_types) {
+    Write("{&", name, ", \"");
+    for (uint8_t x : serialized) {
+      Writef("\\x%02x", x);
     }
+    Write("\"},", Newline());
   }
+  Write(CloseBrace(), ";", Newline());
+  Write("wasm_rt_intern_func_types(&interned, types, ", serialized_types.size(),
+        ");", Newline());
+  Write(CloseBrace(), Newline());
 }
 
 void CWriter::Write(const FuncTypeExpr& expr) {
-  Index func_type_index = module_->GetFuncTypeIndex(expr.func_type->sig);
-  Write(unique_func_type_names_.at(func_type_index));
+  Index func_type_index = state_.module->GetFuncTypeIndex(expr.func_type->sig);
+  Write(state_.unique_func_type_names.at(func_type_index));
 }
 
 // static
@@ -1781,17 +1846,17 @@ void CWriter::SerializeFuncType(const FuncType& func_type,
 
 void CWriter::WriteTagDecls() {
   Index tag_index = 0;
-  for (const Tag* tag : module_->tags) {
-    bool is_import = tag_index < module_->num_tag_imports;
+  for (const Tag* tag : state_.module->tags) {
+    bool is_import = tag_index < state_.module->num_tag_imports;
     if (!is_import) {
       // Tags are identified and compared solely by their (unique) address.
       // The data stored in this variable is never read.
-      if (tag_index == module_->num_tag_imports) {
+      if (tag_index == state_.module->num_tag_imports) {
         Write(Newline());
         Write("typedef char wasm_tag_placeholder_t;", Newline());
       }
       DefineGlobalScopeName(ModuleFieldType::Tag, tag->name);
-      if (c_streams_.size() > 1) {
+      if (state_.c_streams.size() > 1) {
         Write("extern const wasm_tag_placeholder_t ",
               GlobalName(ModuleFieldType::Tag, tag->name), ";", Newline());
       }
@@ -1803,8 +1868,8 @@ void CWriter::WriteTagDecls() {
 void CWriter::WriteTags() {
   Write(Newline());
   Index tag_index = 0;
-  for (const Tag* tag : module_->tags) {
-    bool is_import = tag_index < module_->num_tag_imports;
+  for (const Tag* tag : state_.module->tags) {
+    bool is_import = tag_index < state_.module->num_tag_imports;
     if (!is_import) {
       Write(InternalSymbolScope(), "const wasm_tag_placeholder_t ",
             GlobalName(ModuleFieldType::Tag, tag->name), ";", Newline());
@@ -1816,7 +1881,7 @@ void CWriter::WriteTags() {
 Result CWriter::ComputeUniqueImports() {
   using modname_name_pair = std::pair<std::string, std::string>;
   std::map<modname_name_pair, const Import*> import_map;
-  for (const Import* import : module_->imports) {
+  for (const Import* import : state_.module->imports) {
     // After emplacing, the returned bool says whether the insert happened;
     // i.e., was there already an import with the same modname and name?
     // If there was, make sure it was at least the same kind of import.
@@ -1836,22 +1901,22 @@ Result CWriter::ComputeUniqueImports() {
                 import->module_name.c_str(), import->field_name.c_str());
       }
     }
-    import_module_set_.insert(import->module_name);
+    owned_state_->import_module_set.insert(import->module_name);
     if (import->kind() == ExternalKind::Func) {
-      import_func_module_set_.insert(import->module_name);
-      import_func_module_map_.emplace(cast<FuncImport>(import)->func.name,
-                                      import->module_name);
+      owned_state_->import_func_module_set.insert(import->module_name);
+      owned_state_->import_func_module_map.emplace(
+          cast<FuncImport>(import)->func.name, import->module_name);
     }
   }
 
   for (const auto& node : import_map) {
-    unique_imports_.push_back(node.second);
+    owned_state_->unique_imports.push_back(node.second);
   }
   return Result::Ok;
 }
 
 void CWriter::BeginInstance() {
-  if (module_->imports.empty()) {
+  if (state_.module->imports.empty()) {
     Write("typedef struct ", ModuleInstanceTypeName(), " ", OpenBrace());
     return;
   }
@@ -1862,18 +1927,18 @@ void CWriter::BeginInstance() {
   }
 
   // define names of per-instance imports
-  for (const Import* import : module_->imports) {
+  for (const Import* import : state_.module->imports) {
     DefineImportName(import, import->module_name, import->field_name);
   }
 
   // Forward declaring module instance types
-  for (const auto& import_module : import_module_set_) {
+  for (const auto& import_module : state_.import_module_set) {
     DefineImportedModuleInstanceName(import_module);
     Write("struct ", ModuleInstanceTypeName(import_module), ";", Newline());
   }
 
   // Forward declaring module imports
-  for (const Import* import : unique_imports_) {
+  for (const Import* import : state_.unique_imports) {
     if ((import->kind() == ExternalKind::Func) ||
         (import->kind() == ExternalKind::Tag)) {
       continue;
@@ -1908,12 +1973,12 @@ void CWriter::BeginInstance() {
   // so that imported functions can be given their own module instances
   // when invoked
   Write("typedef struct ", ModuleInstanceTypeName(), " ", OpenBrace());
-  for (const auto& import_module : import_func_module_set_) {
+  for (const auto& import_module : state_.import_func_module_set) {
     Write("struct ", ModuleInstanceTypeName(import_module), "* ",
           GlobalName(ModuleFieldType::Import, import_module), ";", Newline());
   }
 
-  for (const Import* import : unique_imports_) {
+  for (const Import* import : state_.unique_imports) {
     if ((import->kind() == ExternalKind::Func) ||
         (import->kind() == ExternalKind::Tag)) {
       continue;
@@ -1952,12 +2017,12 @@ void CWriter::BeginInstance() {
 
 // Write module-wide imports (funcs & tags), which aren't tied to an instance.
 void CWriter::WriteImports() {
-  if (unique_imports_.empty())
+  if (state_.unique_imports.empty())
     return;
 
   Write(Newline());
 
-  for (const Import* import : unique_imports_) {
+  for (const Import* import : state_.unique_imports) {
     if (import->kind() == ExternalKind::Func) {
       Write(Newline(), "/* import: '", SanitizeForComment(import->module_name),
             "' '", SanitizeForComment(import->field_name), "' */", Newline());
@@ -1966,7 +2031,7 @@ void CWriter::WriteImports() {
           func.decl, import->module_name,
           ExportName(import->module_name, import->field_name));
       Write(";", Newline());
-      if (options_.features.tail_call_enabled()) {
+      if (state_.options.features.tail_call_enabled()) {
         WriteTailCallFuncDeclaration(GetTailCallRef(func.name));
         Write(";", Newline());
       }
@@ -1981,7 +2046,7 @@ void CWriter::WriteImports() {
 }
 
 void CWriter::WriteTailCallWeakImports() {
-  for (const Import* import : unique_imports_) {
+  for (const Import* import : state_.unique_imports) {
     if (import->kind() != ExternalKind::Func) {
       continue;
     }
@@ -1991,7 +2056,7 @@ void CWriter::WriteTailCallWeakImports() {
           SanitizeForComment(import->field_name), "' */", Newline());
     Write("WEAK_FUNC_DECL(",
           TailCallExportName(import->module_name, import->field_name), ", ",
-          kTailCallFallbackPrefix, module_prefix_, "_",
+          kTailCallFallbackPrefix, state_.module_prefix, "_",
           ExportName(import->module_name, import->field_name), ")", Newline());
     Write(OpenBrace(), "next->fn = NULL;", Newline());
 
@@ -2030,14 +2095,14 @@ void CWriter::WriteTailCallWeakImports() {
 }
 
 void CWriter::WriteFuncDeclarations() {
-  if (module_->funcs.size() == module_->num_func_imports)
+  if (state_.module->funcs.size() == state_.module->num_func_imports)
     return;
 
   Write(Newline());
 
   Index func_index = 0;
-  for (const Func* func : module_->funcs) {
-    bool is_import = func_index < module_->num_func_imports;
+  for (const Func* func : state_.module->funcs) {
+    bool is_import = func_index < state_.module->num_func_imports;
     if (!is_import) {
       Write(InternalSymbolScope());
       WriteFuncDeclaration(
@@ -2092,30 +2157,85 @@ static bool func_uses_simd(const FuncSignature& sig) {
 }
 
 void CWriter::ComputeSimdScope() {
-  simd_used_in_header_ =
-      module_->features_used.simd &&
-      (std::any_of(module_->globals.begin(), module_->globals.end(),
+  owned_state_->simd_used_in_header =
+      state_.module->features_used.simd &&
+      (std::any_of(state_.module->globals.begin(), state_.module->globals.end(),
                    [](const auto& x) { return x->type == Type::V128; }) ||
-       std::any_of(module_->imports.begin(), module_->imports.end(),
+       std::any_of(state_.module->imports.begin(), state_.module->imports.end(),
                    [](const auto& x) {
                      return x->kind() == ExternalKind::Func &&
                             func_uses_simd(cast<FuncImport>(x)->func.decl.sig);
                    }) ||
-       std::any_of(module_->exports.begin(), module_->exports.end(),
+       std::any_of(state_.module->exports.begin(), state_.module->exports.end(),
                    [&](const auto& x) {
                      return x->kind == ExternalKind::Func &&
-                            func_uses_simd(module_->GetFunc(x->var)->decl.sig);
+                            func_uses_simd(
+                                state_.module->GetFunc(x->var)->decl.sig);
+
                    }));
 }
 
+// Writes a call_indirect through a static table as a switch over the index,
+// with a direct call for each slot of the right type. Every other index is
+// out of bounds, null or of the wrong type, so it traps.
+void CWriter::WriteStaticCallIndirect(const FuncDeclaration& decl,
+                                      const StaticCallTargets& targets) {
+  Index num_params = decl.GetNumParams();
+  Index num_results = decl.GetNumResults();
+  if (num_results > 1) {
+    Write(OpenBrace(), decl.sig.result_types, " tmp;", Newline());
+  }
+  Write("switch (", StackVar(0), ") ", OpenBrace());
+  for (const auto& [func, slots] : targets) {
+    for (Index slot : slots) {
+      Write("case ", slot, ":", Newline());
+    }
+    Indent();
+    if (num_results > 1) {
+      Write("tmp = ");
+    } else if (num_results == 1) {
+      Write(StackVar(num_params, decl.GetResultType(0)), " = ");
+    }
+    WriteDirectCallee(*func);
+    for (Index i = 0; i < num_params; ++i) {
+      Write(", ", StackVar(num_params - i));
+    }
+    Write(");", Newline(), "break;", Newline());
+    Dedent();
+  }
+  Write("default:", Newline());
+  Indent();
+  Write("TRAP(CALL_INDIRECT);", Newline());
+  Dedent();
+  Write(CloseBrace(), Newline());
+  RefreshLocalMemorySize();
+  DropTypes(num_params + 1);
+  PushTypes(decl.sig.result_types);
+  if (num_results > 1) {
+    Unspill(decl.sig.result_types);
+    Write(CloseBrace(), Newline());
+  }
+}
+
+// Writes the start of a direct call to func, up to its instance argument.
+void CWriter::WriteDirectCallee(const Func& func) {
+  Write(ExternalRef(ModuleFieldType::Func, func.name), "(");
+  if (IsImport(func.name)) {
+    Write("instance->", GlobalName(ModuleFieldType::Import,
+                                   state_.import_module_sym_map.at(func.name)));
+  } else {
+    Write("instance");
+  }
+}
+
 void CWriter::WriteHeaderIncludes() {
   Write("#include \"wasm-rt.h\"", Newline());
 
-  if (module_->features_used.exceptions) {
+  if (state_.module->features_used.exceptions) {
     Write("#include \"wasm-rt-exceptions.h\"", Newline(), Newline());
   }
 
-  if (simd_used_in_header_) {
+  if (state_.simd_used_in_header) {
     WriteV128Decl();
   }
 
@@ -2142,8 +2262,8 @@ void CWriter::WriteModuleInstance() {
   WriteElemInstances();
 
   // C forbids an empty struct
-  if (module_->globals.empty() && module_->memories.empty() &&
-      module_->tables.empty() && import_func_module_set_.empty()) {
+  if (state_.module->globals.empty() && state_.module->memories.empty() &&
+      state_.module->tables.empty() && state_.import_func_module_set.empty()) {
     Write("char dummy_member;", Newline());
   }
 
@@ -2153,9 +2273,9 @@ void CWriter::WriteModuleInstance() {
 
 void CWriter::WriteGlobals() {
   Index global_index = 0;
-  if (module_->globals.size() != module_->num_global_imports) {
-    for (const Global* global : module_->globals) {
-      bool is_import = global_index < module_->num_global_imports;
+  if (state_.module->globals.size() != state_.module->num_global_imports) {
+    for (const Global* global : state_.module->globals) {
+      bool is_import = global_index < state_.module->num_global_imports;
       if (!is_import) {
         WriteGlobal(*global, DefineInstanceMemberName(ModuleFieldType::Global,
                                                       global->name));
@@ -2175,12 +2295,12 @@ void CWriter::WriteGlobalPtr(const Global& global, const std::string& name) {
 }
 
 void CWriter::WriteMemories() {
-  if (module_->memories.size() == module_->num_memory_imports)
+  if (state_.module->memories.size() == state_.module->num_memory_imports)
     return;
 
   Index memory_index = 0;
-  for (const Memory* memory : module_->memories) {
-    bool is_import = memory_index < module_->num_memory_imports;
+  for (const Memory* memory : state_.module->memories) {
+    bool is_import = memory_index < state_.module->num_memory_imports;
     if (!is_import) {
       WriteMemory(
           DefineInstanceMemberName(ModuleFieldType::Memory, memory->name),
@@ -2201,13 +2321,13 @@ void CWriter::WriteMemoryPtr(const std::string& name, const Memory& memory) {
 }
 
 void CWriter::WriteTables() {
-  if (module_->tables.size() == module_->num_table_imports) {
+  if (state_.module->tables.size() == state_.module->num_table_imports) {
     return;
   }
 
   Index table_index = 0;
-  for (const Table* table : module_->tables) {
-    bool is_import = table_index < module_->num_table_imports;
+  for (const Table* table : state_.module->tables) {
+    bool is_import = table_index < state_.module->num_table_imports;
     if (!is_import) {
       WriteTable(DefineInstanceMemberName(ModuleFieldType::Table, table->name),
                  table->elem_type);
@@ -2232,14 +2352,14 @@ void CWriter::WriteTableType(const wabt::Type& type) {
 }
 
 void CWriter::WriteGlobalInitializers() {
-  if (module_->globals.empty())
+  if (state_.module->globals.empty())
     return;
 
   Write(Newline(), "static void init_globals(", ModuleInstanceTypeName(),
         "* instance) ", OpenBrace());
   Index global_index = 0;
-  for (const Global* global : module_->globals) {
-    bool is_import = global_index < module_->num_global_imports;
+  for (const Global* global : state_.module->globals) {
+    bool is_import = global_index < state_.module->num_global_imports;
     if (!is_import) {
       assert(!global->init_expr.empty());
       Write(ExternalInstanceRef(ModuleFieldType::Global, global->name), " = ");
@@ -2256,13 +2376,191 @@ static inline bool is_droppable(const DataSegment* data_segment) {
          (!data_segment->data.empty());
 }
 
+static bool get_const_offset(const ExprList& offset, uint64_t* out) {
+  if (offset.size() != 1 || offset.front().type() != ExprType::Const) {
+    return false;
+  }
+  const Const& const_ = cast<ConstExpr>(&offset.front())->const_;
+  *out = const_.type() == Type::I64 ? const_.u64() : const_.u32();
+  return true;
+}
+
+// The non-empty active data segments of the memory at memory_index, in order.
+static std::vector<const DataSegment*> get_active_data_segments(
+    const Module* module,
+    Index memory_index) {
+  std::vector<const DataSegment*> segments;
+  for (const DataSegment* data_segment : module->data_segments) {
+    if (data_segment->kind == SegmentKind::Active &&
+        !data_segment->data.empty() &&
+        module->GetMemoryIndex(data_segment->memory_var) == memory_index) {
+      segments.push_back(data_segment);
+    }
+  }
+  return segments;
+}
+
+// Marks every table that an instruction in exprs can write to.
+static void find_written_tables(const Module* module,
+                                const ExprList& exprs,
+                                std::vector<bool>* written) {
+  for (const Expr& expr : exprs) {
+    switch (expr.type()) {
+      case ExprType::Block:
+        find_written_tables(module, cast<BlockExpr>(&expr)->block.exprs,
+                            written);
+        break;
+      case ExprType::Loop:
+        find_written_tables(module, cast<LoopExpr>(&expr)->block.exprs,
+                            written);
+        break;
+      case ExprType::If:
+        find_written_tables(module, cast<IfExpr>(&expr)->true_.exprs, written);
+        find_written_tables(module, cast<IfExpr>(&expr)->false_, written);
+        break;
+      case ExprType::Try: {
+        const auto* try_ = cast<TryExpr>(&expr);
+        find_written_tables(module, try_->block.exprs, written);
+        for (const Catch& catch_ : try_->catches) {
+          find_written_tables(module, catch_.exprs, written);
+        }
+        break;
+      }
+      case ExprType::TryTable:
+        find_written_tables(module, cast<TryTableExpr>(&expr)->block.exprs,
+                            written);
+        break;
+      case ExprType::TableSet:
+        (*written)[module->GetTableIndex(cast<TableSetExpr>(&expr)->var)] =
+            true;
+        break;
+      case ExprType::TableGrow:
+        (*written)[module->GetTableIndex(cast<TableGrowExpr>(&expr)->var)] =
+            true;
+        break;
+      case ExprType::TableFill:
+        (*written)[module->GetTableIndex(cast<TableFillExpr>(&expr)->var)] =
+            true;
+        break;
+      case ExprType::TableCopy:
+        (*written)[module->GetTableIndex(
+            cast<TableCopyExpr>(&expr)->dst_table)] = true;
+        break;
+      case ExprType::TableInit:
+        (*written)[module->GetTableIndex(
+            cast<TableInitExpr>(&expr)->table_index)] = true;
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+// A funcref table that is defined by the module, not exported, and never
+// written by an instruction only ever holds what its active element segments
+// put there, so a call_indirect through it can dispatch to direct calls.
+void CWriter::ComputeStaticTables() {
+  owned_state_->static_tables.clear();
+
+  std::vector<bool> excluded(state_.module->tables.size());
+  for (Index i = 0; i < state_.module->tables.size(); ++i) {
+    const Table* table = state_.module->tables[i];
+    excluded[i] = i < state_.module->num_table_imports ||
+                  table->elem_type != Type::FuncRef ||
+                  !(table->init_expr.empty() ||
+                    (table->init_expr.size() == 1 &&
+                     table->init_expr.front().type() == ExprType::RefNull));
+  }
+  for (const Export* export_ : state_.module->exports) {
+    if (export_->kind == ExternalKind::Table) {
+      excluded[state_.module->GetTableIndex(export_->var)] = true;
+    }
+  }
+  for (Index i = state_.module->num_func_imports;
+       i < state_.module->funcs.size(); ++i) {
+    find_written_tables(state_.module, state_.module->funcs[i]->exprs,
+                        &excluded);
+  }
+
+  std::vector<std::map<Index, const Func*>> slots(state_.module->tables.size());
+  for (const ElemSegment* elem_segment : state_.module->elem_segments) {
+    if (elem_segment->kind != SegmentKind::Active) {
+      continue;
+    }
+    Index table_index = state_.module->GetTableIndex(elem_segment->table_var);
+    if (excluded[table_index]) {
+      continue;
+    }
+    // Instantiation traps partway through an out-of-bounds segment, so only
+    // tables whose segments all fit are treated as static.
+    uint64_t offset;
+    if (!get_const_offset(elem_segment->offset, &offset) ||
+        offset + elem_segment->elem_exprs.size() >
+            state_.module->tables[table_index]->elem_limits.initial) {
+      excluded[table_index] = true;
+      continue;
+    }
+    for (const ExprList& elem_expr : elem_segment->elem_exprs) {
+      Index slot = static_cast<Index>(offset++);
+      if (elem_expr.size() == 1 &&
+          elem_expr.front().type() == ExprType::RefFunc) {
+        slots[table_index][slot] =
+            state_.module->GetFunc(cast<RefFuncExpr>(&elem_expr.front())->var);
+      } else if (elem_expr.size() == 1 &&
+                 elem_expr.front().type() == ExprType::RefNull) {
+        slots[table_index].erase(slot);
+      } else {
+        excluded[table_index] = true;
+        break;
+      }
+    }
+  }
+
+  for (Index i = 0; i < state_.module->tables.size(); ++i) {
+    if (!excluded[i]) {
+      owned_state_->static_tables[state_.module->tables[i]] =
+          std::move(slots[i]);
+    }
+  }
+}
+
+// Beyond this many slots of the right type, a call_indirect through a static
+// table is left to the CALL_INDIRECT macro rather than grown into a switch.
+static constexpr size_t kMaxStaticCallSlots = 16;
+
+bool CWriter::GetStaticCallTargets(const Table* table,
+                                   const FuncType* func_type,
+                                   StaticCallTargets* targets) const {
+  auto iter = state_.static_tables.find(table);
+  if (iter == state_.static_tables.end()) {
+    return false;
+  }
+
+  size_t num_slots = 0;
+  std::map<const Func*, size_t> target_index;
+  for (const auto& [slot, func] : iter->second) {
+    if (!(func->decl.sig == func_type->sig)) {
+      continue;
+    }
+    if (++num_slots > kMaxStaticCallSlots) {
+      return false;
+    }
+    auto [target, inserted] = target_index.emplace(func, targets->size());
+    if (inserted) {
+      targets->emplace_back(func, std::vector<Index>());
+    }
+    (*targets)[target->second].second.push_back(slot);
+  }
+  return true;
+}
+
 static inline bool is_droppable(const ElemSegment* elem_segment) {
   return (elem_segment->kind == SegmentKind::Passive) &&
          (!elem_segment->elem_exprs.empty());
 }
 
 void CWriter::WriteDataInstances() {
-  for (const DataSegment* data_segment : module_->data_segments) {
+  for (const DataSegment* data_segment : state_.module->data_segments) {
     std::string name =
         DefineGlobalScopeName(ModuleFieldType::DataSegment, data_segment->name);
     if (is_droppable(data_segment)) {
@@ -2272,16 +2570,21 @@ void CWriter::WriteDataInstances() {
 }
 
 void CWriter::WriteDataInitializerDecls() {
-  if (module_->memories.empty()) {
+  if (state_.module->memories.empty()) {
+    return;
+  }
+
+  if (state_.options.data_stream) {
+    WriteDataFileDecls();
     return;
   }
 
-  for (const DataSegment* data_segment : module_->data_segments) {
+  for (const DataSegment* data_segment : state_.module->data_segments) {
     if (data_segment->data.empty()) {
       continue;
     }
 
-    if (c_streams_.size() > 1) {
+    if (state_.c_streams.size() > 1) {
       Write(Newline(), "extern const u8 data_segment_data_",
             GlobalName(ModuleFieldType::DataSegment, data_segment->name), "[];",
             Newline());
@@ -2290,12 +2593,16 @@ void CWriter::WriteDataInitializerDecls() {
 }
 
 void CWriter::WriteDataInitializers() {
-  if (module_->memories.empty()) {
+  if (state_.module->memories.empty()) {
     return;
   }
 
-  for (const DataSegment* data_segment : module_->data_segments) {
-    if (data_segment->data.empty()) {
+  if (state_.options.data_stream) {
+    WriteDataFile();
+  }
+
+  for (const DataSegment* data_segment : state_.module->data_segments) {
+    if (data_segment->data.empty() || state_.options.data_stream) {
       continue;
     }
 
@@ -2313,12 +2620,17 @@ void CWriter::WriteDataInitializers() {
     Write(CloseBrace(), ";", Newline());
   }
 
+  const bool use_memory_images = CanLoadMemoryImages();
+  if (use_memory_images) {
+    WriteMemoryImageDecls();
+  }
+
   Write(Newline(), "static void init_memories(", ModuleInstanceTypeName(),
         "* instance) ", OpenBrace());
-  if (module_->memories.size() > module_->num_memory_imports) {
-    Index memory_idx = module_->num_memory_imports;
-    for (Index i = memory_idx; i < module_->memories.size(); i++) {
-      const Memory* memory = module_->memories[i];
+  if (state_.module->memories.size() > state_.module->num_memory_imports) {
+    Index memory_idx = state_.module->num_memory_imports;
+    for (Index i = memory_idx; i < state_.module->memories.size(); i++) {
+      const Memory* memory = state_.module->memories[i];
       const uint64_t max =
           memory->page_limits.has_max
               ? memory->page_limits.max
@@ -2333,32 +2645,37 @@ void CWriter::WriteDataInitializers() {
     }
   }
 
-  for (const DataSegment* data_segment : module_->data_segments) {
-    if (data_segment->kind != SegmentKind::Active) {
-      continue;
-    }
-    const Memory* memory =
-        module_->memories[module_->GetMemoryIndex(data_segment->memory_var)];
-    Write("LOAD_DATA(",
-          ExternalInstanceRef(ModuleFieldType::Memory, memory->name), ", ");
-    WriteInitExpr(data_segment->offset);
-    if (data_segment->data.empty()) {
-      Write(", NULL, 0");
-    } else {
-      Write(", data_segment_data_",
-            GlobalName(ModuleFieldType::DataSegment, data_segment->name), ", ",
-            data_segment->data.size());
+  if (use_memory_images) {
+    WriteMemoryImageLoads();
+  } else {
+    for (const DataSegment* data_segment : state_.module->data_segments) {
+      if (data_segment->kind != SegmentKind::Active) {
+        continue;
+      }
+      const Memory* memory =
+          state_.module->memories[state_.module->GetMemoryIndex(
+              data_segment->memory_var)];
+      Write("LOAD_DATA(",
+            ExternalInstanceRef(ModuleFieldType::Memory, memory->name), ", ");
+      WriteInitExpr(data_segment->offset);
+      if (data_segment->data.empty()) {
+        Write(", NULL, 0");
+      } else {
+        Write(", data_segment_data_",
+              GlobalName(ModuleFieldType::DataSegment, data_segment->name),
+              ", ", data_segment->data.size());
+      }
+      Write(");", Newline());
     }
-    Write(");", Newline());
   }
 
   Write(CloseBrace(), Newline());
 
-  if (!module_->data_segments.empty()) {
+  if (!state_.module->data_segments.empty()) {
     Write(Newline(), "static void init_data_instances(",
           ModuleInstanceTypeName(), " *instance) ", OpenBrace());
 
-    for (const DataSegment* data_segment : module_->data_segments) {
+    for (const DataSegment* data_segment : state_.module->data_segments) {
       if (is_droppable(data_segment)) {
         Write("instance->data_segment_dropped_",
               GlobalName(ModuleFieldType::DataSegment, data_segment->name),
@@ -2370,8 +2687,80 @@ void CWriter::WriteDataInitializers() {
   }
 }
 
+// The active data segments can be loaded as memory images if none of them can
+// trap, i.e. they all have constant offsets into unshared memories that the
+// module defines, and fit in the memories' initial sizes.
+bool CWriter::CanLoadMemoryImages() const {
+  bool has_active_segments = false;
+  for (const DataSegment* data_segment : state_.module->data_segments) {
+    if (data_segment->kind != SegmentKind::Active) {
+      continue;
+    }
+    Index memory_index =
+        state_.module->GetMemoryIndex(data_segment->memory_var);
+    if (memory_index < state_.module->num_memory_imports) {
+      return false;
+    }
+    const Memory* memory = state_.module->memories[memory_index];
+    if (memory->page_limits.is_shared ||
+        memory->page_limits.initial > UINT64_MAX / memory->page_size) {
+      return false;
+    }
+    const uint64_t initial_size =
+        memory->page_limits.initial * memory->page_size;
+    uint64_t offset;
+    if (!get_const_offset(data_segment->offset, &offset) ||
+        offset > initial_size ||
+        data_segment->data.size() > initial_size - offset) {
+      return false;
+    }
+    has_active_segments = true;
+  }
+  return has_active_segments;
+}
+
+void CWriter::WriteMemoryImageDecls() {
+  for (Index i = state_.module->num_memory_imports;
+       i < state_.module->memories.size(); i++) {
+    if (get_active_data_segments(state_.module, i).empty()) {
+      continue;
+    }
+    Write(Newline(), "static wasm_rt_memory_image_t memory_image_",
+          GlobalName(ModuleFieldType::Memory, state_.module->memories[i]->name),
+          ";", Newline());
+  }
+}
+
+void CWriter::WriteMemoryImageLoads() {
+  for (Index i = state_.module->num_memory_imports;
+       i < state_.module->memories.size(); i++) {
+    const Memory* memory = state_.module->memories[i];
+    std::vector<const DataSegment*> segments =
+        get_active_data_segments(state_.module, i);
+    if (segments.empty()) {
+      continue;
+    }
+
+    Write(OpenBrace());
+    Write("const wasm_rt_data_segment_t segments[] = ", OpenBrace());
+    for (const DataSegment* data_segment : segments) {
+      uint64_t offset = 0;
+      get_const_offset(data_segment->offset, &offset);
+      Write("{", offset, "ull, data_segment_data_",
+            GlobalName(ModuleFieldType::DataSegment, data_segment->name), ", ",
+            data_segment->data.size(), "},", Newline());
+    }
+    Write(CloseBrace(), ";", Newline());
+    Write("wasm_rt_load_memory_image(",
+          ExternalInstancePtr(ModuleFieldType::Memory, memory->name),
+          ", &memory_image_", GlobalName(ModuleFieldType::Memory, memory->name),
+          ", segments, ", segments.size(), ");", Newline());
+    Write(CloseBrace(), Newline());
+  }
+}
+
 void CWriter::WriteElemInstances() {
-  for (const ElemSegment* elem_segment : module_->elem_segments) {
+  for (const ElemSegment* elem_segment : state_.module->elem_segments) {
     std::string name =
         DefineGlobalScopeName(ModuleFieldType::ElemSegment, elem_segment->name);
     if (is_droppable(elem_segment)) {
@@ -2380,12 +2769,75 @@ void CWriter::WriteElemInstances() {
   }
 }
 
+std::string CWriter::DataFileSymbolName() const {
+  return "data_segments_" + std::string(kGlobalSymbolPrefix) +
+         state_.module_prefix;
+}
+
+// The contents of all the data segments are in one file, and each segment's
+// data is a pointer into it.
+void CWriter::WriteDataFileDecls() {
+  const std::string name = DataFileSymbolName();
+  Write(Newline(), "#if defined(__has_embed)", Newline());
+  Write("extern const u8 ", name, "[];", Newline());
+  Write("#elif defined(__ELF__) || defined(__APPLE__)", Newline());
+  Write("extern const u8 ", name, "[] __asm__(\"", name, "\")", Newline());
+  Write("    __attribute__((visibility(\"hidden\")));", Newline());
+  Write("#else", Newline());
+  Write("#error \"the data segment file needs #embed or .incbin support\"",
+        Newline());
+  Write("#endif", Newline());
+
+  uint64_t offset = 0;
+  for (const DataSegment* data_segment : state_.module->data_segments) {
+    if (data_segment->data.empty()) {
+      continue;
+    }
+    Write("static const u8* const data_segment_data_",
+          GlobalName(ModuleFieldType::DataSegment, data_segment->name), " = ",
+          name, " + ", offset, ";", Newline());
+    offset += data_segment->data.size();
+  }
+}
+
+void CWriter::WriteDataFile() {
+  uint64_t size = 0;
+  for (const DataSegment* data_segment : state_.module->data_segments) {
+    state_.options.data_stream->WriteData(data_segment->data);
+    size += data_segment->data.size();
+  }
+  if (size == 0) {
+    return;
+  }
+
+  const std::string name = DataFileSymbolName();
+  const std::string file_name(state_.options.data_file_name);
+  auto write_incbin = [&](std::string_view section, std::string_view scope) {
+    Write("__asm__(\".pushsection ", section, "\\n\"", Newline());
+    Write("        \".globl ", name, "\\n\"", Newline());
+    Write("        \"", scope, " ", name, "\\n\"", Newline());
+    Write("        \"", name, ":\\n\"", Newline());
+    Write("        \".incbin \\\"", file_name, "\\\"\\n\"", Newline());
+    Write("        \".popsection\\n\");", Newline());
+  };
+
+  Write(Newline(), "#if defined(__has_embed)", Newline());
+  Write("const u8 ", name, "[] = {", Newline());
+  Write("#embed \"", file_name, "\"", Newline());
+  Write("};", Newline());
+  Write("#elif defined(__ELF__)", Newline());
+  write_incbin(".rodata", ".hidden");
+  Write("#else", Newline());
+  write_incbin("__TEXT,__const", ".private_extern");
+  Write("#endif", Newline());
+}
+
 void CWriter::WriteElemInitializerDecls() {
-  if (module_->tables.empty()) {
+  if (state_.module->tables.empty()) {
     return;
   }
 
-  for (const ElemSegment* elem_segment : module_->elem_segments) {
+  for (const ElemSegment* elem_segment : state_.module->elem_segments) {
     if (elem_segment->elem_exprs.empty()) {
       continue;
     }
@@ -2395,7 +2847,7 @@ void CWriter::WriteElemInitializerDecls() {
       continue;
     }
 
-    if (c_streams_.size() > 1) {
+    if (state_.c_streams.size() > 1) {
       Write(Newline(),
             "extern const wasm_elem_segment_expr_t elem_segment_exprs_",
             GlobalName(ModuleFieldType::ElemSegment, elem_segment->name), "[];",
@@ -2425,7 +2877,7 @@ void CWriter::WriteFuncRefWrapper(const Func* func) {
 
   std::string target_module_name;
   if (IsImport(func->name)) {
-    std::string external_module = import_func_module_map_[func->name];
+    std::string external_module = state_.import_func_module_map.at(func->name);
     assert(external_module != "");
     target_module_name = ModuleInstanceTypeName(external_module);
   } else {
@@ -2451,9 +2903,9 @@ void CWriter::WriteFuncRefWrapper(const Func* func) {
 void CWriter::WriteFuncRefWrappers() {
   std::set<std::string> unique_func_wrappers;
 
-  for (Index index : module_->used_func_refs) {
-    assert(index < module_->funcs.size());
-    const Func* func = module_->funcs[index];
+  for (Index index : state_.module->used_func_refs) {
+    assert(index < state_.module->funcs.size());
+    const Func* func = state_.module->funcs[index];
     if (!unique_func_wrappers.contains(func->name)) {
       WriteFuncRefWrapper(func);
       unique_func_wrappers.insert(func->name);
@@ -2462,11 +2914,11 @@ void CWriter::WriteFuncRefWrappers() {
 }
 
 void CWriter::WriteElemInitializers() {
-  if (module_->tables.empty()) {
+  if (state_.module->tables.empty()) {
     return;
   }
 
-  for (const ElemSegment* elem_segment : module_->elem_segments) {
+  for (const ElemSegment* elem_segment : state_.module->elem_segments) {
     if (elem_segment->elem_exprs.empty()) {
       continue;
     }
@@ -2486,11 +2938,13 @@ void CWriter::WriteElemInitializers() {
       const Expr& expr = elem_expr.front();
       switch (expr.type()) {
         case ExprType::RefFunc: {
-          const Func* func = module_->GetFunc(cast<RefFuncExpr>(&expr)->var);
-          const FuncType* func_type = module_->GetFuncType(func->decl.type_var);
-          Write("{RefFunc, ", FuncTypeExpr(func_type),
+          const Func* func =
+              state_.module->GetFunc(cast<RefFuncExpr>(&expr)->var);
+          const FuncType* func_type =
+              state_.module->GetFuncType(func->decl.type_var);
+          Write("{RefFunc, &", FuncTypeExpr(func_type),
                 ", (wasm_rt_function_ptr_t)", WrapperRef(func->name), ", {");
-          if (options_.features.tail_call_enabled() &&
+          if (state_.options.features.tail_call_enabled() &&
               (IsImport(func->name) || func->features_used.tailcall)) {
             Write(TailCallRef(func->name));
           } else {
@@ -2501,7 +2955,7 @@ void CWriter::WriteElemInitializers() {
           if (IsImport(func->name)) {
             Write("offsetof(", ModuleInstanceTypeName(), ", ",
                   GlobalName(ModuleFieldType::Import,
-                             import_module_sym_map_[func->name]),
+                             state_.import_module_sym_map.at(func->name)),
                   ")");
           } else {
             Write("0");
@@ -2513,7 +2967,7 @@ void CWriter::WriteElemInitializers() {
           break;
         case ExprType::GlobalGet: {
           const Global* global =
-              module_->GetGlobal(cast<GlobalGetExpr>(&expr)->var);
+              state_.module->GetGlobal(cast<GlobalGetExpr>(&expr)->var);
           assert(IsImport(global->name));
           Write("{GlobalGet, NULL, NULL, {NULL}, offsetof(",
                 ModuleInstanceTypeName(), ", ",
@@ -2530,10 +2984,10 @@ void CWriter::WriteElemInitializers() {
   Write(Newline(), "static void init_tables(", ModuleInstanceTypeName(),
         "* instance) ", OpenBrace());
 
-  if (module_->tables.size() > module_->num_table_imports) {
-    Index table_idx = module_->num_table_imports;
-    for (Index i = table_idx; i < module_->tables.size(); i++) {
-      const Table* table = module_->tables[i];
+  if (state_.module->tables.size() > state_.module->num_table_imports) {
+    Index table_idx = state_.module->num_table_imports;
+    for (Index i = table_idx; i < state_.module->tables.size(); i++) {
+      const Table* table = state_.module->tables[i];
       uint32_t max =
           table->elem_limits.has_max ? table->elem_limits.max : UINT32_MAX;
       Write("wasm_rt_allocate_", GetReferenceTypeName(table->elem_type),
@@ -2542,23 +2996,23 @@ void CWriter::WriteElemInitializers() {
     }
   }
 
-  for (const ElemSegment* elem_segment : module_->elem_segments) {
+  for (const ElemSegment* elem_segment : state_.module->elem_segments) {
     if (elem_segment->kind != SegmentKind::Active) {
       continue;
     }
 
-    const Table* table = module_->GetTable(elem_segment->table_var);
+    const Table* table = state_.module->GetTable(elem_segment->table_var);
 
     WriteElemTableInit(true, elem_segment, table);
   }
 
   Write(CloseBrace(), Newline());
 
-  if (!module_->elem_segments.empty()) {
+  if (!state_.module->elem_segments.empty()) {
     Write(Newline(), "static void init_elem_instances(",
           ModuleInstanceTypeName(), " *instance) ", OpenBrace());
 
-    for (const ElemSegment* elem_segment : module_->elem_segments) {
+    for (const ElemSegment* elem_segment : state_.module->elem_segments) {
       if (is_droppable(elem_segment)) {
         Write("instance->elem_segment_dropped_",
               GlobalName(ModuleFieldType::ElemSegment, elem_segment->name),
@@ -2616,16 +3070,16 @@ void CWriter::WriteElemTableInit(bool active_initialization,
 }
 
 bool CWriter::IsSingleUnsharedDefault32Memory() {
-  return module_->memories.size() == 1 &&
-         !module_->memories[0]->page_limits.is_shared &&
-         module_->memories[0]->page_size == WABT_DEFAULT_PAGE_SIZE &&
-         !module_->memories[0]->page_limits.is_64;
+  return state_.module->memories.size() == 1 &&
+         !state_.module->memories[0]->page_limits.is_shared &&
+         state_.module->memories[0]->page_size == WABT_DEFAULT_PAGE_SIZE &&
+         !state_.module->memories[0]->page_limits.is_64;
 }
 
 void CWriter::WriteLocalMemoryBaseSizeDeclaration() {
   Write("uint8_t* const wasm_rt_local_memory_base = ");
   if (IsSingleUnsharedDefault32Memory()) {
-    const Memory* memory = module_->memories[0];
+    const Memory* memory = state_.module->memories[0];
     Write("(", ExternalInstancePtr(ModuleFieldType::Memory, memory->name),
           ")->data");
   } else {
@@ -2633,7 +3087,7 @@ void CWriter::WriteLocalMemoryBaseSizeDeclaration() {
   }
   Write(";", Newline(), "uint64_t wasm_rt_local_memory_size = ");
   if (IsSingleUnsharedDefault32Memory()) {
-    const Memory* memory = module_->memories[0];
+    const Memory* memory = state_.module->memories[0];
     Write("(", ExternalInstancePtr(ModuleFieldType::Memory, memory->name),
           ")->size");
   } else {
@@ -2645,7 +3099,7 @@ void CWriter::WriteLocalMemoryBaseSizeDeclaration() {
 
 void CWriter::RefreshLocalMemorySize() {
   if (IsSingleUnsharedDefault32Memory()) {
-    const Memory* memory = module_->memories[0];
+    const Memory* memory = state_.module->memories[0];
     Write("wasm_rt_local_memory_size = (",
           ExternalInstancePtr(ModuleFieldType::Memory, memory->name),
           ")->size;", Newline());
@@ -2677,10 +3131,10 @@ void CWriter::RestoreSegueBase() {
 }
 
 void CWriter::WriteExports(CWriterPhase kind) {
-  if (module_->exports.empty())
+  if (state_.module->exports.empty())
     return;
 
-  for (const Export* export_ : module_->exports) {
+  for (const Export* export_ : state_.module->exports) {
     Write(Newline(), "/* export: '", SanitizeForComment(export_->name), "' */",
           Newline());
 
@@ -2690,13 +3144,13 @@ void CWriter::WriteExports(CWriterPhase kind) {
 
     switch (export_->kind) {
       case ExternalKind::Func: {
-        const Func* func = module_->GetFunc(export_->var);
+        const Func* func = state_.module->GetFunc(export_->var);
         internal_name = func->name;
         if (kind == CWriterPhase::Declarations) {
           WriteFuncDeclaration(func->decl, mangled_name);
         } else {
           func_ = func;
-          local_syms_ = global_syms_;
+          local_syms_ = state_.global_syms;
           local_sym_map_.clear();
           stack_var_sym_map_.clear();
           Write(func_->decl.sig.result_types, " ", mangled_name, "(");
@@ -2708,28 +3162,28 @@ void CWriter::WriteExports(CWriterPhase kind) {
       }
 
       case ExternalKind::Global: {
-        const Global* global = module_->GetGlobal(export_->var);
+        const Global* global = state_.module->GetGlobal(export_->var);
         internal_name = global->name;
         WriteGlobalPtr(*global, mangled_name);
         break;
       }
 
       case ExternalKind::Memory: {
-        const Memory* memory = module_->GetMemory(export_->var);
+        const Memory* memory = state_.module->GetMemory(export_->var);
         internal_name = memory->name;
         WriteMemoryPtr(mangled_name, *memory);
         break;
       }
 
       case ExternalKind::Table: {
-        const Table* table = module_->GetTable(export_->var);
+        const Table* table = state_.module->GetTable(export_->var);
         internal_name = table->name;
         WriteTablePtr(mangled_name, *table);
         break;
       }
 
       case ExternalKind::Tag: {
-        const Tag* tag = module_->GetTag(export_->var);
+        const Tag* tag = state_.module->GetTag(export_->var);
         internal_name = tag->name;
         if (kind == CWriterPhase::Declarations) {
           Write("extern ");
@@ -2752,7 +3206,9 @@ void CWriter::WriteExports(CWriterPhase kind) {
       case ExternalKind::Func: {
         Write(OpenBrace());
         if (IsSingleUnsharedDefault32Memory()) {
-          InstallSegueBase(module_->memories[0], true /* save_old_value */);
+          InstallSegueBase(state_.module->memories[0],
+                           true /* save_old_value */);
+
         }
         auto num_results = func_->GetNumResults();
         if (num_results > 1) {
@@ -2765,7 +3221,7 @@ void CWriter::WriteExports(CWriterPhase kind) {
         if (IsImport(internal_name)) {
           Write("instance->",
                 GlobalName(ModuleFieldType::Import,
-                           import_module_sym_map_[internal_name]));
+                           state_.import_module_sym_map.at(internal_name)));
         } else {
           Write("instance");
         }
@@ -2819,12 +3275,12 @@ void CWriter::WriteExports(CWriterPhase kind) {
 }
 
 void CWriter::WriteTailCallExports(CWriterPhase kind) {
-  for (const Export* export_ : module_->exports) {
+  for (const Export* export_ : state_.module->exports) {
     if (export_->kind != ExternalKind::Func) {
       continue;
     }
 
-    const Func* func = module_->GetFunc(export_->var);
+    const Func* func = state_.module->GetFunc(export_->var);
 
     if (!IsImport(func->name) && !func->features_used.tailcall) {
       continue;
@@ -2840,7 +3296,7 @@ void CWriter::WriteTailCallExports(CWriterPhase kind) {
     } else {
       WriteTailCallFuncDeclaration(mangled_name);
       Write(" ", OpenBrace());
-      const Func* func = module_->GetFunc(export_->var);
+      const Func* func = state_.module->GetFunc(export_->var);
       Write(TailCallRef(func->name), "(instance_ptr, tail_call_stack, next);",
             Newline(), CloseBrace(), Newline());
     }
@@ -2848,9 +3304,9 @@ void CWriter::WriteTailCallExports(CWriterPhase kind) {
 }
 
 void CWriter::WriteInit() {
-  Write(Newline(), "void ", kAdminSymbolPrefix, module_prefix_, "_instantiate(",
-        ModuleInstanceTypeName(), "* instance");
-  for (const auto& import_module_name : import_module_set_) {
+  Write(Newline(), "void ", kAdminSymbolPrefix, state_.module_prefix,
+        "_instantiate(", ModuleInstanceTypeName(), "* instance");
+  for (const auto& import_module_name : state_.import_module_set) {
     Write(", struct ", ModuleInstanceTypeName(import_module_name), "* ",
           GlobalName(ModuleFieldType::Import, import_module_name));
   }
@@ -2858,39 +3314,45 @@ void CWriter::WriteInit() {
 
   Write("assert(wasm_rt_is_initialized());", Newline());
 
-  if (!import_module_set_.empty()) {
+  if (!state_.module->types.empty()) {
+    Write("init_func_types();", Newline());
+  }
+
+  if (!state_.import_module_set.empty()) {
     Write("init_instance_import(instance");
-    for (const auto& import_module_name : import_module_set_) {
+    for (const auto& import_module_name : state_.import_module_set) {
       Write(", ", GlobalName(ModuleFieldType::Import, import_module_name));
     }
     Write(");", Newline());
   }
 
-  if (!module_->globals.empty()) {
+  if (!state_.module->globals.empty()) {
     Write("init_globals(instance);", Newline());
   }
-  if (!module_->tables.empty()) {
+  if (!state_.module->tables.empty()) {
     Write("init_tables(instance);", Newline());
   }
-  if (!module_->memories.empty()) {
+  if (!state_.module->memories.empty()) {
     Write("init_memories(instance);", Newline());
     if (IsSingleUnsharedDefault32Memory()) {
-      InstallSegueBase(module_->memories[0], true /* save_old_value */);
+      InstallSegueBase(state_.module->memories[0], true /* save_old_value */);
     }
   }
-  if (!module_->tables.empty() && !module_->elem_segments.empty()) {
+  if (!state_.module->tables.empty() && !state_.module->elem_segments.empty()) {
     Write("init_elem_instances(instance);", Newline());
   }
-  if (!module_->memories.empty() && !module_->data_segments.empty()) {
+  if (!state_.module->memories.empty() &&
+      !state_.module->data_segments.empty()) {
     Write("init_data_instances(instance);", Newline());
   }
 
-  for (Var* var : module_->starts) {
-    Write(ExternalRef(ModuleFieldType::Func, module_->GetFunc(*var)->name));
-    if (IsImport(module_->GetFunc(*var)->name)) {
+  for (Var* var : state_.module->starts) {
+    const std::string& start_name = state_.module->GetFunc(*var)->name;
+    Write(ExternalRef(ModuleFieldType::Func, start_name));
+    if (IsImport(start_name)) {
       Write("(instance->",
             GlobalName(ModuleFieldType::Import,
-                       import_module_sym_map_[module_->GetFunc(*var)->name]),
+                       state_.import_module_sym_map.at(start_name)),
             ");");
     } else {
       Write("(instance);");
@@ -2905,14 +3367,19 @@ void CWriter::WriteInit() {
 }
 
 void CWriter::WriteGetFuncType() {
-  Write(Newline(), "wasm_rt_func_type_t ", kAdminSymbolPrefix, module_prefix_,
+  Write(Newline(), "wasm_rt_func_type_t ", kAdminSymbolPrefix,
+        state_.module_prefix,
         "_get_func_type(uint32_t param_count, uint32_t result_count, "
         "...) ",
         OpenBrace());
 
   Write("va_list args;", Newline());
 
-  for (const TypeEntry* type : module_->types) {
+  if (!state_.module->types.empty()) {
+    Write("init_func_types();", Newline());
+  }
+
+  for (const TypeEntry* type : state_.module->types) {
     const FuncType* func_type = cast<FuncType>(type);
     const FuncSignature& signature = func_type->sig;
 
@@ -2939,24 +3406,24 @@ void CWriter::WriteGetFuncType() {
 }
 
 void CWriter::WriteInitInstanceImport() {
-  if (import_module_set_.empty())
+  if (state_.import_module_set.empty())
     return;
 
   Write(Newline(), "static void init_instance_import(",
         ModuleInstanceTypeName(), "* instance");
-  for (const auto& import_module_name : import_module_set_) {
+  for (const auto& import_module_name : state_.import_module_set) {
     Write(", struct ", ModuleInstanceTypeName(import_module_name), "* ",
           GlobalName(ModuleFieldType::Import, import_module_name));
   }
   Write(") ", OpenBrace());
 
-  for (const auto& import_module : import_func_module_set_) {
+  for (const auto& import_module : state_.import_func_module_set) {
     Write("instance->", GlobalName(ModuleFieldType::Import, import_module),
           " = ", GlobalName(ModuleFieldType::Import, import_module), ";",
           Newline());
   }
 
-  for (const Import* import : unique_imports_) {
+  for (const Import* import : state_.unique_imports) {
     switch (import->kind()) {
       case ExternalKind::Func:
       case ExternalKind::Tag:
@@ -2980,7 +3447,7 @@ void CWriter::WriteInitInstanceImport() {
 }
 
 void CWriter::WriteImportProperties(CWriterPhase kind) {
-  if (import_module_set_.empty())
+  if (state_.import_module_set.empty())
     return;
 
   Write(Newline());
@@ -2990,8 +3457,8 @@ void CWriter::WriteImportProperties(CWriterPhase kind) {
     if (kind == CWriterPhase::Declarations) {
       Write("extern ");
     }
-    Write("const ", type, " ", kAdminSymbolPrefix, module_prefix_, "_", prop,
-          "_", MangleModuleName(import->module_name), "_",
+    Write("const ", type, " ", kAdminSymbolPrefix, state_.module_prefix, "_",
+          prop, "_", MangleModuleName(import->module_name), "_",
           MangleName(import->field_name));
     if (kind == CWriterPhase::Definitions) {
       Write(" = ", value);
@@ -3000,7 +3467,7 @@ void CWriter::WriteImportProperties(CWriterPhase kind) {
     Write(";", Newline());
   };
 
-  for (const Import* import : unique_imports_) {
+  for (const Import* import : state_.unique_imports) {
     if (import->kind() == ExternalKind::Memory) {
       const Limits* limits = &(cast<MemoryImport>(import)->memory.page_limits);
       // We use u64 so we can handle both 32-bit and 64-bit memories
@@ -3026,13 +3493,13 @@ void CWriter::WriteImportProperties(CWriterPhase kind) {
 }
 
 void CWriter::WriteFree() {
-  Write(Newline(), "void ", kAdminSymbolPrefix, module_prefix_, "_free(",
+  Write(Newline(), "void ", kAdminSymbolPrefix, state_.module_prefix, "_free(",
         ModuleInstanceTypeName(), "* instance) ", OpenBrace());
 
   {
     Index table_index = 0;
-    for (const Table* table : module_->tables) {
-      bool is_import = table_index < module_->num_table_imports;
+    for (const Table* table : state_.module->tables) {
+      bool is_import = table_index < state_.module->num_table_imports;
       if (!is_import) {
         Write("wasm_rt_free_", GetReferenceTypeName(table->elem_type),
               "_table(",
@@ -3045,8 +3512,8 @@ void CWriter::WriteFree() {
 
   {
     Index memory_index = 0;
-    for (const Memory* memory : module_->memories) {
-      bool is_import = memory_index < module_->num_memory_imports;
+    for (const Memory* memory : state_.module->memories) {
+      bool is_import = memory_index < state_.module->num_memory_imports;
       if (!is_import) {
         std::string func = GetMemoryAPIString(*memory, "wasm_rt_free_memory");
         Write(func, "(",
@@ -3062,20 +3529,81 @@ void CWriter::WriteFree() {
 
 void CWriter::WriteFuncs() {
   std::vector<size_t> c_stream_assignment =
-      name_to_output_file_index_(module_->funcs.begin(), module_->funcs.end(),
-                                 module_->num_func_imports, c_streams_.size());
+      state_.name_to_output_file_index(
+          state_.module->funcs.begin(), state_.module->funcs.end(),
+          state_.module->num_func_imports, state_.c_streams.size());
+  std::vector<std::vector<const Func*>> output_funcs(state_.c_streams.size());
   Index func_index = 0;
-  for (const Func* func : module_->funcs) {
-    bool is_import = func_index < module_->num_func_imports;
+  for (const Func* func : state_.module->funcs) {
+    bool is_import = func_index < state_.module->num_func_imports;
     if (!is_import) {
-      stream_ = c_streams_.at(c_stream_assignment.at(func_index));
-      Write(*func);
-      if (func->features_used.tailcall) {
-        WriteTailCallee(*func);
-      }
+      output_funcs.at(c_stream_assignment.at(func_index)).push_back(func);
     }
     ++func_index;
   }
+
+  // The outputs don't depend on each other, so they can be written in any
+  // order, and a writer for one output only reads the module-wide state.
+  using Clock = std::chrono::steady_clock;
+  std::vector<std::chrono::duration<double, std::milli>> output_times(
+      state_.c_streams.size());
+  size_t num_threads =
+      std::min<size_t>(std::max(state_.options.num_threads, 1),
+                       state_.c_streams.size());
+  if (num_threads == 1) {
+    for (size_t i = 0; i < state_.c_streams.size(); ++i) {
+      Clock::time_point start = Clock::now();
+      WriteFuncs(output_funcs[i], state_.c_streams[i]);
+      output_times[i] = Clock::now() - start;
+    }
+  } else {
+    std::vector<std::unique_ptr<CWriter>> writers;
+    for (size_t i = 0; i < num_threads; ++i) {
+      writers.emplace_back(new CWriter(state_));
+    }
+    std::atomic<size_t> next_output{0};
+    auto write_outputs = [&](CWriter* writer) {
+      size_t i;
+      while ((i = next_output++) < state_.c_streams.size()) {
+        Clock::time_point start = Clock::now();
+        writer->WriteFuncs(output_funcs[i], state_.c_streams[i]);
+        output_times[i] = Clock::now() - start;
+      }
+    };
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < num_threads; ++i) {
+      threads.emplace_back(write_outputs, writers[i].get());
+    }
+    write_outputs(writers[0].get());
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+    for (const auto& writer : writers) {
+      if (Failed(writer->result_)) {
+        result_ = Result::Error;
+      }
+    }
+  }
+
+  if (state_.options.log_stream) {
+    for (size_t i = 0; i < state_.c_streams.size(); ++i) {
+      state_.options.log_stream->Writef("output %" PRIzd ": %" PRIzd
+                                  " functions in %.3f ms\n",
+                                  i, output_funcs[i].size(),
+                                  output_times[i].count());
+    }
+  }
+}
+
+void CWriter::WriteFuncs(const std::vector<const Func*>& funcs,
+                         Stream* stream) {
+  stream_ = stream;
+  for (const Func* func : funcs) {
+    Write(*func);
+    if (func->features_used.tailcall) {
+      WriteTailCallee(*func);
+    }
+  }
 }
 
 void CWriter::PushFuncSection(std::string_view include_condition) {
@@ -3084,7 +3612,7 @@ void CWriter::PushFuncSection(std::string_view include_condition) {
 }
 
 bool CWriter::IsImport(const std::string& name) const {
-  return import_module_sym_map_.contains(name);
+  return state_.import_module_sym_map.contains(name);
 }
 
 template <typename sources>
@@ -3526,9 +4054,9 @@ void CWriter::Write(const Catch& c) {
   }
 
   Write("if (wasm_rt_exception_tag() == ",
-        TagSymbol(module_->GetTag(c.var)->name), ") ", OpenBrace());
+        TagSymbol(state_.module->GetTag(c.var)->name), ") ", OpenBrace());
 
-  const Tag* tag = module_->GetTag(c.var);
+  const Tag* tag = state_.module->GetTag(c.var);
   const FuncDeclaration& tag_type = tag->decl;
   const Index num_params = tag_type.GetNumParams();
   PushTypes(tag_type.sig.param_types);
@@ -3661,9 +4189,9 @@ void CWriter::Write(const TryTableExpr& try_table_expr) {
 void CWriter::Write(const TableCatch& c) {
   if (!c.IsCatchAll()) {
     Write("if (wasm_rt_exception_tag() == ",
-          TagSymbol(module_->GetTag(c.tag)->name), ") ", OpenBrace());
+          TagSymbol(state_.module->GetTag(c.tag)->name), ") ", OpenBrace());
 
-    const Tag* tag = module_->GetTag(c.tag);
+    const Tag* tag = state_.module->GetTag(c.tag);
     const FuncDeclaration& tag_type = tag->decl;
     const Index num_params = tag_type.GetNumParams();
     PushTypes(tag_type.sig.param_types);
@@ -3746,7 +4274,7 @@ void CWriter::Write(const ExprList& exprs) {
 
       case ExprType::Call: {
         const Var& var = cast<CallExpr>(&expr)->var;
-        const Func& func = *module_->GetFunc(var);
+        const Func& func = *state_.module->GetFunc(var);
         Index num_params = func.GetNumParams();
         Index num_results = func.GetNumResults();
         assert(type_stack_.size() >= num_params);
@@ -3757,13 +4285,7 @@ void CWriter::Write(const ExprList& exprs) {
         }
 
         assert(var.is_name());
-        Write(ExternalRef(ModuleFieldType::Func, var.name()), "(");
-        if (IsImport(func.name)) {
-          Write("instance->", GlobalName(ModuleFieldType::Import,
-                                         import_module_sym_map_[func.name]));
-        } else {
-          Write("instance");
-        }
+        WriteDirectCallee(func);
         for (Index i = 0; i < num_params; ++i) {
           Write(", ");
           Write(StackVar(num_params - i - 1));
@@ -3784,18 +4306,25 @@ void CWriter::Write(const ExprList& exprs) {
         Index num_params = decl.GetNumParams();
         Index num_results = decl.GetNumResults();
         assert(type_stack_.size() > num_params);
+
+        const Table* table =
+            state_.module->GetTable(cast<CallIndirectExpr>(&expr)->table);
+
+        assert(decl.has_func_type);
+        const FuncType* func_type = state_.module->GetFuncType(decl.type_var);
+
+        StaticCallTargets targets;
+        if (GetStaticCallTargets(table, func_type, &targets)) {
+          WriteStaticCallIndirect(decl, targets);
+          break;
+        }
+
         if (num_results > 1) {
           Write(OpenBrace(), decl.sig.result_types, " tmp = ");
         } else if (num_results == 1) {
           Write(StackVar(num_params, decl.GetResultType(0)), " = ");
         }
 
-        const Table* table =
-            module_->GetTable(cast<CallIndirectExpr>(&expr)->table);
-
-        assert(decl.has_func_type);
-        const FuncType* func_type = module_->GetFuncType(decl.type_var);
-
         Write("CALL_INDIRECT(",
               ExternalInstanceRef(ModuleFieldType::Table, table->name), ", ");
         WriteCallIndirectFuncDeclaration(decl, "(*)");
@@ -3807,7 +4336,8 @@ void CWriter::Write(const ExprList& exprs) {
         }
         Write(");", Newline());
         if (IsSingleUnsharedDefault32Memory()) {
-          InstallSegueBase(module_->memories[0], false /* save_old_value */);
+          InstallSegueBase(state_.module->memories[0],
+                           false /* save_old_value */);
         }
         RefreshLocalMemorySize();
         DropTypes(num_params + 1);
@@ -3843,7 +4373,7 @@ void CWriter::Write(const ExprList& exprs) {
 
       case ExprType::GlobalGet: {
         const Var& var = cast<GlobalGetExpr>(&expr)->var;
-        PushType(module_->GetGlobal(var)->type);
+        PushType(state_.module->GetGlobal(var)->type);
         Write(StackVar(0), " = ", GlobalInstanceVar(var), ";", Newline());
         break;
       }
@@ -3922,7 +4452,8 @@ void CWriter::Write(const ExprList& exprs) {
       case ExprType::MemoryFill: {
         const auto inst = cast<MemoryFillExpr>(&expr);
         Memory* memory =
-            module_->memories[module_->GetMemoryIndex(inst->memidx)];
+            state_.module->memories[state_.module->GetMemoryIndex(
+                inst->memidx)];
         Write("memory_fill(",
               ExternalInstancePtr(ModuleFieldType::Memory, memory->name), ", ",
               StackVar(2), ", ", StackVar(1), ", ", StackVar(0), ");",
@@ -3933,8 +4464,10 @@ void CWriter::Write(const ExprList& exprs) {
       case ExprType::MemoryCopy: {
         const auto inst = cast<MemoryCopyExpr>(&expr);
         Memory* dest_memory =
-            module_->memories[module_->GetMemoryIndex(inst->destmemidx)];
-        const Memory* src_memory = module_->GetMemory(inst->srcmemidx);
+            state_.module->memories[state_.module->GetMemoryIndex(
+                inst->destmemidx)];
+
+        const Memory* src_memory = state_.module->GetMemory(inst->srcmemidx);
         Write("memory_copy(",
               ExternalInstancePtr(ModuleFieldType::Memory, dest_memory->name),
               ", ",
@@ -3947,8 +4480,9 @@ void CWriter::Write(const ExprList& exprs) {
       case ExprType::MemoryInit: {
         const auto inst = cast<MemoryInitExpr>(&expr);
         Memory* dest_memory =
-            module_->memories[module_->GetMemoryIndex(inst->memidx)];
-        const DataSegment* src_data = module_->GetDataSegment(inst->var);
+            state_.module->memories[state_.module->GetMemoryIndex(
+                inst->memidx)];
+        const DataSegment* src_data = state_.module->GetDataSegment(inst->var);
         Write("memory_init(",
               ExternalInstancePtr(ModuleFieldType::Memory, dest_memory->name),
               ", ");
@@ -3974,9 +4508,10 @@ void CWriter::Write(const ExprList& exprs) {
       case ExprType::TableInit: {
         const auto inst = cast<TableInitExpr>(&expr);
         Table* dest_table =
-            module_->tables[module_->GetTableIndex(inst->table_index)];
+            state_.module->tables[state_.module->GetTableIndex(
+                inst->table_index)];
         const ElemSegment* src_segment =
-            module_->GetElemSegment(inst->segment_index);
+            state_.module->GetElemSegment(inst->segment_index);
 
         WriteElemTableInit(false, src_segment, dest_table);
         DropTypes(3);
@@ -3984,7 +4519,7 @@ void CWriter::Write(const ExprList& exprs) {
 
       case ExprType::DataDrop: {
         const auto inst = cast<DataDropExpr>(&expr);
-        const DataSegment* data = module_->GetDataSegment(inst->var);
+        const DataSegment* data = state_.module->GetDataSegment(inst->var);
         if (is_droppable(data)) {
           Write("instance->data_segment_dropped_",
                 GlobalName(ModuleFieldType::DataSegment, data->name),
@@ -3994,7 +4529,7 @@ void CWriter::Write(const ExprList& exprs) {
 
       case ExprType::ElemDrop: {
         const auto inst = cast<ElemDropExpr>(&expr);
-        const ElemSegment* seg = module_->GetElemSegment(inst->var);
+        const ElemSegment* seg = state_.module->GetElemSegment(inst->var);
         if (is_droppable(seg)) {
           Write("instance->elem_segment_dropped_",
                 GlobalName(ModuleFieldType::ElemSegment, seg->name), " = true;",
@@ -4005,8 +4540,9 @@ void CWriter::Write(const ExprList& exprs) {
       case ExprType::TableCopy: {
         const auto inst = cast<TableCopyExpr>(&expr);
         Table* dest_table =
-            module_->tables[module_->GetTableIndex(inst->dst_table)];
-        const Table* src_table = module_->GetTable(inst->src_table);
+            state_.module->tables[state_.module->GetTableIndex(
+                inst->dst_table)];
+        const Table* src_table = state_.module->GetTable(inst->src_table);
         if (dest_table->elem_type != src_table->elem_type) {
           WABT_UNREACHABLE;
         }
@@ -4020,7 +4556,8 @@ void CWriter::Write(const ExprList& exprs) {
       } break;
 
       case ExprType::TableGet: {
-        const Table* table = module_->GetTable(cast<TableGetExpr>(&expr)->var);
+        const Table* table =
+            state_.module->GetTable(cast<TableGetExpr>(&expr)->var);
         Write(StackVar(0, table->elem_type), " = ",
               GetReferenceTypeName(table->elem_type), "_table_get(",
               ExternalInstancePtr(ModuleFieldType::Table, table->name), ", ",
@@ -4030,7 +4567,8 @@ void CWriter::Write(const ExprList& exprs) {
       } break;
 
       case ExprType::TableSet: {
-        const Table* table = module_->GetTable(cast<TableSetExpr>(&expr)->var);
+        const Table* table =
+            state_.module->GetTable(cast<TableSetExpr>(&expr)->var);
         Write(GetReferenceTypeName(table->elem_type), "_table_set(",
               ExternalInstancePtr(ModuleFieldType::Table, table->name), ", ",
               StackVar(1), ", ", StackVar(0), ");", Newline());
@@ -4038,7 +4576,8 @@ void CWriter::Write(const ExprList& exprs) {
       } break;
 
       case ExprType::TableGrow: {
-        const Table* table = module_->GetTable(cast<TableGrowExpr>(&expr)->var);
+        const Table* table =
+            state_.module->GetTable(cast<TableGrowExpr>(&expr)->var);
         Write(StackVar(1, table->elem_limits.IndexType()), " = wasm_rt_grow_",
               GetReferenceTypeName(table->elem_type), "_table(",
               ExternalInstancePtr(ModuleFieldType::Table, table->name), ", ",
@@ -4048,7 +4587,8 @@ void CWriter::Write(const ExprList& exprs) {
       } break;
 
       case ExprType::TableSize: {
-        const Table* table = module_->GetTable(cast<TableSizeExpr>(&expr)->var);
+        const Table* table =
+            state_.module->GetTable(cast<TableSizeExpr>(&expr)->var);
 
         PushType(table->elem_limits.IndexType());
         Write(StackVar(0), " = ",
@@ -4057,7 +4597,8 @@ void CWriter::Write(const ExprList& exprs) {
       } break;
 
       case ExprType::TableFill: {
-        const Table* table = module_->GetTable(cast<TableFillExpr>(&expr)->var);
+        const Table* table =
+            state_.module->GetTable(cast<TableFillExpr>(&expr)->var);
         Write(GetReferenceTypeName(table->elem_type), "_table_fill(",
               ExternalInstancePtr(ModuleFieldType::Table, table->name), ", ",
               StackVar(2), ", ", StackVar(1), ", ", StackVar(0), ");",
@@ -4070,16 +4611,17 @@ void CWriter::Write(const ExprList& exprs) {
         break;
 
       case ExprType::RefFunc: {
-        const Func* func = module_->GetFunc(cast<RefFuncExpr>(&expr)->var);
+        const Func* func =
+            state_.module->GetFunc(cast<RefFuncExpr>(&expr)->var);
         PushType(Type::FuncRef);
         const FuncDeclaration& decl = func->decl;
 
         assert(decl.has_func_type);
-        const FuncType* func_type = module_->GetFuncType(decl.type_var);
+        const FuncType* func_type = state_.module->GetFuncType(decl.type_var);
 
         Write(StackVar(0), " = (wasm_rt_funcref_t){", FuncTypeExpr(func_type),
               ", (wasm_rt_function_ptr_t)", WrapperRef(func->name), ", {");
-        if (options_.features.tail_call_enabled() &&
+        if (state_.options.features.tail_call_enabled() &&
             (IsImport(func->name) || func->features_used.tailcall)) {
           Write(TailCallRef(func->name));
         } else {
@@ -4088,8 +4630,9 @@ void CWriter::Write(const ExprList& exprs) {
         Write("}, ");
 
         if (IsImport(func->name)) {
-          Write("instance->", GlobalName(ModuleFieldType::Import,
-                                         import_module_sym_map_[func->name]));
+          Write("instance->",
+                GlobalName(ModuleFieldType::Import,
+                           state_.import_module_sym_map.at(func->name)));
         } else {
           Write("instance");
         }
@@ -4128,7 +4671,7 @@ void CWriter::Write(const ExprList& exprs) {
         break;
 
       case ExprType::MemoryGrow: {
-        Memory* memory = module_->memories[module_->GetMemoryIndex(
+        Memory* memory = state_.module->memories[state_.module->GetMemoryIndex(
             cast<MemoryGrowExpr>(&expr)->memidx)];
 
         std::string func = GetMemoryAPIString(*memory, "wasm_rt_grow_memory");
@@ -4136,14 +4679,15 @@ void CWriter::Write(const ExprList& exprs) {
               ExternalInstancePtr(ModuleFieldType::Memory, memory->name), ", ",
               StackVar(0), ");", Newline());
         if (IsSingleUnsharedDefault32Memory()) {
-          InstallSegueBase(module_->memories[0], false /* save_old_value */);
+          InstallSegueBase(state_.module->memories[0],
+                           false /* save_old_value */);
         }
         RefreshLocalMemorySize();
         break;
       }
 
       case ExprType::MemorySize: {
-        Memory* memory = module_->memories[module_->GetMemoryIndex(
+        Memory* memory = state_.module->memories[state_.module->GetMemoryIndex(
             cast<MemorySizeExpr>(&expr)->memidx)];
 
         PushType(memory->page_limits.IndexType());
@@ -4218,7 +4762,7 @@ void CWriter::Write(const ExprList& exprs) {
 
       case ExprType::Throw: {
         const Var& var = cast<ThrowExpr>(&expr)->var;
-        const Tag* tag = module_->GetTag(var);
+        const Tag* tag = state_.module->GetTag(var);
 
         Index num_params = tag->decl.GetNumParams();
         if (num_params == 0) {
@@ -4313,7 +4857,7 @@ void CWriter::Write(const ExprList& exprs) {
 
       case ExprType::ReturnCall: {
         const auto inst = cast<ReturnCallExpr>(&expr);
-        const Func& func = *module_->GetFunc(inst->var);
+        const Func& func = *state_.module->GetFunc(inst->var);
 
         const FuncDeclaration& decl = func.decl;
         assert(decl.sig.result_types == func_->decl.sig.result_types);
@@ -4345,7 +4889,7 @@ void CWriter::Write(const ExprList& exprs) {
         if (IsImport(func.name)) {
           Write("*instance_ptr = instance->",
                 GlobalName(ModuleFieldType::Import,
-                           import_module_sym_map_.at(func.name)),
+                           state_.import_module_sym_map.at(func.name)),
                 ";", Newline());
         }
         DropTypes(num_params);
@@ -4361,10 +4905,10 @@ void CWriter::Write(const ExprList& exprs) {
         const Index num_params = decl.GetNumParams();
         WriteTailCallAsserts(decl.sig);
         WriteUnwindTryCatchStack(FindLabel(Var(label_stack_.size() - 1, {})));
-        const Table* table = module_->GetTable(inst->table);
+        const Table* table = state_.module->GetTable(inst->table);
         Write("CHECK_CALL_INDIRECT(",
               ExternalInstanceRef(ModuleFieldType::Table, table->name), ", ",
-              FuncTypeExpr(module_->GetFuncType(decl.type_var)), ", ",
+              FuncTypeExpr(state_.module->GetFuncType(decl.type_var)), ", ",
               StackVar(0), ");", Newline());
 
         Write("if (!", ExternalInstanceRef(ModuleFieldType::Table, table->name),
@@ -4407,8 +4951,16 @@ void CWriter::Write(const ExprList& exprs) {
         return;
       }
 
-      case ExprType::AtomicWait:
-      case ExprType::AtomicNotify:
+      case ExprType::AtomicWait: {
+        Write(*cast<AtomicWaitExpr>(&expr));
+        break;
+      }
+
+      case ExprType::AtomicNotify: {
+        Write(*cast<AtomicNotifyExpr>(&expr));
+        break;
+      }
+
       case ExprType::CallRef:
       case ExprType::ReturnCallRef:
       case ExprType::Quaternary:
@@ -5424,7 +5976,8 @@ void CWriter::Write(const LoadExpr& expr) {
   }
   // clang-format on
 
-  Memory* memory = module_->memories[module_->GetMemoryIndex(expr.memidx)];
+  Memory* memory =
+      state_.module->memories[state_.module->GetMemoryIndex(expr.memidx)];
   func = GetMemoryAPIString(*memory, func);
 
   Type result_type = expr.opcode.GetResultType();
@@ -5457,7 +6010,8 @@ void CWriter::Write(const StoreExpr& expr) {
   }
   // clang-format on
 
-  Memory* memory = module_->memories[module_->GetMemoryIndex(expr.memidx)];
+  Memory* memory =
+      state_.module->memories[state_.module->GetMemoryIndex(expr.memidx)];
   func = GetMemoryAPIString(*memory, func);
 
   Write(func, "(wasm_rt_local_memory_base, wasm_rt_local_memory_size, ");
@@ -5917,7 +6471,8 @@ void CWriter::Write(const SimdLoadLaneExpr& expr) {
       WABT_UNREACHABLE;
   }
   // clang-format on
-  Memory* memory = module_->memories[module_->GetMemoryIndex(expr.memidx)];
+  Memory* memory =
+      state_.module->memories[state_.module->GetMemoryIndex(expr.memidx)];
   Type result_type = expr.opcode.GetResultType();
   Write(StackVar(1, result_type), " = ", func, expr.val,
         "(wasm_rt_local_memory_base, wasm_rt_local_memory_size, ");
@@ -5942,7 +6497,8 @@ void CWriter::Write(const SimdStoreLaneExpr& expr) {
       WABT_UNREACHABLE;
   }
   // clang-format on
-  Memory* memory = module_->memories[module_->GetMemoryIndex(expr.memidx)];
+  Memory* memory =
+      state_.module->memories[state_.module->GetMemoryIndex(expr.memidx)];
 
   Write(func, expr.val,
         "(wasm_rt_local_memory_base, wasm_rt_local_memory_size, ");
@@ -5974,7 +6530,8 @@ void CWriter::Write(const SimdShuffleOpExpr& expr) {
 }
 
 void CWriter::Write(const LoadSplatExpr& expr) {
-  Memory* memory = module_->memories[module_->GetMemoryIndex(expr.memidx)];
+  Memory* memory =
+      state_.module->memories[state_.module->GetMemoryIndex(expr.memidx)];
 
   const char* func = nullptr;
   // clang-format off
@@ -5999,7 +6556,8 @@ void CWriter::Write(const LoadSplatExpr& expr) {
 }
 
 void CWriter::Write(const LoadZeroExpr& expr) {
-  Memory* memory = module_->memories[module_->GetMemoryIndex(expr.memidx)];
+  Memory* memory =
+      state_.module->memories[state_.module->GetMemoryIndex(expr.memidx)];
 
   const char* func = nullptr;
   // clang-format off
@@ -6039,7 +6597,8 @@ void CWriter::Write(const AtomicLoadExpr& expr) {
   }
   // clang-format on
 
-  Memory* memory = module_->memories[module_->GetMemoryIndex(expr.memidx)];
+  Memory* memory =
+      state_.module->memories[state_.module->GetMemoryIndex(expr.memidx)];
   func = GetMemoryAPIString(*memory, func);
 
   Type result_type = expr.opcode.GetResultType();
@@ -6069,7 +6628,8 @@ void CWriter::Write(const AtomicStoreExpr& expr) {
   }
   // clang-format on
 
-  Memory* memory = module_->memories[module_->GetMemoryIndex(expr.memidx)];
+  Memory* memory =
+      state_.module->memories[state_.module->GetMemoryIndex(expr.memidx)];
   func = GetMemoryAPIString(*memory, func);
 
   Write(func, "(wasm_rt_local_memory_base, wasm_rt_local_memory_size, ");
@@ -6130,7 +6690,8 @@ void CWriter::Write(const AtomicRmwExpr& expr) {
   }
   // clang-format on
 
-  Memory* memory = module_->memories[module_->GetMemoryIndex(expr.memidx)];
+  Memory* memory =
+      state_.module->memories[state_.module->GetMemoryIndex(expr.memidx)];
   func = GetMemoryAPIString(*memory, func);
 
   Type result_type = expr.opcode.GetResultType();
@@ -6160,7 +6721,8 @@ void CWriter::Write(const AtomicRmwCmpxchgExpr& expr) {
   }
   // clang-format on
 
-  Memory* memory = module_->memories[module_->GetMemoryIndex(expr.memidx)];
+  Memory* memory =
+      state_.module->memories[state_.module->GetMemoryIndex(expr.memidx)];
   func = GetMemoryAPIString(*memory, func);
 
   Type result_type = expr.opcode.GetResultType();
@@ -6174,8 +6736,50 @@ void CWriter::Write(const AtomicRmwCmpxchgExpr& expr) {
   PushType(result_type);
 }
 
+void CWriter::Write(const AtomicWaitExpr& expr) {
+  std::string func;
+  // clang-format off
+  switch (expr.opcode) {
+    case Opcode::MemoryAtomicWait32: func = "memory_atomic_wait32"; break;
+    case Opcode::MemoryAtomicWait64: func = "memory_atomic_wait64"; break;
+    default:
+      WABT_UNREACHABLE;
+  }
+  // clang-format on
+
+  Memory* memory =
+      state_.module->memories[state_.module->GetMemoryIndex(expr.memidx)];
+  func = GetMemoryAPIString(*memory, func);
+
+  Type result_type = expr.opcode.GetResultType();
+
+  Write(StackVar(2, result_type), " = ", func,
+        "(wasm_rt_local_memory_base, wasm_rt_local_memory_size, ");
+  Write(ExternalInstancePtr(ModuleFieldType::Memory, memory->name), ", ");
+  WriteMemoryAddress(2, memory, expr.offset);
+  Write(", ", StackVar(1), ", ", StackVar(0), ");", Newline());
+  DropTypes(3);
+  PushType(result_type);
+}
+
+void CWriter::Write(const AtomicNotifyExpr& expr) {
+  Memory* memory =
+      state_.module->memories[state_.module->GetMemoryIndex(expr.memidx)];
+  std::string func = GetMemoryAPIString(*memory, "memory_atomic_notify");
+
+  Type result_type = expr.opcode.GetResultType();
+
+  Write(StackVar(1, result_type), " = ", func,
+        "(wasm_rt_local_memory_base, wasm_rt_local_memory_size, ");
+  Write(ExternalInstancePtr(ModuleFieldType::Memory, memory->name), ", ");
+  WriteMemoryAddress(1, memory, expr.offset);
+  Write(", ", StackVar(0), ");", Newline());
+  DropTypes(2);
+  PushType(result_type);
+}
+
 void CWriter::ReserveExportNames() {
-  for (const Export* export_ : module_->exports) {
+  for (const Export* export_ : state_.module->exports) {
     ReserveExportName(export_->name);
   }
 }
@@ -6183,7 +6787,7 @@ void CWriter::ReserveExportNames() {
 void CWriter::WriteCHeader() {
   ReserveExportNames();
 
-  stream_ = h_stream_;
+  stream_ = state_.h_stream;
   std::string guard = GenerateHeaderGuard();
   Write("/* Automatically generated by wasm2c */", Newline());
   Write("#ifndef ", guard, Newline());
@@ -6204,7 +6808,7 @@ void CWriter::WriteCHeader() {
   WriteImports();
   WriteImportProperties(CWriterPhase::Declarations);
   WriteExports(CWriterPhase::Declarations);
-  if (options_.features.tail_call_enabled()) {
+  if (state_.options.features.tail_call_enabled()) {
     WriteTailCallExports(CWriterPhase::Declarations);
   }
   Write(Newline());
@@ -6214,7 +6818,7 @@ void CWriter::WriteCHeader() {
 
 void CWriter::WriteCSource() {
   /* Write the "top" to h_impl stream */
-  stream_ = h_impl_stream_;
+  stream_ = state_.h_impl_stream;
   Write("/* Automatically generated by wasm2c */", Newline());
   WriteSourceTop();
 
@@ -6225,12 +6829,12 @@ void CWriter::WriteCSource() {
   WriteFuncDeclarations();
   WriteDataInitializerDecls();
   WriteElemInitializerDecls();
-  if (options_.features.tail_call_enabled()) {
+  if (state_.options.features.tail_call_enabled()) {
     WriteTailcalleeParamTypes();
   }
 
   /* Write the module-wide material to the first output stream */
-  stream_ = c_streams_.front();
+  stream_ = state_.c_streams.front();
   WriteMultiCTop();
   WriteFuncTypes();
   WriteTags();
@@ -6239,7 +6843,7 @@ void CWriter::WriteCSource() {
   WriteDataInitializers();
   WriteElemInitializers();
   WriteExports(CWriterPhase::Definitions);
-  if (options_.features.tail_call_enabled()) {
+  if (state_.options.features.tail_call_enabled()) {
     WriteTailCallExports(CWriterPhase::Definitions);
     WriteTailCallWeakImports();
   }
@@ -6250,6 +6854,7 @@ void CWriter::WriteCSource() {
   WriteGetFuncType();
 
   /* Write function bodies across the different output streams */
+  ComputeStaticTables();
   WriteFuncs();
 
   /* For any empty .c output, write a dummy typedef to avoid gcc warning */
@@ -6257,8 +6862,7 @@ void CWriter::WriteCSource() {
 }
 
 Result CWriter::WriteModule(const Module& module) {
-  WABT_USE(options_);
-  module_ = &module;
+  owned_state_->module = &module;
 
   WriteCHeader();
   if (Failed(result_)) {
@@ -6297,7 +6901,7 @@ const char* CWriter::GetReferenceNullValue(const Type& type) {
 }
 
 const char* CWriter::InternalSymbolScope() const {
-  if (c_streams_.size() == 1) {
+  if (state_.c_streams.size() == 1) {
     return "static ";
   } else {
     return "";
@@ -16,7 +16,10 @@
 
 #include "wabt/interp/binary-reader-interp.h"
 
+#include <algorithm>
+#include <iterator>
 #include <map>
+#include <mutex>
 #include <set>
 
 #include "wabt/binary-reader-nop.h"
@@ -60,6 +63,37 @@ struct Label {
   u32 handler_desc_index;
 };
 
+// The value stack of the function being read at some point in its istream,
+// as described by a StackMapDesc.
+struct StackLayout {
+  Index height;           // Counted from the first param.
+  std::vector<u32> refs;  // Sorted.
+};
+
+// An instruction that may start a superinstruction, as it was emitted.
+struct FusableInstr {
+  Opcode opcode;
+  Istream::Offset offset;
+  u32 imm;
+};
+
+// The number of instructions emitted before the last one of the longest
+// sequence that is fused.
+constexpr size_t kMaxFusablePrefix = 2;
+
+// Only the sequences listed in superinstructions.def are fused, so removing
+// an entry there turns its fusion off.
+bool IsListedSuperinstruction(Opcode fused) {
+  static constexpr Opcode::Enum kSuperinstructions[] = {
+#define WABT_SUPERINSTRUCTION(opcode, sequence) Opcode::opcode,
+#include "superinstructions.def"
+#undef WABT_SUPERINSTRUCTION
+  };
+
+  return std::find(std::begin(kSuperinstructions), std::end(kSuperinstructions),
+                   fused) != std::end(kSuperinstructions);
+}
+
 struct FixupMap {
   using Offset = Istream::Offset;
   using Fixups = std::vector<Offset>;
@@ -79,7 +113,8 @@ class BinaryReaderInterp : public BinaryReaderNop {
   BinaryReaderInterp(ModuleDesc* module,
                      std::string_view filename,
                      Errors* errors,
-                     const Features& features);
+                     const Features& features,
+                     const CompileOptions& compile_options);
 
   // Implement BinaryReader.
   bool OnError(const Error&) override;
@@ -299,6 +334,13 @@ class BinaryReaderInterp : public BinaryReaderNop {
   Result OnDataSegmentData(Index index, ByteSpan data) override;
 
  private:
+  friend class LazyFuncCompiler;
+
+  // Where a function body is in the module; see CompileOptions::lazy.
+  struct FuncBody {
+    Offset offset;
+    Offset size;
+  };
   Location GetLocation() const;
   Label* GetLabel(Index depth);
   Label* GetNearestTryLabel(Index depth);
@@ -331,12 +373,28 @@ class BinaryReaderInterp : public BinaryReaderNop {
               Index catch_drop_count);
 
   Result EmitBrCond(Opcode opcode, Index depth);
+  void EmitBrUnless(Opcode opcode);
 
   void FixupTopLabel();
-  u32 GetFuncOffset(Index func_index);
+
+  void BeginFuelBlock(Opcode opcode);
+  void EmitEpochCheck();
+  void EndFuelBlock();
+
+  void ResetStackLayout();
+  void PopStackLayout(Index count);
+  void DropKeepStackLayout(Index drop_count, Index keep_count);
+  void RecordStackMap();
+  void Truncate(Istream::Offset offset);
 
   Index TranslateLocalIndex(Index local_index);
 
+  void AddFusable(Opcode opcode, Istream::Offset offset, u32 imm = 0);
+  bool ShouldFuse(Opcode fused) const;
+  const FusableInstr* MatchFusable(Opcode fused,
+                                   std::initializer_list<Opcode> prefix);
+  void EmitBinop(Opcode opcode);
+
   Index num_func_imports() const;
 
   Errors* errors_ = nullptr;
@@ -348,17 +406,41 @@ class BinaryReaderInterp : public BinaryReaderNop {
   FuncDesc* func_;
   std::vector<Label> label_stack_;
   FixupMap depth_fixups_;
-  FixupMap func_fixups_;
 
   u32 local_decl_count_;
   u32 local_count_;
 
+  // Stack maps are only recorded for function bodies, not init expressions.
+  bool in_function_body_ = false;
+  // The params and locals that are references.
+  std::vector<u32> local_refs_;
+  // The layout of the value stack when the last emitted instruction has run.
+  // This is taken from the validator before each instruction is read, and
+  // updated by the instructions that are emitted to lower it.
+  StackLayout stack_layout_;
+  // The fuel instruction of the current basic block, and the number of
+  // instructions read since it was emitted.
+  Istream::Offset fuel_fixup_ = Istream::kInvalidOffset;
+  u32 fuel_cost_ = 0;
+
   std::vector<FuncType> func_types_;      // Includes imported and defined.
   std::vector<TableType> table_types_;    // Includes imported and defined.
   std::vector<MemoryType> memory_types_;  // Includes imported and defined.
   std::vector<GlobalType> global_types_;  // Includes imported and defined.
   std::vector<TagType> tag_types_;        // Includes imported and defined.
 
+  CompileOptions compile_options_;
+  // The most recently emitted instructions that may start a superinstruction.
+  // Cleared whenever any other instruction is read, so these are always
+  // contiguous and end at istream_.end().
+  std::vector<FusableInstr> fusable_;
+
+  // With CompileOptions::lazy, the bodies are only recorded until the end of
+  // the module, and compiled later by a LazyFuncCompiler.
+  bool defer_function_bodies_;
+  std::vector<FuncBody> func_bodies_;  // Indexed like module_.funcs.
+  Index data_count_ = kInvalidIndex;
+
   std::string_view filename_;
 };
 
@@ -390,11 +472,14 @@ void FixupMap::Resolve(Istream& istream, Index index) {
 BinaryReaderInterp::BinaryReaderInterp(ModuleDesc* module,
                                        std::string_view filename,
                                        Errors* errors,
-                                       const Features& features)
+                                       const Features& features,
+                                       const CompileOptions& compile_options)
     : errors_(errors),
       module_(*module),
       istream_(module->istream),
       validator_(errors, filename, ValidateOptions(features)),
+      compile_options_(compile_options),
+      defer_function_bodies_(compile_options.lazy),
       filename_(filename) {}
 
 Label* BinaryReaderInterp::GetLabel(Index depth) {
@@ -472,6 +557,7 @@ void BinaryReaderInterp::EmitBr(Index depth,
                                 Index keep_count,
                                 Index catch_drop_count) {
   istream_.EmitDropKeep(drop_count, keep_count);
+  DropKeepStackLayout(drop_count, keep_count);
   istream_.EmitCatchDrop(catch_drop_count);
   Istream::Offset offset = GetLabel(depth)->offset;
   istream_.Emit(Opcode::Br);
@@ -489,8 +575,12 @@ Result BinaryReaderInterp::EmitBrCond(Opcode opcode, Index depth) {
   CHECK_RESULT(validator_.GetCatchCount(depth, &catch_drop_count));
   // The opcode is flipped so if <cond> is
   // true it can drop values from the stack.
-  istream_.Emit(opcode);
+  EmitBrUnless(opcode);
   auto fixup = istream_.EmitFixupU32();
+  // The flipped br_on_non_null keeps the reference when it falls through.
+  if (opcode != Opcode::BrOnNull) {
+    PopStackLayout(1);
+  }
   // The validator for br_on_null keeps the (non-null) reference on
   // the stack. This reference needs to be ignored when the branch
   // is executed. Note: opcode contains the flipped value.
@@ -502,17 +592,169 @@ Result BinaryReaderInterp::EmitBrCond(Opcode opcode, Index depth) {
   return Result::Ok;
 }
 
+// Emits the opcode of a conditional branch, without its target. A
+// br_unless whose condition is i32.eqz or i32.eq is fused with it.
+void BinaryReaderInterp::EmitBrUnless(Opcode opcode) {
+  if (opcode == Opcode::InterpBrUnless) {
+    if (auto* prefix =
+            MatchFusable(Opcode::InterpBrUnlessI32Eqz, {Opcode::I32Eqz})) {
+      Truncate(prefix[0].offset);
+      istream_.Emit(Opcode::InterpBrUnlessI32Eqz);
+      return;
+    }
+    if (auto* prefix =
+            MatchFusable(Opcode::InterpBrUnlessI32Eq, {Opcode::I32Eq})) {
+      Truncate(prefix[0].offset);
+      istream_.Emit(Opcode::InterpBrUnlessI32Eq);
+      return;
+    }
+  }
+  istream_.Emit(opcode);
+  fusable_.clear();
+}
+
+// Emits a binop or compare. An i32.add or i32.and whose operands are pushed by
+// `local.get; i32.const`, or an i32.add of two locals, is fused with them.
+void BinaryReaderInterp::EmitBinop(Opcode opcode) {
+  if (opcode == Opcode::I32Add || opcode == Opcode::I32And) {
+    Opcode fused = opcode == Opcode::I32Add ? Opcode::InterpI32AddLocalConst
+                                            : Opcode::InterpI32AndLocalConst;
+    if (auto* prefix =
+            MatchFusable(fused, {Opcode::LocalGet, Opcode::I32Const})) {
+      Istream::Offset offset = prefix[0].offset;
+      Index local_index = prefix[0].imm;
+      u32 value = prefix[1].imm;
+      Truncate(offset);
+      istream_.Emit(fused, local_index, value);
+      // A following local.set may be fused with it too.
+      AddFusable(fused, offset);
+      return;
+    }
+  }
+  if (opcode == Opcode::I32Add) {
+    if (auto* prefix = MatchFusable(Opcode::InterpI32AddLocals,
+                                    {Opcode::LocalGet, Opcode::LocalGet})) {
+      // The fused instruction runs at the stack height of the first local.get,
+      // so the index that was translated at a greater height is adjusted.
+      Index lhs_index = prefix[0].imm;
+      Index rhs_index = prefix[1].imm - 1;
+      Truncate(prefix[0].offset);
+      istream_.Emit(Opcode::InterpI32AddLocals, lhs_index, rhs_index);
+      return;
+    }
+  }
+  Istream::Offset offset = istream_.end();
+  istream_.Emit(opcode);
+  AddFusable(opcode, offset);
+}
+
 void BinaryReaderInterp::FixupTopLabel() {
   depth_fixups_.Resolve(istream_, label_stack_.size() - 1);
 }
 
-u32 BinaryReaderInterp::GetFuncOffset(Index func_index) {
-  assert(func_index >= num_func_imports());
-  FuncDesc& func = module_.funcs[func_index - num_func_imports()];
-  if (func.code_offset == Istream::kInvalidOffset) {
-    func_fixups_.Append(func_index, istream_.end());
+// Starts a basic block with an instruction that charges its cost against the
+// thread's fuel. Every instruction that is read until the next basic block
+// starts is part of this one. Branches that leave the block early are charged
+// for the whole block anyway, which keeps the cost deterministic.
+void BinaryReaderInterp::BeginFuelBlock(Opcode opcode) {
+  if (!compile_options_.meter_fuel) {
+    return;
+  }
+  EndFuelBlock();
+  istream_.Emit(opcode);
+  fuel_fixup_ = istream_.EmitFixupU32();
+  fuel_cost_ = 0;
+  fusable_.clear();
+}
+
+void BinaryReaderInterp::EndFuelBlock() {
+  if (fuel_fixup_ != Istream::kInvalidOffset) {
+    istream_.ResolveFixupU32(fuel_fixup_, fuel_cost_);
+    fuel_fixup_ = Istream::kInvalidOffset;
+  }
+}
+
+void BinaryReaderInterp::EmitEpochCheck() {
+  if (compile_options_.epoch_interruption) {
+    istream_.Emit(Opcode::InterpCheckEpoch);
+  }
+}
+
+// Sets the stack layout to the validator's type stack, which is the layout
+// between two instructions.
+void BinaryReaderInterp::ResetStackLayout() {
+  const TypeVector& type_stack = validator_.type_stack();
+  Index local_count = validator_.GetLocalCount();
+  stack_layout_.height = local_count + type_stack.size();
+  stack_layout_.refs = local_refs_;
+  for (Index i = 0; i < type_stack.size(); ++i) {
+    if (type_stack[i].IsRef()) {
+      stack_layout_.refs.push_back(local_count + i);
+    }
+  }
+}
+
+void BinaryReaderInterp::PopStackLayout(Index count) {
+  // Unreachable code may pop more than the stack holds.
+  Index height = stack_layout_.height;
+  height = height > count ? height - count : 0;
+  auto& refs = stack_layout_.refs;
+  refs.erase(std::lower_bound(refs.begin(), refs.end(), height), refs.end());
+  stack_layout_.height = height;
+}
+
+// Updates the stack layout for a drop_keep that was just emitted, and records
+// it for the instructions that follow.
+void BinaryReaderInterp::DropKeepStackLayout(Index drop_count,
+                                             Index keep_count) {
+  Index height = stack_layout_.height;
+  if (drop_count == 0 || height < drop_count + keep_count) {
+    return;
+  }
+  Index keep_start = height - keep_count;
+  Index drop_start = keep_start - drop_count;
+  auto& refs = stack_layout_.refs;
+  auto out = std::lower_bound(refs.begin(), refs.end(), drop_start);
+  for (auto in = std::lower_bound(out, refs.end(), keep_start);
+       in != refs.end(); ++in) {
+    *out++ = *in - drop_count;
+  }
+  refs.erase(out, refs.end());
+  stack_layout_.height = height - drop_count;
+  RecordStackMap();
+}
+
+// Records the stack layout as the stack map for istream_.end(). A map is only
+// added if the previous one doesn't already describe the live slots.
+void BinaryReaderInterp::RecordStackMap() {
+  if (!in_function_body_) {
+    return;
+  }
+  auto& maps = func_->stack_maps;
+  const auto& refs = stack_layout_.refs;
+  Istream::Offset offset = istream_.end();
+  if (!maps.empty()) {
+    StackMapDesc& last = maps.back();
+    auto live_end = std::lower_bound(last.refs.begin(), last.refs.end(),
+                                     stack_layout_.height);
+    if (std::equal(last.refs.begin(), live_end, refs.begin(), refs.end())) {
+      return;
+    }
+    if (last.offset == offset) {
+      last.refs = refs;
+      return;
+    }
+  }
+  maps.push_back(StackMapDesc{offset, refs});
+}
+
+// Removes the instructions after `offset`, along with their stack maps.
+void BinaryReaderInterp::Truncate(Istream::Offset offset) {
+  istream_.Truncate(offset);
+  auto& maps = func_->stack_maps;
+  while (!maps.empty() && maps.back().offset > offset) {
+    maps.pop_back();
   }
-  return func.code_offset;
 }
 
 bool BinaryReaderInterp::OnError(const Error& error) {
@@ -522,6 +764,7 @@ bool BinaryReaderInterp::OnError(const Error& error) {
 
 Result BinaryReaderInterp::EndModule() {
   CHECK_RESULT(validator_.EndModule());
+  defer_function_bodies_ = false;
   return Result::Ok;
 }
 
@@ -624,7 +867,8 @@ Result BinaryReaderInterp::OnFunction(Index index, Index sig_index) {
   CHECK_RESULT(
       validator_.OnFunction(GetLocation(), Var(sig_index, GetLocation())));
   FuncType& func_type = module_.func_types[sig_index];
-  module_.funcs.push_back(FuncDesc{func_type, {}, Istream::kInvalidOffset, {}});
+  module_.funcs.push_back(
+      FuncDesc{func_type, {}, Istream::kInvalidOffset, {}, {}});
   func_types_.push_back(func_type);
   return Result::Ok;
 }
@@ -643,7 +887,7 @@ Result BinaryReaderInterp::BeginTable(Index index,
                                   init_provided));
   TableType table_type{elem_type, *elem_limits};
   FuncDesc init_func{
-      FuncType{{}, {elem_type}}, {}, Istream::kInvalidOffset, {}};
+      FuncType{{}, {elem_type}}, {}, Istream::kInvalidOffset, {}, {}};
   module_.tables.push_back(TableDesc{table_type, init_func});
   table_types_.push_back(table_type);
   return Result::Ok;
@@ -685,7 +929,7 @@ Result BinaryReaderInterp::OnGlobalCount(Index count) {
 Result BinaryReaderInterp::BeginGlobal(Index index, Type type, bool mutable_) {
   CHECK_RESULT(validator_.OnGlobal(GetLocation(), type, mutable_));
   GlobalType global_type{type, ToMutability(mutable_)};
-  FuncDesc init_func{FuncType{{}, {type}}, {}, Istream::kInvalidOffset, {}};
+  FuncDesc init_func{FuncType{{}, {type}}, {}, Istream::kInvalidOffset, {}, {}};
   module_.globals.push_back(GlobalDesc{global_type, init_func});
   global_types_.push_back(global_type);
   return Result::Ok;
@@ -778,7 +1022,7 @@ Result BinaryReaderInterp::BeginElemSegment(Index index,
     offset_type = ValueType::I64;
   }
   FuncDesc init_func{
-      FuncType{{}, {offset_type}}, {}, Istream::kInvalidOffset, {}};
+      FuncType{{}, {offset_type}}, {}, Istream::kInvalidOffset, {}, {}};
   ElemDesc desc{{}, ValueType::Void, mode, table_index, init_func};
   module_.elems.push_back(desc);
   return Result::Ok;
@@ -810,7 +1054,7 @@ Result BinaryReaderInterp::BeginElemExpr(Index elem_index, Index expr_index) {
   assert(elem_index == module_.elems.size() - 1);
   ElemDesc& elem = module_.elems.back();
   elem.elements.push_back(
-      {FuncType{{}, {elem.type}}, {}, Istream::kInvalidOffset, {}});
+      {FuncType{{}, {elem.type}}, {}, Istream::kInvalidOffset, {}, {}});
   assert(expr_index == elem.elements.size() - 1);
   return BeginInitExpr(&elem.elements.back());
 }
@@ -821,6 +1065,7 @@ Result BinaryReaderInterp::EndElemExpr(Index elem_index, Index expr_index) {
 
 Result BinaryReaderInterp::OnDataCount(Index count) {
   validator_.OnDataCount(count);
+  data_count_ = count;
   module_.datas.reserve(std::min(count, kMaxPreallocatedBufferSize));
   return Result::Ok;
 }
@@ -847,7 +1092,7 @@ Result BinaryReaderInterp::BeginDataSegment(Index index,
     offset_type = ValueType::I64;
   }
   FuncDesc init_func{
-      FuncType{{}, {offset_type}}, {}, Istream::kInvalidOffset, {}};
+      FuncType{{}, {offset_type}}, {}, Istream::kInvalidOffset, {}, {}};
   DataDesc desc{{}, mode, memory_index, init_func};
   module_.datas.push_back(desc);
   return Result::Ok;
@@ -872,16 +1117,19 @@ void BinaryReaderInterp::PopLabel() {
 
 Result BinaryReaderInterp::BeginFunctionBody(Index index, Offset size) {
   Index defined_index = index - num_func_imports();
+  if (defer_function_bodies_) {
+    module_.funcs[defined_index].lazy_index = defined_index;
+    func_bodies_.push_back(FuncBody{state->offset, size});
+    return Result::Ok;
+  }
+
   func_ = &module_.funcs[defined_index];
   func_->code_offset = istream_.end();
 
   depth_fixups_.Clear();
   label_stack_.clear();
-
-  // The fixups map is keyed by actual function index (not defined_index)
-  // (function imports don't have code and won't appear in the fixups map,
-  // but they still use function indexes)
-  func_fixups_.Resolve(istream_, index);
+  fusable_.clear();
+  in_function_body_ = true;
 
   CHECK_RESULT(validator_.BeginFunctionBody(GetLocation(), index));
 
@@ -895,14 +1143,21 @@ Result BinaryReaderInterp::BeginFunctionBody(Index index, Offset size) {
 }
 
 Result BinaryReaderInterp::EndFunctionBody(Index index) {
+  if (defer_function_bodies_) {
+    return Result::Ok;
+  }
+
   FixupTopLabel();
   Index drop_count, keep_count;
   CHECK_RESULT(GetReturnDropKeepCount(&drop_count, &keep_count));
   CHECK_RESULT(validator_.EndFunctionBody(GetLocation()));
   istream_.EmitDropKeep(drop_count, keep_count);
+  DropKeepStackLayout(drop_count, keep_count);
   istream_.Emit(Opcode::Return);
   PopLabel();
+  EndFuelBlock();
   func_ = nullptr;
+  in_function_body_ = false;
   return Result::Ok;
 }
 
@@ -923,14 +1178,28 @@ Result BinaryReaderInterp::OnLocalDecl(Index decl_index,
 }
 
 Result BinaryReaderInterp::EndLocalDecls() {
-  if (local_count_ != 0) {
-    istream_.Emit(Opcode::InterpAlloca, local_count_);
-    for (Index i = 0; i < local_count_; i++) {
-      if (func_->GetLocalType(func_->type.params.size() + i).IsRef()) {
-        istream_.Emit(Opcode::InterpMarkRef, local_count_ - i);
+  Index param_count = func_->type.params.size();
+  local_refs_.clear();
+  for (Index i = 0; i < param_count; ++i) {
+    if (func_->type.params[i].IsRef()) {
+      local_refs_.push_back(i);
+    }
+  }
+  // Only the params are on the stack until the alloca has run.
+  stack_layout_.height = param_count;
+  stack_layout_.refs = local_refs_;
+  RecordStackMap();
+
+  for (const LocalDesc& local : func_->locals) {
+    if (local.type.IsRef()) {
+      for (Index i = local.end - local.count; i < local.end; ++i) {
+        local_refs_.push_back(param_count + i);
       }
     }
   }
+  if (local_count_ != 0) {
+    istream_.Emit(Opcode::InterpAlloca, local_count_);
+  }
   // Continuation of the implicit func label, used for exception handling. (See
   // BeginFunctionBody.)
   // We need the local count for this, which is only available after processing
@@ -943,7 +1212,9 @@ Result BinaryReaderInterp::EndLocalDecls() {
                                         {Istream::kInvalidOffset},
                                         static_cast<u32>(local_count_),
                                         0});
-
+  // Calls are checked on entry.
+  EmitEpochCheck();
+  BeginFuelBlock(Opcode::InterpCheckFuel);
   return Result::Ok;
 }
 
@@ -956,6 +1227,30 @@ Result BinaryReaderInterp::OnOpcode(Opcode opcode) {
     PrintError("Unexpected instruction after end of function");
     return Result::Error;
   }
+  // Any instruction that can't be part of a superinstruction ends the
+  // sequence. This also keeps branches from targeting the middle of a fused
+  // sequence, since loop is the only label that is bound where it appears.
+  switch (opcode) {
+    case Opcode::LocalGet:
+    case Opcode::LocalSet:
+    case Opcode::I32Const:
+    case Opcode::I32Add:
+    case Opcode::I32And:
+    case Opcode::I32Eqz:
+    case Opcode::I32Eq:
+    case Opcode::I32Load:
+    case Opcode::I32Load8U:
+    case Opcode::BrIf:
+    case Opcode::If:
+      break;
+
+    default:
+      fusable_.clear();
+      break;
+  }
+  ResetStackLayout();
+  RecordStackMap();
+  ++fuel_cost_;
   return Result::Ok;
 }
 
@@ -1079,7 +1374,7 @@ Result BinaryReaderInterp::OnAtomicRmwCmpxchgExpr(Opcode opcode,
 
 Result BinaryReaderInterp::OnBinaryExpr(Opcode opcode) {
   CHECK_RESULT(validator_.OnBinary(GetLocation(), opcode));
-  istream_.Emit(opcode);
+  EmitBinop(opcode);
   return Result::Ok;
 }
 
@@ -1092,14 +1387,18 @@ Result BinaryReaderInterp::OnBlockExpr(Type sig_type) {
 Result BinaryReaderInterp::OnLoopExpr(Type sig_type) {
   CHECK_RESULT(validator_.OnLoop(GetLocation(), sig_type));
   PushLabel(LabelKind::Block, istream_.end());
+  // Back-edges are checked at the loop header.
+  EmitEpochCheck();
+  BeginFuelBlock(Opcode::InterpCheckFuel);
   return Result::Ok;
 }
 
 Result BinaryReaderInterp::OnIfExpr(Type sig_type) {
   CHECK_RESULT(validator_.OnIf(GetLocation(), sig_type));
-  istream_.Emit(Opcode::InterpBrUnless);
+  EmitBrUnless(Opcode::InterpBrUnless);
   auto fixup = istream_.EmitFixupU32();
   PushLabel(LabelKind::Block, Istream::kInvalidOffset, fixup);
+  BeginFuelBlock(Opcode::InterpConsumeFuel);
   return Result::Ok;
 }
 
@@ -1110,6 +1409,7 @@ Result BinaryReaderInterp::OnElseExpr() {
   istream_.Emit(Opcode::Br);
   label->fixup_offset = istream_.EmitFixupU32();
   istream_.ResolveFixupU32(fixup_cond_offset);
+  BeginFuelBlock(Opcode::InterpConsumeFuel);
   return Result::Ok;
 }
 
@@ -1140,6 +1440,7 @@ Result BinaryReaderInterp::OnEndExpr() {
   }
   FixupTopLabel();
   PopLabel();
+  BeginFuelBlock(Opcode::InterpConsumeFuel);
   return Result::Ok;
 }
 
@@ -1177,6 +1478,10 @@ Result BinaryReaderInterp::OnBrTableExpr(Index num_targets,
   CHECK_RESULT(validator_.BeginBrTable(GetLocation()));
   Index drop_count, keep_count, catch_drop_count;
   istream_.Emit(Opcode::BrTable, num_targets);
+  // Every entry starts with the key popped, since br_table jumps into the
+  // middle of the table.
+  PopStackLayout(1);
+  const StackLayout table_layout = stack_layout_;
 
   for (Index i = 0; i < num_targets; ++i) {
     Index depth = target_depths[i];
@@ -1184,9 +1489,12 @@ Result BinaryReaderInterp::OnBrTableExpr(Index num_targets,
         validator_.OnBrTableTarget(GetLocation(), Var(depth, GetLocation())));
     CHECK_RESULT(GetBrDropKeepCount(depth, &drop_count, &keep_count));
     CHECK_RESULT(validator_.GetCatchCount(depth, &catch_drop_count));
+    stack_layout_ = table_layout;
+    RecordStackMap();
     // Emit DropKeep directly (instead of using EmitDropKeep) so the
     // instruction has a fixed size. Same for CatchDrop as well.
     istream_.Emit(Opcode::InterpDropKeep, drop_count, keep_count);
+    DropKeepStackLayout(drop_count, keep_count);
     istream_.Emit(Opcode::InterpCatchDrop, catch_drop_count);
     EmitBr(depth, 0, 0, 0);
   }
@@ -1196,8 +1504,11 @@ Result BinaryReaderInterp::OnBrTableExpr(Index num_targets,
       GetBrDropKeepCount(default_target_depth, &drop_count, &keep_count));
   CHECK_RESULT(
       validator_.GetCatchCount(default_target_depth, &catch_drop_count));
+  stack_layout_ = table_layout;
+  RecordStackMap();
   // The default case doesn't need a fixed size, since it is never jumped over.
   istream_.EmitDropKeep(drop_count, keep_count);
+  DropKeepStackLayout(drop_count, keep_count);
   istream_.Emit(Opcode::InterpCatchDrop, catch_drop_count);
   EmitBr(default_target_depth, 0, 0, 0);
 
@@ -1251,14 +1562,12 @@ Result BinaryReaderInterp::OnReturnCallExpr(Index func_index) {
   CHECK_RESULT(
       validator_.OnReturnCall(GetLocation(), Var(func_index, GetLocation())));
   istream_.EmitDropKeep(drop_count, keep_count);
+  DropKeepStackLayout(drop_count, keep_count);
   istream_.EmitCatchDrop(catch_drop_count);
 
   if (func_index >= num_func_imports()) {
+    // This also jumps to the start of the function.
     istream_.Emit(Opcode::InterpAdjustFrameForReturnCall, func_index);
-    istream_.Emit(Opcode::Br);
-    // We emit this separately to ensure that the fixup generated by
-    // GetFuncOffset comes after the Br opcode.
-    istream_.Emit(GetFuncOffset(func_index));
   } else {
     istream_.Emit(Opcode::InterpCallImport, func_index);
     istream_.Emit(Opcode::Return);
@@ -1287,6 +1596,7 @@ Result BinaryReaderInterp::OnReturnCallIndirectExpr(Index sig_index,
       GetLocation(), Var(sig_index, GetLocation()),
       Var(table_index, GetLocation())));
   istream_.EmitDropKeep(drop_count, keep_count);
+  DropKeepStackLayout(drop_count, keep_count);
   istream_.EmitCatchDrop(catch_drop_count);
   istream_.Emit(Opcode::ReturnCallIndirect, table_index, sig_index);
   return Result::Ok;
@@ -1302,13 +1612,15 @@ Result BinaryReaderInterp::OnReturnCallRefExpr(Type sig_type) {
 
 Result BinaryReaderInterp::OnCompareExpr(Opcode opcode) {
   CHECK_RESULT(validator_.OnCompare(GetLocation(), opcode));
-  istream_.Emit(opcode);
+  EmitBinop(opcode);
   return Result::Ok;
 }
 
 Result BinaryReaderInterp::OnConvertExpr(Opcode opcode) {
   CHECK_RESULT(validator_.OnConvert(GetLocation(), opcode));
+  Istream::Offset offset = istream_.end();
   istream_.Emit(opcode);
+  AddFusable(opcode, offset);
   return Result::Ok;
 }
 
@@ -1320,7 +1632,9 @@ Result BinaryReaderInterp::OnDropExpr() {
 
 Result BinaryReaderInterp::OnI32ConstExpr(uint32_t value) {
   CHECK_RESULT(validator_.OnConst(GetLocation(), Type::I32));
+  Istream::Offset offset = istream_.end();
   istream_.Emit(Opcode::I32Const, value);
+  AddFusable(Opcode::I32Const, offset, value);
   return Result::Ok;
 }
 
@@ -1352,12 +1666,7 @@ Result BinaryReaderInterp::OnGlobalGetExpr(Index global_index) {
   CHECK_RESULT(
       validator_.OnGlobalGet(GetLocation(), Var(global_index, GetLocation())));
 
-  Type type = global_types_.at(global_index).type;
-  if (type.IsRef()) {
-    istream_.Emit(Opcode::InterpGlobalGetRef, global_index);
-  } else {
-    istream_.Emit(Opcode::GlobalGet, global_index);
-  }
+  istream_.Emit(Opcode::GlobalGet, global_index);
   return Result::Ok;
 }
 
@@ -1373,6 +1682,46 @@ Index BinaryReaderInterp::TranslateLocalIndex(Index local_index) {
          local_index;
 }
 
+void BinaryReaderInterp::AddFusable(Opcode opcode,
+                                    Istream::Offset offset,
+                                    u32 imm) {
+  if (!compile_options_.superinstructions) {
+    return;
+  }
+  if (fusable_.size() == kMaxFusablePrefix) {
+    fusable_.erase(fusable_.begin());
+  }
+  fusable_.push_back(FusableInstr{opcode, offset, imm});
+}
+
+bool BinaryReaderInterp::ShouldFuse(Opcode fused) const {
+  return compile_options_.superinstructions && IsListedSuperinstruction(fused);
+}
+
+// Returns the first of the last emitted instructions if they match `prefix`
+// and the superinstruction `fused` should be used, or nullptr otherwise. The
+// caller truncates the istream to its offset before emitting `fused`.
+const FusableInstr* BinaryReaderInterp::MatchFusable(
+    Opcode fused,
+    std::initializer_list<Opcode> prefix) {
+  assert(prefix.size() <= kMaxFusablePrefix);
+  if (fusable_.size() < prefix.size() || !ShouldFuse(fused)) {
+    return nullptr;
+  }
+  const FusableInstr* first = fusable_.data() + fusable_.size() - prefix.size();
+  const FusableInstr* instr = first;
+  for (Opcode opcode : prefix) {
+    if (instr->opcode != opcode) {
+      return nullptr;
+    }
+    ++instr;
+  }
+  // The matched instructions are replaced, so they can't start another
+  // superinstruction.
+  fusable_.clear();
+  return first;
+}
+
 Result BinaryReaderInterp::OnLocalGetExpr(Index local_index) {
   // Get the translated index before calling validator_.OnLocalGet because it
   // will update the type stack size. We need the index to be relative to the
@@ -1381,12 +1730,9 @@ Result BinaryReaderInterp::OnLocalGetExpr(Index local_index) {
   CHECK_RESULT(
       validator_.OnLocalGet(GetLocation(), Var(local_index, GetLocation())));
 
-  Type type = func_->GetLocalType(local_index);
-  if (type.IsRef()) {
-    istream_.Emit(Opcode::InterpLocalGetRef, translated_local_index);
-  } else {
-    istream_.Emit(Opcode::LocalGet, translated_local_index);
-  }
+  Istream::Offset offset = istream_.end();
+  istream_.Emit(Opcode::LocalGet, translated_local_index);
+  AddFusable(Opcode::LocalGet, offset, translated_local_index);
   return Result::Ok;
 }
 
@@ -1396,7 +1742,19 @@ Result BinaryReaderInterp::OnLocalSetExpr(Index local_index) {
   CHECK_RESULT(
       validator_.OnLocalSet(GetLocation(), Var(local_index, GetLocation())));
 
+  if (auto* prefix = MatchFusable(Opcode::InterpI32AddLocalConstSet,
+                                  {Opcode::InterpI32AddLocalConst})) {
+    // The sum is written to the local instead of being pushed, so the local's
+    // index is translated at the height it was pushed at.
+    Istream::Offset offset = prefix[0].offset;
+    Instr instr = istream_.Read(&offset);
+    Truncate(prefix[0].offset);
+    istream_.Emit(Opcode::InterpI32AddLocalConstSet, instr.imm_u32x2.fst,
+                  instr.imm_u32x2.snd, translated_local_index - 1);
+    return Result::Ok;
+  }
   istream_.Emit(Opcode::LocalSet, translated_local_index);
+  fusable_.clear();
   return Result::Ok;
 }
 
@@ -1415,7 +1773,18 @@ Result BinaryReaderInterp::OnLoadExpr(Opcode opcode,
   CHECK_RESULT(validator_.OnLoad(GetLocation(), opcode,
                                  Var(memidx, GetLocation()),
                                  GetAlignment(align_log2), offset));
+  if (opcode == Opcode::I32Load || opcode == Opcode::I32Load8U) {
+    Opcode fused = opcode == Opcode::I32Load ? Opcode::InterpI32LoadLocal
+                                             : Opcode::InterpI32Load8ULocal;
+    if (auto* prefix = MatchFusable(fused, {Opcode::LocalGet})) {
+      Index local_index = prefix[0].imm;
+      Truncate(prefix[0].offset);
+      istream_.Emit(fused, memidx, local_index, offset);
+      return Result::Ok;
+    }
+  }
   istream_.Emit(opcode, memidx, offset);
+  fusable_.clear();
   return Result::Ok;
 }
 
@@ -1502,6 +1871,7 @@ Result BinaryReaderInterp::OnReturnExpr() {
       validator_.GetCatchCount(label_stack_.size() - 1, &catch_drop_count));
   CHECK_RESULT(validator_.OnReturn(GetLocation()));
   istream_.EmitDropKeep(drop_count, keep_count);
+  DropKeepStackLayout(drop_count, keep_count);
   istream_.EmitCatchDrop(catch_drop_count);
   istream_.Emit(Opcode::Return);
   return Result::Ok;
@@ -1672,6 +2042,10 @@ Result BinaryReaderInterp::OnTryTableExpr(Type sig_type,
   // NOTE: *NOT* GetLocalCount. we don't count the parameters, as they're not
   // part of the frame.
   u32 value_stack_height = validator_.type_stack_size() + local_count_;
+  // A handler starts with the stack reset to this height and the caught
+  // exception's values pushed.
+  ResetStackLayout();
+  const StackLayout try_layout = stack_layout_;
 
   HandlerDesc desc =
       HandlerDesc{HandlerKind::Catch,        Istream::kInvalidOffset,
@@ -1702,6 +2076,19 @@ Result BinaryReaderInterp::OnTryTableExpr(Type sig_type,
       desc.catches.push_back(
           CatchDesc{raw_catch.tag, istream_.end(), catch_.IsRef()});
     }
+    stack_layout_ = try_layout;
+    if (!catch_.IsCatchAll()) {
+      for (Type type : tag_types_[raw_catch.tag].signature) {
+        if (type.IsRef()) {
+          stack_layout_.refs.push_back(stack_layout_.height);
+        }
+        stack_layout_.height++;
+      }
+    }
+    if (catch_.IsRef()) {
+      stack_layout_.refs.push_back(stack_layout_.height++);
+    }
+    RecordStackMap();
     // we can't use GetBrDropKeepCount because we're not in a real block.
     SharedValidator::Label* vlabel;
     CHECK_RESULT(validator_.GetLabel(raw_catch.depth, &vlabel));
@@ -1761,6 +2148,7 @@ Result BinaryReaderInterp::OnCatchExpr(Index tag_index) {
   // try blocks to use as a delegate target.
   label->kind = LabelKind::Block;
   desc.catches.push_back(CatchDesc{tag_index, istream_.end()});
+  BeginFuelBlock(Opcode::InterpConsumeFuel);
   return Result::Ok;
 }
 
@@ -1782,6 +2170,7 @@ Result BinaryReaderInterp::OnCatchAllExpr() {
   }
   label->kind = LabelKind::Block;
   desc.catch_all_offset = istream_.end();
+  BeginFuelBlock(Opcode::InterpConsumeFuel);
   return Result::Ok;
 }
 
@@ -1802,23 +2191,134 @@ Result BinaryReaderInterp::OnDelegateExpr(Index depth) {
   desc.delegate_handler_index = target_label->handler_desc_index;
   FixupTopLabel();
   PopLabel();
+  BeginFuelBlock(Opcode::InterpConsumeFuel);
   return Result::Ok;
 }
 
+// Keeps the reader of a module that was read with CompileOptions::lazy, with
+// the module-level state it had at the end of the module, so that each
+// function body can be validated and compiled later as if it were read in
+// place. It is shared by the copies of the ModuleDesc, which may be used by
+// several threads.
+class LazyFuncCompiler {
+ public:
+  LazyFuncCompiler(std::string_view filename,
+                   ByteSpan data,
+                   const ReadBinaryOptions& options,
+                   const CompileOptions& compile_options,
+                   Istream::Encoding encoding);
+
+  Result ReadModule(Errors*, ModuleDesc* out_module);
+  Result Compile(ModuleDesc* module, Index index, std::string* out_error);
+
+ private:
+  std::string filename_;
+  std::vector<u8> data_;
+  ReadBinaryOptions options_;
+  Errors errors_;
+  // Only func_types and funcs are kept once the module has been read; the
+  // istream is swapped in from the ModuleDesc that is being compiled.
+  ModuleDesc module_;
+  BinaryReaderInterp reader_;
+  std::mutex mutex_;
+};
+
+LazyFuncCompiler::LazyFuncCompiler(std::string_view filename,
+                                   ByteSpan data,
+                                   const ReadBinaryOptions& options,
+                                   const CompileOptions& compile_options,
+                                   Istream::Encoding encoding)
+    : filename_(filename),
+      data_(data.begin(), data.end()),
+      options_(options),
+      reader_(&module_,
+              filename_,
+              &errors_,
+              options.features,
+              compile_options) {
+  module_.istream = Istream(encoding);
+}
+
+Result LazyFuncCompiler::ReadModule(Errors* errors, ModuleDesc* out_module) {
+  ReadBinaryOptions options = options_;
+  options.skip_function_bodies = true;
+  // The log stream isn't kept for the bodies, which are read much later.
+  options_.log_stream = nullptr;
+  Result result = ReadBinary(data_, &reader_, options);
+  errors->insert(errors->end(), errors_.begin(), errors_.end());
+  errors_.clear();
+  CHECK_RESULT(result);
+
+  *out_module = std::move(module_);
+  module_ = ModuleDesc();
+  module_.func_types = out_module->func_types;
+  module_.funcs = out_module->funcs;
+  return Result::Ok;
+}
+
+Result LazyFuncCompiler::Compile(ModuleDesc* module,
+                                 Index index,
+                                 std::string* out_error) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  // Start from the uncompiled FuncDesc, since an earlier attempt may have
+  // failed part way through.
+  FuncDesc& func = module_.funcs[index];
+  func = module->funcs[index];
+  std::swap(module_.istream, module->istream);
+  Istream::Offset end = module_.istream.end();
+  const BinaryReaderInterp::FuncBody& body = reader_.func_bodies_[index];
+  Result result = ReadBinaryFunctionBody(
+      data_, reader_.num_func_imports() + index, body.offset, body.size,
+      reader_.data_count_, &reader_, options_);
+  if (Failed(result)) {
+    module_.istream.Truncate(end);
+    *out_error = errors_.empty() ? "invalid function body"
+                                 : errors_.front().message;
+    errors_.clear();
+  }
+  std::swap(module_.istream, module->istream);
+  if (Succeeded(result)) {
+    module->funcs[index] = std::move(func);
+  }
+  return result;
+}
+
 }  // namespace
 
 Result ReadBinaryInterp(std::string_view filename,
                         ByteSpan data,
                         const ReadBinaryOptions& options,
+                        const CompileOptions& compile_options,
                         Errors* errors,
                         ModuleDesc* out_module) {
   // BinaryReaderInterp does not support collect-all-errors mode; only readers
   // such as BinaryReaderIR/objdump may be used with stop_on_first_error=false.
   assert(options.stop_on_first_error);
-  BinaryReaderInterp reader(out_module, filename, errors, options.features);
+  if (compile_options.lazy) {
+    auto compiler = std::make_shared<LazyFuncCompiler>(
+        filename, data, options, compile_options,
+        out_module->istream.encoding());
+    CHECK_RESULT(compiler->ReadModule(errors, out_module));
+    out_module->compile_func = [compiler](ModuleDesc* module, Index index,
+                                          std::string* out_error) {
+      return compiler->Compile(module, index, out_error);
+    };
+    return Result::Ok;
+  }
+  BinaryReaderInterp reader(out_module, filename, errors, options.features,
+                            compile_options);
   return ReadBinary(data, &reader, options);
 }
 
+Result ReadBinaryInterp(std::string_view filename,
+                        ByteSpan data,
+                        const ReadBinaryOptions& options,
+                        Errors* errors,
+                        ModuleDesc* out_module) {
+  return ReadBinaryInterp(filename, data, options, CompileOptions(), errors,
+                          out_module);
+}
+
 // TODO(sbc): Remove this old API. Use the ByteSpan overload instead.
 Result ReadBinaryInterp(std::string_view filename,
                         const uint8_t* data,
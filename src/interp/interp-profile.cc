@@ -0,0 +1,272 @@
+/*
+ * Copyright 2026 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "wabt/interp/interp-profile.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+
+#include "wabt/stream.h"
+
+namespace wabt {
+namespace interp {
+
+// A node in the call tree. Each node is a distinct call stack, from the root
+// down to the node.
+struct Profile::Node {
+  Node(Ref ref, Index func) : ref(ref), func(func) {}
+
+  Ref ref;
+  Index func;
+  u64 self = 0;
+  std::map<Index, std::unique_ptr<Node>> children;
+};
+
+namespace {
+
+void WriteEscapedString(Stream* stream, std::string_view s) {
+  stream->WriteChar('"');
+  for (size_t i = 0; i < s.length(); ++i) {
+    uint8_t c = s[i];
+    if (c < 0x20 || c == '\\' || c == '"') {
+      stream->Writef("\\u%04x", c);
+    } else {
+      stream->WriteChar(c);
+    }
+  }
+  stream->WriteChar('"');
+}
+
+}  // end anonymous namespace
+
+Profile::Profile()
+    : root_(std::make_unique<Node>(Ref::Null, kInvalidIndex)),
+      opcode_counts_(Opcode::Invalid + 1) {}
+
+Profile::~Profile() = default;
+
+u64 Profile::GetOpcodeCount(Opcode opcode) const {
+  return opcode_counts_[std::min<size_t>(opcode, Opcode::Invalid)];
+}
+
+void Profile::OnCall(size_t depth) {
+  // The thread may have returned to a call stack that looks the same as the
+  // one in stack_, so the new frame must be treated as a new call.
+  if (stack_.size() > depth) {
+    stack_.resize(depth);
+  }
+}
+
+void Profile::OnInstruction(const std::vector<Frame>& frames, Opcode opcode) {
+  assert(!frames.empty());
+  // An instruction can only push or replace the top frame, or unwind frames,
+  // so the stacks differ at most in their last common frame.
+  size_t depth = std::min(stack_.size(), frames.size());
+  if (depth > 0 && stack_[depth - 1]->ref != frames[depth - 1].func) {
+    --depth;
+  }
+  bool same_frame = depth == stack_.size() && depth == frames.size();
+  stack_.resize(depth);
+  for (; depth < frames.size(); ++depth) {
+    Node* parent = stack_.empty() ? root_.get() : stack_.back();
+    Index func = GetFuncIndex(frames, depth);
+    auto& child = parent->children[func];
+    if (!child) {
+      child = std::make_unique<Node>(frames[depth].func, func);
+    }
+    funcs_[func].calls++;
+    stack_.push_back(child.get());
+  }
+
+  Node* node = stack_.back();
+  Istream::Offset offset = frames.back().offset;
+  if (same_frame && offset <= last_offset_) {
+    // A back-edge to the loop header at `offset`.
+    loops_[{node->func, offset}]++;
+  }
+  last_offset_ = offset;
+  node->self++;
+  funcs_[node->func].self++;
+  opcode_counts_[opcode]++;
+  instruction_count_++;
+}
+
+Index Profile::GetFuncIndex(const std::vector<Frame>& frames, size_t depth) {
+  auto iter = func_indexes_.find(frames[depth].func.index);
+  if (iter != func_indexes_.end()) {
+    return iter->second;
+  }
+  Index index = funcs_.size();
+  funcs_.emplace_back();
+  funcs_.back().name = GetFuncName(frames, depth);
+  func_indexes_.emplace(frames[depth].func.index, index);
+  return index;
+}
+
+std::string Profile::GetFuncName(const std::vector<Frame>& frames,
+                                 size_t depth) {
+  // A HostFunc frame has no instance, but it was called from its caller's.
+  const Frame& frame = frames[depth];
+  const Frame& owner = frame.inst || depth == 0 ? frame : frames[depth - 1];
+  if (!owner.inst) {
+    return "<host>";
+  }
+  const RefVec& funcs = owner.inst->funcs();
+  auto iter = std::find(funcs.begin(), funcs.end(), frame.func);
+  if (iter == funcs.end()) {
+    return "<host>";
+  }
+
+  Index func_index = iter - funcs.begin();
+  const ModuleDesc& desc = owner.mod->desc();
+  for (auto&& export_ : desc.exports) {
+    if (export_.type.type->kind == ExternalKind::Func &&
+        export_.index == func_index) {
+      return export_.type.name;
+    }
+  }
+  Index import_index = 0;
+  for (auto&& import : desc.imports) {
+    if (import.type.type->kind == ExternalKind::Func &&
+        import_index++ == func_index) {
+      return import.type.module + "." + import.type.name;
+    }
+  }
+  return StringPrintf("func[%u]", func_index);
+}
+
+// static
+u64 Profile::AddTotals(const Node& node,
+                       std::vector<u32>* active,
+                       std::vector<FuncStats>* out_stats) {
+  u64 total = node.self;
+  (*active)[node.func]++;
+  for (auto&& child : node.children) {
+    total += AddTotals(*child.second, active, out_stats);
+  }
+  if (--(*active)[node.func] == 0) {
+    (*out_stats)[node.func].total += total;
+  }
+  return total;
+}
+
+std::vector<Profile::FuncStats> Profile::GetFuncStats() const {
+  std::vector<FuncStats> stats = funcs_;
+  std::vector<u32> active(funcs_.size());
+  for (auto&& child : root_->children) {
+    AddTotals(*child.second, &active, &stats);
+  }
+  return stats;
+}
+
+std::vector<Profile::LoopStats> Profile::GetHotLoops(size_t max_count) const {
+  std::vector<LoopStats> loops;
+  for (auto&& loop : loops_) {
+    loops.push_back(LoopStats{loop.first.first, loop.first.second,
+                              loop.second});
+  }
+  std::stable_sort(loops.begin(), loops.end(),
+                   [](const LoopStats& lhs, const LoopStats& rhs) {
+                     return lhs.iterations > rhs.iterations;
+                   });
+  if (loops.size() > max_count) {
+    loops.resize(max_count);
+  }
+  return loops;
+}
+
+// static
+void Profile::WriteFoldedStacks(Stream* stream,
+                                const std::vector<FuncStats>& funcs,
+                                const Node& node,
+                                std::string* path) {
+  size_t size = path->size();
+  if (!path->empty()) {
+    *path += ';';
+  }
+  *path += funcs[node.func].name;
+  if (node.self) {
+    stream->Writef("%s %" PRIu64 "\n", path->c_str(), node.self);
+  }
+  for (auto&& child : node.children) {
+    WriteFoldedStacks(stream, funcs, *child.second, path);
+  }
+  path->resize(size);
+}
+
+void Profile::WriteFoldedStacks(Stream* stream) const {
+  std::string path;
+  for (auto&& child : root_->children) {
+    WriteFoldedStacks(stream, funcs_, *child.second, &path);
+  }
+}
+
+void Profile::WriteJson(Stream* stream, size_t max_hot_loops) const {
+  std::vector<FuncStats> funcs = GetFuncStats();
+  std::vector<Index> order(funcs.size());
+  for (Index i = 0; i < order.size(); ++i) {
+    order[i] = i;
+  }
+  std::stable_sort(order.begin(), order.end(), [&](Index lhs, Index rhs) {
+    return funcs[lhs].self > funcs[rhs].self;
+  });
+
+  stream->Writef("{\n  \"instructions\": %" PRIu64 ",\n", instruction_count_);
+  stream->Writef("  \"functions\": [");
+  const char* separator = "\n";
+  for (Index i : order) {
+    stream->Writef("%s    {\"name\": ", separator);
+    WriteEscapedString(stream, funcs[i].name);
+    stream->Writef(", \"calls\": %" PRIu64 ", \"self\": %" PRIu64
+                   ", \"total\": %" PRIu64 "}",
+                   funcs[i].calls, funcs[i].self, funcs[i].total);
+    separator = ",\n";
+  }
+  stream->Writef("\n  ],\n");
+
+  std::vector<Opcode> opcodes;
+  for (size_t i = 0; i < Opcode::Invalid; ++i) {
+    if (opcode_counts_[i]) {
+      opcodes.push_back(static_cast<Opcode::Enum>(i));
+    }
+  }
+  std::stable_sort(opcodes.begin(), opcodes.end(), [&](Opcode lhs, Opcode rhs) {
+    return opcode_counts_[lhs] > opcode_counts_[rhs];
+  });
+  stream->Writef("  \"opcodes\": [");
+  separator = "\n";
+  for (Opcode opcode : opcodes) {
+    stream->Writef("%s    {\"name\": \"%s\", \"count\": %" PRIu64 "}",
+                   separator, opcode.GetName(), opcode_counts_[opcode]);
+    separator = ",\n";
+  }
+  stream->Writef("\n  ],\n");
+
+  stream->Writef("  \"hot_loops\": [");
+  separator = "\n";
+  for (const LoopStats& loop : GetHotLoops(max_hot_loops)) {
+    stream->Writef("%s    {\"function\": ", separator);
+    WriteEscapedString(stream, funcs[loop.func].name);
+    stream->Writef(", \"offset\": %u, \"iterations\": %" PRIu64 "}",
+                   loop.offset, loop.iterations);
+    separator = ",\n";
+  }
+  stream->Writef("\n  ]\n}\n");
+}
+
+}  // namespace interp
+}  // namespace wabt
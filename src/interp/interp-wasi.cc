@@ -697,7 +697,8 @@ Result WasiBindImports(const Module::Ptr& module,
 Result WasiRunStart(const Instance::Ptr& instance,
                     uvwasi_s* uvwasi,
                     Stream* err_stream,
-                    Stream* trace_stream) {
+                    Stream* trace_stream,
+                    Profile* profile) {
   Store* store = instance.store();
   auto module = store->UnsafeGet<Module>(instance->module());
   auto&& module_desc = module->desc();
@@ -747,7 +748,11 @@ Result WasiRunStart(const Instance::Ptr& instance,
   Values params;
   Values results;
   Trap::Ptr trap;
-  Result res = start->Call(*store, params, results, &trap, trace_stream);
+  Thread::Options options;
+  options.trace_stream = trace_stream;
+  options.profile = profile;
+  Thread thread(*store, options);
+  Result res = start->Call(thread, params, results, &trap);
   if (trap) {
     WriteTrap(err_stream, "error", trap);
   }
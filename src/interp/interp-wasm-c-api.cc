@@ -959,11 +959,7 @@ void wasm_global_get(const wasm_global_t* global, own wasm_val_t* out) {
 
 void wasm_global_set(wasm_global_t* global, const wasm_val_t* val) {
   TRACE0();
-  if (wasm_valkind_is_ref(val->kind)) {
-    global->As<Global>()->Set(*global->I.store(), val->of.ref->I->self());
-  } else {
-    global->As<Global>()->UnsafeSet(ToWabtValue(*val).value);
-  }
+  global->As<Global>()->Set(*global->I.store(), ToWabtValue(*val).value);
 }
 
 // wasm_table
@@ -19,9 +19,47 @@
 #include <algorithm>
 #include <cassert>
 #include <cinttypes>
+#include <condition_variable>
 #include <limits>
+#include <mutex>
 
 #include "wabt/interp/interp-math.h"
+#include "wabt/interp/interp-profile.h"
+
+// Use direct-threaded dispatch (computed goto) in Thread::Execute when the
+// compiler supports it, otherwise fall back to a switch.
+#ifndef WABT_INTERP_COMPUTED_GOTO
+#if COMPILER_IS_CLANG || COMPILER_IS_GNU
+#define WABT_INTERP_COMPUTED_GOTO 1
+#else
+#define WABT_INTERP_COMPUTED_GOTO 0
+#endif
+#endif
+
+// Support backing 32-bit memories with a guarded address space reservation,
+// so that growing a memory never moves its data; see Memory::IsGuarded.
+#ifndef WABT_INTERP_GUARD_PAGES
+#if !WABT_BIG_ENDIAN && !defined(_WIN32) && UINTPTR_MAX > UINT32_MAX
+#define WABT_INTERP_GUARD_PAGES 1
+#else
+#define WABT_INTERP_GUARD_PAGES 0
+#endif
+#endif
+
+// Share the contents of memories captured by an InstanceSnapshot between the
+// instances created from it, by mapping a memfd copy-on-write.
+#ifndef WABT_INTERP_COW_MEMORY
+#if WABT_INTERP_GUARD_PAGES && defined(__linux__)
+#define WABT_INTERP_COW_MEMORY 1
+#else
+#define WABT_INTERP_COW_MEMORY 0
+#endif
+#endif
+
+#if WABT_INTERP_GUARD_PAGES
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 namespace wabt {
 namespace interp {
@@ -314,11 +352,191 @@ ValueType FuncDesc::GetLocalType(Index index) const {
   return iter->type;
 }
 
+const StackMapDesc* FuncDesc::GetStackMap(u32 offset) const {
+  auto iter = std::upper_bound(
+      stack_maps.begin(), stack_maps.end(), offset,
+      [](u32 lhs, const StackMapDesc& rhs) { return lhs < rhs.offset; });
+  if (iter == stack_maps.begin()) {
+    return nullptr;
+  }
+  return &*std::prev(iter);
+}
+
+//// ObjectPool ////
+struct ObjectPool::Slab {
+  // Links in available_, while the slab has a free slot.
+  Slab* prev = nullptr;
+  Slab* next = nullptr;
+  void* free_list = nullptr;
+  size_t size_class;
+  size_t live = 0;
+  bool available = false;
+};
+
+ObjectPool::~ObjectPool() {
+  for (Slab* slab : slabs_) {
+    slab->~Slab();
+    ::operator delete(slab, std::align_val_t{kSlabSize});
+  }
+}
+
+void* ObjectPool::Allocate(size_t size) {
+  assert(size > 0 && size <= kMaxSize);
+  size_t size_class = (size - 1) / kGranularity;
+  Slab* slab = available_[size_class];
+  if (!slab) {
+    slab = NewSlab(size_class);
+  }
+  void* slot = slab->free_list;
+  slab->free_list = *static_cast<void**>(slot);
+  slab->live++;
+  if (!slab->free_list) {
+    UnlinkAvailable(slab);
+  }
+  return slot;
+}
+
+void ObjectPool::Free(void* slot) {
+  auto* slab = reinterpret_cast<Slab*>(reinterpret_cast<uintptr_t>(slot) &
+                                       ~uintptr_t{kSlabSize - 1});
+  assert(slab->live > 0);
+  *static_cast<void**>(slot) = slab->free_list;
+  slab->free_list = slot;
+  slab->live--;
+  if (!slab->available) {
+    LinkAvailable(slab);
+  }
+}
+
+void ObjectPool::ReleaseEmptySlabs() {
+  // Keep one empty slab per size class, so that a slab isn't released and
+  // then allocated again right after every collection.
+  bool kept[kNumSizeClasses] = {};
+  auto iter = std::remove_if(slabs_.begin(), slabs_.end(), [&](Slab* slab) {
+    if (slab->live != 0) {
+      return false;
+    }
+    if (!kept[slab->size_class]) {
+      kept[slab->size_class] = true;
+      return false;
+    }
+    UnlinkAvailable(slab);
+    slab->~Slab();
+    ::operator delete(slab, std::align_val_t{kSlabSize});
+    return true;
+  });
+  slabs_.erase(iter, slabs_.end());
+}
+
+ObjectPool::Slab* ObjectPool::NewSlab(size_t size_class) {
+  void* memory = ::operator new(kSlabSize, std::align_val_t{kSlabSize});
+  Slab* slab = new (memory) Slab();
+  slab->size_class = size_class;
+  slabs_.push_back(slab);
+
+  // Thread the slots onto the free list, lowest address first.
+  size_t slot_size = (size_class + 1) * kGranularity;
+  char* begin = static_cast<char*>(memory) +
+                (sizeof(Slab) + kGranularity - 1) / kGranularity * kGranularity;
+  char* end = static_cast<char*>(memory) + kSlabSize;
+  size_t num_slots = (end - begin) / slot_size;
+  assert(num_slots > 0);
+  for (size_t i = num_slots; i-- > 0;) {
+    void* slot = begin + i * slot_size;
+    *static_cast<void**>(slot) = slab->free_list;
+    slab->free_list = slot;
+  }
+  LinkAvailable(slab);
+  return slab;
+}
+
+void ObjectPool::LinkAvailable(Slab* slab) {
+  assert(!slab->available);
+  Slab*& head = available_[slab->size_class];
+  slab->prev = nullptr;
+  slab->next = head;
+  if (head) {
+    head->prev = slab;
+  }
+  head = slab;
+  slab->available = true;
+}
+
+void ObjectPool::UnlinkAvailable(Slab* slab) {
+  if (!slab->available) {
+    return;
+  }
+  if (slab->prev) {
+    slab->prev->next = slab->next;
+  } else {
+    available_[slab->size_class] = slab->next;
+  }
+  if (slab->next) {
+    slab->next->prev = slab->prev;
+  }
+  slab->prev = slab->next = nullptr;
+  slab->available = false;
+}
+
 //// Store ////
 Store::Store(const Features& features) : features_(features) {
   Ref ref{objects_.New(new Object(ObjectKind::Null))};
   assert(ref == Ref::Null);
   roots_.New(ref);
+  UpdateTrigger();
+}
+
+Store::~Store() {
+  for (ObjectList::Index i = 0; i < objects_.size(); ++i) {
+    if (objects_.IsUsed(i)) {
+      DeleteObject(i);
+    }
+  }
+}
+
+void Store::DeleteObject(ObjectList::Index index) {
+  Object* object = objects_.Get(index);
+  objects_.Delete(index);
+  if (IsPooled(object->kind())) {
+    object->~Object();
+    object_pool_.Free(object);
+  } else {
+    delete object;
+  }
+}
+
+std::unique_ptr<Thread> Store::AcquireThread() {
+  if (thread_pool_.empty()) {
+    return std::make_unique<Thread>(*this);
+  }
+  std::unique_ptr<Thread> thread = std::move(thread_pool_.back());
+  thread_pool_.pop_back();
+  return thread;
+}
+
+void Store::ReleaseThread(std::unique_ptr<Thread> thread) {
+  assert(&thread->store() == this);
+  thread->Reset();
+  thread_pool_.push_back(std::move(thread));
+}
+
+void Store::AddThread(Thread* thread) {
+  thread->next_thread_ = threads_;
+  if (threads_) {
+    threads_->prev_thread_ = thread;
+  }
+  threads_ = thread;
+}
+
+void Store::RemoveThread(Thread* thread) {
+  if (thread->prev_thread_) {
+    thread->prev_thread_->next_thread_ = thread->next_thread_;
+  } else {
+    threads_ = thread->next_thread_;
+  }
+  if (thread->next_thread_) {
+    thread->next_thread_->prev_thread_ = thread->prev_thread_;
+  }
 }
 
 #ifndef NDEBUG
@@ -366,45 +584,167 @@ void Store::DeleteRoot(RootList::Index index) {
   roots_.Delete(index);
 }
 
+void Store::SetGCOptions(const GCOptions& options) {
+  gc_options_ = options;
+  if (gc_context_.phase == GCPhase::Idle) {
+    UpdateTrigger();
+  }
+}
+
+void Store::UpdateTrigger() {
+  if (!gc_options_.automatic) {
+    gc_context_.trigger = SIZE_MAX;
+    return;
+  }
+  size_t count = objects_.count();
+  double target = count * gc_options_.growth_factor;
+  gc_context_.trigger =
+      target >= static_cast<double>(SIZE_MAX)
+          ? SIZE_MAX
+          : std::max({gc_options_.min_objects, count + 1,
+                      static_cast<size_t>(target)});
+}
+
+void Store::BlockGC() {
+  gc_context_.blocked++;
+}
+
+void Store::UnblockGC() {
+  assert(gc_context_.blocked > 0);
+  if (--gc_context_.blocked == 0 && gc_options_.automatic &&
+      objects_.count() >= gc_context_.trigger) {
+    CollectIncrement();
+  }
+}
+
+void Store::GCSafePoint() {
+  // Only the calling Thread may be executing; any others are suspended in host
+  // calls.
+  if (gc_context_.blocked == 1 && gc_options_.automatic &&
+      objects_.count() >= gc_context_.trigger) {
+    CollectIncrement();
+  }
+}
+
+void Store::OnAllocGC(Ref ref) {
+  if (gc_context_.phase != GCPhase::Idle) {
+    // Objects allocated during a collection survive it. While marking, they
+    // must still be traced, since the references passed to their constructors
+    // may not be reachable from anywhere else.
+    auto& marks = gc_context_.marks;
+    if (ref.index >= marks.size()) {
+      marks.resize(objects_.size());
+    }
+    marks[ref.index] = true;
+    if (gc_context_.phase == GCPhase::Mark) {
+      gc_context_.mark_stack.push_back(ref.index);
+    }
+  }
+  if (gc_options_.automatic && gc_context_.blocked == 0) {
+    CollectIncrement();
+  }
+}
+
 void Store::Collect() {
-  size_t object_count = objects_.size();
+  auto start = std::chrono::steady_clock::now();
+  // A collection in progress keeps the objects that were reachable when it
+  // started, so a new one is needed to free everything that is unreachable
+  // now.
+  if (gc_context_.phase != GCPhase::Idle) {
+    DoCollectionWork(SIZE_MAX);
+  }
+  StartCollection();
+  DoCollectionWork(SIZE_MAX);
+  RecordPause(start);
+}
 
-  assert(gc_context_.call_depth == 0);
+bool Store::CollectIncrement() {
+  auto start = std::chrono::steady_clock::now();
+  if (gc_context_.phase == GCPhase::Idle) {
+    StartCollection();
+  }
+  bool done = DoCollectionWork(gc_options_.slice_size);
+  RecordPause(start);
+  return done;
+}
 
-  gc_context_.marks.resize(object_count);
-  std::fill(gc_context_.marks.begin(), gc_context_.marks.end(), false);
+void Store::RecordPause(std::chrono::steady_clock::time_point start) {
+  auto pause = std::chrono::steady_clock::now() - start;
+  gc_stats_.increments++;
+  gc_stats_.total_pause += pause;
+  gc_stats_.max_pause = std::max<std::chrono::nanoseconds>(
+      gc_stats_.max_pause, pause);
+}
 
-  // First mark all roots.
+void Store::MarkRoots() {
   for (RootList::Index i = 0; i < roots_.size(); ++i) {
     if (roots_.IsUsed(i)) {
       Mark(roots_.Get(i));
     }
   }
 
-  for (auto thread : threads_) {
+  for (Thread* thread = threads_; thread; thread = thread->next_thread_) {
     thread->Mark();
   }
+}
 
-  // This vector is often empty since the default maximum
-  // recursion is usually enough to mark all objects.
-  while (WABT_UNLIKELY(!gc_context_.untraced_objects.empty())) {
-    size_t index = gc_context_.untraced_objects.back();
-
-    assert(gc_context_.marks[index]);
-    assert(gc_context_.call_depth == 0);
+void Store::StartCollection() {
+  assert(gc_context_.phase == GCPhase::Idle);
+  gc_context_.phase = GCPhase::Mark;
+  gc_context_.trigger = 0;
+  gc_context_.marks.assign(objects_.size(), false);
+  gc_context_.mark_stack.clear();
+  MarkRoots();
+}
 
-    gc_context_.untraced_objects.pop_back();
+void Store::FinishMarking() {
+  // The roots and the threads' stacks aren't covered by the write barrier,
+  // so they are marked again, and everything they reach is traced at once.
+  MarkRoots();
+  while (!gc_context_.mark_stack.empty()) {
+    size_t index = gc_context_.mark_stack.back();
+    gc_context_.mark_stack.pop_back();
     objects_.Get(index)->Mark(*this);
   }
+  gc_context_.phase = GCPhase::Sweep;
+  gc_context_.sweep_index = 0;
+  gc_context_.sweep_end = objects_.size();
+}
+
+bool Store::DoCollectionWork(size_t budget) {
+  for (; budget > 0; --budget) {
+    switch (gc_context_.phase) {
+      case GCPhase::Idle:
+        return true;
 
-  assert(gc_context_.call_depth == 0);
+      case GCPhase::Mark:
+        if (gc_context_.mark_stack.empty()) {
+          FinishMarking();
+        } else {
+          size_t index = gc_context_.mark_stack.back();
+          gc_context_.mark_stack.pop_back();
+          objects_.Get(index)->Mark(*this);
+        }
+        break;
 
-  // Delete all unmarked objects.
-  for (size_t i = 0; i < object_count; ++i) {
-    if (objects_.IsUsed(i) && !gc_context_.marks[i]) {
-      objects_.Delete(i);
+      case GCPhase::Sweep: {
+        if (gc_context_.sweep_index == gc_context_.sweep_end) {
+          gc_context_.phase = GCPhase::Idle;
+          gc_stats_.collections++;
+          object_pool_.ReleaseEmptySlabs();
+          UpdateTrigger();
+          return true;
+        }
+        size_t index = gc_context_.sweep_index++;
+        if (objects_.IsUsed(index) && !gc_context_.marks[index]) {
+          DeleteObject(index);
+          gc_stats_.objects_freed++;
+        }
+        break;
+      }
     }
   }
+  return gc_context_.phase == GCPhase::Idle;
 }
 
 void Store::Mark(Ref ref) {
@@ -414,15 +754,7 @@ void Store::Mark(Ref ref) {
     return;
 
   gc_context_.marks[index] = true;
-
-  if (WABT_UNLIKELY(gc_context_.call_depth >= max_call_depth)) {
-    gc_context_.untraced_objects.push_back(index);
-    return;
-  }
-
-  gc_context_.call_depth++;
-  objects_.Get(index)->Mark(*this);
-  gc_context_.call_depth--;
+  gc_context_.mark_stack.push_back(index);
 }
 
 void Store::Mark(const RefVec& refs) {
@@ -508,8 +840,14 @@ Result Func::Call(Store& store,
                   Values& results,
                   Trap::Ptr* out_trap,
                   Stream* trace_stream) {
-  Thread thread(store, trace_stream);
-  return DoCall(thread, params, results, out_trap);
+  if (trace_stream) {
+    Thread thread(store, trace_stream);
+    return DoCall(thread, params, results, out_trap);
+  }
+  std::unique_ptr<Thread> thread = store.AcquireThread();
+  Result result = DoCall(*thread, params, results, out_trap);
+  store.ReleaseThread(std::move(thread));
+  return result;
 }
 
 Result Func::Call(Thread& thread,
@@ -533,19 +871,36 @@ Result DefinedFunc::Match(Store& store,
   return MatchImpl(store, import_type, type_, out_trap);
 }
 
+Result DefinedFunc::Compile(Store& store, std::string* out_error) {
+  // The body is compiled once per Module, and shared by its instances.
+  Instance* inst = store.UnsafeGet<Instance>(instance_).get();
+  Module* mod = store.UnsafeGet<Module>(inst->module()).get();
+  CHECK_RESULT(mod->CompileFunc(desc_.lazy_index, out_error));
+  desc_ = mod->desc().funcs[desc_.lazy_index];
+  return Result::Ok;
+}
+
 Result DefinedFunc::DoCall(Thread& thread,
                            const Values& params,
                            Values& results,
                            Trap::Ptr* out_trap) {
   assert(params.size() == type_.params.size());
-  thread.PushValues(type_.params, params);
-  RunResult result = thread.PushCall(*this, out_trap);
+  RunResult result = thread.PushCall(*this, params, out_trap);
   if (result == RunResult::Trap) {
     return Result::Error;
   }
   result = thread.Run(out_trap);
   if (result == RunResult::Trap) {
     return Result::Error;
+  } else if (result == RunResult::OutOfFuel) {
+    // A call made through the Func API can't be resumed.
+    thread.PopTrappedCall();
+    *out_trap = Trap::New(thread.store(), "out of fuel");
+    return Result::Error;
+  } else if (result == RunResult::Interrupted) {
+    thread.PopTrappedCall();
+    *out_trap = Trap::New(thread.store(), "interrupted");
+    return Result::Error;
   } else if (result == RunResult::Exception) {
     // While this is not actually a trap, it is a convenient way
     // to report an uncaught exception.
@@ -618,6 +973,7 @@ Result Table::Set(Store& store, u64 offset, Ref ref) {
   assert(store.HasValueType(ref, type_.element));
   if (IsValidRange(offset, 1)) {
     elements_[offset] = ref;
+    store.WriteBarrier(ref);
     return Result::Ok;
   }
   return Result::Error;
@@ -649,6 +1005,7 @@ Result Table::Fill(Store& store, u64 offset, Ref ref, u64 size) {
   if (IsValidRange(offset, size)) {
     std::fill(elements_.begin() + offset, elements_.begin() + offset + size,
               ref);
+    store.WriteBarrier(ref);
     return Result::Ok;
   }
   return Result::Error;
@@ -661,9 +1018,11 @@ Result Table::Init(Store& store,
                    u32 size) {
   if (IsValidRange(dst_offset, size) && src.IsValidRange(src_offset, size) &&
       TypesMatch(type_.element, src.desc().type)) {
-    std::copy(src.elements().begin() + src_offset,
-              src.elements().begin() + src_offset + size,
-              elements_.begin() + dst_offset);
+    auto src_begin = src.elements().begin() + src_offset;
+    auto src_end = src_begin + size;
+    std::copy(src_begin, src_end, elements_.begin() + dst_offset);
+    // The segment may be dropped before its elements are traced.
+    store.WriteBarrier(src_begin, src_end);
     return Result::Ok;
   }
   return Result::Error;
@@ -688,51 +1047,314 @@ Result Table::Copy(Store& store,
     } else {
       std::move(src_begin, src_end, dst_begin);
     }
+    store.WriteBarrier(dst_begin, dst_end);
     return Result::Ok;
   }
   return Result::Error;
 }
 
 //// Memory ////
-Memory::Memory(class Store&, MemoryType type)
+#if WABT_INTERP_GUARD_PAGES
+namespace {
+
+// The largest 32-bit memory.
+const u64 kGuardedReservationSize = u64{4} << 30;
+
+}  // end anonymous namespace
+#endif  // WABT_INTERP_GUARD_PAGES
+
+struct Memory::SharedStorage {
+  SharedStorage(u8* data, u64 size) : data(data), size(size) {}
+  ~SharedStorage() {
+#if WABT_INTERP_GUARD_PAGES
+    munmap(data, kGuardedReservationSize);
+#endif
+  }
+
+  u8* data;
+  std::atomic<u64> size;
+  // Held while growing, so that concurrent grows don't lose pages.
+  std::mutex grow_mutex;
+};
+
+namespace {
+
+// The OS threads blocked in memory.atomic.wait, keyed by the address that
+// they wait on. The addresses are those of the storage, so Memory objects in
+// different Stores that share it wait on the same addresses.
+class ParkingLot {
+ public:
+  // Blocks until Unpark wakes the calling thread, or `timeout` nanoseconds
+  // have passed, unless `check` returns false. It is called while notifies
+  // are blocked, so that a notify after the value was changed can't be
+  // missed. Returns the result of memory.atomic.wait.
+  template <typename F>
+  u32 Park(const void* addr, F&& check, s64 timeout);
+  u32 Unpark(const void* addr, u32 count);
+
+ private:
+  static constexpr size_t kNumBuckets = 64;
+
+  struct Waiter {
+    explicit Waiter(const void* addr) : addr(addr) {}
+
+    const void* addr;
+    bool woken = false;
+    std::condition_variable cv;
+    Waiter* next = nullptr;
+  };
+
+  // Waiters are woken in the order that they started waiting.
+  struct Bucket {
+    std::mutex mutex;
+    Waiter* head = nullptr;
+    Waiter* tail = nullptr;
+  };
+
+  Bucket& GetBucket(const void* addr) {
+    return buckets_[(reinterpret_cast<uintptr_t>(addr) >> 2) % kNumBuckets];
+  }
+  static void Remove(Bucket&, Waiter*);
+
+  Bucket buckets_[kNumBuckets];
+};
+
+template <typename F>
+u32 ParkingLot::Park(const void* addr, F&& check, s64 timeout) {
+  Bucket& bucket = GetBucket(addr);
+  std::unique_lock<std::mutex> lock(bucket.mutex);
+  if (!check()) {
+    return 1;
+  }
+
+  Waiter waiter(addr);
+  if (bucket.tail) {
+    bucket.tail->next = &waiter;
+  } else {
+    bucket.head = &waiter;
+  }
+  bucket.tail = &waiter;
+
+  if (timeout < 0) {
+    waiter.cv.wait(lock, [&] { return waiter.woken; });
+  } else if (!waiter.cv.wait_for(lock, std::chrono::nanoseconds(timeout),
+                                 [&] { return waiter.woken; })) {
+    Remove(bucket, &waiter);
+    return 2;
+  }
+  return 0;
+}
+
+u32 ParkingLot::Unpark(const void* addr, u32 count) {
+  Bucket& bucket = GetBucket(addr);
+  std::lock_guard<std::mutex> lock(bucket.mutex);
+  u32 woken = 0;
+  for (Waiter* waiter = bucket.head; waiter && woken < count;) {
+    Waiter* next = waiter->next;
+    if (waiter->addr == addr) {
+      Remove(bucket, waiter);
+      waiter->woken = true;
+      waiter->cv.notify_one();
+      ++woken;
+    }
+    waiter = next;
+  }
+  return woken;
+}
+
+// static
+void ParkingLot::Remove(Bucket& bucket, Waiter* waiter) {
+  Waiter* prev = nullptr;
+  for (Waiter* iter = bucket.head; iter != waiter; iter = iter->next) {
+    prev = iter;
+  }
+  (prev ? prev->next : bucket.head) = waiter->next;
+  if (bucket.tail == waiter) {
+    bucket.tail = prev;
+  }
+  waiter->next = nullptr;
+}
+
+ParkingLot& GetParkingLot() {
+  static ParkingLot parking_lot;
+  return parking_lot;
+}
+
+}  // end anonymous namespace
+
+Memory::Memory(class Store& store, MemoryType type)
     : Extern(skind), type_(type), pages_(type.limits.initial) {
-  data_.resize(pages_ * type_.page_size);
+  size_ = pages_ * type_.page_size;
+  if (!store.guard_memories() || !Reserve()) {
+    buffer_.resize(size_);
+    data_ = buffer_.data();
+  } else if (type_.limits.is_shared) {
+    shared_ = std::make_shared<SharedStorage>(data_, size_);
+  }
+}
+
+Memory::Memory(class Store&, const Memory& shared)
+    : Extern(skind),
+      type_(shared.type_),
+      data_(shared.data_),
+      guarded_(true),
+      shared_(shared.shared_) {
+  size_ = shared_->size.load();
+  pages_ = size_ / type_.page_size;
+  type_.limits.initial = pages_;
+}
+
+Memory::~Memory() {
+#if WABT_INTERP_GUARD_PAGES
+  if (guarded_ && !shared_) {
+    munmap(data_, kGuardedReservationSize);
+  }
+#endif
+}
+
+u64 Memory::SharedByteSize() const {
+  return shared_->size.load();
+}
+
+bool Memory::Reserve() {
+#if WABT_INTERP_GUARD_PAGES
+  // Grow makes whole OS pages accessible, so pages must be a multiple of the
+  // OS page size.
+  static const u64 os_page_size = sysconf(_SC_PAGESIZE);
+  if (type_.limits.is_64 || type_.page_size % os_page_size != 0) {
+    return false;
+  }
+
+  void* addr = mmap(nullptr, kGuardedReservationSize, PROT_NONE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  if (addr == MAP_FAILED) {
+    return false;
+  }
+  if (size_ > 0 && mprotect(addr, size_, PROT_READ | PROT_WRITE) != 0) {
+    munmap(addr, kGuardedReservationSize);
+    return false;
+  }
+
+  data_ = static_cast<u8*>(addr);
+  guarded_ = true;
+  return true;
+#else
+  return false;
+#endif
 }
 
 void Memory::Mark(class Store&) {}
 
+Result Memory::InitFromImage(int fd, const Buffer& data) {
+#if WABT_INTERP_COW_MEMORY
+  if (fd != -1) {
+    if (guarded_) {
+      // Pages that are never written stay shared with the image.
+      void* addr = mmap(data_, size_, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_FIXED, fd, 0);
+      return addr == MAP_FAILED ? Result::Error : Result::Ok;
+    }
+    for (u64 offset = 0; offset < size_;) {
+      ssize_t count = pread(fd, data_ + offset, size_ - offset, offset);
+      if (count <= 0) {
+        return Result::Error;
+      }
+      offset += count;
+    }
+    return Result::Ok;
+  }
+#endif
+  assert(data.size() == size_);
+  std::copy(data.begin(), data.end(), data_);
+  return Result::Ok;
+}
+
 Result Memory::Match(class Store& store,
                      const ImportType& import_type,
                      Trap::Ptr* out_trap) {
   return MatchImpl(store, import_type, type_, out_trap);
 }
 
-Result Memory::Grow(u64 count) {
+Result Memory::Grow(u64 count, u64* out_old_pages) {
+  std::unique_lock<std::mutex> lock;
+  if (shared_) {
+    lock = std::unique_lock<std::mutex>(shared_->grow_mutex);
+    size_ = shared_->size.load();
+    pages_ = size_ / type_.page_size;
+    type_.limits.initial = pages_;
+  }
+  if (out_old_pages) {
+    *out_old_pages = pages_;
+  }
+
   u64 new_pages;
   if (CanGrow<u64>(type_.limits, pages_, count, &new_pages)) {
+    u64 new_size = new_pages * type_.page_size;
+    if (guarded_) {
+#if WABT_INTERP_GUARD_PAGES
+      if (new_size > size_ && mprotect(data_ + size_, new_size - size_,
+                                       PROT_READ | PROT_WRITE) != 0) {
+        return Result::Error;
+      }
+#endif
+    } else {
+      buffer_.resize(new_size);
+      data_ = buffer_.data();
+#if WABT_BIG_ENDIAN
+      std::move_backward(data_, data_ + size_, data_ + new_size);
+      std::fill(data_, data_ + new_size - size_, 0);
+#endif
+    }
     // Grow the limits of the memory too, so that if it is used as an
     // import to another module its new size is honored.
     type_.limits.initial += count;
-#if WABT_BIG_ENDIAN
-    auto old_size = data_.size();
-#endif
     pages_ = new_pages;
-    data_.resize(new_pages * type_.page_size);
-#if WABT_BIG_ENDIAN
-    std::move_backward(data_.begin(), data_.begin() + old_size, data_.end());
-    std::fill(data_.begin(), data_.end() - old_size, 0);
-#endif
+    size_ = new_size;
+    if (shared_) {
+      shared_->size.store(new_size);
+    }
     return Result::Ok;
   }
   return Result::Error;
 }
 
+template <typename T>
+Result Memory::AtomicWait(u64 offset,
+                          u64 addend,
+                          T expected,
+                          s64 timeout,
+                          u32* out) {
+  assert(IsShared());
+  if (!IsValidAtomicAccess(offset, addend, sizeof(T))) {
+    return Result::Error;
+  }
+  T* addr = AtomicAddress<T>(offset, addend);
+  *out = GetParkingLot().Park(
+      addr, [&] { return std::atomic_ref<T>(*addr).load() == expected; },
+      timeout);
+  return Result::Ok;
+}
+
+template Result Memory::AtomicWait<u32>(u64, u64, u32, s64, u32*);
+template Result Memory::AtomicWait<u64>(u64, u64, u64, s64, u32*);
+
+Result Memory::AtomicNotify(u64 offset, u64 addend, u32 count, u32* out) {
+  if (!IsValidAtomicAccess(offset, addend, sizeof(u32))) {
+    return Result::Error;
+  }
+  // No one can wait on an unshared memory.
+  *out = IsShared()
+             ? GetParkingLot().Unpark(AtomicAddress<u32>(offset, addend), count)
+             : 0;
+  return Result::Ok;
+}
+
 Result Memory::Fill(u64 offset, u8 value, u64 size) {
   if (IsValidAccess(offset, 0, size)) {
 #if WABT_BIG_ENDIAN
-    std::fill(data_.end() - offset - size, data_.end() - offset, value);
+    std::fill(data_ + size_ - offset - size, data_ + size_ - offset, value);
 #else
-    std::fill(data_.begin() + offset, data_.begin() + offset + size, value);
+    std::fill(data_ + offset, data_ + offset + size, value);
 #endif
     return Result::Ok;
   }
@@ -748,9 +1370,9 @@ Result Memory::Init(u64 dst_offset,
     std::copy(src.desc().data.begin() + src_offset,
               src.desc().data.begin() + src_offset + size,
 #if WABT_BIG_ENDIAN
-              data_.rbegin() + dst_offset);
+              std::reverse_iterator<u8*>(data_ + size_) + dst_offset);
 #else
-              data_.begin() + dst_offset);
+              data_ + dst_offset);
 #endif
     return Result::Ok;
   }
@@ -766,11 +1388,11 @@ Result Memory::Copy(Memory& dst,
   if (dst.IsValidAccess(dst_offset, 0, size) &&
       src.IsValidAccess(src_offset, 0, size)) {
 #if WABT_BIG_ENDIAN
-    auto src_begin = src.data_.end() - src_offset - size;
-    auto dst_begin = dst.data_.end() - dst_offset - size;
+    auto src_begin = src.data_ + src.size_ - src_offset - size;
+    auto dst_begin = dst.data_ + dst.size_ - dst_offset - size;
 #else
-    auto src_begin = src.data_.begin() + src_offset;
-    auto dst_begin = dst.data_.begin() + dst_offset;
+    auto src_begin = src.data_ + src_offset;
+    auto dst_begin = dst.data_ + dst_offset;
 #endif
     auto src_end = src_begin + size;
     auto dst_end = dst_begin + size;
@@ -817,6 +1439,14 @@ Result Global::Match(Store& store,
 void Global::Set(Store& store, Ref ref) {
   assert(store.HasValueType(ref, type_.type));
   value_.Set(ref);
+  store.WriteBarrier(ref);
+}
+
+void Global::Set(Store& store, Value value) {
+  value_ = value;
+  if (type_.type.IsRef()) {
+    store.WriteBarrier(value.Get<Ref>());
+  }
 }
 
 void Global::UnsafeSet(Value value) {
@@ -848,6 +1478,7 @@ ElemSegment::ElemSegment(Store& store,
       WABT_UNREACHABLE;  // valid const expression cannot trap
     }
     elements_.push_back(value.Get<Ref>());
+    store.WriteBarrier(elements_.back());
   }
 }
 
@@ -857,6 +1488,9 @@ bool ElemSegment::IsValidRange(u32 offset, u32 size) const {
 }
 
 //// DataSegment ////
+ElemSegment::ElemSegment(const ElemDesc* desc, RefVec elements)
+    : desc_(desc), elements_(std::move(elements)) {}
+
 DataSegment::DataSegment(const DataDesc* desc)
     : desc_(desc), size_(desc->data.size()) {}
 
@@ -895,6 +1529,14 @@ Module::Module(Store&, ModuleDesc desc)
 
 void Module::Mark(Store&) {}
 
+Result Module::CompileFunc(Index index, std::string* out_error) {
+  assert(desc_.compile_func);
+  if (desc_.funcs[index].code_offset != Istream::kInvalidOffset) {
+    return Result::Ok;
+  }
+  return desc_.compile_func(&desc_, index, out_error);
+}
+
 //// ElemSegment ////
 void ElemSegment::Mark(Store& store) {
   store.Mark(elements_);
@@ -935,17 +1577,8 @@ Instance::Ptr Instance::Instantiate(Store& store,
       return {};
     }
 
-    inst->imports_.push_back(extern_ref);
-
-    switch (import_desc.type.type->kind) {
-      case ExternKind::Func:   inst->funcs_.push_back(extern_ref); break;
-      case ExternKind::Table:  inst->tables_.push_back(extern_ref); break;
-      case ExternKind::Memory: inst->memories_.push_back(extern_ref); break;
-      case ExternKind::Global: inst->globals_.push_back(extern_ref); break;
-      case ExternKind::Tag:    inst->tags_.push_back(extern_ref); break;
-    }
+    inst->AddImport(store, import_desc.type.type->kind, extern_ref);
   }
-
   // Funcs.
   for (auto&& desc : mod->desc().funcs) {
     inst->funcs_.push_back(DefinedFunc::New(store, inst.ref(), desc).ref());
@@ -985,18 +1618,7 @@ Instance::Ptr Instance::Instantiate(Store& store,
     inst->tags_.push_back(Tag::New(store, desc.type).ref());
   }
 
-  // Exports.
-  for (auto&& desc : mod->desc().exports) {
-    Ref ref;
-    switch (desc.type.type->kind) {
-      case ExternKind::Func:   ref = inst->funcs_[desc.index]; break;
-      case ExternKind::Table:  ref = inst->tables_[desc.index]; break;
-      case ExternKind::Memory: ref = inst->memories_[desc.index]; break;
-      case ExternKind::Global: ref = inst->globals_[desc.index]; break;
-      case ExternKind::Tag:    ref = inst->tags_[desc.index]; break;
-    }
-    inst->exports_.push_back(ref);
-  }
+  inst->InitExports(mod->desc());
 
   // Elems.
   for (auto&& desc : mod->desc().elems) {
@@ -1112,6 +1734,104 @@ Instance::Ptr Instance::Instantiate(Store& store,
   return inst;
 }
 
+Instance::Ptr Instance::Instantiate(Store& store,
+                                    const InstanceSnapshot& snapshot,
+                                    Trap::Ptr* out_trap) {
+  assert(&store == &snapshot.store_);
+  const Module::Ptr& mod = snapshot.module_;
+  Instance::Ptr inst = store.Alloc<Instance>(store, mod.ref());
+
+  for (size_t i = 0; i < snapshot.imports_.size(); ++i) {
+    inst->AddImport(store, mod->desc().imports[i].type.type->kind,
+                    snapshot.imports_[i]);
+  }
+
+  for (auto&& desc : mod->desc().funcs) {
+    inst->funcs_.push_back(DefinedFunc::New(store, inst.ref(), desc).ref());
+  }
+
+  // Replaces the captured references to the original instance's functions
+  // with references to this instance's.
+  auto restore_refs = [&](const InstanceSnapshot::RefImage& image) {
+    RefVec refs = image.refs;
+    for (auto&& [pos, func] : image.funcs) {
+      refs[pos] = inst->funcs_[func];
+    }
+    store.WriteBarrier(refs.begin(), refs.end());
+    return refs;
+  };
+
+  for (auto&& image : snapshot.tables_) {
+    Table::Ptr table = Table::New(store, image.type, Ref::Null);
+    table->elements_ = restore_refs(image.elements);
+    inst->tables_.push_back(table.ref());
+  }
+
+  for (auto&& image : snapshot.memories_) {
+    Memory::Ptr memory = Memory::New(store, image.type);
+    if (Failed(memory->InitFromImage(image.fd, image.data))) {
+      *out_trap = Trap::New(store, "unable to map memory snapshot");
+      return {};
+    }
+    inst->memories_.push_back(memory.ref());
+  }
+
+  for (auto&& image : snapshot.globals_) {
+    Value value = image.value;
+    if (image.func != kInvalidIndex) {
+      value.Set(inst->funcs_[image.func]);
+    }
+    inst->globals_.push_back(Global::New(store, image.type, value).ref());
+  }
+
+  for (auto&& desc : mod->desc().tags) {
+    inst->tags_.push_back(Tag::New(store, desc.type).ref());
+  }
+
+  inst->InitExports(mod->desc());
+
+  for (size_t i = 0; i < snapshot.elems_.size(); ++i) {
+    inst->elems_.push_back(ElemSegment(&mod->desc().elems[i],
+                                       restore_refs(snapshot.elems_[i])));
+  }
+
+  for (size_t i = 0; i < snapshot.dropped_datas_.size(); ++i) {
+    inst->datas_.emplace_back(&mod->desc().datas[i]);
+    if (snapshot.dropped_datas_[i]) {
+      inst->datas_.back().Drop();
+    }
+  }
+
+  return inst;
+}
+
+void Instance::AddImport(Store& store, ExternKind kind, Ref ref) {
+  imports_.push_back(ref);
+  store.WriteBarrier(ref);
+
+  switch (kind) {
+    case ExternKind::Func:   funcs_.push_back(ref); break;
+    case ExternKind::Table:  tables_.push_back(ref); break;
+    case ExternKind::Memory: memories_.push_back(ref); break;
+    case ExternKind::Global: globals_.push_back(ref); break;
+    case ExternKind::Tag:    tags_.push_back(ref); break;
+  }
+}
+
+void Instance::InitExports(const ModuleDesc& mod_desc) {
+  for (auto&& desc : mod_desc.exports) {
+    Ref ref;
+    switch (desc.type.type->kind) {
+      case ExternKind::Func:   ref = funcs_[desc.index]; break;
+      case ExternKind::Table:  ref = tables_[desc.index]; break;
+      case ExternKind::Memory: ref = memories_[desc.index]; break;
+      case ExternKind::Global: ref = globals_[desc.index]; break;
+      case ExternKind::Tag:    ref = tags_[desc.index]; break;
+    }
+    exports_.push_back(ref);
+  }
+}
+
 void Instance::Mark(Store& store) {
   store.Mark(module_);
   store.Mark(imports_);
@@ -1126,41 +1846,192 @@ void Instance::Mark(Store& store) {
   }
 }
 
+//// InstanceSnapshot ////
+InstanceSnapshot::InstanceSnapshot(Store& store, const Instance& inst)
+    : store_(store), module_(store, inst.module()), imports_(inst.imports()) {
+  for (Ref ref : imports_) {
+    roots_.emplace_back(store, ref);
+  }
+
+  const ModuleDesc& mod_desc = module_->desc();
+  FuncIndexMap own_funcs;
+  size_t first_func = inst.funcs().size() - mod_desc.funcs.size();
+  for (Index i = first_func; i < inst.funcs().size(); ++i) {
+    own_funcs.emplace(inst.funcs()[i].index, i);
+  }
+
+  // The imported memories, tables and globals are shared, so only the
+  // instance's own ones are captured.
+  size_t first_memory = inst.memories().size() - mod_desc.memories.size();
+  for (size_t i = first_memory; i < inst.memories().size(); ++i) {
+    Memory::Ptr memory{store, inst.memories()[i]};
+    MemoryImage image(memory->type());
+    const u8* data = memory->UnsafeData();
+    u64 size = memory->ByteSize();
+#if WABT_INTERP_COW_MEMORY
+    if (memory->IsGuarded()) {
+      image.fd = memfd_create("wasm-memory-snapshot", MFD_CLOEXEC);
+      bool ok = image.fd != -1 && ftruncate(image.fd, size) == 0;
+      // The memfd is sparse, so only the pages with data are written.
+      static const u64 os_page_size = sysconf(_SC_PAGESIZE);
+      for (u64 offset = 0; ok && offset < size; offset += os_page_size) {
+        const u8* page = data + offset;
+        if (std::all_of(page, page + os_page_size,
+                        [](u8 byte) { return byte == 0; })) {
+          continue;
+        }
+        ok = pwrite(image.fd, page, os_page_size, offset) ==
+             static_cast<ssize_t>(os_page_size);
+      }
+      if (!ok && image.fd != -1) {
+        close(image.fd);
+        image.fd = -1;
+      }
+    }
+#endif
+    if (image.fd == -1) {
+      image.data.assign(data, data + size);
+    }
+    memories_.push_back(std::move(image));
+  }
+
+  size_t first_table = inst.tables().size() - mod_desc.tables.size();
+  for (size_t i = first_table; i < inst.tables().size(); ++i) {
+    Table::Ptr table{store, inst.tables()[i]};
+    tables_.push_back(
+        TableImage{table->type(), CaptureRefs(table->elements(), own_funcs)});
+  }
+
+  size_t first_global = inst.globals().size() - mod_desc.globals.size();
+  for (size_t i = first_global; i < inst.globals().size(); ++i) {
+    Global::Ptr global{store, inst.globals()[i]};
+    GlobalImage image{global->type(), global->Get(), kInvalidIndex};
+    if (global->type().type.IsRef()) {
+      image.value.Set(
+          CaptureRef(image.value.Get<Ref>(), own_funcs, &image.func));
+    }
+    globals_.push_back(image);
+  }
+
+  for (auto&& elem : inst.elems()) {
+    elems_.push_back(CaptureRefs(elem.elements(), own_funcs));
+  }
+
+  for (auto&& data : inst.datas()) {
+    dropped_datas_.push_back(data.size() != data.desc().data.size());
+  }
+}
+
+InstanceSnapshot::~InstanceSnapshot() {
+#if WABT_INTERP_COW_MEMORY
+  for (auto&& image : memories_) {
+    if (image.fd != -1) {
+      close(image.fd);
+    }
+  }
+#endif
+}
+
+Ref InstanceSnapshot::CaptureRef(Ref ref,
+                                 const FuncIndexMap& own_funcs,
+                                 Index* out_func) {
+  auto iter = own_funcs.find(ref.index);
+  if (iter != own_funcs.end()) {
+    *out_func = iter->second;
+    return Ref::Null;
+  }
+  if (ref != Ref::Null) {
+    roots_.emplace_back(store_, ref);
+  }
+  return ref;
+}
+
+InstanceSnapshot::RefImage InstanceSnapshot::CaptureRefs(
+    const RefVec& refs,
+    const FuncIndexMap& own_funcs) {
+  RefImage image;
+  image.refs.reserve(refs.size());
+  for (Ref ref : refs) {
+    Index func = kInvalidIndex;
+    image.refs.push_back(CaptureRef(ref, own_funcs, &func));
+    if (func != kInvalidIndex) {
+      image.funcs.emplace_back(image.refs.size() - 1, func);
+    }
+  }
+  return image;
+}
+
 //// Thread ////
 Thread::Thread(Store& store, Stream* trace_stream)
-    : store_(store), trace_stream_(trace_stream) {
-  store.threads().insert(this);
+    : Thread(store, Options{Options::kDefaultValueStackSize,
+                            Options::kDefaultCallStackSize, trace_stream}) {}
+
+Thread::Thread(Store& store, const Options& options)
+    : store_(store),
+      fuel_(std::min(options.fuel, Options::kUnlimitedFuel)),
+      fuel_added_(fuel_),
+      epoch_deadline_(options.epoch_deadline),
+      trace_stream_(options.trace_stream),
+      profile_(options.profile) {
+  store.AddThread(this);
 
-  Thread::Options options;
   frames_.reserve(options.call_stack_size);
   values_.reserve(options.value_stack_size);
-  if (trace_stream) {
+  if (trace_stream_) {
     trace_source_ = std::make_unique<TraceSource>(this);
   }
 }
 
 Thread::~Thread() {
-  store_.threads().erase(this);
+  store_.RemoveThread(this);
+}
+
+void Thread::Reset() {
+  frames_.clear();
+  values_.clear();
+  exceptions_.clear();
+  inst_ = nullptr;
+  mod_ = nullptr;
+  fuel_ = Options::kUnlimitedFuel;
+  fuel_added_ = fuel_;
+  epoch_deadline_ = Options::kNoEpochDeadline;
 }
 
 void Thread::Mark() {
-  for (auto&& frame : frames_) {
+  // Each DefinedFunc frame owns the values from its first param up to the
+  // first value owned by the frame above it. The stack map for the frame's
+  // offset says which of them are references.
+  size_t top = values_.size();
+  for (auto iter = frames_.rbegin(); iter != frames_.rend(); ++iter) {
+    Frame& frame = *iter;
     frame.Mark(store_);
-  }
-  for (auto index : refs_) {
-    store_.Mark(values_[index].Get<Ref>());
+    if (!frame.inst) {
+      // A HostFunc's params are popped before it is called.
+      top = frame.values;
+      continue;
+    }
+
+    // Marking mustn't create roots, so don't hold the func in a RefPtr. The
+    // frame keeps it alive.
+    const FuncDesc& desc =
+        store_.UnsafeGetUnrooted<DefinedFunc>(frame.func)->desc();
+    size_t base = frame.values - desc.type.params.size();
+    if (const StackMapDesc* map = desc.GetStackMap(frame.offset)) {
+      for (u32 slot : map->refs) {
+        if (base + slot >= top) {
+          break;
+        }
+        store_.Mark(values_[base + slot].Get<Ref>());
+      }
+    }
+    top = base;
   }
   store_.Mark(exceptions_);
 }
 
 void Thread::PushValues(const ValueTypes& types, const Values& values) {
   assert(types.size() == values.size());
-  for (size_t i = 0; i < types.size(); ++i) {
-    if (IsReference(types[i])) {
-      refs_.push_back(values_.size());
-    }
-    values_.push_back(values[i]);
-  }
+  values_.insert(values_.end(), values.begin(), values.end());
 }
 
 #define TRAP(msg) *out_trap = Trap::New(store_, (msg), frames_), RunResult::Trap
@@ -1185,6 +2056,12 @@ RunResult Thread::PushCall(Ref func, u32 offset, Trap::Ptr* out_trap) {
 
 RunResult Thread::PushCall(const DefinedFunc& func, Trap::Ptr* out_trap) {
   TRAP_IF(frames_.size() == frames_.capacity(), "call stack exhausted");
+  if (WABT_UNLIKELY(!func.IsCompiled())) {
+    DefinedFunc::Ptr lazy_func = store_.UnsafeGet<DefinedFunc>(func.self());
+    if (CompileFunc(*lazy_func, out_trap) == RunResult::Trap) {
+      return RunResult::Trap;
+    }
+  }
   inst_ = store_.UnsafeGet<Instance>(func.instance()).get();
   mod_ = store_.UnsafeGet<Module>(inst_->module()).get();
   frames_.emplace_back(func.self(), values_.size(), exceptions_.size(),
@@ -1192,6 +2069,51 @@ RunResult Thread::PushCall(const DefinedFunc& func, Trap::Ptr* out_trap) {
   return RunResult::Ok;
 }
 
+RunResult Thread::CompileFunc(DefinedFunc& func, Trap::Ptr* out_trap) {
+  std::string error;
+  TRAP_IF(Failed(func.Compile(store_, &error)), error);
+  return RunResult::Ok;
+}
+
+RunResult Thread::PushCall(const DefinedFunc& func,
+                           const Values& params,
+                           Trap::Ptr* out_trap) {
+  assert(params.size() == func.type().params.size());
+  PushValues(func.type().params, params);
+  RunResult result = PushCall(func, out_trap);
+  if (profile_ && result == RunResult::Ok) {
+    profile_->OnCall(frames_.size() - 1);
+  }
+  return result;
+}
+
+void Thread::PopResults(const DefinedFunc& func, Values* out_results) {
+  PopValues(func.type().results, out_results);
+}
+
+void Thread::AddFuel(u64 fuel) {
+  // Saturate at kUnlimitedFuel.
+  fuel = std::min(fuel, Options::kUnlimitedFuel - static_cast<u64>(fuel_));
+  fuel_ = static_cast<s64>(static_cast<u64>(fuel_) + fuel);
+  fuel_added_ += fuel;
+}
+
+u64 Thread::GetFuel() const {
+  return fuel_ < 0 ? 0 : fuel_;
+}
+
+u64 Thread::GetFuelConsumed() const {
+  return fuel_added_ - fuel_;
+}
+
+void Thread::SetEpochDeadline(u64 deadline) {
+  epoch_deadline_ = deadline;
+}
+
+u64 Thread::GetEpochDeadline() const {
+  return epoch_deadline_;
+}
+
 RunResult Thread::PushCall(const HostFunc& func, Trap::Ptr* out_trap) {
   TRAP_IF(frames_.size() == frames_.capacity(), "call stack exhausted");
   inst_ = nullptr;
@@ -1221,9 +2143,27 @@ RunResult Thread::PopCall() {
   return RunResult::Ok;
 }
 
+// The frames of a call that trapped can't be resumed, and their values no
+// longer match their stack maps, so they are popped up to the HostFunc (if
+// any) that made the call. The trap keeps its own copy of the frames.
+void Thread::PopTrappedCall() {
+  while (!frames_.empty() && frames_.back().inst) {
+    frames_.pop_back();
+  }
+  if (frames_.empty()) {
+    values_.clear();
+    exceptions_.clear();
+  } else {
+    values_.resize(frames_.back().values);
+    exceptions_.resize(frames_.back().exceptions);
+  }
+}
+
 RunResult Thread::DoReturnCall(const Func::Ptr& func, Trap::Ptr* out_trap) {
   PopCall();
-  DoCall(func, out_trap);
+  if (DoCall(func, out_trap) == RunResult::Trap) {
+    return RunResult::Trap;
+  }
   return frames_.empty() ? RunResult::Return : RunResult::Ok;
 }
 
@@ -1235,28 +2175,35 @@ void Thread::PopValues(const ValueTypes& types, Values* out_values) {
 }
 
 RunResult Thread::Run(Trap::Ptr* out_trap) {
-  const int kDefaultInstructionCount = 1000;
-  RunResult result;
-  do {
-    result = Run(kDefaultInstructionCount, out_trap);
-  } while (result == RunResult::Ok);
-  return result;
+  return Run(-1, out_trap);
 }
 
 RunResult Thread::Run(int num_instructions, Trap::Ptr* out_trap) {
+  if (fuel_ < 0) {
+    return RunResult::OutOfFuel;
+  }
   DefinedFunc::Ptr func{store_, frames_.back().func};
-  for (; num_instructions > 0; --num_instructions) {
-    auto result = StepInternal(out_trap);
-    if (result != RunResult::Ok) {
-      return result;
+  store_.BlockGC();
+  RunResult result = RunResult::Ok;
+  if (trace_stream_ || profile_) {
+    while (result == RunResult::Ok &&
+           (num_instructions < 0 || num_instructions-- > 0)) {
+      result = StepInternal(out_trap);
     }
+  } else if (num_instructions < 0) {
+    result = Execute<false>(0, out_trap);
+  } else {
+    result = Execute<true>(num_instructions, out_trap);
   }
-  return RunResult::Ok;
+  if (result == RunResult::Trap) {
+    PopTrappedCall();
+  }
+  store_.UnblockGC();
+  return result;
 }
 
 RunResult Thread::Step(Trap::Ptr* out_trap) {
-  DefinedFunc::Ptr func{store_, frames_.back().func};
-  return StepInternal(out_trap);
+  return Run(1, out_trap);
 }
 
 Value& Thread::Pick(Index index) {
@@ -1270,9 +2217,6 @@ T WABT_VECTORCALL Thread::Pop() {
 }
 
 Value Thread::Pop() {
-  if (!refs_.empty() && refs_.back() >= values_.size() - 1) {
-    refs_.pop_back();
-  }
   auto value = values_.back();
   values_.pop_back();
   return value;
@@ -1286,6 +2230,15 @@ u64 Thread::PopPtr(const Table::Ptr& table) {
   return table->type().limits.is_64 ? Pop<u64>() : Pop<u32>();
 }
 
+u64 Thread::PickPtr(const Memory& memory, Index index) {
+  return memory.type().limits.is_64 ? Pick(index).Get<u64>()
+                                    : Pick(index).Get<u32>();
+}
+
+Memory& Thread::GetMemory(Index memidx) {
+  return *store_.UnsafeGetUnrooted<Memory>(inst_->memories()[memidx]);
+}
+
 void Thread::PushPtr(const Memory::Ptr& memory, u64 value) {
   if (memory->type().limits.is_64) {
     Push<u64>(value);
@@ -1317,79 +2270,156 @@ void Thread::Push(Value value) {
 }
 
 void Thread::Push(Ref ref) {
-  refs_.push_back(values_.size());
   values_.push_back(Value::Make(ref));
 }
 
 RunResult Thread::StepInternal(Trap::Ptr* out_trap) {
+  if (trace_stream_) {
+    auto& istream = mod_->desc().istream;
+    istream.Trace(trace_stream_, frames_.back().offset, trace_source_.get());
+  }
+  if (profile_) {
+    Istream::Offset offset = frames_.back().offset;
+    profile_->OnInstruction(frames_, mod_->desc().istream.Read(&offset).op);
+  }
+  return Execute<true>(1, out_trap);
+}
+
+#if WABT_INTERP_COMPUTED_GOTO
+#define CASE(name) case O::name: op_##name
+#define DISPATCH() goto* kDispatchTable[instr.op]
+#define NEXT()                                                 \
+  do {                                                         \
+    if (kHasBudget && WABT_UNLIKELY(--num_instructions <= 0)) { \
+      return RunResult::Ok;                                    \
+    }                                                          \
+    instr = istream.Read(&pc);                                 \
+    DISPATCH();                                                \
+  } while (0)
+#else
+#define CASE(name) case O::name
+#define NEXT() goto next
+#endif
+
+// Continue with the next instruction if the given expression returned
+// RunResult::Ok.
+#define NEXT_IF_OK(...)                           \
+  do {                                            \
+    RunResult result = (__VA_ARGS__);             \
+    if (WABT_UNLIKELY(result != RunResult::Ok)) { \
+      return result;                              \
+    }                                             \
+    NEXT();                                       \
+  } while (0)
+
+// Like NEXT_IF_OK, but for instructions that may change the current frame
+// (calls, returns and throws); `pc` and `istream` must be reloaded.
+#define RESUME_IF_OK(...)                         \
+  do {                                            \
+    RunResult result = (__VA_ARGS__);             \
+    if (WABT_UNLIKELY(result != RunResult::Ok)) { \
+      return result;                              \
+    }                                             \
+    goto resume;                                  \
+  } while (0)
+
+template <bool kHasBudget>
+RunResult Thread::Execute(int num_instructions, Trap::Ptr* out_trap) {
   using O = Opcode;
 
+#if WABT_INTERP_COMPUTED_GOTO
+  static const void* const kDispatchTable[] = {
+#define WABT_OPCODE(rtype, rtype2, type1, type2, type3, mem_size, prefix, \
+                    code, Name, text, decomp)                             \
+  &&op_##Name,
+#include "wabt/opcode.def"
+#undef WABT_OPCODE
+      &&op_Invalid,
+  };
+#endif
+
+  Instr instr;
+  // The budget is decremented before each instruction is read, including the
+  // first one.
+  ++num_instructions;
+
+resume:
+  // The current frame has changed, so `pc` and `istream` may refer to a
+  // different function or module.
   u32& pc = frames_.back().offset;
   auto& istream = mod_->desc().istream;
 
-  if (trace_stream_) {
-    istream.Trace(trace_stream_, pc, trace_source_.get());
-  }
-
   // clang-format off
-  auto instr = istream.Read(&pc);
+#if WABT_INTERP_COMPUTED_GOTO
+  NEXT();
+#else
+next:
+  if (kHasBudget && WABT_UNLIKELY(--num_instructions <= 0)) {
+    return RunResult::Ok;
+  }
+  instr = istream.Read(&pc);
+#endif
   switch (instr.op) {
-    case O::Unreachable:
+    CASE(Unreachable):
       return TRAP("unreachable executed");
 
-    case O::Br:
+    CASE(Br):
       pc = instr.imm_u32;
-      break;
+      NEXT();
 
-    case O::BrIf:
+    CASE(BrIf):
       if (Pop<u32>()) {
         pc = instr.imm_u32;
       }
-      break;
+      NEXT();
 
-    case O::BrOnNonNull: {
+    CASE(BrOnNonNull): {
       Ref ref = Pop<Ref>();
       if (ref != Ref::Null) {
         Push(ref);
         pc = instr.imm_u32;
       }
-      break;
+      NEXT();
     }
 
-    case O::BrOnNull: {
+    CASE(BrOnNull): {
       Ref ref = Pop<Ref>();
       if (ref == Ref::Null) {
         pc = instr.imm_u32;
       } else {
         Push(ref);
       }
-      break;
+      NEXT();
     }
 
-    case O::BrTable: {
+    CASE(BrTable): {
       auto key = Pop<u32>();
       if (key >= instr.imm_u32) {
         key = instr.imm_u32;
       }
-      pc += key * Istream::kBrTableEntrySize;
-      break;
+      pc += key * istream.BrTableEntrySize();
+      NEXT();
     }
 
-    case O::Return:
-      return PopCall();
+    CASE(Return):
+      RESUME_IF_OK(PopCall());
 
-    case O::Call: {
+    CASE(Call): {
       Ref new_func_ref = inst_->funcs()[instr.imm_u32];
       DefinedFunc::Ptr new_func{store_, new_func_ref};
+      if (WABT_UNLIKELY(!new_func->IsCompiled()) &&
+          CompileFunc(*new_func, out_trap) == RunResult::Trap) {
+        return RunResult::Trap;
+      }
       if (PushCall(new_func_ref, new_func->desc().code_offset, out_trap) ==
           RunResult::Trap) {
         return RunResult::Trap;
       }
-      break;
+      goto resume;
     }
 
-    case O::CallIndirect:
-    case O::ReturnCallIndirect: {
+    CASE(CallIndirect):
+    CASE(ReturnCallIndirect): {
       Table::Ptr table{store_, inst_->tables()[instr.imm_u32x2.fst]};
       auto&& func_type = mod_->desc().func_types[instr.imm_u32x2.snd];
       u64 entry = PopPtr(table);
@@ -1401,800 +2431,857 @@ RunResult Thread::StepInternal(Trap::Ptr* out_trap) {
           Failed(Match(new_func->type(), func_type, nullptr)),
           "indirect call signature mismatch");  // TODO: don't use "signature"
       if (instr.op == O::ReturnCallIndirect) {
-        return DoReturnCall(new_func, out_trap);
+        RESUME_IF_OK(DoReturnCall(new_func, out_trap));
       } else {
-        return DoCall(new_func, out_trap);
+        RESUME_IF_OK(DoCall(new_func, out_trap));
       }
     }
 
-    case O::CallRef:
-    case O::ReturnCallRef: {
+    CASE(CallRef):
+    CASE(ReturnCallRef): {
       Ref new_func_ref = Pop<Ref>();
       TRAP_IF(new_func_ref == Ref::Null, "null function reference");
       Func::Ptr new_func{store_, new_func_ref};
 
       if (instr.op == O::ReturnCallRef) {
-        return DoReturnCall(new_func, out_trap);
+        RESUME_IF_OK(DoReturnCall(new_func, out_trap));
       } else {
-        return DoCall(new_func, out_trap);
+        RESUME_IF_OK(DoCall(new_func, out_trap));
       }
     }
 
-    case O::Drop:
+    CASE(Drop):
       Pop();
-      break;
+      NEXT();
 
-    case O::Select: {
+    CASE(Select): {
       auto cond = Pop<u32>();
-      auto ref = false;
-      // check if either is a ref
-      ref |= !refs_.empty() && refs_.back() == values_.size() - 1;
       Value false_ = Pop();
-      ref |= !refs_.empty() && refs_.back() == values_.size() - 1;
       Value true_ = Pop();
-      if (ref) {
-        refs_.push_back(values_.size());
-      }
       Push(cond ? true_ : false_);
-      break;
+      NEXT();
     }
 
-    case O::InterpLocalGetRef:
-      refs_.push_back(values_.size());
-      [[fallthrough]];
-    case O::LocalGet:
+    CASE(LocalGet):
       Push(Pick(instr.imm_u32));
-      break;
+      NEXT();
 
-    case O::LocalSet: {
+    CASE(LocalSet): {
       Pick(instr.imm_u32) = Pick(1);
       Pop();
-      break;
+      NEXT();
     }
 
-    case O::LocalTee:
+    CASE(LocalTee):
       Pick(instr.imm_u32) = Pick(1);
-      break;
-
-    case O::InterpMarkRef:
-      refs_.push_back(values_.size() - instr.imm_u32);
-      break;
+      NEXT();
 
-    case O::InterpGlobalGetRef:
-      refs_.push_back(values_.size());
-      [[fallthrough]];
-    case O::GlobalGet: {
+    CASE(GlobalGet): {
       Global::Ptr global{store_, inst_->globals()[instr.imm_u32]};
       Push(global->Get());
-      break;
+      NEXT();
     }
 
-    case O::GlobalSet: {
+    CASE(GlobalSet): {
       Global::Ptr global{store_, inst_->globals()[instr.imm_u32]};
-      global->UnsafeSet(Pop());
-      break;
+      global->Set(store_, Pop());
+      NEXT();
     }
 
-    case O::I32Load:    return DoLoad<u32>(instr, out_trap);
-    case O::I64Load:    return DoLoad<u64>(instr, out_trap);
-    case O::F32Load:    return DoLoad<f32>(instr, out_trap);
-    case O::F64Load:    return DoLoad<f64>(instr, out_trap);
-    case O::I32Load8S:  return DoLoad<s32, s8>(instr, out_trap);
-    case O::I32Load8U:  return DoLoad<u32, u8>(instr, out_trap);
-    case O::I32Load16S: return DoLoad<s32, s16>(instr, out_trap);
-    case O::I32Load16U: return DoLoad<u32, u16>(instr, out_trap);
-    case O::I64Load8S:  return DoLoad<s64, s8>(instr, out_trap);
-    case O::I64Load8U:  return DoLoad<u64, u8>(instr, out_trap);
-    case O::I64Load16S: return DoLoad<s64, s16>(instr, out_trap);
-    case O::I64Load16U: return DoLoad<u64, u16>(instr, out_trap);
-    case O::I64Load32S: return DoLoad<s64, s32>(instr, out_trap);
-    case O::I64Load32U: return DoLoad<u64, u32>(instr, out_trap);
-
-    case O::I32Store:   return DoStore<u32>(instr, out_trap);
-    case O::I64Store:   return DoStore<u64>(instr, out_trap);
-    case O::F32Store:   return DoStore<f32>(instr, out_trap);
-    case O::F64Store:   return DoStore<f64>(instr, out_trap);
-    case O::I32Store8:  return DoStore<u32, u8>(instr, out_trap);
-    case O::I32Store16: return DoStore<u32, u16>(instr, out_trap);
-    case O::I64Store8:  return DoStore<u64, u8>(instr, out_trap);
-    case O::I64Store16: return DoStore<u64, u16>(instr, out_trap);
-    case O::I64Store32: return DoStore<u64, u32>(instr, out_trap);
-
-    case O::MemorySize: {
+    CASE(I32Load):      NEXT_IF_OK(DoLoad<u32>(instr, out_trap));
+    CASE(I64Load):      NEXT_IF_OK(DoLoad<u64>(instr, out_trap));
+    CASE(F32Load):      NEXT_IF_OK(DoLoad<f32>(instr, out_trap));
+    CASE(F64Load):      NEXT_IF_OK(DoLoad<f64>(instr, out_trap));
+    CASE(I32Load8S):    NEXT_IF_OK(DoLoad<s32, s8>(instr, out_trap));
+    CASE(I32Load8U):    NEXT_IF_OK(DoLoad<u32, u8>(instr, out_trap));
+    CASE(I32Load16S):   NEXT_IF_OK(DoLoad<s32, s16>(instr, out_trap));
+    CASE(I32Load16U):   NEXT_IF_OK(DoLoad<u32, u16>(instr, out_trap));
+    CASE(I64Load8S):    NEXT_IF_OK(DoLoad<s64, s8>(instr, out_trap));
+    CASE(I64Load8U):    NEXT_IF_OK(DoLoad<u64, u8>(instr, out_trap));
+    CASE(I64Load16S):   NEXT_IF_OK(DoLoad<s64, s16>(instr, out_trap));
+    CASE(I64Load16U):   NEXT_IF_OK(DoLoad<u64, u16>(instr, out_trap));
+    CASE(I64Load32S):   NEXT_IF_OK(DoLoad<s64, s32>(instr, out_trap));
+    CASE(I64Load32U):   NEXT_IF_OK(DoLoad<u64, u32>(instr, out_trap));
+
+    CASE(I32Store):     NEXT_IF_OK(DoStore<u32>(instr, out_trap));
+    CASE(I64Store):     NEXT_IF_OK(DoStore<u64>(instr, out_trap));
+    CASE(F32Store):     NEXT_IF_OK(DoStore<f32>(instr, out_trap));
+    CASE(F64Store):     NEXT_IF_OK(DoStore<f64>(instr, out_trap));
+    CASE(I32Store8):    NEXT_IF_OK(DoStore<u32, u8>(instr, out_trap));
+    CASE(I32Store16):   NEXT_IF_OK(DoStore<u32, u16>(instr, out_trap));
+    CASE(I64Store8):    NEXT_IF_OK(DoStore<u64, u8>(instr, out_trap));
+    CASE(I64Store16):   NEXT_IF_OK(DoStore<u64, u16>(instr, out_trap));
+    CASE(I64Store32):   NEXT_IF_OK(DoStore<u64, u32>(instr, out_trap));
+
+    CASE(MemorySize): {
       Memory::Ptr memory{store_, inst_->memories()[instr.imm_u32]};
       PushPtr(memory, memory->PageSize());
-      break;
+      NEXT();
     }
 
-    case O::MemoryGrow: {
+    CASE(MemoryGrow): {
       Memory::Ptr memory{store_, inst_->memories()[instr.imm_u32]};
-      u64 old_size = memory->PageSize();
-      if (Failed(memory->Grow(PopPtr(memory)))) {
+      u64 old_size;
+      if (Failed(memory->Grow(PopPtr(memory), &old_size))) {
         PushPtr(memory, -1);
       } else {
         PushPtr(memory, old_size);
       }
-      break;
+      NEXT();
     }
 
-    case O::I32Const: Push(instr.imm_u32); break;
-    case O::F32Const: Push(instr.imm_f32); break;
-    case O::I64Const: Push(instr.imm_u64); break;
-    case O::F64Const: Push(instr.imm_f64); break;
-
-    case O::I32Eqz: return DoUnop(IntEqz<u32>);
-    case O::I32Eq:  return DoBinop(Eq<u32>);
-    case O::I32Ne:  return DoBinop(Ne<u32>);
-    case O::I32LtS: return DoBinop(Lt<s32>);
-    case O::I32LtU: return DoBinop(Lt<u32>);
-    case O::I32GtS: return DoBinop(Gt<s32>);
-    case O::I32GtU: return DoBinop(Gt<u32>);
-    case O::I32LeS: return DoBinop(Le<s32>);
-    case O::I32LeU: return DoBinop(Le<u32>);
-    case O::I32GeS: return DoBinop(Ge<s32>);
-    case O::I32GeU: return DoBinop(Ge<u32>);
-
-    case O::I64Eqz: return DoUnop(IntEqz<u64>);
-    case O::I64Eq:  return DoBinop(Eq<u64>);
-    case O::I64Ne:  return DoBinop(Ne<u64>);
-    case O::I64LtS: return DoBinop(Lt<s64>);
-    case O::I64LtU: return DoBinop(Lt<u64>);
-    case O::I64GtS: return DoBinop(Gt<s64>);
-    case O::I64GtU: return DoBinop(Gt<u64>);
-    case O::I64LeS: return DoBinop(Le<s64>);
-    case O::I64LeU: return DoBinop(Le<u64>);
-    case O::I64GeS: return DoBinop(Ge<s64>);
-    case O::I64GeU: return DoBinop(Ge<u64>);
-
-    case O::F32Eq:  return DoBinop(Eq<f32>);
-    case O::F32Ne:  return DoBinop(Ne<f32>);
-    case O::F32Lt:  return DoBinop(Lt<f32>);
-    case O::F32Gt:  return DoBinop(Gt<f32>);
-    case O::F32Le:  return DoBinop(Le<f32>);
-    case O::F32Ge:  return DoBinop(Ge<f32>);
-
-    case O::F64Eq:  return DoBinop(Eq<f64>);
-    case O::F64Ne:  return DoBinop(Ne<f64>);
-    case O::F64Lt:  return DoBinop(Lt<f64>);
-    case O::F64Gt:  return DoBinop(Gt<f64>);
-    case O::F64Le:  return DoBinop(Le<f64>);
-    case O::F64Ge:  return DoBinop(Ge<f64>);
-
-    case O::I32Clz:    return DoUnop(IntClz<u32>);
-    case O::I32Ctz:    return DoUnop(IntCtz<u32>);
-    case O::I32Popcnt: return DoUnop(IntPopcnt<u32>);
-    case O::I32Add:    return DoBinop(Add<u32>);
-    case O::I32Sub:    return DoBinop(Sub<u32>);
-    case O::I32Mul:    return DoBinop(Mul<u32>);
-    case O::I32DivS:   return DoBinop(IntDiv<s32>, out_trap);
-    case O::I32DivU:   return DoBinop(IntDiv<u32>, out_trap);
-    case O::I32RemS:   return DoBinop(IntRem<s32>, out_trap);
-    case O::I32RemU:   return DoBinop(IntRem<u32>, out_trap);
-    case O::I32And:    return DoBinop(IntAnd<u32>);
-    case O::I32Or:     return DoBinop(IntOr<u32>);
-    case O::I32Xor:    return DoBinop(IntXor<u32>);
-    case O::I32Shl:    return DoBinop(IntShl<u32>);
-    case O::I32ShrS:   return DoBinop(IntShr<s32>);
-    case O::I32ShrU:   return DoBinop(IntShr<u32>);
-    case O::I32Rotl:   return DoBinop(IntRotl<u32>);
-    case O::I32Rotr:   return DoBinop(IntRotr<u32>);
-
-    case O::I64Clz:    return DoUnop(IntClz<u64>);
-    case O::I64Ctz:    return DoUnop(IntCtz<u64>);
-    case O::I64Popcnt: return DoUnop(IntPopcnt<u64>);
-    case O::I64Add:    return DoBinop(Add<u64>);
-    case O::I64Sub:    return DoBinop(Sub<u64>);
-    case O::I64Mul:    return DoBinop(Mul<u64>);
-    case O::I64DivS:   return DoBinop(IntDiv<s64>, out_trap);
-    case O::I64DivU:   return DoBinop(IntDiv<u64>, out_trap);
-    case O::I64RemS:   return DoBinop(IntRem<s64>, out_trap);
-    case O::I64RemU:   return DoBinop(IntRem<u64>, out_trap);
-    case O::I64And:    return DoBinop(IntAnd<u64>);
-    case O::I64Or:     return DoBinop(IntOr<u64>);
-    case O::I64Xor:    return DoBinop(IntXor<u64>);
-    case O::I64Shl:    return DoBinop(IntShl<u64>);
-    case O::I64ShrS:   return DoBinop(IntShr<s64>);
-    case O::I64ShrU:   return DoBinop(IntShr<u64>);
-    case O::I64Rotl:   return DoBinop(IntRotl<u64>);
-    case O::I64Rotr:   return DoBinop(IntRotr<u64>);
-
-    case O::F32Abs:     return DoUnop(FloatAbs<f32>);
-    case O::F32Neg:     return DoUnop(FloatNeg<f32>);
-    case O::F32Ceil:    return DoUnop(FloatCeil<f32>);
-    case O::F32Floor:   return DoUnop(FloatFloor<f32>);
-    case O::F32Trunc:   return DoUnop(FloatTrunc<f32>);
-    case O::F32Nearest: return DoUnop(FloatNearest<f32>);
-    case O::F32Sqrt:    return DoUnop(FloatSqrt<f32>);
-    case O::F32Add:      return DoBinop(Add<f32>);
-    case O::F32Sub:      return DoBinop(Sub<f32>);
-    case O::F32Mul:      return DoBinop(Mul<f32>);
-    case O::F32Div:      return DoBinop(FloatDiv<f32>);
-    case O::F32Min:      return DoBinop(FloatMin<f32>);
-    case O::F32Max:      return DoBinop(FloatMax<f32>);
-    case O::F32Copysign: return DoBinop(FloatCopysign<f32>);
-
-    case O::F64Abs:     return DoUnop(FloatAbs<f64>);
-    case O::F64Neg:     return DoUnop(FloatNeg<f64>);
-    case O::F64Ceil:    return DoUnop(FloatCeil<f64>);
-    case O::F64Floor:   return DoUnop(FloatFloor<f64>);
-    case O::F64Trunc:   return DoUnop(FloatTrunc<f64>);
-    case O::F64Nearest: return DoUnop(FloatNearest<f64>);
-    case O::F64Sqrt:    return DoUnop(FloatSqrt<f64>);
-    case O::F64Add:      return DoBinop(Add<f64>);
-    case O::F64Sub:      return DoBinop(Sub<f64>);
-    case O::F64Mul:      return DoBinop(Mul<f64>);
-    case O::F64Div:      return DoBinop(FloatDiv<f64>);
-    case O::F64Min:      return DoBinop(FloatMin<f64>);
-    case O::F64Max:      return DoBinop(FloatMax<f64>);
-    case O::F64Copysign: return DoBinop(FloatCopysign<f64>);
-
-    case O::I32WrapI64:      return DoConvert<u32, u64>(out_trap);
-    case O::I32TruncF32S:    return DoConvert<s32, f32>(out_trap);
-    case O::I32TruncF32U:    return DoConvert<u32, f32>(out_trap);
-    case O::I32TruncF64S:    return DoConvert<s32, f64>(out_trap);
-    case O::I32TruncF64U:    return DoConvert<u32, f64>(out_trap);
-    case O::I64ExtendI32S:   return DoConvert<s64, s32>(out_trap);
-    case O::I64ExtendI32U:   return DoConvert<u64, u32>(out_trap);
-    case O::I64TruncF32S:    return DoConvert<s64, f32>(out_trap);
-    case O::I64TruncF32U:    return DoConvert<u64, f32>(out_trap);
-    case O::I64TruncF64S:    return DoConvert<s64, f64>(out_trap);
-    case O::I64TruncF64U:    return DoConvert<u64, f64>(out_trap);
-    case O::F32ConvertI32S:  return DoConvert<f32, s32>(out_trap);
-    case O::F32ConvertI32U:  return DoConvert<f32, u32>(out_trap);
-    case O::F32ConvertI64S:  return DoConvert<f32, s64>(out_trap);
-    case O::F32ConvertI64U:  return DoConvert<f32, u64>(out_trap);
-    case O::F32DemoteF64:    return DoConvert<f32, f64>(out_trap);
-    case O::F64ConvertI32S:  return DoConvert<f64, s32>(out_trap);
-    case O::F64ConvertI32U:  return DoConvert<f64, u32>(out_trap);
-    case O::F64ConvertI64S:  return DoConvert<f64, s64>(out_trap);
-    case O::F64ConvertI64U:  return DoConvert<f64, u64>(out_trap);
-    case O::F64PromoteF32:   return DoConvert<f64, f32>(out_trap);
-
-    case O::I32ReinterpretF32: return DoReinterpret<u32, f32>();
-    case O::F32ReinterpretI32: return DoReinterpret<f32, u32>();
-    case O::I64ReinterpretF64: return DoReinterpret<u64, f64>();
-    case O::F64ReinterpretI64: return DoReinterpret<f64, u64>();
-
-    case O::I32Extend8S:   return DoUnop(IntExtend<u32, 7>);
-    case O::I32Extend16S:  return DoUnop(IntExtend<u32, 15>);
-    case O::I64Extend8S:   return DoUnop(IntExtend<u64, 7>);
-    case O::I64Extend16S:  return DoUnop(IntExtend<u64, 15>);
-    case O::I64Extend32S:  return DoUnop(IntExtend<u64, 31>);
-
-    case O::InterpAlloca:
+    CASE(I32Const):   Push(instr.imm_u32); NEXT();
+    CASE(F32Const):   Push(instr.imm_f32); NEXT();
+    CASE(I64Const):   Push(instr.imm_u64); NEXT();
+    CASE(F64Const):   Push(instr.imm_f64); NEXT();
+
+    CASE(I32Eqz):   NEXT_IF_OK(DoUnop(IntEqz<u32>));
+    CASE(I32Eq):    NEXT_IF_OK(DoBinop(Eq<u32>));
+    CASE(I32Ne):    NEXT_IF_OK(DoBinop(Ne<u32>));
+    CASE(I32LtS):   NEXT_IF_OK(DoBinop(Lt<s32>));
+    CASE(I32LtU):   NEXT_IF_OK(DoBinop(Lt<u32>));
+    CASE(I32GtS):   NEXT_IF_OK(DoBinop(Gt<s32>));
+    CASE(I32GtU):   NEXT_IF_OK(DoBinop(Gt<u32>));
+    CASE(I32LeS):   NEXT_IF_OK(DoBinop(Le<s32>));
+    CASE(I32LeU):   NEXT_IF_OK(DoBinop(Le<u32>));
+    CASE(I32GeS):   NEXT_IF_OK(DoBinop(Ge<s32>));
+    CASE(I32GeU):   NEXT_IF_OK(DoBinop(Ge<u32>));
+
+    CASE(I64Eqz):   NEXT_IF_OK(DoUnop(IntEqz<u64>));
+    CASE(I64Eq):    NEXT_IF_OK(DoBinop(Eq<u64>));
+    CASE(I64Ne):    NEXT_IF_OK(DoBinop(Ne<u64>));
+    CASE(I64LtS):   NEXT_IF_OK(DoBinop(Lt<s64>));
+    CASE(I64LtU):   NEXT_IF_OK(DoBinop(Lt<u64>));
+    CASE(I64GtS):   NEXT_IF_OK(DoBinop(Gt<s64>));
+    CASE(I64GtU):   NEXT_IF_OK(DoBinop(Gt<u64>));
+    CASE(I64LeS):   NEXT_IF_OK(DoBinop(Le<s64>));
+    CASE(I64LeU):   NEXT_IF_OK(DoBinop(Le<u64>));
+    CASE(I64GeS):   NEXT_IF_OK(DoBinop(Ge<s64>));
+    CASE(I64GeU):   NEXT_IF_OK(DoBinop(Ge<u64>));
+
+    CASE(F32Eq):    NEXT_IF_OK(DoBinop(Eq<f32>));
+    CASE(F32Ne):    NEXT_IF_OK(DoBinop(Ne<f32>));
+    CASE(F32Lt):    NEXT_IF_OK(DoBinop(Lt<f32>));
+    CASE(F32Gt):    NEXT_IF_OK(DoBinop(Gt<f32>));
+    CASE(F32Le):    NEXT_IF_OK(DoBinop(Le<f32>));
+    CASE(F32Ge):    NEXT_IF_OK(DoBinop(Ge<f32>));
+
+    CASE(F64Eq):    NEXT_IF_OK(DoBinop(Eq<f64>));
+    CASE(F64Ne):    NEXT_IF_OK(DoBinop(Ne<f64>));
+    CASE(F64Lt):    NEXT_IF_OK(DoBinop(Lt<f64>));
+    CASE(F64Gt):    NEXT_IF_OK(DoBinop(Gt<f64>));
+    CASE(F64Le):    NEXT_IF_OK(DoBinop(Le<f64>));
+    CASE(F64Ge):    NEXT_IF_OK(DoBinop(Ge<f64>));
+
+    CASE(I32Clz):      NEXT_IF_OK(DoUnop(IntClz<u32>));
+    CASE(I32Ctz):      NEXT_IF_OK(DoUnop(IntCtz<u32>));
+    CASE(I32Popcnt):   NEXT_IF_OK(DoUnop(IntPopcnt<u32>));
+    CASE(I32Add):      NEXT_IF_OK(DoBinop(Add<u32>));
+    CASE(I32Sub):      NEXT_IF_OK(DoBinop(Sub<u32>));
+    CASE(I32Mul):      NEXT_IF_OK(DoBinop(Mul<u32>));
+    CASE(I32DivS):     NEXT_IF_OK(DoBinop(IntDiv<s32>, out_trap));
+    CASE(I32DivU):     NEXT_IF_OK(DoBinop(IntDiv<u32>, out_trap));
+    CASE(I32RemS):     NEXT_IF_OK(DoBinop(IntRem<s32>, out_trap));
+    CASE(I32RemU):     NEXT_IF_OK(DoBinop(IntRem<u32>, out_trap));
+    CASE(I32And):      NEXT_IF_OK(DoBinop(IntAnd<u32>));
+    CASE(I32Or):       NEXT_IF_OK(DoBinop(IntOr<u32>));
+    CASE(I32Xor):      NEXT_IF_OK(DoBinop(IntXor<u32>));
+    CASE(I32Shl):      NEXT_IF_OK(DoBinop(IntShl<u32>));
+    CASE(I32ShrS):     NEXT_IF_OK(DoBinop(IntShr<s32>));
+    CASE(I32ShrU):     NEXT_IF_OK(DoBinop(IntShr<u32>));
+    CASE(I32Rotl):     NEXT_IF_OK(DoBinop(IntRotl<u32>));
+    CASE(I32Rotr):     NEXT_IF_OK(DoBinop(IntRotr<u32>));
+
+    CASE(I64Clz):      NEXT_IF_OK(DoUnop(IntClz<u64>));
+    CASE(I64Ctz):      NEXT_IF_OK(DoUnop(IntCtz<u64>));
+    CASE(I64Popcnt):   NEXT_IF_OK(DoUnop(IntPopcnt<u64>));
+    CASE(I64Add):      NEXT_IF_OK(DoBinop(Add<u64>));
+    CASE(I64Sub):      NEXT_IF_OK(DoBinop(Sub<u64>));
+    CASE(I64Mul):      NEXT_IF_OK(DoBinop(Mul<u64>));
+    CASE(I64DivS):     NEXT_IF_OK(DoBinop(IntDiv<s64>, out_trap));
+    CASE(I64DivU):     NEXT_IF_OK(DoBinop(IntDiv<u64>, out_trap));
+    CASE(I64RemS):     NEXT_IF_OK(DoBinop(IntRem<s64>, out_trap));
+    CASE(I64RemU):     NEXT_IF_OK(DoBinop(IntRem<u64>, out_trap));
+    CASE(I64And):      NEXT_IF_OK(DoBinop(IntAnd<u64>));
+    CASE(I64Or):       NEXT_IF_OK(DoBinop(IntOr<u64>));
+    CASE(I64Xor):      NEXT_IF_OK(DoBinop(IntXor<u64>));
+    CASE(I64Shl):      NEXT_IF_OK(DoBinop(IntShl<u64>));
+    CASE(I64ShrS):     NEXT_IF_OK(DoBinop(IntShr<s64>));
+    CASE(I64ShrU):     NEXT_IF_OK(DoBinop(IntShr<u64>));
+    CASE(I64Rotl):     NEXT_IF_OK(DoBinop(IntRotl<u64>));
+    CASE(I64Rotr):     NEXT_IF_OK(DoBinop(IntRotr<u64>));
+
+    CASE(F32Abs):       NEXT_IF_OK(DoUnop(FloatAbs<f32>));
+    CASE(F32Neg):       NEXT_IF_OK(DoUnop(FloatNeg<f32>));
+    CASE(F32Ceil):      NEXT_IF_OK(DoUnop(FloatCeil<f32>));
+    CASE(F32Floor):     NEXT_IF_OK(DoUnop(FloatFloor<f32>));
+    CASE(F32Trunc):     NEXT_IF_OK(DoUnop(FloatTrunc<f32>));
+    CASE(F32Nearest):   NEXT_IF_OK(DoUnop(FloatNearest<f32>));
+    CASE(F32Sqrt):      NEXT_IF_OK(DoUnop(FloatSqrt<f32>));
+    CASE(F32Add):        NEXT_IF_OK(DoBinop(Add<f32>));
+    CASE(F32Sub):        NEXT_IF_OK(DoBinop(Sub<f32>));
+    CASE(F32Mul):        NEXT_IF_OK(DoBinop(Mul<f32>));
+    CASE(F32Div):        NEXT_IF_OK(DoBinop(FloatDiv<f32>));
+    CASE(F32Min):        NEXT_IF_OK(DoBinop(FloatMin<f32>));
+    CASE(F32Max):        NEXT_IF_OK(DoBinop(FloatMax<f32>));
+    CASE(F32Copysign):   NEXT_IF_OK(DoBinop(FloatCopysign<f32>));
+
+    CASE(F64Abs):       NEXT_IF_OK(DoUnop(FloatAbs<f64>));
+    CASE(F64Neg):       NEXT_IF_OK(DoUnop(FloatNeg<f64>));
+    CASE(F64Ceil):      NEXT_IF_OK(DoUnop(FloatCeil<f64>));
+    CASE(F64Floor):     NEXT_IF_OK(DoUnop(FloatFloor<f64>));
+    CASE(F64Trunc):     NEXT_IF_OK(DoUnop(FloatTrunc<f64>));
+    CASE(F64Nearest):   NEXT_IF_OK(DoUnop(FloatNearest<f64>));
+    CASE(F64Sqrt):      NEXT_IF_OK(DoUnop(FloatSqrt<f64>));
+    CASE(F64Add):        NEXT_IF_OK(DoBinop(Add<f64>));
+    CASE(F64Sub):        NEXT_IF_OK(DoBinop(Sub<f64>));
+    CASE(F64Mul):        NEXT_IF_OK(DoBinop(Mul<f64>));
+    CASE(F64Div):        NEXT_IF_OK(DoBinop(FloatDiv<f64>));
+    CASE(F64Min):        NEXT_IF_OK(DoBinop(FloatMin<f64>));
+    CASE(F64Max):        NEXT_IF_OK(DoBinop(FloatMax<f64>));
+    CASE(F64Copysign):   NEXT_IF_OK(DoBinop(FloatCopysign<f64>));
+
+    CASE(I32WrapI64):        NEXT_IF_OK(DoConvert<u32, u64>(out_trap));
+    CASE(I32TruncF32S):      NEXT_IF_OK(DoConvert<s32, f32>(out_trap));
+    CASE(I32TruncF32U):      NEXT_IF_OK(DoConvert<u32, f32>(out_trap));
+    CASE(I32TruncF64S):      NEXT_IF_OK(DoConvert<s32, f64>(out_trap));
+    CASE(I32TruncF64U):      NEXT_IF_OK(DoConvert<u32, f64>(out_trap));
+    CASE(I64ExtendI32S):     NEXT_IF_OK(DoConvert<s64, s32>(out_trap));
+    CASE(I64ExtendI32U):     NEXT_IF_OK(DoConvert<u64, u32>(out_trap));
+    CASE(I64TruncF32S):      NEXT_IF_OK(DoConvert<s64, f32>(out_trap));
+    CASE(I64TruncF32U):      NEXT_IF_OK(DoConvert<u64, f32>(out_trap));
+    CASE(I64TruncF64S):      NEXT_IF_OK(DoConvert<s64, f64>(out_trap));
+    CASE(I64TruncF64U):      NEXT_IF_OK(DoConvert<u64, f64>(out_trap));
+    CASE(F32ConvertI32S):    NEXT_IF_OK(DoConvert<f32, s32>(out_trap));
+    CASE(F32ConvertI32U):    NEXT_IF_OK(DoConvert<f32, u32>(out_trap));
+    CASE(F32ConvertI64S):    NEXT_IF_OK(DoConvert<f32, s64>(out_trap));
+    CASE(F32ConvertI64U):    NEXT_IF_OK(DoConvert<f32, u64>(out_trap));
+    CASE(F32DemoteF64):      NEXT_IF_OK(DoConvert<f32, f64>(out_trap));
+    CASE(F64ConvertI32S):    NEXT_IF_OK(DoConvert<f64, s32>(out_trap));
+    CASE(F64ConvertI32U):    NEXT_IF_OK(DoConvert<f64, u32>(out_trap));
+    CASE(F64ConvertI64S):    NEXT_IF_OK(DoConvert<f64, s64>(out_trap));
+    CASE(F64ConvertI64U):    NEXT_IF_OK(DoConvert<f64, u64>(out_trap));
+    CASE(F64PromoteF32):     NEXT_IF_OK(DoConvert<f64, f32>(out_trap));
+
+    CASE(I32ReinterpretF32):   NEXT_IF_OK(DoReinterpret<u32, f32>());
+    CASE(F32ReinterpretI32):   NEXT_IF_OK(DoReinterpret<f32, u32>());
+    CASE(I64ReinterpretF64):   NEXT_IF_OK(DoReinterpret<u64, f64>());
+    CASE(F64ReinterpretI64):   NEXT_IF_OK(DoReinterpret<f64, u64>());
+
+    CASE(I32Extend8S):     NEXT_IF_OK(DoUnop(IntExtend<u32, 7>));
+    CASE(I32Extend16S):    NEXT_IF_OK(DoUnop(IntExtend<u32, 15>));
+    CASE(I64Extend8S):     NEXT_IF_OK(DoUnop(IntExtend<u64, 7>));
+    CASE(I64Extend16S):    NEXT_IF_OK(DoUnop(IntExtend<u64, 15>));
+    CASE(I64Extend32S):    NEXT_IF_OK(DoUnop(IntExtend<u64, 31>));
+
+    CASE(InterpAlloca):
       values_.resize(values_.size() + instr.imm_u32);
-      // refs_ will be marked in InterpMarkRef.
-      break;
+      NEXT();
 
-    case O::InterpBrUnless:
+    CASE(InterpBrUnless):
       if (!Pop<u32>()) {
         pc = instr.imm_u32;
       }
-      break;
+      NEXT();
 
-    case O::InterpCallImport: {
+    CASE(InterpCallImport): {
       Ref new_func_ref = inst_->funcs()[instr.imm_u32];
       Func::Ptr new_func{store_, new_func_ref};
-      return DoCall(new_func, out_trap);
+      RESUME_IF_OK(DoCall(new_func, out_trap));
     }
 
-    case O::InterpDropKeep: {
+    CASE(InterpDropKeep): {
       auto drop = instr.imm_u32x2.fst;
       auto keep = instr.imm_u32x2.snd;
-      // Shift kept refs down.
-      auto iter = refs_.rbegin();
-      for (; iter != refs_.rend(); ++iter) {
-        if (*iter >= values_.size() - keep) {
-          *iter -= drop;
-        } else {
-          break;
-        }
-      }
-      // Find dropped refs.
-      auto drop_iter = iter;
-      for (; drop_iter != refs_.rend(); ++drop_iter) {
-        if (*drop_iter < values_.size() - keep - drop) {
-          break;
-        }
-      }
-      // Erase dropped refs.
-      refs_.erase(drop_iter.base(), iter.base());
       std::move(values_.end() - keep, values_.end(),
                 values_.end() - drop - keep);
       values_.resize(values_.size() - drop);
-      break;
+      NEXT();
     }
 
-    case O::InterpCatchDrop: {
+    CASE(InterpCatchDrop): {
       auto drop = instr.imm_u32;
       for (u32 i = 0; i < drop; i++) {
         exceptions_.pop_back();
       }
-      break;
+      NEXT();
     }
 
+    CASE(InterpConsumeFuel):
+      fuel_ -= instr.imm_u32;
+      NEXT();
+
+    CASE(InterpCheckFuel):
+      fuel_ -= instr.imm_u32;
+      if (WABT_UNLIKELY(fuel_ < 0)) {
+        return RunResult::OutOfFuel;
+      }
+      NEXT();
+
+    CASE(InterpCheckEpoch):
+      if (WABT_UNLIKELY(store_.epoch() >= epoch_deadline_)) {
+        return RunResult::Interrupted;
+      }
+      NEXT();
+
     // This operation adjusts the function reference of the reused frame
     // after a return_call. This ensures the correct exception handlers are
     // used for the call.
-    case O::InterpAdjustFrameForReturnCall: {
+    CASE(InterpAdjustFrameForReturnCall): {
+      // The args have already been moved down to replace this frame's values.
+      // The frame is switched to the new function and its first instruction
+      // together, so the frame always matches its stack map.
       Ref new_func_ref = inst_->funcs()[instr.imm_u32];
+      DefinedFunc::Ptr new_func{store_, new_func_ref};
+      if (WABT_UNLIKELY(!new_func->IsCompiled()) &&
+          CompileFunc(*new_func, out_trap) == RunResult::Trap) {
+        return RunResult::Trap;
+      }
       Frame& current_frame = frames_.back();
       current_frame.func = new_func_ref;
-      break;
+      current_frame.values = values_.size();
+      pc = new_func->desc().code_offset;
+      NEXT();
+    }
+
+    // Superinstructions; see superinstructions.def.
+    CASE(InterpBrUnlessI32Eqz):
+      if (Pop<u32>()) {
+        pc = instr.imm_u32;
+      }
+      NEXT();
+
+    CASE(InterpBrUnlessI32Eq): {
+      u32 rhs = Pop<u32>();
+      if (Pop<u32>() != rhs) {
+        pc = instr.imm_u32;
+      }
+      NEXT();
+    }
+
+    CASE(InterpI32LoadLocal): {
+      Memory& memory = GetMemory(instr.imm_index_local_offset.memidx);
+      u64 offset = PickPtr(memory, instr.imm_index_local_offset.local);
+      u32 val;
+      if (Load<u32>(memory, offset, instr.imm_index_local_offset.offset, &val,
+                    out_trap) != RunResult::Ok) {
+        return RunResult::Trap;
+      }
+      Push(val);
+      NEXT();
+    }
+
+    CASE(InterpI32Load8ULocal): {
+      Memory& memory = GetMemory(instr.imm_index_local_offset.memidx);
+      u64 offset = PickPtr(memory, instr.imm_index_local_offset.local);
+      u8 val;
+      if (Load<u8>(memory, offset, instr.imm_index_local_offset.offset, &val,
+                   out_trap) != RunResult::Ok) {
+        return RunResult::Trap;
+      }
+      Push(u32{val});
+      NEXT();
     }
 
-    case O::I32TruncSatF32S: return DoUnop(IntTruncSat<s32, f32>);
-    case O::I32TruncSatF32U: return DoUnop(IntTruncSat<u32, f32>);
-    case O::I32TruncSatF64S: return DoUnop(IntTruncSat<s32, f64>);
-    case O::I32TruncSatF64U: return DoUnop(IntTruncSat<u32, f64>);
-    case O::I64TruncSatF32S: return DoUnop(IntTruncSat<s64, f32>);
-    case O::I64TruncSatF32U: return DoUnop(IntTruncSat<u64, f32>);
-    case O::I64TruncSatF64S: return DoUnop(IntTruncSat<s64, f64>);
-    case O::I64TruncSatF64U: return DoUnop(IntTruncSat<u64, f64>);
-
-    case O::MemoryInit: return DoMemoryInit(instr, out_trap);
-    case O::DataDrop:   return DoDataDrop(instr);
-    case O::MemoryCopy: return DoMemoryCopy(instr, out_trap);
-    case O::MemoryFill: return DoMemoryFill(instr, out_trap);
-
-    case O::TableInit: return DoTableInit(instr, out_trap);
-    case O::ElemDrop:  return DoElemDrop(instr);
-    case O::TableCopy: return DoTableCopy(instr, out_trap);
-    case O::TableGet:  return DoTableGet(instr, out_trap);
-    case O::TableSet:  return DoTableSet(instr, out_trap);
-    case O::TableGrow: return DoTableGrow(instr, out_trap);
-    case O::TableSize: return DoTableSize(instr);
-    case O::TableFill: return DoTableFill(instr, out_trap);
-
-    case O::RefNull:
+    CASE(InterpI32AddLocals):
+      Push(Add(Pick(instr.imm_u32x2.fst).Get<u32>(),
+               Pick(instr.imm_u32x2.snd).Get<u32>()));
+      NEXT();
+
+    CASE(InterpI32AddLocalConst):
+      Push(Add(Pick(instr.imm_u32x2.fst).Get<u32>(), instr.imm_u32x2.snd));
+      NEXT();
+
+    CASE(InterpI32AddLocalConstSet):
+      Pick(instr.imm_u32x3.trd) = Value::Make(
+          Add(Pick(instr.imm_u32x3.fst).Get<u32>(), instr.imm_u32x3.snd));
+      NEXT();
+
+    CASE(InterpI32AndLocalConst):
+      Push(IntAnd(Pick(instr.imm_u32x2.fst).Get<u32>(), instr.imm_u32x2.snd));
+      NEXT();
+
+    CASE(I32TruncSatF32S):   NEXT_IF_OK(DoUnop(IntTruncSat<s32, f32>));
+    CASE(I32TruncSatF32U):   NEXT_IF_OK(DoUnop(IntTruncSat<u32, f32>));
+    CASE(I32TruncSatF64S):   NEXT_IF_OK(DoUnop(IntTruncSat<s32, f64>));
+    CASE(I32TruncSatF64U):   NEXT_IF_OK(DoUnop(IntTruncSat<u32, f64>));
+    CASE(I64TruncSatF32S):   NEXT_IF_OK(DoUnop(IntTruncSat<s64, f32>));
+    CASE(I64TruncSatF32U):   NEXT_IF_OK(DoUnop(IntTruncSat<u64, f32>));
+    CASE(I64TruncSatF64S):   NEXT_IF_OK(DoUnop(IntTruncSat<s64, f64>));
+    CASE(I64TruncSatF64U):   NEXT_IF_OK(DoUnop(IntTruncSat<u64, f64>));
+
+    CASE(MemoryInit):   NEXT_IF_OK(DoMemoryInit(instr, out_trap));
+    CASE(DataDrop):     NEXT_IF_OK(DoDataDrop(instr));
+    CASE(MemoryCopy):   NEXT_IF_OK(DoMemoryCopy(instr, out_trap));
+    CASE(MemoryFill):   NEXT_IF_OK(DoMemoryFill(instr, out_trap));
+
+    CASE(TableInit):   NEXT_IF_OK(DoTableInit(instr, out_trap));
+    CASE(ElemDrop):    NEXT_IF_OK(DoElemDrop(instr));
+    CASE(TableCopy):   NEXT_IF_OK(DoTableCopy(instr, out_trap));
+    CASE(TableGet):    NEXT_IF_OK(DoTableGet(instr, out_trap));
+    CASE(TableSet):    NEXT_IF_OK(DoTableSet(instr, out_trap));
+    CASE(TableGrow):   NEXT_IF_OK(DoTableGrow(instr, out_trap));
+    CASE(TableSize):   NEXT_IF_OK(DoTableSize(instr));
+    CASE(TableFill):   NEXT_IF_OK(DoTableFill(instr, out_trap));
+
+    CASE(RefNull):
       Push(Ref::Null);
-      break;
+      NEXT();
 
-    case O::RefIsNull:
+    CASE(RefIsNull):
       Push(Pop<Ref>() == Ref::Null);
-      break;
+      NEXT();
 
-    case O::RefAsNonNull:
+    CASE(RefAsNonNull):
       TRAP_IF(Pick(1).Get<Ref>() == Ref::Null, "null reference");
-      break;
+      NEXT();
 
-    case O::RefFunc:
+    CASE(RefFunc):
       Push(inst_->funcs()[instr.imm_u32]);
-      break;
+      NEXT();
 
-    case O::V128Load: return DoLoad<v128>(instr, out_trap);
-    case O::V128Store: return DoStore<v128>(instr, out_trap);
+    CASE(V128Load):   NEXT_IF_OK(DoLoad<v128>(instr, out_trap));
+    CASE(V128Store):   NEXT_IF_OK(DoStore<v128>(instr, out_trap));
 
-    case O::V128Const:
+    CASE(V128Const):
       Push<v128>(instr.imm_v128);
-      break;
-
-    case O::I8X16Splat:        return DoSimdSplat<u8x16, u32>();
-    case O::I8X16ExtractLaneS: return DoSimdExtract<s8x16, s32>(instr);
-    case O::I8X16ExtractLaneU: return DoSimdExtract<u8x16, u32>(instr);
-    case O::I8X16ReplaceLane:  return DoSimdReplace<u8x16, u32>(instr);
-    case O::I16X8Splat:        return DoSimdSplat<u16x8, u32>();
-    case O::I16X8ExtractLaneS: return DoSimdExtract<s16x8, s32>(instr);
-    case O::I16X8ExtractLaneU: return DoSimdExtract<u16x8, u32>(instr);
-    case O::I16X8ReplaceLane:  return DoSimdReplace<u16x8, u32>(instr);
-    case O::I32X4Splat:        return DoSimdSplat<u32x4, u32>();
-    case O::I32X4ExtractLane:  return DoSimdExtract<s32x4, u32>(instr);
-    case O::I32X4ReplaceLane:  return DoSimdReplace<u32x4, u32>(instr);
-    case O::I64X2Splat:        return DoSimdSplat<u64x2, u64>();
-    case O::I64X2ExtractLane:  return DoSimdExtract<u64x2, u64>(instr);
-    case O::I64X2ReplaceLane:  return DoSimdReplace<u64x2, u64>(instr);
-    case O::F32X4Splat:        return DoSimdSplat<f32x4, f32>();
-    case O::F32X4ExtractLane:  return DoSimdExtract<f32x4, f32>(instr);
-    case O::F32X4ReplaceLane:  return DoSimdReplace<f32x4, f32>(instr);
-    case O::F64X2Splat:        return DoSimdSplat<f64x2, f64>();
-    case O::F64X2ExtractLane:  return DoSimdExtract<f64x2, f64>(instr);
-    case O::F64X2ReplaceLane:  return DoSimdReplace<f64x2, f64>(instr);
-
-    case O::I8X16Eq:  return DoSimdBinop(EqMask<u8>);
-    case O::I8X16Ne:  return DoSimdBinop(NeMask<u8>);
-    case O::I8X16LtS: return DoSimdBinop(LtMask<s8>);
-    case O::I8X16LtU: return DoSimdBinop(LtMask<u8>);
-    case O::I8X16GtS: return DoSimdBinop(GtMask<s8>);
-    case O::I8X16GtU: return DoSimdBinop(GtMask<u8>);
-    case O::I8X16LeS: return DoSimdBinop(LeMask<s8>);
-    case O::I8X16LeU: return DoSimdBinop(LeMask<u8>);
-    case O::I8X16GeS: return DoSimdBinop(GeMask<s8>);
-    case O::I8X16GeU: return DoSimdBinop(GeMask<u8>);
-    case O::I16X8Eq:  return DoSimdBinop(EqMask<u16>);
-    case O::I16X8Ne:  return DoSimdBinop(NeMask<u16>);
-    case O::I16X8LtS: return DoSimdBinop(LtMask<s16>);
-    case O::I16X8LtU: return DoSimdBinop(LtMask<u16>);
-    case O::I16X8GtS: return DoSimdBinop(GtMask<s16>);
-    case O::I16X8GtU: return DoSimdBinop(GtMask<u16>);
-    case O::I16X8LeS: return DoSimdBinop(LeMask<s16>);
-    case O::I16X8LeU: return DoSimdBinop(LeMask<u16>);
-    case O::I16X8GeS: return DoSimdBinop(GeMask<s16>);
-    case O::I16X8GeU: return DoSimdBinop(GeMask<u16>);
-    case O::I32X4Eq:  return DoSimdBinop(EqMask<u32>);
-    case O::I32X4Ne:  return DoSimdBinop(NeMask<u32>);
-    case O::I32X4LtS: return DoSimdBinop(LtMask<s32>);
-    case O::I32X4LtU: return DoSimdBinop(LtMask<u32>);
-    case O::I32X4GtS: return DoSimdBinop(GtMask<s32>);
-    case O::I32X4GtU: return DoSimdBinop(GtMask<u32>);
-    case O::I32X4LeS: return DoSimdBinop(LeMask<s32>);
-    case O::I32X4LeU: return DoSimdBinop(LeMask<u32>);
-    case O::I32X4GeS: return DoSimdBinop(GeMask<s32>);
-    case O::I32X4GeU: return DoSimdBinop(GeMask<u32>);
-    case O::I64X2Eq:  return DoSimdBinop(EqMask<u64>);
-    case O::I64X2Ne:  return DoSimdBinop(NeMask<u64>);
-    case O::I64X2LtS: return DoSimdBinop(LtMask<s64>);
-    case O::I64X2GtS: return DoSimdBinop(GtMask<s64>);
-    case O::I64X2LeS: return DoSimdBinop(LeMask<s64>);
-    case O::I64X2GeS: return DoSimdBinop(GeMask<s64>);
-    case O::F32X4Eq:  return DoSimdBinop(EqMask<f32>);
-    case O::F32X4Ne:  return DoSimdBinop(NeMask<f32>);
-    case O::F32X4Lt:  return DoSimdBinop(LtMask<f32>);
-    case O::F32X4Gt:  return DoSimdBinop(GtMask<f32>);
-    case O::F32X4Le:  return DoSimdBinop(LeMask<f32>);
-    case O::F32X4Ge:  return DoSimdBinop(GeMask<f32>);
-    case O::F64X2Eq:  return DoSimdBinop(EqMask<f64>);
-    case O::F64X2Ne:  return DoSimdBinop(NeMask<f64>);
-    case O::F64X2Lt:  return DoSimdBinop(LtMask<f64>);
-    case O::F64X2Gt:  return DoSimdBinop(GtMask<f64>);
-    case O::F64X2Le:  return DoSimdBinop(LeMask<f64>);
-    case O::F64X2Ge:  return DoSimdBinop(GeMask<f64>);
-
-    case O::V128Not:       return DoSimdUnop(IntNot<u64>);
-    case O::V128And:       return DoSimdBinop(IntAnd<u64>);
-    case O::V128Or:        return DoSimdBinop(IntOr<u64>);
-    case O::V128Xor:       return DoSimdBinop(IntXor<u64>);
-    case O::V128AnyTrue:      return DoSimdIsTrue<u8x16, 1>();
-
-    case O::V128BitSelect:
-    case O::I8X16RelaxedLaneSelect:
-    case O::I16X8RelaxedLaneSelect:
-    case O::I32X4RelaxedLaneSelect:
-    case O::I64X2RelaxedLaneSelect:
-      return DoSimdBitSelect();
-
-    case O::I8X16Neg:          return DoSimdUnop(IntNeg<u8>);
-    case O::I8X16Bitmask:      return DoSimdBitmask<s8x16>();
-    case O::I8X16AllTrue:      return DoSimdIsTrue<u8x16, 16>();
-    case O::I8X16Shl:          return DoSimdShift(IntShl<u8>);
-    case O::I8X16ShrS:         return DoSimdShift(IntShr<s8>);
-    case O::I8X16ShrU:         return DoSimdShift(IntShr<u8>);
-    case O::I8X16Add:          return DoSimdBinop(Add<u8>);
-    case O::I8X16AddSatS:      return DoSimdBinop(IntAddSat<s8>);
-    case O::I8X16AddSatU:      return DoSimdBinop(IntAddSat<u8>);
-    case O::I8X16Sub:          return DoSimdBinop(Sub<u8>);
-    case O::I8X16SubSatS:      return DoSimdBinop(IntSubSat<s8>);
-    case O::I8X16SubSatU:      return DoSimdBinop(IntSubSat<u8>);
-    case O::I8X16MinS:         return DoSimdBinop(IntMin<s8>);
-    case O::I8X16MinU:         return DoSimdBinop(IntMin<u8>);
-    case O::I8X16MaxS:         return DoSimdBinop(IntMax<s8>);
-    case O::I8X16MaxU:         return DoSimdBinop(IntMax<u8>);
-
-    case O::I16X8Neg:          return DoSimdUnop(IntNeg<u16>);
-    case O::I16X8Bitmask:      return DoSimdBitmask<s16x8>();
-    case O::I16X8AllTrue:      return DoSimdIsTrue<u16x8, 8>();
-    case O::I16X8Shl:          return DoSimdShift(IntShl<u16>);
-    case O::I16X8ShrS:         return DoSimdShift(IntShr<s16>);
-    case O::I16X8ShrU:         return DoSimdShift(IntShr<u16>);
-    case O::I16X8Add:          return DoSimdBinop(Add<u16>);
-    case O::I16X8AddSatS:      return DoSimdBinop(IntAddSat<s16>);
-    case O::I16X8AddSatU:      return DoSimdBinop(IntAddSat<u16>);
-    case O::I16X8Sub:          return DoSimdBinop(Sub<u16>);
-    case O::I16X8SubSatS:      return DoSimdBinop(IntSubSat<s16>);
-    case O::I16X8SubSatU:      return DoSimdBinop(IntSubSat<u16>);
-    case O::I16X8Mul:          return DoSimdBinop(Mul<u16>);
-    case O::I16X8MinS:         return DoSimdBinop(IntMin<s16>);
-    case O::I16X8MinU:         return DoSimdBinop(IntMin<u16>);
-    case O::I16X8MaxS:         return DoSimdBinop(IntMax<s16>);
-    case O::I16X8MaxU:         return DoSimdBinop(IntMax<u16>);
-
-    case O::I32X4Neg:          return DoSimdUnop(IntNeg<u32>);
-    case O::I32X4Bitmask:      return DoSimdBitmask<s32x4>();
-    case O::I32X4AllTrue:      return DoSimdIsTrue<u32x4, 4>();
-    case O::I32X4Shl:          return DoSimdShift(IntShl<u32>);
-    case O::I32X4ShrS:         return DoSimdShift(IntShr<s32>);
-    case O::I32X4ShrU:         return DoSimdShift(IntShr<u32>);
-    case O::I32X4Add:          return DoSimdBinop(Add<u32>);
-    case O::I32X4Sub:          return DoSimdBinop(Sub<u32>);
-    case O::I32X4Mul:          return DoSimdBinop(Mul<u32>);
-    case O::I32X4MinS:         return DoSimdBinop(IntMin<s32>);
-    case O::I32X4MinU:         return DoSimdBinop(IntMin<u32>);
-    case O::I32X4MaxS:         return DoSimdBinop(IntMax<s32>);
-    case O::I32X4MaxU:         return DoSimdBinop(IntMax<u32>);
-
-    case O::I64X2Neg:          return DoSimdUnop(IntNeg<u64>);
-    case O::I64X2Bitmask:      return DoSimdBitmask<s64x2>();
-    case O::I64X2AllTrue:      return DoSimdIsTrue<u64x2, 2>();
-    case O::I64X2Shl:          return DoSimdShift(IntShl<u64>);
-    case O::I64X2ShrS:         return DoSimdShift(IntShr<s64>);
-    case O::I64X2ShrU:         return DoSimdShift(IntShr<u64>);
-    case O::I64X2Add:          return DoSimdBinop(Add<u64>);
-    case O::I64X2Sub:          return DoSimdBinop(Sub<u64>);
-    case O::I64X2Mul:          return DoSimdBinop(Mul<u64>);
-
-    case O::F32X4Ceil:         return DoSimdUnop(FloatCeil<f32>);
-    case O::F32X4Floor:        return DoSimdUnop(FloatFloor<f32>);
-    case O::F32X4Trunc:        return DoSimdUnop(FloatTrunc<f32>);
-    case O::F32X4Nearest:      return DoSimdUnop(FloatNearest<f32>);
-
-    case O::F64X2Ceil:         return DoSimdUnop(FloatCeil<f64>);
-    case O::F64X2Floor:        return DoSimdUnop(FloatFloor<f64>);
-    case O::F64X2Trunc:        return DoSimdUnop(FloatTrunc<f64>);
-    case O::F64X2Nearest:      return DoSimdUnop(FloatNearest<f64>);
-
-    case O::F32X4Abs:          return DoSimdUnop(FloatAbs<f32>);
-    case O::F32X4Neg:          return DoSimdUnop(FloatNeg<f32>);
-    case O::F32X4Sqrt:         return DoSimdUnop(FloatSqrt<f32>);
-    case O::F32X4Add:          return DoSimdBinop(Add<f32>);
-    case O::F32X4Sub:          return DoSimdBinop(Sub<f32>);
-    case O::F32X4Mul:          return DoSimdBinop(Mul<f32>);
-    case O::F32X4Div:          return DoSimdBinop(FloatDiv<f32>);
-    case O::F32X4PMin:         return DoSimdBinop(FloatPMin<f32>);
-    case O::F32X4PMax:         return DoSimdBinop(FloatPMax<f32>);
-
-    case O::F32X4Min:
-    case O::F32X4RelaxedMin:
-      return DoSimdBinop(FloatMin<f32>);
-
-    case O::F32X4Max:
-    case O::F32X4RelaxedMax:
-      return DoSimdBinop(FloatMax<f32>);
-
-    case O::F64X2Abs:          return DoSimdUnop(FloatAbs<f64>);
-    case O::F64X2Neg:          return DoSimdUnop(FloatNeg<f64>);
-    case O::F64X2Sqrt:         return DoSimdUnop(FloatSqrt<f64>);
-    case O::F64X2Add:          return DoSimdBinop(Add<f64>);
-    case O::F64X2Sub:          return DoSimdBinop(Sub<f64>);
-    case O::F64X2Mul:          return DoSimdBinop(Mul<f64>);
-    case O::F64X2Div:          return DoSimdBinop(FloatDiv<f64>);
-    case O::F64X2PMin:         return DoSimdBinop(FloatPMin<f64>);
-    case O::F64X2PMax:         return DoSimdBinop(FloatPMax<f64>);
-
-    case O::F64X2Min:
-    case O::F64X2RelaxedMin:
-      return DoSimdBinop(FloatMin<f64>);
-
-    case O::F64X2Max:
-    case O::F64X2RelaxedMax:
-      return DoSimdBinop(FloatMax<f64>);
-
-    case O::I32X4TruncSatF32X4S:
-    case O::I32X4RelaxedTruncF32X4S:
-      return DoSimdUnop(IntTruncSat<s32, f32>);
-
-    case O::I32X4TruncSatF32X4U:
-    case O::I32X4RelaxedTruncF32X4U:
-      return DoSimdUnop(IntTruncSat<u32, f32>);
-
-    case O::I32X4TruncSatF64X2SZero:
-    case O::I32X4RelaxedTruncF64X2SZero:
-      return DoSimdUnopZero(IntTruncSat<s32, f64>);
-
-    case O::I32X4TruncSatF64X2UZero:
-    case O::I32X4RelaxedTruncF64X2UZero:
-      return DoSimdUnopZero(IntTruncSat<u32, f64>);
-
-    case O::F32X4ConvertI32X4S:  return DoSimdUnop(Convert<f32, s32>);
-    case O::F32X4ConvertI32X4U:  return DoSimdUnop(Convert<f32, u32>);
-    case O::F32X4DemoteF64X2Zero: return DoSimdUnopZero(Convert<f32, f64>);
-    case O::F64X2PromoteLowF32X4: return DoSimdConvert<f64x2, f32x4, true>();
-    case O::F64X2ConvertLowI32X4S: return DoSimdConvert<f64x2, s32x4, true>();
-    case O::F64X2ConvertLowI32X4U: return DoSimdConvert<f64x2, u32x4, true>();
-
-    case O::I8X16Swizzle:
-    case O::I8X16RelaxedSwizzle:
-      return DoSimdSwizzle();
-
-    case O::I8X16Shuffle:     return DoSimdShuffle(instr);
-
-    case O::V128Load8Splat:    return DoSimdLoadSplat<u8x16>(instr, out_trap);
-    case O::V128Load16Splat:   return DoSimdLoadSplat<u16x8>(instr, out_trap);
-    case O::V128Load32Splat:   return DoSimdLoadSplat<u32x4>(instr, out_trap);
-    case O::V128Load64Splat:   return DoSimdLoadSplat<u64x2>(instr, out_trap);
-
-    case O::V128Load8Lane:    return DoSimdLoadLane<u8x16>(instr, out_trap);
-    case O::V128Load16Lane:   return DoSimdLoadLane<u16x8>(instr, out_trap);
-    case O::V128Load32Lane:   return DoSimdLoadLane<u32x4>(instr, out_trap);
-    case O::V128Load64Lane:   return DoSimdLoadLane<u64x2>(instr, out_trap);
-
-    case O::V128Store8Lane:    return DoSimdStoreLane<u8x16>(instr, out_trap);
-    case O::V128Store16Lane:   return DoSimdStoreLane<u16x8>(instr, out_trap);
-    case O::V128Store32Lane:   return DoSimdStoreLane<u32x4>(instr, out_trap);
-    case O::V128Store64Lane:   return DoSimdStoreLane<u64x2>(instr, out_trap);
-
-    case O::V128Load32Zero: return DoSimdLoadZero<u32x4, u32>(instr, out_trap);
-    case O::V128Load64Zero: return DoSimdLoadZero<u64x2, u64>(instr, out_trap);
-
-    case O::I8X16NarrowI16X8S:    return DoSimdNarrow<s8x16, s16x8>();
-    case O::I8X16NarrowI16X8U:    return DoSimdNarrow<u8x16, s16x8>();
-    case O::I16X8NarrowI32X4S:    return DoSimdNarrow<s16x8, s32x4>();
-    case O::I16X8NarrowI32X4U:    return DoSimdNarrow<u16x8, s32x4>();
-    case O::I16X8ExtendLowI8X16S:  return DoSimdConvert<s16x8, s8x16, true>();
-    case O::I16X8ExtendHighI8X16S: return DoSimdConvert<s16x8, s8x16, false>();
-    case O::I16X8ExtendLowI8X16U:  return DoSimdConvert<u16x8, u8x16, true>();
-    case O::I16X8ExtendHighI8X16U: return DoSimdConvert<u16x8, u8x16, false>();
-    case O::I32X4ExtendLowI16X8S:  return DoSimdConvert<s32x4, s16x8, true>();
-    case O::I32X4ExtendHighI16X8S: return DoSimdConvert<s32x4, s16x8, false>();
-    case O::I32X4ExtendLowI16X8U:  return DoSimdConvert<u32x4, u16x8, true>();
-    case O::I32X4ExtendHighI16X8U: return DoSimdConvert<u32x4, u16x8, false>();
-    case O::I64X2ExtendLowI32X4S:  return DoSimdConvert<s64x2, s32x4, true>();
-    case O::I64X2ExtendHighI32X4S: return DoSimdConvert<s64x2, s32x4, false>();
-    case O::I64X2ExtendLowI32X4U:  return DoSimdConvert<u64x2, u32x4, true>();
-    case O::I64X2ExtendHighI32X4U: return DoSimdConvert<u64x2, u32x4, false>();
-
-    case O::V128Load8X8S:  return DoSimdLoadExtend<s16x8, s8x8>(instr, out_trap);
-    case O::V128Load8X8U:  return DoSimdLoadExtend<u16x8, u8x8>(instr, out_trap);
-    case O::V128Load16X4S: return DoSimdLoadExtend<s32x4, s16x4>(instr, out_trap);
-    case O::V128Load16X4U: return DoSimdLoadExtend<u32x4, u16x4>(instr, out_trap);
-    case O::V128Load32X2S: return DoSimdLoadExtend<s64x2, s32x2>(instr, out_trap);
-    case O::V128Load32X2U: return DoSimdLoadExtend<u64x2, u32x2>(instr, out_trap);
-
-    case O::V128Andnot: return DoSimdBinop(IntAndNot<u64>);
-    case O::I8X16AvgrU: return DoSimdBinop(IntAvgr<u8>);
-    case O::I16X8AvgrU: return DoSimdBinop(IntAvgr<u16>);
-
-    case O::I8X16Abs: return DoSimdUnop(IntAbs<u8>);
-    case O::I16X8Abs: return DoSimdUnop(IntAbs<u16>);
-    case O::I32X4Abs: return DoSimdUnop(IntAbs<u32>);
-    case O::I64X2Abs: return DoSimdUnop(IntAbs<u64>);
-
-    case O::I8X16Popcnt: return DoSimdUnop(IntPopcnt<u8>);
-
-    case O::I16X8ExtaddPairwiseI8X16S: return DoSimdExtaddPairwise<s16x8, s8x16>();
-    case O::I16X8ExtaddPairwiseI8X16U: return DoSimdExtaddPairwise<u16x8, u8x16>();
-    case O::I32X4ExtaddPairwiseI16X8S: return DoSimdExtaddPairwise<s32x4, s16x8>();
-    case O::I32X4ExtaddPairwiseI16X8U: return DoSimdExtaddPairwise<u32x4, u16x8>();
-
-    case O::I16X8ExtmulLowI8X16S: return DoSimdExtmul<s16x8, s8x16, true>();
-    case O::I16X8ExtmulHighI8X16S: return DoSimdExtmul<s16x8, s8x16, false>();
-    case O::I16X8ExtmulLowI8X16U: return DoSimdExtmul<u16x8, u8x16, true>();
-    case O::I16X8ExtmulHighI8X16U: return DoSimdExtmul<u16x8, u8x16, false>();
-    case O::I32X4ExtmulLowI16X8S: return DoSimdExtmul<s32x4, s16x8, true>();
-    case O::I32X4ExtmulHighI16X8S: return DoSimdExtmul<s32x4, s16x8, false>();
-    case O::I32X4ExtmulLowI16X8U: return DoSimdExtmul<u32x4, u16x8, true>();
-    case O::I32X4ExtmulHighI16X8U: return DoSimdExtmul<u32x4, u16x8, false>();
-    case O::I64X2ExtmulLowI32X4S: return DoSimdExtmul<s64x2, s32x4, true>();
-    case O::I64X2ExtmulHighI32X4S: return DoSimdExtmul<s64x2, s32x4, false>();
-    case O::I64X2ExtmulLowI32X4U: return DoSimdExtmul<u64x2, u32x4, true>();
-    case O::I64X2ExtmulHighI32X4U: return DoSimdExtmul<u64x2, u32x4, false>();
-
-    case O::I16X8Q15mulrSatS:
-    case O::I16X8RelaxedQ15mulrS:
-      return DoSimdBinop(SaturatingRoundingQMul<s16>);
-
-    case O::I32X4DotI16X8S: return DoSimdDot<u32x4, s16x8>();
-    case O::I16X8DotI8X16I7X16S: return DoSimdDot<u16x8, s8x16>();
-    case O::I32X4DotI8X16I7X16AddS: return DoSimdDotAdd<u32x4, s16x8>();
-
-    case O::F32X4RelaxedMadd: return DoSimdRelaxedMadd<f32>();
-    case O::F32X4RelaxedNmadd: return DoSimdRelaxedNmadd<f32>();
-    case O::F64X2RelaxedMadd: return DoSimdRelaxedMadd<f64>();
-    case O::F64X2RelaxedNmadd: return DoSimdRelaxedNmadd<f64>();
-
-    case O::AtomicFence:
-    case O::MemoryAtomicNotify:
-    case O::MemoryAtomicWait32:
-    case O::MemoryAtomicWait64:
-    case O::I64Add128:
-    case O::I64Sub128:
-    case O::I64MulWideS:
-    case O::I64MulWideU:
+      NEXT();
+
+    CASE(I8X16Splat):          NEXT_IF_OK(DoSimdSplat<u8x16, u32>());
+    CASE(I8X16ExtractLaneS):   NEXT_IF_OK(DoSimdExtract<s8x16, s32>(instr));
+    CASE(I8X16ExtractLaneU):   NEXT_IF_OK(DoSimdExtract<u8x16, u32>(instr));
+    CASE(I8X16ReplaceLane):    NEXT_IF_OK(DoSimdReplace<u8x16, u32>(instr));
+    CASE(I16X8Splat):          NEXT_IF_OK(DoSimdSplat<u16x8, u32>());
+    CASE(I16X8ExtractLaneS):   NEXT_IF_OK(DoSimdExtract<s16x8, s32>(instr));
+    CASE(I16X8ExtractLaneU):   NEXT_IF_OK(DoSimdExtract<u16x8, u32>(instr));
+    CASE(I16X8ReplaceLane):    NEXT_IF_OK(DoSimdReplace<u16x8, u32>(instr));
+    CASE(I32X4Splat):          NEXT_IF_OK(DoSimdSplat<u32x4, u32>());
+    CASE(I32X4ExtractLane):    NEXT_IF_OK(DoSimdExtract<s32x4, u32>(instr));
+    CASE(I32X4ReplaceLane):    NEXT_IF_OK(DoSimdReplace<u32x4, u32>(instr));
+    CASE(I64X2Splat):          NEXT_IF_OK(DoSimdSplat<u64x2, u64>());
+    CASE(I64X2ExtractLane):    NEXT_IF_OK(DoSimdExtract<u64x2, u64>(instr));
+    CASE(I64X2ReplaceLane):    NEXT_IF_OK(DoSimdReplace<u64x2, u64>(instr));
+    CASE(F32X4Splat):          NEXT_IF_OK(DoSimdSplat<f32x4, f32>());
+    CASE(F32X4ExtractLane):    NEXT_IF_OK(DoSimdExtract<f32x4, f32>(instr));
+    CASE(F32X4ReplaceLane):    NEXT_IF_OK(DoSimdReplace<f32x4, f32>(instr));
+    CASE(F64X2Splat):          NEXT_IF_OK(DoSimdSplat<f64x2, f64>());
+    CASE(F64X2ExtractLane):    NEXT_IF_OK(DoSimdExtract<f64x2, f64>(instr));
+    CASE(F64X2ReplaceLane):    NEXT_IF_OK(DoSimdReplace<f64x2, f64>(instr));
+
+    CASE(I8X16Eq):    NEXT_IF_OK(DoSimdBinop(EqMask<u8>));
+    CASE(I8X16Ne):    NEXT_IF_OK(DoSimdBinop(NeMask<u8>));
+    CASE(I8X16LtS):   NEXT_IF_OK(DoSimdBinop(LtMask<s8>));
+    CASE(I8X16LtU):   NEXT_IF_OK(DoSimdBinop(LtMask<u8>));
+    CASE(I8X16GtS):   NEXT_IF_OK(DoSimdBinop(GtMask<s8>));
+    CASE(I8X16GtU):   NEXT_IF_OK(DoSimdBinop(GtMask<u8>));
+    CASE(I8X16LeS):   NEXT_IF_OK(DoSimdBinop(LeMask<s8>));
+    CASE(I8X16LeU):   NEXT_IF_OK(DoSimdBinop(LeMask<u8>));
+    CASE(I8X16GeS):   NEXT_IF_OK(DoSimdBinop(GeMask<s8>));
+    CASE(I8X16GeU):   NEXT_IF_OK(DoSimdBinop(GeMask<u8>));
+    CASE(I16X8Eq):    NEXT_IF_OK(DoSimdBinop(EqMask<u16>));
+    CASE(I16X8Ne):    NEXT_IF_OK(DoSimdBinop(NeMask<u16>));
+    CASE(I16X8LtS):   NEXT_IF_OK(DoSimdBinop(LtMask<s16>));
+    CASE(I16X8LtU):   NEXT_IF_OK(DoSimdBinop(LtMask<u16>));
+    CASE(I16X8GtS):   NEXT_IF_OK(DoSimdBinop(GtMask<s16>));
+    CASE(I16X8GtU):   NEXT_IF_OK(DoSimdBinop(GtMask<u16>));
+    CASE(I16X8LeS):   NEXT_IF_OK(DoSimdBinop(LeMask<s16>));
+    CASE(I16X8LeU):   NEXT_IF_OK(DoSimdBinop(LeMask<u16>));
+    CASE(I16X8GeS):   NEXT_IF_OK(DoSimdBinop(GeMask<s16>));
+    CASE(I16X8GeU):   NEXT_IF_OK(DoSimdBinop(GeMask<u16>));
+    CASE(I32X4Eq):    NEXT_IF_OK(DoSimdBinop(EqMask<u32>));
+    CASE(I32X4Ne):    NEXT_IF_OK(DoSimdBinop(NeMask<u32>));
+    CASE(I32X4LtS):   NEXT_IF_OK(DoSimdBinop(LtMask<s32>));
+    CASE(I32X4LtU):   NEXT_IF_OK(DoSimdBinop(LtMask<u32>));
+    CASE(I32X4GtS):   NEXT_IF_OK(DoSimdBinop(GtMask<s32>));
+    CASE(I32X4GtU):   NEXT_IF_OK(DoSimdBinop(GtMask<u32>));
+    CASE(I32X4LeS):   NEXT_IF_OK(DoSimdBinop(LeMask<s32>));
+    CASE(I32X4LeU):   NEXT_IF_OK(DoSimdBinop(LeMask<u32>));
+    CASE(I32X4GeS):   NEXT_IF_OK(DoSimdBinop(GeMask<s32>));
+    CASE(I32X4GeU):   NEXT_IF_OK(DoSimdBinop(GeMask<u32>));
+    CASE(I64X2Eq):    NEXT_IF_OK(DoSimdBinop(EqMask<u64>));
+    CASE(I64X2Ne):    NEXT_IF_OK(DoSimdBinop(NeMask<u64>));
+    CASE(I64X2LtS):   NEXT_IF_OK(DoSimdBinop(LtMask<s64>));
+    CASE(I64X2GtS):   NEXT_IF_OK(DoSimdBinop(GtMask<s64>));
+    CASE(I64X2LeS):   NEXT_IF_OK(DoSimdBinop(LeMask<s64>));
+    CASE(I64X2GeS):   NEXT_IF_OK(DoSimdBinop(GeMask<s64>));
+    CASE(F32X4Eq):    NEXT_IF_OK(DoSimdBinop(EqMask<f32>));
+    CASE(F32X4Ne):    NEXT_IF_OK(DoSimdBinop(NeMask<f32>));
+    CASE(F32X4Lt):    NEXT_IF_OK(DoSimdBinop(LtMask<f32>));
+    CASE(F32X4Gt):    NEXT_IF_OK(DoSimdBinop(GtMask<f32>));
+    CASE(F32X4Le):    NEXT_IF_OK(DoSimdBinop(LeMask<f32>));
+    CASE(F32X4Ge):    NEXT_IF_OK(DoSimdBinop(GeMask<f32>));
+    CASE(F64X2Eq):    NEXT_IF_OK(DoSimdBinop(EqMask<f64>));
+    CASE(F64X2Ne):    NEXT_IF_OK(DoSimdBinop(NeMask<f64>));
+    CASE(F64X2Lt):    NEXT_IF_OK(DoSimdBinop(LtMask<f64>));
+    CASE(F64X2Gt):    NEXT_IF_OK(DoSimdBinop(GtMask<f64>));
+    CASE(F64X2Le):    NEXT_IF_OK(DoSimdBinop(LeMask<f64>));
+    CASE(F64X2Ge):    NEXT_IF_OK(DoSimdBinop(GeMask<f64>));
+
+    CASE(V128Not):         NEXT_IF_OK(DoSimdUnop(IntNot<u64>));
+    CASE(V128And):         NEXT_IF_OK(DoSimdBinop(IntAnd<u64>));
+    CASE(V128Or):          NEXT_IF_OK(DoSimdBinop(IntOr<u64>));
+    CASE(V128Xor):         NEXT_IF_OK(DoSimdBinop(IntXor<u64>));
+    CASE(V128AnyTrue):        NEXT_IF_OK(DoSimdIsTrue<u8x16, 1>());
+
+    CASE(V128BitSelect):
+    CASE(I8X16RelaxedLaneSelect):
+    CASE(I16X8RelaxedLaneSelect):
+    CASE(I32X4RelaxedLaneSelect):
+    CASE(I64X2RelaxedLaneSelect):
+      NEXT_IF_OK(DoSimdBitSelect());
+
+    CASE(I8X16Neg):            NEXT_IF_OK(DoSimdUnop(IntNeg<u8>));
+    CASE(I8X16Bitmask):        NEXT_IF_OK(DoSimdBitmask<s8x16>());
+    CASE(I8X16AllTrue):        NEXT_IF_OK(DoSimdIsTrue<u8x16, 16>());
+    CASE(I8X16Shl):            NEXT_IF_OK(DoSimdShift(IntShl<u8>));
+    CASE(I8X16ShrS):           NEXT_IF_OK(DoSimdShift(IntShr<s8>));
+    CASE(I8X16ShrU):           NEXT_IF_OK(DoSimdShift(IntShr<u8>));
+    CASE(I8X16Add):            NEXT_IF_OK(DoSimdBinop(Add<u8>));
+    CASE(I8X16AddSatS):        NEXT_IF_OK(DoSimdBinop(IntAddSat<s8>));
+    CASE(I8X16AddSatU):        NEXT_IF_OK(DoSimdBinop(IntAddSat<u8>));
+    CASE(I8X16Sub):            NEXT_IF_OK(DoSimdBinop(Sub<u8>));
+    CASE(I8X16SubSatS):        NEXT_IF_OK(DoSimdBinop(IntSubSat<s8>));
+    CASE(I8X16SubSatU):        NEXT_IF_OK(DoSimdBinop(IntSubSat<u8>));
+    CASE(I8X16MinS):           NEXT_IF_OK(DoSimdBinop(IntMin<s8>));
+    CASE(I8X16MinU):           NEXT_IF_OK(DoSimdBinop(IntMin<u8>));
+    CASE(I8X16MaxS):           NEXT_IF_OK(DoSimdBinop(IntMax<s8>));
+    CASE(I8X16MaxU):           NEXT_IF_OK(DoSimdBinop(IntMax<u8>));
+
+    CASE(I16X8Neg):            NEXT_IF_OK(DoSimdUnop(IntNeg<u16>));
+    CASE(I16X8Bitmask):        NEXT_IF_OK(DoSimdBitmask<s16x8>());
+    CASE(I16X8AllTrue):        NEXT_IF_OK(DoSimdIsTrue<u16x8, 8>());
+    CASE(I16X8Shl):            NEXT_IF_OK(DoSimdShift(IntShl<u16>));
+    CASE(I16X8ShrS):           NEXT_IF_OK(DoSimdShift(IntShr<s16>));
+    CASE(I16X8ShrU):           NEXT_IF_OK(DoSimdShift(IntShr<u16>));
+    CASE(I16X8Add):            NEXT_IF_OK(DoSimdBinop(Add<u16>));
+    CASE(I16X8AddSatS):        NEXT_IF_OK(DoSimdBinop(IntAddSat<s16>));
+    CASE(I16X8AddSatU):        NEXT_IF_OK(DoSimdBinop(IntAddSat<u16>));
+    CASE(I16X8Sub):            NEXT_IF_OK(DoSimdBinop(Sub<u16>));
+    CASE(I16X8SubSatS):        NEXT_IF_OK(DoSimdBinop(IntSubSat<s16>));
+    CASE(I16X8SubSatU):        NEXT_IF_OK(DoSimdBinop(IntSubSat<u16>));
+    CASE(I16X8Mul):            NEXT_IF_OK(DoSimdBinop(Mul<u16>));
+    CASE(I16X8MinS):           NEXT_IF_OK(DoSimdBinop(IntMin<s16>));
+    CASE(I16X8MinU):           NEXT_IF_OK(DoSimdBinop(IntMin<u16>));
+    CASE(I16X8MaxS):           NEXT_IF_OK(DoSimdBinop(IntMax<s16>));
+    CASE(I16X8MaxU):           NEXT_IF_OK(DoSimdBinop(IntMax<u16>));
+
+    CASE(I32X4Neg):            NEXT_IF_OK(DoSimdUnop(IntNeg<u32>));
+    CASE(I32X4Bitmask):        NEXT_IF_OK(DoSimdBitmask<s32x4>());
+    CASE(I32X4AllTrue):        NEXT_IF_OK(DoSimdIsTrue<u32x4, 4>());
+    CASE(I32X4Shl):            NEXT_IF_OK(DoSimdShift(IntShl<u32>));
+    CASE(I32X4ShrS):           NEXT_IF_OK(DoSimdShift(IntShr<s32>));
+    CASE(I32X4ShrU):           NEXT_IF_OK(DoSimdShift(IntShr<u32>));
+    CASE(I32X4Add):            NEXT_IF_OK(DoSimdBinop(Add<u32>));
+    CASE(I32X4Sub):            NEXT_IF_OK(DoSimdBinop(Sub<u32>));
+    CASE(I32X4Mul):            NEXT_IF_OK(DoSimdBinop(Mul<u32>));
+    CASE(I32X4MinS):           NEXT_IF_OK(DoSimdBinop(IntMin<s32>));
+    CASE(I32X4MinU):           NEXT_IF_OK(DoSimdBinop(IntMin<u32>));
+    CASE(I32X4MaxS):           NEXT_IF_OK(DoSimdBinop(IntMax<s32>));
+    CASE(I32X4MaxU):           NEXT_IF_OK(DoSimdBinop(IntMax<u32>));
+
+    CASE(I64X2Neg):            NEXT_IF_OK(DoSimdUnop(IntNeg<u64>));
+    CASE(I64X2Bitmask):        NEXT_IF_OK(DoSimdBitmask<s64x2>());
+    CASE(I64X2AllTrue):        NEXT_IF_OK(DoSimdIsTrue<u64x2, 2>());
+    CASE(I64X2Shl):            NEXT_IF_OK(DoSimdShift(IntShl<u64>));
+    CASE(I64X2ShrS):           NEXT_IF_OK(DoSimdShift(IntShr<s64>));
+    CASE(I64X2ShrU):           NEXT_IF_OK(DoSimdShift(IntShr<u64>));
+    CASE(I64X2Add):            NEXT_IF_OK(DoSimdBinop(Add<u64>));
+    CASE(I64X2Sub):            NEXT_IF_OK(DoSimdBinop(Sub<u64>));
+    CASE(I64X2Mul):            NEXT_IF_OK(DoSimdBinop(Mul<u64>));
+
+    CASE(F32X4Ceil):           NEXT_IF_OK(DoSimdUnop(FloatCeil<f32>));
+    CASE(F32X4Floor):          NEXT_IF_OK(DoSimdUnop(FloatFloor<f32>));
+    CASE(F32X4Trunc):          NEXT_IF_OK(DoSimdUnop(FloatTrunc<f32>));
+    CASE(F32X4Nearest):        NEXT_IF_OK(DoSimdUnop(FloatNearest<f32>));
+
+    CASE(F64X2Ceil):           NEXT_IF_OK(DoSimdUnop(FloatCeil<f64>));
+    CASE(F64X2Floor):          NEXT_IF_OK(DoSimdUnop(FloatFloor<f64>));
+    CASE(F64X2Trunc):          NEXT_IF_OK(DoSimdUnop(FloatTrunc<f64>));
+    CASE(F64X2Nearest):        NEXT_IF_OK(DoSimdUnop(FloatNearest<f64>));
+
+    CASE(F32X4Abs):            NEXT_IF_OK(DoSimdUnop(FloatAbs<f32>));
+    CASE(F32X4Neg):            NEXT_IF_OK(DoSimdUnop(FloatNeg<f32>));
+    CASE(F32X4Sqrt):           NEXT_IF_OK(DoSimdUnop(FloatSqrt<f32>));
+    CASE(F32X4Add):            NEXT_IF_OK(DoSimdBinop(Add<f32>));
+    CASE(F32X4Sub):            NEXT_IF_OK(DoSimdBinop(Sub<f32>));
+    CASE(F32X4Mul):            NEXT_IF_OK(DoSimdBinop(Mul<f32>));
+    CASE(F32X4Div):            NEXT_IF_OK(DoSimdBinop(FloatDiv<f32>));
+    CASE(F32X4PMin):           NEXT_IF_OK(DoSimdBinop(FloatPMin<f32>));
+    CASE(F32X4PMax):           NEXT_IF_OK(DoSimdBinop(FloatPMax<f32>));
+
+    CASE(F32X4Min):
+    CASE(F32X4RelaxedMin):
+      NEXT_IF_OK(DoSimdBinop(FloatMin<f32>));
+
+    CASE(F32X4Max):
+    CASE(F32X4RelaxedMax):
+      NEXT_IF_OK(DoSimdBinop(FloatMax<f32>));
+
+    CASE(F64X2Abs):            NEXT_IF_OK(DoSimdUnop(FloatAbs<f64>));
+    CASE(F64X2Neg):            NEXT_IF_OK(DoSimdUnop(FloatNeg<f64>));
+    CASE(F64X2Sqrt):           NEXT_IF_OK(DoSimdUnop(FloatSqrt<f64>));
+    CASE(F64X2Add):            NEXT_IF_OK(DoSimdBinop(Add<f64>));
+    CASE(F64X2Sub):            NEXT_IF_OK(DoSimdBinop(Sub<f64>));
+    CASE(F64X2Mul):            NEXT_IF_OK(DoSimdBinop(Mul<f64>));
+    CASE(F64X2Div):            NEXT_IF_OK(DoSimdBinop(FloatDiv<f64>));
+    CASE(F64X2PMin):           NEXT_IF_OK(DoSimdBinop(FloatPMin<f64>));
+    CASE(F64X2PMax):           NEXT_IF_OK(DoSimdBinop(FloatPMax<f64>));
+
+    CASE(F64X2Min):
+    CASE(F64X2RelaxedMin):
+      NEXT_IF_OK(DoSimdBinop(FloatMin<f64>));
+
+    CASE(F64X2Max):
+    CASE(F64X2RelaxedMax):
+      NEXT_IF_OK(DoSimdBinop(FloatMax<f64>));
+
+    CASE(I32X4TruncSatF32X4S):
+    CASE(I32X4RelaxedTruncF32X4S):
+      NEXT_IF_OK(DoSimdUnop(IntTruncSat<s32, f32>));
+
+    CASE(I32X4TruncSatF32X4U):
+    CASE(I32X4RelaxedTruncF32X4U):
+      NEXT_IF_OK(DoSimdUnop(IntTruncSat<u32, f32>));
+
+    CASE(I32X4TruncSatF64X2SZero):
+    CASE(I32X4RelaxedTruncF64X2SZero):
+      NEXT_IF_OK(DoSimdUnopZero(IntTruncSat<s32, f64>));
+
+    CASE(I32X4TruncSatF64X2UZero):
+    CASE(I32X4RelaxedTruncF64X2UZero):
+      NEXT_IF_OK(DoSimdUnopZero(IntTruncSat<u32, f64>));
+
+    CASE(F32X4ConvertI32X4S):    NEXT_IF_OK(DoSimdUnop(Convert<f32, s32>));
+    CASE(F32X4ConvertI32X4U):    NEXT_IF_OK(DoSimdUnop(Convert<f32, u32>));
+    CASE(F32X4DemoteF64X2Zero):   NEXT_IF_OK(DoSimdUnopZero(Convert<f32, f64>));
+    CASE(F64X2PromoteLowF32X4):   NEXT_IF_OK(DoSimdConvert<f64x2, f32x4, true>());
+    CASE(F64X2ConvertLowI32X4S):   NEXT_IF_OK(DoSimdConvert<f64x2, s32x4, true>());
+    CASE(F64X2ConvertLowI32X4U):   NEXT_IF_OK(DoSimdConvert<f64x2, u32x4, true>());
+
+    CASE(I8X16Swizzle):
+    CASE(I8X16RelaxedSwizzle):
+      NEXT_IF_OK(DoSimdSwizzle());
+
+    CASE(I8X16Shuffle):       NEXT_IF_OK(DoSimdShuffle(instr));
+
+    CASE(V128Load8Splat):      NEXT_IF_OK(DoSimdLoadSplat<u8x16>(instr, out_trap));
+    CASE(V128Load16Splat):     NEXT_IF_OK(DoSimdLoadSplat<u16x8>(instr, out_trap));
+    CASE(V128Load32Splat):     NEXT_IF_OK(DoSimdLoadSplat<u32x4>(instr, out_trap));
+    CASE(V128Load64Splat):     NEXT_IF_OK(DoSimdLoadSplat<u64x2>(instr, out_trap));
+
+    CASE(V128Load8Lane):      NEXT_IF_OK(DoSimdLoadLane<u8x16>(instr, out_trap));
+    CASE(V128Load16Lane):     NEXT_IF_OK(DoSimdLoadLane<u16x8>(instr, out_trap));
+    CASE(V128Load32Lane):     NEXT_IF_OK(DoSimdLoadLane<u32x4>(instr, out_trap));
+    CASE(V128Load64Lane):     NEXT_IF_OK(DoSimdLoadLane<u64x2>(instr, out_trap));
+
+    CASE(V128Store8Lane):      NEXT_IF_OK(DoSimdStoreLane<u8x16>(instr, out_trap));
+    CASE(V128Store16Lane):     NEXT_IF_OK(DoSimdStoreLane<u16x8>(instr, out_trap));
+    CASE(V128Store32Lane):     NEXT_IF_OK(DoSimdStoreLane<u32x4>(instr, out_trap));
+    CASE(V128Store64Lane):     NEXT_IF_OK(DoSimdStoreLane<u64x2>(instr, out_trap));
+
+    CASE(V128Load32Zero):   NEXT_IF_OK(DoSimdLoadZero<u32x4, u32>(instr, out_trap));
+    CASE(V128Load64Zero):   NEXT_IF_OK(DoSimdLoadZero<u64x2, u64>(instr, out_trap));
+
+    CASE(I8X16NarrowI16X8S):      NEXT_IF_OK(DoSimdNarrow<s8x16, s16x8>());
+    CASE(I8X16NarrowI16X8U):      NEXT_IF_OK(DoSimdNarrow<u8x16, s16x8>());
+    CASE(I16X8NarrowI32X4S):      NEXT_IF_OK(DoSimdNarrow<s16x8, s32x4>());
+    CASE(I16X8NarrowI32X4U):      NEXT_IF_OK(DoSimdNarrow<u16x8, s32x4>());
+    CASE(I16X8ExtendLowI8X16S):    NEXT_IF_OK(DoSimdConvert<s16x8, s8x16, true>());
+    CASE(I16X8ExtendHighI8X16S):   NEXT_IF_OK(DoSimdConvert<s16x8, s8x16, false>());
+    CASE(I16X8ExtendLowI8X16U):    NEXT_IF_OK(DoSimdConvert<u16x8, u8x16, true>());
+    CASE(I16X8ExtendHighI8X16U):   NEXT_IF_OK(DoSimdConvert<u16x8, u8x16, false>());
+    CASE(I32X4ExtendLowI16X8S):    NEXT_IF_OK(DoSimdConvert<s32x4, s16x8, true>());
+    CASE(I32X4ExtendHighI16X8S):   NEXT_IF_OK(DoSimdConvert<s32x4, s16x8, false>());
+    CASE(I32X4ExtendLowI16X8U):    NEXT_IF_OK(DoSimdConvert<u32x4, u16x8, true>());
+    CASE(I32X4ExtendHighI16X8U):   NEXT_IF_OK(DoSimdConvert<u32x4, u16x8, false>());
+    CASE(I64X2ExtendLowI32X4S):    NEXT_IF_OK(DoSimdConvert<s64x2, s32x4, true>());
+    CASE(I64X2ExtendHighI32X4S):   NEXT_IF_OK(DoSimdConvert<s64x2, s32x4, false>());
+    CASE(I64X2ExtendLowI32X4U):    NEXT_IF_OK(DoSimdConvert<u64x2, u32x4, true>());
+    CASE(I64X2ExtendHighI32X4U):   NEXT_IF_OK(DoSimdConvert<u64x2, u32x4, false>());
+
+    CASE(V128Load8X8S):    NEXT_IF_OK(DoSimdLoadExtend<s16x8, s8x8>(instr, out_trap));
+    CASE(V128Load8X8U):    NEXT_IF_OK(DoSimdLoadExtend<u16x8, u8x8>(instr, out_trap));
+    CASE(V128Load16X4S):   NEXT_IF_OK(DoSimdLoadExtend<s32x4, s16x4>(instr, out_trap));
+    CASE(V128Load16X4U):   NEXT_IF_OK(DoSimdLoadExtend<u32x4, u16x4>(instr, out_trap));
+    CASE(V128Load32X2S):   NEXT_IF_OK(DoSimdLoadExtend<s64x2, s32x2>(instr, out_trap));
+    CASE(V128Load32X2U):   NEXT_IF_OK(DoSimdLoadExtend<u64x2, u32x2>(instr, out_trap));
+
+    CASE(V128Andnot):   NEXT_IF_OK(DoSimdBinop(IntAndNot<u64>));
+    CASE(I8X16AvgrU):   NEXT_IF_OK(DoSimdBinop(IntAvgr<u8>));
+    CASE(I16X8AvgrU):   NEXT_IF_OK(DoSimdBinop(IntAvgr<u16>));
+
+    CASE(I8X16Abs):   NEXT_IF_OK(DoSimdUnop(IntAbs<u8>));
+    CASE(I16X8Abs):   NEXT_IF_OK(DoSimdUnop(IntAbs<u16>));
+    CASE(I32X4Abs):   NEXT_IF_OK(DoSimdUnop(IntAbs<u32>));
+    CASE(I64X2Abs):   NEXT_IF_OK(DoSimdUnop(IntAbs<u64>));
+
+    CASE(I8X16Popcnt):   NEXT_IF_OK(DoSimdUnop(IntPopcnt<u8>));
+
+    CASE(I16X8ExtaddPairwiseI8X16S):   NEXT_IF_OK(DoSimdExtaddPairwise<s16x8, s8x16>());
+    CASE(I16X8ExtaddPairwiseI8X16U):   NEXT_IF_OK(DoSimdExtaddPairwise<u16x8, u8x16>());
+    CASE(I32X4ExtaddPairwiseI16X8S):   NEXT_IF_OK(DoSimdExtaddPairwise<s32x4, s16x8>());
+    CASE(I32X4ExtaddPairwiseI16X8U):   NEXT_IF_OK(DoSimdExtaddPairwise<u32x4, u16x8>());
+
+    CASE(I16X8ExtmulLowI8X16S):   NEXT_IF_OK(DoSimdExtmul<s16x8, s8x16, true>());
+    CASE(I16X8ExtmulHighI8X16S):   NEXT_IF_OK(DoSimdExtmul<s16x8, s8x16, false>());
+    CASE(I16X8ExtmulLowI8X16U):   NEXT_IF_OK(DoSimdExtmul<u16x8, u8x16, true>());
+    CASE(I16X8ExtmulHighI8X16U):   NEXT_IF_OK(DoSimdExtmul<u16x8, u8x16, false>());
+    CASE(I32X4ExtmulLowI16X8S):   NEXT_IF_OK(DoSimdExtmul<s32x4, s16x8, true>());
+    CASE(I32X4ExtmulHighI16X8S):   NEXT_IF_OK(DoSimdExtmul<s32x4, s16x8, false>());
+    CASE(I32X4ExtmulLowI16X8U):   NEXT_IF_OK(DoSimdExtmul<u32x4, u16x8, true>());
+    CASE(I32X4ExtmulHighI16X8U):   NEXT_IF_OK(DoSimdExtmul<u32x4, u16x8, false>());
+    CASE(I64X2ExtmulLowI32X4S):   NEXT_IF_OK(DoSimdExtmul<s64x2, s32x4, true>());
+    CASE(I64X2ExtmulHighI32X4S):   NEXT_IF_OK(DoSimdExtmul<s64x2, s32x4, false>());
+    CASE(I64X2ExtmulLowI32X4U):   NEXT_IF_OK(DoSimdExtmul<u64x2, u32x4, true>());
+    CASE(I64X2ExtmulHighI32X4U):   NEXT_IF_OK(DoSimdExtmul<u64x2, u32x4, false>());
+
+    CASE(I16X8Q15mulrSatS):
+    CASE(I16X8RelaxedQ15mulrS):
+      NEXT_IF_OK(DoSimdBinop(SaturatingRoundingQMul<s16>));
+
+    CASE(I32X4DotI16X8S):   NEXT_IF_OK(DoSimdDot<u32x4, s16x8>());
+    CASE(I16X8DotI8X16I7X16S):   NEXT_IF_OK(DoSimdDot<u16x8, s8x16>());
+    CASE(I32X4DotI8X16I7X16AddS):   NEXT_IF_OK(DoSimdDotAdd<u32x4, s16x8>());
+
+    CASE(F32X4RelaxedMadd):   NEXT_IF_OK(DoSimdRelaxedMadd<f32>());
+    CASE(F32X4RelaxedNmadd):   NEXT_IF_OK(DoSimdRelaxedNmadd<f32>());
+    CASE(F64X2RelaxedMadd):   NEXT_IF_OK(DoSimdRelaxedMadd<f64>());
+    CASE(F64X2RelaxedNmadd):   NEXT_IF_OK(DoSimdRelaxedNmadd<f64>());
+
+    CASE(AtomicFence):
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      NEXT();
+
+    CASE(MemoryAtomicNotify):  NEXT_IF_OK(DoAtomicNotify(instr, out_trap));
+    CASE(MemoryAtomicWait32):  NEXT_IF_OK(DoAtomicWait<u32>(instr, out_trap));
+    CASE(MemoryAtomicWait64):  NEXT_IF_OK(DoAtomicWait<u64>(instr, out_trap));
+
+    CASE(I64Add128):
+    CASE(I64Sub128):
+    CASE(I64MulWideS):
+    CASE(I64MulWideU):
       return TRAP("not implemented");
 
-    case O::I32AtomicLoad:       return DoAtomicLoad<u32>(instr, out_trap);
-    case O::I64AtomicLoad:       return DoAtomicLoad<u64>(instr, out_trap);
-    case O::I32AtomicLoad8U:     return DoAtomicLoad<u32, u8>(instr, out_trap);
-    case O::I32AtomicLoad16U:    return DoAtomicLoad<u32, u16>(instr, out_trap);
-    case O::I64AtomicLoad8U:     return DoAtomicLoad<u64, u8>(instr, out_trap);
-    case O::I64AtomicLoad16U:    return DoAtomicLoad<u64, u16>(instr, out_trap);
-    case O::I64AtomicLoad32U:    return DoAtomicLoad<u64, u32>(instr, out_trap);
-    case O::I32AtomicStore:      return DoAtomicStore<u32>(instr, out_trap);
-    case O::I64AtomicStore:      return DoAtomicStore<u64>(instr, out_trap);
-    case O::I32AtomicStore8:     return DoAtomicStore<u32, u8>(instr, out_trap);
-    case O::I32AtomicStore16:    return DoAtomicStore<u32, u16>(instr, out_trap);
-    case O::I64AtomicStore8:     return DoAtomicStore<u64, u8>(instr, out_trap);
-    case O::I64AtomicStore16:    return DoAtomicStore<u64, u16>(instr, out_trap);
-    case O::I64AtomicStore32:    return DoAtomicStore<u64, u32>(instr, out_trap);
-    case O::I32AtomicRmwAdd:     return DoAtomicRmw<u32>(Add<u32>, instr, out_trap);
-    case O::I64AtomicRmwAdd:     return DoAtomicRmw<u64>(Add<u64>, instr, out_trap);
-    case O::I32AtomicRmw8AddU:   return DoAtomicRmw<u32>(Add<u8>, instr, out_trap);
-    case O::I32AtomicRmw16AddU:  return DoAtomicRmw<u32>(Add<u16>, instr, out_trap);
-    case O::I64AtomicRmw8AddU:   return DoAtomicRmw<u64>(Add<u8>, instr, out_trap);
-    case O::I64AtomicRmw16AddU:  return DoAtomicRmw<u64>(Add<u16>, instr, out_trap);
-    case O::I64AtomicRmw32AddU:  return DoAtomicRmw<u64>(Add<u32>, instr, out_trap);
-    case O::I32AtomicRmwSub:     return DoAtomicRmw<u32>(Sub<u32>, instr, out_trap);
-    case O::I64AtomicRmwSub:     return DoAtomicRmw<u64>(Sub<u64>, instr, out_trap);
-    case O::I32AtomicRmw8SubU:   return DoAtomicRmw<u32>(Sub<u8>, instr, out_trap);
-    case O::I32AtomicRmw16SubU:  return DoAtomicRmw<u32>(Sub<u16>, instr, out_trap);
-    case O::I64AtomicRmw8SubU:   return DoAtomicRmw<u64>(Sub<u8>, instr, out_trap);
-    case O::I64AtomicRmw16SubU:  return DoAtomicRmw<u64>(Sub<u16>, instr, out_trap);
-    case O::I64AtomicRmw32SubU:  return DoAtomicRmw<u64>(Sub<u32>, instr, out_trap);
-    case O::I32AtomicRmwAnd:     return DoAtomicRmw<u32>(IntAnd<u32>, instr, out_trap);
-    case O::I64AtomicRmwAnd:     return DoAtomicRmw<u64>(IntAnd<u64>, instr, out_trap);
-    case O::I32AtomicRmw8AndU:   return DoAtomicRmw<u32>(IntAnd<u8>, instr, out_trap);
-    case O::I32AtomicRmw16AndU:  return DoAtomicRmw<u32>(IntAnd<u16>, instr, out_trap);
-    case O::I64AtomicRmw8AndU:   return DoAtomicRmw<u64>(IntAnd<u8>, instr, out_trap);
-    case O::I64AtomicRmw16AndU:  return DoAtomicRmw<u64>(IntAnd<u16>, instr, out_trap);
-    case O::I64AtomicRmw32AndU:  return DoAtomicRmw<u64>(IntAnd<u32>, instr, out_trap);
-    case O::I32AtomicRmwOr:      return DoAtomicRmw<u32>(IntOr<u32>, instr, out_trap);
-    case O::I64AtomicRmwOr:      return DoAtomicRmw<u64>(IntOr<u64>, instr, out_trap);
-    case O::I32AtomicRmw8OrU:    return DoAtomicRmw<u32>(IntOr<u8>, instr, out_trap);
-    case O::I32AtomicRmw16OrU:   return DoAtomicRmw<u32>(IntOr<u16>, instr, out_trap);
-    case O::I64AtomicRmw8OrU:    return DoAtomicRmw<u64>(IntOr<u8>, instr, out_trap);
-    case O::I64AtomicRmw16OrU:   return DoAtomicRmw<u64>(IntOr<u16>, instr, out_trap);
-    case O::I64AtomicRmw32OrU:   return DoAtomicRmw<u64>(IntOr<u32>, instr, out_trap);
-    case O::I32AtomicRmwXor:     return DoAtomicRmw<u32>(IntXor<u32>, instr, out_trap);
-    case O::I64AtomicRmwXor:     return DoAtomicRmw<u64>(IntXor<u64>, instr, out_trap);
-    case O::I32AtomicRmw8XorU:   return DoAtomicRmw<u32>(IntXor<u8>, instr, out_trap);
-    case O::I32AtomicRmw16XorU:  return DoAtomicRmw<u32>(IntXor<u16>, instr, out_trap);
-    case O::I64AtomicRmw8XorU:   return DoAtomicRmw<u64>(IntXor<u8>, instr, out_trap);
-    case O::I64AtomicRmw16XorU:  return DoAtomicRmw<u64>(IntXor<u16>, instr, out_trap);
-    case O::I64AtomicRmw32XorU:  return DoAtomicRmw<u64>(IntXor<u32>, instr, out_trap);
-    case O::I32AtomicRmwXchg:    return DoAtomicRmw<u32>(Xchg<u32>, instr, out_trap);
-    case O::I64AtomicRmwXchg:    return DoAtomicRmw<u64>(Xchg<u64>, instr, out_trap);
-    case O::I32AtomicRmw8XchgU:  return DoAtomicRmw<u32>(Xchg<u8>, instr, out_trap);
-    case O::I32AtomicRmw16XchgU: return DoAtomicRmw<u32>(Xchg<u16>, instr, out_trap);
-    case O::I64AtomicRmw8XchgU:  return DoAtomicRmw<u64>(Xchg<u8>, instr, out_trap);
-    case O::I64AtomicRmw16XchgU: return DoAtomicRmw<u64>(Xchg<u16>, instr, out_trap);
-    case O::I64AtomicRmw32XchgU: return DoAtomicRmw<u64>(Xchg<u32>, instr, out_trap);
-
-    case O::I32AtomicRmwCmpxchg:    return DoAtomicRmwCmpxchg<u32>(instr, out_trap);
-    case O::I64AtomicRmwCmpxchg:    return DoAtomicRmwCmpxchg<u64>(instr, out_trap);
-    case O::I32AtomicRmw8CmpxchgU:  return DoAtomicRmwCmpxchg<u32, u8>(instr, out_trap);
-    case O::I32AtomicRmw16CmpxchgU: return DoAtomicRmwCmpxchg<u32, u16>(instr, out_trap);
-    case O::I64AtomicRmw8CmpxchgU:  return DoAtomicRmwCmpxchg<u64, u8>(instr, out_trap);
-    case O::I64AtomicRmw16CmpxchgU: return DoAtomicRmwCmpxchg<u64, u16>(instr, out_trap);
-    case O::I64AtomicRmw32CmpxchgU: return DoAtomicRmwCmpxchg<u64, u32>(instr, out_trap);
-
-    case O::Throw: {
+    CASE(I32AtomicLoad):         NEXT_IF_OK(DoAtomicLoad<u32>(instr, out_trap));
+    CASE(I64AtomicLoad):         NEXT_IF_OK(DoAtomicLoad<u64>(instr, out_trap));
+    CASE(I32AtomicLoad8U):       NEXT_IF_OK(DoAtomicLoad<u32, u8>(instr, out_trap));
+    CASE(I32AtomicLoad16U):      NEXT_IF_OK(DoAtomicLoad<u32, u16>(instr, out_trap));
+    CASE(I64AtomicLoad8U):       NEXT_IF_OK(DoAtomicLoad<u64, u8>(instr, out_trap));
+    CASE(I64AtomicLoad16U):      NEXT_IF_OK(DoAtomicLoad<u64, u16>(instr, out_trap));
+    CASE(I64AtomicLoad32U):      NEXT_IF_OK(DoAtomicLoad<u64, u32>(instr, out_trap));
+    CASE(I32AtomicStore):        NEXT_IF_OK(DoAtomicStore<u32>(instr, out_trap));
+    CASE(I64AtomicStore):        NEXT_IF_OK(DoAtomicStore<u64>(instr, out_trap));
+    CASE(I32AtomicStore8):       NEXT_IF_OK(DoAtomicStore<u32, u8>(instr, out_trap));
+    CASE(I32AtomicStore16):      NEXT_IF_OK(DoAtomicStore<u32, u16>(instr, out_trap));
+    CASE(I64AtomicStore8):       NEXT_IF_OK(DoAtomicStore<u64, u8>(instr, out_trap));
+    CASE(I64AtomicStore16):      NEXT_IF_OK(DoAtomicStore<u64, u16>(instr, out_trap));
+    CASE(I64AtomicStore32):      NEXT_IF_OK(DoAtomicStore<u64, u32>(instr, out_trap));
+    CASE(I32AtomicRmwAdd):       NEXT_IF_OK(DoAtomicRmw<u32>(Add<u32>, instr, out_trap));
+    CASE(I64AtomicRmwAdd):       NEXT_IF_OK(DoAtomicRmw<u64>(Add<u64>, instr, out_trap));
+    CASE(I32AtomicRmw8AddU):     NEXT_IF_OK(DoAtomicRmw<u32>(Add<u8>, instr, out_trap));
+    CASE(I32AtomicRmw16AddU):    NEXT_IF_OK(DoAtomicRmw<u32>(Add<u16>, instr, out_trap));
+    CASE(I64AtomicRmw8AddU):     NEXT_IF_OK(DoAtomicRmw<u64>(Add<u8>, instr, out_trap));
+    CASE(I64AtomicRmw16AddU):    NEXT_IF_OK(DoAtomicRmw<u64>(Add<u16>, instr, out_trap));
+    CASE(I64AtomicRmw32AddU):    NEXT_IF_OK(DoAtomicRmw<u64>(Add<u32>, instr, out_trap));
+    CASE(I32AtomicRmwSub):       NEXT_IF_OK(DoAtomicRmw<u32>(Sub<u32>, instr, out_trap));
+    CASE(I64AtomicRmwSub):       NEXT_IF_OK(DoAtomicRmw<u64>(Sub<u64>, instr, out_trap));
+    CASE(I32AtomicRmw8SubU):     NEXT_IF_OK(DoAtomicRmw<u32>(Sub<u8>, instr, out_trap));
+    CASE(I32AtomicRmw16SubU):    NEXT_IF_OK(DoAtomicRmw<u32>(Sub<u16>, instr, out_trap));
+    CASE(I64AtomicRmw8SubU):     NEXT_IF_OK(DoAtomicRmw<u64>(Sub<u8>, instr, out_trap));
+    CASE(I64AtomicRmw16SubU):    NEXT_IF_OK(DoAtomicRmw<u64>(Sub<u16>, instr, out_trap));
+    CASE(I64AtomicRmw32SubU):    NEXT_IF_OK(DoAtomicRmw<u64>(Sub<u32>, instr, out_trap));
+    CASE(I32AtomicRmwAnd):       NEXT_IF_OK(DoAtomicRmw<u32>(IntAnd<u32>, instr, out_trap));
+    CASE(I64AtomicRmwAnd):       NEXT_IF_OK(DoAtomicRmw<u64>(IntAnd<u64>, instr, out_trap));
+    CASE(I32AtomicRmw8AndU):     NEXT_IF_OK(DoAtomicRmw<u32>(IntAnd<u8>, instr, out_trap));
+    CASE(I32AtomicRmw16AndU):    NEXT_IF_OK(DoAtomicRmw<u32>(IntAnd<u16>, instr, out_trap));
+    CASE(I64AtomicRmw8AndU):     NEXT_IF_OK(DoAtomicRmw<u64>(IntAnd<u8>, instr, out_trap));
+    CASE(I64AtomicRmw16AndU):    NEXT_IF_OK(DoAtomicRmw<u64>(IntAnd<u16>, instr, out_trap));
+    CASE(I64AtomicRmw32AndU):    NEXT_IF_OK(DoAtomicRmw<u64>(IntAnd<u32>, instr, out_trap));
+    CASE(I32AtomicRmwOr):        NEXT_IF_OK(DoAtomicRmw<u32>(IntOr<u32>, instr, out_trap));
+    CASE(I64AtomicRmwOr):        NEXT_IF_OK(DoAtomicRmw<u64>(IntOr<u64>, instr, out_trap));
+    CASE(I32AtomicRmw8OrU):      NEXT_IF_OK(DoAtomicRmw<u32>(IntOr<u8>, instr, out_trap));
+    CASE(I32AtomicRmw16OrU):     NEXT_IF_OK(DoAtomicRmw<u32>(IntOr<u16>, instr, out_trap));
+    CASE(I64AtomicRmw8OrU):      NEXT_IF_OK(DoAtomicRmw<u64>(IntOr<u8>, instr, out_trap));
+    CASE(I64AtomicRmw16OrU):     NEXT_IF_OK(DoAtomicRmw<u64>(IntOr<u16>, instr, out_trap));
+    CASE(I64AtomicRmw32OrU):     NEXT_IF_OK(DoAtomicRmw<u64>(IntOr<u32>, instr, out_trap));
+    CASE(I32AtomicRmwXor):       NEXT_IF_OK(DoAtomicRmw<u32>(IntXor<u32>, instr, out_trap));
+    CASE(I64AtomicRmwXor):       NEXT_IF_OK(DoAtomicRmw<u64>(IntXor<u64>, instr, out_trap));
+    CASE(I32AtomicRmw8XorU):     NEXT_IF_OK(DoAtomicRmw<u32>(IntXor<u8>, instr, out_trap));
+    CASE(I32AtomicRmw16XorU):    NEXT_IF_OK(DoAtomicRmw<u32>(IntXor<u16>, instr, out_trap));
+    CASE(I64AtomicRmw8XorU):     NEXT_IF_OK(DoAtomicRmw<u64>(IntXor<u8>, instr, out_trap));
+    CASE(I64AtomicRmw16XorU):    NEXT_IF_OK(DoAtomicRmw<u64>(IntXor<u16>, instr, out_trap));
+    CASE(I64AtomicRmw32XorU):    NEXT_IF_OK(DoAtomicRmw<u64>(IntXor<u32>, instr, out_trap));
+    CASE(I32AtomicRmwXchg):      NEXT_IF_OK(DoAtomicRmw<u32>(Xchg<u32>, instr, out_trap));
+    CASE(I64AtomicRmwXchg):      NEXT_IF_OK(DoAtomicRmw<u64>(Xchg<u64>, instr, out_trap));
+    CASE(I32AtomicRmw8XchgU):    NEXT_IF_OK(DoAtomicRmw<u32>(Xchg<u8>, instr, out_trap));
+    CASE(I32AtomicRmw16XchgU):   NEXT_IF_OK(DoAtomicRmw<u32>(Xchg<u16>, instr, out_trap));
+    CASE(I64AtomicRmw8XchgU):    NEXT_IF_OK(DoAtomicRmw<u64>(Xchg<u8>, instr, out_trap));
+    CASE(I64AtomicRmw16XchgU):   NEXT_IF_OK(DoAtomicRmw<u64>(Xchg<u16>, instr, out_trap));
+    CASE(I64AtomicRmw32XchgU):   NEXT_IF_OK(DoAtomicRmw<u64>(Xchg<u32>, instr, out_trap));
+
+    CASE(I32AtomicRmwCmpxchg):      NEXT_IF_OK(DoAtomicRmwCmpxchg<u32>(instr, out_trap));
+    CASE(I64AtomicRmwCmpxchg):      NEXT_IF_OK(DoAtomicRmwCmpxchg<u64>(instr, out_trap));
+    CASE(I32AtomicRmw8CmpxchgU):    NEXT_IF_OK(DoAtomicRmwCmpxchg<u32, u8>(instr, out_trap));
+    CASE(I32AtomicRmw16CmpxchgU):   NEXT_IF_OK(DoAtomicRmwCmpxchg<u32, u16>(instr, out_trap));
+    CASE(I64AtomicRmw8CmpxchgU):    NEXT_IF_OK(DoAtomicRmwCmpxchg<u64, u8>(instr, out_trap));
+    CASE(I64AtomicRmw16CmpxchgU):   NEXT_IF_OK(DoAtomicRmwCmpxchg<u64, u16>(instr, out_trap));
+    CASE(I64AtomicRmw32CmpxchgU):   NEXT_IF_OK(DoAtomicRmwCmpxchg<u64, u32>(instr, out_trap));
+
+    CASE(Throw): {
       u32 tag_index = instr.imm_u32;
       Values params;
       Ref tag_ref = inst_->tags()[tag_index];
       Tag::Ptr tag{store_, tag_ref};
       PopValues(tag->type().signature, &params);
       Exception::Ptr exn = Exception::New(store_, tag_ref, params);
-      return DoThrow(exn);
+      RESUME_IF_OK(DoThrow(exn));
     }
-    case O::Rethrow: {
+    CASE(Rethrow): {
       u32 exn_index = instr.imm_u32;
       Exception::Ptr exn{store_,
                          exceptions_[exceptions_.size() - exn_index - 1]};
-      return DoThrow(exn);
+      RESUME_IF_OK(DoThrow(exn));
     }
-    case O::ThrowRef: {
+    CASE(ThrowRef): {
       Ref ref = Pop<Ref>();
       assert(store_.HasValueType(ref, ValueType::ExnRef));
       // FIXME better error message?
       TRAP_IF(ref == Ref::Null, "expected exnref, got null");
       Exception::Ptr exn = store_.UnsafeGet<Exception>(ref);
-      return DoThrow(exn);
+      RESUME_IF_OK(DoThrow(exn));
     }
 
     // The following opcodes are either never generated or should never be
     // executed.
-    case O::Nop:
-    case O::Block:
-    case O::Loop:
-    case O::If:
-    case O::Else:
-    case O::End:
-    case O::ReturnCall:
-    case O::SelectT:
-
-    case O::Try:
-    case O::TryTable:
-    case O::Catch:
-    case O::CatchAll:
-    case O::Delegate:
-    case O::InterpData:
-    case O::Invalid:
+    CASE(Nop):
+    CASE(Block):
+    CASE(Loop):
+    CASE(If):
+    CASE(Else):
+    CASE(End):
+    CASE(ReturnCall):
+    CASE(SelectT):
+
+    CASE(Try):
+    CASE(TryTable):
+    CASE(Catch):
+    CASE(CatchAll):
+    CASE(Delegate):
+    CASE(InterpData):
+    CASE(Invalid):
       WABT_UNREACHABLE;
-      break;
   }
   // clang-format on
 
-  return RunResult::Ok;
+  WABT_UNREACHABLE;
 }
 
+#undef CASE
+#undef DISPATCH
+#undef NEXT
+#undef NEXT_IF_OK
+#undef RESUME_IF_OK
+
 RunResult Thread::DoCall(const Func::Ptr& func, Trap::Ptr* out_trap) {
   if (auto* host_func = dyn_cast<HostFunc>(func.get())) {
     auto& func_type = host_func->type();
@@ -2206,8 +3293,14 @@ RunResult Thread::DoCall(const Func::Ptr& func, Trap::Ptr* out_trap) {
     }
 
     Values results(func_type.results.size());
-    if (Failed(host_func->Call(*this, params, results, out_trap))) {
-      return RunResult::Trap;
+    {
+      // The caller's stack map is valid during the call.
+      store_.UnblockGC();
+      Result result = host_func->Call(*this, params, results, out_trap);
+      store_.BlockGC();
+      if (Failed(result)) {
+        return RunResult::Trap;
+      }
     }
 
     PopCall();
@@ -2221,37 +3314,41 @@ RunResult Thread::DoCall(const Func::Ptr& func, Trap::Ptr* out_trap) {
 }
 
 template <typename T>
-RunResult Thread::Load(Instr instr, T* out, Trap::Ptr* out_trap) {
-  Memory::Ptr memory{store_, inst_->memories()[instr.imm_index_offset.memidx]};
-  u64 offset = PopPtr(memory);
-  TRAP_IF(Failed(memory->Load(offset, instr.imm_index_offset.offset, out)),
+RunResult Thread::Load(Memory& memory,
+                       u64 offset,
+                       u64 addend,
+                       T* out,
+                       Trap::Ptr* out_trap) {
+  TRAP_IF(Failed(memory.Load(offset, addend, out)),
           StringPrintf("out of bounds memory access: access at %" PRIu64
                        "+%" PRIzd " >= max value %" PRIu64,
-                       offset + instr.imm_index_offset.offset, sizeof(T),
-                       memory->ByteSize()));
+                       offset + addend, sizeof(T), memory.ByteSize()));
   return RunResult::Ok;
 }
 
 template <typename T, typename V>
 RunResult Thread::DoLoad(Instr instr, Trap::Ptr* out_trap) {
+  Memory& memory = GetMemory(instr.imm_index_offset.memidx);
   V val;
-  if (Load<V>(instr, &val, out_trap) != RunResult::Ok) {
+  if (Load<V>(memory, PickPtr(memory, 1), instr.imm_index_offset.offset, &val,
+              out_trap) != RunResult::Ok) {
     return RunResult::Trap;
   }
-  Push(static_cast<T>(val));
+  Pick(1) = Value::Make(static_cast<T>(val));
   return RunResult::Ok;
 }
 
 template <typename T, typename V>
 RunResult Thread::DoStore(Instr instr, Trap::Ptr* out_trap) {
-  Memory::Ptr memory{store_, inst_->memories()[instr.imm_index_offset.memidx]};
-  V val = static_cast<V>(Pop<T>());
-  u64 offset = PopPtr(memory);
-  TRAP_IF(Failed(memory->Store(offset, instr.imm_index_offset.offset, val)),
+  Memory& memory = GetMemory(instr.imm_index_offset.memidx);
+  V val = static_cast<V>(Pick(1).Get<T>());
+  u64 offset = PickPtr(memory, 2);
+  TRAP_IF(Failed(memory.Store(offset, instr.imm_index_offset.offset, val)),
           StringPrintf("out of bounds memory access: access at %" PRIu64
                        "+%" PRIzd " >= max value %" PRIu64,
                        offset + instr.imm_index_offset.offset, sizeof(V),
-                       memory->ByteSize()));
+                       memory.ByteSize()));
+  values_.resize(values_.size() - 2);
   return RunResult::Ok;
 }
 
@@ -2563,57 +3660,62 @@ RunResult Thread::DoSimdShift(BinopFunc<R, T> f) {
 template <typename S>
 RunResult Thread::DoSimdLoadSplat(Instr instr, Trap::Ptr* out_trap) {
   using L = typename S::LaneType;
+  Memory& memory = GetMemory(instr.imm_index_offset.memidx);
   L val;
-  if (Load<L>(instr, &val, out_trap) != RunResult::Ok) {
+  if (Load<L>(memory, PickPtr(memory, 1), instr.imm_index_offset.offset, &val,
+              out_trap) != RunResult::Ok) {
     return RunResult::Trap;
   }
   S result;
   std::fill(std::begin(result.v), std::end(result.v), val);
-  Push(result);
+  Pick(1) = Value::Make(result);
   return RunResult::Ok;
 }
 
 template <typename S>
 RunResult Thread::DoSimdLoadLane(Instr instr, Trap::Ptr* out_trap) {
   using T = typename S::LaneType;
-  auto result = Pop<S>();
+  Memory& memory = GetMemory(instr.imm_index_offset_lane.memidx);
   T val;
-  if (Load<T>(instr, &val, out_trap) != RunResult::Ok) {
+  if (Load<T>(memory, PickPtr(memory, 2), instr.imm_index_offset_lane.offset,
+              &val, out_trap) != RunResult::Ok) {
     return RunResult::Trap;
   }
+  auto result = Pop<S>();
   result[instr.imm_index_offset_lane.lane] = val;
-  Push(result);
+  Pick(1) = Value::Make(result);
   return RunResult::Ok;
 }
 
 template <typename S>
 RunResult Thread::DoSimdStoreLane(Instr instr, Trap::Ptr* out_trap) {
   using T = typename S::LaneType;
-  Memory::Ptr memory{store_,
-                     inst_->memories()[instr.imm_index_offset_lane.memidx]};
-  auto result = Pop<S>();
-  T val = result[instr.imm_index_offset_lane.lane];
-  u64 offset = PopPtr(memory);
+  Memory& memory = GetMemory(instr.imm_index_offset_lane.memidx);
+  T val = Pick(1).Get<S>()[instr.imm_index_offset_lane.lane];
+  u64 offset = PickPtr(memory, 2);
   TRAP_IF(
-      Failed(memory->Store(offset, instr.imm_index_offset_lane.offset, val)),
+      Failed(memory.Store(offset, instr.imm_index_offset_lane.offset, val)),
       StringPrintf("out of bounds memory access: access at %" PRIu64 "+%" PRIzd
                    " >= max value %" PRIu64,
                    offset + instr.imm_index_offset_lane.offset, sizeof(T),
-                   memory->ByteSize()));
+                   memory.ByteSize()));
+  values_.resize(values_.size() - 2);
   return RunResult::Ok;
 }
 
 template <typename S, typename T>
 RunResult Thread::DoSimdLoadZero(Instr instr, Trap::Ptr* out_trap) {
   using L = typename S::LaneType;
+  Memory& memory = GetMemory(instr.imm_index_offset.memidx);
   L val;
-  if (Load<L>(instr, &val, out_trap) != RunResult::Ok) {
+  if (Load<L>(memory, PickPtr(memory, 1), instr.imm_index_offset.offset, &val,
+              out_trap) != RunResult::Ok) {
     return RunResult::Trap;
   }
   S result;
   std::fill(std::begin(result.v), std::end(result.v), 0);
   result[0] = val;
-  Push(result);
+  Pick(1) = Value::Make(result);
   return RunResult::Ok;
 }
 
@@ -2687,15 +3789,17 @@ RunResult Thread::DoSimdExtmul() {
 
 template <typename S, typename T>
 RunResult Thread::DoSimdLoadExtend(Instr instr, Trap::Ptr* out_trap) {
+  Memory& memory = GetMemory(instr.imm_index_offset.memidx);
   T val;
-  if (Load<T>(instr, &val, out_trap) != RunResult::Ok) {
+  if (Load<T>(memory, PickPtr(memory, 1), instr.imm_index_offset.offset, &val,
+              out_trap) != RunResult::Ok) {
     return RunResult::Trap;
   }
   S result;
   for (u8 i = 0; i < S::lanes; ++i) {
     result[i] = val[i];
   }
-  Push(result);
+  Pick(1) = Value::Make(result);
   return RunResult::Ok;
 }
 
@@ -2830,6 +3934,35 @@ RunResult Thread::DoAtomicRmwCmpxchg(Instr instr, Trap::Ptr* out_trap) {
   return RunResult::Ok;
 }
 
+template <typename T>
+RunResult Thread::DoAtomicWait(Instr instr, Trap::Ptr* out_trap) {
+  Memory::Ptr memory{store_, inst_->memories()[instr.imm_index_offset.memidx]};
+  s64 timeout = Pop<s64>();
+  T expected = Pop<T>();
+  u64 offset = PopPtr(memory);
+  TRAP_UNLESS(memory->IsShared(), "expected shared memory");
+  u32 result;
+  TRAP_IF(Failed(memory->AtomicWait(offset, instr.imm_index_offset.offset,
+                                    expected, timeout, &result)),
+          StringPrintf("invalid atomic access at %" PRIaddress "+%" PRIu64,
+                       offset, instr.imm_index_offset.offset));
+  Push(result);
+  return RunResult::Ok;
+}
+
+RunResult Thread::DoAtomicNotify(Instr instr, Trap::Ptr* out_trap) {
+  Memory::Ptr memory{store_, inst_->memories()[instr.imm_index_offset.memidx]};
+  u32 count = Pop<u32>();
+  u64 offset = PopPtr(memory);
+  u32 result;
+  TRAP_IF(Failed(memory->AtomicNotify(offset, instr.imm_index_offset.offset,
+                                      count, &result)),
+          StringPrintf("invalid atomic access at %" PRIaddress "+%" PRIu64,
+                       offset, instr.imm_index_offset.offset));
+  Push(result);
+  return RunResult::Ok;
+}
+
 RunResult Thread::DoThrow(Exception::Ptr exn) {
   Istream::Offset target_offset = Istream::kInvalidOffset;
   u32 target_values, target_exceptions;
@@ -2924,6 +4057,9 @@ found_handler:
   if (target_exnref) {
     Push(exn.ref());
   }
+  // The thread is now at the start of the handler, so this is a safe point to
+  // collect the exceptions that a long-running loop may throw.
+  store_.GCSafePoint();
   return RunResult::Ok;
 }
 
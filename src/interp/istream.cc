@@ -17,12 +17,25 @@
 #include "wabt/interp/istream.h"
 
 #include <cinttypes>
+#include <utility>
 
 namespace wabt {
 namespace interp {
 
+Istream::Istream(Encoding encoding) : encoding_(encoding) {}
+
+Istream::Offset Istream::BrTableEntrySize() const {
+  return encoding_ == Encoding::FixedWidth ? kFixedWidthBrTableEntrySize
+                                           : kBrTableEntrySize;
+}
+
 template <typename T>
 void WABT_VECTORCALL Istream::EmitAt(Offset offset, T val) {
+  if (encoding_ == Encoding::FixedWidth) {
+    assert(offset + sizeof(T) <= slots_.size() * sizeof(Instr));
+    memcpy(reinterpret_cast<u8*>(slots_.data()) + offset, &val, sizeof(val));
+    return;
+  }
   u32 new_size = offset + sizeof(T);
   if (new_size > data_.size()) {
     data_.resize(new_size);
@@ -35,41 +48,185 @@ void WABT_VECTORCALL Istream::EmitInternal(T val) {
   EmitAt(end(), val);
 }
 
+namespace {
+
+// Size of the immediates that are read for each InstrKind in the Compact
+// encoding.
+u32 GetImmediateSize(InstrKind kind) {
+  switch (kind) {
+    case InstrKind::Imm_0_Op_0:
+    case InstrKind::Imm_0_Op_1:
+    case InstrKind::Imm_0_Op_2:
+    case InstrKind::Imm_0_Op_3:
+      return 0;
+
+    case InstrKind::Imm_Jump_Op_0:
+    case InstrKind::Imm_Jump_Op_1:
+    case InstrKind::Imm_Jump_Op_2:
+    case InstrKind::Imm_Index_Op_0:
+    case InstrKind::Imm_Index_Op_1:
+    case InstrKind::Imm_Index_Op_2:
+    case InstrKind::Imm_Index_Op_3:
+    case InstrKind::Imm_Index_Op_N:
+    case InstrKind::Imm_I32_Op_0:
+    case InstrKind::Imm_F32_Op_0:
+      return sizeof(u32);
+
+    case InstrKind::Imm_Index_Index_Op_3:
+    case InstrKind::Imm_Index_Index_Op_N:
+    case InstrKind::Imm_I32_I32_Op_0:
+    case InstrKind::Imm_Index_Index_Op_0:
+    case InstrKind::Imm_Index_I32_Op_0:
+      return sizeof(u32) * 2;
+
+    case InstrKind::Imm_Index_Offset_Op_1:
+    case InstrKind::Imm_Index_Offset_Op_2:
+    case InstrKind::Imm_Index_Offset_Op_3:
+      return sizeof(u32) + sizeof(u64);
+
+    case InstrKind::Imm_Index_Offset_Lane_Op_2:
+      return sizeof(u32) + sizeof(u64) + sizeof(u8);
+
+    case InstrKind::Imm_I64_Op_0:
+    case InstrKind::Imm_F64_Op_0:
+      return sizeof(u64);
+
+    case InstrKind::Imm_I8_Op_1:
+    case InstrKind::Imm_I8_Op_2:
+      return sizeof(u8);
+
+    case InstrKind::Imm_V128_Op_0:
+    case InstrKind::Imm_V128_Op_2:
+      return sizeof(v128);
+
+    case InstrKind::Imm_Index_I32_Index_Op_0:
+      return sizeof(u32) * 3;
+
+    case InstrKind::Imm_Index_Index_Offset_Op_0:
+      return sizeof(u32) * 2 + sizeof(u64);
+  }
+  WABT_UNREACHABLE;
+}
+
+}  // end anonymous namespace
+
+Instr& Istream::EmitSlot(Opcode::Enum op) {
+  assert(slot_imm_pending_ == 0);
+  Instr& instr = slots_.emplace_back();
+  instr.op = op;
+  instr.kind = kInstrKinds[op];
+  instr.imm_v128 = v128(0, 0, 0, 0);
+  return instr;
+}
+
 void Istream::Emit(u32 val) {
+  if (encoding_ == Encoding::FixedWidth) {
+    // A separately emitted immediate of the last instruction. These are
+    // always u32s, which are laid out in order in the Instr union.
+    assert(slot_imm_pending_ >= sizeof(u32));
+    memcpy(reinterpret_cast<u8*>(&slots_.back().imm_u32x2) + slot_imm_written_,
+           &val, sizeof(val));
+    slot_imm_written_ += sizeof(u32);
+    slot_imm_pending_ -= sizeof(u32);
+    return;
+  }
   EmitInternal(val);
 }
 
 void Istream::Emit(Opcode::Enum op) {
+  if (encoding_ == Encoding::FixedWidth) {
+    Instr& instr = EmitSlot(op);
+    slot_imm_written_ = 0;
+    slot_imm_pending_ = GetImmediateSize(instr.kind);
+    return;
+  }
   EmitInternal(static_cast<SerializedOpcode>(op));
 }
 
 void Istream::Emit(Opcode::Enum op, u8 val) {
+  if (encoding_ == Encoding::FixedWidth) {
+    EmitSlot(op).imm_u8 = val;
+    return;
+  }
   Emit(op);
   EmitInternal(val);
 }
 
 void Istream::Emit(Opcode::Enum op, u32 val) {
+  if (encoding_ == Encoding::FixedWidth) {
+    EmitSlot(op).imm_u32 = val;
+    return;
+  }
   Emit(op);
   EmitInternal(val);
 }
 
 void Istream::Emit(Opcode::Enum op, u64 val) {
+  if (encoding_ == Encoding::FixedWidth) {
+    EmitSlot(op).imm_u64 = val;
+    return;
+  }
   Emit(op);
   EmitInternal(val);
 }
 
 void Istream::Emit(Opcode::Enum op, v128 val) {
+  if (encoding_ == Encoding::FixedWidth) {
+    EmitSlot(op).imm_v128 = val;
+    return;
+  }
   Emit(op);
   EmitInternal(val);
 }
 
 void Istream::Emit(Opcode::Enum op, u32 val1, u32 val2) {
+  if (encoding_ == Encoding::FixedWidth) {
+    Instr& instr = EmitSlot(op);
+    instr.imm_u32x2.fst = val1;
+    instr.imm_u32x2.snd = val2;
+    return;
+  }
   Emit(op);
   EmitInternal(val1);
   EmitInternal(val2);
 }
 
 void Istream::Emit(Opcode::Enum op, u32 val1, u32 val2, u8 val3) {
+  if (encoding_ == Encoding::FixedWidth) {
+    Instr& instr = EmitSlot(op);
+    instr.imm_u32x2_u8.fst = val1;
+    instr.imm_u32x2_u8.snd = val2;
+    instr.imm_u32x2_u8.idx = val3;
+    return;
+  }
+  Emit(op);
+  EmitInternal(val1);
+  EmitInternal(val2);
+  EmitInternal(val3);
+}
+
+void Istream::Emit(Opcode::Enum op, u32 val1, u32 val2, u32 val3) {
+  if (encoding_ == Encoding::FixedWidth) {
+    Instr& instr = EmitSlot(op);
+    instr.imm_u32x3.fst = val1;
+    instr.imm_u32x3.snd = val2;
+    instr.imm_u32x3.trd = val3;
+    return;
+  }
+  Emit(op);
+  EmitInternal(val1);
+  EmitInternal(val2);
+  EmitInternal(val3);
+}
+
+void Istream::Emit(Opcode::Enum op, u32 val1, u32 val2, u64 val3) {
+  if (encoding_ == Encoding::FixedWidth) {
+    Instr& instr = EmitSlot(op);
+    instr.imm_index_local_offset.memidx = val1;
+    instr.imm_index_local_offset.local = val2;
+    instr.imm_index_local_offset.offset = val3;
+    return;
+  }
   Emit(op);
   EmitInternal(val1);
   EmitInternal(val2);
@@ -77,12 +234,25 @@ void Istream::Emit(Opcode::Enum op, u32 val1, u32 val2, u8 val3) {
 }
 
 void Istream::Emit(Opcode::Enum op, u32 val1, u64 val2) {
+  if (encoding_ == Encoding::FixedWidth) {
+    Instr& instr = EmitSlot(op);
+    instr.imm_index_offset.memidx = val1;
+    instr.imm_index_offset.offset = val2;
+    return;
+  }
   Emit(op);
   EmitInternal(val1);
   EmitInternal(val2);
 }
 
 void Istream::Emit(Opcode::Enum op, u32 val1, u64 val2, u8 val3) {
+  if (encoding_ == Encoding::FixedWidth) {
+    Instr& instr = EmitSlot(op);
+    instr.imm_index_offset_lane.memidx = val1;
+    instr.imm_index_offset_lane.offset = val2;
+    instr.imm_index_offset_lane.lane = val3;
+    return;
+  }
   Emit(op);
   EmitInternal(val1);
   EmitInternal(val2);
@@ -107,7 +277,7 @@ void Istream::EmitCatchDrop(u32 drop) {
 
 Istream::Offset Istream::EmitFixupU32() {
   auto result = end();
-  EmitInternal(kInvalidOffset);
+  Emit(kInvalidOffset);
   return result;
 }
 
@@ -115,33 +285,46 @@ void Istream::ResolveFixupU32(Offset fixup_offset) {
   EmitAt(fixup_offset, end());
 }
 
+void Istream::ResolveFixupU32(Offset fixup_offset, u32 value) {
+  EmitAt(fixup_offset, value);
+}
+
 Istream::Offset Istream::end() const {
+  if (encoding_ == Encoding::FixedWidth) {
+    Offset slots_end = static_cast<Offset>(slots_.size() * sizeof(Instr));
+    if (slot_imm_pending_ > 0) {
+      // Point at the next immediate of the last instruction.
+      return slots_end - sizeof(Instr) + offsetof(Instr, imm_u32x2) +
+             slot_imm_written_;
+    }
+    return slots_end;
+  }
   return static_cast<u32>(data_.size());
 }
 
-template <typename T>
-T WABT_VECTORCALL Istream::ReadAt(Offset* offset) const {
-  assert(*offset + sizeof(T) <= data_.size());
-  T result;
-  memcpy(&result, data_.data() + *offset, sizeof(T));
-  *offset += sizeof(T);
-  return result;
+void Istream::Truncate(Offset offset) {
+  assert(offset <= end());
+  if (encoding_ == Encoding::FixedWidth) {
+    assert(slot_imm_pending_ == 0 && offset % sizeof(Instr) == 0);
+    slots_.resize(offset / sizeof(Instr));
+    return;
+  }
+  data_.resize(offset);
 }
 
-Instr Istream::Read(Offset* offset) const {
-  Instr instr;
-  instr.op = static_cast<Opcode::Enum>(ReadAt<SerializedOpcode>(offset));
+namespace {
 
-  switch (instr.op) {
+constexpr InstrKind GetInstrKind(Opcode::Enum op) {
+  switch (op) {
     case Opcode::Drop:
     case Opcode::Nop:
     case Opcode::Return:
     case Opcode::Unreachable:
     case Opcode::ThrowRef:
     case Opcode::RefNull:
+    case Opcode::InterpCheckEpoch:
       // 0 immediates, 0 operands.
-      instr.kind = InstrKind::Imm_0_Op_0;
-      break;
+      return InstrKind::Imm_0_Op_0;
 
     case Opcode::F32Abs:
     case Opcode::F32Ceil:
@@ -275,8 +458,7 @@ Instr Istream::Read(Offset* offset) const {
     case Opcode::I32X4RelaxedTruncF64X2SZero:
     case Opcode::I32X4RelaxedTruncF64X2UZero:
       // 0 immediates, 1 operand.
-      instr.kind = InstrKind::Imm_0_Op_1;
-      break;
+      return InstrKind::Imm_0_Op_1;
 
     case Opcode::F32Add:
     case Opcode::F32Copysign:
@@ -495,14 +677,14 @@ Instr Istream::Read(Offset* offset) const {
     case Opcode::I16X8RelaxedQ15mulrS:
     case Opcode::I16X8DotI8X16I7X16S:
       // 0 immediates, 2 operands
-      instr.kind = InstrKind::Imm_0_Op_2;
-      break;
+      return InstrKind::Imm_0_Op_2;
 
     case Opcode::I64Add128:
     case Opcode::I64Sub128:
     case Opcode::I64MulWideS:
     case Opcode::I64MulWideU:
-      assert(false);  // Unsupported
+      // Unsupported, never emitted.
+      [[fallthrough]];
 
     case Opcode::Select:
     case Opcode::SelectT:
@@ -516,30 +698,27 @@ Instr Istream::Read(Offset* offset) const {
     case Opcode::I64X2RelaxedLaneSelect:
     case Opcode::I32X4DotI8X16I7X16AddS:
       // 0 immediates, 3 operands
-      instr.kind = InstrKind::Imm_0_Op_3;
-      break;
+      return InstrKind::Imm_0_Op_3;
 
     case Opcode::Br:
       // Jump target immediate, 0 operands.
-      instr.kind = InstrKind::Imm_Jump_Op_0;
-      instr.imm_u32 = ReadAt<u32>(offset);
-      break;
+      return InstrKind::Imm_Jump_Op_0;
 
     case Opcode::BrIf:
     case Opcode::BrOnNonNull:
     case Opcode::BrOnNull:
     case Opcode::BrTable:
     case Opcode::InterpBrUnless:
+    case Opcode::InterpBrUnlessI32Eqz:
       // Jump target immediate, 1 operand.
-      instr.kind = InstrKind::Imm_Jump_Op_1;
-      instr.imm_u32 = ReadAt<u32>(offset);
-      break;
+      return InstrKind::Imm_Jump_Op_1;
+
+    case Opcode::InterpBrUnlessI32Eq:
+      // Jump target immediate, 2 operands.
+      return InstrKind::Imm_Jump_Op_2;
 
     case Opcode::GlobalGet:
     case Opcode::LocalGet:
-    case Opcode::InterpLocalGetRef:
-    case Opcode::InterpGlobalGetRef:
-    case Opcode::InterpMarkRef:
     case Opcode::MemorySize:
     case Opcode::TableSize:
     case Opcode::DataDrop:
@@ -548,9 +727,7 @@ Instr Istream::Read(Offset* offset) const {
     case Opcode::Throw:
     case Opcode::Rethrow:
       // Index immediate, 0 operands.
-      instr.kind = InstrKind::Imm_Index_Op_0;
-      instr.imm_u32 = ReadAt<u32>(offset);
-      break;
+      return InstrKind::Imm_Index_Op_0;
 
     case Opcode::GlobalSet:
     case Opcode::LocalSet:
@@ -558,47 +735,33 @@ Instr Istream::Read(Offset* offset) const {
     case Opcode::MemoryGrow:
     case Opcode::TableGet:
       // Index immediate, 1 operand.
-      instr.kind = InstrKind::Imm_Index_Op_1;
-      instr.imm_u32 = ReadAt<u32>(offset);
-      break;
+      return InstrKind::Imm_Index_Op_1;
 
     case Opcode::TableSet:
     case Opcode::TableGrow:
       // Index immediate, 2 operands.
-      instr.kind = InstrKind::Imm_Index_Op_2;
-      instr.imm_u32 = ReadAt<u32>(offset);
-      break;
+      return InstrKind::Imm_Index_Op_2;
 
     case Opcode::MemoryFill:
     case Opcode::TableFill:
       // Index immediate, 3 operands.
-      instr.kind = InstrKind::Imm_Index_Op_3;
-      instr.imm_u32 = ReadAt<u32>(offset);
-      break;
+      return InstrKind::Imm_Index_Op_3;
 
     case Opcode::Call:
     case Opcode::InterpCallImport:
-      instr.kind = InstrKind::Imm_Index_Op_N;
-      instr.imm_u32 = ReadAt<u32>(offset);
-      break;
+      return InstrKind::Imm_Index_Op_N;
 
     case Opcode::CallIndirect:
     case Opcode::ReturnCallIndirect:
       // Index immediate, N operands.
-      instr.kind = InstrKind::Imm_Index_Index_Op_N;
-      instr.imm_u32x2.fst = ReadAt<u32>(offset);
-      instr.imm_u32x2.snd = ReadAt<u32>(offset);
-      break;
+      return InstrKind::Imm_Index_Index_Op_N;
 
     case Opcode::MemoryInit:
     case Opcode::TableInit:
     case Opcode::MemoryCopy:
     case Opcode::TableCopy:
       // Index + index immediates, 3 operands.
-      instr.kind = InstrKind::Imm_Index_Index_Op_3;
-      instr.imm_u32x2.fst = ReadAt<u32>(offset);
-      instr.imm_u32x2.snd = ReadAt<u32>(offset);
-      break;
+      return InstrKind::Imm_Index_Index_Op_3;
 
     case Opcode::F32Load:
     case Opcode::F64Load:
@@ -635,10 +798,7 @@ Instr Istream::Read(Offset* offset) const {
     case Opcode::V128Load32Zero:
     case Opcode::V128Load64Zero:
       // Index + memory offset immediates, 1 operand.
-      instr.kind = InstrKind::Imm_Index_Offset_Op_1;
-      instr.imm_index_offset.memidx = ReadAt<u32>(offset);
-      instr.imm_index_offset.offset = ReadAt<u64>(offset);
-      break;
+      return InstrKind::Imm_Index_Offset_Op_1;
 
     case Opcode::MemoryAtomicNotify:
     case Opcode::F32Store:
@@ -701,10 +861,7 @@ Instr Istream::Read(Offset* offset) const {
     case Opcode::I64Store8:
     case Opcode::V128Store:
       // Index and memory offset immediates, 2 operands.
-      instr.kind = InstrKind::Imm_Index_Offset_Op_2;
-      instr.imm_index_offset.memidx = ReadAt<u32>(offset);
-      instr.imm_index_offset.offset = ReadAt<u64>(offset);
-      break;
+      return InstrKind::Imm_Index_Offset_Op_2;
 
     case Opcode::V128Load8Lane:
     case Opcode::V128Load16Lane:
@@ -715,11 +872,7 @@ Instr Istream::Read(Offset* offset) const {
     case Opcode::V128Store32Lane:
     case Opcode::V128Store64Lane:
       // Index, memory offset, lane index immediates, 2 operands.
-      instr.kind = InstrKind::Imm_Index_Offset_Lane_Op_2;
-      instr.imm_index_offset_lane.memidx = ReadAt<u32>(offset);
-      instr.imm_index_offset_lane.offset = ReadAt<u64>(offset);
-      instr.imm_index_offset_lane.lane = ReadAt<u8>(offset);
-      break;
+      return InstrKind::Imm_Index_Offset_Lane_Op_2;
 
     case Opcode::I32AtomicRmw16CmpxchgU:
     case Opcode::I32AtomicRmw8CmpxchgU:
@@ -731,45 +884,33 @@ Instr Istream::Read(Offset* offset) const {
     case Opcode::MemoryAtomicWait32:
     case Opcode::MemoryAtomicWait64:
       // Index and memory offset immediates, 3 operands.
-      instr.kind = InstrKind::Imm_Index_Offset_Op_3;
-      instr.imm_index_offset.memidx = ReadAt<u32>(offset);
-      instr.imm_index_offset.offset = ReadAt<u64>(offset);
-      break;
+      return InstrKind::Imm_Index_Offset_Op_3;
 
     case Opcode::AtomicFence:
     case Opcode::I32Const:
     case Opcode::InterpAlloca:
     case Opcode::InterpCatchDrop:
     case Opcode::InterpAdjustFrameForReturnCall:
+    case Opcode::InterpConsumeFuel:
+    case Opcode::InterpCheckFuel:
       // i32/f32 immediate, 0 operands.
-      instr.kind = InstrKind::Imm_I32_Op_0;
-      instr.imm_u32 = ReadAt<u32>(offset);
-      break;
+      return InstrKind::Imm_I32_Op_0;
 
     case Opcode::I64Const:
       // i64 immediate, 0 operands.
-      instr.kind = InstrKind::Imm_I64_Op_0;
-      instr.imm_u64 = ReadAt<u64>(offset);
-      break;
+      return InstrKind::Imm_I64_Op_0;
 
     case Opcode::F32Const:
       // f32 immediate, 0 operands.
-      instr.kind = InstrKind::Imm_F32_Op_0;
-      instr.imm_f32 = ReadAt<f32>(offset);
-      break;
+      return InstrKind::Imm_F32_Op_0;
 
     case Opcode::F64Const:
       // f64 immediate, 0 operands.
-      instr.kind = InstrKind::Imm_F64_Op_0;
-      instr.imm_f64 = ReadAt<f64>(offset);
-      break;
+      return InstrKind::Imm_F64_Op_0;
 
     case Opcode::InterpDropKeep:
       // i32 and i32 immediates, 0 operands.
-      instr.kind = InstrKind::Imm_I32_I32_Op_0;
-      instr.imm_u32x2.fst = ReadAt<u32>(offset);
-      instr.imm_u32x2.snd = ReadAt<u32>(offset);
-      break;
+      return InstrKind::Imm_I32_I32_Op_0;
 
     case Opcode::I8X16ExtractLaneS:
     case Opcode::I8X16ExtractLaneU:
@@ -780,9 +921,7 @@ Instr Istream::Read(Offset* offset) const {
     case Opcode::F32X4ExtractLane:
     case Opcode::F64X2ExtractLane:
       // u8 immediate, 1 operand.
-      instr.kind = InstrKind::Imm_I8_Op_1;
-      instr.imm_u8 = ReadAt<u8>(offset);
-      break;
+      return InstrKind::Imm_I8_Op_1;
 
     case Opcode::I8X16ReplaceLane:
     case Opcode::I16X8ReplaceLane:
@@ -791,27 +930,38 @@ Instr Istream::Read(Offset* offset) const {
     case Opcode::F32X4ReplaceLane:
     case Opcode::F64X2ReplaceLane:
       // u8 immediate, 2 operands.
-      instr.kind = InstrKind::Imm_I8_Op_2;
-      instr.imm_u8 = ReadAt<u8>(offset);
-      break;
+      return InstrKind::Imm_I8_Op_2;
 
     case Opcode::V128Const:
       // v128 immediate, 0 operands.
-      instr.kind = InstrKind::Imm_V128_Op_0;
-      instr.imm_v128 = ReadAt<v128>(offset);
-      break;
+      return InstrKind::Imm_V128_Op_0;
 
     case Opcode::I8X16Shuffle:
       // v128 immediate, 2 operands.
-      instr.kind = InstrKind::Imm_V128_Op_2;
-      instr.imm_v128 = ReadAt<v128>(offset);
-      break;
+      return InstrKind::Imm_V128_Op_2;
 
     case Opcode::CallRef:
     case Opcode::ReturnCallRef:
       // 0 immediates, 1 operand (the callee reference).
-      instr.kind = InstrKind::Imm_0_Op_1;
-      break;
+      return InstrKind::Imm_0_Op_1;
+
+    case Opcode::InterpI32AddLocals:
+      // Two local index immediates, 0 operands.
+      return InstrKind::Imm_Index_Index_Op_0;
+
+    case Opcode::InterpI32AddLocalConst:
+    case Opcode::InterpI32AndLocalConst:
+      // Local index and i32 immediates, 0 operands.
+      return InstrKind::Imm_Index_I32_Op_0;
+
+    case Opcode::InterpI32AddLocalConstSet:
+      // Local index, i32 and local index immediates, 0 operands.
+      return InstrKind::Imm_Index_I32_Index_Op_0;
+
+    case Opcode::InterpI32LoadLocal:
+    case Opcode::InterpI32Load8ULocal:
+      // Memory index, local index and offset immediates, 0 operands.
+      return InstrKind::Imm_Index_Index_Offset_Op_0;
 
     case Opcode::Block:
     case Opcode::Catch:
@@ -827,13 +977,24 @@ Instr Istream::Read(Offset* offset) const {
     case Opcode::TryTable:
     case Opcode::ReturnCall:
       // Not used.
-      break;
+      return InstrKind::Imm_0_Op_0;
   }
-  return instr;
+  WABT_UNREACHABLE;
 }
 
+template <size_t... Is>
+constexpr std::array<InstrKind, sizeof...(Is)> MakeInstrKindTable(
+    std::index_sequence<Is...>) {
+  return {{GetInstrKind(static_cast<Opcode::Enum>(Is))...}};
+}
+
+}  // end anonymous namespace
+
+constinit const std::array<InstrKind, Opcode::Invalid + 1> Istream::kInstrKinds =
+    MakeInstrKindTable(std::make_index_sequence<Opcode::Invalid + 1>());
+
 void Istream::Disassemble(Stream* stream) const {
-  Disassemble(stream, 0, data_.size());
+  Disassemble(stream, 0, end());
 }
 
 std::string Istream::DisassemblySource::Header(Offset offset) {
@@ -851,7 +1012,7 @@ Istream::Offset Istream::Disassemble(Stream* stream, Offset offset) const {
 
 void Istream::Disassemble(Stream* stream, Offset from, Offset to) const {
   DisassemblySource source;
-  assert(from <= data_.size() && to <= data_.size() && from <= to);
+  assert(from <= end() && to <= end() && from <= to);
 
   Offset pc = from;
   while (pc < to) {
@@ -895,6 +1056,12 @@ Istream::Offset Istream::Trace(Stream* stream,
                      source->Pick(1, instr).c_str());
       break;
 
+    case InstrKind::Imm_Jump_Op_2:
+      stream->Writef(" @%u, %s, %s\n", instr.imm_u32,
+                     source->Pick(2, instr).c_str(),
+                     source->Pick(1, instr).c_str());
+      break;
+
     case InstrKind::Imm_Index_Op_0:
       stream->Writef(" $%u\n", instr.imm_u32);
       break;
@@ -1007,6 +1174,26 @@ Istream::Offset Istream::Trace(Stream* stream,
           instr.imm_v128.u32(0), instr.imm_v128.u32(1), instr.imm_v128.u32(2),
           instr.imm_v128.u32(3));
       break;
+
+    case InstrKind::Imm_Index_Index_Op_0:
+      stream->Writef(" $%u, $%u\n", instr.imm_u32x2.fst, instr.imm_u32x2.snd);
+      break;
+
+    case InstrKind::Imm_Index_I32_Op_0:
+      stream->Writef(" $%u, %u\n", instr.imm_u32x2.fst, instr.imm_u32x2.snd);
+      break;
+
+    case InstrKind::Imm_Index_I32_Index_Op_0:
+      stream->Writef(" $%u, %u, $%u\n", instr.imm_u32x3.fst,
+                     instr.imm_u32x3.snd, instr.imm_u32x3.trd);
+      break;
+
+    case InstrKind::Imm_Index_Index_Offset_Op_0:
+      stream->Writef(" $%u:$%u+$%" PRIu64 "\n",
+                     instr.imm_index_local_offset.memidx,
+                     instr.imm_index_local_offset.local,
+                     instr.imm_index_local_offset.offset);
+      break;
   }
   return offset;
 }
@@ -387,6 +387,17 @@ bool Opcode::IsEnabled(const Features& features) const {
     case Opcode::InterpCallImport:
     case Opcode::InterpData:
     case Opcode::InterpDropKeep:
+    case Opcode::InterpConsumeFuel:
+    case Opcode::InterpCheckFuel:
+    case Opcode::InterpCheckEpoch:
+    case Opcode::InterpBrUnlessI32Eqz:
+    case Opcode::InterpBrUnlessI32Eq:
+    case Opcode::InterpI32LoadLocal:
+    case Opcode::InterpI32Load8ULocal:
+    case Opcode::InterpI32AddLocals:
+    case Opcode::InterpI32AddLocalConst:
+    case Opcode::InterpI32AddLocalConstSet:
+    case Opcode::InterpI32AndLocalConst:
       return false;
 
     default:
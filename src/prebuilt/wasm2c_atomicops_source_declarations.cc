@@ -487,6 +487,100 @@ R"w2c_template(DEFINE_ATOMIC_CMP_XCHG(i64_atomic_rmw32_cmpxchg_u, u64, u32);
 R"w2c_template(DEFINE_ATOMIC_CMP_XCHG(i64_atomic_rmw_cmpxchg, u64, u64);
 )w2c_template"
 R"w2c_template(
+// Wait and notify don't access the memory in the Wasm thread, so they can't
+)w2c_template"
+R"w2c_template(// rely on guard pages to trap out-of-bounds accesses. The runtime must not
+)w2c_template"
+R"w2c_template(// fault either, since it accesses the memory with a lock held.
+)w2c_template"
+R"w2c_template(#define DEFINE_ATOMIC_WAIT(name, rt_name, t)                                  \
+)w2c_template"
+R"w2c_template(  static inline u32 name##_unchecked(uint8_t* const wasm_rt_local_memory_base, \
+)w2c_template"
+R"w2c_template(                                     wasm_rt_memory_t* mem, u64 addr,          \
+)w2c_template"
+R"w2c_template(                                     t expected, s64 timeout) {                \
+)w2c_template"
+R"w2c_template(    RANGE_CHECK(mem, addr, sizeof(t));                                         \
+)w2c_template"
+R"w2c_template(    ATOMIC_ALIGNMENT_CHECK(addr, t);                                           \
+)w2c_template"
+R"w2c_template(    TRAP(UNSHARED_WAIT);                                                       \
+)w2c_template"
+R"w2c_template(  }                                                                            \
+)w2c_template"
+R"w2c_template(  DEF_MEM_CHECKS2(name, _, t, return, u32, t, s64)                             \
+)w2c_template"
+R"w2c_template(  static inline u32 name##_shared_unchecked(                                   \
+)w2c_template"
+R"w2c_template(      uint8_t* const wasm_rt_local_memory_base, wasm_rt_shared_memory_t* mem,  \
+)w2c_template"
+R"w2c_template(      u64 addr, t expected, s64 timeout) {                                     \
+)w2c_template"
+R"w2c_template(    RANGE_CHECK(mem, addr, sizeof(t));                                         \
+)w2c_template"
+R"w2c_template(    ATOMIC_ALIGNMENT_CHECK(addr, t);                                           \
+)w2c_template"
+R"w2c_template(    return rt_name((_Atomic volatile t*)MEM_ADDR(mem, addr, sizeof(t)),        \
+)w2c_template"
+R"w2c_template(                   expected, timeout);                                         \
+)w2c_template"
+R"w2c_template(  }                                                                            \
+)w2c_template"
+R"w2c_template(  DEF_MEM_CHECKS2(name##_shared, _shared_, t, return, u32, t, s64)
+)w2c_template"
+R"w2c_template(
+DEFINE_ATOMIC_WAIT(memory_atomic_wait32, wasm_rt_atomic_wait32, u32)
+)w2c_template"
+R"w2c_template(DEFINE_ATOMIC_WAIT(memory_atomic_wait64, wasm_rt_atomic_wait64, u64)
+)w2c_template"
+R"w2c_template(
+static inline u32 memory_atomic_notify_unchecked(
+)w2c_template"
+R"w2c_template(    uint8_t* const wasm_rt_local_memory_base,
+)w2c_template"
+R"w2c_template(    wasm_rt_memory_t* mem,
+)w2c_template"
+R"w2c_template(    u64 addr,
+)w2c_template"
+R"w2c_template(    u32 count) {
+)w2c_template"
+R"w2c_template(  RANGE_CHECK(mem, addr, sizeof(u32));
+)w2c_template"
+R"w2c_template(  ATOMIC_ALIGNMENT_CHECK(addr, u32);
+)w2c_template"
+R"w2c_template(  /* No thread can wait on an unshared memory. */
+)w2c_template"
+R"w2c_template(  return 0;
+)w2c_template"
+R"w2c_template(}
+)w2c_template"
+R"w2c_template(DEF_MEM_CHECKS1(memory_atomic_notify, _, u32, return, u32, u32)
+)w2c_template"
+R"w2c_template(
+static inline u32 memory_atomic_notify_shared_unchecked(
+)w2c_template"
+R"w2c_template(    uint8_t* const wasm_rt_local_memory_base,
+)w2c_template"
+R"w2c_template(    wasm_rt_shared_memory_t* mem,
+)w2c_template"
+R"w2c_template(    u64 addr,
+)w2c_template"
+R"w2c_template(    u32 count) {
+)w2c_template"
+R"w2c_template(  RANGE_CHECK(mem, addr, sizeof(u32));
+)w2c_template"
+R"w2c_template(  ATOMIC_ALIGNMENT_CHECK(addr, u32);
+)w2c_template"
+R"w2c_template(  return wasm_rt_atomic_notify((volatile void*)MEM_ADDR(mem, addr, sizeof(u32)),
+)w2c_template"
+R"w2c_template(                               count);
+)w2c_template"
+R"w2c_template(}
+)w2c_template"
+R"w2c_template(DEF_MEM_CHECKS1(memory_atomic_notify_shared, _shared_, u32, return, u32, u32)
+)w2c_template"
+R"w2c_template(
 #define atomic_fence() atomic_thread_fence(memory_order_seq_cst)
 )w2c_template"
 ;
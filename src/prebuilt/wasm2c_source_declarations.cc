@@ -176,7 +176,11 @@ R"w2c_template(#define W2C_COLD_FUNC
 R"w2c_template(#endif
 )w2c_template"
 R"w2c_template(
-W2C_COLD_FUNC static bool func_types_eq_slowpath(
+// Function types are interned, so this is only reached if the types differ,
+)w2c_template"
+R"w2c_template(// or for a function whose type the host did not intern.
+)w2c_template"
+R"w2c_template(W2C_COLD_FUNC static bool func_types_eq_slowpath(
 )w2c_template"
 R"w2c_template(    const wasm_rt_funcref_table_t* table,
 )w2c_template"
@@ -1312,7 +1316,7 @@ typedef struct {
 )w2c_template"
 R"w2c_template(  wasm_elem_segment_expr_type_t expr_type;
 )w2c_template"
-R"w2c_template(  wasm_rt_func_type_t type;
+R"w2c_template(  const wasm_rt_func_type_t* type;
 )w2c_template"
 R"w2c_template(  wasm_rt_function_ptr_t func;
 )w2c_template"
@@ -1355,7 +1359,7 @@ R"w2c_template(      case RefFunc:
 )w2c_template"
 R"w2c_template(        *dest_val = (wasm_rt_funcref_t){
 )w2c_template"
-R"w2c_template(            src_expr->type, src_expr->func, src_expr->func_tailcallee,
+R"w2c_template(            *src_expr->type, src_expr->func, src_expr->func_tailcallee,
 )w2c_template"
 R"w2c_template(            (char*)module_instance + src_expr->module_offset};
 )w2c_template"
@@ -1497,23 +1501,15 @@ DEFINE_TABLE_FILL(funcref)
 R"w2c_template(DEFINE_TABLE_FILL(externref)
 )w2c_template"
 R"w2c_template(
-#if defined(__GNUC__) || defined(__clang__)
-)w2c_template"
-R"w2c_template(#define FUNC_TYPE_DECL_EXTERN_T(x) extern const char* const x
-)w2c_template"
-R"w2c_template(#define FUNC_TYPE_EXTERN_T(x) const char* const x
+// Function types are set to their interned values when the module is first
 )w2c_template"
-R"w2c_template(#define FUNC_TYPE_T(x) static const char* const x
+R"w2c_template(// instantiated, so that call_indirect can compare them as pointers.
 )w2c_template"
-R"w2c_template(#else
-)w2c_template"
-R"w2c_template(#define FUNC_TYPE_DECL_EXTERN_T(x) extern const char x[]
+R"w2c_template(#define FUNC_TYPE_DECL_EXTERN_T(x) extern wasm_rt_func_type_t x
 )w2c_template"
-R"w2c_template(#define FUNC_TYPE_EXTERN_T(x) const char x[]
+R"w2c_template(#define FUNC_TYPE_EXTERN_T(x) wasm_rt_func_type_t x
 )w2c_template"
-R"w2c_template(#define FUNC_TYPE_T(x) static const char x[]
-)w2c_template"
-R"w2c_template(#endif
+R"w2c_template(#define FUNC_TYPE_T(x) static wasm_rt_func_type_t x
 )w2c_template"
 R"w2c_template(
 #if (__STDC_VERSION__ < 201112L) && !defined(static_assert)
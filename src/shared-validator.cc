@@ -37,6 +37,29 @@ SharedValidator::SharedValidator(Errors* errors,
       [this](const char* msg) { OnTypecheckerError(msg); });
 }
 
+SharedValidator::SharedValidator(const SharedValidator& other, Errors* errors)
+    : options_(other.options_),
+      errors_(errors),
+      filename_(other.filename_),
+      typechecker_(other.options_.features, func_types_),
+      num_types_(other.num_types_),
+      func_types_(other.func_types_),
+      struct_types_(other.struct_types_),
+      array_types_(other.array_types_),
+      funcs_(other.funcs_),
+      tables_(other.tables_),
+      memories_(other.memories_),
+      globals_(other.globals_),
+      tags_(other.tags_),
+      elems_(other.elems_),
+      starts_(other.starts_),
+      num_imported_globals_(other.num_imported_globals_),
+      data_segments_(other.data_segments_),
+      declared_funcs_(other.declared_funcs_) {
+  typechecker_.set_error_callback(
+      [this](const char* msg) { OnTypecheckerError(msg); });
+}
+
 void WABT_PRINTF_FORMAT(3, 4) SharedValidator::PrintError(const Location& loc,
                                                           const char* format,
                                                           ...) {
@@ -394,9 +417,18 @@ Result SharedValidator::EndModule() {
   for (Var func_var : check_declared_funcs_) {
     result |= CheckDeclaredFunc(func_var);
   }
+  check_declared_funcs_.clear();
+  module_ended_ = true;
   return result;
 }
 
+void SharedValidator::MergeDeferredChecks(SharedValidator* other) {
+  check_declared_funcs_.insert(check_declared_funcs_.end(),
+                               other->check_declared_funcs_.begin(),
+                               other->check_declared_funcs_.end());
+  other->check_declared_funcs_.clear();
+}
+
 Result SharedValidator::CheckIndex(Var var, Index max_index, const char* desc) {
   if (var.index() >= max_index) {
     PrintError(var.loc,
@@ -1190,6 +1222,8 @@ Result SharedValidator::OnRefFunc(const Location& loc, Var func_var) {
     // opposed to references in function bodies that are considered usages.
     if (in_init_expr_) {
       declared_funcs_.insert(func_var.index());
+    } else if (module_ended_) {
+      result |= CheckDeclaredFunc(func_var);
     } else {
       check_declared_funcs_.push_back(func_var);
     }
@@ -94,6 +94,8 @@ static inline void wasm_rt_segue_write_base(void* base) {
 #define W2C_COLD_FUNC
 #endif
 
+// Function types are interned, so this is only reached if the types differ,
+// or for a function whose type the host did not intern.
 W2C_COLD_FUNC static bool func_types_eq_slowpath(
     const wasm_rt_funcref_table_t* table,
     const wasm_rt_func_type_t expected_type,
@@ -699,7 +701,7 @@ typedef enum { RefFunc, RefNull, GlobalGet } wasm_elem_segment_expr_type_t;
 
 typedef struct {
   wasm_elem_segment_expr_type_t expr_type;
-  wasm_rt_func_type_t type;
+  const wasm_rt_func_type_t* type;
   wasm_rt_function_ptr_t func;
   wasm_rt_tailcallee_t func_tailcallee;
   size_t module_offset;
@@ -721,7 +723,7 @@ static inline void funcref_table_init(wasm_rt_funcref_table_t* dest,
     switch (src_expr->expr_type) {
       case RefFunc:
         *dest_val = (wasm_rt_funcref_t){
-            src_expr->type, src_expr->func, src_expr->func_tailcallee,
+            *src_expr->type, src_expr->func, src_expr->func_tailcallee,
             (char*)module_instance + src_expr->module_offset};
         break;
       case RefNull:
@@ -797,15 +799,11 @@ DEFINE_TABLE_SET(externref)
 DEFINE_TABLE_FILL(funcref)
 DEFINE_TABLE_FILL(externref)
 
-#if defined(__GNUC__) || defined(__clang__)
-#define FUNC_TYPE_DECL_EXTERN_T(x) extern const char* const x
-#define FUNC_TYPE_EXTERN_T(x) const char* const x
-#define FUNC_TYPE_T(x) static const char* const x
-#else
-#define FUNC_TYPE_DECL_EXTERN_T(x) extern const char x[]
-#define FUNC_TYPE_EXTERN_T(x) const char x[]
-#define FUNC_TYPE_T(x) static const char x[]
-#endif
+// Function types are set to their interned values when the module is first
+// instantiated, so that call_indirect can compare them as pointers.
+#define FUNC_TYPE_DECL_EXTERN_T(x) extern wasm_rt_func_type_t x
+#define FUNC_TYPE_EXTERN_T(x) wasm_rt_func_type_t x
+#define FUNC_TYPE_T(x) static wasm_rt_func_type_t x
 
 #if (__STDC_VERSION__ < 201112L) && !defined(static_assert)
 #define static_assert(X) \
@@ -0,0 +1,138 @@
+/*
+ * Copyright 2026 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "wabt/arena.h"
+#include "wabt/binary-reader-ir.h"
+#include "wabt/binary-reader.h"
+#include "wabt/ir.h"
+
+using namespace wabt;
+
+namespace {
+
+struct TestObject : ArenaAllocated<TestObject> {
+  static int live_count;
+
+  explicit TestObject(int data) : data(data) { ++live_count; }
+  ~TestObject() { --live_count; }
+
+  int data;
+};
+
+int TestObject::live_count = 0;
+
+bool IsAligned(const void* p) {
+  return reinterpret_cast<uintptr_t>(p) % Arena::kAlignment == 0;
+}
+
+}  // end anonymous namespace
+
+TEST(Arena, Allocate) {
+  Arena arena;
+  EXPECT_EQ(0u, arena.capacity());
+  char* a = static_cast<char*>(arena.Allocate(1));
+  char* b = static_cast<char*>(arena.Allocate(3));
+  EXPECT_TRUE(IsAligned(a));
+  EXPECT_TRUE(IsAligned(b));
+  EXPECT_EQ(a + Arena::kAlignment, b);
+  size_t capacity = arena.capacity();
+  EXPECT_GT(capacity, 0u);
+
+  // A large allocation gets a block of its own, and doesn't disturb the
+  // current one.
+  arena.Allocate(1024 * 1024);
+  EXPECT_EQ(capacity + 1024 * 1024, arena.capacity());
+  char* c = static_cast<char*>(arena.Allocate(1));
+  EXPECT_EQ(b + Arena::kAlignment, c);
+}
+
+TEST(Arena, Scope) {
+  EXPECT_EQ(nullptr, Arena::current());
+  Arena outer;
+  Arena inner;
+  {
+    Arena::Scope outer_scope(&outer);
+    EXPECT_EQ(&outer, Arena::current());
+    {
+      Arena::Scope inner_scope(&inner);
+      EXPECT_EQ(&inner, Arena::current());
+    }
+    EXPECT_EQ(&outer, Arena::current());
+  }
+  EXPECT_EQ(nullptr, Arena::current());
+}
+
+TEST(Arena, ArenaAllocated) {
+  Arena arena;
+  std::vector<std::unique_ptr<TestObject>> objects;
+  objects.push_back(std::make_unique<TestObject>(1));
+  EXPECT_EQ(0u, arena.capacity());
+  {
+    Arena::Scope scope(&arena);
+    for (int i = 2; i <= 100; ++i) {
+      objects.push_back(std::make_unique<TestObject>(i));
+    }
+  }
+  objects.push_back(std::make_unique<TestObject>(101));
+  EXPECT_GT(arena.capacity(), 0u);
+  EXPECT_EQ(101, TestObject::live_count);
+  for (size_t i = 0; i < objects.size(); ++i) {
+    EXPECT_TRUE(IsAligned(objects[i].get()));
+    EXPECT_EQ(static_cast<int>(i + 1), objects[i]->data);
+  }
+
+  // Objects from the heap and the arena can be deleted in any order, and
+  // their destructors always run.
+  objects.erase(objects.begin() + 50);
+  objects.erase(objects.begin());
+  objects.pop_back();
+  EXPECT_EQ(98, TestObject::live_count);
+  objects.clear();
+  EXPECT_EQ(0, TestObject::live_count);
+}
+
+TEST(Arena, ReadBinaryIr) {
+  // (module (func (result i32) i32.const 1 i32.const 2 i32.add))
+  const uint8_t data[] = {
+      0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x05, 0x01,
+      0x60, 0x00, 0x01, 0x7f, 0x03, 0x02, 0x01, 0x00, 0x0a, 0x09, 0x01,
+      0x07, 0x00, 0x41, 0x01, 0x41, 0x02, 0x6a, 0x0b,
+  };
+  for (int num_threads : {1, 2}) {
+    Errors errors;
+    Module module;
+    ReadBinaryOptions options;
+    options.num_threads = num_threads;
+    ASSERT_EQ(Result::Ok, ReadBinaryIr("test", data, sizeof(data), options,
+                                       &errors, &module));
+    ASSERT_FALSE(module.arenas.empty());
+    ASSERT_EQ(1u, module.funcs.size());
+    EXPECT_EQ(3u, module.funcs[0]->exprs.size());
+
+    // The module can be moved; it takes its arenas along.
+    Module moved = std::move(module);
+    EXPECT_TRUE(module.arenas.empty());
+    EXPECT_EQ(3u, moved.funcs[0]->exprs.size());
+    moved.funcs[0]->exprs.pop_back();
+    EXPECT_EQ(2u, moved.funcs[0]->exprs.size());
+  }
+}
@@ -16,10 +16,15 @@
 
 #include "gtest/gtest.h"
 
+#include <chrono>
+#include <cinttypes>
+#include <thread>
+
 #include "wabt/binary-reader.h"
 #include "wabt/error-formatter.h"
 
 #include "wabt/interp/binary-reader-interp.h"
+#include "wabt/interp/interp-profile.h"
 #include "wabt/interp/interp.h"
 
 using namespace wabt;
@@ -30,8 +35,9 @@ class InterpTest : public ::testing::Test {
   void ReadModule(const std::vector<u8>& data) {
     Errors errors;
     ReadBinaryOptions options;
-    Result result =
-        ReadBinaryInterp("<internal>", data, options, &errors, &module_desc_);
+    options.features = store_.features();
+    Result result = ReadBinaryInterp("<internal>", data, options,
+                                     compile_options_, &errors, &module_desc_);
     ASSERT_EQ(Result::Ok, result)
         << FormatErrorsToString(errors, Location::Type::Binary);
   }
@@ -54,6 +60,7 @@ class InterpTest : public ::testing::Test {
   }
 
   Store store_;
+  CompileOptions compile_options_;
   ModuleDesc module_desc_;
   Module::Ptr mod_;
   Instance::Ptr inst_;
@@ -129,6 +136,25 @@ const std::vector<u8> s_fac_module = {
     0x00, 0x41, 0x01, 0x6b, 0x21, 0x00, 0x0c, 0x00, 0x0b, 0x0b,
 };
 
+// (func (export "f") (loop (br 0)))
+const std::vector<u8> s_infinite_loop_module = {
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x04, 0x01,
+    0x60, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 0x07, 0x05, 0x01, 0x01,
+    0x66, 0x00, 0x00, 0x0a, 0x09, 0x01, 0x07, 0x00, 0x03, 0x40, 0x0c,
+    0x00, 0x0b, 0x0b,
+};
+
+// (func (export "ok") (result i32) (call $inner))
+// (func $inner (result i32) (i32.const 42))
+// (func (export "bad") (result i32) (i32.add (i32.const 1)))
+const std::vector<u8> s_invalid_func_module = {
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x05, 0x01,
+    0x60, 0x00, 0x01, 0x7f, 0x03, 0x04, 0x03, 0x00, 0x00, 0x00, 0x07,
+    0x0c, 0x02, 0x02, 0x6f, 0x6b, 0x00, 0x00, 0x03, 0x62, 0x61, 0x64,
+    0x00, 0x02, 0x0a, 0x11, 0x03, 0x04, 0x00, 0x10, 0x01, 0x0b, 0x04,
+    0x00, 0x41, 0x2a, 0x0b, 0x05, 0x00, 0x41, 0x01, 0x6a, 0x0b,
+};
+
 }  // namespace
 
 TEST_F(InterpTest, Disassemble) {
@@ -144,19 +170,18 @@ R"(   0| alloca 1
   16| local.set $2, %[-1]
   24| local.get $1
   32| local.get $3
-  40| i32.eqz %[-1]
-  44| br_unless @60, %[-1]
-  52| br @116
-  60| local.get $3
-  68| i32.mul %[-2], %[-1]
-  72| local.set $2, %[-1]
-  80| local.get $2
-  88| i32.const 1
-  96| i32.sub %[-2], %[-1]
- 100| local.set $3, %[-1]
- 108| br @24
- 116| drop_keep $2 $1
- 128| return
+  40| br_unless.i32.eqz @56, %[-1]
+  48| br @112
+  56| local.get $3
+  64| i32.mul %[-2], %[-1]
+  68| local.set $2, %[-1]
+  76| local.get $2
+  84| i32.const 1
+  92| i32.sub %[-2], %[-1]
+  96| local.set $3, %[-1]
+ 104| br @24
+ 112| drop_keep $2 $1
+ 124| return
 )");
 }
 
@@ -174,6 +199,267 @@ TEST_F(InterpTest, Fac) {
   EXPECT_EQ(120u, results[0].Get<u32>());
 }
 
+TEST_F(InterpTest, Fac_FixedWidth) {
+  module_desc_.istream = Istream(Istream::Encoding::FixedWidth);
+  ReadModule(s_fac_module);
+  Instantiate();
+  auto func = GetFuncExport(0);
+
+  Values results;
+  Trap::Ptr trap;
+  Result result = func->Call(store_, {Value::Make(5)}, results, &trap);
+
+  ASSERT_EQ(Result::Ok, result);
+  EXPECT_EQ(1u, results.size());
+  EXPECT_EQ(120u, results[0].Get<u32>());
+  EXPECT_EQ(0u, module_desc_.istream.end() % sizeof(Instr));
+}
+
+TEST_F(InterpTest, Fac_Lazy) {
+  compile_options_.lazy = true;
+  ReadModule(s_fac_module);
+  EXPECT_EQ(Istream::kInvalidOffset, module_desc_.funcs[0].code_offset);
+  Instantiate();
+  auto func = GetFuncExport(0);
+  EXPECT_FALSE(func->IsCompiled());
+
+  Values results;
+  Trap::Ptr trap;
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_EQ(Result::Ok,
+              func->Call(store_, {Value::Make(5)}, results, &trap));
+    EXPECT_EQ(120u, results[0].Get<u32>());
+    EXPECT_TRUE(func->IsCompiled());
+  }
+
+  // The body is compiled once per Module, and shared by its instances.
+  Istream::Offset end = mod_->desc().istream.end();
+  auto inst = Instance::Instantiate(store_, mod_.ref(), {}, &trap);
+  ASSERT_TRUE(inst);
+  auto other_func = store_.UnsafeGet<DefinedFunc>(inst->exports()[0]);
+  EXPECT_TRUE(other_func->IsCompiled());
+  ASSERT_EQ(Result::Ok,
+            other_func->Call(store_, {Value::Make(5)}, results, &trap));
+  EXPECT_EQ(120u, results[0].Get<u32>());
+  EXPECT_EQ(end, mod_->desc().istream.end());
+  EXPECT_EQ(func->desc().code_offset, other_func->desc().code_offset);
+}
+
+TEST_F(InterpTest, Lazy_InvalidFunc) {
+  compile_options_.lazy = true;
+  ReadModule(s_invalid_func_module);
+  Instantiate();
+
+  // Only the functions that are called are validated.
+  Values results;
+  Trap::Ptr trap;
+  ASSERT_EQ(Result::Ok, GetFuncExport(0)->Call(store_, {}, results, &trap));
+  EXPECT_EQ(42u, results[0].Get<u32>());
+
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_EQ(Result::Error,
+              GetFuncExport(1)->Call(store_, {}, results, &trap));
+    EXPECT_EQ("type mismatch in i32.add, expected [i32, i32] but got [i32]",
+              trap->message());
+    EXPECT_FALSE(GetFuncExport(1)->IsCompiled());
+  }
+}
+
+TEST_F(InterpTest, Lazy_UndeclaredRefFunc) {
+  // (func $declared)
+  // (func $undeclared)
+  // (func (export "declared") (result funcref) (ref.func $declared))
+  // (func (export "undeclared") (result funcref) (ref.func $undeclared))
+  // (elem declare func $declared)
+  const std::vector<u8> data = {
+      0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x08, 0x02, 0x60,
+      0x00, 0x00, 0x60, 0x00, 0x01, 0x70, 0x03, 0x05, 0x04, 0x00, 0x00, 0x01,
+      0x01, 0x07, 0x19, 0x02, 0x08, 0x64, 0x65, 0x63, 0x6c, 0x61, 0x72, 0x65,
+      0x64, 0x00, 0x02, 0x0a, 0x75, 0x6e, 0x64, 0x65, 0x63, 0x6c, 0x61, 0x72,
+      0x65, 0x64, 0x00, 0x03, 0x09, 0x05, 0x01, 0x03, 0x00, 0x01, 0x00, 0x0a,
+      0x11, 0x04, 0x02, 0x00, 0x0b, 0x02, 0x00, 0x0b, 0x04, 0x00, 0xd2, 0x00,
+      0x0b, 0x04, 0x00, 0xd2, 0x01, 0x0b,
+  };
+  compile_options_.lazy = true;
+  ReadModule(data);
+  Instantiate();
+
+  // The declarations are checked when a body is compiled, as they would be
+  // at the end of the module without CompileOptions::lazy.
+  Values results;
+  Trap::Ptr trap;
+  ASSERT_EQ(Result::Ok, GetFuncExport(0)->Call(store_, {}, results, &trap));
+  ASSERT_EQ(Result::Error, GetFuncExport(1)->Call(store_, {}, results, &trap));
+  EXPECT_EQ("function 1 is not declared in any elem sections",
+            trap->message());
+}
+
+TEST_F(InterpTest, Fac_ThreadPool) {
+  ReadModule(s_fac_module);
+  Instantiate();
+  auto func = GetFuncExport(0);
+
+  // Func::Call borrows a thread from the store's pool and gives it back.
+  std::unique_ptr<Thread> thread = store_.AcquireThread();
+  Thread* pooled = thread.get();
+  thread->SetEpochDeadline(0);
+  store_.ReleaseThread(std::move(thread));
+
+  for (int i = 0; i < 2; ++i) {
+    Values results;
+    Trap::Ptr trap;
+    ASSERT_EQ(Result::Ok,
+              func->Call(store_, {Value::Make(5)}, results, &trap));
+    EXPECT_EQ(120u, results[0].Get<u32>());
+  }
+
+  // The thread was reset when it was released.
+  thread = store_.AcquireThread();
+  EXPECT_EQ(pooled, thread.get());
+  EXPECT_EQ(Thread::Options::kNoEpochDeadline, thread->GetEpochDeadline());
+  store_.ReleaseThread(std::move(thread));
+}
+
+TEST_F(InterpTest, Fac_Fuel) {
+  compile_options_.meter_fuel = true;
+  ReadModule(s_fac_module);
+  Instantiate();
+  auto func = GetFuncExport(0);
+  const Values params = {Value::Make(5)};
+  Trap::Ptr trap;
+
+  Thread unlimited_thread(store_);
+  ASSERT_EQ(RunResult::Ok, unlimited_thread.PushCall(*func, params, &trap));
+  ASSERT_EQ(RunResult::Return, unlimited_thread.Run(&trap));
+  u64 cost = unlimited_thread.GetFuelConsumed();
+  EXPECT_GT(cost, 0u);
+
+  // Running out of fuel pauses the call, which resumes once it is refuelled.
+  // The total cost doesn't depend on how the fuel was given.
+  Thread::Options options;
+  options.fuel = 8;
+  Thread thread(store_, options);
+  ASSERT_EQ(RunResult::Ok, thread.PushCall(*func, params, &trap));
+  int pauses = 0;
+  RunResult result;
+  while ((result = thread.Run(&trap)) == RunResult::OutOfFuel) {
+    EXPECT_EQ(0u, thread.GetFuel());
+    EXPECT_EQ(RunResult::OutOfFuel, thread.Run(&trap));
+    thread.AddFuel(8);
+    ++pauses;
+  }
+  ASSERT_EQ(RunResult::Return, result);
+  EXPECT_GT(pauses, 1);
+  EXPECT_EQ(cost, thread.GetFuelConsumed());
+  Values results;
+  thread.PopResults(*func, &results);
+  ASSERT_EQ(1u, results.size());
+  EXPECT_EQ(120u, results[0].Get<u32>());
+
+  // A call made with Func::Call can't be resumed, so it traps.
+  Thread call_thread(store_, options);
+  ASSERT_EQ(Result::Error, func->Call(call_thread, params, results, &trap));
+  EXPECT_EQ("out of fuel", trap->message());
+}
+
+TEST_F(InterpTest, Fac_Epoch) {
+  compile_options_.epoch_interruption = true;
+  ReadModule(s_fac_module);
+  Instantiate();
+  auto func = GetFuncExport(0);
+  const Values params = {Value::Make(5)};
+  Trap::Ptr trap;
+
+  // A deadline that has already been reached interrupts the call at every
+  // check, and each interruption can be resumed.
+  Thread::Options options;
+  options.epoch_deadline = store_.epoch();
+  Thread thread(store_, options);
+  ASSERT_EQ(RunResult::Ok, thread.PushCall(*func, params, &trap));
+  int interrupts = 0;
+  RunResult result;
+  while ((result = thread.Run(&trap)) == RunResult::Interrupted) {
+    store_.IncrementEpoch();
+    thread.SetEpochDeadline(store_.epoch());
+    ++interrupts;
+  }
+  ASSERT_EQ(RunResult::Return, result);
+  EXPECT_GT(interrupts, 1);
+  Values results;
+  thread.PopResults(*func, &results);
+  ASSERT_EQ(1u, results.size());
+  EXPECT_EQ(120u, results[0].Get<u32>());
+
+  // A call made with Func::Call can't be resumed, so it traps.
+  Thread call_thread(store_, options);
+  ASSERT_EQ(Result::Error, func->Call(call_thread, params, results, &trap));
+  EXPECT_EQ("interrupted", trap->message());
+
+  // Without a deadline the epoch is ignored.
+  Thread unlimited_thread(store_);
+  ASSERT_EQ(Result::Ok, func->Call(unlimited_thread, params, results, &trap));
+}
+
+TEST_F(InterpTest, Fac_Profile) {
+  ReadModule(s_fac_module);
+  Instantiate();
+  auto func = GetFuncExport(0);
+
+  Profile profile;
+  Thread::Options options;
+  options.profile = &profile;
+  Thread thread(store_, options);
+  Values results;
+  Trap::Ptr trap;
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_EQ(Result::Ok,
+              func->Call(thread, {Value::Make(5)}, results, &trap));
+    EXPECT_EQ(120u, results[0].Get<u32>());
+  }
+
+  u64 count = profile.instruction_count();
+  EXPECT_GT(count, 0u);
+  EXPECT_EQ(2u, profile.GetOpcodeCount(Opcode::InterpAlloca));
+  EXPECT_EQ(10u, profile.GetOpcodeCount(Opcode::I32Mul));
+
+  auto funcs = profile.GetFuncStats();
+  ASSERT_EQ(1u, funcs.size());
+  EXPECT_EQ("fac", funcs[0].name);
+  EXPECT_EQ(2u, funcs[0].calls);
+  EXPECT_EQ(count, funcs[0].self);
+  EXPECT_EQ(count, funcs[0].total);
+
+  // The loop's back-edge is taken 5 times per call.
+  auto loops = profile.GetHotLoops(Profile::kDefaultMaxHotLoops);
+  ASSERT_EQ(1u, loops.size());
+  EXPECT_EQ(0u, loops[0].func);
+  EXPECT_EQ(10u, loops[0].iterations);
+
+  MemoryStream stream;
+  profile.WriteFoldedStacks(&stream);
+  auto buf = stream.ReleaseOutputBuffer();
+  ExpectBufferStrEq(*buf, StringPrintf("fac %" PRIu64 "\n", count).c_str());
+}
+
+TEST_F(InterpTest, InfiniteLoop_EpochFromOtherThread) {
+  compile_options_.epoch_interruption = true;
+  ReadModule(s_infinite_loop_module);
+  Instantiate();
+  auto func = GetFuncExport(0);
+  Trap::Ptr trap;
+
+  Thread::Options options;
+  options.epoch_deadline = store_.epoch() + 1;
+  Thread thread(store_, options);
+  ASSERT_EQ(RunResult::Ok, thread.PushCall(*func, {}, &trap));
+  std::thread ticker([this]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    store_.IncrementEpoch();
+  });
+  EXPECT_EQ(RunResult::Interrupted, thread.Run(&trap));
+  ticker.join();
+}
+
 TEST_F(InterpTest, Fac_Trace) {
   ReadModule(s_fac_module);
   Instantiate();
@@ -192,35 +478,32 @@ R"(#0.    0: V:1  | alloca 1
 #0.   16: V:3  | local.set $2, 1
 #0.   24: V:2  | local.get $1
 #0.   32: V:3  | local.get $3
-#0.   40: V:4  | i32.eqz 2
-#0.   44: V:4  | br_unless @60, 0
-#0.   60: V:3  | local.get $3
-#0.   68: V:4  | i32.mul 1, 2
-#0.   72: V:3  | local.set $2, 2
-#0.   80: V:2  | local.get $2
-#0.   88: V:3  | i32.const 1
-#0.   96: V:4  | i32.sub 2, 1
-#0.  100: V:3  | local.set $3, 1
-#0.  108: V:2  | br @24
+#0.   40: V:4  | br_unless.i32.eqz @56, 2
+#0.   56: V:3  | local.get $3
+#0.   64: V:4  | i32.mul 1, 2
+#0.   68: V:3  | local.set $2, 2
+#0.   76: V:2  | local.get $2
+#0.   84: V:3  | i32.const 1
+#0.   92: V:4  | i32.sub 2, 1
+#0.   96: V:3  | local.set $3, 1
+#0.  104: V:2  | br @24
 #0.   24: V:2  | local.get $1
 #0.   32: V:3  | local.get $3
-#0.   40: V:4  | i32.eqz 1
-#0.   44: V:4  | br_unless @60, 0
-#0.   60: V:3  | local.get $3
-#0.   68: V:4  | i32.mul 2, 1
-#0.   72: V:3  | local.set $2, 2
-#0.   80: V:2  | local.get $2
-#0.   88: V:3  | i32.const 1
-#0.   96: V:4  | i32.sub 1, 1
-#0.  100: V:3  | local.set $3, 0
-#0.  108: V:2  | br @24
+#0.   40: V:4  | br_unless.i32.eqz @56, 1
+#0.   56: V:3  | local.get $3
+#0.   64: V:4  | i32.mul 2, 1
+#0.   68: V:3  | local.set $2, 2
+#0.   76: V:2  | local.get $2
+#0.   84: V:3  | i32.const 1
+#0.   92: V:4  | i32.sub 1, 1
+#0.   96: V:3  | local.set $3, 0
+#0.  104: V:2  | br @24
 #0.   24: V:2  | local.get $1
 #0.   32: V:3  | local.get $3
-#0.   40: V:4  | i32.eqz 0
-#0.   44: V:4  | br_unless @60, 1
-#0.   52: V:3  | br @116
-#0.  116: V:3  | drop_keep $2 $1
-#0.  128: V:1  | return
+#0.   40: V:4  | br_unless.i32.eqz @56, 0
+#0.   48: V:3  | br @112
+#0.  112: V:3  | drop_keep $2 $1
+#0.  124: V:1  | return
 )");
 }
 
@@ -403,6 +686,173 @@ TEST_F(InterpTest, HostTrap) {
   ASSERT_EQ("boom", trap->message());
 }
 
+TEST_F(InterpTest, Memory_OutOfBounds) {
+  // (memory (export "mem") 1)
+  // (func (export "load") (param i32) (result i32)
+  //   (i32.load (local.get 0)))
+  ReadModule({
+      0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x06, 0x01,
+      0x60, 0x01, 0x7f, 0x01, 0x7f, 0x03, 0x02, 0x01, 0x00, 0x05, 0x03,
+      0x01, 0x00, 0x01, 0x07, 0x0e, 0x02, 0x03, 0x6d, 0x65, 0x6d, 0x02,
+      0x00, 0x04, 0x6c, 0x6f, 0x61, 0x64, 0x00, 0x00, 0x0a, 0x09, 0x01,
+      0x07, 0x00, 0x20, 0x00, 0x28, 0x02, 0x00, 0x0b,
+  });
+  Instantiate();
+  auto memory = store_.UnsafeGet<Memory>(inst_->exports()[0]);
+  auto func = GetFuncExport(1);
+
+  auto load = [&](u32 offset, Trap::Ptr* trap) {
+    Values results;
+    Result result = func->Call(store_, {Value::Make(offset)}, results, trap);
+    return Succeeded(result) ? results[0].Get<u32>() : 0;
+  };
+
+  Trap::Ptr trap;
+  memory->UnsafeData()[65532] = 42;
+  EXPECT_EQ(42u, load(65532, &trap));
+  ASSERT_FALSE(trap);
+
+  // Whether or not the memory is guarded, an out-of-bounds access traps with
+  // the same message, and the thread can be used again afterward.
+  for (int i = 0; i < 2; ++i) {
+    load(65533, &trap);
+    ASSERT_TRUE(trap);
+    EXPECT_EQ(
+        "out of bounds memory access: access at 65533+4 >= max value 65536",
+        trap->message());
+    trap.reset();
+  }
+  load(0xffffffff, &trap);
+  ASSERT_TRUE(trap);
+  trap.reset();
+
+  ASSERT_EQ(Result::Ok, memory->Grow(1));
+  EXPECT_EQ(42u, load(65532, &trap));
+  EXPECT_EQ(0u, load(65533, &trap));
+  ASSERT_FALSE(trap);
+}
+
+TEST_F(InterpTest, Memory_StoreStraddlingEnd) {
+  // (memory (export "mem") 1)
+  // (func (export "store") (param i32 i64)
+  //   (i64.store (local.get 0) (local.get 1)))
+  ReadModule({
+      0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x06, 0x01, 0x60,
+      0x02, 0x7f, 0x7e, 0x00, 0x03, 0x02, 0x01, 0x00, 0x05, 0x03, 0x01, 0x00,
+      0x01, 0x07, 0x0f, 0x02, 0x03, 0x6d, 0x65, 0x6d, 0x02, 0x00, 0x05, 0x73,
+      0x74, 0x6f, 0x72, 0x65, 0x00, 0x00, 0x0a, 0x0b, 0x01, 0x09, 0x00, 0x20,
+      0x00, 0x20, 0x01, 0x37, 0x03, 0x00, 0x0b,
+  });
+  Instantiate();
+  auto memory = store_.UnsafeGet<Memory>(inst_->exports()[0]);
+  auto func = GetFuncExport(1);
+
+  Values results;
+  Trap::Ptr trap;
+  EXPECT_EQ(Result::Error,
+            func->Call(store_, {Value::Make(u32{65532}), Value::Make(~u64{0})},
+                       results, &trap));
+  ASSERT_TRUE(trap);
+  EXPECT_EQ("out of bounds memory access: access at 65532+8 >= max value 65536",
+            trap->message());
+
+  // The bytes that are in bounds must not have been written.
+  const u8* data = memory->UnsafeData();
+  for (u64 i = 65532; i < 65536; ++i) {
+    EXPECT_EQ(0, data[i]) << "at " << i;
+  }
+}
+
+TEST_F(InterpTest, Memory_GuardedGrowDoesNotMove) {
+  MemoryType type(Limits(1, 10), WABT_DEFAULT_PAGE_SIZE);
+  EXPECT_FALSE(Memory::New(store_, type)->IsGuarded());
+
+  store_.SetGuardMemories(true);
+  auto memory = Memory::New(store_, type);
+  if (!memory->IsGuarded()) {
+    GTEST_SKIP() << "guarded memories aren't supported";
+  }
+  u8* data = memory->UnsafeData();
+  data[65535] = 42;
+  ASSERT_EQ(Result::Ok, memory->Grow(2));
+  EXPECT_EQ(data, memory->UnsafeData());
+  EXPECT_EQ(42, data[65535]);
+  EXPECT_EQ(0, data[3 * 65536 - 1]);
+}
+
+TEST_F(InterpTest, SharedMemory_Threads) {
+  // (import "env" "mem" (memory 1 1 shared))
+  // (func (export "add") (param $n i32)
+  //   (loop $loop
+  //     (drop (i32.atomic.rmw.add (i32.const 0) (i32.const 1)))
+  //     (br_if $loop
+  //       (local.tee $n (i32.sub (local.get $n) (i32.const 1))))))
+  // (func (export "wait") (result i32)
+  //   (memory.atomic.wait32 (i32.const 4) (i32.const 0) (i64.const -1)))
+  Features features;
+  features.enable_threads();
+  store_.setFeatures(features);
+  store_.SetGuardMemories(true);
+  ReadModule({
+      0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x09, 0x02, 0x60,
+      0x01, 0x7f, 0x00, 0x60, 0x00, 0x01, 0x7f, 0x02, 0x0d, 0x01, 0x03, 0x65,
+      0x6e, 0x76, 0x03, 0x6d, 0x65, 0x6d, 0x02, 0x03, 0x01, 0x01, 0x03, 0x03,
+      0x02, 0x00, 0x01, 0x07, 0x0e, 0x02, 0x03, 0x61, 0x64, 0x64, 0x00, 0x00,
+      0x04, 0x77, 0x61, 0x69, 0x74, 0x00, 0x01, 0x0a, 0x26, 0x02, 0x17, 0x00,
+      0x03, 0x40, 0x41, 0x00, 0x41, 0x01, 0xfe, 0x1e, 0x02, 0x00, 0x1a, 0x20,
+      0x00, 0x41, 0x01, 0x6b, 0x22, 0x00, 0x0d, 0x00, 0x0b, 0x0b, 0x0c, 0x00,
+      0x41, 0x04, 0x41, 0x00, 0x42, 0x7f, 0xfe, 0x01, 0x02, 0x00, 0x0b,
+  });
+  auto memory = Memory::New(
+      store_, MemoryType(Limits(1, 1, true), WABT_DEFAULT_PAGE_SIZE));
+  if (!Memory::New(store_, *memory)) {
+    GTEST_SKIP() << "memories can only be shared between guarded Stores";
+  }
+
+  // A Store may only be used by one OS thread, so each thread instantiates
+  // the module in its own Store, with a Memory that shares the storage.
+  auto run = [&](Index export_index, u32* out_result) {
+    Store store(features);
+    auto shared = Memory::New(store, *memory);
+    auto mod = Module::New(store, module_desc_);
+    Trap::Ptr trap;
+    auto inst = Instance::Instantiate(store, mod.ref(), {shared.ref()}, &trap);
+    ASSERT_TRUE(inst);
+    auto func = store.UnsafeGet<Func>(inst->exports()[export_index]);
+    Values params;
+    if (export_index == 0) {
+      params.push_back(Value::Make(10000u));
+    }
+    Values results;
+    ASSERT_EQ(Result::Ok, func->Call(store, params, results, &trap));
+    if (out_result) {
+      *out_result = results[0].Get<u32>();
+    }
+  };
+
+  u32 wait_result = ~0u;
+  std::thread waiter(run, 1, &wait_result);
+  std::vector<std::thread> adders;
+  for (int i = 0; i < 4; ++i) {
+    adders.emplace_back(run, 0, nullptr);
+  }
+  for (auto&& adder : adders) {
+    adder.join();
+  }
+  u32 value;
+  ASSERT_EQ(Result::Ok, memory->AtomicLoad(0, 0, &value));
+  EXPECT_EQ(40000u, value);
+
+  // The waiter may not have started waiting yet.
+  u32 woken = 0;
+  while (woken == 0) {
+    ASSERT_EQ(Result::Ok, memory->AtomicNotify(4, 0, 1, &woken));
+    std::this_thread::yield();
+  }
+  waiter.join();
+  EXPECT_EQ(0u, wait_result);
+}
+
 TEST_F(InterpTest, Rot13) {
   // (import "host" "mem" (memory $mem 1))
   // (import "host" "fill_buf" (func $fill_buf (param i32 i32) (result i32)))
@@ -562,6 +1012,126 @@ TEST_F(InterpTest, Rot13) {
   ASSERT_EQ("Hello, WebAssembly!", string_data);
 }
 
+TEST_F(InterpTest, Snapshot) {
+  // (type $t (func (result i32)))
+  // (memory (export "mem") 1)
+  // (global $g (mut i32) (i32.const 0))
+  // (table 1 funcref)
+  // (elem (i32.const 0) $get)
+  // (data (i32.const 16) "hello")
+  // (func $get (type $t) (global.get $g))
+  // (func $start
+  //   (global.set $g (i32.const 42))
+  //   (i32.store8 (i32.const 16) (i32.const 72)))
+  // (start $start)
+  // (func (export "call") (result i32)
+  //   (call_indirect (type $t) (i32.const 0)))
+  // (func (export "set") (param i32)
+  //   (global.set $g (local.get 0))
+  //   (i32.store8 (i32.const 17) (local.get 0)))
+  ReadModule({
+      0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0c, 0x03, 0x60,
+      0x00, 0x01, 0x7f, 0x60, 0x00, 0x00, 0x60, 0x01, 0x7f, 0x00, 0x03, 0x05,
+      0x04, 0x00, 0x01, 0x00, 0x02, 0x04, 0x04, 0x01, 0x70, 0x00, 0x01, 0x05,
+      0x03, 0x01, 0x00, 0x01, 0x06, 0x06, 0x01, 0x7f, 0x01, 0x41, 0x00, 0x0b,
+      0x07, 0x14, 0x03, 0x03, 0x6d, 0x65, 0x6d, 0x02, 0x00, 0x04, 0x63, 0x61,
+      0x6c, 0x6c, 0x00, 0x02, 0x03, 0x73, 0x65, 0x74, 0x00, 0x03, 0x08, 0x01,
+      0x01, 0x09, 0x07, 0x01, 0x00, 0x41, 0x00, 0x0b, 0x01, 0x00, 0x0a, 0x2b,
+      0x04, 0x04, 0x00, 0x23, 0x00, 0x0b, 0x0e, 0x00, 0x41, 0x2a, 0x24, 0x00,
+      0x41, 0x10, 0x41, 0xc8, 0x00, 0x3a, 0x00, 0x00, 0x0b, 0x07, 0x00, 0x41,
+      0x00, 0x11, 0x00, 0x00, 0x0b, 0x0d, 0x00, 0x20, 0x00, 0x24, 0x00, 0x41,
+      0x11, 0x20, 0x00, 0x3a, 0x00, 0x00, 0x0b, 0x0b, 0x0b, 0x01, 0x00, 0x41,
+      0x10, 0x0b, 0x05, 0x68, 0x65, 0x6c, 0x6c, 0x6f,
+  });
+  Instantiate();
+
+  auto call = [&](const Instance::Ptr& inst, Index export_index,
+                  const Values& params) {
+    Values results;
+    Trap::Ptr trap;
+    Func::Ptr func = store_.UnsafeGet<Func>(inst->exports()[export_index]);
+    EXPECT_EQ(Result::Ok, func->Call(store_, params, results, &trap));
+    return results.empty() ? 0 : results[0].Get<u32>();
+  };
+  auto memory_string = [&](const Instance::Ptr& inst) {
+    Memory::Ptr memory = store_.UnsafeGet<Memory>(inst->exports()[0]);
+    return std::string(reinterpret_cast<char*>(memory->UnsafeData()) + 16, 5);
+  };
+
+  InstanceSnapshot snapshot(store_, *inst_);
+  call(inst_, 2, {Value::Make(u32{'a'})});
+
+  Trap::Ptr trap;
+  Instance::Ptr copy1 = Instance::Instantiate(store_, snapshot, &trap);
+  Instance::Ptr copy2 = Instance::Instantiate(store_, snapshot, &trap);
+  ASSERT_TRUE(copy1 && copy2);
+
+  // Each copy starts with the state after the start function, and calls its
+  // own functions through its table.
+  EXPECT_EQ(42u, call(copy1, 1, {}));
+  call(copy1, 2, {Value::Make(u32{'i'})});
+  EXPECT_EQ(u32{'i'}, call(copy1, 1, {}));
+  EXPECT_EQ(42u, call(copy2, 1, {}));
+  EXPECT_EQ(u32{'a'}, call(inst_, 1, {}));
+
+  EXPECT_EQ("Hillo", memory_string(copy1));
+  EXPECT_EQ("Hello", memory_string(copy2));
+  EXPECT_EQ("Hallo", memory_string(inst_));
+
+  Table::Ptr table = store_.UnsafeGet<Table>(copy1->tables()[0]);
+  EXPECT_EQ(copy1->funcs()[0], table->UnsafeGet(0));
+}
+
+TEST_F(InterpTest, Dispatch_InstructionCount) {
+  // (func (export "sum") (param $n i32) (result i32)
+  //   (local $sum i32)
+  //   (block $done
+  //     (loop $loop
+  //       (br_if $done (i32.eqz (local.get $n)))
+  //       (local.set $sum (i32.add (local.get $sum) (local.get $n)))
+  //       (local.set $n (i32.sub (local.get $n) (i32.const 1)))
+  //       (br $loop)))
+  //   (local.get $sum))
+  ReadModule({
+      0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x06, 0x01, 0x60,
+      0x01, 0x7f, 0x01, 0x7f, 0x03, 0x02, 0x01, 0x00, 0x07, 0x07, 0x01, 0x03,
+      0x73, 0x75, 0x6d, 0x00, 0x00, 0x0a, 0x23, 0x01, 0x21, 0x01, 0x01, 0x7f,
+      0x02, 0x40, 0x03, 0x40, 0x20, 0x00, 0x45, 0x0d, 0x01, 0x20, 0x01, 0x20,
+      0x00, 0x6a, 0x21, 0x01, 0x20, 0x00, 0x41, 0x01, 0x6b, 0x21, 0x00, 0x0c,
+      0x00, 0x0b, 0x0b, 0x20, 0x01, 0x0b,
+  });
+  Instantiate();
+  auto func = GetFuncExport(0);
+
+  const u32 kIterations = 100;
+  const Values params = {Value::Make(kIterations)};
+  Trap::Ptr trap;
+  RunResult result;
+
+  Thread step_thread(store_);
+  ASSERT_EQ(RunResult::Ok, step_thread.PushCall(*func, params, &trap));
+  u64 num_instructions = 0;
+  do {
+    result = step_thread.Step(&trap);
+    ++num_instructions;
+  } while (result == RunResult::Ok);
+  ASSERT_EQ(RunResult::Return, result);
+
+  // The instruction budget of the threaded dispatch loop must match the
+  // single-stepped instruction count, including instructions that change
+  // frames.
+  Thread budget_thread(store_);
+  ASSERT_EQ(RunResult::Ok, budget_thread.PushCall(*func, params, &trap));
+  EXPECT_EQ(RunResult::Ok,
+            budget_thread.Run(static_cast<int>(num_instructions - 1), &trap));
+  EXPECT_EQ(RunResult::Return, budget_thread.Run(1, &trap));
+
+  Values results;
+  ASSERT_EQ(Result::Ok, func->Call(store_, params, results, &trap));
+  EXPECT_EQ(1u, results.size());
+  EXPECT_EQ(kIterations * (kIterations + 1) / 2, results[0].Get<u32>());
+}
+
 class InterpGCTest : public InterpTest {
  public:
   void SetUp() override { before_new = store_.object_count(); }
@@ -734,6 +1304,222 @@ TEST_F(InterpGCTest, Collect_DeepRecursion) {
   EXPECT_EQ(1u, store_.object_count());
 }
 
-// TODO: Test for Thread keeping references alive as locals/params/stack values.
-// This requires better tracking of references than currently exists in the
-// interpreter. (see TODOs in Select/LocalGet/GlobalGet)
+TEST_F(InterpGCTest, Collect_Automatic) {
+  Store::GCOptions options;
+  options.automatic = true;
+  options.min_objects = 64;
+  options.slice_size = 8;
+  store_.SetGCOptions(options);
+
+  for (int i = 0; i < 10000; ++i) {
+    Foreign::New(store_, nullptr);
+  }
+  EXPECT_LT(store_.object_count(), before_new + 256);
+
+  const Store::GCStats& stats = store_.gc_stats();
+  EXPECT_GT(stats.collections, 1u);
+  EXPECT_GT(stats.increments, stats.collections);
+  EXPECT_GT(stats.objects_freed, 9000u);
+  EXPECT_GE(stats.total_pause, stats.max_pause);
+}
+
+TEST_F(InterpGCTest, Collect_IncrementalWriteBarrier) {
+  TableType tt = TableType{ValueType::ExternRef, Limits{1}};
+  Table::Ptr old_table = Table::New(store_, tt, Ref::Null);
+  Table::Ptr new_table = Table::New(store_, tt, Ref::Null);
+  Ref foreign = Foreign::New(store_, nullptr)->self();
+  ASSERT_EQ(Result::Ok, old_table->Set(store_, 0, foreign));
+
+  // The most recent root is traced first, so new_table has been traced
+  // before the foreign object is moved into it.
+  Store::GCOptions options;
+  options.slice_size = 1;
+  store_.SetGCOptions(options);
+  ASSERT_FALSE(store_.CollectIncrement());
+  ASSERT_EQ(Result::Ok, new_table->Set(store_, 0, foreign));
+  ASSERT_EQ(Result::Ok, old_table->Set(store_, 0, Ref::Null));
+  while (!store_.CollectIncrement()) {
+  }
+
+  EXPECT_TRUE(store_.Is<Foreign>(foreign));
+  EXPECT_EQ(foreign, new_table->UnsafeGet(0));
+}
+
+TEST_F(InterpGCTest, Collect_IncrementalWriteBarrierGlobal) {
+  // Global::Set(Store&, Value) is how global.set and wasm_global_set store
+  // into a global.
+  GlobalType gt{ValueType::ExternRef, Mutability::Var};
+  Global::Ptr old_global = Global::New(store_, gt, Value::Make(Ref::Null));
+  Global::Ptr new_global = Global::New(store_, gt, Value::Make(Ref::Null));
+  Ref foreign = Foreign::New(store_, nullptr)->self();
+  old_global->Set(store_, Value::Make(foreign));
+
+  Store::GCOptions options;
+  options.slice_size = 1;
+  store_.SetGCOptions(options);
+  ASSERT_FALSE(store_.CollectIncrement());
+  new_global->Set(store_, Value::Make(foreign));
+  old_global->Set(store_, Value::Make(Ref::Null));
+  while (!store_.CollectIncrement()) {
+  }
+
+  EXPECT_TRUE(store_.Is<Foreign>(foreign));
+  EXPECT_EQ(foreign, new_global->Get().Get<Ref>());
+}
+
+TEST_F(InterpGCTest, Collect_ExceptionAllocation) {
+  // (tag $e (param i32))
+  // (func $thrower (param i32) (throw $e (local.get 0)))
+  // (func (export "f") (param $n i32) (result i32)
+  //   (local $sum i32)
+  //   (loop $loop
+  //     (block $h (result i32)
+  //       (try_table (catch $e $h) (call $thrower (local.get $n)))
+  //       (unreachable))
+  //     (local.set $sum (i32.add (local.get $sum)))
+  //     (br_if $loop (local.tee $n (i32.sub (local.get $n) (i32.const 1)))))
+  //   (local.get $sum))
+  Features features;
+  features.enable_exceptions();
+  store_.setFeatures(features);
+  ReadModule({
+      0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0a, 0x02, 0x60,
+      0x01, 0x7f, 0x00, 0x60, 0x01, 0x7f, 0x01, 0x7f, 0x03, 0x03, 0x02, 0x00,
+      0x01, 0x0d, 0x03, 0x01, 0x00, 0x00, 0x07, 0x05, 0x01, 0x01, 0x66, 0x00,
+      0x01, 0x0a, 0x2f, 0x02, 0x06, 0x00, 0x20, 0x00, 0x08, 0x00, 0x0b, 0x26,
+      0x01, 0x01, 0x7f, 0x03, 0x40, 0x02, 0x7f, 0x1f, 0x40, 0x01, 0x00, 0x00,
+      0x00, 0x20, 0x00, 0x10, 0x00, 0x0b, 0x00, 0x0b, 0x20, 0x01, 0x6a, 0x21,
+      0x01, 0x20, 0x00, 0x41, 0x01, 0x6b, 0x22, 0x00, 0x0d, 0x00, 0x0b, 0x20,
+      0x01, 0x0b,
+  });
+  Instantiate();
+  auto func = GetFuncExport(0);
+
+  Store::GCOptions options;
+  options.automatic = true;
+  options.min_objects = 256;
+  store_.SetGCOptions(options);
+
+  const u32 kIterations = 4096;
+  Values results;
+  Trap::Ptr trap;
+  ASSERT_EQ(Result::Ok, func->Call(store_, {Value::Make(kIterations)}, results,
+                                   &trap));
+  EXPECT_EQ(kIterations * (kIterations + 1) / 2, results[0].Get<u32>());
+
+  // The exceptions are freed as the loop runs.
+  EXPECT_GT(store_.gc_stats().objects_freed, kIterations / 2);
+  EXPECT_LT(store_.object_count(), before_new + 3 * options.min_objects);
+}
+
+TEST_F(InterpGCTest, Collect_KeepsOneEmptySlab) {
+  size_t slabs_before = store_.object_pool_slab_count();
+  std::vector<Foreign::Ptr> foreigns;
+  for (int i = 0; i < 10000; ++i) {
+    foreigns.push_back(Foreign::New(store_, nullptr));
+  }
+  EXPECT_GT(store_.object_pool_slab_count(), slabs_before + 1);
+
+  // All but one of the empty slabs are released, so that allocating again
+  // right after a collection doesn't need a new slab.
+  foreigns.clear();
+  store_.Collect();
+  EXPECT_EQ(slabs_before + 1, store_.object_pool_slab_count());
+  Foreign::New(store_, nullptr);
+  EXPECT_EQ(slabs_before + 1, store_.object_pool_slab_count());
+}
+
+class InterpGCThreadTest : public InterpGCTest {
+ public:
+  // Reads and instantiates a module that moves each of its first three
+  // externref params to a different place (a param, a local, and the value
+  // stack) while it calls the imported `collect`, then returns them. The last
+  // param is dropped before the first call.
+  void InstantiateThreadModule() {
+    // (import "" "collect" (func $collect))
+    // (func (export "f")
+    //   (param externref externref externref externref)
+    //   (result externref externref externref)
+    //   (local externref)
+    //   (local.set 3 (ref.null extern))
+    //   (local.set 4 (local.get 1))
+    //   (local.set 1 (ref.null extern))
+    //   (local.get 2)
+    //   (local.set 2 (ref.null extern))
+    //   (block (result externref)
+    //     (i32.const 7)
+    //     (local.get 0)
+    //     (local.set 0 (ref.null extern))
+    //     (call $collect)
+    //     (br 0))
+    //   (call $collect)
+    //   (local.get 4)
+    //   (call $collect))
+    ReadModule({
+        0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x01, 0x0e, 0x02,
+        0x60, 0x00, 0x00, 0x60, 0x04, 0x6f, 0x6f, 0x6f, 0x6f, 0x03, 0x6f,
+        0x6f, 0x6f, 0x02, 0x0c, 0x01, 0x00, 0x07, 0x63, 0x6f, 0x6c, 0x6c,
+        0x65, 0x63, 0x74, 0x00, 0x00, 0x03, 0x02, 0x01, 0x01, 0x07, 0x05,
+        0x01, 0x01, 0x66, 0x00, 0x01, 0x0a, 0x2d, 0x01, 0x2b, 0x01, 0x01,
+        0x6f, 0xd0, 0x6f, 0x21, 0x03, 0x20, 0x01, 0x21, 0x04, 0xd0, 0x6f,
+        0x21, 0x01, 0x20, 0x02, 0xd0, 0x6f, 0x21, 0x02, 0x02, 0x6f, 0x41,
+        0x07, 0x20, 0x00, 0xd0, 0x6f, 0x21, 0x00, 0x10, 0x00, 0x0c, 0x00,
+        0x0b, 0x10, 0x00, 0x20, 0x04, 0x10, 0x00, 0x0b,
+    });
+    auto collect = HostFunc::New(
+        store_, FuncType{{}, {}},
+        [this](Thread& thread, const Values&, Values&, Trap::Ptr*) -> Result {
+          store_.Collect();
+          return Result::Ok;
+        });
+    Instantiate({collect->self()});
+
+    for (int i = 0; i < 4; ++i) {
+      auto foreign = Foreign::New(store_, nullptr);
+      refs_.push_back(foreign->self());
+      params_.push_back(Value::Make(foreign->self()));
+    }
+  }
+
+  void ExpectCollected() {
+    EXPECT_TRUE(store_.IsValid(refs_[0]));
+    EXPECT_TRUE(store_.IsValid(refs_[1]));
+    EXPECT_TRUE(store_.IsValid(refs_[2]));
+    EXPECT_FALSE(store_.IsValid(refs_[3]));
+  }
+
+  RefVec refs_;
+  Values params_;
+};
+
+TEST_F(InterpGCThreadTest, Collect_Call) {
+  InstantiateThreadModule();
+
+  Values results;
+  Trap::Ptr trap;
+  ASSERT_EQ(Result::Ok,
+            GetFuncExport(0)->Call(store_, params_, results, &trap));
+  ExpectCollected();
+  ASSERT_EQ(3u, results.size());
+  EXPECT_EQ(refs_[2], results[0].Get<Ref>());
+  EXPECT_EQ(refs_[0], results[1].Get<Ref>());
+  EXPECT_EQ(refs_[1], results[2].Get<Ref>());
+}
+
+TEST_F(InterpGCThreadTest, Collect_EveryInstruction) {
+  InstantiateThreadModule();
+
+  // Collecting between any two instructions must keep exactly the live
+  // references.
+  Thread thread(store_);
+  Trap::Ptr trap;
+  ASSERT_EQ(RunResult::Ok,
+            thread.PushCall(*GetFuncExport(0), params_, &trap));
+  RunResult result;
+  do {
+    store_.Collect();
+    result = thread.Run(1, &trap);
+  } while (result == RunResult::Ok);
+  ASSERT_EQ(RunResult::Return, result);
+  ExpectCollected();
+}
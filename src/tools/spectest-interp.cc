@@ -49,6 +49,8 @@ static int s_verbose;
 static std::string s_infile;
 static Thread::Options s_thread_options;
 static Stream* s_trace_stream;
+static Istream::Encoding s_istream_encoding = Istream::Encoding::Compact;
+static CompileOptions s_compile_options;
 static Features s_features;
 
 static std::unique_ptr<FileStream> s_log_stream;
@@ -89,6 +91,14 @@ static void ParseOptions(int argc, char** argv) {
                    });
   parser.AddOption('t', "trace", "Trace execution",
                    []() { s_trace_stream = s_stdout_stream.get(); });
+  parser.AddOption("fixed-width-istream",
+                   "Pre-decode instructions into fixed-width slots. Faster to "
+                   "execute, but uses more memory",
+                   []() { s_istream_encoding = Istream::Encoding::FixedWidth; });
+  parser.AddOption("disable-superinstructions",
+                   "Don't fuse common instruction sequences into "
+                   "superinstructions",
+                   []() { s_compile_options.superinstructions = false; });
 
   parser.AddArgument("filename", OptionParser::ArgumentCount::One,
                      [](const char* argument) {
@@ -1505,8 +1515,9 @@ interp::Module::Ptr CommandRunner::ReadModule(std::string_view module_filename,
   ReadBinaryOptions options(s_features, s_log_stream.get(), kReadDebugNames,
                             kStopOnFirstError, kFailOnCustomSectionError);
   ModuleDesc module_desc;
-  if (Failed(ReadBinaryInterp(module_filename, file_data, options, errors,
-                              &module_desc))) {
+  module_desc.istream = Istream(s_istream_encoding);
+  if (Failed(ReadBinaryInterp(module_filename, file_data, options,
+                              s_compile_options, errors, &module_desc))) {
     return {};
   }
 
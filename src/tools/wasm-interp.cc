@@ -15,17 +15,21 @@
  */
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstdio>
 #include <cstdlib>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "wabt/binary-reader.h"
 #include "wabt/error-formatter.h"
 #include "wabt/feature.h"
 #include "wabt/interp/binary-reader-interp.h"
+#include "wabt/interp/interp-profile.h"
 #include "wabt/interp/interp-util.h"
 #include "wabt/interp/interp-wasi.h"
 #include "wabt/interp/interp.h"
@@ -57,11 +61,16 @@ static int s_verbose;
 static const char* s_infile;
 static Thread::Options s_thread_options;
 static Stream* s_trace_stream;
+static std::string s_profile_prefix;
+static std::unique_ptr<Profile> s_profile;
+static Istream::Encoding s_istream_encoding = Istream::Encoding::Compact;
+static CompileOptions s_compile_options;
 static bool s_run_all_exports;
 static bool s_host_print;
 static bool s_dummy_import_func;
 static Features s_features;
 static bool s_wasi;
+static bool s_threads;
 static std::vector<FunctionCall> s_run_exports;
 static std::vector<std::string> s_wasi_env;
 static std::vector<std::string> s_wasi_argv;
@@ -73,6 +82,16 @@ static std::unique_ptr<FileStream> s_stderr_stream;
 
 static Store s_store;
 
+// For --threads. Each spawned thread instantiates s_module_desc in its own
+// Store, since a Store can only be used by one OS thread.
+static ModuleDesc s_module_desc;
+static Memory::Ptr s_shared_memory;
+static std::atomic<u32> s_next_thread_id{1};
+static std::mutex s_threads_mutex;
+static std::vector<std::thread> s_spawned_threads;
+// Held while writing the output of a host function or a spawned thread.
+static std::mutex s_output_mutex;
+
 static const char s_description[] =
     R"(  read a file in the wasm binary format, and run in it a stack-based
   interpreter.
@@ -155,6 +174,25 @@ static void ParseOptions(int argc, char** argv) {
                    });
   parser.AddOption('t', "trace", "Trace execution",
                    []() { s_trace_stream = s_stdout_stream.get(); });
+  parser.AddOption('\0', "profile", "PREFIX",
+                   "Count the instructions executed by each function and "
+                   "opcode, and write them to PREFIX.folded (for a flame "
+                   "graph) and PREFIX.json",
+                   [](const std::string& argument) {
+                     s_profile_prefix = argument;
+                   });
+  parser.AddOption("fixed-width-istream",
+                   "Pre-decode instructions into fixed-width slots. Faster to "
+                   "execute, but uses more memory",
+                   []() { s_istream_encoding = Istream::Encoding::FixedWidth; });
+  parser.AddOption("disable-superinstructions",
+                   "Don't fuse common instruction sequences into "
+                   "superinstructions",
+                   []() { s_compile_options.superinstructions = false; });
+  parser.AddOption("lazy-compile",
+                   "Compile each function on its first call. Functions that "
+                   "are never called aren't validated",
+                   []() { s_compile_options.lazy = true; });
   parser.AddOption('r', "run-export", "FUNCTION",
                    "Run exported function by name",
                    [](const std::string& argument) {
@@ -179,6 +217,11 @@ static void ParseOptions(int argc, char** argv) {
                    "Assume input module is WASI compliant (Export "
                    " WASI API the the module and invoke _start function)",
                    []() { s_wasi = true; });
+  parser.AddOption("threads",
+                   "Provide the wasi-threads import \"wasi.thread-spawn\", "
+                   "which runs the export \"wasi_thread_start\" on a new OS "
+                   "thread, sharing the module's shared memory",
+                   []() { s_threads = true; });
   parser.AddOption(
       'e', "env", "ENV",
       "Pass the given environment string in the WASI runtime",
@@ -208,6 +251,17 @@ static void ParseOptions(int argc, char** argv) {
   parser.Parse(argc, argv);
 }
 
+static Result CallFunc(const Func::Ptr& func,
+                       const Values& params,
+                       Values& results,
+                       Trap::Ptr* trap) {
+  Thread::Options options = s_thread_options;
+  options.trace_stream = s_trace_stream;
+  options.profile = s_profile.get();
+  Thread thread(s_store, options);
+  return func->Call(thread, params, results, trap);
+}
+
 Result RunSpecificExports(const Instance::Ptr& instance,
                           Errors* errors,
                           std::vector<FunctionCall>& calls) {
@@ -238,8 +292,7 @@ Result RunSpecificExports(const Instance::Ptr& instance,
         auto func = s_store.UnsafeGet<Func>(instance->funcs()[export_.index]);
         Values results;
         Trap::Ptr trap;
-        result |=
-            func->Call(s_store, call_.args, results, &trap, s_trace_stream);
+        result |= CallFunc(func, call_.args, results, &trap);
         WriteCall(s_stdout_stream.get(), export_.type.name, *func_type,
                   call_.args, results, trap);
       }
@@ -269,7 +322,7 @@ Result RunAllExports(const Instance::Ptr& instance, Errors* errors) {
       Values params;
       Values results;
       Trap::Ptr trap;
-      result |= func->Call(s_store, params, results, &trap, s_trace_stream);
+      result |= CallFunc(func, params, results, &trap);
       WriteCall(s_stdout_stream.get(), export_.type.name, *func_type, params,
                 results, trap);
     }
@@ -278,10 +331,117 @@ Result RunAllExports(const Instance::Ptr& instance, Errors* errors) {
   return result;
 }
 
-static void BindImports(const Module::Ptr& module, RefVec& imports) {
+static Result BindImports(Store& store,
+                          const Module::Ptr& module,
+                          RefVec& imports);
+
+// The thread ids of wasi-threads are positive, and at most 0x1fffffff.
+static constexpr u32 kMaxThreadId = 0x1fffffff;
+
+static void RunSpawnedThread(u32 thread_id, u32 start_arg) {
+  Store store(s_features);
+  Module::Ptr module = Module::New(store, s_module_desc);
+  RefVec imports;
+  if (Failed(BindImports(store, module, imports))) {
+    return;
+  }
+
+  Trap::Ptr trap;
+  Instance::Ptr instance =
+      Instance::Instantiate(store, module.ref(), imports, &trap);
+  if (!instance) {
+    std::lock_guard<std::mutex> lock(s_output_mutex);
+    WriteTrap(s_stderr_stream.get(), "error initializing thread", trap);
+    return;
+  }
+
+  for (auto&& export_ : module->desc().exports) {
+    if (export_.type.type->kind == ExternalKind::Func &&
+        export_.type.name == "wasi_thread_start") {
+      auto func = store.UnsafeGet<Func>(instance->funcs()[export_.index]);
+      Values params{Value::Make(thread_id), Value::Make(start_arg)};
+      Values results;
+      Thread thread(store, s_thread_options);
+      if (Failed(func->Call(thread, params, results, &trap))) {
+        std::lock_guard<std::mutex> lock(s_output_mutex);
+        WriteTrap(s_stderr_stream.get(), "error running thread", trap);
+      }
+      return;
+    }
+  }
+  std::lock_guard<std::mutex> lock(s_output_mutex);
+  s_stderr_stream->Writef("error running thread: no export "
+                          "\"wasi_thread_start\"\n");
+}
+
+static Result SpawnThread(Thread& thread,
+                          const Values& params,
+                          Values& results,
+                          Trap::Ptr* trap) {
+  u32 thread_id = s_next_thread_id++;
+  if (thread_id > kMaxThreadId) {
+    results[0] = Value::Make(u32(-1));
+    return Result::Ok;
+  }
+  std::lock_guard<std::mutex> lock(s_threads_mutex);
+  s_spawned_threads.emplace_back(RunSpawnedThread, thread_id,
+                                 params[0].Get<u32>());
+  results[0] = Value::Make(thread_id);
+  return Result::Ok;
+}
+
+static void JoinSpawnedThreads() {
+  // A spawned thread may spawn more threads while this waits.
+  for (;;) {
+    std::thread thread;
+    {
+      std::lock_guard<std::mutex> lock(s_threads_mutex);
+      if (s_spawned_threads.empty()) {
+        return;
+      }
+      thread = std::move(s_spawned_threads.back());
+      s_spawned_threads.pop_back();
+    }
+    thread.join();
+  }
+}
+
+static Result BindImports(Store& store,
+                          const Module::Ptr& module,
+                          RefVec& imports) {
   auto* stream = s_stdout_stream.get();
 
   for (auto&& import : module->desc().imports) {
+    if (s_threads && import.type.type->kind == ExternKind::Memory &&
+        cast<MemoryType>(import.type.type.get())->limits.is_shared) {
+      // The main thread creates the memory, and the spawned threads share it.
+      // Only guarded memories can be shared between Stores.
+      Memory::Ptr memory;
+      if (&store == &s_store) {
+        s_shared_memory =
+            Memory::New(store, *cast<MemoryType>(import.type.type.get()));
+        if (!s_shared_memory->IsGuarded()) {
+          s_stderr_stream->Writef(
+              "--threads requires guard-page memories, but memory %s.%s "
+              "can't be guarded\n",
+              import.type.module.c_str(), import.type.name.c_str());
+          return Result::Error;
+        }
+        memory = s_shared_memory;
+      } else {
+        memory = Memory::New(store, *s_shared_memory);
+      }
+      imports.push_back(memory.ref());
+      continue;
+    }
+
+    if (s_threads && import.type.type->kind == ExternKind::Func &&
+        import.type.module == "wasi" && import.type.name == "thread-spawn") {
+      auto func_type = *cast<FuncType>(import.type.type.get());
+      imports.push_back(HostFunc::New(store, func_type, SpawnThread).ref());
+      continue;
+    }
+
     if (import.type.type->kind == ExternKind::Func &&
         ((s_host_print && import.type.module == "host" &&
           import.type.name == "print") ||
@@ -291,9 +451,10 @@ static void BindImports(const Module::Ptr& module, RefVec& imports) {
                                       import.type.name.c_str());
 
       auto host_func = HostFunc::New(
-          s_store, func_type,
+          store, func_type,
           [=](Thread& thread, const Values& params, Values& results,
               Trap::Ptr* trap) -> Result {
+            std::lock_guard<std::mutex> lock(s_output_mutex);
             printf("called host ");
             WriteCall(stream, import_name, func_type, params, results, *trap);
             return Result::Ok;
@@ -306,6 +467,7 @@ static void BindImports(const Module::Ptr& module, RefVec& imports) {
     // instantiation will fail.
     imports.push_back(Ref::Null);
   }
+  return Result::Ok;
 }
 
 static Result ReadModule(const char* module_filename,
@@ -316,18 +478,22 @@ static Result ReadModule(const char* module_filename,
   CHECK_RESULT(ReadFile(module_filename, &file_data));
 
   ModuleDesc module_desc;
+  module_desc.istream = Istream(s_istream_encoding);
   const bool kReadDebugNames = true;
   const bool kStopOnFirstError = true;
   const bool kFailOnCustomSectionError = true;
   ReadBinaryOptions options(s_features, s_log_stream.get(), kReadDebugNames,
                             kStopOnFirstError, kFailOnCustomSectionError);
-  CHECK_RESULT(ReadBinaryInterp(module_filename, file_data, options, errors,
-                                &module_desc));
+  CHECK_RESULT(ReadBinaryInterp(module_filename, file_data, options,
+                                s_compile_options, errors, &module_desc));
 
   if (s_verbose) {
     module_desc.istream.Disassemble(stream);
   }
 
+  if (s_threads) {
+    s_module_desc = module_desc;
+  }
   *out_module = Module::New(s_store, module_desc);
   return Result::Ok;
 }
@@ -355,6 +521,11 @@ static Result ReadAndRunModule(const char* module_filename) {
 
   RefVec imports;
 
+  if (s_wasi && s_threads) {
+    s_stderr_stream->Writef("--threads can't be used with --wasi\n");
+    return Result::Error;
+  }
+
 #if WITH_WASI
   uvwasi_t uvwasi;
 #endif
@@ -415,7 +586,7 @@ static Result ReadAndRunModule(const char* module_filename) {
     return Result::Error;
 #endif
   } else {
-    BindImports(module, imports);
+    CHECK_RESULT(BindImports(s_store, module, imports));
   }
 
   Instance::Ptr instance;
@@ -433,13 +604,24 @@ static Result ReadAndRunModule(const char* module_filename) {
 #ifdef WITH_WASI
   if (s_wasi) {
     CHECK_RESULT(
-        WasiRunStart(instance, &uvwasi, s_stderr_stream.get(), s_trace_stream));
+        WasiRunStart(instance, &uvwasi, s_stderr_stream.get(), s_trace_stream,
+                     s_profile.get()));
   }
 #endif
 
   return Result::Ok;
 }
 
+static Result WriteProfile() {
+  MemoryStream folded_stream;
+  s_profile->WriteFoldedStacks(&folded_stream);
+  CHECK_RESULT(folded_stream.WriteToFile(s_profile_prefix + ".folded"));
+
+  MemoryStream json_stream;
+  s_profile->WriteJson(&json_stream);
+  return json_stream.WriteToFile(s_profile_prefix + ".json");
+}
+
 int ProgramMain(int argc, char** argv) {
   InitStdio();
   s_stdout_stream = FileStream::CreateStdout();
@@ -447,8 +629,17 @@ int ProgramMain(int argc, char** argv) {
 
   ParseOptions(argc, argv);
   s_store.setFeatures(s_features);
+  // The spawned threads share the main thread's memory.
+  s_store.SetGuardMemories(s_threads);
+  if (!s_profile_prefix.empty()) {
+    s_profile = std::make_unique<Profile>();
+  }
 
   wabt::Result result = ReadAndRunModule(s_infile);
+  JoinSpawnedThreads();
+  if (s_profile) {
+    result |= WriteProfile();
+  }
   return result != wabt::Result::Ok;
 }
 
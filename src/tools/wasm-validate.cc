@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cassert>
 #include <cinttypes>
 #include <cstdio>
@@ -34,6 +35,7 @@ static std::string s_infile;
 static Features s_features;
 static bool s_read_debug_names = true;
 static bool s_fail_on_custom_section_error = true;
+static int s_num_threads = 1;
 static std::unique_ptr<FileStream> s_log_stream;
 
 static const char s_description[] =
@@ -55,6 +57,12 @@ static void ParseOptions(int argc, char** argv) {
   parser.AddOption("ignore-custom-section-errors",
                    "Ignore errors in custom sections",
                    []() { s_fail_on_custom_section_error = false; });
+  parser.AddOption('j', "jobs", "N",
+                   "Decode and validate function bodies on N threads. Errors "
+                   "are reported in the same order as with one thread",
+                   [](const char* argument) {
+                     s_num_threads = std::max(atoi(argument), 1);
+                   });
   parser.AddArgument("filename", OptionParser::ArgumentCount::One,
                      [](const char* argument) {
                        s_infile = argument;
@@ -78,10 +86,12 @@ int ProgramMain(int argc, char** argv) {
     ReadBinaryOptions options(s_features, s_log_stream.get(),
                               s_read_debug_names, kStopOnFirstError,
                               s_fail_on_custom_section_error);
+    options.num_threads = s_num_threads;
     result =
         ReadBinaryIr(s_infile.c_str(), file_data, options, &errors, &module);
     if (Succeeded(result)) {
       ValidateOptions options(s_features);
+      options.num_threads = s_num_threads;
       result = ValidateModule(&module, &errors, options);
     }
     FormatErrorsToFile(errors, Location::Type::Binary);
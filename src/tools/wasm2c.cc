@@ -18,6 +18,7 @@
 #include <cinttypes>
 #include <cstdio>
 #include <cstdlib>
+#include <filesystem>
 
 #include "wabt/apply-names.h"
 #include "wabt/binary-reader-ir.h"
@@ -39,9 +40,12 @@ using namespace wabt;
 
 static std::string s_infile;
 static std::string s_outfile;
+static std::string s_data_file;
+static std::string s_data_file_path;
 static unsigned int s_num_outputs = 1;
 static WriteCOptions s_write_c_options;
 static bool s_read_debug_names = true;
+static int s_num_threads = 1;
 static std::unique_ptr<FileStream> s_log_stream;
 
 static const char s_description[] =
@@ -91,15 +95,30 @@ static void ParseOptions(int argc, char** argv) {
       "names section is used. If that is not present the name of the input\n"
       "file is used as the default.\n",
       [](const char* argument) { s_write_c_options.module_name = argument; });
+  parser.AddOption(
+      '\0', "data-file", "FILENAME",
+      "Write the data segments to FILENAME instead of as C array literals.\n"
+      "The C output includes FILENAME with #embed, or with .incbin if the C\n"
+      "compiler lacks #embed, by its absolute path, so the data file can't\n"
+      "be moved after wasm2c runs.\n",
+      [](const char* argument) { s_data_file = argument; });
   s_write_c_options.features.AddOptions(&parser);
   parser.AddOption("no-debug-names", "Ignore debug names in the binary file",
                    []() { s_read_debug_names = false; });
+  parser.AddOption('j', "jobs", "N",
+                   "Decode, validate and write function bodies on N threads. "
+                   "Each .c output is written by one thread",
+                   [](const char* argument) {
+                     s_num_threads = std::max(atoi(argument), 1);
+                   });
   parser.AddArgument("filename", OptionParser::ArgumentCount::One,
                      [](const char* argument) {
                        s_infile = argument;
                        ConvertBackslashToSlash(&s_infile);
                      });
   parser.Parse(argc, argv);
+  s_write_c_options.num_threads = s_num_threads;
+  s_write_c_options.log_stream = s_log_stream.get();
 
   bool any_non_supported_feature = false;
 #define WABT_FEATURE(variable, flag, default_, help)                   \
@@ -123,6 +142,26 @@ Result Wasm2cMain(Errors& errors) {
     return Result::Error;
   }
 
+  if (!s_data_file.empty()) {
+    // #embed looks for a relative path next to the .c file, but .incbin
+    // looks in the directory that the compiler runs in, so only an absolute
+    // path means the same file to both.
+    std::error_code error;
+    s_data_file_path =
+        std::filesystem::absolute(s_data_file, error).generic_string();
+    if (error) {
+      fprintf(stderr, "Unable to resolve data file name \"%s\": %s\n",
+              s_data_file.c_str(), error.message().c_str());
+      return Result::Error;
+    }
+    if (s_data_file_path.find_first_of("\"\\\n") != std::string::npos) {
+      fprintf(stderr,
+              "Data file path must not contain quotes, backslashes or "
+              "newlines.\n");
+      return Result::Error;
+    }
+  }
+
   std::vector<uint8_t> file_data;
   CHECK_RESULT(ReadFile(s_infile.c_str(), &file_data));
 
@@ -132,14 +171,27 @@ Result Wasm2cMain(Errors& errors) {
   ReadBinaryOptions options(s_write_c_options.features, s_log_stream.get(),
                             s_read_debug_names, kStopOnFirstError,
                             kFailOnCustomSectionError);
+  options.num_threads = s_num_threads;
   CHECK_RESULT(
       ReadBinaryIr(s_infile.c_str(), file_data, options, &errors, &module));
-  CHECK_RESULT(ValidateModule(&module, &errors, s_write_c_options.features));
+  ValidateOptions validate_options(s_write_c_options.features);
+  validate_options.num_threads = s_num_threads;
+  CHECK_RESULT(ValidateModule(&module, &errors, validate_options));
   CHECK_RESULT(GenerateNames(&module));
   /* TODO(binji): This shouldn't fail; if a name can't be applied
    * (because the index is invalid, say) it should just be skipped. */
   (void)ApplyNames(&module);
 
+  std::unique_ptr<FileStream> data_stream;
+  if (!s_data_file.empty()) {
+    data_stream = std::make_unique<FileStream>(s_data_file);
+    if (!data_stream->is_open()) {
+      return Result::Error;
+    }
+    s_write_c_options.data_stream = data_stream.get();
+    s_write_c_options.data_file_name = s_data_file_path;
+  }
+
   if (!s_outfile.empty()) {
     std::string header_name_full =
         std::string(wabt::StripExtension(s_outfile)) + ".h";
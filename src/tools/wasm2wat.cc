@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cassert>
 #include <cinttypes>
 #include <cstdio>
@@ -45,6 +46,7 @@ static bool s_read_debug_names = true;
 static bool s_fail_on_custom_section_error = true;
 static std::unique_ptr<FileStream> s_log_stream;
 static bool s_validate = true;
+static int s_num_threads = 1;
 
 static const char s_description[] =
     R"(  Read a file in the WebAssembly binary format, and convert it to
@@ -88,6 +90,11 @@ static void ParseOptions(int argc, char** argv) {
       []() { s_generate_names = true; });
   parser.AddOption("no-check", "Don't check for invalid modules",
                    []() { s_validate = false; });
+  parser.AddOption('j', "jobs", "N",
+                   "Decode and validate function bodies on N threads",
+                   [](const char* argument) {
+                     s_num_threads = std::max(atoi(argument), 1);
+                   });
   parser.AddArgument("filename", OptionParser::ArgumentCount::One,
                      [](const char* argument) {
                        s_infile = argument;
@@ -111,11 +118,13 @@ int ProgramMain(int argc, char** argv) {
     ReadBinaryOptions options(s_features, s_log_stream.get(),
                               s_read_debug_names, kStopOnFirstError,
                               s_fail_on_custom_section_error);
+    options.num_threads = s_num_threads;
     result =
         ReadBinaryIr(s_infile.c_str(), file_data, options, &errors, &module);
     if (Succeeded(result)) {
       if (Succeeded(result) && s_validate) {
         ValidateOptions options(s_features);
+        options.num_threads = s_num_threads;
         result = ValidateModule(&module, &errors, options);
       }
 
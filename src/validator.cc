@@ -16,10 +16,14 @@
 
 #include "wabt/validator.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cinttypes>
 #include <cstdarg>
 #include <cstdio>
+#include <memory>
+#include <thread>
 
 #include "wabt/config.h"
 
@@ -90,6 +94,9 @@ class ScriptValidator {
 class Validator : public ExprVisitor::Delegate {
  public:
   Validator(Errors*, const Module* module, const ValidateOptions& options);
+  // Checks function bodies with the module-level state of `other`; see
+  // CheckFuncBodiesInParallel.
+  Validator(const Validator& other, Errors*);
 
   Result CheckModule();
 
@@ -176,6 +183,9 @@ class Validator : public ExprVisitor::Delegate {
   Type GetDeclarationType(const FuncDeclaration&);
   Var GetFuncTypeIndex(const Location&, const FuncDeclaration&);
 
+  void CheckFuncBody(const Func&, Index func_index);
+  void CheckFuncBodiesInParallel();
+
   const ValidateOptions& options_;
   Errors* errors_ = nullptr;
   SharedValidator validator_;
@@ -773,6 +783,87 @@ Validator::Validator(Errors* errors,
       validator_(errors_, module->filename, options_),
       current_module_(module) {}
 
+Validator::Validator(const Validator& other, Errors* errors)
+    : options_(other.options_),
+      errors_(errors),
+      validator_(other.validator_, errors),
+      current_module_(other.current_module_) {}
+
+void Validator::CheckFuncBody(const Func& func, Index func_index) {
+  const Location& body_start = func.loc;
+  const Location& body_end =
+      func.exprs.empty() ? body_start : func.exprs.back().loc;
+  result_ |= validator_.BeginFunctionBody(body_start, func_index);
+
+  for (auto&& decl : func.local_types.decls()) {
+    result_ |= validator_.OnLocalDecl(body_start, decl.second, decl.first);
+  }
+
+  ExprVisitor visitor(this);
+  result_ |= visitor.VisitExprList(const_cast<ExprList&>(func.exprs));
+  result_ |= validator_.EndFunctionBody(body_end);
+}
+
+// Function bodies only depend on the module-level state, so they are split
+// into contiguous chunks that are checked by separate Validators. The chunks'
+// errors and deferred checks are merged in order, so the result is the same
+// as that of a sequential check.
+void Validator::CheckFuncBodiesInParallel() {
+  // More chunks than threads, so that a few large functions don't leave the
+  // other threads idle.
+  static constexpr size_t kChunksPerThread = 4;
+
+  struct Chunk {
+    size_t begin;
+    size_t end;
+    Errors errors;
+    std::unique_ptr<Validator> validator;
+  };
+
+  const Module* module = current_module_;
+  std::vector<const Func*> funcs;
+  for (const ModuleField& field : module->fields) {
+    if (auto* f = dyn_cast<FuncModuleField>(&field)) {
+      funcs.push_back(&f->func);
+    }
+  }
+
+  size_t num_threads = options_.num_threads;
+  size_t num_chunks = std::min(funcs.size(), num_threads * kChunksPerThread);
+  std::vector<Chunk> chunks(num_chunks);
+  for (size_t i = 0; i < num_chunks; ++i) {
+    chunks[i].begin = funcs.size() * i / num_chunks;
+    chunks[i].end = funcs.size() * (i + 1) / num_chunks;
+  }
+
+  std::atomic<size_t> next_chunk{0};
+  auto check_chunks = [&]() {
+    size_t i;
+    while ((i = next_chunk++) < chunks.size()) {
+      Chunk& chunk = chunks[i];
+      chunk.validator = std::make_unique<Validator>(*this, &chunk.errors);
+      for (size_t j = chunk.begin; j < chunk.end; ++j) {
+        chunk.validator->CheckFuncBody(*funcs[j], module->num_func_imports + j);
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < std::min(num_threads, num_chunks); ++i) {
+    threads.emplace_back(check_chunks);
+  }
+  check_chunks();
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  for (Chunk& chunk : chunks) {
+    errors_->insert(errors_->end(), chunk.errors.begin(), chunk.errors.end());
+    result_ |= chunk.validator->result_;
+    validator_.MergeDeferredChecks(&chunk.validator->validator_);
+  }
+}
+
 Result Validator::CheckModule() {
   const Module* module = current_module_;
 
@@ -973,21 +1064,14 @@ Result Validator::CheckModule() {
   validator_.OnDataCount(module->data_segments.size());
 
   // Code section.
-  Index func_index = module->num_func_imports;
-  for (const ModuleField& field : module->fields) {
-    if (auto* f = dyn_cast<FuncModuleField>(&field)) {
-      const Location& body_start = f->func.loc;
-      const Location& body_end =
-          f->func.exprs.empty() ? body_start : f->func.exprs.back().loc;
-      result_ |= validator_.BeginFunctionBody(body_start, func_index++);
-
-      for (auto&& decl : f->func.local_types.decls()) {
-        result_ |= validator_.OnLocalDecl(body_start, decl.second, decl.first);
+  if (options_.num_threads > 1) {
+    CheckFuncBodiesInParallel();
+  } else {
+    Index func_index = module->num_func_imports;
+    for (const ModuleField& field : module->fields) {
+      if (auto* f = dyn_cast<FuncModuleField>(&field)) {
+        CheckFuncBody(f->func, func_index++);
       }
-
-      ExprVisitor visitor(this);
-      result_ |= visitor.VisitExprList(const_cast<ExprList&>(f->func.exprs));
-      result_ |= validator_.EndFunctionBody(body_end);
     }
   }
 
@@ -124,12 +124,13 @@ def IsModuleCommand(command):
 
 class CWriter(object):
 
-    def __init__(self, spec_json, prefix, out_file, out_dir):
+    def __init__(self, spec_json, prefix, driver, out_file, out_dir):
         self.source_filename = os.path.basename(spec_json['source_filename'])
         self.commands = spec_json['commands']
         self.out_file = out_file
         self.out_dir = out_dir
         self.prefix = prefix
+        self.driver = driver
         self.module_idx = 0
         self.module_name_to_idx = {}
         self.module_prefix_map = {}
@@ -142,6 +143,8 @@ class CWriter(object):
         self._WriteIncludes()
         self.out_file.write(self.prefix)
         self._WriteModuleInstances()
+        if self.driver:
+            self.out_file.write(self.driver)
         test_function_num = 0
         self.out_file.write('\nvoid run_spec_tests_0(void) {\n\n')
         for i, command in enumerate(self.commands):
@@ -153,6 +156,8 @@ class CWriter(object):
         self.out_file.write('\n}\n\nvoid run_spec_tests(void) {\n\n')
         for i in range(test_function_num + 1):
             self.out_file.write('run_spec_tests_%d();\n' % i)
+        if self.driver:
+            self.out_file.write('run_driver_tests();\n')
         self._WriteModuleCleanUps()
         self.out_file.write('\n}\n')
 
@@ -518,6 +523,10 @@ def main(args):
                         help='output directory for files.')
     parser.add_argument('-P', '--prefix', metavar='PATH', help='prefix file.',
                         default=os.path.join(SCRIPT_DIR, 'spec-wasm2c-prefix.c'))
+    parser.add_argument('--driver', metavar='PATH',
+                        help='C file defining run_driver_tests(), which is '
+                        'run after the commands of the wast file, before the '
+                        'modules are freed.')
     parser.add_argument('--bindir', metavar='PATH',
                         default=find_exe.GetDefaultPath(),
                         help='directory to search for all executables.')
@@ -561,6 +570,11 @@ def main(args):
     parser.add_argument('--num-outputs', metavar='COUNT',
                         help='number of output c files for wasm2c', dest='num_outputs',
                         default=1, type=int, action='store')
+    parser.add_argument('--data-file', action='store_true',
+                        help='write the data segments to a separate file')
+    parser.add_argument('-j', '--jobs', metavar='COUNT',
+                        help='number of threads for wasm2c', dest='jobs',
+                        default=1, type=int, action='store')
     options = parser.parse_args(args)
 
     with utils.TempDirectory(options.out_dir, 'run-spec-wasm2c-') as out_dir:
@@ -612,8 +626,13 @@ def main(args):
             with open(options.prefix) as prefix_file:
                 prefix = prefix_file.read() + '\n'
 
+        driver = ''
+        if options.driver:
+            with open(options.driver) as driver_file:
+                driver = driver_file.read() + '\n'
+
         output = io.StringIO()
-        cwriter = CWriter(spec_json, prefix, output, out_dir)
+        cwriter = CWriter(spec_json, prefix, driver, output, out_dir)
 
         o_filenames = []
         cflags = ['-I%s' % options.wasmrt_dir, '-I%s' % options.simde_dir]
@@ -635,6 +654,13 @@ def main(args):
             else:
                 c_filenames.append(utils.ChangeExt(wasm_filename, '.c'))
             args = ['-n', cwriter.GetModulePrefixUnmangled(i), '--num-outputs', str(options.num_outputs)]
+            if options.jobs > 1:
+                args += ['--jobs', str(options.jobs)]
+            if options.data_file:
+                # A path relative to the working directory, not to the .c
+                # file, which wasm2c must resolve for both #embed and .incbin.
+                data_filename = os.path.relpath(utils.ChangeExt(wasm_filename, '.bin'))
+                args += ['--data-file', data_filename]
             wasm2c.RunWithArgs(wasm_filename, '-o', c_filename_input, *args)
             if options.compile:
                 for j, c_filename in enumerate(c_filenames):
@@ -663,6 +689,8 @@ def main(args):
             else:
                 exe_ext = ''
                 libs = ['-lm']
+                if options.enable_threads:
+                    libs.append('-lpthread')
             main_exe = utils.ChangeExt(json_file_path, exe_ext)
             Link(cc, o_filenames, main_exe, *libs)
 
@@ -86,6 +86,16 @@ static void error(const char* file, int line, const char* format, ...) {
     }                                                                     \
   } while (0)
 
+#define ASSERT_TRUE(cond)                                         \
+  do {                                                            \
+    g_tests_run++;                                                \
+    if (cond) {                                                   \
+      g_tests_passed++;                                           \
+    } else {                                                      \
+      error(__FILE__, __LINE__, "expected " #cond " to hold.\n"); \
+    }                                                             \
+  } while (0)
+
 #define ASSERT_TRAP(f)                                         \
   do {                                                         \
     g_tests_run++;                                             \
@@ -0,0 +1,65 @@
+/* Driver for atomic-wait-notify-threads.txt. */
+
+#ifdef _WIN32
+#include <windows.h>
+typedef HANDLE test_thread_t;
+#define THREAD_RETURN DWORD WINAPI
+#define THREAD_CREATE(thread, func) \
+  ((*(thread) = CreateThread(NULL, 0, func, NULL, 0, NULL)) != NULL)
+#define THREAD_JOIN(thread) WaitForSingleObject(thread, INFINITE)
+#define THREAD_YIELD() SwitchToThread()
+#else
+#include <pthread.h>
+#include <sched.h>
+typedef pthread_t test_thread_t;
+#define THREAD_RETURN void*
+#define THREAD_CREATE(thread, func) (pthread_create(thread, NULL, func, NULL) == 0)
+#define THREAD_JOIN(thread) pthread_join(thread, NULL)
+#define THREAD_YIELD() sched_yield()
+#endif
+
+#define NUM_WAITERS 4
+
+static _Atomic u32 g_wait_results[NUM_WAITERS];
+static _Atomic u32 g_next_waiter;
+
+static THREAD_RETURN wait_thread(void* arg) {
+  (void)arg;
+  wasm_rt_init_thread();
+  u32 result = w2c_waiter_wait(&waiter_instance);
+  g_wait_results[g_next_waiter++] = result;
+  wasm_rt_free_thread();
+  return 0;
+}
+
+static void run_driver_tests(void) {
+  test_thread_t threads[NUM_WAITERS];
+  for (int i = 0; i < NUM_WAITERS; ++i) {
+    g_wait_results[i] = ~0u;
+    ASSERT_TRUE(THREAD_CREATE(&threads[i], wait_thread));
+  }
+
+  /* A notify only wakes the threads that are already waiting, so wake them
+   * one at a time until every thread has been woken. */
+  u32 woken = 0;
+  bool woke_at_most_one = true;
+  while (woken < NUM_WAITERS) {
+    u32 count = w2c_waiter_notify(&waiter_instance, 1);
+    woke_at_most_one &= count <= 1;
+    woken += count;
+    if (count == 0) {
+      THREAD_YIELD();
+    }
+  }
+  ASSERT_TRUE(woke_at_most_one);
+
+  for (int i = 0; i < NUM_WAITERS; ++i) {
+    THREAD_JOIN(threads[i]);
+  }
+  for (int i = 0; i < NUM_WAITERS; ++i) {
+    ASSERT_TRUE(g_wait_results[i] == 0);
+  }
+
+  /* No thread is left waiting. */
+  ASSERT_TRUE(w2c_waiter_notify(&waiter_instance, NUM_WAITERS) == 0);
+}
@@ -0,0 +1,18 @@
+/* Driver for call-indirect-imported-table.txt. */
+
+static void run_driver_tests(void) {
+  /* call_indirect in "b" compares the type of a function from "a" by
+   * pointer, so both modules must return the same pointer for a type. */
+  wasm_rt_func_type_t a_ii =
+      wasm2c_a_get_func_type(1, 1, WASM_RT_I32, WASM_RT_I32);
+  wasm_rt_func_type_t b_ii =
+      wasm2c_b_get_func_type(1, 1, WASM_RT_I32, WASM_RT_I32);
+  wasm_rt_func_type_t a_ll =
+      wasm2c_a_get_func_type(1, 1, WASM_RT_I64, WASM_RT_I64);
+  wasm_rt_func_type_t b_ll =
+      wasm2c_b_get_func_type(1, 1, WASM_RT_I64, WASM_RT_I64);
+  ASSERT_TRUE(a_ii != NULL && a_ii == b_ii);
+  ASSERT_TRUE(a_ll != NULL && a_ll == b_ll);
+  ASSERT_TRUE(a_ii != a_ll);
+  ASSERT_TRUE(wasm2c_b_get_func_type(0, 0) == NULL);
+}
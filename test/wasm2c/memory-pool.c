@@ -0,0 +1,49 @@
+/* Driver for memory-pool.txt. */
+
+static void run_driver_tests(void) {
+  wasm_rt_memory_pool_t pool;
+  ASSERT_TRUE(wasm_rt_memory_pool_init(&pool, 1, WASM_DEFAULT_PAGE_SIZE));
+  wasm_rt_memory_pool_install(&pool);
+
+  w2c_image first;
+  wasm2c_image_instantiate(&first);
+  ASSERT_TRUE(wasm_rt_memory_pool_hits(&pool) == 1);
+  ASSERT_TRUE(w2c_image_load(&first, 4096) == 'w');
+  ASSERT_TRUE(w2c_image_load(&first, 70000) == 'p');
+  /* Dirty the page that stays resident and the page after it. */
+  w2c_image_store(&first, 0, 1);
+  w2c_image_store(&first, 4097, 1);
+  w2c_image_store(&first, 100000, 1);
+
+  /* The pool has one slot, so a second memory maps its own. */
+  w2c_image second;
+  wasm2c_image_instantiate(&second);
+  ASSERT_TRUE(wasm_rt_memory_pool_hits(&pool) == 1);
+  ASSERT_TRUE(wasm_rt_memory_pool_misses(&pool) == 1);
+  wasm2c_image_free(&second);
+  wasm2c_image_free(&first);
+
+  /* A module without data gets the slot back with no trace of the data
+   * segments or the writes. */
+  w2c_plain plain;
+  wasm2c_plain_instantiate(&plain);
+  ASSERT_TRUE(wasm_rt_memory_pool_hits(&pool) == 2);
+  ASSERT_TRUE(w2c_plain_load(&plain, 0) == 0);
+  ASSERT_TRUE(w2c_plain_load(&plain, 4096) == 0);
+  ASSERT_TRUE(w2c_plain_load(&plain, 4097) == 0);
+  ASSERT_TRUE(w2c_plain_load(&plain, 70000) == 0);
+  ASSERT_TRUE(w2c_plain_load(&plain, 100000) == 0);
+  wasm2c_plain_free(&plain);
+
+  /* And the module with data gets its data segments back. */
+  wasm2c_image_instantiate(&first);
+  ASSERT_TRUE(wasm_rt_memory_pool_hits(&pool) == 3);
+  ASSERT_TRUE(w2c_image_load(&first, 0) == 0);
+  ASSERT_TRUE(w2c_image_load(&first, 4097) == 'a');
+  ASSERT_TRUE(w2c_image_load(&first, 100000) == 0);
+  wasm2c_image_free(&first);
+
+  ASSERT_TRUE(wasm_rt_memory_pool_misses(&pool) == 1);
+  wasm_rt_memory_pool_install(NULL);
+  wasm_rt_memory_pool_free(&pool);
+}
@@ -0,0 +1,39 @@
+;; A lock that is contended by all of the threads, built on wait and notify
+;; like a futex-based mutex: the lock at address 0 is 0 when unlocked, 1 when
+;; locked, and 2 when locked with waiters.
+(module
+  (import "env" "memory" (memory 1 1 shared))
+
+  (func $lock
+    (local $c i32)
+    (local.set $c
+      (i32.atomic.rmw.cmpxchg (i32.const 0) (i32.const 0) (i32.const 1)))
+    (if (i32.eqz (local.get $c))
+      (then (return)))
+    (if (i32.ne (local.get $c) (i32.const 2))
+      (then
+        (local.set $c (i32.atomic.rmw.xchg (i32.const 0) (i32.const 2)))))
+    (block $locked
+      (loop $retry
+        (br_if $locked (i32.eqz (local.get $c)))
+        (drop (memory.atomic.wait32 (i32.const 0) (i32.const 2) (i64.const -1)))
+        (local.set $c (i32.atomic.rmw.xchg (i32.const 0) (i32.const 2)))
+        (br $retry))))
+
+  (func $unlock
+    (if (i32.ne (i32.atomic.rmw.sub (i32.const 0) (i32.const 1)) (i32.const 1))
+      (then
+        (i32.atomic.store (i32.const 0) (i32.const 0))
+        (drop (memory.atomic.notify (i32.const 0) (i32.const 1))))))
+
+  ;; Increments the counter at address 4 `iterations` times, with the lock
+  ;; held.
+  (func (export "run") (param $iterations i32)
+    (loop $loop
+      (call $lock)
+      (i32.store (i32.const 4) (i32.add (i32.load (i32.const 4)) (i32.const 1)))
+      (call $unlock)
+      (br_if $loop
+        (local.tee $iterations
+          (i32.sub (local.get $iterations) (i32.const 1))))))
+)
@@ -0,0 +1,115 @@
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "contention.h"
+
+/**
+ * Measures memory.atomic.wait and memory.atomic.notify under contention.
+ *
+ * Each thread instantiates the module with the same shared memory, and then
+ * takes and releases a lock in it `iterations` times. The lock waits when it
+ * is contended, and is notified when it is released, so with more than one
+ * thread most of the time is spent in the runtime's wait and notify.
+ */
+
+#define DEFAULT_THREADS 4
+#define DEFAULT_ITERATIONS 1000000
+
+struct w2c_env {
+  wasm_rt_shared_memory_t memory;
+};
+
+wasm_rt_shared_memory_t* w2c_env_memory(struct w2c_env* env) {
+  return &env->memory;
+}
+
+static struct w2c_env env;
+static u32 iterations = DEFAULT_ITERATIONS;
+
+/* The threads start running together, once they have all instantiated. */
+static pthread_mutex_t start_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t start_cond = PTHREAD_COND_INITIALIZER;
+static int num_ready;
+static int started;
+
+static void* run_thread(void* arg) {
+  wasm_rt_init_thread();
+  w2c_contention inst;
+  wasm2c_contention_instantiate(&inst, &env);
+
+  pthread_mutex_lock(&start_mutex);
+  num_ready++;
+  pthread_cond_broadcast(&start_cond);
+  while (!started) {
+    pthread_cond_wait(&start_cond, &start_mutex);
+  }
+  pthread_mutex_unlock(&start_mutex);
+
+  w2c_contention_run(&inst, iterations);
+  wasm2c_contention_free(&inst);
+  wasm_rt_free_thread();
+  return NULL;
+}
+
+static double now_seconds(void) {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char** argv) {
+  int num_threads = argc > 1 ? atoi(argv[1]) : DEFAULT_THREADS;
+  if (argc > 2) {
+    iterations = (u32)strtoul(argv[2], NULL, 10);
+  }
+  if (num_threads <= 0 || iterations == 0) {
+    fprintf(stderr, "usage: %s [threads] [iterations]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  wasm_rt_init();
+  wasm_rt_allocate_memory_shared(&env.memory, 1, 1, false,
+                                 WASM_DEFAULT_PAGE_SIZE);
+
+  pthread_t* threads = calloc(num_threads, sizeof(pthread_t));
+  for (int i = 0; i < num_threads; ++i) {
+    if (pthread_create(&threads[i], NULL, run_thread, NULL)) {
+      perror("pthread_create");
+      return EXIT_FAILURE;
+    }
+  }
+
+  pthread_mutex_lock(&start_mutex);
+  while (num_ready < num_threads) {
+    pthread_cond_wait(&start_cond, &start_mutex);
+  }
+  double start = now_seconds();
+  started = 1;
+  pthread_cond_broadcast(&start_cond);
+  pthread_mutex_unlock(&start_mutex);
+
+  for (int i = 0; i < num_threads; ++i) {
+    pthread_join(threads[i], NULL);
+  }
+  double elapsed = now_seconds() - start;
+
+  /* The counter is only incremented with the lock held. */
+  u32 counter;
+  memcpy(&counter, (void*)(env.memory.data + 4), sizeof(counter));
+  u64 expected = (u64)num_threads * iterations;
+  if (counter != (u32)expected) {
+    fprintf(stderr, "Counter is %u, expected %u.\n", counter, (u32)expected);
+    return EXIT_FAILURE;
+  }
+
+  printf("%d threads, %u lock/unlock pairs each: %.3f s, %.1f ns per pair\n",
+         num_threads, iterations, elapsed, elapsed * 1e9 / expected);
+
+  free(threads);
+  wasm_rt_free_memory_shared(&env.memory);
+  wasm_rt_free();
+  return EXIT_SUCCESS;
+}
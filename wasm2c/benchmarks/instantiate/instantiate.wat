@@ -0,0 +1,20 @@
+;; A module whose instantiation is dominated by allocating its memory. It
+;; writes a byte to each of its pages, and checks that the memory was
+;; initialized: the bytes it writes must start out as zero.
+(module
+  (memory 16)
+  (data (i32.const 0) "instantiate")
+
+  (func (export "touch") (result i32)
+    (local $addr i32)
+    (local $dirty i32)
+    (loop $pages
+      (local.set $dirty
+        (i32.or (local.get $dirty)
+                (i32.load8_u offset=100 (local.get $addr))))
+      (i32.store8 offset=100 (local.get $addr) (i32.const 1))
+      (local.set $addr (i32.add (local.get $addr) (i32.const 65536)))
+      (br_if $pages (i32.lt_u (local.get $addr) (i32.const 0x100000))))
+    (i32.or (i32.shl (local.get $dirty) (i32.const 8))
+            (i32.load8_u (i32.const 0))))
+)
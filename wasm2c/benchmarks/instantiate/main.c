@@ -0,0 +1,96 @@
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "instantiate.h"
+
+/**
+ * Measures instantiating and freeing a module with a 1 MiB memory.
+ *
+ * Each thread instantiates the module, touches every page of its memory, and
+ * frees it `iterations` times. With a memory pool of `slots` slots, the
+ * memories are taken from the pool instead of being mapped and unmapped each
+ * time, and the first `keep_kib` KiB of each stay resident.
+ */
+
+#define DEFAULT_THREADS 4
+#define DEFAULT_SLOTS 4
+#define DEFAULT_KEEP_KIB 0
+#define DEFAULT_ITERATIONS 100000
+
+static u32 iterations = DEFAULT_ITERATIONS;
+
+static void* run_thread(void* arg) {
+  wasm_rt_init_thread();
+  for (u32 i = 0; i < iterations; ++i) {
+    w2c_instantiate inst;
+    wasm2c_instantiate_instantiate(&inst);
+    if (w2c_instantiate_touch(&inst) != 'i') {
+      fprintf(stderr, "Memory was not initialized correctly.\n");
+      abort();
+    }
+    wasm2c_instantiate_free(&inst);
+  }
+  wasm_rt_free_thread();
+  return NULL;
+}
+
+static double now_seconds(void) {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char** argv) {
+  int num_threads = argc > 1 ? atoi(argv[1]) : DEFAULT_THREADS;
+  int num_slots = argc > 2 ? atoi(argv[2]) : DEFAULT_SLOTS;
+  u64 keep_kib = argc > 3 ? strtoull(argv[3], NULL, 10) : DEFAULT_KEEP_KIB;
+  if (argc > 4) {
+    iterations = (u32)strtoul(argv[4], NULL, 10);
+  }
+  if (num_threads <= 0 || num_slots < 0 || iterations == 0) {
+    fprintf(stderr, "usage: %s [threads] [slots] [keep_kib] [iterations]\n",
+            argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  wasm_rt_init();
+  wasm_rt_memory_pool_t pool;
+  if (num_slots > 0) {
+    if (!wasm_rt_memory_pool_init(&pool, num_slots, keep_kib * 1024)) {
+      fprintf(stderr, "Memory pools are not supported.\n");
+      return EXIT_FAILURE;
+    }
+    wasm_rt_memory_pool_install(&pool);
+  }
+
+  double start = now_seconds();
+  pthread_t* threads = calloc(num_threads, sizeof(pthread_t));
+  for (int i = 0; i < num_threads; ++i) {
+    if (pthread_create(&threads[i], NULL, run_thread, NULL)) {
+      perror("pthread_create");
+      return EXIT_FAILURE;
+    }
+  }
+  for (int i = 0; i < num_threads; ++i) {
+    pthread_join(threads[i], NULL);
+  }
+  double elapsed = now_seconds() - start;
+
+  u64 total = (u64)num_threads * iterations;
+  printf("%d threads, %d slots, %llu KiB resident: %.3f s, %.1f us each",
+         num_threads, num_slots, (unsigned long long)keep_kib, elapsed,
+         elapsed * 1e6 / total);
+  if (num_slots > 0) {
+    printf(" (%llu hits, %llu misses)",
+           (unsigned long long)wasm_rt_memory_pool_hits(&pool),
+           (unsigned long long)wasm_rt_memory_pool_misses(&pool));
+    wasm_rt_memory_pool_free(&pool);
+  }
+  printf("\n");
+
+  free(threads);
+  wasm_rt_free();
+  return EXIT_SUCCESS;
+}
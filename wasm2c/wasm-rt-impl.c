@@ -357,6 +357,104 @@ void* wasm_rt_syscall_get_segue_base() {
 }
 #endif
 
+/*
+ * Function types are interned in an open-addressing hash set of their 256-bit
+ * IDs. The IDs are SHA-256 hashes, so their first bytes are already a good
+ * hash. The set only grows, so that interned types stay valid for the lifetime
+ * of the process.
+ */
+
+#define FUNC_TYPE_ID_SIZE 32
+
+static const char** g_func_types;
+static size_t g_func_types_capacity;
+static size_t g_func_types_count;
+
+#if WASM_RT_USE_CRITICALSECTION
+static SRWLOCK g_func_types_lock = SRWLOCK_INIT;
+#define FUNC_TYPES_LOCK() AcquireSRWLockExclusive(&g_func_types_lock)
+#define FUNC_TYPES_UNLOCK() ReleaseSRWLockExclusive(&g_func_types_lock)
+#elif WASM_RT_USE_PTHREADS
+static pthread_mutex_t g_func_types_lock = PTHREAD_MUTEX_INITIALIZER;
+#define FUNC_TYPES_LOCK() pthread_mutex_lock(&g_func_types_lock)
+#define FUNC_TYPES_UNLOCK() pthread_mutex_unlock(&g_func_types_lock)
+#else
+#define FUNC_TYPES_LOCK()
+#define FUNC_TYPES_UNLOCK()
+#endif
+
+static size_t func_type_hash(const char* id) {
+  size_t hash;
+  memcpy(&hash, id, sizeof(hash));
+  return hash;
+}
+
+/* Returns the slot that holds `id`, or the empty slot where it belongs. */
+static const char** find_func_type(const char** types,
+                                   size_t capacity,
+                                   const char* id) {
+  size_t mask = capacity - 1;
+  for (size_t i = func_type_hash(id) & mask;; i = (i + 1) & mask) {
+    if (!types[i] || memcmp(types[i], id, FUNC_TYPE_ID_SIZE) == 0) {
+      return &types[i];
+    }
+  }
+}
+
+static wasm_rt_func_type_t intern_func_type(const char* id) {
+  if ((g_func_types_count + 1) * 2 > g_func_types_capacity) {
+    size_t capacity = g_func_types_capacity ? g_func_types_capacity * 2 : 64;
+    const char** types = calloc(capacity, sizeof(const char*));
+    if (!types) {
+      abort();
+    }
+    for (size_t i = 0; i < g_func_types_capacity; i++) {
+      if (g_func_types[i]) {
+        *find_func_type(types, capacity, g_func_types[i]) = g_func_types[i];
+      }
+    }
+    free(g_func_types);
+    g_func_types = types;
+    g_func_types_capacity = capacity;
+  }
+
+  const char** slot = find_func_type(g_func_types, g_func_types_capacity, id);
+  if (!*slot) {
+    char* type = malloc(FUNC_TYPE_ID_SIZE);
+    if (!type) {
+      abort();
+    }
+    memcpy(type, id, FUNC_TYPE_ID_SIZE);
+    *slot = type;
+    g_func_types_count++;
+  }
+  return *slot;
+}
+
+wasm_rt_func_type_t wasm_rt_intern_func_type(const char* id) {
+  FUNC_TYPES_LOCK();
+  wasm_rt_func_type_t type = intern_func_type(id);
+  FUNC_TYPES_UNLOCK();
+  return type;
+}
+
+void wasm_rt_intern_func_types(bool* interned,
+                               const wasm_rt_func_type_init_t* types,
+                               uint32_t count) {
+  FUNC_TYPES_LOCK();
+  if (!*interned) {
+    for (uint32_t i = 0; i < count; i++) {
+      *types[i].type = intern_func_type(types[i].id);
+    }
+    *interned = true;
+  }
+  FUNC_TYPES_UNLOCK();
+}
+
+#undef FUNC_TYPES_UNLOCK
+#undef FUNC_TYPES_LOCK
+#undef FUNC_TYPE_ID_SIZE
+
 // Include table operations for funcref
 #define WASM_RT_TABLE_OPS_FUNCREF
 #include "wasm-rt-impl-tableops.inc"
@@ -394,6 +492,8 @@ const char* wasm_rt_strerror(wasm_rt_trap_t trap) {
       return "Uncaught exception";
     case WASM_RT_TRAP_UNALIGNED:
       return "Unaligned atomic memory access";
+    case WASM_RT_TRAP_UNSHARED_WAIT:
+      return "Atomic wait on an unshared memory";
     case WASM_RT_TRAP_NULL_REF:
       return "Null reference";
   }
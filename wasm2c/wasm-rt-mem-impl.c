@@ -19,10 +19,29 @@
 #include <assert.h>
 #include <stdio.h>
 
+#ifdef WASM_RT_C11_AVAILABLE
+#include <stdatomic.h>
+#endif
+
 #ifdef _WIN32
 #include <windows.h>
 #else
+#include <errno.h>
 #include <sys/mman.h>
+#include <time.h>
+#endif
+
+#if WASM_RT_USE_MMAP && WASM_RT_USE_MEMORY_IMAGES && defined(__linux__) && \
+    !WABT_BIG_ENDIAN
+#define WASM_RT_MAP_MEMORY_IMAGES 1
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#ifndef MFD_CLOEXEC
+#define MFD_CLOEXEC 0x0001U
+#endif
+#else
+#define WASM_RT_MAP_MEMORY_IMAGES 0
 #endif
 
 #ifdef WASM_RT_GROW_FAILED_HANDLER
@@ -140,6 +159,91 @@ static uint64_t get_alloc_size_for_mmap_default32(uint64_t max_pages) {
 
 #endif /* WASM_RT_USE_MMAP */
 
+#if defined(WASM_RT_C11_AVAILABLE) && WASM_RT_USE_MMAP && !defined(_WIN32)
+#define WASM_RT_MEMORY_POOLS_SUPPORTED 1
+#else
+#define WASM_RT_MEMORY_POOLS_SUPPORTED 0
+#endif
+
+#if WASM_RT_MEMORY_POOLS_SUPPORTED
+
+static wasm_rt_memory_pool_t* g_memory_pool;
+
+/* The free slot stack `free_slots`, updated to have `top` at the top. */
+static uint64_t memory_pool_set_top(uint64_t free_slots, uint32_t top) {
+  return ((free_slots >> 32) + 1) << 32 | top;
+}
+
+/* Returns a free slot of the installed pool, or NULL if there is none. */
+static uint8_t* memory_pool_acquire(void) {
+  wasm_rt_memory_pool_t* pool = g_memory_pool;
+  if (!pool) {
+    return NULL;
+  }
+  uint64_t free_slots = atomic_load(&pool->free_slots);
+  uint64_t new_free_slots;
+  uint32_t top;
+  do {
+    top = (uint32_t)free_slots;
+    if (top == 0) {
+      atomic_fetch_add_explicit(&pool->misses, 1, memory_order_relaxed);
+      return NULL;
+    }
+    uint32_t next = atomic_load(&pool->next_free[top - 1]);
+    new_free_slots = memory_pool_set_top(free_slots, next);
+  } while (!atomic_compare_exchange_weak(&pool->free_slots, &free_slots,
+                                         new_free_slots));
+  atomic_fetch_add_explicit(&pool->hits, 1, memory_order_relaxed);
+  return pool->base + (top - 1) * pool->slot_size;
+}
+
+/*
+ * Returns the slot at `addr` to the installed pool, or false if it isn't one
+ * of its slots. `used_size` bytes of the slot are accessible. The first
+ * `keep_resident` of them are zeroed, and the rest are replaced with fresh
+ * pages. Replacing them with mmap, rather than madvise(MADV_DONTNEED), also
+ * drops the pages mapped from a memory image.
+ */
+static bool memory_pool_release(uint8_t* addr,
+                                uint64_t mmap_size,
+                                uint64_t used_size) {
+  wasm_rt_memory_pool_t* pool = g_memory_pool;
+  if (!pool || addr < pool->base ||
+      addr >= pool->base + pool->num_slots * pool->slot_size) {
+    return false;
+  }
+
+  uint64_t keep =
+      used_size < pool->keep_resident ? used_size : pool->keep_resident;
+#if !WABT_BIG_ENDIAN
+  (void)mmap_size;
+  uint8_t* keep_begin = addr;
+  uint8_t* reset_begin = addr + keep;
+#else
+  uint8_t* keep_begin = addr + mmap_size - keep;
+  uint8_t* reset_begin = addr + mmap_size - used_size;
+#endif
+  memset(keep_begin, 0, keep);
+  if ((keep != 0 && mprotect(keep_begin, keep, PROT_NONE) != 0) ||
+      (used_size != keep &&
+       mmap(reset_begin, used_size - keep, PROT_NONE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0) == MAP_FAILED)) {
+    os_print_last_error("Resetting a memory pool slot failed.");
+    abort();
+  }
+
+  uint32_t index = (uint32_t)((addr - pool->base) / pool->slot_size);
+  uint64_t free_slots = atomic_load(&pool->free_slots);
+  do {
+    atomic_store(&pool->next_free[index], (uint32_t)free_slots);
+  } while (!atomic_compare_exchange_weak(
+      &pool->free_slots, &free_slots,
+      memory_pool_set_top(free_slots, index + 1)));
+  return true;
+}
+
+#endif /* WASM_RT_MEMORY_POOLS_SUPPORTED */
+
 static bool u64_mult_overflow(uint64_t a, uint64_t b, uint64_t* result) {
   uint64_t x = a * b;
   *result = x;
@@ -160,6 +264,466 @@ static bool u64_mult_overflow(uint64_t a, uint64_t b, uint64_t* result) {
 #include "wasm-rt-mem-impl-helper.inc"
 #undef WASM_RT_MEM_OPS_SHARED
 
+#ifdef WASM_RT_C11_AVAILABLE
+
+bool wasm_rt_memory_pool_init(wasm_rt_memory_pool_t* pool,
+                              uint32_t num_slots,
+                              uint64_t keep_resident) {
+#if WASM_RT_MEMORY_POOLS_SUPPORTED
+  const uint64_t slot_size = get_alloc_size_for_mmap_default32(0);
+  if (num_slots == 0 || num_slots > UINT64_MAX / slot_size) {
+    return false;
+  }
+  pool->next_free = malloc(num_slots * sizeof(*pool->next_free));
+  if (!pool->next_free) {
+    return false;
+  }
+  pool->base = os_mmap(num_slots * slot_size);
+  if (!pool->base) {
+    free(pool->next_free);
+    return false;
+  }
+  pool->slot_size = slot_size;
+  pool->num_slots = num_slots;
+  /* Whole Wasm pages, so that the rest of the memory is page-aligned. */
+  pool->keep_resident = keep_resident / WASM_DEFAULT_PAGE_SIZE *
+                        WASM_DEFAULT_PAGE_SIZE;
+  for (uint32_t i = 0; i < num_slots; i++) {
+    atomic_init(&pool->next_free[i], i);
+  }
+  atomic_init(&pool->free_slots, num_slots);
+  atomic_init(&pool->hits, 0);
+  atomic_init(&pool->misses, 0);
+  return true;
+#else
+  return false;
+#endif
+}
+
+void wasm_rt_memory_pool_install(wasm_rt_memory_pool_t* pool) {
+#if WASM_RT_MEMORY_POOLS_SUPPORTED
+  g_memory_pool = pool;
+#endif
+}
+
+void wasm_rt_memory_pool_free(wasm_rt_memory_pool_t* pool) {
+#if WASM_RT_MEMORY_POOLS_SUPPORTED
+  if (g_memory_pool == pool) {
+    g_memory_pool = NULL;
+  }
+  os_munmap(pool->base, pool->num_slots * pool->slot_size);
+  free(pool->next_free);
+  pool->base = NULL;
+  pool->next_free = NULL;
+#endif
+}
+
+uint64_t wasm_rt_memory_pool_hits(const wasm_rt_memory_pool_t* pool) {
+  return atomic_load_explicit(&pool->hits, memory_order_relaxed);
+}
+
+uint64_t wasm_rt_memory_pool_misses(const wasm_rt_memory_pool_t* pool) {
+  return atomic_load_explicit(&pool->misses, memory_order_relaxed);
+}
+
+#endif /* WASM_RT_C11_AVAILABLE */
+
+static void copy_memory_image(wasm_rt_memory_t* memory,
+                              const wasm_rt_data_segment_t* segments,
+                              uint32_t num_segments) {
+  for (uint32_t i = 0; i < num_segments; i++) {
+    const wasm_rt_data_segment_t* segment = &segments[i];
+    if (segment->offset > memory->size ||
+        segment->size > memory->size - segment->offset) {
+      wasm_rt_trap(WASM_RT_TRAP_OOB);
+    }
+    if (segment->size == 0) {
+      continue;
+    }
+#if WABT_BIG_ENDIAN
+    uint8_t* dest = memory->data_end - segment->offset - segment->size;
+    for (uint64_t j = 0; j < segment->size; j++) {
+      dest[j] = segment->data[segment->size - j - 1];
+    }
+#else
+    memcpy(memory->data + segment->offset, segment->data, segment->size);
+#endif
+  }
+}
+
+#if WASM_RT_MAP_MEMORY_IMAGES
+
+/*
+ * A memory image is an in-memory file (memfd) with the data segments written
+ * at their offsets, so that the pages holding them can be mapped into each
+ * memory with MAP_PRIVATE. Pages without data stay anonymous and zero. Images
+ * are built on first use and kept for the lifetime of the process.
+ */
+
+static pthread_mutex_t g_memory_image_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static int compare_memory_image_ranges(const void* a, const void* b) {
+  const wasm_rt_memory_image_range_t* lhs = a;
+  const wasm_rt_memory_image_range_t* rhs = b;
+  return lhs->offset < rhs->offset ? -1 : lhs->offset > rhs->offset;
+}
+
+static bool write_memory_image_segment(int fd,
+                                       const wasm_rt_data_segment_t* segment) {
+  uint64_t written = 0;
+  while (written < segment->size) {
+    ssize_t ret = pwrite(fd, segment->data + written, segment->size - written,
+                         (off_t)(segment->offset + written));
+    if (ret < 0 && errno == EINTR) {
+      continue;
+    }
+    if (ret <= 0) {
+      return false;
+    }
+    written += (uint64_t)ret;
+  }
+  return true;
+}
+
+static void build_memory_image(wasm_rt_memory_image_t* image,
+                               const wasm_rt_data_segment_t* segments,
+                               uint32_t num_segments) {
+  image->fd = -1;
+  image->ranges = NULL;
+  image->num_ranges = 0;
+
+  const uint64_t page_size = (uint64_t)sysconf(_SC_PAGESIZE);
+  wasm_rt_memory_image_range_t* ranges =
+      malloc(num_segments * sizeof(wasm_rt_memory_image_range_t));
+  if (num_segments == 0 || !ranges) {
+    free(ranges);
+    return;
+  }
+
+  /* The host pages that each segment touches, sorted and merged. */
+  uint32_t num_ranges = 0;
+  for (uint32_t i = 0; i < num_segments; i++) {
+    const wasm_rt_data_segment_t* segment = &segments[i];
+    if (segment->size == 0) {
+      continue;
+    }
+    uint64_t begin = segment->offset / page_size * page_size;
+    uint64_t end = (segment->offset + segment->size + page_size - 1) /
+                   page_size * page_size;
+    ranges[num_ranges].offset = begin;
+    ranges[num_ranges].size = end - begin;
+    num_ranges++;
+  }
+  if (num_ranges == 0) {
+    free(ranges);
+    return;
+  }
+  qsort(ranges, num_ranges, sizeof(wasm_rt_memory_image_range_t),
+        compare_memory_image_ranges);
+  uint32_t merged = 0;
+  for (uint32_t i = 1; i < num_ranges; i++) {
+    wasm_rt_memory_image_range_t* last = &ranges[merged];
+    if (ranges[i].offset <= last->offset + last->size) {
+      uint64_t end = ranges[i].offset + ranges[i].size;
+      if (end > last->offset + last->size) {
+        last->size = end - last->offset;
+      }
+    } else {
+      ranges[++merged] = ranges[i];
+    }
+  }
+  num_ranges = merged + 1;
+
+  const wasm_rt_memory_image_range_t* last = &ranges[num_ranges - 1];
+  int fd = (int)syscall(SYS_memfd_create, "wasm2c-memory-image", MFD_CLOEXEC);
+  if (fd < 0) {
+    free(ranges);
+    return;
+  }
+  bool ok = ftruncate(fd, (off_t)(last->offset + last->size)) == 0;
+  /* Segments are written in order, so that later ones overwrite earlier. */
+  for (uint32_t i = 0; ok && i < num_segments; i++) {
+    ok = write_memory_image_segment(fd, &segments[i]);
+  }
+  if (!ok) {
+    close(fd);
+    free(ranges);
+    return;
+  }
+
+  image->fd = fd;
+  image->ranges = ranges;
+  image->num_ranges = num_ranges;
+}
+
+#endif /* WASM_RT_MAP_MEMORY_IMAGES */
+
+void wasm_rt_load_memory_image(wasm_rt_memory_t* memory,
+                               wasm_rt_memory_image_t* image,
+                               const wasm_rt_data_segment_t* segments,
+                               uint32_t num_segments) {
+#if WASM_RT_MAP_MEMORY_IMAGES
+  /*
+   * If a segment is out of bounds, copying the segments traps after loading
+   * the ones before it, as the spec requires.
+   */
+  bool in_bounds = wasm_rt_memory_is_default32(memory);
+  for (uint32_t i = 0; in_bounds && i < num_segments; i++) {
+    in_bounds = segments[i].offset <= memory->size &&
+                segments[i].size <= memory->size - segments[i].offset;
+  }
+  if (in_bounds) {
+    if (pthread_mutex_lock(&g_memory_image_lock) != 0) {
+      abort();
+    }
+    if (!image->initialized) {
+      build_memory_image(image, segments, num_segments);
+      image->initialized = true;
+    }
+    pthread_mutex_unlock(&g_memory_image_lock);
+
+    const wasm_rt_memory_image_range_t* last =
+        image->fd >= 0 ? &image->ranges[image->num_ranges - 1] : NULL;
+    if (last && last->offset + last->size <= memory->size) {
+      for (uint32_t i = 0; i < image->num_ranges; i++) {
+        const wasm_rt_memory_image_range_t* range = &image->ranges[i];
+        void* addr = mmap(memory->data + range->offset, range->size,
+                          PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED,
+                          image->fd, (off_t)range->offset);
+        if (addr == MAP_FAILED) {
+          os_print_last_error("mmap of memory image failed.");
+          abort();
+        }
+      }
+      return;
+    }
+  }
+#endif
+  copy_memory_image(memory, segments, num_segments);
+}
+
+#ifdef WASM_RT_C11_AVAILABLE
+
+/*
+ * memory.atomic.wait and memory.atomic.notify are implemented with a "parking
+ * lot": the waiting threads are kept in a fixed number of buckets, hashed by
+ * the address that they wait on. Each bucket has a lock and a FIFO list of its
+ * waiters, and each waiter blocks on its own condition variable, so that a
+ * notify wakes exactly the threads that it counts.
+ */
+
+#define PARKING_LOT_BUCKETS 64
+#define NANOSECONDS_PER_SECOND 1000000000
+
+typedef struct parking_lot_waiter {
+  volatile void* addr;
+  bool woken;
+  struct parking_lot_waiter* next;
+#if WASM_RT_USE_CRITICALSECTION
+  CONDITION_VARIABLE cond;
+#elif WASM_RT_USE_PTHREADS
+  pthread_cond_t cond;
+#endif
+} parking_lot_waiter;
+
+typedef struct {
+  WASM_RT_MUTEX lock;
+  parking_lot_waiter* head;
+  parking_lot_waiter* tail;
+} parking_lot_bucket;
+
+static parking_lot_bucket g_parking_lot[PARKING_LOT_BUCKETS];
+
+#if WASM_RT_USE_CRITICALSECTION
+
+#define PARKING_LOT_LOCK_AQUIRE(name) WIN_MEMORY_LOCK_AQUIRE(name)
+#define PARKING_LOT_LOCK_RELEASE(name) WIN_MEMORY_LOCK_RELEASE(name)
+
+static INIT_ONCE g_parking_lot_once = INIT_ONCE_STATIC_INIT;
+
+static BOOL CALLBACK parking_lot_init(PINIT_ONCE once,
+                                     PVOID param,
+                                     PVOID* context) {
+  for (int i = 0; i < PARKING_LOT_BUCKETS; i++) {
+    WIN_MEMORY_LOCK_VAR_INIT(g_parking_lot[i].lock);
+  }
+  return TRUE;
+}
+
+#elif WASM_RT_USE_PTHREADS
+
+#define PARKING_LOT_LOCK_AQUIRE(name) PTHREAD_MEMORY_LOCK_AQUIRE(name)
+#define PARKING_LOT_LOCK_RELEASE(name) PTHREAD_MEMORY_LOCK_RELEASE(name)
+
+/* macOS can't time condition variables with the monotonic clock. */
+#ifdef __APPLE__
+#define PARKING_LOT_CLOCK CLOCK_REALTIME
+#else
+#define PARKING_LOT_CLOCK CLOCK_MONOTONIC
+#endif
+
+static pthread_once_t g_parking_lot_once = PTHREAD_ONCE_INIT;
+static pthread_condattr_t g_parking_lot_condattr;
+
+static void parking_lot_init(void) {
+  for (int i = 0; i < PARKING_LOT_BUCKETS; i++) {
+    PTHREAD_MEMORY_LOCK_VAR_INIT(g_parking_lot[i].lock);
+  }
+  pthread_condattr_init(&g_parking_lot_condattr);
+#ifndef __APPLE__
+  pthread_condattr_setclock(&g_parking_lot_condattr, PARKING_LOT_CLOCK);
+#endif
+}
+
+#endif
+
+static parking_lot_bucket* parking_lot_get_bucket(volatile void* addr) {
+#if WASM_RT_USE_CRITICALSECTION
+  InitOnceExecuteOnce(&g_parking_lot_once, parking_lot_init, NULL, NULL);
+#elif WASM_RT_USE_PTHREADS
+  pthread_once(&g_parking_lot_once, parking_lot_init);
+#endif
+  /* Wait and notify addresses are aligned to at least 4 bytes. */
+  return &g_parking_lot[((uintptr_t)addr >> 2) % PARKING_LOT_BUCKETS];
+}
+
+static void parking_lot_remove(parking_lot_bucket* bucket,
+                               parking_lot_waiter* waiter) {
+  parking_lot_waiter* prev = NULL;
+  for (parking_lot_waiter* iter = bucket->head; iter != waiter;
+       iter = iter->next) {
+    prev = iter;
+  }
+  if (prev) {
+    prev->next = waiter->next;
+  } else {
+    bucket->head = waiter->next;
+  }
+  if (bucket->tail == waiter) {
+    bucket->tail = prev;
+  }
+}
+
+/*
+ * Blocks the calling thread on `addr` until it is woken or `timeout`
+ * nanoseconds have passed, and returns 0 or 2 respectively. Must be called
+ * with the bucket's lock held.
+ */
+static uint32_t parking_lot_park(parking_lot_bucket* bucket,
+                                 volatile void* addr,
+                                 int64_t timeout) {
+  parking_lot_waiter waiter;
+  waiter.addr = addr;
+  waiter.woken = false;
+  waiter.next = NULL;
+  if (bucket->tail) {
+    bucket->tail->next = &waiter;
+  } else {
+    bucket->head = &waiter;
+  }
+  bucket->tail = &waiter;
+
+#if WASM_RT_USE_CRITICALSECTION
+  InitializeConditionVariable(&waiter.cond);
+  ULONGLONG deadline = 0;
+  if (timeout >= 0) {
+    deadline = GetTickCount64() + (timeout + 999999) / 1000000;
+  }
+  while (!waiter.woken) {
+    DWORD milliseconds = INFINITE;
+    if (timeout >= 0) {
+      ULONGLONG now = GetTickCount64();
+      if (now >= deadline) {
+        break;
+      }
+      milliseconds = deadline - now < INFINITE ? (DWORD)(deadline - now)
+                                               : INFINITE - 1;
+    }
+    SleepConditionVariableCS(&waiter.cond, &bucket->lock, milliseconds);
+  }
+#elif WASM_RT_USE_PTHREADS
+  pthread_cond_init(&waiter.cond, &g_parking_lot_condattr);
+  struct timespec deadline;
+  if (timeout >= 0) {
+    clock_gettime(PARKING_LOT_CLOCK, &deadline);
+    deadline.tv_sec += timeout / NANOSECONDS_PER_SECOND;
+    deadline.tv_nsec += timeout % NANOSECONDS_PER_SECOND;
+    if (deadline.tv_nsec >= NANOSECONDS_PER_SECOND) {
+      deadline.tv_sec++;
+      deadline.tv_nsec -= NANOSECONDS_PER_SECOND;
+    }
+  }
+  while (!waiter.woken) {
+    if (timeout < 0) {
+      pthread_cond_wait(&waiter.cond, &bucket->lock);
+    } else if (pthread_cond_timedwait(&waiter.cond, &bucket->lock,
+                                      &deadline) == ETIMEDOUT) {
+      break;
+    }
+  }
+  pthread_cond_destroy(&waiter.cond);
+#endif
+
+  /* The waiter may have been woken after the wait timed out. */
+  if (!waiter.woken) {
+    parking_lot_remove(bucket, &waiter);
+    return 2;
+  }
+  return 0;
+}
+
+/*
+ * The value is compared with the bucket's lock held, so that a notify after
+ * the value is changed can't be missed.
+ */
+#define DEFINE_ATOMIC_WAIT(name, t)                                        \
+  uint32_t name(_Atomic volatile t* addr, t expected, int64_t timeout) { \
+    volatile void* key = (volatile void*)addr;                           \
+    parking_lot_bucket* bucket = parking_lot_get_bucket(key);            \
+    PARKING_LOT_LOCK_AQUIRE(bucket->lock);                               \
+    uint32_t result = 1;                                                 \
+    if (atomic_load(addr) == expected) {                                 \
+      result = parking_lot_park(bucket, key, timeout);                   \
+    }                                                                    \
+    PARKING_LOT_LOCK_RELEASE(bucket->lock);                              \
+    return result;                                                       \
+  }
+
+DEFINE_ATOMIC_WAIT(wasm_rt_atomic_wait32, uint32_t)
+DEFINE_ATOMIC_WAIT(wasm_rt_atomic_wait64, uint64_t)
+
+uint32_t wasm_rt_atomic_notify(volatile void* addr, uint32_t count) {
+  parking_lot_bucket* bucket = parking_lot_get_bucket(addr);
+  PARKING_LOT_LOCK_AQUIRE(bucket->lock);
+  uint32_t woken = 0;
+  parking_lot_waiter* waiter = bucket->head;
+  while (waiter && woken < count) {
+    parking_lot_waiter* next = waiter->next;
+    if (waiter->addr == addr) {
+      parking_lot_remove(bucket, waiter);
+      waiter->woken = true;
+#if WASM_RT_USE_CRITICALSECTION
+      WakeConditionVariable(&waiter->cond);
+#elif WASM_RT_USE_PTHREADS
+      pthread_cond_signal(&waiter->cond);
+#endif
+      woken++;
+    }
+    waiter = next;
+  }
+  PARKING_LOT_LOCK_RELEASE(bucket->lock);
+  return woken;
+}
+
+#undef DEFINE_ATOMIC_WAIT
+#undef PARKING_LOT_CLOCK
+#undef PARKING_LOT_LOCK_RELEASE
+#undef PARKING_LOT_LOCK_AQUIRE
+#undef NANOSECONDS_PER_SECOND
+#undef PARKING_LOT_BUCKETS
+
+#endif /* WASM_RT_C11_AVAILABLE */
+
 #undef C11_MEMORY_LOCK_VAR_INIT
 #undef C11_MEMORY_LOCK_AQUIRE
 #undef C11_MEMORY_LOCK_RELEASE
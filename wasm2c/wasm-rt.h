@@ -132,6 +132,15 @@ extern "C" {
 #endif
 #endif
 
+/**
+ * If enabled, the initial contents of mmap-ed memories are mapped copy-on-write
+ * from an image of the module's data segments, instead of being copied into
+ * each instance. This is only supported on Linux.
+ */
+#ifndef WASM_RT_USE_MEMORY_IMAGES
+#define WASM_RT_USE_MEMORY_IMAGES 0
+#endif
+
 /**
  * This macro, if defined, allows the embedder to permit elimination of unused
  * memory loads. Note, this a non conformant configuration, i.e., this does not
@@ -406,6 +415,10 @@ typedef enum {
 #else
   WASM_RT_TRAP_EXHAUSTION, /** Call stack exhausted. */
 #endif
+  /** Atomic wait on an unshared memory. Traps are only ever appended, so that
+   * the existing values don't change; this is the value after an unmerged
+   * WASM_RT_TRAP_EXHAUSTION. */
+  WASM_RT_TRAP_UNSHARED_WAIT = WASM_RT_TRAP_UNALIGNED + 2,
 } wasm_rt_trap_t;
 
 /** Value types. Used to define function signatures. */
@@ -441,10 +454,18 @@ typedef struct wasm_rt_tailcallee_t {
 
 /**
  * The type of a function (an arbitrary number of param and result types).
- * This is represented as an opaque 256-bit ID.
+ * This is represented as an opaque 256-bit ID. The generated code interns the
+ * IDs with `wasm_rt_intern_func_type`, so equal types from any module are the
+ * same pointer.
  */
 typedef const char* wasm_rt_func_type_t;
 
+/** A function type to intern, and where to store the interned type. */
+typedef struct {
+  wasm_rt_func_type_t* type;
+  const char* id;
+} wasm_rt_func_type_init_t;
+
 /**
  * A function instance (the runtime representation of a function).
  * These can be stored in tables of type funcref, or used as values.
@@ -635,6 +656,21 @@ const char* wasm_rt_strerror(wasm_rt_trap_t trap);
 
 #define wasm_rt_try(target) WASM_RT_SETJMP_EXN(target)
 
+/**
+ * Return the canonical type for the 256-bit function type ID `id`: the same
+ * pointer is returned for every equal ID, for the lifetime of the process.
+ */
+wasm_rt_func_type_t wasm_rt_intern_func_type(const char* id);
+
+/**
+ * Intern `count` function types and store them, unless `*interned` is set.
+ * Sets `*interned`. This is called by the generated code when a module is
+ * instantiated, and is safe to call from several threads at once.
+ */
+void wasm_rt_intern_func_types(bool* interned,
+                               const wasm_rt_func_type_init_t* types,
+                               uint32_t count);
+
 /** WebAssembly's default page size (64 KiB) */
 #define WASM_DEFAULT_PAGE_SIZE 65536
 
@@ -675,6 +711,57 @@ uint64_t wasm_rt_grow_memory(wasm_rt_memory_t*, uint64_t pages);
 /** Free a Memory object. */
 void wasm_rt_free_memory(wasm_rt_memory_t*);
 
+/** An active data segment, and the offset in memory that it is loaded at. */
+typedef struct {
+  uint64_t offset;
+  const uint8_t* data;
+  uint64_t size;
+} wasm_rt_data_segment_t;
+
+/** One run of host pages of a memory image that contains data. */
+typedef struct {
+  uint64_t offset;
+  uint64_t size;
+} wasm_rt_memory_image_range_t;
+
+/**
+ * The initial contents of a memory, shared by all the instances of a module.
+ * Must be zero-initialized before its first use; the runtime fills it in the
+ * first time that it is loaded.
+ */
+typedef struct {
+  /** Set once the runtime has tried to build the image. */
+  bool initialized;
+  /** The file that holds the image, or -1 if the image could not be built. */
+  int fd;
+  /** The runs of host pages that are mapped from the file. */
+  wasm_rt_memory_image_range_t* ranges;
+  uint32_t num_ranges;
+} wasm_rt_memory_image_t;
+
+/**
+ * Load the active data segments `segments` into a freshly allocated Memory
+ * object, in order. Traps if a segment is out of bounds.
+ *
+ * If the runtime is built with WASM_RT_USE_MEMORY_IMAGES on Linux, the
+ * segments are written once to a read-only file, `image`, and the pages that
+ * hold them are mapped into the memory copy-on-write, so that instantiating
+ * the module copies no data and the instances share the pages that they don't
+ * write to. Otherwise, and for memories that are not mmap-ed, the segments
+ * are copied into the memory as usual.
+ *
+ *  ```
+ *    static wasm_rt_memory_image_t my_image;
+ *    static const uint8_t hello[] = "hello";
+ *    wasm_rt_data_segment_t segments[] = {{16, hello, 5}};
+ *    wasm_rt_load_memory_image(&my_memory, &my_image, segments, 1);
+ *  ```
+ */
+void wasm_rt_load_memory_image(wasm_rt_memory_t*,
+                               wasm_rt_memory_image_t* image,
+                               const wasm_rt_data_segment_t* segments,
+                               uint32_t num_segments);
+
 #ifdef WASM_RT_C11_AVAILABLE
 /** Shared memory version of wasm_rt_allocate_memory */
 void wasm_rt_allocate_memory_shared(wasm_rt_shared_memory_t*,
@@ -688,6 +775,86 @@ uint64_t wasm_rt_grow_memory_shared(wasm_rt_shared_memory_t*, uint64_t pages);
 
 /** Shared memory version of wasm_rt_free_memory */
 void wasm_rt_free_memory_shared(wasm_rt_shared_memory_t*);
+
+/**
+ * A pool of pre-reserved address space for mmap-ed memories. Each slot is a
+ * whole memory reservation, including its guard pages. Freeing a memory that
+ * came from the pool returns its slot instead of unmapping it.
+ */
+typedef struct {
+  /** The reservation holding all of the slots. */
+  uint8_t* base;
+  /** The size in bytes of each slot. */
+  uint64_t slot_size;
+  uint32_t num_slots;
+  /**
+   * How many bytes at the start of a memory stay resident when its slot is
+   * returned. They are zeroed instead of being given back to the OS.
+   */
+  uint64_t keep_resident;
+  /**
+   * The free slots, as a stack: the low 32 bits are the index of the top slot
+   * plus one (or 0 if the stack is empty), and the high 32 bits are a counter
+   * that changes on every update.
+   */
+  _Atomic uint64_t free_slots;
+  /** For each slot in the stack, the index plus one of the slot below it. */
+  _Atomic uint32_t* next_free;
+  /** Read with wasm_rt_memory_pool_hits. */
+  _Atomic uint64_t hits;
+  /** Read with wasm_rt_memory_pool_misses. */
+  _Atomic uint64_t misses;
+} wasm_rt_memory_pool_t;
+
+/**
+ * Reserve a pool with `num_slots` slots. Returns false if pools are not
+ * supported (they need WASM_RT_USE_MMAP and a POSIX OS) or the reservation
+ * fails.
+ */
+bool wasm_rt_memory_pool_init(wasm_rt_memory_pool_t*,
+                              uint32_t num_slots,
+                              uint64_t keep_resident);
+
+/**
+ * Make `pool` the pool that memories are allocated from, or stop using one if
+ * it is NULL. Must not be called while memories are being allocated or freed,
+ * and a pool must stay installed until all of its memories have been freed.
+ */
+void wasm_rt_memory_pool_install(wasm_rt_memory_pool_t* pool);
+
+/** Release a pool's reservation. All of its slots must be free. */
+void wasm_rt_memory_pool_free(wasm_rt_memory_pool_t*);
+
+/** The number of memory allocations that got a slot from `pool`. */
+uint64_t wasm_rt_memory_pool_hits(const wasm_rt_memory_pool_t* pool);
+
+/**
+ * The number of memory allocations that found `pool` empty, and mapped their
+ * own memory.
+ */
+uint64_t wasm_rt_memory_pool_misses(const wasm_rt_memory_pool_t* pool);
+
+/**
+ * Implements memory.atomic.wait32 on a shared memory. Blocks the calling thread
+ * until `wasm_rt_atomic_notify` wakes it, or until `timeout` nanoseconds have
+ * passed if the timeout is not negative. Returns 0 if the thread was woken, 1
+ * if `*addr` was not `expected`, or 2 if the wait timed out.
+ */
+uint32_t wasm_rt_atomic_wait32(_Atomic volatile uint32_t* addr,
+                               uint32_t expected,
+                               int64_t timeout);
+
+/** 64-bit version of wasm_rt_atomic_wait32 */
+uint32_t wasm_rt_atomic_wait64(_Atomic volatile uint64_t* addr,
+                               uint64_t expected,
+                               int64_t timeout);
+
+/**
+ * Implements memory.atomic.notify on a shared memory. Wakes up to `count` of
+ * the threads waiting on `addr`, in the order that they started waiting, and
+ * returns the number of threads woken.
+ */
+uint32_t wasm_rt_atomic_notify(volatile void* addr, uint32_t count);
 #endif
 
 /**